@@ -0,0 +1,434 @@
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "types.h"
+
+#include "empirical_degree_distribution.h"
+#include "event_queue.h"
+#include "event_queue_backend.h"
+#include "int_degree_distribution.h"
+#include "logger.h"
+#include "metrics.h"
+#include "network.h"
+#include "network_builder.h"
+#include "random_stream.h"
+#include "result_writer.h"
+
+// the allocations of the benchmarked code are counted by replacing the global
+// allocation functions, with METRICS they are replaced by the metrics
+#ifdef METRICS
+
+namespace
+{
+
+uint64_t get_allocated_bytes()
+{
+   return simulator::metrics::get_allocated_bytes();
+}
+
+} // namespace
+
+#else
+
+namespace
+{
+
+std::atomic<uint64_t> allocatedBytes {0U};
+
+uint64_t get_allocated_bytes()
+{
+   return allocatedBytes.load(std::memory_order_relaxed);
+}
+
+} // namespace
+
+void *operator new(std::size_t size)
+{
+   allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+   if(void *pointer = std::malloc(size == 0U ? 1U : size))
+   {
+      return pointer;
+   }
+   throw std::bad_alloc {};
+}
+
+void *operator new[](std::size_t size)
+{
+   return operator new(size);
+}
+
+void operator delete(void *pointer) noexcept
+{
+   std::free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+   std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+   std::free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept
+{
+   std::free(pointer);
+}
+
+#endif
+
+namespace simulator
+{
+
+namespace
+{
+
+// every benchmark is repeated until it ran for at least this long
+constexpr double minDurationInSeconds {0.5};
+constexpr uint64_t masterSeed {1U};
+
+// prints one CSV line; an operation is what the benchmark does in one step,
+// e.g. a pair of push and pop or the construction of one network
+void measure(const std::string &name,
+             const std::string &parameter,
+             const uint64_t numOfOperationsPerRun,
+             const std::function<void()> &setup,
+             const std::function<void()> &run)
+{
+   uint64_t numOfRuns {0U};
+   uint64_t bytes {0U};
+   double seconds {0.0};
+   while(seconds < minDurationInSeconds)
+   {
+      setup();
+      const uint64_t bytesBefore {get_allocated_bytes()};
+      const auto start {std::chrono::steady_clock::now()};
+      run();
+      const auto stop {std::chrono::steady_clock::now()};
+      bytes += get_allocated_bytes() - bytesBefore;
+      seconds += std::chrono::duration<double>(stop - start).count();
+      ++numOfRuns;
+   }
+
+   const double numOfOperations {static_cast<double>(numOfRuns * numOfOperationsPerRun)};
+   std::cout << name << "," << parameter << "," << numOfOperations << ","
+             << seconds * 1e9 / numOfOperations << "," << numOfOperations / seconds << ","
+             << bytes / numOfOperations << std::endl;
+}
+
+network_properties create_network_properties(const degree_distribution_type type,
+                                             const uint32_t numOfNodes,
+                                             const sampling_method samplingMethod,
+                                             const std::string &histogramFile)
+{
+   network_properties networkProperties {};
+   networkProperties.mNumOfNodes = numOfNodes;
+   networkProperties.mCharacteristicTime = 1.0;
+   networkProperties.mDegreeDistributionType = type;
+   networkProperties.mKMin = 1U;
+   networkProperties.mSamplingMethod = samplingMethod;
+   networkProperties.mDanglingConnectionsOk = true;
+   networkProperties.mLoopsOk = true;
+   networkProperties.mNetworkBuilderType = network_builder_type::sequential;
+   networkProperties.mMultiEdgeHandling = multi_edge_handling::keep;
+
+   switch(type)
+   {
+      case degree_distribution_type::constant:
+         networkProperties.mKMin = 3U;
+         break;
+      case degree_distribution_type::uniform:
+         networkProperties.mDegreeDistributionParameter1 = 8.0;
+         break;
+      case degree_distribution_type::power_law:
+         networkProperties.mDegreeDistributionParameter1 = 2.5;
+         break;
+      case degree_distribution_type::poisson:
+         networkProperties.mDegreeDistributionParameter1 = 4.5;
+         break;
+      case degree_distribution_type::negative_binomial:
+         networkProperties.mDegreeDistributionParameter1 = 0.4;
+         networkProperties.mDegreeDistributionParameter2 = 5.0;
+         break;
+      case degree_distribution_type::empirical:
+         networkProperties.mDegreeHistogram =
+            empirical_degree_distribution::load_histogram(networkProperties.mKMin, histogramFile);
+         break;
+      case degree_distribution_type::invalid:
+      default:
+         break;
+   }
+
+   return networkProperties;
+}
+
+std::string to_string(const degree_distribution_type type)
+{
+   switch(type)
+   {
+      case degree_distribution_type::constant:
+         return "constant";
+      case degree_distribution_type::uniform:
+         return "uniform";
+      case degree_distribution_type::power_law:
+         return "power_law";
+      case degree_distribution_type::poisson:
+         return "poisson";
+      case degree_distribution_type::negative_binomial:
+         return "negative_binomial";
+      case degree_distribution_type::empirical:
+         return "empirical";
+      case degree_distribution_type::invalid:
+      default:
+         return "invalid";
+   }
+}
+
+std::string to_string(const sampling_method samplingMethod)
+{
+   return sampling_method::alias_table == samplingMethod ? "alias_table" : "piecewise_constant";
+}
+
+const std::vector<degree_distribution_type> degreeDistributionTypes {
+   degree_distribution_type::constant,
+   degree_distribution_type::uniform,
+   degree_distribution_type::power_law,
+   degree_distribution_type::poisson,
+   degree_distribution_type::negative_binomial,
+   degree_distribution_type::empirical};
+
+std::unique_ptr<network> build_network(const network_properties &networkProperties)
+{
+   random_stream networkBuildingStream {masterSeed, 0U, random_purpose::network_building};
+   network_builder networkBuilder {networkBuildingStream, 0U};
+   return networkBuilder.construct(networkProperties);
+}
+
+// hold model: the queue keeps its size, every operation pops the earliest
+// event and pushes a new one at an exponentially distributed delay; the new
+// event goes to a node not reached before, because the first passage heap
+// drops the events of nodes already popped
+template <typename backend>
+void bench_event_queue(const std::string &name)
+{
+   for(const uint32_t numOfEvents : {1000U, 100000U})
+   {
+      constexpr uint32_t numOfOperations {1000000U};
+      const uint32_t numOfNodes {numOfEvents + numOfOperations};
+      random_stream randomNumberGenerator {masterSeed, numOfEvents, random_purpose::transmission};
+      std::exponential_distribution<time> delayDistribution {1.0};
+      std::uniform_int_distribution<node_id> nodeDistribution {0U, numOfNodes - 1U};
+      std::unique_ptr<event_queue<backend>> eventQueue {};
+      event_list newEvents(1U);
+
+      measure("event_queue_hold", name + "/" + std::to_string(numOfEvents), numOfOperations,
+         [&]()
+         {
+            eventQueue = std::make_unique<event_queue<backend>>(0.0, numOfNodes);
+            event_list initialEvents {};
+            for(uint32_t index = 0U; index < numOfEvents; ++index)
+            {
+               initialEvents.emplace_back(nodeDistribution(randomNumberGenerator), index,
+                                          delayDistribution(randomNumberGenerator));
+            }
+            eventQueue->update(initialEvents);
+         },
+         [&]()
+         {
+            for(uint32_t operation = 0U; operation < numOfOperations; ++operation)
+            {
+               const event nextEvent {eventQueue->next()};
+               newEvents[0] = event {nextEvent.mToNodeId, numOfEvents + operation,
+                                     eventQueue->get_current_time() + delayDistribution(randomNumberGenerator)};
+               eventQueue->update(newEvents);
+            }
+         });
+   }
+}
+
+void bench_network_builder(const std::string &histogramFile)
+{
+   for(const auto type : degreeDistributionTypes)
+   {
+      for(const uint32_t numOfNodes : {1000U, 10000U, 100000U})
+      {
+         const network_properties networkProperties {
+            create_network_properties(type, numOfNodes, sampling_method::piecewise_constant, histogramFile)};
+         measure("network_builder_construct", to_string(type) + "/" + std::to_string(numOfNodes), 1U,
+            []()
+            {
+            },
+            [&]()
+            {
+               build_network(networkProperties);
+            });
+      }
+   }
+}
+
+void bench_get_random_degree(const std::string &histogramFile)
+{
+   constexpr uint32_t numOfNodes {1000000U};
+   constexpr uint64_t numOfDegrees {1000000U};
+   for(const auto type : degreeDistributionTypes)
+   {
+      // only the Poisson, power law and negative binomial distributions offer both sampling methods
+      const bool hasSamplingMethods {degree_distribution_type::power_law == type ||
+                                     degree_distribution_type::poisson == type ||
+                                     degree_distribution_type::negative_binomial == type};
+      for(const auto samplingMethod : {sampling_method::piecewise_constant, sampling_method::alias_table})
+      {
+         if(!hasSamplingMethods && sampling_method::alias_table == samplingMethod)
+         {
+            continue;
+         }
+         const network_properties networkProperties {
+            create_network_properties(type, numOfNodes, samplingMethod, histogramFile)};
+         random_stream randomNumberGenerator {masterSeed, 0U, random_purpose::network_building};
+         network_builder networkBuilder {randomNumberGenerator, 0U};
+         const auto degreeDistribution {networkBuilder.create_degree_distribution(networkProperties)};
+
+         uint64_t sumOfDegrees {0U};
+         const std::string parameter {hasSamplingMethods ? to_string(type) + "/" + to_string(samplingMethod)
+                                                         : to_string(type)};
+         measure("get_random_degree", parameter, numOfDegrees,
+            []()
+            {
+            },
+            [&]()
+            {
+               for(uint64_t index = 0U; index < numOfDegrees; ++index)
+               {
+                  sumOfDegrees += degreeDistribution->get_random_degree(randomNumberGenerator);
+               }
+            });
+         // keeps the draws from being optimized away
+         if(0U == sumOfDegrees)
+         {
+            std::cerr << "No degrees drawn." << std::endl;
+         }
+      }
+   }
+}
+
+void bench_network(const std::string &resultDirectory)
+{
+   for(const uint32_t numOfNodes : {1000U, 100000U})
+   {
+      const auto network {build_network(
+         create_network_properties(degree_distribution_type::poisson, numOfNodes,
+                                   sampling_method::piecewise_constant, std::string {}))};
+      network->set_transmission_stream(random_stream {masterSeed, 0U, random_purpose::transmission});
+      const std::string parameter {"poisson/" + std::to_string(numOfNodes)};
+
+      // the nodes are informed in order of their IDs at increasing times
+      event_list newEvents {};
+      measure("network_inform_node", parameter, numOfNodes,
+         [&]()
+         {
+            network->reset();
+         },
+         [&]()
+         {
+            for(node_id nodeId = 0U; nodeId < numOfNodes; ++nodeId)
+            {
+               newEvents.clear();
+               network->inform_node(nodeId, static_cast<time>(nodeId), newEvents);
+            }
+         });
+
+      measure("network_get_result", parameter, 1U,
+         []()
+         {
+         },
+         [&]()
+         {
+            network->get_result(0.0);
+         });
+
+      // a result of every node informed, written by a writer of its own
+      const auto simulationResult {network->get_result(0.0)};
+      for(const auto format : {results_format::text, results_format::binary})
+      {
+         constexpr uint32_t numOfSimulations {10U};
+         const std::string formatName {results_format::text == format ? "text" : "binary"};
+         measure("result_writer_save", formatName + "/" + std::to_string(numOfNodes), numOfSimulations,
+            []()
+            {
+            },
+            [&]()
+            {
+               result_writer resultWriter {resultDirectory + "/bench_results." + formatName, format, numOfSimulations};
+               for(uint32_t simulationId = 0U; simulationId < numOfSimulations; ++simulationId)
+               {
+                  resultWriter.push(simulationId, std::make_unique<result>(*simulationResult));
+               }
+               resultWriter.close(numOfSimulations);
+            });
+      }
+   }
+}
+
+std::string write_histogram(const std::string &directory)
+{
+   // degree histogram of a Poisson distribution with parameter 4.5
+   const std::string histogramFile {directory + "/bench_histogram.txt"};
+   std::ofstream histogramStream {histogramFile};
+   histogramStream << "# degree count\n";
+   double weight {std::exp(-4.5)};
+   for(degree currentDegree = 0U; currentDegree < 30U; ++currentDegree)
+   {
+      histogramStream << currentDegree << " " << weight * 1e9 << "\n";
+      weight *= 4.5 / (currentDegree + 1U);
+   }
+   return histogramFile;
+}
+
+} // namespace
+
+} // namespace simulator
+
+// the only argument is the directory of the temporary files, the results are
+// printed in CSV
+int main(int argc, char **argv)
+{
+   using namespace simulator;
+
+   if(2 != argc)
+   {
+      std::cerr << "Usage: " << argv[0] << " <working directory>" << std::endl;
+      return 1;
+   }
+   const std::string directory {argv[1]};
+
+   logger::set_log_file(directory + "/bench.log");
+   logger::set_log_level(WARNING);
+
+   const std::string histogramFile {write_histogram(directory)};
+
+   std::cout << "benchmark,parameter,operations,ns_per_op,ops_per_s,bytes_allocated_per_op" << std::endl;
+   bench_event_queue<binary_heap>("binary_heap");
+   bench_event_queue<quaternary_heap>("quaternary_heap");
+   bench_event_queue<radix_heap>("radix_heap");
+   bench_event_queue<first_passage_heap>("first_passage_heap");
+   bench_network_builder(histogramFile);
+   bench_get_random_degree(histogramFile);
+   bench_network(directory);
+
+   logger::close();
+
+   return 0;
+}
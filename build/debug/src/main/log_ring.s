@@ -0,0 +1,37396 @@
+	.file	"log_ring.cpp"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "./src/main/log_ring.cpp"
+	.section	.text._ZSt23__is_constant_evaluatedv,"axG",@progbits,_ZSt23__is_constant_evaluatedv,comdat
+	.weak	_ZSt23__is_constant_evaluatedv
+	.type	_ZSt23__is_constant_evaluatedv, @function
+_ZSt23__is_constant_evaluatedv:
+.LFB1:
+	.file 1 "/usr/include/x86_64-linux-gnu/c++/12/bits/c++config.h"
+	.loc 1 517 3
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+1:	call	*mcount@GOTPCREL(%rip)
+	lock addq	$1, __gcov0._ZSt23__is_constant_evaluatedv(%rip)
+	.loc 1 523 44
+	movl	$0, %eax
+	.loc 1 527 3
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE1:
+	.size	_ZSt23__is_constant_evaluatedv, .-_ZSt23__is_constant_evaluatedv
+	.section	.text._ZSt17__size_to_integerm,"axG",@progbits,_ZSt17__size_to_integerm,comdat
+	.weak	_ZSt17__size_to_integerm
+	.type	_ZSt17__size_to_integerm, @function
+_ZSt17__size_to_integerm:
+.LFB314:
+	.file 2 "/usr/include/c++/12/bits/stl_algobase.h"
+	.loc 2 1009 40
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZSt17__size_to_integerm(%rip)
+	.loc 2 1009 49
+	movq	-8(%rbp), %rax
+	.loc 2 1009 54
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE314:
+	.size	_ZSt17__size_to_integerm, .-_ZSt17__size_to_integerm
+	.section	.text._ZnwmPv,"axG",@progbits,_ZnwmPv,comdat
+	.weak	_ZnwmPv
+	.type	_ZnwmPv, @function
+_ZnwmPv:
+.LFB408:
+	.file 3 "/usr/include/c++/12/new"
+	.loc 3 175 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZnwmPv(%rip)
+	.loc 3 175 10
+	movq	-16(%rbp), %rax
+	.loc 3 175 15
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE408:
+	.size	_ZnwmPv, .-_ZnwmPv
+	.section	.rodata
+	.type	_ZN6__pstl9execution2v1L3seqE, @object
+	.size	_ZN6__pstl9execution2v1L3seqE, 1
+_ZN6__pstl9execution2v1L3seqE:
+	.zero	1
+	.type	_ZN6__pstl9execution2v1L3parE, @object
+	.size	_ZN6__pstl9execution2v1L3parE, 1
+_ZN6__pstl9execution2v1L3parE:
+	.zero	1
+	.type	_ZN6__pstl9execution2v1L9par_unseqE, @object
+	.size	_ZN6__pstl9execution2v1L9par_unseqE, 1
+_ZN6__pstl9execution2v1L9par_unseqE:
+	.zero	1
+	.type	_ZN6__pstl9execution2v1L5unseqE, @object
+	.size	_ZN6__pstl9execution2v1L5unseqE, 1
+_ZN6__pstl9execution2v1L5unseqE:
+	.zero	1
+	.section	.text._ZStanSt12memory_orderSt23__memory_order_modifier,"axG",@progbits,_ZStanSt12memory_orderSt23__memory_order_modifier,comdat
+	.weak	_ZStanSt12memory_orderSt23__memory_order_modifier
+	.type	_ZStanSt12memory_orderSt23__memory_order_modifier, @function
+_ZStanSt12memory_orderSt23__memory_order_modifier:
+.LFB669:
+	.file 4 "/usr/include/c++/12/bits/atomic_base.h"
+	.loc 4 105 3
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movl	%edi, -4(%rbp)
+	movl	%esi, -8(%rbp)
+	lock addq	$1, __gcov0._ZStanSt12memory_orderSt23__memory_order_modifier(%rip)
+	.loc 4 106 25
+	movl	-4(%rbp), %edx
+	.loc 4 106 36
+	movl	-8(%rbp), %eax
+	.loc 4 106 34
+	andl	%edx, %eax
+	.loc 4 107 3
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE669:
+	.size	_ZStanSt12memory_orderSt23__memory_order_modifier, .-_ZStanSt12memory_orderSt23__memory_order_modifier
+	.section	.text._ZNSt6atomicImEC2Em,"axG",@progbits,_ZNSt6atomicImEC5Em,comdat
+	.align 2
+	.weak	_ZNSt6atomicImEC2Em
+	.type	_ZNSt6atomicImEC2Em, @function
+_ZNSt6atomicImEC2Em:
+.LFB874:
+	.file 5 "/usr/include/c++/12/atomic"
+	.loc 5 904 17
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZNSt6atomicImEC2Em(%rip)
+.LBB14:
+	.loc 5 904 71
+	movq	-8(%rbp), %rax
+	movq	-16(%rbp), %rdx
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt13__atomic_baseImEC2Em
+	lock addq	$1, 8+__gcov0._ZNSt6atomicImEC2Em(%rip)
+.LBE14:
+	.loc 5 904 75
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE874:
+	.size	_ZNSt6atomicImEC2Em, .-_ZNSt6atomicImEC2Em
+	.weak	_ZNSt6atomicImEC1Em
+	.set	_ZNSt6atomicImEC1Em,_ZNSt6atomicImEC2Em
+	.section	.text._ZNSt12_Vector_baseIcSaIcEE12_Vector_implD2Ev,"axG",@progbits,_ZNSt12_Vector_baseIcSaIcEE12_Vector_implD5Ev,comdat
+	.align 2
+	.weak	_ZNSt12_Vector_baseIcSaIcEE12_Vector_implD2Ev
+	.type	_ZNSt12_Vector_baseIcSaIcEE12_Vector_implD2Ev, @function
+_ZNSt12_Vector_baseIcSaIcEE12_Vector_implD2Ev:
+.LFB2032:
+	.file 6 "/usr/include/c++/12/bits/stl_vector.h"
+	.loc 6 133 14
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Vector_baseIcSaIcEE12_Vector_implD2Ev(%rip)
+.LBB15:
+	.loc 6 133 14
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSaIcED2Ev@PLT
+	lock addq	$1, 8+__gcov0._ZNSt12_Vector_baseIcSaIcEE12_Vector_implD2Ev(%rip)
+.LBE15:
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2032:
+	.size	_ZNSt12_Vector_baseIcSaIcEE12_Vector_implD2Ev, .-_ZNSt12_Vector_baseIcSaIcEE12_Vector_implD2Ev
+	.weak	_ZNSt12_Vector_baseIcSaIcEE12_Vector_implD1Ev
+	.set	_ZNSt12_Vector_baseIcSaIcEE12_Vector_implD1Ev,_ZNSt12_Vector_baseIcSaIcEE12_Vector_implD2Ev
+	.section	.text._ZNSt12_Vector_baseIcSaIcEEC2Ev,"axG",@progbits,_ZNSt12_Vector_baseIcSaIcEEC5Ev,comdat
+	.align 2
+	.weak	_ZNSt12_Vector_baseIcSaIcEEC2Ev
+	.type	_ZNSt12_Vector_baseIcSaIcEEC2Ev, @function
+_ZNSt12_Vector_baseIcSaIcEEC2Ev:
+.LFB2034:
+	.loc 6 312 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Vector_baseIcSaIcEEC2Ev(%rip)
+.LBB16:
+	.loc 6 312 7
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseIcSaIcEE12_Vector_implC1Ev
+	lock addq	$1, 8+__gcov0._ZNSt12_Vector_baseIcSaIcEEC2Ev(%rip)
+.LBE16:
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2034:
+	.size	_ZNSt12_Vector_baseIcSaIcEEC2Ev, .-_ZNSt12_Vector_baseIcSaIcEEC2Ev
+	.weak	_ZNSt12_Vector_baseIcSaIcEEC1Ev
+	.set	_ZNSt12_Vector_baseIcSaIcEEC1Ev,_ZNSt12_Vector_baseIcSaIcEEC2Ev
+	.section	.text._ZNSt6vectorIcSaIcEEC2Ev,"axG",@progbits,_ZNSt6vectorIcSaIcEEC5Ev,comdat
+	.align 2
+	.weak	_ZNSt6vectorIcSaIcEEC2Ev
+	.type	_ZNSt6vectorIcSaIcEEC2Ev, @function
+_ZNSt6vectorIcSaIcEEC2Ev:
+.LFB2036:
+	.loc 6 526 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt6vectorIcSaIcEEC2Ev(%rip)
+.LBB17:
+	.loc 6 526 7
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseIcSaIcEEC2Ev
+	lock addq	$1, 8+__gcov0._ZNSt6vectorIcSaIcEEC2Ev(%rip)
+.LBE17:
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2036:
+	.size	_ZNSt6vectorIcSaIcEEC2Ev, .-_ZNSt6vectorIcSaIcEEC2Ev
+	.weak	_ZNSt6vectorIcSaIcEEC1Ev
+	.set	_ZNSt6vectorIcSaIcEEC1Ev,_ZNSt6vectorIcSaIcEEC2Ev
+	.text
+	.align 2
+	.globl	_ZN9simulator8log_ringC2Em
+	.type	_ZN9simulator8log_ringC2Em, @function
+_ZN9simulator8log_ringC2Em:
+.LFB2038:
+	.file 7 "./src/main/log_ring.cpp"
+	.loc 7 14 1
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA2038
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	subq	$40, %rsp
+	.cfi_offset 3, -24
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -40(%rbp)
+	movq	%rsi, -48(%rbp)
+	lock addq	$1, __gcov0._ZN9simulator8log_ringC2Em(%rip)
+.LBB18:
+	.loc 7 15 6
+	movq	-40(%rbp), %rax
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, (%rax)
+	movq	%xmm0, 16(%rax)
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt6vectorIcSaIcEEC1Ev
+	lock addq	$1, 8+__gcov0._ZN9simulator8log_ringC2Em(%rip)
+	.loc 7 16 6
+	movq	-40(%rbp), %rax
+	movq	$0, 24(%rax)
+	.loc 7 17 6
+	movq	-40(%rbp), %rax
+	addq	$64, %rax
+	movl	$0, %esi
+	movq	%rax, %rdi
+	call	_ZNSt6atomicImEC1Em
+	lock addq	$1, 16+__gcov0._ZN9simulator8log_ringC2Em(%rip)
+	.loc 7 18 6
+	movq	-40(%rbp), %rax
+	subq	$-128, %rax
+	movl	$0, %esi
+	movq	%rax, %rdi
+	call	_ZNSt6atomicImEC1Em
+.LBB19:
+	.loc 7 20 11
+	movq	$16, -24(%rbp)
+	.loc 7 21 4
+	jmp	.L14
+.L15:
+	.loc 7 23 23
+	salq	-24(%rbp)
+	lock addq	$1, 24+__gcov0._ZN9simulator8log_ringC2Em(%rip)
+.L14:
+	.loc 7 21 26
+	movq	-24(%rbp), %rax
+	cmpq	-48(%rbp), %rax
+	jb	.L15
+	lock addq	$1, 32+__gcov0._ZN9simulator8log_ringC2Em(%rip)
+	.loc 7 25 18
+	movq	-40(%rbp), %rax
+	movq	-24(%rbp), %rdx
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+.LEHB0:
+	call	_ZNSt6vectorIcSaIcEE6resizeEm
+.LEHE0:
+	lock addq	$1, 48+__gcov0._ZN9simulator8log_ringC2Em(%rip)
+	.loc 7 26 28
+	movq	-24(%rbp), %rax
+	leaq	-1(%rax), %rdx
+	.loc 7 26 10
+	movq	-40(%rbp), %rax
+	movq	%rdx, 24(%rax)
+.LBE19:
+.LBE18:
+	.loc 7 27 1
+	jmp	.L18
+.L17:
+	movq	%rax, %rbx
+	lock addq	$1, 40+__gcov0._ZN9simulator8log_ringC2Em(%rip)
+.LBB20:
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt6vectorIcSaIcEED1Ev
+	lock addq	$1, 56+__gcov0._ZN9simulator8log_ringC2Em(%rip)
+	movq	%rbx, %rax
+	movq	%rax, %rdi
+.LEHB1:
+	call	_Unwind_Resume@PLT
+.LEHE1:
+.L18:
+.LBE20:
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2038:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA2038:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE2038-.LLSDACSB2038
+.LLSDACSB2038:
+	.uleb128 .LEHB0-.LFB2038
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 .L17-.LFB2038
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB2038
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE2038:
+	.text
+	.size	_ZN9simulator8log_ringC2Em, .-_ZN9simulator8log_ringC2Em
+	.globl	_ZN9simulator8log_ringC1Em
+	.set	_ZN9simulator8log_ringC1Em,_ZN9simulator8log_ringC2Em
+	.align 2
+	.globl	_ZN9simulator8log_ring8try_pushElPKcj
+	.type	_ZN9simulator8log_ring8try_pushElPKcj, @function
+_ZN9simulator8log_ring8try_pushElPKcj:
+.LFB2040:
+	.loc 7 30 1
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA2040
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	addq	$-128, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -104(%rbp)
+	movq	%rsi, -112(%rbp)
+	movq	%rdx, -120(%rbp)
+	movl	%ecx, -124(%rbp)
+	lock addq	$1, __gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	.loc 7 31 53
+	movl	-124(%rbp), %eax
+	.loc 7 31 17
+	addq	$16, %rax
+	movq	%rax, -8(%rbp)
+	.loc 7 33 35
+	movq	-104(%rbp), %rax
+	subq	$-128, %rax
+	movq	%rax, -48(%rbp)
+	movl	$0, -52(%rbp)
+.LBB21:
+.LBB22:
+	.loc 4 484 10
+	movl	-52(%rbp), %eax
+	movl	$65535, %esi
+	movl	%eax, %edi
+	call	_ZStanSt12memory_orderSt23__memory_order_modifier
+	movl	%eax, -56(%rbp)
+	lock addq	$1, 8+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	.loc 4 485 39
+	call	_ZSt23__is_constant_evaluatedv
+	.loc 4 485 42
+	testb	%al, %al
+	je	.L20
+	lock addq	$1, 16+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	cmpl	$3, -56(%rbp)
+	jne	.L20
+	lock addq	$1, 24+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	movl	$1, %eax
+	jmp	.L21
+.L20:
+	movl	$0, %eax
+	lock addq	$1, 32+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+.L21:
+	.loc 4 485 7
+	testb	%al, %al
+	je	.L22
+	lock addq	$1, 40+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+.L22:
+	.loc 4 486 39
+	call	_ZSt23__is_constant_evaluatedv
+	lock addq	$1, 48+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	.loc 4 486 42
+	testb	%al, %al
+	je	.L23
+	lock addq	$1, 56+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	cmpl	$4, -56(%rbp)
+	jne	.L23
+	lock addq	$1, 64+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	movl	$1, %eax
+	jmp	.L24
+.L23:
+	movl	$0, %eax
+.L24:
+	.loc 4 486 7
+	testb	%al, %al
+	je	.L25
+	lock addq	$1, 72+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+.L25:
+	.loc 4 488 25
+	movq	-48(%rbp), %rax
+	.loc 4 488 24
+	movq	(%rax), %rax
+	.loc 4 488 40
+	nop
+.LBE22:
+.LBE21:
+	.loc 7 33 35
+	movq	%rax, -16(%rbp)
+	.loc 7 34 35
+	movq	-104(%rbp), %rax
+	addq	$64, %rax
+	movq	%rax, -32(%rbp)
+	movl	$2, -36(%rbp)
+.LBB23:
+.LBB24:
+	.loc 4 484 10
+	movl	-36(%rbp), %eax
+	movl	$65535, %esi
+	movl	%eax, %edi
+	call	_ZStanSt12memory_orderSt23__memory_order_modifier
+	movl	%eax, -40(%rbp)
+	lock addq	$1, 80+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	.loc 4 485 39
+	call	_ZSt23__is_constant_evaluatedv
+	.loc 4 485 42
+	testb	%al, %al
+	je	.L27
+	lock addq	$1, 88+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	cmpl	$3, -40(%rbp)
+	jne	.L27
+	lock addq	$1, 96+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	movl	$1, %eax
+	jmp	.L28
+.L27:
+	movl	$0, %eax
+	lock addq	$1, 104+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+.L28:
+	.loc 4 485 7
+	testb	%al, %al
+	je	.L29
+	lock addq	$1, 112+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+.L29:
+	.loc 4 486 39
+	call	_ZSt23__is_constant_evaluatedv
+	lock addq	$1, 120+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	.loc 4 486 42
+	testb	%al, %al
+	je	.L30
+	lock addq	$1, 128+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	cmpl	$4, -40(%rbp)
+	jne	.L30
+	lock addq	$1, 136+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	movl	$1, %eax
+	jmp	.L31
+.L30:
+	movl	$0, %eax
+.L31:
+	.loc 4 486 7
+	testb	%al, %al
+	je	.L32
+	lock addq	$1, 144+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+.L32:
+	.loc 4 488 25
+	movq	-32(%rbp), %rax
+	.loc 4 488 24
+	movq	(%rax), %rax
+	.loc 4 488 40
+	nop
+.LBE24:
+.LBE23:
+	.loc 7 34 35
+	movq	%rax, -24(%rbp)
+	.loc 7 35 32
+	movq	-104(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE4sizeEv
+	lock addq	$1, 152+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	.loc 7 35 35
+	movq	-24(%rbp), %rdx
+	subq	-16(%rbp), %rdx
+	addq	%rdx, %rax
+	.loc 7 35 18
+	cmpq	-8(%rbp), %rax
+	setb	%al
+	.loc 7 35 4
+	testb	%al, %al
+	je	.L34
+	.loc 7 37 14
+	movl	$0, %eax
+	lock addq	$1, 160+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	jmp	.L53
+.L34:
+	.loc 7 40 49
+	movq	-112(%rbp), %rax
+	movq	%rax, -96(%rbp)
+	movl	-124(%rbp), %eax
+	movl	%eax, -88(%rbp)
+	.loc 7 41 11
+	leaq	-96(%rbp), %rdx
+	movq	-16(%rbp), %rsi
+	movq	-104(%rbp), %rax
+	movl	$16, %ecx
+	movq	%rax, %rdi
+.LEHB2:
+	call	_ZN9simulator8log_ring7copy_inEmPKcm
+.LEHE2:
+	lock addq	$1, 176+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	.loc 7 42 11
+	movl	-124(%rbp), %ecx
+	movq	-16(%rbp), %rax
+	leaq	16(%rax), %rsi
+	movq	-120(%rbp), %rdx
+	movq	-104(%rbp), %rax
+	movq	%rax, %rdi
+.LEHB3:
+	call	_ZN9simulator8log_ring7copy_inEmPKcm
+.LEHE3:
+	jmp	.L52
+.L50:
+	lock addq	$1, 184+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	jmp	.L38
+.L52:
+	lock addq	$1, 192+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	.loc 7 43 15
+	movq	-104(%rbp), %rax
+	leaq	128(%rax), %rdx
+	movq	-16(%rbp), %rcx
+	movq	-8(%rbp), %rax
+	addq	%rcx, %rax
+	movq	%rdx, -64(%rbp)
+	movq	%rax, -72(%rbp)
+	movl	$3, -76(%rbp)
+.LBB25:
+.LBB26:
+	.loc 4 459 10
+	movl	-76(%rbp), %eax
+	movl	$65535, %esi
+	movl	%eax, %edi
+	call	_ZStanSt12memory_orderSt23__memory_order_modifier
+	movl	%eax, -80(%rbp)
+	lock addq	$1, 200+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	.loc 4 460 39
+	call	_ZSt23__is_constant_evaluatedv
+	.loc 4 460 42
+	testb	%al, %al
+	je	.L39
+	lock addq	$1, 208+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	cmpl	$2, -80(%rbp)
+	jne	.L39
+	lock addq	$1, 216+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	movl	$1, %eax
+	jmp	.L40
+.L39:
+	movl	$0, %eax
+	lock addq	$1, 224+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+.L40:
+	.loc 4 460 7
+	testb	%al, %al
+	je	.L41
+	lock addq	$1, 232+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+.L41:
+	.loc 4 461 39
+	call	_ZSt23__is_constant_evaluatedv
+	lock addq	$1, 240+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	.loc 4 461 42
+	testb	%al, %al
+	je	.L42
+	lock addq	$1, 248+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	cmpl	$4, -80(%rbp)
+	jne	.L42
+	lock addq	$1, 256+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	movl	$1, %eax
+	jmp	.L43
+.L42:
+	movl	$0, %eax
+.L43:
+	.loc 4 461 7
+	testb	%al, %al
+	je	.L44
+	lock addq	$1, 264+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+.L44:
+	.loc 4 462 39
+	call	_ZSt23__is_constant_evaluatedv
+	lock addq	$1, 272+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	.loc 4 462 42
+	testb	%al, %al
+	je	.L45
+	lock addq	$1, 280+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	cmpl	$1, -80(%rbp)
+	jne	.L45
+	lock addq	$1, 288+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+	movl	$1, %eax
+	jmp	.L46
+.L45:
+	movl	$0, %eax
+.L46:
+	.loc 4 462 7
+	testb	%al, %al
+	je	.L47
+	lock addq	$1, 296+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+.L47:
+	.loc 4 464 19
+	movq	-64(%rbp), %rax
+	.loc 4 464 18
+	movq	-72(%rbp), %rdx
+	xchgq	(%rax), %rdx
+	.loc 4 465 7
+	nop
+.LBE26:
+.LBE25:
+	.loc 7 44 11
+	movl	$1, %eax
+	jmp	.L53
+.L51:
+	lock addq	$1, 168+__gcov0._ZN9simulator8log_ring8try_pushElPKcj(%rip)
+.L38:
+	movq	%rax, %rdi
+.LEHB4:
+	call	_Unwind_Resume@PLT
+.LEHE4:
+.L53:
+	.loc 7 45 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2040:
+	.section	.gcc_except_table
+.LLSDA2040:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE2040-.LLSDACSB2040
+.LLSDACSB2040:
+	.uleb128 .LEHB2-.LFB2040
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 .L51-.LFB2040
+	.uleb128 0
+	.uleb128 .LEHB3-.LFB2040
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 .L50-.LFB2040
+	.uleb128 0
+	.uleb128 .LEHB4-.LFB2040
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE2040:
+	.text
+	.size	_ZN9simulator8log_ring8try_pushElPKcj, .-_ZN9simulator8log_ring8try_pushElPKcj
+	.align 2
+	.globl	_ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE
+	.type	_ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE, @function
+_ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE:
+.LFB2041:
+	.loc 7 48 1
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA2041
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	subq	$136, %rsp
+	.cfi_offset 3, -24
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -120(%rbp)
+	movq	%rsi, -128(%rbp)
+	movq	%rdx, -136(%rbp)
+	lock addq	$1, __gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 7 50 35
+	movq	-120(%rbp), %rax
+	addq	$64, %rax
+	movq	%rax, -64(%rbp)
+	movl	$0, -68(%rbp)
+.LBB27:
+.LBB28:
+	.loc 4 484 10
+	movl	-68(%rbp), %eax
+	movl	$65535, %esi
+	movl	%eax, %edi
+	call	_ZStanSt12memory_orderSt23__memory_order_modifier
+	movl	%eax, -72(%rbp)
+	lock addq	$1, 8+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 485 39
+	call	_ZSt23__is_constant_evaluatedv
+	.loc 4 485 42
+	testb	%al, %al
+	je	.L55
+	lock addq	$1, 16+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	cmpl	$3, -72(%rbp)
+	jne	.L55
+	lock addq	$1, 24+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	movl	$1, %eax
+	jmp	.L56
+.L55:
+	movl	$0, %eax
+	lock addq	$1, 32+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+.L56:
+	.loc 4 485 7
+	testb	%al, %al
+	je	.L57
+	lock addq	$1, 40+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+.L57:
+	.loc 4 486 39
+	call	_ZSt23__is_constant_evaluatedv
+	lock addq	$1, 48+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 486 42
+	testb	%al, %al
+	je	.L58
+	lock addq	$1, 56+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	cmpl	$4, -72(%rbp)
+	jne	.L58
+	lock addq	$1, 64+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	movl	$1, %eax
+	jmp	.L59
+.L58:
+	movl	$0, %eax
+.L59:
+	.loc 4 486 7
+	testb	%al, %al
+	je	.L60
+	lock addq	$1, 72+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+.L60:
+	.loc 4 488 25
+	movq	-64(%rbp), %rax
+	.loc 4 488 24
+	movq	(%rax), %rax
+	.loc 4 488 40
+	nop
+.LBE28:
+.LBE27:
+	.loc 7 50 35
+	movq	%rax, -24(%rbp)
+	.loc 7 51 35
+	movq	-120(%rbp), %rax
+	subq	$-128, %rax
+	movq	%rax, -48(%rbp)
+	movl	$2, -52(%rbp)
+.LBB29:
+.LBB30:
+	.loc 4 484 10
+	movl	-52(%rbp), %eax
+	movl	$65535, %esi
+	movl	%eax, %edi
+	call	_ZStanSt12memory_orderSt23__memory_order_modifier
+	movl	%eax, -56(%rbp)
+	lock addq	$1, 80+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 485 39
+	call	_ZSt23__is_constant_evaluatedv
+	.loc 4 485 42
+	testb	%al, %al
+	je	.L62
+	lock addq	$1, 88+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	cmpl	$3, -56(%rbp)
+	jne	.L62
+	lock addq	$1, 96+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	movl	$1, %eax
+	jmp	.L63
+.L62:
+	movl	$0, %eax
+	lock addq	$1, 104+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+.L63:
+	.loc 4 485 7
+	testb	%al, %al
+	je	.L64
+	lock addq	$1, 112+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+.L64:
+	.loc 4 486 39
+	call	_ZSt23__is_constant_evaluatedv
+	lock addq	$1, 120+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 486 42
+	testb	%al, %al
+	je	.L65
+	lock addq	$1, 128+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	cmpl	$4, -56(%rbp)
+	jne	.L65
+	lock addq	$1, 136+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	movl	$1, %eax
+	jmp	.L66
+.L65:
+	movl	$0, %eax
+.L66:
+	.loc 4 486 7
+	testb	%al, %al
+	je	.L67
+	lock addq	$1, 144+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+.L67:
+	.loc 4 488 25
+	movq	-48(%rbp), %rax
+	.loc 4 488 24
+	movq	(%rax), %rax
+	.loc 4 488 40
+	nop
+.LBE30:
+.LBE29:
+	.loc 7 51 35
+	movq	%rax, -32(%rbp)
+	.loc 7 52 4
+	movq	-24(%rbp), %rax
+	cmpq	-32(%rbp), %rax
+	jne	.L69
+	lock addq	$1, 152+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 7 54 14
+	movl	$0, %eax
+	jmp	.L92
+.L69:
+	.loc 7 57 18
+	movq	$0, -112(%rbp)
+	movq	$0, -104(%rbp)
+	.loc 7 58 12
+	leaq	-112(%rbp), %rdx
+	movq	-24(%rbp), %rsi
+	movq	-120(%rbp), %rax
+	movl	$16, %ecx
+	movq	%rax, %rdi
+.LEHB5:
+	call	_ZNK9simulator8log_ring8copy_outEmPcm
+.LEHE5:
+	lock addq	$1, 168+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 7 59 37
+	movq	-136(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4sizeEv@PLT
+	movq	%rax, -40(%rbp)
+	lock addq	$1, 176+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 7 60 35
+	movl	-104(%rbp), %eax
+	movl	%eax, %edx
+	.loc 7 60 18
+	movq	-40(%rbp), %rax
+	addq	%rax, %rdx
+	movq	-136(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+.LEHB6:
+	call	_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6resizeEm@PLT
+.LEHE6:
+	jmp	.L90
+.L89:
+	lock addq	$1, 184+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	jmp	.L73
+.L90:
+	lock addq	$1, 192+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 7 61 68
+	movl	-104(%rbp), %eax
+	.loc 7 61 12
+	movl	%eax, %ebx
+	.loc 7 61 48
+	movq	-136(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4dataEv@PLT
+	lock addq	$1, 200+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 7 61 12
+	movq	-40(%rbp), %rdx
+	addq	%rax, %rdx
+	movq	-24(%rbp), %rax
+	leaq	16(%rax), %rsi
+	movq	-120(%rbp), %rax
+	movq	%rbx, %rcx
+	movq	%rax, %rdi
+.LEHB7:
+	call	_ZNK9simulator8log_ring8copy_outEmPcm
+.LEHE7:
+	jmp	.L91
+.L87:
+	lock addq	$1, 208+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	jmp	.L73
+.L91:
+	lock addq	$1, 216+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 7 62 23
+	movq	-112(%rbp), %rdx
+	.loc 7 62 14
+	movq	-128(%rbp), %rax
+	movq	%rdx, (%rax)
+	.loc 7 63 15
+	movq	-120(%rbp), %rax
+	leaq	64(%rax), %rdx
+	.loc 7 63 47
+	movl	-104(%rbp), %eax
+	movl	%eax, %ecx
+	.loc 7 63 38
+	movq	-24(%rbp), %rax
+	addq	%rcx, %rax
+	.loc 7 63 15
+	addq	$16, %rax
+	movq	%rdx, -80(%rbp)
+	movq	%rax, -88(%rbp)
+	movl	$3, -92(%rbp)
+.LBB31:
+.LBB32:
+	.loc 4 459 10
+	movl	-92(%rbp), %eax
+	movl	$65535, %esi
+	movl	%eax, %edi
+	call	_ZStanSt12memory_orderSt23__memory_order_modifier
+	movl	%eax, -96(%rbp)
+	lock addq	$1, 224+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 460 39
+	call	_ZSt23__is_constant_evaluatedv
+	.loc 4 460 42
+	testb	%al, %al
+	je	.L76
+	lock addq	$1, 232+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	cmpl	$2, -96(%rbp)
+	jne	.L76
+	lock addq	$1, 240+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	movl	$1, %eax
+	jmp	.L77
+.L76:
+	movl	$0, %eax
+	lock addq	$1, 248+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+.L77:
+	.loc 4 460 7
+	testb	%al, %al
+	je	.L78
+	lock addq	$1, 256+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+.L78:
+	.loc 4 461 39
+	call	_ZSt23__is_constant_evaluatedv
+	lock addq	$1, 264+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 461 42
+	testb	%al, %al
+	je	.L79
+	lock addq	$1, 272+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	cmpl	$4, -96(%rbp)
+	jne	.L79
+	lock addq	$1, 280+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	movl	$1, %eax
+	jmp	.L80
+.L79:
+	movl	$0, %eax
+.L80:
+	.loc 4 461 7
+	testb	%al, %al
+	je	.L81
+	lock addq	$1, 288+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+.L81:
+	.loc 4 462 39
+	call	_ZSt23__is_constant_evaluatedv
+	lock addq	$1, 296+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 462 42
+	testb	%al, %al
+	je	.L82
+	lock addq	$1, 304+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	cmpl	$1, -96(%rbp)
+	jne	.L82
+	lock addq	$1, 312+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	movl	$1, %eax
+	jmp	.L83
+.L82:
+	movl	$0, %eax
+.L83:
+	.loc 4 462 7
+	testb	%al, %al
+	je	.L84
+	lock addq	$1, 320+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+.L84:
+	.loc 4 464 19
+	movq	-80(%rbp), %rax
+	.loc 4 464 18
+	movq	-88(%rbp), %rdx
+	xchgq	(%rax), %rdx
+	.loc 4 465 7
+	nop
+.LBE32:
+.LBE31:
+	.loc 7 64 11
+	movl	$1, %eax
+	jmp	.L92
+.L88:
+	lock addq	$1, 160+__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+.L73:
+	movq	%rax, %rdi
+.LEHB8:
+	call	_Unwind_Resume@PLT
+.LEHE8:
+.L92:
+	.loc 7 65 1
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2041:
+	.section	.gcc_except_table
+.LLSDA2041:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE2041-.LLSDACSB2041
+.LLSDACSB2041:
+	.uleb128 .LEHB5-.LFB2041
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 .L88-.LFB2041
+	.uleb128 0
+	.uleb128 .LEHB6-.LFB2041
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 .L89-.LFB2041
+	.uleb128 0
+	.uleb128 .LEHB7-.LFB2041
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 .L87-.LFB2041
+	.uleb128 0
+	.uleb128 .LEHB8-.LFB2041
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE2041:
+	.text
+	.size	_ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE, .-_ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE
+	.align 2
+	.globl	_ZNK9simulator8log_ring12get_capacityEv
+	.type	_ZNK9simulator8log_ring12get_capacityEv, @function
+_ZNK9simulator8log_ring12get_capacityEv:
+.LFB2042:
+	.loc 7 68 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNK9simulator8log_ring12get_capacityEv(%rip)
+	.loc 7 69 23
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE4sizeEv
+	.loc 7 69 24
+	nop
+	lock addq	$1, 8+__gcov0._ZNK9simulator8log_ring12get_capacityEv(%rip)
+	.loc 7 70 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2042:
+	.size	_ZNK9simulator8log_ring12get_capacityEv, .-_ZNK9simulator8log_ring12get_capacityEv
+	.align 2
+	.globl	_ZN9simulator8log_ring7copy_inEmPKcm
+	.type	_ZN9simulator8log_ring7copy_inEmPKcm, @function
+_ZN9simulator8log_ring7copy_inEmPKcm:
+.LFB2043:
+	.loc 7 73 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r12
+	pushq	%rbx
+	subq	$64, %rsp
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -56(%rbp)
+	movq	%rsi, -64(%rbp)
+	movq	%rdx, -72(%rbp)
+	movq	%rcx, -80(%rbp)
+	lock addq	$1, __gcov0._ZN9simulator8log_ring7copy_inEmPKcm(%rip)
+	.loc 7 75 55
+	movq	-56(%rbp), %rax
+	movq	24(%rax), %rax
+	.loc 7 75 17
+	andq	-64(%rbp), %rax
+	movq	%rax, -24(%rbp)
+	.loc 7 76 55
+	movq	-56(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE4sizeEv
+	lock addq	$1, 8+__gcov0._ZN9simulator8log_ring7copy_inEmPKcm(%rip)
+	.loc 7 76 58
+	subq	-24(%rbp), %rax
+	movq	%rax, -40(%rbp)
+	.loc 7 76 36
+	leaq	-40(%rbp), %rdx
+	leaq	-80(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt3minImERKT_S2_S2_
+	lock addq	$1, 16+__gcov0._ZN9simulator8log_ring7copy_inEmPKcm(%rip)
+	.loc 7 76 66
+	movq	(%rax), %rax
+	movq	%rax, -32(%rbp)
+	.loc 7 77 28
+	movq	-56(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt6vectorIcSaIcEE4dataEv
+	lock addq	$1, 24+__gcov0._ZN9simulator8log_ring7copy_inEmPKcm(%rip)
+	.loc 7 77 31
+	movq	-24(%rbp), %rdx
+	leaq	(%rax,%rdx), %rcx
+	.loc 7 77 15
+	movq	-32(%rbp), %rdx
+	movq	-72(%rbp), %rax
+	movq	%rax, %rsi
+	movq	%rcx, %rdi
+	call	memcpy@PLT
+	.loc 7 78 52
+	movq	-80(%rbp), %rax
+	.loc 7 78 15
+	subq	-32(%rbp), %rax
+	movq	%rax, %rbx
+	.loc 7 78 39
+	movq	-72(%rbp), %rdx
+	movq	-32(%rbp), %rax
+	leaq	(%rdx,%rax), %r12
+	.loc 7 78 28
+	movq	-56(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt6vectorIcSaIcEE4dataEv
+	lock addq	$1, 32+__gcov0._ZN9simulator8log_ring7copy_inEmPKcm(%rip)
+	.loc 7 78 15
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	.loc 7 79 1
+	nop
+	addq	$64, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2043:
+	.size	_ZN9simulator8log_ring7copy_inEmPKcm, .-_ZN9simulator8log_ring7copy_inEmPKcm
+	.align 2
+	.globl	_ZNK9simulator8log_ring8copy_outEmPcm
+	.type	_ZNK9simulator8log_ring8copy_outEmPcm, @function
+_ZNK9simulator8log_ring8copy_outEmPcm:
+.LFB2044:
+	.loc 7 82 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	subq	$72, %rsp
+	.cfi_offset 3, -24
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -56(%rbp)
+	movq	%rsi, -64(%rbp)
+	movq	%rdx, -72(%rbp)
+	movq	%rcx, -80(%rbp)
+	lock addq	$1, __gcov0._ZNK9simulator8log_ring8copy_outEmPcm(%rip)
+	.loc 7 83 55
+	movq	-56(%rbp), %rax
+	movq	24(%rax), %rax
+	.loc 7 83 17
+	andq	-64(%rbp), %rax
+	movq	%rax, -24(%rbp)
+	.loc 7 84 55
+	movq	-56(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE4sizeEv
+	lock addq	$1, 8+__gcov0._ZNK9simulator8log_ring8copy_outEmPcm(%rip)
+	.loc 7 84 58
+	subq	-24(%rbp), %rax
+	movq	%rax, -40(%rbp)
+	.loc 7 84 36
+	leaq	-40(%rbp), %rdx
+	leaq	-80(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt3minImERKT_S2_S2_
+	lock addq	$1, 16+__gcov0._ZNK9simulator8log_ring8copy_outEmPcm(%rip)
+	.loc 7 84 66
+	movq	(%rax), %rax
+	movq	%rax, -32(%rbp)
+	.loc 7 85 41
+	movq	-56(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE4dataEv
+	lock addq	$1, 24+__gcov0._ZNK9simulator8log_ring8copy_outEmPcm(%rip)
+	.loc 7 85 44
+	movq	-24(%rbp), %rdx
+	leaq	(%rax,%rdx), %rcx
+	.loc 7 85 15
+	movq	-32(%rbp), %rdx
+	movq	-72(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	.loc 7 86 57
+	movq	-80(%rbp), %rax
+	.loc 7 86 15
+	subq	-32(%rbp), %rax
+	movq	%rax, %rbx
+	.loc 7 86 53
+	movq	-56(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE4dataEv
+	movq	%rax, %rcx
+	lock addq	$1, 32+__gcov0._ZNK9simulator8log_ring8copy_outEmPcm(%rip)
+	.loc 7 86 28
+	movq	-72(%rbp), %rdx
+	movq	-32(%rbp), %rax
+	addq	%rdx, %rax
+	.loc 7 86 15
+	movq	%rbx, %rdx
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+	.loc 7 87 1
+	nop
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2044:
+	.size	_ZNK9simulator8log_ring8copy_outEmPcm, .-_ZNK9simulator8log_ring8copy_outEmPcm
+	.section	.text._ZNSt13__atomic_baseImEC2Em,"axG",@progbits,_ZNSt13__atomic_baseImEC5Em,comdat
+	.align 2
+	.weak	_ZNSt13__atomic_baseImEC2Em
+	.type	_ZNSt13__atomic_baseImEC2Em, @function
+_ZNSt13__atomic_baseImEC2Em:
+.LFB2091:
+	.loc 4 345 17
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZNSt13__atomic_baseImEC2Em(%rip)
+.LBB33:
+	.loc 4 345 58
+	movq	-8(%rbp), %rax
+	movq	-16(%rbp), %rdx
+	movq	%rdx, (%rax)
+.LBE33:
+	.loc 4 345 71
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2091:
+	.size	_ZNSt13__atomic_baseImEC2Em, .-_ZNSt13__atomic_baseImEC2Em
+	.weak	_ZNSt13__atomic_baseImEC1Em
+	.set	_ZNSt13__atomic_baseImEC1Em,_ZNSt13__atomic_baseImEC2Em
+	.section	.text._ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev,"axG",@progbits,_ZNSt12_Vector_baseIcSaIcEE12_Vector_implC5Ev,comdat
+	.align 2
+	.weak	_ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev
+	.type	_ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev, @function
+_ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev:
+.LFB2366:
+	.loc 6 137 2
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev(%rip)
+.LBB34:
+	.loc 6 139 19
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSaIcEC2Ev@PLT
+	lock addq	$1, 8+__gcov0._ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev(%rip)
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC2Ev
+	lock addq	$1, 16+__gcov0._ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev(%rip)
+.LBE34:
+	.loc 6 140 4
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2366:
+	.size	_ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev, .-_ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev
+	.weak	_ZNSt12_Vector_baseIcSaIcEE12_Vector_implC1Ev
+	.set	_ZNSt12_Vector_baseIcSaIcEE12_Vector_implC1Ev,_ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev
+	.section	.text._ZNSt12_Vector_baseIcSaIcEED2Ev,"axG",@progbits,_ZNSt12_Vector_baseIcSaIcEED5Ev,comdat
+	.align 2
+	.weak	_ZNSt12_Vector_baseIcSaIcEED2Ev
+	.type	_ZNSt12_Vector_baseIcSaIcEED2Ev, @function
+_ZNSt12_Vector_baseIcSaIcEED2Ev:
+.LFB2369:
+	.loc 6 364 7
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA2369
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Vector_baseIcSaIcEED2Ev(%rip)
+.LBB35:
+	.loc 6 367 17
+	movq	-8(%rbp), %rax
+	movq	16(%rax), %rdx
+	.loc 6 367 45
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rax
+	.loc 6 367 35
+	subq	%rax, %rdx
+	.loc 6 366 15
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rcx
+	movq	-8(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm
+	lock addq	$1, 8+__gcov0._ZNSt12_Vector_baseIcSaIcEED2Ev(%rip)
+	.loc 6 368 7
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseIcSaIcEE12_Vector_implD1Ev
+	lock addq	$1, 16+__gcov0._ZNSt12_Vector_baseIcSaIcEED2Ev(%rip)
+.LBE35:
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2369:
+	.section	.gcc_except_table
+.LLSDA2369:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE2369-.LLSDACSB2369
+.LLSDACSB2369:
+.LLSDACSE2369:
+	.section	.text._ZNSt12_Vector_baseIcSaIcEED2Ev,"axG",@progbits,_ZNSt12_Vector_baseIcSaIcEED5Ev,comdat
+	.size	_ZNSt12_Vector_baseIcSaIcEED2Ev, .-_ZNSt12_Vector_baseIcSaIcEED2Ev
+	.weak	_ZNSt12_Vector_baseIcSaIcEED1Ev
+	.set	_ZNSt12_Vector_baseIcSaIcEED1Ev,_ZNSt12_Vector_baseIcSaIcEED2Ev
+	.section	.text._ZNSt6vectorIcSaIcEED2Ev,"axG",@progbits,_ZNSt6vectorIcSaIcEED5Ev,comdat
+	.align 2
+	.weak	_ZNSt6vectorIcSaIcEED2Ev
+	.type	_ZNSt6vectorIcSaIcEED2Ev, @function
+_ZNSt6vectorIcSaIcEED2Ev:
+.LFB2372:
+	.loc 6 728 7
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA2372
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt6vectorIcSaIcEED2Ev(%rip)
+.LBB36:
+	.loc 6 731 28
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv
+	movq	%rax, %rdx
+	lock addq	$1, 8+__gcov0._ZNSt6vectorIcSaIcEED2Ev(%rip)
+	.loc 6 730 15
+	movq	-8(%rbp), %rax
+	movq	8(%rax), %rcx
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt8_DestroyIPccEvT_S1_RSaIT0_E
+	lock addq	$1, 16+__gcov0._ZNSt6vectorIcSaIcEED2Ev(%rip)
+	.loc 6 733 7
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseIcSaIcEED2Ev
+	lock addq	$1, 24+__gcov0._ZNSt6vectorIcSaIcEED2Ev(%rip)
+.LBE36:
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2372:
+	.section	.gcc_except_table
+.LLSDA2372:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE2372-.LLSDACSB2372
+.LLSDACSB2372:
+.LLSDACSE2372:
+	.section	.text._ZNSt6vectorIcSaIcEED2Ev,"axG",@progbits,_ZNSt6vectorIcSaIcEED5Ev,comdat
+	.size	_ZNSt6vectorIcSaIcEED2Ev, .-_ZNSt6vectorIcSaIcEED2Ev
+	.weak	_ZNSt6vectorIcSaIcEED1Ev
+	.set	_ZNSt6vectorIcSaIcEED1Ev,_ZNSt6vectorIcSaIcEED2Ev
+	.section	.text._ZNSt6vectorIcSaIcEE6resizeEm,"axG",@progbits,_ZNSt6vectorIcSaIcEE6resizeEm,comdat
+	.align 2
+	.weak	_ZNSt6vectorIcSaIcEE6resizeEm
+	.type	_ZNSt6vectorIcSaIcEE6resizeEm, @function
+_ZNSt6vectorIcSaIcEE6resizeEm:
+.LFB2374:
+	.loc 6 1008 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZNSt6vectorIcSaIcEE6resizeEm(%rip)
+	.loc 6 1010 23
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE4sizeEv
+	lock addq	$1, 8+__gcov0._ZNSt6vectorIcSaIcEE6resizeEm(%rip)
+	.loc 6 1010 17
+	cmpq	-16(%rbp), %rax
+	setb	%al
+	.loc 6 1010 2
+	testb	%al, %al
+	je	.L102
+	lock addq	$1, 16+__gcov0._ZNSt6vectorIcSaIcEE6resizeEm(%rip)
+	.loc 6 1011 39
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE4sizeEv
+	lock addq	$1, 24+__gcov0._ZNSt6vectorIcSaIcEE6resizeEm(%rip)
+	.loc 6 1011 21
+	movq	-16(%rbp), %rdx
+	subq	%rax, %rdx
+	movq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt6vectorIcSaIcEE17_M_default_appendEm
+	lock addq	$1, 32+__gcov0._ZNSt6vectorIcSaIcEE6resizeEm(%rip)
+	.loc 6 1014 7
+	jmp	.L104
+.L102:
+	.loc 6 1012 28
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE4sizeEv
+	lock addq	$1, 40+__gcov0._ZNSt6vectorIcSaIcEE6resizeEm(%rip)
+	.loc 6 1012 22
+	cmpq	%rax, -16(%rbp)
+	setb	%al
+	.loc 6 1012 7
+	testb	%al, %al
+	je	.L104
+	lock addq	$1, 48+__gcov0._ZNSt6vectorIcSaIcEE6resizeEm(%rip)
+	.loc 6 1013 34
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rdx
+	.loc 6 1013 19
+	movq	-16(%rbp), %rax
+	addq	%rax, %rdx
+	movq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc
+	lock addq	$1, 56+__gcov0._ZNSt6vectorIcSaIcEE6resizeEm(%rip)
+.L104:
+	.loc 6 1014 7
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2374:
+	.size	_ZNSt6vectorIcSaIcEE6resizeEm, .-_ZNSt6vectorIcSaIcEE6resizeEm
+	.section	.text._ZNKSt6vectorIcSaIcEE4sizeEv,"axG",@progbits,_ZNKSt6vectorIcSaIcEE4sizeEv,comdat
+	.align 2
+	.weak	_ZNKSt6vectorIcSaIcEE4sizeEv
+	.type	_ZNKSt6vectorIcSaIcEE4sizeEv, @function
+_ZNKSt6vectorIcSaIcEE4sizeEv:
+.LFB2376:
+	.loc 6 987 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNKSt6vectorIcSaIcEE4sizeEv(%rip)
+	.loc 6 988 40
+	movq	-8(%rbp), %rax
+	movq	8(%rax), %rdx
+	.loc 6 988 66
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rax
+	.loc 6 988 50
+	subq	%rax, %rdx
+	.loc 6 988 74
+	movq	%rdx, %rax
+	.loc 6 988 77
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2376:
+	.size	_ZNKSt6vectorIcSaIcEE4sizeEv, .-_ZNKSt6vectorIcSaIcEE4sizeEv
+	.section	.text._ZSt3minImERKT_S2_S2_,"axG",@progbits,_ZSt3minImERKT_S2_S2_,comdat
+	.weak	_ZSt3minImERKT_S2_S2_
+	.type	_ZSt3minImERKT_S2_S2_, @function
+_ZSt3minImERKT_S2_S2_:
+.LFB2380:
+	.loc 2 230 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZSt3minImERKT_S2_S2_(%rip)
+	.loc 2 235 15
+	movq	-16(%rbp), %rax
+	movq	(%rax), %rdx
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rax
+	.loc 2 235 7
+	cmpq	%rax, %rdx
+	jnb	.L108
+	lock addq	$1, 8+__gcov0._ZSt3minImERKT_S2_S2_(%rip)
+	.loc 2 236 9
+	movq	-16(%rbp), %rax
+	jmp	.L109
+.L108:
+	.loc 2 237 14
+	movq	-8(%rbp), %rax
+.L109:
+	.loc 2 238 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2380:
+	.size	_ZSt3minImERKT_S2_S2_, .-_ZSt3minImERKT_S2_S2_
+	.section	.text._ZNSt6vectorIcSaIcEE4dataEv,"axG",@progbits,_ZNSt6vectorIcSaIcEE4dataEv,comdat
+	.align 2
+	.weak	_ZNSt6vectorIcSaIcEE4dataEv
+	.type	_ZNSt6vectorIcSaIcEE4dataEv, @function
+_ZNSt6vectorIcSaIcEE4dataEv:
+.LFB2381:
+	.loc 6 1255 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt6vectorIcSaIcEE4dataEv(%rip)
+	.loc 6 1256 27
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rdx
+	movq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_
+	.loc 6 1256 50
+	nop
+	lock addq	$1, 8+__gcov0._ZNSt6vectorIcSaIcEE4dataEv(%rip)
+	.loc 6 1256 53
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2381:
+	.size	_ZNSt6vectorIcSaIcEE4dataEv, .-_ZNSt6vectorIcSaIcEE4dataEv
+	.section	.text._ZNKSt6vectorIcSaIcEE4dataEv,"axG",@progbits,_ZNKSt6vectorIcSaIcEE4dataEv,comdat
+	.align 2
+	.weak	_ZNKSt6vectorIcSaIcEE4dataEv
+	.type	_ZNKSt6vectorIcSaIcEE4dataEv, @function
+_ZNKSt6vectorIcSaIcEE4dataEv:
+.LFB2382:
+	.loc 6 1260 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNKSt6vectorIcSaIcEE4dataEv(%rip)
+	.loc 6 1261 42
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rdx
+	.loc 6 1261 27
+	movq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_
+	.loc 6 1261 50
+	nop
+	lock addq	$1, 8+__gcov0._ZNKSt6vectorIcSaIcEE4dataEv(%rip)
+	.loc 6 1261 53
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2382:
+	.size	_ZNKSt6vectorIcSaIcEE4dataEv, .-_ZNKSt6vectorIcSaIcEE4dataEv
+	.section	.text._ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC2Ev,"axG",@progbits,_ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC5Ev,comdat
+	.align 2
+	.weak	_ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC2Ev
+	.type	_ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC2Ev, @function
+_ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC2Ev:
+.LFB2479:
+	.loc 6 99 2
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC2Ev(%rip)
+.LBB37:
+	.loc 6 100 4
+	movq	-8(%rbp), %rax
+	movq	$0, (%rax)
+	.loc 6 100 16
+	movq	-8(%rbp), %rax
+	movq	$0, 8(%rax)
+	.loc 6 100 29
+	movq	-8(%rbp), %rax
+	movq	$0, 16(%rax)
+.LBE37:
+	.loc 6 101 4
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2479:
+	.size	_ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC2Ev, .-_ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC2Ev
+	.weak	_ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC1Ev
+	.set	_ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC1Ev,_ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC2Ev
+	.section	.text._ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm,"axG",@progbits,_ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm,comdat
+	.align 2
+	.weak	_ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm
+	.type	_ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm, @function
+_ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm:
+.LFB2481:
+	.loc 6 383 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm(%rip)
+	.loc 6 386 2
+	cmpq	$0, -16(%rbp)
+	je	.L117
+	lock addq	$1, 8+__gcov0._ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm(%rip)
+	.loc 6 387 20
+	movq	-8(%rbp), %rax
+	.loc 6 387 19
+	movq	-24(%rbp), %rdx
+	movq	-16(%rbp), %rcx
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm
+	lock addq	$1, 16+__gcov0._ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm(%rip)
+.L117:
+	.loc 6 388 7
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2481:
+	.size	_ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm, .-_ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm
+	.section	.text._ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv,"axG",@progbits,_ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv,comdat
+	.align 2
+	.weak	_ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv
+	.type	_ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv, @function
+_ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv:
+.LFB2482:
+	.loc 6 298 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv(%rip)
+	.loc 6 299 22
+	movq	-8(%rbp), %rax
+	.loc 6 299 31
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2482:
+	.size	_ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv, .-_ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv
+	.section	.text._ZSt8_DestroyIPccEvT_S1_RSaIT0_E,"axG",@progbits,_ZSt8_DestroyIPccEvT_S1_RSaIT0_E,comdat
+	.weak	_ZSt8_DestroyIPccEvT_S1_RSaIT0_E
+	.type	_ZSt8_DestroyIPccEvT_S1_RSaIT0_E, @function
+_ZSt8_DestroyIPccEvT_S1_RSaIT0_E:
+.LFB2483:
+	.file 8 "/usr/include/c++/12/bits/alloc_traits.h"
+	.loc 8 847 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	lock addq	$1, __gcov0._ZSt8_DestroyIPccEvT_S1_RSaIT0_E(%rip)
+	.loc 8 850 15
+	movq	-16(%rbp), %rdx
+	movq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt8_DestroyIPcEvT_S1_
+	lock addq	$1, 8+__gcov0._ZSt8_DestroyIPccEvT_S1_RSaIT0_E(%rip)
+	.loc 8 851 5
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2483:
+	.size	_ZSt8_DestroyIPccEvT_S1_RSaIT0_E, .-_ZSt8_DestroyIPccEvT_S1_RSaIT0_E
+	.section	.rodata
+.LC0:
+	.string	"vector::_M_default_append"
+	.section	.text._ZNSt6vectorIcSaIcEE17_M_default_appendEm,"axG",@progbits,_ZNSt6vectorIcSaIcEE17_M_default_appendEm,comdat
+	.align 2
+	.weak	_ZNSt6vectorIcSaIcEE17_M_default_appendEm
+	.type	_ZNSt6vectorIcSaIcEE17_M_default_appendEm, @function
+_ZNSt6vectorIcSaIcEE17_M_default_appendEm:
+.LFB2484:
+	.file 9 "/usr/include/c++/12/bits/vector.tcc"
+	.loc 9 626 5
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA2484
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	subq	$56, %rsp
+	.cfi_offset 3, -24
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -56(%rbp)
+	movq	%rsi, -64(%rbp)
+	lock addq	$1, __gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+.LBB38:
+	.loc 9 629 7
+	cmpq	$0, -64(%rbp)
+	je	.L135
+	lock addq	$1, 8+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+.LBB39:
+	.loc 9 631 33
+	movq	-56(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE4sizeEv
+	movq	%rax, -24(%rbp)
+	lock addq	$1, 16+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+	.loc 9 632 49
+	movq	-56(%rbp), %rax
+	movq	16(%rax), %rdx
+	.loc 9 633 23
+	movq	-56(%rbp), %rax
+	movq	8(%rax), %rax
+	.loc 9 633 7
+	subq	%rax, %rdx
+	.loc 9 632 14
+	movq	%rdx, -32(%rbp)
+	.loc 9 635 25
+	movq	-56(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE8max_sizeEv
+	.loc 9 635 28
+	cmpq	-24(%rbp), %rax
+	jb	.L123
+	lock addq	$1, 24+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+	.loc 9 635 50 discriminator 2
+	movq	-56(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE8max_sizeEv
+	lock addq	$1, 32+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+	.loc 9 635 53 discriminator 2
+	subq	-24(%rbp), %rax
+	.loc 9 635 28 discriminator 2
+	cmpq	-32(%rbp), %rax
+	jnb	.L124
+.L123:
+	.loc 9 635 28 is_stmt 0 discriminator 3
+	movl	$1, %eax
+	lock addq	$1, 40+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+	jmp	.L125
+.L124:
+	.loc 9 635 28 discriminator 4
+	movl	$0, %eax
+	lock addq	$1, 48+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+.L125:
+	.loc 9 635 4 is_stmt 1 discriminator 6
+	testb	%al, %al
+	je	.L126
+	lock addq	$1, 56+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+.L126:
+.LBB40:
+	.loc 9 638 4
+	movq	-32(%rbp), %rax
+	cmpq	-64(%rbp), %rax
+	jb	.L127
+	lock addq	$1, 64+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+	.loc 9 643 32
+	movq	-56(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv
+	movq	%rax, %rdx
+	lock addq	$1, 72+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+	.loc 9 642 35
+	movq	-56(%rbp), %rax
+	movq	8(%rax), %rax
+	movq	-64(%rbp), %rcx
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+.LEHB9:
+	call	_ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E
+	.loc 9 641 32
+	movq	-56(%rbp), %rdx
+	movq	%rax, 8(%rdx)
+	lock addq	$1, 80+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+.LBE40:
+.LBE39:
+.LBE38:
+	.loc 9 698 5
+	jmp	.L135
+.L127:
+.LBB47:
+.LBB45:
+.LBB43:
+.LBB41:
+	.loc 9 649 15
+	movq	-64(%rbp), %rcx
+	movq	-56(%rbp), %rax
+	leaq	.LC0(%rip), %rdx
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc
+	lock addq	$1, 88+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+	movq	%rax, -40(%rbp)
+	.loc 9 650 45
+	movq	-56(%rbp), %rax
+	movq	-40(%rbp), %rdx
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm
+.LEHE9:
+	lock addq	$1, 96+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+	movq	%rax, -48(%rbp)
+	.loc 9 656 34
+	movq	-56(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv
+	movq	%rax, %rdx
+	lock addq	$1, 104+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+	.loc 9 655 41
+	movq	-48(%rbp), %rcx
+	movq	-24(%rbp), %rax
+	addq	%rax, %rcx
+	movq	-64(%rbp), %rax
+	movq	%rax, %rsi
+	movq	%rcx, %rdi
+.LEHB10:
+	call	_ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E
+.LEHE10:
+	lock addq	$1, 112+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+	.loc 9 664 42
+	movq	-56(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv
+	movq	%rax, %rcx
+	lock addq	$1, 120+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+	.loc 9 663 16
+	movq	-56(%rbp), %rax
+	movq	8(%rax), %rsi
+	movq	-56(%rbp), %rax
+	movq	(%rax), %rax
+	movq	-48(%rbp), %rdx
+	movq	%rax, %rdi
+	call	_ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_
+	lock addq	$1, 128+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+	.loc 9 690 21
+	movq	-56(%rbp), %rax
+	.loc 9 691 22
+	movq	-56(%rbp), %rdx
+	movq	16(%rdx), %rcx
+	.loc 9 692 24
+	movq	-56(%rbp), %rdx
+	movq	(%rdx), %rdx
+	.loc 9 692 8
+	subq	%rdx, %rcx
+	.loc 9 690 21
+	movq	%rcx, %rsi
+	movq	-56(%rbp), %rdx
+	movq	(%rdx), %rcx
+	movq	%rsi, %rdx
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+.LEHB11:
+	call	_ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm
+.LEHE11:
+	.loc 9 693 31
+	movq	-56(%rbp), %rax
+	movq	-48(%rbp), %rdx
+	movq	%rdx, (%rax)
+	.loc 9 694 55
+	movq	-24(%rbp), %rdx
+	movq	-64(%rbp), %rax
+	addq	%rax, %rdx
+	movq	-48(%rbp), %rax
+	addq	%rax, %rdx
+	.loc 9 694 32
+	movq	-56(%rbp), %rax
+	movq	%rdx, 8(%rax)
+	.loc 9 695 54
+	movq	-48(%rbp), %rdx
+	movq	-40(%rbp), %rax
+	addq	%rax, %rdx
+	.loc 9 695 40
+	movq	-56(%rbp), %rax
+	movq	%rdx, 16(%rax)
+	lock addq	$1, 136+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+.LBE41:
+.LBE43:
+.LBE45:
+.LBE47:
+	.loc 9 698 5
+	jmp	.L135
+.L132:
+	lock addq	$1, 144+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+.LBB48:
+.LBB46:
+.LBB44:
+.LBB42:
+	.loc 9 658 5
+	movq	%rax, %rdi
+	call	__cxa_begin_catch@PLT
+	lock addq	$1, 152+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+	.loc 9 660 22
+	movq	-56(%rbp), %rax
+	movq	-40(%rbp), %rdx
+	movq	-48(%rbp), %rcx
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+.LEHB12:
+	call	_ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm
+.LEHE12:
+	lock addq	$1, 168+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+.LEHB13:
+	.loc 9 661 9
+	call	__cxa_rethrow@PLT
+.LEHE13:
+.L133:
+	movq	%rax, %rbx
+	lock addq	$1, 176+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+	jmp	.L130
+.L134:
+	movq	%rax, %rbx
+	lock addq	$1, 160+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+.L130:
+	.loc 9 658 5
+	call	__cxa_end_catch@PLT
+	lock addq	$1, 184+__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm(%rip)
+	movq	%rbx, %rax
+	movq	%rax, %rdi
+.LEHB14:
+	call	_Unwind_Resume@PLT
+.LEHE14:
+.L135:
+.LBE42:
+.LBE44:
+.LBE46:
+.LBE48:
+	.loc 9 698 5
+	nop
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2484:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA2484:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT2484-.LLSDATTD2484
+.LLSDATTD2484:
+	.byte	0x1
+	.uleb128 .LLSDACSE2484-.LLSDACSB2484
+.LLSDACSB2484:
+	.uleb128 .LEHB9-.LFB2484
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB10-.LFB2484
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 .L132-.LFB2484
+	.uleb128 0x1
+	.uleb128 .LEHB11-.LFB2484
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB12-.LFB2484
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 .L134-.LFB2484
+	.uleb128 0
+	.uleb128 .LEHB13-.LFB2484
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 .L133-.LFB2484
+	.uleb128 0
+	.uleb128 .LEHB14-.LFB2484
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE2484:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	0
+
+.LLSDATT2484:
+	.section	.text._ZNSt6vectorIcSaIcEE17_M_default_appendEm,"axG",@progbits,_ZNSt6vectorIcSaIcEE17_M_default_appendEm,comdat
+	.size	_ZNSt6vectorIcSaIcEE17_M_default_appendEm, .-_ZNSt6vectorIcSaIcEE17_M_default_appendEm
+	.section	.text._ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc,"axG",@progbits,_ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc,comdat
+	.align 2
+	.weak	_ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc
+	.type	_ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc, @function
+_ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc:
+.LFB2488:
+	.loc 6 1928 7
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA2488
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	lock addq	$1, __gcov0._ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc(%rip)
+.LBB49:
+	.loc 6 1930 36
+	movq	-24(%rbp), %rax
+	movq	8(%rax), %rax
+	.loc 6 1930 46
+	subq	-32(%rbp), %rax
+	.loc 6 1930 16
+	movq	%rax, -8(%rbp)
+	.loc 6 1930 2
+	cmpq	$0, -8(%rbp)
+	je	.L138
+	lock addq	$1, 8+__gcov0._ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc(%rip)
+	.loc 6 1933 25
+	movq	-24(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv
+	movq	%rax, %rdx
+	lock addq	$1, 16+__gcov0._ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc(%rip)
+	.loc 6 1932 19
+	movq	-24(%rbp), %rax
+	movq	8(%rax), %rcx
+	movq	-32(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt8_DestroyIPccEvT_S1_RSaIT0_E
+	.loc 6 1934 30
+	movq	-24(%rbp), %rax
+	movq	-32(%rbp), %rdx
+	movq	%rdx, 8(%rax)
+	lock addq	$1, 24+__gcov0._ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc(%rip)
+.L138:
+.LBE49:
+	.loc 6 1937 7
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2488:
+	.section	.gcc_except_table
+.LLSDA2488:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE2488-.LLSDACSB2488
+.LLSDACSB2488:
+.LLSDACSE2488:
+	.section	.text._ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc,"axG",@progbits,_ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc,comdat
+	.size	_ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc, .-_ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc
+	.section	.text._ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_,"axG",@progbits,_ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_,comdat
+	.align 2
+	.weak	_ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_
+	.type	_ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_, @function
+_ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_:
+.LFB2489:
+	.loc 6 1985 2
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_(%rip)
+	.loc 6 1986 11
+	movq	-16(%rbp), %rax
+	.loc 6 1986 18
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2489:
+	.size	_ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_, .-_ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_
+	.section	.text._ZSt19__iterator_categoryIPcENSt15iterator_traitsIT_E17iterator_categoryERKS2_,"axG",@progbits,_ZSt19__iterator_categoryIPcENSt15iterator_traitsIT_E17iterator_categoryERKS2_,comdat
+	.weak	_ZSt19__iterator_categoryIPcENSt15iterator_traitsIT_E17iterator_categoryERKS2_
+	.type	_ZSt19__iterator_categoryIPcENSt15iterator_traitsIT_E17iterator_categoryERKS2_, @function
+_ZSt19__iterator_categoryIPcENSt15iterator_traitsIT_E17iterator_categoryERKS2_:
+.LFB2496:
+	.file 10 "/usr/include/c++/12/bits/stl_iterator_base_types.h"
+	.loc 10 238 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZSt19__iterator_categoryIPcENSt15iterator_traitsIT_E17iterator_categoryERKS2_(%rip)
+	.loc 10 239 65
+	nop
+	.loc 10 239 68
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2496:
+	.size	_ZSt19__iterator_categoryIPcENSt15iterator_traitsIT_E17iterator_categoryERKS2_, .-_ZSt19__iterator_categoryIPcENSt15iterator_traitsIT_E17iterator_categoryERKS2_
+	.section	.text._ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm,"axG",@progbits,_ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm,comdat
+	.weak	_ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm
+	.type	_ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm, @function
+_ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm:
+.LFB2553:
+	.loc 8 495 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	lock addq	$1, __gcov0._ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm(%rip)
+	.loc 8 496 23
+	movq	-24(%rbp), %rdx
+	movq	-16(%rbp), %rcx
+	movq	-8(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt15__new_allocatorIcE10deallocateEPcm
+	lock addq	$1, 8+__gcov0._ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm(%rip)
+	.loc 8 496 35
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2553:
+	.size	_ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm, .-_ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm
+	.section	.text._ZSt8_DestroyIPcEvT_S1_,"axG",@progbits,_ZSt8_DestroyIPcEvT_S1_,comdat
+	.weak	_ZSt8_DestroyIPcEvT_S1_
+	.type	_ZSt8_DestroyIPcEvT_S1_, @function
+_ZSt8_DestroyIPcEvT_S1_:
+.LFB2554:
+	.file 11 "/usr/include/c++/12/bits/stl_construct.h"
+	.loc 11 182 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZSt8_DestroyIPcEvT_S1_(%rip)
+	.loc 11 196 11
+	movq	-16(%rbp), %rdx
+	movq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt12_Destroy_auxILb1EE9__destroyIPcEEvT_S3_
+	lock addq	$1, 8+__gcov0._ZSt8_DestroyIPcEvT_S1_(%rip)
+	.loc 11 197 5
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2554:
+	.size	_ZSt8_DestroyIPcEvT_S1_, .-_ZSt8_DestroyIPcEvT_S1_
+	.section	.text._ZNKSt6vectorIcSaIcEE8max_sizeEv,"axG",@progbits,_ZNKSt6vectorIcSaIcEE8max_sizeEv,comdat
+	.align 2
+	.weak	_ZNKSt6vectorIcSaIcEE8max_sizeEv
+	.type	_ZNKSt6vectorIcSaIcEE8max_sizeEv, @function
+_ZNKSt6vectorIcSaIcEE8max_sizeEv:
+.LFB2555:
+	.loc 6 993 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNKSt6vectorIcSaIcEE8max_sizeEv(%rip)
+	.loc 6 994 47
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv
+	lock addq	$1, 8+__gcov0._ZNKSt6vectorIcSaIcEE8max_sizeEv(%rip)
+	.loc 6 994 27
+	movq	%rax, %rdi
+	call	_ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_
+	.loc 6 994 49
+	nop
+	lock addq	$1, 16+__gcov0._ZNKSt6vectorIcSaIcEE8max_sizeEv(%rip)
+	.loc 6 994 52
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2555:
+	.size	_ZNKSt6vectorIcSaIcEE8max_sizeEv, .-_ZNKSt6vectorIcSaIcEE8max_sizeEv
+	.section	.text._ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E,"axG",@progbits,_ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E,comdat
+	.weak	_ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E
+	.type	_ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E, @function
+_ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E:
+.LFB2556:
+	.file 12 "/usr/include/c++/12/bits/stl_uninitialized.h"
+	.loc 12 764 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	lock addq	$1, __gcov0._ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E(%rip)
+	.loc 12 766 44
+	movq	-16(%rbp), %rdx
+	movq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt25__uninitialized_default_nIPcmET_S1_T0_
+	lock addq	$1, 8+__gcov0._ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E(%rip)
+	.loc 12 766 60
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2556:
+	.size	_ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E, .-_ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E
+	.section	.text._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc,"axG",@progbits,_ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc,comdat
+	.align 2
+	.weak	_ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc
+	.type	_ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc, @function
+_ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc:
+.LFB2557:
+	.loc 6 1891 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	subq	$56, %rsp
+	.cfi_offset 3, -24
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -40(%rbp)
+	movq	%rsi, -48(%rbp)
+	movq	%rdx, -56(%rbp)
+	lock addq	$1, __gcov0._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc(%rip)
+	.loc 6 1893 14
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE8max_sizeEv
+	movq	%rax, %rbx
+	lock addq	$1, 8+__gcov0._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc(%rip)
+	.loc 6 1893 23
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE4sizeEv
+	.loc 6 1893 17
+	subq	%rax, %rbx
+	movq	%rbx, %rdx
+	.loc 6 1893 26
+	movq	-48(%rbp), %rax
+	cmpq	%rax, %rdx
+	setb	%al
+	.loc 6 1893 2
+	testb	%al, %al
+	je	.L150
+	lock addq	$1, 16+__gcov0._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc(%rip)
+	.loc 6 1894 24
+	movq	-56(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.L150:
+	lock addq	$1, 24+__gcov0._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc(%rip)
+	.loc 6 1896 30
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE4sizeEv
+	movq	%rax, %rbx
+	lock addq	$1, 32+__gcov0._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc(%rip)
+	.loc 6 1896 50
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE4sizeEv
+	lock addq	$1, 40+__gcov0._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc(%rip)
+	movq	%rax, -32(%rbp)
+	.loc 6 1896 45
+	leaq	-48(%rbp), %rdx
+	leaq	-32(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt3maxImERKT_S2_S2_
+	lock addq	$1, 48+__gcov0._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc(%rip)
+	.loc 6 1896 33
+	movq	(%rax), %rax
+	.loc 6 1896 18
+	addq	%rbx, %rax
+	movq	%rax, -24(%rbp)
+	.loc 6 1897 22
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE4sizeEv
+	lock addq	$1, 56+__gcov0._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc(%rip)
+	.loc 6 1897 48
+	cmpq	%rax, -24(%rbp)
+	jb	.L151
+	lock addq	$1, 64+__gcov0._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc(%rip)
+	.loc 6 1897 44 discriminator 2
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE8max_sizeEv
+	lock addq	$1, 72+__gcov0._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc(%rip)
+	.loc 6 1897 25 discriminator 2
+	cmpq	-24(%rbp), %rax
+	jnb	.L152
+.L151:
+	.loc 6 1897 58 discriminator 3
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorIcSaIcEE8max_sizeEv
+	.loc 6 1897 48 discriminator 3
+	jmp	.L153
+.L152:
+	.loc 6 1897 48 is_stmt 0 discriminator 4
+	movq	-24(%rbp), %rax
+	lock addq	$1, 80+__gcov0._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc(%rip)
+.L153:
+	.loc 6 1897 63 is_stmt 1 discriminator 6
+	nop
+	lock addq	$1, 88+__gcov0._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc(%rip)
+	.loc 6 1898 7 discriminator 6
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2557:
+	.size	_ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc, .-_ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc
+	.section	.text._ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm,"axG",@progbits,_ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm,comdat
+	.align 2
+	.weak	_ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm
+	.type	_ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm, @function
+_ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm:
+.LFB2558:
+	.loc 6 375 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm(%rip)
+	.loc 6 378 18
+	cmpq	$0, -16(%rbp)
+	je	.L156
+	lock addq	$1, 8+__gcov0._ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm(%rip)
+	.loc 6 378 34 discriminator 1
+	movq	-8(%rbp), %rax
+	.loc 6 378 33 discriminator 1
+	movq	-16(%rbp), %rdx
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt16allocator_traitsISaIcEE8allocateERS0_m
+	lock addq	$1, 16+__gcov0._ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm(%rip)
+	.loc 6 378 58 discriminator 1
+	jmp	.L158
+.L156:
+	.loc 6 378 18 discriminator 2
+	movl	$0, %eax
+.L158:
+	.loc 6 379 7 discriminator 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2558:
+	.size	_ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm, .-_ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm
+	.section	.text._ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_,"axG",@progbits,_ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_,comdat
+	.weak	_ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_
+	.type	_ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_, @function
+_ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_:
+.LFB2559:
+	.loc 6 499 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	movq	%rcx, -32(%rbp)
+	lock addq	$1, __gcov0._ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_(%rip)
+	.loc 6 504 26
+	movq	-32(%rbp), %rcx
+	movq	-24(%rbp), %rdx
+	movq	-16(%rbp), %rsi
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_
+	.loc 6 504 61
+	nop
+	lock addq	$1, 8+__gcov0._ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_(%rip)
+	.loc 6 509 7
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2559:
+	.size	_ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_, .-_ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_
+	.section	.text._ZNSt15__new_allocatorIcE10deallocateEPcm,"axG",@progbits,_ZNSt15__new_allocatorIcE10deallocateEPcm,comdat
+	.align 2
+	.weak	_ZNSt15__new_allocatorIcE10deallocateEPcm
+	.type	_ZNSt15__new_allocatorIcE10deallocateEPcm, @function
+_ZNSt15__new_allocatorIcE10deallocateEPcm:
+.LFB2609:
+	.file 13 "/usr/include/c++/12/bits/new_allocator.h"
+	.loc 13 142 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	lock addq	$1, __gcov0._ZNSt15__new_allocatorIcE10deallocateEPcm(%rip)
+	.loc 13 158 19
+	movq	-24(%rbp), %rdx
+	movq	-16(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZdlPvm@PLT
+	lock addq	$1, 8+__gcov0._ZNSt15__new_allocatorIcE10deallocateEPcm(%rip)
+	.loc 13 159 7
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2609:
+	.size	_ZNSt15__new_allocatorIcE10deallocateEPcm, .-_ZNSt15__new_allocatorIcE10deallocateEPcm
+	.section	.text._ZNSt12_Destroy_auxILb1EE9__destroyIPcEEvT_S3_,"axG",@progbits,_ZNSt12_Destroy_auxILb1EE9__destroyIPcEEvT_S3_,comdat
+	.weak	_ZNSt12_Destroy_auxILb1EE9__destroyIPcEEvT_S3_
+	.type	_ZNSt12_Destroy_auxILb1EE9__destroyIPcEEvT_S3_, @function
+_ZNSt12_Destroy_auxILb1EE9__destroyIPcEEvT_S3_:
+.LFB2610:
+	.loc 11 172 9
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Destroy_auxILb1EE9__destroyIPcEEvT_S3_(%rip)
+	.loc 11 172 57
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2610:
+	.size	_ZNSt12_Destroy_auxILb1EE9__destroyIPcEEvT_S3_, .-_ZNSt12_Destroy_auxILb1EE9__destroyIPcEEvT_S3_
+	.section	.text._ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_,"axG",@progbits,_ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_,comdat
+	.weak	_ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_
+	.type	_ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_, @function
+_ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_:
+.LFB2611:
+	.loc 6 1911 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	lock addq	$1, __gcov0._ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_(%rip)
+	.loc 6 1916 15
+	movabsq	$9223372036854775807, %rax
+	movq	%rax, -8(%rbp)
+	.loc 6 1918 51
+	movq	-24(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_
+	lock addq	$1, 8+__gcov0._ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_(%rip)
+	.loc 6 1918 15
+	movq	%rax, -16(%rbp)
+	.loc 6 1919 19
+	leaq	-16(%rbp), %rdx
+	leaq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt3minImERKT_S2_S2_
+	.loc 6 1919 41
+	movq	(%rax), %rax
+	lock addq	$1, 16+__gcov0._ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_(%rip)
+	.loc 6 1920 7
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2611:
+	.size	_ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_, .-_ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_
+	.section	.text._ZNKSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv,"axG",@progbits,_ZNKSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv,comdat
+	.align 2
+	.weak	_ZNKSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv
+	.type	_ZNKSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv, @function
+_ZNKSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv:
+.LFB2612:
+	.loc 6 303 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNKSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv(%rip)
+	.loc 6 304 22
+	movq	-8(%rbp), %rax
+	.loc 6 304 31
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2612:
+	.size	_ZNKSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv, .-_ZNKSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv
+	.section	.text._ZSt25__uninitialized_default_nIPcmET_S1_T0_,"axG",@progbits,_ZSt25__uninitialized_default_nIPcmET_S1_T0_,comdat
+	.weak	_ZSt25__uninitialized_default_nIPcmET_S1_T0_
+	.type	_ZSt25__uninitialized_default_nIPcmET_S1_T0_, @function
+_ZSt25__uninitialized_default_nIPcmET_S1_T0_:
+.LFB2613:
+	.loc 12 691 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	lock addq	$1, __gcov0._ZSt25__uninitialized_default_nIPcmET_S1_T0_(%rip)
+	.loc 12 696 22
+	movb	$1, -1(%rbp)
+	.loc 12 701 20
+	movq	-32(%rbp), %rdx
+	movq	-24(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_
+	lock addq	$1, 8+__gcov0._ZSt25__uninitialized_default_nIPcmET_S1_T0_(%rip)
+	.loc 12 702 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2613:
+	.size	_ZSt25__uninitialized_default_nIPcmET_S1_T0_, .-_ZSt25__uninitialized_default_nIPcmET_S1_T0_
+	.section	.text._ZSt3maxImERKT_S2_S2_,"axG",@progbits,_ZSt3maxImERKT_S2_S2_,comdat
+	.weak	_ZSt3maxImERKT_S2_S2_
+	.type	_ZSt3maxImERKT_S2_S2_, @function
+_ZSt3maxImERKT_S2_S2_:
+.LFB2614:
+	.loc 2 254 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZSt3maxImERKT_S2_S2_(%rip)
+	.loc 2 259 15
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rdx
+	movq	-16(%rbp), %rax
+	movq	(%rax), %rax
+	.loc 2 259 7
+	cmpq	%rax, %rdx
+	jnb	.L171
+	lock addq	$1, 8+__gcov0._ZSt3maxImERKT_S2_S2_(%rip)
+	.loc 2 260 9
+	movq	-16(%rbp), %rax
+	jmp	.L172
+.L171:
+	.loc 2 261 14
+	movq	-8(%rbp), %rax
+.L172:
+	.loc 2 262 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2614:
+	.size	_ZSt3maxImERKT_S2_S2_, .-_ZSt3maxImERKT_S2_S2_
+	.section	.text._ZNSt16allocator_traitsISaIcEE8allocateERS0_m,"axG",@progbits,_ZNSt16allocator_traitsISaIcEE8allocateERS0_m,comdat
+	.weak	_ZNSt16allocator_traitsISaIcEE8allocateERS0_m
+	.type	_ZNSt16allocator_traitsISaIcEE8allocateERS0_m, @function
+_ZNSt16allocator_traitsISaIcEE8allocateERS0_m:
+.LFB2615:
+	.loc 8 463 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZNSt16allocator_traitsISaIcEE8allocateERS0_m(%rip)
+	.loc 8 464 28
+	movq	-16(%rbp), %rcx
+	movq	-8(%rbp), %rax
+	movl	$0, %edx
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt15__new_allocatorIcE8allocateEmPKv
+	lock addq	$1, 8+__gcov0._ZNSt16allocator_traitsISaIcEE8allocateERS0_m(%rip)
+	.loc 8 464 35
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2615:
+	.size	_ZNSt16allocator_traitsISaIcEE8allocateERS0_m, .-_ZNSt16allocator_traitsISaIcEE8allocateERS0_m
+	.section	.text._ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_,"axG",@progbits,_ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_,comdat
+	.weak	_ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_
+	.type	_ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_, @function
+_ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_:
+.LFB2616:
+	.loc 12 1127 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r12
+	pushq	%rbx
+	subq	$32, %rsp
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	movq	%rdx, -40(%rbp)
+	movq	%rcx, -48(%rbp)
+	lock addq	$1, __gcov0._ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_(%rip)
+	.loc 12 1133 33
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt12__niter_baseIPcET_S1_
+	movq	%rax, %r12
+	lock addq	$1, 8+__gcov0._ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_(%rip)
+	movq	-32(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt12__niter_baseIPcET_S1_
+	movq	%rax, %rbx
+	lock addq	$1, 16+__gcov0._ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_(%rip)
+	movq	-24(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt12__niter_baseIPcET_S1_
+	movq	%rax, %rdi
+	lock addq	$1, 24+__gcov0._ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_(%rip)
+	movq	-48(%rbp), %rax
+	movq	%rax, %rcx
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	call	_ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E
+	.loc 12 1135 42
+	nop
+	lock addq	$1, 32+__gcov0._ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_(%rip)
+	.loc 12 1136 5
+	addq	$32, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2616:
+	.size	_ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_, .-_ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_
+	.section	.text._ZSt11__addressofIcEPT_RS0_,"axG",@progbits,_ZSt11__addressofIcEPT_RS0_,comdat
+	.weak	_ZSt11__addressofIcEPT_RS0_
+	.type	_ZSt11__addressofIcEPT_RS0_, @function
+_ZSt11__addressofIcEPT_RS0_:
+.LFB2617:
+	.file 14 "/usr/include/c++/12/bits/move.h"
+	.loc 14 49 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZSt11__addressofIcEPT_RS0_(%rip)
+	.loc 14 50 37
+	movq	-8(%rbp), %rax
+	.loc 14 50 40
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2617:
+	.size	_ZSt11__addressofIcEPT_RS0_, .-_ZSt11__addressofIcEPT_RS0_
+	.section	.text._ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_,"axG",@progbits,_ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_,comdat
+	.weak	_ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_
+	.type	_ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_, @function
+_ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_:
+.LFB2636:
+	.loc 8 547 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_(%rip)
+	.loc 8 550 21
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt15__new_allocatorIcE8max_sizeEv
+	.loc 8 550 22
+	nop
+	lock addq	$1, 8+__gcov0._ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_(%rip)
+	.loc 8 554 7
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2636:
+	.size	_ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_, .-_ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_
+	.section	.text._ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_,"axG",@progbits,_ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_,comdat
+	.weak	_ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_
+	.type	_ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_, @function
+_ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_:
+.LFB2637:
+	.loc 12 655 9
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	lock addq	$1, __gcov0._ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_(%rip)
+.LBB50:
+	.loc 12 657 4
+	cmpq	$0, -32(%rbp)
+	je	.L182
+	lock addq	$1, 8+__gcov0._ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_(%rip)
+.LBB51:
+	.loc 12 660 21
+	movq	-24(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt11__addressofIcEPT_RS0_
+	movq	%rax, -8(%rbp)
+	lock addq	$1, 16+__gcov0._ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_(%rip)
+	.loc 12 661 23
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt10_ConstructIcJEEvPT_DpOT0_
+	lock addq	$1, 24+__gcov0._ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_(%rip)
+	.loc 12 662 8
+	addq	$1, -24(%rbp)
+	.loc 12 663 29
+	movq	-32(%rbp), %rax
+	leaq	-1(%rax), %rcx
+	movq	-8(%rbp), %rdx
+	movq	-24(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt6fill_nIPcmcET_S1_T0_RKT1_
+	movq	%rax, -24(%rbp)
+.L182:
+.LBE51:
+.LBE50:
+	.loc 12 665 11
+	movq	-24(%rbp), %rax
+	lock addq	$1, 32+__gcov0._ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_(%rip)
+	.loc 12 666 2
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2637:
+	.size	_ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_, .-_ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_
+	.section	.text._ZNSt15__new_allocatorIcE8allocateEmPKv,"axG",@progbits,_ZNSt15__new_allocatorIcE8allocateEmPKv,comdat
+	.align 2
+	.weak	_ZNSt15__new_allocatorIcE8allocateEmPKv
+	.type	_ZNSt15__new_allocatorIcE8allocateEmPKv, @function
+_ZNSt15__new_allocatorIcE8allocateEmPKv:
+.LFB2638:
+	.loc 13 112 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	lock addq	$1, __gcov0._ZNSt15__new_allocatorIcE8allocateEmPKv(%rip)
+	.loc 13 120 46
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt15__new_allocatorIcE11_M_max_sizeEv
+	lock addq	$1, 8+__gcov0._ZNSt15__new_allocatorIcE8allocateEmPKv(%rip)
+	.loc 13 120 27
+	cmpq	-16(%rbp), %rax
+	setb	%al
+	.loc 13 120 22
+	movzbl	%al, %eax
+	testq	%rax, %rax
+	setne	%al
+	.loc 13 120 2
+	testb	%al, %al
+	je	.L185
+	lock addq	$1, 16+__gcov0._ZNSt15__new_allocatorIcE8allocateEmPKv(%rip)
+	.loc 13 126 28
+	call	_ZSt17__throw_bad_allocv@PLT
+.L185:
+	.loc 13 137 41
+	movq	-16(%rbp), %rax
+	movq	%rax, %rdi
+	call	_Znwm@PLT
+	lock addq	$1, 24+__gcov0._ZNSt15__new_allocatorIcE8allocateEmPKv(%rip)
+	.loc 13 137 60
+	nop
+	.loc 13 138 7
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2638:
+	.size	_ZNSt15__new_allocatorIcE8allocateEmPKv, .-_ZNSt15__new_allocatorIcE8allocateEmPKv
+	.section	.text._ZSt12__niter_baseIPcET_S1_,"axG",@progbits,_ZSt12__niter_baseIPcET_S1_,comdat
+	.weak	_ZSt12__niter_baseIPcET_S1_
+	.type	_ZSt12__niter_baseIPcET_S1_, @function
+_ZSt12__niter_baseIPcET_S1_:
+.LFB2639:
+	.loc 2 313 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZSt12__niter_baseIPcET_S1_(%rip)
+	.loc 2 315 14
+	movq	-8(%rbp), %rax
+	.loc 2 315 20
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2639:
+	.size	_ZSt12__niter_baseIPcET_S1_, .-_ZSt12__niter_baseIPcET_S1_
+	.section	.text._ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E,"axG",@progbits,_ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E,comdat
+	.weak	_ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E
+	.type	_ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E, @function
+_ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E:
+.LFB2640:
+	.loc 12 1100 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$48, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	movq	%rdx, -40(%rbp)
+	movq	%rcx, -48(%rbp)
+	lock addq	$1, __gcov0._ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E(%rip)
+	.loc 12 1104 17
+	movq	-32(%rbp), %rax
+	subq	-24(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	.loc 12 1105 7
+	cmpq	$0, -8(%rbp)
+	jle	.L190
+	lock addq	$1, 8+__gcov0._ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E(%rip)
+	.loc 12 1117 21
+	movq	-8(%rbp), %rdx
+	movq	-24(%rbp), %rcx
+	movq	-40(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	memmove@PLT
+.L190:
+	.loc 12 1119 25
+	movq	-8(%rbp), %rdx
+	movq	-40(%rbp), %rax
+	addq	%rdx, %rax
+	.loc 12 1120 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2640:
+	.size	_ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E, .-_ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E
+	.section	.text._ZNKSt15__new_allocatorIcE8max_sizeEv,"axG",@progbits,_ZNKSt15__new_allocatorIcE8max_sizeEv,comdat
+	.align 2
+	.weak	_ZNKSt15__new_allocatorIcE8max_sizeEv
+	.type	_ZNKSt15__new_allocatorIcE8max_sizeEv, @function
+_ZNKSt15__new_allocatorIcE8max_sizeEv:
+.LFB2649:
+	.loc 13 167 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNKSt15__new_allocatorIcE8max_sizeEv(%rip)
+	.loc 13 168 27
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt15__new_allocatorIcE11_M_max_sizeEv
+	.loc 13 168 28
+	nop
+	lock addq	$1, 8+__gcov0._ZNKSt15__new_allocatorIcE8max_sizeEv(%rip)
+	.loc 13 168 31
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2649:
+	.size	_ZNKSt15__new_allocatorIcE8max_sizeEv, .-_ZNKSt15__new_allocatorIcE8max_sizeEv
+	.section	.text._ZSt10_ConstructIcJEEvPT_DpOT0_,"axG",@progbits,_ZSt10_ConstructIcJEEvPT_DpOT0_,comdat
+	.weak	_ZSt10_ConstructIcJEEvPT_DpOT0_
+	.type	_ZSt10_ConstructIcJEEvPT_DpOT0_, @function
+_ZSt10_ConstructIcJEEvPT_DpOT0_:
+.LFB2650:
+	.loc 11 109 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZSt10_ConstructIcJEEvPT_DpOT0_(%rip)
+	.loc 11 119 13
+	movq	-8(%rbp), %rax
+	.loc 11 119 7
+	movq	%rax, %rsi
+	movl	$1, %edi
+	call	_ZnwmPv
+	lock addq	$1, 8+__gcov0._ZSt10_ConstructIcJEEvPT_DpOT0_(%rip)
+	movb	$0, (%rax)
+	.loc 11 120 5
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2650:
+	.size	_ZSt10_ConstructIcJEEvPT_DpOT0_, .-_ZSt10_ConstructIcJEEvPT_DpOT0_
+	.section	.text._ZSt6fill_nIPcmcET_S1_T0_RKT1_,"axG",@progbits,_ZSt6fill_nIPcmcET_S1_T0_RKT1_,comdat
+	.weak	_ZSt6fill_nIPcmcET_S1_T0_RKT1_
+	.type	_ZSt6fill_nIPcmcET_S1_T0_RKT1_, @function
+_ZSt6fill_nIPcmcET_S1_T0_RKT1_:
+.LFB2651:
+	.loc 2 1143 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	lock addq	$1, __gcov0._ZSt6fill_nIPcmcET_S1_T0_RKT1_(%rip)
+	.loc 2 1149 35
+	leaq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt19__iterator_categoryIPcENSt15iterator_traitsIT_E17iterator_categoryERKS2_
+	lock addq	$1, 8+__gcov0._ZSt6fill_nIPcmcET_S1_T0_RKT1_(%rip)
+	.loc 2 1148 29
+	movq	-16(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt17__size_to_integerm
+	movq	%rax, %rcx
+	lock addq	$1, 16+__gcov0._ZSt6fill_nIPcmcET_S1_T0_RKT1_(%rip)
+	movq	-8(%rbp), %rax
+	movq	-24(%rbp), %rdx
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag
+	.loc 2 1149 44
+	nop
+	lock addq	$1, 24+__gcov0._ZSt6fill_nIPcmcET_S1_T0_RKT1_(%rip)
+	.loc 2 1150 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2651:
+	.size	_ZSt6fill_nIPcmcET_S1_T0_RKT1_, .-_ZSt6fill_nIPcmcET_S1_T0_RKT1_
+	.section	.text._ZNKSt15__new_allocatorIcE11_M_max_sizeEv,"axG",@progbits,_ZNKSt15__new_allocatorIcE11_M_max_sizeEv,comdat
+	.align 2
+	.weak	_ZNKSt15__new_allocatorIcE11_M_max_sizeEv
+	.type	_ZNKSt15__new_allocatorIcE11_M_max_sizeEv, @function
+_ZNKSt15__new_allocatorIcE11_M_max_sizeEv:
+.LFB2652:
+	.loc 13 210 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNKSt15__new_allocatorIcE11_M_max_sizeEv(%rip)
+	.loc 13 213 54
+	movabsq	$9223372036854775807, %rax
+	.loc 13 217 7
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2652:
+	.size	_ZNKSt15__new_allocatorIcE11_M_max_sizeEv, .-_ZNKSt15__new_allocatorIcE11_M_max_sizeEv
+	.section	.text._ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag,"axG",@progbits,_ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag,comdat
+	.weak	_ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag
+	.type	_ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag, @function
+_ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag:
+.LFB2656:
+	.loc 2 1108 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	lock addq	$1, __gcov0._ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag(%rip)
+	.loc 2 1114 7
+	cmpq	$0, -16(%rbp)
+	jne	.L200
+	lock addq	$1, 8+__gcov0._ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag(%rip)
+	.loc 2 1115 9
+	movq	-8(%rbp), %rax
+	jmp	.L201
+.L200:
+	.loc 2 1119 20
+	movq	-8(%rbp), %rdx
+	movq	-16(%rbp), %rax
+	leaq	(%rdx,%rax), %rcx
+	movq	-24(%rbp), %rdx
+	movq	-8(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt8__fill_aIPccEvT_S1_RKT0_
+	lock addq	$1, 16+__gcov0._ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag(%rip)
+	.loc 2 1120 24
+	movq	-8(%rbp), %rdx
+	movq	-16(%rbp), %rax
+	addq	%rdx, %rax
+.L201:
+	.loc 2 1121 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2656:
+	.size	_ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag, .-_ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag
+	.section	.text._ZSt8__fill_aIPccEvT_S1_RKT0_,"axG",@progbits,_ZSt8__fill_aIPccEvT_S1_RKT0_,comdat
+	.weak	_ZSt8__fill_aIPccEvT_S1_RKT0_
+	.type	_ZSt8__fill_aIPccEvT_S1_RKT0_, @function
+_ZSt8__fill_aIPccEvT_S1_RKT0_:
+.LFB2657:
+	.loc 2 967 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	lock addq	$1, __gcov0._ZSt8__fill_aIPccEvT_S1_RKT0_(%rip)
+	.loc 2 968 21
+	movq	-24(%rbp), %rdx
+	movq	-16(%rbp), %rcx
+	movq	-8(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_
+	lock addq	$1, 8+__gcov0._ZSt8__fill_aIPccEvT_S1_RKT0_(%rip)
+	.loc 2 968 49
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2657:
+	.size	_ZSt8__fill_aIPccEvT_S1_RKT0_, .-_ZSt8__fill_aIPccEvT_S1_RKT0_
+	.section	.text._ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_,"axG",@progbits,_ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_,comdat
+	.weak	_ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_
+	.type	_ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_, @function
+_ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_:
+.LFB2658:
+	.loc 2 930 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$48, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	movq	%rdx, -40(%rbp)
+	lock addq	$1, __gcov0._ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_(%rip)
+	.loc 2 932 17
+	movq	-40(%rbp), %rax
+	movzbl	(%rax), %eax
+	movb	%al, -1(%rbp)
+.LBB52:
+	.loc 2 941 39
+	movq	-32(%rbp), %rax
+	subq	-24(%rbp), %rax
+	.loc 2 941 24
+	movq	%rax, -16(%rbp)
+	.loc 2 941 7
+	cmpq	$0, -16(%rbp)
+	je	.L205
+	lock addq	$1, 8+__gcov0._ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_(%rip)
+	.loc 2 942 28
+	movzbl	-1(%rbp), %eax
+	.loc 2 942 18
+	movzbl	%al, %ecx
+	movq	-16(%rbp), %rdx
+	movq	-24(%rbp), %rax
+	movl	%ecx, %esi
+	movq	%rax, %rdi
+	call	memset@PLT
+.L205:
+.LBE52:
+	.loc 2 943 5
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2658:
+	.size	_ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_, .-_ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_
+	.local	__gcov0._ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_
+	.comm	__gcov0._ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_,16,16
+	.local	__gcov0._ZSt8__fill_aIPccEvT_S1_RKT0_
+	.comm	__gcov0._ZSt8__fill_aIPccEvT_S1_RKT0_,16,16
+	.local	__gcov0._ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag
+	.comm	__gcov0._ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag,24,16
+	.local	__gcov0._ZNKSt15__new_allocatorIcE11_M_max_sizeEv
+	.comm	__gcov0._ZNKSt15__new_allocatorIcE11_M_max_sizeEv,8,8
+	.local	__gcov0._ZSt6fill_nIPcmcET_S1_T0_RKT1_
+	.comm	__gcov0._ZSt6fill_nIPcmcET_S1_T0_RKT1_,32,32
+	.local	__gcov0._ZSt10_ConstructIcJEEvPT_DpOT0_
+	.comm	__gcov0._ZSt10_ConstructIcJEEvPT_DpOT0_,16,16
+	.local	__gcov0._ZNKSt15__new_allocatorIcE8max_sizeEv
+	.comm	__gcov0._ZNKSt15__new_allocatorIcE8max_sizeEv,16,16
+	.local	__gcov0._ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E
+	.comm	__gcov0._ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E,16,16
+	.local	__gcov0._ZSt12__niter_baseIPcET_S1_
+	.comm	__gcov0._ZSt12__niter_baseIPcET_S1_,8,8
+	.local	__gcov0._ZNSt15__new_allocatorIcE8allocateEmPKv
+	.comm	__gcov0._ZNSt15__new_allocatorIcE8allocateEmPKv,32,32
+	.local	__gcov0._ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_
+	.comm	__gcov0._ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_,40,32
+	.local	__gcov0._ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_
+	.comm	__gcov0._ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_,16,16
+	.local	__gcov0._ZSt11__addressofIcEPT_RS0_
+	.comm	__gcov0._ZSt11__addressofIcEPT_RS0_,8,8
+	.local	__gcov0._ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_
+	.comm	__gcov0._ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_,40,32
+	.local	__gcov0._ZNSt16allocator_traitsISaIcEE8allocateERS0_m
+	.comm	__gcov0._ZNSt16allocator_traitsISaIcEE8allocateERS0_m,16,16
+	.local	__gcov0._ZSt3maxImERKT_S2_S2_
+	.comm	__gcov0._ZSt3maxImERKT_S2_S2_,16,16
+	.local	__gcov0._ZSt25__uninitialized_default_nIPcmET_S1_T0_
+	.comm	__gcov0._ZSt25__uninitialized_default_nIPcmET_S1_T0_,16,16
+	.local	__gcov0._ZNKSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv
+	.comm	__gcov0._ZNKSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv,8,8
+	.local	__gcov0._ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_
+	.comm	__gcov0._ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_,24,16
+	.local	__gcov0._ZNSt12_Destroy_auxILb1EE9__destroyIPcEEvT_S3_
+	.comm	__gcov0._ZNSt12_Destroy_auxILb1EE9__destroyIPcEEvT_S3_,8,8
+	.local	__gcov0._ZNSt15__new_allocatorIcE10deallocateEPcm
+	.comm	__gcov0._ZNSt15__new_allocatorIcE10deallocateEPcm,16,16
+	.local	__gcov0._ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_
+	.comm	__gcov0._ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_,16,16
+	.local	__gcov0._ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm
+	.comm	__gcov0._ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm,24,16
+	.local	__gcov0._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc
+	.comm	__gcov0._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc,96,32
+	.local	__gcov0._ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E
+	.comm	__gcov0._ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E,16,16
+	.local	__gcov0._ZNKSt6vectorIcSaIcEE8max_sizeEv
+	.comm	__gcov0._ZNKSt6vectorIcSaIcEE8max_sizeEv,24,16
+	.local	__gcov0._ZSt8_DestroyIPcEvT_S1_
+	.comm	__gcov0._ZSt8_DestroyIPcEvT_S1_,16,16
+	.local	__gcov0._ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm
+	.comm	__gcov0._ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm,16,16
+	.local	__gcov0._ZSt19__iterator_categoryIPcENSt15iterator_traitsIT_E17iterator_categoryERKS2_
+	.comm	__gcov0._ZSt19__iterator_categoryIPcENSt15iterator_traitsIT_E17iterator_categoryERKS2_,8,8
+	.local	__gcov0._ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_
+	.comm	__gcov0._ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_,8,8
+	.local	__gcov0._ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc
+	.comm	__gcov0._ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc,32,32
+	.local	__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm
+	.comm	__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm,192,32
+	.local	__gcov0._ZSt8_DestroyIPccEvT_S1_RSaIT0_E
+	.comm	__gcov0._ZSt8_DestroyIPccEvT_S1_RSaIT0_E,16,16
+	.local	__gcov0._ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv
+	.comm	__gcov0._ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv,8,8
+	.local	__gcov0._ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm
+	.comm	__gcov0._ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm,24,16
+	.local	__gcov0._ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC2Ev
+	.comm	__gcov0._ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC2Ev,8,8
+	.local	__gcov0._ZNKSt6vectorIcSaIcEE4dataEv
+	.comm	__gcov0._ZNKSt6vectorIcSaIcEE4dataEv,16,16
+	.local	__gcov0._ZNSt6vectorIcSaIcEE4dataEv
+	.comm	__gcov0._ZNSt6vectorIcSaIcEE4dataEv,16,16
+	.local	__gcov0._ZSt3minImERKT_S2_S2_
+	.comm	__gcov0._ZSt3minImERKT_S2_S2_,16,16
+	.local	__gcov0._ZNKSt6vectorIcSaIcEE4sizeEv
+	.comm	__gcov0._ZNKSt6vectorIcSaIcEE4sizeEv,8,8
+	.local	__gcov0._ZNSt6vectorIcSaIcEE6resizeEm
+	.comm	__gcov0._ZNSt6vectorIcSaIcEE6resizeEm,64,32
+	.local	__gcov0._ZNSt6vectorIcSaIcEED2Ev
+	.comm	__gcov0._ZNSt6vectorIcSaIcEED2Ev,32,32
+	.local	__gcov0._ZNSt12_Vector_baseIcSaIcEED2Ev
+	.comm	__gcov0._ZNSt12_Vector_baseIcSaIcEED2Ev,24,16
+	.local	__gcov0._ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev
+	.comm	__gcov0._ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev,24,16
+	.local	__gcov0._ZNSt13__atomic_baseImEC2Em
+	.comm	__gcov0._ZNSt13__atomic_baseImEC2Em,8,8
+	.local	__gcov0._ZNK9simulator8log_ring8copy_outEmPcm
+	.comm	__gcov0._ZNK9simulator8log_ring8copy_outEmPcm,40,32
+	.local	__gcov0._ZN9simulator8log_ring7copy_inEmPKcm
+	.comm	__gcov0._ZN9simulator8log_ring7copy_inEmPKcm,40,32
+	.local	__gcov0._ZNK9simulator8log_ring12get_capacityEv
+	.comm	__gcov0._ZNK9simulator8log_ring12get_capacityEv,16,16
+	.local	__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE
+	.comm	__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE,328,32
+	.local	__gcov0._ZN9simulator8log_ring8try_pushElPKcj
+	.comm	__gcov0._ZN9simulator8log_ring8try_pushElPKcj,304,32
+	.local	__gcov0._ZN9simulator8log_ringC2Em
+	.comm	__gcov0._ZN9simulator8log_ringC2Em,64,32
+	.local	__gcov0._ZNSt6vectorIcSaIcEEC2Ev
+	.comm	__gcov0._ZNSt6vectorIcSaIcEEC2Ev,16,16
+	.local	__gcov0._ZNSt12_Vector_baseIcSaIcEEC2Ev
+	.comm	__gcov0._ZNSt12_Vector_baseIcSaIcEEC2Ev,16,16
+	.local	__gcov0._ZNSt12_Vector_baseIcSaIcEE12_Vector_implD2Ev
+	.comm	__gcov0._ZNSt12_Vector_baseIcSaIcEE12_Vector_implD2Ev,16,16
+	.local	__gcov0._ZNSt6atomicImEC2Em
+	.comm	__gcov0._ZNSt6atomicImEC2Em,16,16
+	.local	__gcov0._ZStanSt12memory_orderSt23__memory_order_modifier
+	.comm	__gcov0._ZStanSt12memory_orderSt23__memory_order_modifier,8,8
+	.local	__gcov0._ZnwmPv
+	.comm	__gcov0._ZnwmPv,8,8
+	.local	__gcov0._ZSt17__size_to_integerm
+	.comm	__gcov0._ZSt17__size_to_integerm,8,8
+	.local	__gcov0._ZSt23__is_constant_evaluatedv
+	.comm	__gcov0._ZSt23__is_constant_evaluatedv,8,8
+	.section	.data.rel.local,"aw"
+	.align 32
+	.type	__gcov_._ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_, @object
+	.size	__gcov_._ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_, 40
+__gcov_._ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_:
+	.quad	.LPBX0
+	.long	695615255
+	.long	-797635245
+	.long	357215991
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_
+	.section	.rodata
+	.align 8
+.LC1:
+	.string	"/root/repo/build/debug/./src/main/log_ring.gcda"
+	.section	.data.rel,"aw"
+	.align 32
+	.type	.LPBX0, @object
+	.size	.LPBX0, 112
+.LPBX0:
+	.long	1110585898
+	.zero	4
+	.quad	0
+	.long	1228383600
+	.long	1937722089
+	.quad	.LC1
+	.quad	__gcov_merge_add
+	.quad	0
+	.quad	0
+	.quad	0
+	.quad	0
+	.quad	0
+	.quad	0
+	.quad	0
+	.long	59
+	.zero	4
+	.quad	.LPBX1
+	.section	.data.rel.local
+	.align 32
+	.type	__gcov_._ZSt8__fill_aIPccEvT_S1_RKT0_, @object
+	.size	__gcov_._ZSt8__fill_aIPccEvT_S1_RKT0_, 40
+__gcov_._ZSt8__fill_aIPccEvT_S1_RKT0_:
+	.quad	.LPBX0
+	.long	2060926500
+	.long	-1311820381
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt8__fill_aIPccEvT_S1_RKT0_
+	.align 32
+	.type	__gcov_._ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag, @object
+	.size	__gcov_._ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag, 40
+__gcov_._ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag:
+	.quad	.LPBX0
+	.long	1334429361
+	.long	1645130287
+	.long	1343802470
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag
+	.align 32
+	.type	__gcov_._ZNKSt15__new_allocatorIcE11_M_max_sizeEv, @object
+	.size	__gcov_._ZNKSt15__new_allocatorIcE11_M_max_sizeEv, 40
+__gcov_._ZNKSt15__new_allocatorIcE11_M_max_sizeEv:
+	.quad	.LPBX0
+	.long	76087340
+	.long	1287664801
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNKSt15__new_allocatorIcE11_M_max_sizeEv
+	.align 32
+	.type	__gcov_._ZSt6fill_nIPcmcET_S1_T0_RKT1_, @object
+	.size	__gcov_._ZSt6fill_nIPcmcET_S1_T0_RKT1_, 40
+__gcov_._ZSt6fill_nIPcmcET_S1_T0_RKT1_:
+	.quad	.LPBX0
+	.long	1814383149
+	.long	704181061
+	.long	-212105353
+	.zero	4
+	.long	4
+	.zero	4
+	.quad	__gcov0._ZSt6fill_nIPcmcET_S1_T0_RKT1_
+	.align 32
+	.type	__gcov_._ZSt10_ConstructIcJEEvPT_DpOT0_, @object
+	.size	__gcov_._ZSt10_ConstructIcJEEvPT_DpOT0_, 40
+__gcov_._ZSt10_ConstructIcJEEvPT_DpOT0_:
+	.quad	.LPBX0
+	.long	353921232
+	.long	1381854390
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt10_ConstructIcJEEvPT_DpOT0_
+	.align 32
+	.type	__gcov_._ZNKSt15__new_allocatorIcE8max_sizeEv, @object
+	.size	__gcov_._ZNKSt15__new_allocatorIcE8max_sizeEv, 40
+__gcov_._ZNKSt15__new_allocatorIcE8max_sizeEv:
+	.quad	.LPBX0
+	.long	330406592
+	.long	1175364825
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNKSt15__new_allocatorIcE8max_sizeEv
+	.align 32
+	.type	__gcov_._ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E, @object
+	.size	__gcov_._ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E, 40
+__gcov_._ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E:
+	.quad	.LPBX0
+	.long	1524088
+	.long	-1620618500
+	.long	-1955494511
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E
+	.align 32
+	.type	__gcov_._ZSt12__niter_baseIPcET_S1_, @object
+	.size	__gcov_._ZSt12__niter_baseIPcET_S1_, 40
+__gcov_._ZSt12__niter_baseIPcET_S1_:
+	.quad	.LPBX0
+	.long	1615483483
+	.long	1852810412
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZSt12__niter_baseIPcET_S1_
+	.align 32
+	.type	__gcov_._ZNSt15__new_allocatorIcE8allocateEmPKv, @object
+	.size	__gcov_._ZNSt15__new_allocatorIcE8allocateEmPKv, 40
+__gcov_._ZNSt15__new_allocatorIcE8allocateEmPKv:
+	.quad	.LPBX0
+	.long	88395471
+	.long	-1599778729
+	.long	-1001174357
+	.zero	4
+	.long	4
+	.zero	4
+	.quad	__gcov0._ZNSt15__new_allocatorIcE8allocateEmPKv
+	.align 32
+	.type	__gcov_._ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_, @object
+	.size	__gcov_._ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_, 40
+__gcov_._ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_:
+	.quad	.LPBX0
+	.long	858694502
+	.long	-788395339
+	.long	1513684644
+	.zero	4
+	.long	5
+	.zero	4
+	.quad	__gcov0._ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_
+	.align 32
+	.type	__gcov_._ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_, @object
+	.size	__gcov_._ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_, 40
+__gcov_._ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_:
+	.quad	.LPBX0
+	.long	1911859672
+	.long	-956622722
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_
+	.align 32
+	.type	__gcov_._ZSt11__addressofIcEPT_RS0_, @object
+	.size	__gcov_._ZSt11__addressofIcEPT_RS0_, 40
+__gcov_._ZSt11__addressofIcEPT_RS0_:
+	.quad	.LPBX0
+	.long	1922834819
+	.long	1932278801
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZSt11__addressofIcEPT_RS0_
+	.align 32
+	.type	__gcov_._ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_, @object
+	.size	__gcov_._ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_, 40
+__gcov_._ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_:
+	.quad	.LPBX0
+	.long	1299356831
+	.long	-1776506105
+	.long	260709395
+	.zero	4
+	.long	5
+	.zero	4
+	.quad	__gcov0._ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_
+	.align 32
+	.type	__gcov_._ZNSt16allocator_traitsISaIcEE8allocateERS0_m, @object
+	.size	__gcov_._ZNSt16allocator_traitsISaIcEE8allocateERS0_m, 40
+__gcov_._ZNSt16allocator_traitsISaIcEE8allocateERS0_m:
+	.quad	.LPBX0
+	.long	1502394377
+	.long	-1278931067
+	.long	2092124921
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt16allocator_traitsISaIcEE8allocateERS0_m
+	.align 32
+	.type	__gcov_._ZSt3maxImERKT_S2_S2_, @object
+	.size	__gcov_._ZSt3maxImERKT_S2_S2_, 40
+__gcov_._ZSt3maxImERKT_S2_S2_:
+	.quad	.LPBX0
+	.long	1077455238
+	.long	-1803683750
+	.long	-1032003044
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt3maxImERKT_S2_S2_
+	.align 32
+	.type	__gcov_._ZSt25__uninitialized_default_nIPcmET_S1_T0_, @object
+	.size	__gcov_._ZSt25__uninitialized_default_nIPcmET_S1_T0_, 40
+__gcov_._ZSt25__uninitialized_default_nIPcmET_S1_T0_:
+	.quad	.LPBX0
+	.long	1409863003
+	.long	379949941
+	.long	2092124921
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt25__uninitialized_default_nIPcmET_S1_T0_
+	.align 32
+	.type	__gcov_._ZNKSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv, @object
+	.size	__gcov_._ZNKSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv, 40
+__gcov_._ZNKSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv:
+	.quad	.LPBX0
+	.long	983289777
+	.long	-1164453564
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNKSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv
+	.align 32
+	.type	__gcov_._ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_, @object
+	.size	__gcov_._ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_, 40
+__gcov_._ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_:
+	.quad	.LPBX0
+	.long	683469272
+	.long	-2088000942
+	.long	-162248067
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_
+	.align 32
+	.type	__gcov_._ZNSt12_Destroy_auxILb1EE9__destroyIPcEEvT_S3_, @object
+	.size	__gcov_._ZNSt12_Destroy_auxILb1EE9__destroyIPcEEvT_S3_, 40
+__gcov_._ZNSt12_Destroy_auxILb1EE9__destroyIPcEEvT_S3_:
+	.quad	.LPBX0
+	.long	1355176493
+	.long	-1495616651
+	.long	-1540324424
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNSt12_Destroy_auxILb1EE9__destroyIPcEEvT_S3_
+	.align 32
+	.type	__gcov_._ZNSt15__new_allocatorIcE10deallocateEPcm, @object
+	.size	__gcov_._ZNSt15__new_allocatorIcE10deallocateEPcm, 40
+__gcov_._ZNSt15__new_allocatorIcE10deallocateEPcm:
+	.quad	.LPBX0
+	.long	827109195
+	.long	-191115895
+	.long	-191797997
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt15__new_allocatorIcE10deallocateEPcm
+	.align 32
+	.type	__gcov_._ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_, @object
+	.size	__gcov_._ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_, 40
+__gcov_._ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_:
+	.quad	.LPBX0
+	.long	1038469090
+	.long	-109044001
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_
+	.align 32
+	.type	__gcov_._ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm, @object
+	.size	__gcov_._ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm, 40
+__gcov_._ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm:
+	.quad	.LPBX0
+	.long	836440455
+	.long	-1204808818
+	.long	1891682443
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm
+	.align 32
+	.type	__gcov_._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc, @object
+	.size	__gcov_._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc, 40
+__gcov_._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc:
+	.quad	.LPBX0
+	.long	1767528278
+	.long	1537136337
+	.long	-284142522
+	.zero	4
+	.long	12
+	.zero	4
+	.quad	__gcov0._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc
+	.align 32
+	.type	__gcov_._ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E, @object
+	.size	__gcov_._ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E, 40
+__gcov_._ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E:
+	.quad	.LPBX0
+	.long	1812107535
+	.long	-1814064712
+	.long	2092124921
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E
+	.align 32
+	.type	__gcov_._ZNKSt6vectorIcSaIcEE8max_sizeEv, @object
+	.size	__gcov_._ZNKSt6vectorIcSaIcEE8max_sizeEv, 40
+__gcov_._ZNKSt6vectorIcSaIcEE8max_sizeEv:
+	.quad	.LPBX0
+	.long	785718976
+	.long	-1349397427
+	.long	-206267174
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZNKSt6vectorIcSaIcEE8max_sizeEv
+	.align 32
+	.type	__gcov_._ZSt8_DestroyIPcEvT_S1_, @object
+	.size	__gcov_._ZSt8_DestroyIPcEvT_S1_, 40
+__gcov_._ZSt8_DestroyIPcEvT_S1_:
+	.quad	.LPBX0
+	.long	1832903795
+	.long	827016712
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt8_DestroyIPcEvT_S1_
+	.align 32
+	.type	__gcov_._ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm, @object
+	.size	__gcov_._ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm, 40
+__gcov_._ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm:
+	.quad	.LPBX0
+	.long	1347526914
+	.long	-649379972
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm
+	.align 32
+	.type	__gcov_._ZSt19__iterator_categoryIPcENSt15iterator_traitsIT_E17iterator_categoryERKS2_, @object
+	.size	__gcov_._ZSt19__iterator_categoryIPcENSt15iterator_traitsIT_E17iterator_categoryERKS2_, 40
+__gcov_._ZSt19__iterator_categoryIPcENSt15iterator_traitsIT_E17iterator_categoryERKS2_:
+	.quad	.LPBX0
+	.long	674277282
+	.long	-950461335
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZSt19__iterator_categoryIPcENSt15iterator_traitsIT_E17iterator_categoryERKS2_
+	.align 32
+	.type	__gcov_._ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_, @object
+	.size	__gcov_._ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_, 40
+__gcov_._ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_:
+	.quad	.LPBX0
+	.long	930692440
+	.long	209247792
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_
+	.align 32
+	.type	__gcov_._ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc, @object
+	.size	__gcov_._ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc, 40
+__gcov_._ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc:
+	.quad	.LPBX0
+	.long	1033246490
+	.long	1073623279
+	.long	379464595
+	.zero	4
+	.long	4
+	.zero	4
+	.quad	__gcov0._ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc
+	.align 32
+	.type	__gcov_._ZNSt6vectorIcSaIcEE17_M_default_appendEm, @object
+	.size	__gcov_._ZNSt6vectorIcSaIcEE17_M_default_appendEm, 40
+__gcov_._ZNSt6vectorIcSaIcEE17_M_default_appendEm:
+	.quad	.LPBX0
+	.long	1621599436
+	.long	2081273898
+	.long	1709209094
+	.zero	4
+	.long	24
+	.zero	4
+	.quad	__gcov0._ZNSt6vectorIcSaIcEE17_M_default_appendEm
+	.align 32
+	.type	__gcov_._ZSt8_DestroyIPccEvT_S1_RSaIT0_E, @object
+	.size	__gcov_._ZSt8_DestroyIPccEvT_S1_RSaIT0_E, 40
+__gcov_._ZSt8_DestroyIPccEvT_S1_RSaIT0_E:
+	.quad	.LPBX0
+	.long	1472469549
+	.long	-395332725
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt8_DestroyIPccEvT_S1_RSaIT0_E
+	.align 32
+	.type	__gcov_._ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv, @object
+	.size	__gcov_._ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv, 40
+__gcov_._ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv:
+	.quad	.LPBX0
+	.long	130786036
+	.long	236392697
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv
+	.align 32
+	.type	__gcov_._ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm, @object
+	.size	__gcov_._ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm, 40
+__gcov_._ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm:
+	.quad	.LPBX0
+	.long	1155434580
+	.long	395454460
+	.long	-2076400574
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm
+	.align 32
+	.type	__gcov_._ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC2Ev, @object
+	.size	__gcov_._ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC2Ev, 40
+__gcov_._ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC2Ev:
+	.quad	.LPBX0
+	.long	71478784
+	.long	-1153027993
+	.long	-1540324424
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC2Ev
+	.align 32
+	.type	__gcov_._ZNKSt6vectorIcSaIcEE4dataEv, @object
+	.size	__gcov_._ZNKSt6vectorIcSaIcEE4dataEv, 40
+__gcov_._ZNKSt6vectorIcSaIcEE4dataEv:
+	.quad	.LPBX0
+	.long	1682311
+	.long	1571162686
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNKSt6vectorIcSaIcEE4dataEv
+	.align 32
+	.type	__gcov_._ZNSt6vectorIcSaIcEE4dataEv, @object
+	.size	__gcov_._ZNSt6vectorIcSaIcEE4dataEv, 40
+__gcov_._ZNSt6vectorIcSaIcEE4dataEv:
+	.quad	.LPBX0
+	.long	1444406192
+	.long	861070820
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt6vectorIcSaIcEE4dataEv
+	.align 32
+	.type	__gcov_._ZSt3minImERKT_S2_S2_, @object
+	.size	__gcov_._ZSt3minImERKT_S2_S2_, 40
+__gcov_._ZSt3minImERKT_S2_S2_:
+	.quad	.LPBX0
+	.long	534093904
+	.long	827727607
+	.long	-1032003044
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt3minImERKT_S2_S2_
+	.align 32
+	.type	__gcov_._ZNKSt6vectorIcSaIcEE4sizeEv, @object
+	.size	__gcov_._ZNKSt6vectorIcSaIcEE4sizeEv, 40
+__gcov_._ZNKSt6vectorIcSaIcEE4sizeEv:
+	.quad	.LPBX0
+	.long	1488729553
+	.long	2142870624
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNKSt6vectorIcSaIcEE4sizeEv
+	.align 32
+	.type	__gcov_._ZNSt6vectorIcSaIcEE6resizeEm, @object
+	.size	__gcov_._ZNSt6vectorIcSaIcEE6resizeEm, 40
+__gcov_._ZNSt6vectorIcSaIcEE6resizeEm:
+	.quad	.LPBX0
+	.long	1203714535
+	.long	-1144780893
+	.long	-30180979
+	.zero	4
+	.long	8
+	.zero	4
+	.quad	__gcov0._ZNSt6vectorIcSaIcEE6resizeEm
+	.align 32
+	.type	__gcov_._ZNSt6vectorIcSaIcEED2Ev, @object
+	.size	__gcov_._ZNSt6vectorIcSaIcEED2Ev, 40
+__gcov_._ZNSt6vectorIcSaIcEED2Ev:
+	.quad	.LPBX0
+	.long	169034508
+	.long	-1845728325
+	.long	-2114763847
+	.zero	4
+	.long	4
+	.zero	4
+	.quad	__gcov0._ZNSt6vectorIcSaIcEED2Ev
+	.align 32
+	.type	__gcov_._ZNSt12_Vector_baseIcSaIcEED2Ev, @object
+	.size	__gcov_._ZNSt12_Vector_baseIcSaIcEED2Ev, 40
+__gcov_._ZNSt12_Vector_baseIcSaIcEED2Ev:
+	.quad	.LPBX0
+	.long	815269987
+	.long	-2091693673
+	.long	-206267174
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZNSt12_Vector_baseIcSaIcEED2Ev
+	.align 32
+	.type	__gcov_._ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev, @object
+	.size	__gcov_._ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev, 40
+__gcov_._ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev:
+	.quad	.LPBX0
+	.long	2143856486
+	.long	-491077844
+	.long	-206267174
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev
+	.align 32
+	.type	__gcov_._ZNSt13__atomic_baseImEC2Em, @object
+	.size	__gcov_._ZNSt13__atomic_baseImEC2Em, 40
+__gcov_._ZNSt13__atomic_baseImEC2Em:
+	.quad	.LPBX0
+	.long	323019399
+	.long	-496085671
+	.long	-1540324424
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNSt13__atomic_baseImEC2Em
+	.align 32
+	.type	__gcov_._ZNK9simulator8log_ring8copy_outEmPcm, @object
+	.size	__gcov_._ZNK9simulator8log_ring8copy_outEmPcm, 40
+__gcov_._ZNK9simulator8log_ring8copy_outEmPcm:
+	.quad	.LPBX0
+	.long	75219402
+	.long	-1146949851
+	.long	-377911160
+	.zero	4
+	.long	5
+	.zero	4
+	.quad	__gcov0._ZNK9simulator8log_ring8copy_outEmPcm
+	.align 32
+	.type	__gcov_._ZN9simulator8log_ring7copy_inEmPKcm, @object
+	.size	__gcov_._ZN9simulator8log_ring7copy_inEmPKcm, 40
+__gcov_._ZN9simulator8log_ring7copy_inEmPKcm:
+	.quad	.LPBX0
+	.long	623780361
+	.long	-144440221
+	.long	-377911160
+	.zero	4
+	.long	5
+	.zero	4
+	.quad	__gcov0._ZN9simulator8log_ring7copy_inEmPKcm
+	.align 32
+	.type	__gcov_._ZNK9simulator8log_ring12get_capacityEv, @object
+	.size	__gcov_._ZNK9simulator8log_ring12get_capacityEv, 40
+__gcov_._ZNK9simulator8log_ring12get_capacityEv:
+	.quad	.LPBX0
+	.long	308451556
+	.long	-1802983024
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNK9simulator8log_ring12get_capacityEv
+	.align 32
+	.type	__gcov_._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE, @object
+	.size	__gcov_._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE, 40
+__gcov_._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE:
+	.quad	.LPBX0
+	.long	2084874742
+	.long	-139293796
+	.long	1735776194
+	.zero	4
+	.long	41
+	.zero	4
+	.quad	__gcov0._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE
+	.align 32
+	.type	__gcov_._ZN9simulator8log_ring8try_pushElPKcj, @object
+	.size	__gcov_._ZN9simulator8log_ring8try_pushElPKcj, 40
+__gcov_._ZN9simulator8log_ring8try_pushElPKcj:
+	.quad	.LPBX0
+	.long	1913142550
+	.long	-184355884
+	.long	1886086492
+	.zero	4
+	.long	38
+	.zero	4
+	.quad	__gcov0._ZN9simulator8log_ring8try_pushElPKcj
+	.align 32
+	.type	__gcov_._ZN9simulator8log_ringC2Em, @object
+	.size	__gcov_._ZN9simulator8log_ringC2Em, 40
+__gcov_._ZN9simulator8log_ringC2Em:
+	.quad	.LPBX0
+	.long	1646134532
+	.long	-1008000865
+	.long	-1235307211
+	.zero	4
+	.long	8
+	.zero	4
+	.quad	__gcov0._ZN9simulator8log_ringC2Em
+	.align 32
+	.type	__gcov_._ZNSt6vectorIcSaIcEEC2Ev, @object
+	.size	__gcov_._ZNSt6vectorIcSaIcEEC2Ev, 40
+__gcov_._ZNSt6vectorIcSaIcEEC2Ev:
+	.quad	.LPBX0
+	.long	1911580696
+	.long	-2073597997
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt6vectorIcSaIcEEC2Ev
+	.align 32
+	.type	__gcov_._ZNSt12_Vector_baseIcSaIcEEC2Ev, @object
+	.size	__gcov_._ZNSt12_Vector_baseIcSaIcEEC2Ev, 40
+__gcov_._ZNSt12_Vector_baseIcSaIcEEC2Ev:
+	.quad	.LPBX0
+	.long	1266361207
+	.long	1321489688
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt12_Vector_baseIcSaIcEEC2Ev
+	.align 32
+	.type	__gcov_._ZNSt12_Vector_baseIcSaIcEE12_Vector_implD2Ev, @object
+	.size	__gcov_._ZNSt12_Vector_baseIcSaIcEE12_Vector_implD2Ev, 40
+__gcov_._ZNSt12_Vector_baseIcSaIcEE12_Vector_implD2Ev:
+	.quad	.LPBX0
+	.long	69962866
+	.long	-532198459
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt12_Vector_baseIcSaIcEE12_Vector_implD2Ev
+	.align 32
+	.type	__gcov_._ZNSt6atomicImEC2Em, @object
+	.size	__gcov_._ZNSt6atomicImEC2Em, 40
+__gcov_._ZNSt6atomicImEC2Em:
+	.quad	.LPBX0
+	.long	1774541825
+	.long	22141788
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt6atomicImEC2Em
+	.align 32
+	.type	__gcov_._ZStanSt12memory_orderSt23__memory_order_modifier, @object
+	.size	__gcov_._ZStanSt12memory_orderSt23__memory_order_modifier, 40
+__gcov_._ZStanSt12memory_orderSt23__memory_order_modifier:
+	.quad	.LPBX0
+	.long	1563986709
+	.long	610375601
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZStanSt12memory_orderSt23__memory_order_modifier
+	.align 32
+	.type	__gcov_._ZnwmPv, @object
+	.size	__gcov_._ZnwmPv, 40
+__gcov_._ZnwmPv:
+	.quad	.LPBX0
+	.long	98535094
+	.long	-1137985752
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZnwmPv
+	.align 32
+	.type	__gcov_._ZSt17__size_to_integerm, @object
+	.size	__gcov_._ZSt17__size_to_integerm, 40
+__gcov_._ZSt17__size_to_integerm:
+	.quad	.LPBX0
+	.long	1817723270
+	.long	879454991
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZSt17__size_to_integerm
+	.align 32
+	.type	__gcov_._ZSt23__is_constant_evaluatedv, @object
+	.size	__gcov_._ZSt23__is_constant_evaluatedv, 40
+__gcov_._ZSt23__is_constant_evaluatedv:
+	.quad	.LPBX0
+	.long	29871445
+	.long	-1631716299
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZSt23__is_constant_evaluatedv
+	.align 32
+	.type	.LPBX1, @object
+	.size	.LPBX1, 472
+.LPBX1:
+	.quad	__gcov_._ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_
+	.quad	__gcov_._ZSt8__fill_aIPccEvT_S1_RKT0_
+	.quad	__gcov_._ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag
+	.quad	__gcov_._ZNKSt15__new_allocatorIcE11_M_max_sizeEv
+	.quad	__gcov_._ZSt6fill_nIPcmcET_S1_T0_RKT1_
+	.quad	__gcov_._ZSt10_ConstructIcJEEvPT_DpOT0_
+	.quad	__gcov_._ZNKSt15__new_allocatorIcE8max_sizeEv
+	.quad	__gcov_._ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E
+	.quad	__gcov_._ZSt12__niter_baseIPcET_S1_
+	.quad	__gcov_._ZNSt15__new_allocatorIcE8allocateEmPKv
+	.quad	__gcov_._ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_
+	.quad	__gcov_._ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_
+	.quad	__gcov_._ZSt11__addressofIcEPT_RS0_
+	.quad	__gcov_._ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_
+	.quad	__gcov_._ZNSt16allocator_traitsISaIcEE8allocateERS0_m
+	.quad	__gcov_._ZSt3maxImERKT_S2_S2_
+	.quad	__gcov_._ZSt25__uninitialized_default_nIPcmET_S1_T0_
+	.quad	__gcov_._ZNKSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv
+	.quad	__gcov_._ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_
+	.quad	__gcov_._ZNSt12_Destroy_auxILb1EE9__destroyIPcEEvT_S3_
+	.quad	__gcov_._ZNSt15__new_allocatorIcE10deallocateEPcm
+	.quad	__gcov_._ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_
+	.quad	__gcov_._ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm
+	.quad	__gcov_._ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc
+	.quad	__gcov_._ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E
+	.quad	__gcov_._ZNKSt6vectorIcSaIcEE8max_sizeEv
+	.quad	__gcov_._ZSt8_DestroyIPcEvT_S1_
+	.quad	__gcov_._ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm
+	.quad	__gcov_._ZSt19__iterator_categoryIPcENSt15iterator_traitsIT_E17iterator_categoryERKS2_
+	.quad	__gcov_._ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_
+	.quad	__gcov_._ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc
+	.quad	__gcov_._ZNSt6vectorIcSaIcEE17_M_default_appendEm
+	.quad	__gcov_._ZSt8_DestroyIPccEvT_S1_RSaIT0_E
+	.quad	__gcov_._ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv
+	.quad	__gcov_._ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm
+	.quad	__gcov_._ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC2Ev
+	.quad	__gcov_._ZNKSt6vectorIcSaIcEE4dataEv
+	.quad	__gcov_._ZNSt6vectorIcSaIcEE4dataEv
+	.quad	__gcov_._ZSt3minImERKT_S2_S2_
+	.quad	__gcov_._ZNKSt6vectorIcSaIcEE4sizeEv
+	.quad	__gcov_._ZNSt6vectorIcSaIcEE6resizeEm
+	.quad	__gcov_._ZNSt6vectorIcSaIcEED2Ev
+	.quad	__gcov_._ZNSt12_Vector_baseIcSaIcEED2Ev
+	.quad	__gcov_._ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev
+	.quad	__gcov_._ZNSt13__atomic_baseImEC2Em
+	.quad	__gcov_._ZNK9simulator8log_ring8copy_outEmPcm
+	.quad	__gcov_._ZN9simulator8log_ring7copy_inEmPKcm
+	.quad	__gcov_._ZNK9simulator8log_ring12get_capacityEv
+	.quad	__gcov_._ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE
+	.quad	__gcov_._ZN9simulator8log_ring8try_pushElPKcj
+	.quad	__gcov_._ZN9simulator8log_ringC2Em
+	.quad	__gcov_._ZNSt6vectorIcSaIcEEC2Ev
+	.quad	__gcov_._ZNSt12_Vector_baseIcSaIcEEC2Ev
+	.quad	__gcov_._ZNSt12_Vector_baseIcSaIcEE12_Vector_implD2Ev
+	.quad	__gcov_._ZNSt6atomicImEC2Em
+	.quad	__gcov_._ZStanSt12memory_orderSt23__memory_order_modifier
+	.quad	__gcov_._ZnwmPv
+	.quad	__gcov_._ZSt17__size_to_integerm
+	.quad	__gcov_._ZSt23__is_constant_evaluatedv
+	.text
+	.type	_sub_I_00100_0, @function
+_sub_I_00100_0:
+.LFB2659:
+	.cfi_startproc
+	.loc 7 89 1
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	leaq	.LPBX0(%rip), %rax
+	movq	%rax, %rdi
+	call	__gcov_init@PLT
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2659:
+	.size	_sub_I_00100_0, .-_sub_I_00100_0
+	.section	.init_array.00100,"aw"
+	.align 8
+	.quad	_sub_I_00100_0
+	.text
+	.type	_sub_D_00100_1, @function
+_sub_D_00100_1:
+.LFB2660:
+	.cfi_startproc
+	.loc 7 89 1
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	call	__gcov_exit@PLT
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2660:
+	.size	_sub_D_00100_1, .-_sub_D_00100_1
+	.section	.fini_array.00100,"aw"
+	.align 8
+	.quad	_sub_D_00100_1
+	.text
+.Letext0:
+	.file 15 "/usr/include/c++/12/type_traits"
+	.file 16 "/usr/include/c++/12/debug/debug.h"
+	.file 17 "/usr/include/c++/12/cstdlib"
+	.file 18 "/usr/include/c++/12/cstdint"
+	.file 19 "/usr/include/c++/12/cstring"
+	.file 20 "/usr/include/c++/12/ctime"
+	.file 21 "/usr/include/c++/12/cwchar"
+	.file 22 "/usr/include/c++/12/bits/char_traits.h"
+	.file 23 "/usr/include/c++/12/bits/allocator.h"
+	.file 24 "/usr/include/c++/12/clocale"
+	.file 25 "/usr/include/c++/12/string_view"
+	.file 26 "/usr/include/c++/12/cstdio"
+	.file 27 "/usr/include/c++/12/bits/basic_string.h"
+	.file 28 "/usr/include/c++/12/initializer_list"
+	.file 29 "/usr/include/c++/12/bits/stringfwd.h"
+	.file 30 "/usr/include/c++/12/bits/functexcept.h"
+	.file 31 "/usr/include/c++/12/bits/predefined_ops.h"
+	.file 32 "/usr/include/c++/12/ext/alloc_traits.h"
+	.file 33 "/usr/include/c++/12/bits/stl_iterator.h"
+	.file 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 35 "/usr/include/stdlib.h"
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 41 "/usr/include/c++/12/pstl/execution_defs.h"
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 43 "/usr/include/stdint.h"
+	.file 44 "/usr/include/string.h"
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.file 46 "/usr/include/time.h"
+	.file 47 "<built-in>"
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/wint_t.h"
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h"
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 54 "/usr/include/wchar.h"
+	.file 55 "/usr/include/locale.h"
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.file 57 "/usr/include/stdio.h"
+	.file 58 "./src/main/inc/log_ring.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x89bd
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x71
+	.long	.LASF3171
+	.byte	0x21
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL2
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x72
+	.string	"std"
+	.byte	0x1
+	.value	0x128
+	.byte	0xb
+	.long	0x5094
+	.uleb128 0x19
+	.long	.LASF2115
+	.byte	0x1
+	.byte	0xf
+	.byte	0x3e
+	.byte	0xc
+	.long	0xa4
+	.uleb128 0x5
+	.long	.LASF2117
+	.byte	0xf
+	.byte	0x41
+	.byte	0x13
+	.long	0x509b
+	.uleb128 0x2b
+	.long	.LASF2111
+	.byte	0xf
+	.byte	0x43
+	.byte	0x11
+	.long	.LASF2113
+	.long	0x48
+	.long	0x6c
+	.long	0x72
+	.uleb128 0x2
+	.long	0x572c
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2112
+	.byte	0xf
+	.byte	0x48
+	.byte	0x1c
+	.long	.LASF2114
+	.long	0x48
+	.long	0x8a
+	.long	0x90
+	.uleb128 0x2
+	.long	0x572c
+	.byte	0
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x509b
+	.uleb128 0x53
+	.string	"__v"
+	.long	0x509b
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x3b
+	.uleb128 0x19
+	.long	.LASF2116
+	.byte	0x1
+	.byte	0xf
+	.byte	0x3e
+	.byte	0xc
+	.long	0x112
+	.uleb128 0x5
+	.long	.LASF2117
+	.byte	0xf
+	.byte	0x41
+	.byte	0x13
+	.long	0x509b
+	.uleb128 0x2b
+	.long	.LASF2118
+	.byte	0xf
+	.byte	0x43
+	.byte	0x11
+	.long	.LASF2119
+	.long	0xb6
+	.long	0xda
+	.long	0xe0
+	.uleb128 0x2
+	.long	0x5731
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2112
+	.byte	0xf
+	.byte	0x48
+	.byte	0x1c
+	.long	.LASF2120
+	.long	0xb6
+	.long	0xf8
+	.long	0xfe
+	.uleb128 0x2
+	.long	0x5731
+	.byte	0
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x509b
+	.uleb128 0x53
+	.string	"__v"
+	.long	0x509b
+	.byte	0x1
+	.byte	0
+	.uleb128 0x7
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF2121
+	.byte	0xf
+	.byte	0x55
+	.byte	0x9
+	.long	0x3b
+	.uleb128 0x1d
+	.long	.LASF2122
+	.byte	0x1
+	.value	0x12a
+	.byte	0x1d
+	.long	0x56db
+	.uleb128 0x7
+	.long	0x123
+	.uleb128 0x54
+	.long	.LASF2123
+	.value	0xa9f
+	.uleb128 0x54
+	.long	.LASF2124
+	.value	0xaf5
+	.uleb128 0x73
+	.long	.LASF3172
+	.byte	0x1
+	.byte	0xa
+	.byte	0x5d
+	.byte	0xa
+	.uleb128 0x19
+	.long	.LASF2125
+	.byte	0x1
+	.byte	0xa
+	.byte	0x63
+	.byte	0xa
+	.long	0x15f
+	.uleb128 0x2c
+	.long	0x143
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2126
+	.byte	0x1
+	.byte	0xa
+	.byte	0x67
+	.byte	0xa
+	.long	0x172
+	.uleb128 0x2c
+	.long	0x14c
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2127
+	.byte	0x1
+	.byte	0xa
+	.byte	0x6b
+	.byte	0xa
+	.long	0x185
+	.uleb128 0x2c
+	.long	0x15f
+	.byte	0
+	.uleb128 0x55
+	.long	.LASF2128
+	.byte	0x10
+	.byte	0x32
+	.byte	0xd
+	.uleb128 0x74
+	.long	.LASF3173
+	.byte	0x7
+	.byte	0x8
+	.long	0x56db
+	.byte	0x3
+	.byte	0x59
+	.byte	0xe
+	.uleb128 0x19
+	.long	.LASF2129
+	.byte	0x1
+	.byte	0xb
+	.byte	0xa8
+	.byte	0xc
+	.long	0x1c9
+	.uleb128 0x75
+	.long	.LASF2954
+	.byte	0xb
+	.byte	0xac
+	.byte	0x9
+	.long	.LASF3174
+	.uleb128 0xc
+	.long	.LASF2130
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x594a
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0x7f
+	.byte	0xb
+	.long	0x57ab
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0x80
+	.byte	0xb
+	.long	0x57de
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0x86
+	.byte	0xb
+	.long	0x5a07
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0x89
+	.byte	0xb
+	.long	0x5a25
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0x8c
+	.byte	0xb
+	.long	0x5a40
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0x8d
+	.byte	0xb
+	.long	0x5a56
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0x8e
+	.byte	0xb
+	.long	0x5a6c
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0x8f
+	.byte	0xb
+	.long	0x5a82
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0x91
+	.byte	0xb
+	.long	0x5aad
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0x94
+	.byte	0xb
+	.long	0x5aca
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0x96
+	.byte	0xb
+	.long	0x5ae1
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0x99
+	.byte	0xb
+	.long	0x5afd
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0x9a
+	.byte	0xb
+	.long	0x5b19
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0x9b
+	.byte	0xb
+	.long	0x5b3f
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0x9d
+	.byte	0xb
+	.long	0x5b60
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xa0
+	.byte	0xb
+	.long	0x5b81
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xa3
+	.byte	0xb
+	.long	0x5b95
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xa5
+	.byte	0xb
+	.long	0x5ba2
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xa6
+	.byte	0xb
+	.long	0x5bb4
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xa7
+	.byte	0xb
+	.long	0x5bd4
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xa8
+	.byte	0xb
+	.long	0x5bf4
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xa9
+	.byte	0xb
+	.long	0x5c14
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xab
+	.byte	0xb
+	.long	0x5c2b
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xac
+	.byte	0xb
+	.long	0x5c51
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xf0
+	.byte	0x16
+	.long	0x5811
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xf5
+	.byte	0x16
+	.long	0x50f5
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xf6
+	.byte	0x16
+	.long	0x5c6d
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xf8
+	.byte	0x16
+	.long	0x5c89
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xf9
+	.byte	0x16
+	.long	0x5cdf
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xfa
+	.byte	0x16
+	.long	0x5c9f
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xfb
+	.byte	0x16
+	.long	0x5cbf
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xfc
+	.byte	0x16
+	.long	0x5cfa
+	.uleb128 0x5
+	.long	.LASF2131
+	.byte	0xf
+	.byte	0x52
+	.byte	0x9
+	.long	0xa9
+	.uleb128 0x56
+	.long	.LASF2138
+	.long	0x5094
+	.byte	0x4e
+	.byte	0x10
+	.long	0x309
+	.uleb128 0x34
+	.long	.LASF2132
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF2133
+	.byte	0x1
+	.uleb128 0x34
+	.long	.LASF2134
+	.byte	0x2
+	.uleb128 0x34
+	.long	.LASF2135
+	.byte	0x3
+	.uleb128 0x34
+	.long	.LASF2136
+	.byte	0x4
+	.uleb128 0x34
+	.long	.LASF2137
+	.byte	0x5
+	.byte	0
+	.uleb128 0x56
+	.long	.LASF2139
+	.long	0x5094
+	.byte	0x59
+	.byte	0x8
+	.long	0x33b
+	.uleb128 0x76
+	.long	.LASF2140
+	.value	0xffff
+	.uleb128 0x48
+	.long	.LASF2141
+	.long	0xffff0000
+	.uleb128 0x48
+	.long	.LASF2142
+	.long	0x10000
+	.uleb128 0x48
+	.long	.LASF2143
+	.long	0x20000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2138
+	.byte	0x4
+	.byte	0x56
+	.byte	0x7
+	.long	0x2d5
+	.uleb128 0x57
+	.long	.LASF2221
+	.byte	0x4
+	.value	0x144
+	.long	0xb89
+	.uleb128 0x77
+	.long	.LASF3175
+	.byte	0x4
+	.value	0x14c
+	.byte	0x1c
+	.long	.LASF3176
+	.long	0x5704
+	.byte	0x3
+	.byte	0x8
+	.byte	0x1
+	.uleb128 0x1e
+	.long	.LASF2264
+	.byte	0x4
+	.value	0x14a
+	.byte	0x14
+	.long	0x56db
+	.byte	0x3
+	.uleb128 0x78
+	.long	.LASF3177
+	.byte	0x4
+	.value	0x14f
+	.byte	0x28
+	.long	0x367
+	.byte	0x8
+	.byte	0
+	.byte	0x3
+	.uleb128 0x35
+	.long	.LASF2144
+	.byte	0x4
+	.value	0x152
+	.long	.LASF2146
+	.long	0x399
+	.long	0x39f
+	.uleb128 0x2
+	.long	0x5f9a
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF2145
+	.byte	0x4
+	.value	0x153
+	.long	.LASF2147
+	.long	0x3b3
+	.long	0x3be
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x2
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x58
+	.long	.LASF2144
+	.byte	0x4
+	.value	0x154
+	.long	.LASF2148
+	.long	0x3d2
+	.long	0x3dd
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x5fa4
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF2149
+	.byte	0x4
+	.value	0x155
+	.byte	0x16
+	.long	.LASF2150
+	.long	0x5fa9
+	.long	0x3f6
+	.long	0x401
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x5fa4
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF2149
+	.byte	0x4
+	.value	0x156
+	.byte	0x16
+	.long	.LASF2151
+	.long	0x5fa9
+	.long	0x41a
+	.long	0x425
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x5fa4
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2144
+	.byte	0x4
+	.value	0x159
+	.byte	0x11
+	.long	.LASF2186
+	.long	0x43a
+	.long	0x445
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x367
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2152
+	.byte	0x4
+	.value	0x15b
+	.byte	0x7
+	.long	.LASF2153
+	.long	0x367
+	.long	0x45e
+	.long	0x464
+	.uleb128 0x2
+	.long	0x5fb3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2152
+	.byte	0x4
+	.value	0x15e
+	.byte	0x7
+	.long	.LASF2154
+	.long	0x367
+	.long	0x47d
+	.long	0x483
+	.uleb128 0x2
+	.long	0x5fbd
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2149
+	.byte	0x4
+	.value	0x162
+	.byte	0x7
+	.long	.LASF2155
+	.long	0x367
+	.long	0x49c
+	.long	0x4a7
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x367
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2149
+	.byte	0x4
+	.value	0x169
+	.byte	0x7
+	.long	.LASF2156
+	.long	0x367
+	.long	0x4c0
+	.long	0x4cb
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x367
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2157
+	.byte	0x4
+	.value	0x170
+	.byte	0x7
+	.long	.LASF2158
+	.long	0x367
+	.long	0x4e4
+	.long	0x4ef
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2157
+	.byte	0x4
+	.value	0x174
+	.byte	0x7
+	.long	.LASF2159
+	.long	0x367
+	.long	0x508
+	.long	0x513
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2160
+	.byte	0x4
+	.value	0x178
+	.byte	0x7
+	.long	.LASF2161
+	.long	0x367
+	.long	0x52c
+	.long	0x537
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2160
+	.byte	0x4
+	.value	0x17c
+	.byte	0x7
+	.long	.LASF2162
+	.long	0x367
+	.long	0x550
+	.long	0x55b
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2157
+	.byte	0x4
+	.value	0x180
+	.byte	0x7
+	.long	.LASF2163
+	.long	0x367
+	.long	0x574
+	.long	0x57a
+	.uleb128 0x2
+	.long	0x5f9a
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2157
+	.byte	0x4
+	.value	0x184
+	.byte	0x7
+	.long	.LASF2164
+	.long	0x367
+	.long	0x593
+	.long	0x599
+	.uleb128 0x2
+	.long	0x5fae
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2160
+	.byte	0x4
+	.value	0x188
+	.byte	0x7
+	.long	.LASF2165
+	.long	0x367
+	.long	0x5b2
+	.long	0x5b8
+	.uleb128 0x2
+	.long	0x5f9a
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2160
+	.byte	0x4
+	.value	0x18c
+	.byte	0x7
+	.long	.LASF2166
+	.long	0x367
+	.long	0x5d1
+	.long	0x5d7
+	.uleb128 0x2
+	.long	0x5fae
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2167
+	.byte	0x4
+	.value	0x190
+	.byte	0x7
+	.long	.LASF2168
+	.long	0x367
+	.long	0x5f0
+	.long	0x5fb
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x367
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2167
+	.byte	0x4
+	.value	0x194
+	.byte	0x7
+	.long	.LASF2169
+	.long	0x367
+	.long	0x614
+	.long	0x61f
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x367
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2170
+	.byte	0x4
+	.value	0x198
+	.byte	0x7
+	.long	.LASF2171
+	.long	0x367
+	.long	0x638
+	.long	0x643
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x367
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2170
+	.byte	0x4
+	.value	0x19c
+	.byte	0x7
+	.long	.LASF2172
+	.long	0x367
+	.long	0x65c
+	.long	0x667
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x367
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2173
+	.byte	0x4
+	.value	0x1a0
+	.byte	0x7
+	.long	.LASF2174
+	.long	0x367
+	.long	0x680
+	.long	0x68b
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x367
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2173
+	.byte	0x4
+	.value	0x1a4
+	.byte	0x7
+	.long	.LASF2175
+	.long	0x367
+	.long	0x6a4
+	.long	0x6af
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x367
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2176
+	.byte	0x4
+	.value	0x1a8
+	.byte	0x7
+	.long	.LASF2177
+	.long	0x367
+	.long	0x6c8
+	.long	0x6d3
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x367
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2176
+	.byte	0x4
+	.value	0x1ac
+	.byte	0x7
+	.long	.LASF2178
+	.long	0x367
+	.long	0x6ec
+	.long	0x6f7
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x367
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2179
+	.byte	0x4
+	.value	0x1b0
+	.byte	0x7
+	.long	.LASF2180
+	.long	0x367
+	.long	0x710
+	.long	0x71b
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x367
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2179
+	.byte	0x4
+	.value	0x1b4
+	.byte	0x7
+	.long	.LASF2181
+	.long	0x367
+	.long	0x734
+	.long	0x73f
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x367
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2182
+	.byte	0x4
+	.value	0x1b8
+	.byte	0x7
+	.long	.LASF2183
+	.long	0x509b
+	.long	0x758
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x5fb3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2182
+	.byte	0x4
+	.value	0x1c0
+	.byte	0x7
+	.long	.LASF2184
+	.long	0x509b
+	.long	0x777
+	.long	0x77d
+	.uleb128 0x2
+	.long	0x5fbd
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2185
+	.byte	0x4
+	.value	0x1c8
+	.byte	0x7
+	.long	.LASF2187
+	.long	0x792
+	.long	0x7a2
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2185
+	.byte	0x4
+	.value	0x1d4
+	.byte	0x7
+	.long	.LASF2188
+	.long	0x7b7
+	.long	0x7c7
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2189
+	.byte	0x4
+	.value	0x1e1
+	.byte	0x7
+	.long	.LASF2190
+	.long	0x367
+	.long	0x7e0
+	.long	0x7eb
+	.uleb128 0x2
+	.long	0x5fb3
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2189
+	.byte	0x4
+	.value	0x1ec
+	.byte	0x7
+	.long	.LASF2191
+	.long	0x367
+	.long	0x804
+	.long	0x80f
+	.uleb128 0x2
+	.long	0x5fbd
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2192
+	.byte	0x4
+	.value	0x1f7
+	.byte	0x7
+	.long	.LASF2193
+	.long	0x367
+	.long	0x828
+	.long	0x838
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2192
+	.byte	0x4
+	.value	0x1ff
+	.byte	0x7
+	.long	.LASF2194
+	.long	0x367
+	.long	0x851
+	.long	0x861
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2195
+	.byte	0x4
+	.value	0x206
+	.byte	0x7
+	.long	.LASF2196
+	.long	0x509b
+	.long	0x87a
+	.long	0x894
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x5fc2
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2195
+	.byte	0x4
+	.value	0x210
+	.byte	0x7
+	.long	.LASF2197
+	.long	0x509b
+	.long	0x8ad
+	.long	0x8c7
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x5fc2
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2195
+	.byte	0x4
+	.value	0x21b
+	.byte	0x7
+	.long	.LASF2198
+	.long	0x509b
+	.long	0x8e0
+	.long	0x8f5
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x5fc2
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2195
+	.byte	0x4
+	.value	0x223
+	.byte	0x7
+	.long	.LASF2199
+	.long	0x509b
+	.long	0x90e
+	.long	0x923
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x5fc2
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2200
+	.byte	0x4
+	.value	0x22b
+	.byte	0x7
+	.long	.LASF2201
+	.long	0x509b
+	.long	0x93c
+	.long	0x956
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x5fc2
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2200
+	.byte	0x4
+	.value	0x235
+	.byte	0x7
+	.long	.LASF2202
+	.long	0x509b
+	.long	0x96f
+	.long	0x989
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x5fc2
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2200
+	.byte	0x4
+	.value	0x240
+	.byte	0x7
+	.long	.LASF2203
+	.long	0x509b
+	.long	0x9a2
+	.long	0x9b7
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x5fc2
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2200
+	.byte	0x4
+	.value	0x248
+	.byte	0x7
+	.long	.LASF2204
+	.long	0x509b
+	.long	0x9d0
+	.long	0x9e5
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x5fc2
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2205
+	.byte	0x4
+	.value	0x268
+	.byte	0x7
+	.long	.LASF2206
+	.long	0x367
+	.long	0x9fe
+	.long	0xa0e
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2205
+	.byte	0x4
+	.value	0x26d
+	.byte	0x7
+	.long	.LASF2207
+	.long	0x367
+	.long	0xa27
+	.long	0xa37
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2208
+	.byte	0x4
+	.value	0x272
+	.byte	0x7
+	.long	.LASF2209
+	.long	0x367
+	.long	0xa50
+	.long	0xa60
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2208
+	.byte	0x4
+	.value	0x277
+	.byte	0x7
+	.long	.LASF2210
+	.long	0x367
+	.long	0xa79
+	.long	0xa89
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2211
+	.byte	0x4
+	.value	0x27c
+	.byte	0x7
+	.long	.LASF2212
+	.long	0x367
+	.long	0xaa2
+	.long	0xab2
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2211
+	.byte	0x4
+	.value	0x281
+	.byte	0x7
+	.long	.LASF2213
+	.long	0x367
+	.long	0xacb
+	.long	0xadb
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2214
+	.byte	0x4
+	.value	0x286
+	.byte	0x7
+	.long	.LASF2215
+	.long	0x367
+	.long	0xaf4
+	.long	0xb04
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2214
+	.byte	0x4
+	.value	0x28b
+	.byte	0x7
+	.long	.LASF2216
+	.long	0x367
+	.long	0xb1d
+	.long	0xb2d
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2217
+	.byte	0x4
+	.value	0x290
+	.byte	0x7
+	.long	.LASF2218
+	.long	0x367
+	.long	0xb46
+	.long	0xb56
+	.uleb128 0x2
+	.long	0x5f9a
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2217
+	.byte	0x4
+	.value	0x295
+	.byte	0x7
+	.long	.LASF2219
+	.long	0x367
+	.long	0xb6f
+	.long	0xb7f
+	.uleb128 0x2
+	.long	0x5fae
+	.uleb128 0x1
+	.long	0x367
+	.uleb128 0x1
+	.long	0x33b
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2220
+	.long	0x56db
+	.byte	0
+	.uleb128 0x7
+	.long	0x347
+	.uleb128 0x59
+	.long	0x347
+	.uleb128 0x7
+	.long	0xb8e
+	.uleb128 0x57
+	.long	.LASF2222
+	.byte	0x5
+	.value	0x37d
+	.long	0xcc9
+	.uleb128 0x16
+	.byte	0x5
+	.value	0x37d
+	.byte	0xc
+	.long	0x445
+	.uleb128 0x16
+	.byte	0x5
+	.value	0x37d
+	.byte	0xc
+	.long	0x464
+	.uleb128 0x16
+	.byte	0x5
+	.value	0x37d
+	.byte	0xc
+	.long	0x4a7
+	.uleb128 0x16
+	.byte	0x5
+	.value	0x37d
+	.byte	0xc
+	.long	0x483
+	.uleb128 0x16
+	.byte	0x5
+	.value	0x37d
+	.byte	0xc
+	.long	0x401
+	.uleb128 0x16
+	.byte	0x5
+	.value	0x37d
+	.byte	0xc
+	.long	0x3dd
+	.uleb128 0x2c
+	.long	0x347
+	.uleb128 0x35
+	.long	.LASF2223
+	.byte	0x5
+	.value	0x382
+	.long	.LASF2224
+	.long	0xbf3
+	.long	0xbf9
+	.uleb128 0x2
+	.long	0x5fc7
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF2225
+	.byte	0x5
+	.value	0x383
+	.long	.LASF2226
+	.long	0xc0d
+	.long	0xc18
+	.uleb128 0x2
+	.long	0x5fc7
+	.uleb128 0x2
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x58
+	.long	.LASF2223
+	.byte	0x5
+	.value	0x384
+	.long	.LASF2227
+	.long	0xc2c
+	.long	0xc37
+	.uleb128 0x2
+	.long	0x5fc7
+	.uleb128 0x1
+	.long	0x5fd1
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF2149
+	.byte	0x5
+	.value	0x385
+	.byte	0xf
+	.long	.LASF2228
+	.long	0x5fd6
+	.long	0xc50
+	.long	0xc5b
+	.uleb128 0x2
+	.long	0x5fc7
+	.uleb128 0x1
+	.long	0x5fd1
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF2149
+	.byte	0x5
+	.value	0x386
+	.byte	0xf
+	.long	.LASF2229
+	.long	0x5fd6
+	.long	0xc74
+	.long	0xc7f
+	.uleb128 0x2
+	.long	0x5fdb
+	.uleb128 0x1
+	.long	0x5fd1
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2223
+	.byte	0x5
+	.value	0x388
+	.byte	0x11
+	.long	.LASF2230
+	.long	0xc94
+	.long	0xc9f
+	.uleb128 0x2
+	.long	0x5fc7
+	.uleb128 0x1
+	.long	0xc9f
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2231
+	.byte	0x5
+	.value	0x37f
+	.byte	0x1d
+	.long	0x56db
+	.uleb128 0x79
+	.long	.LASF3178
+	.byte	0x5
+	.value	0x38e
+	.byte	0x1d
+	.long	.LASF3179
+	.long	0x50a2
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x56db
+	.byte	0
+	.uleb128 0x7
+	.long	0xb98
+	.uleb128 0x59
+	.long	0xb98
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x2f
+	.byte	0xb
+	.long	0x5971
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x30
+	.byte	0xb
+	.long	0x597d
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x31
+	.byte	0xb
+	.long	0x5989
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x32
+	.byte	0xb
+	.long	0x5995
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x34
+	.byte	0xb
+	.long	0x5f0a
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x35
+	.byte	0xb
+	.long	0x5f16
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x36
+	.byte	0xb
+	.long	0x5f22
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x37
+	.byte	0xb
+	.long	0x5f2e
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x39
+	.byte	0xb
+	.long	0x5eaa
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x3a
+	.byte	0xb
+	.long	0x5eb6
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x3b
+	.byte	0xb
+	.long	0x5ec2
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x3c
+	.byte	0xb
+	.long	0x5ece
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x3e
+	.byte	0xb
+	.long	0x5f82
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x3f
+	.byte	0xb
+	.long	0x5f6a
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x41
+	.byte	0xb
+	.long	0x5e70
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x42
+	.byte	0xb
+	.long	0x5e7c
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x43
+	.byte	0xb
+	.long	0x5e88
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x44
+	.byte	0xb
+	.long	0x5e99
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x46
+	.byte	0xb
+	.long	0x5f3a
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x47
+	.byte	0xb
+	.long	0x5f46
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x48
+	.byte	0xb
+	.long	0x5f52
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x49
+	.byte	0xb
+	.long	0x5f5e
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x4b
+	.byte	0xb
+	.long	0x5eda
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x4c
+	.byte	0xb
+	.long	0x5ee6
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x4d
+	.byte	0xb
+	.long	0x5ef2
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x4e
+	.byte	0xb
+	.long	0x5efe
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x50
+	.byte	0xb
+	.long	0x5f8e
+	.uleb128 0x4
+	.byte	0x12
+	.byte	0x51
+	.byte	0xb
+	.long	0x5f76
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x4d
+	.byte	0xb
+	.long	0x5fe0
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x4d
+	.byte	0xb
+	.long	0x6004
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x54
+	.byte	0xb
+	.long	0x6028
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x57
+	.byte	0xb
+	.long	0x6043
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x5d
+	.byte	0xb
+	.long	0x605a
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x5e
+	.byte	0xb
+	.long	0x6076
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x5f
+	.byte	0xb
+	.long	0x6096
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x5f
+	.byte	0xb
+	.long	0x60b5
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x60
+	.byte	0xb
+	.long	0x60d4
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x60
+	.byte	0xb
+	.long	0x60f4
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x61
+	.byte	0xb
+	.long	0x6114
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x61
+	.byte	0xb
+	.long	0x6133
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x62
+	.byte	0xb
+	.long	0x6152
+	.uleb128 0x4
+	.byte	0x13
+	.byte	0x62
+	.byte	0xb
+	.long	0x6172
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x3c
+	.byte	0xb
+	.long	0x5954
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x3d
+	.byte	0xb
+	.long	0x5960
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x3e
+	.byte	0xb
+	.long	0x6192
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x40
+	.byte	0xb
+	.long	0x6234
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x41
+	.byte	0xb
+	.long	0x6240
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x42
+	.byte	0xb
+	.long	0x625b
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x43
+	.byte	0xb
+	.long	0x6276
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x44
+	.byte	0xb
+	.long	0x6291
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x45
+	.byte	0xb
+	.long	0x62ac
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x46
+	.byte	0xb
+	.long	0x62c7
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x47
+	.byte	0xb
+	.long	0x62dd
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x4f
+	.byte	0xb
+	.long	0x59a1
+	.uleb128 0x4
+	.byte	0x14
+	.byte	0x50
+	.byte	0xb
+	.long	0x62f3
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x40
+	.byte	0xb
+	.long	0x63ac
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x8d
+	.byte	0xb
+	.long	0x634a
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x8f
+	.byte	0xb
+	.long	0x655c
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x90
+	.byte	0xb
+	.long	0x6573
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x91
+	.byte	0xb
+	.long	0x658f
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x92
+	.byte	0xb
+	.long	0x65b0
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x93
+	.byte	0xb
+	.long	0x65cc
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x94
+	.byte	0xb
+	.long	0x65e8
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x95
+	.byte	0xb
+	.long	0x6604
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x96
+	.byte	0xb
+	.long	0x6621
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x97
+	.byte	0xb
+	.long	0x6642
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x98
+	.byte	0xb
+	.long	0x6659
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x99
+	.byte	0xb
+	.long	0x6666
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x9a
+	.byte	0xb
+	.long	0x668c
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x9b
+	.byte	0xb
+	.long	0x66b2
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x9c
+	.byte	0xb
+	.long	0x66ce
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x9d
+	.byte	0xb
+	.long	0x66f9
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0x9e
+	.byte	0xb
+	.long	0x6715
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xa0
+	.byte	0xb
+	.long	0x672c
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xa2
+	.byte	0xb
+	.long	0x674e
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xa3
+	.byte	0xb
+	.long	0x676f
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xa4
+	.byte	0xb
+	.long	0x678b
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xa6
+	.byte	0xb
+	.long	0x67b1
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xa9
+	.byte	0xb
+	.long	0x67d6
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xac
+	.byte	0xb
+	.long	0x67fc
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xae
+	.byte	0xb
+	.long	0x6821
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xb0
+	.byte	0xb
+	.long	0x683d
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xb2
+	.byte	0xb
+	.long	0x685d
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xb3
+	.byte	0xb
+	.long	0x687e
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xb4
+	.byte	0xb
+	.long	0x6899
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xb5
+	.byte	0xb
+	.long	0x68b4
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xb6
+	.byte	0xb
+	.long	0x68cf
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xb7
+	.byte	0xb
+	.long	0x68ea
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xb8
+	.byte	0xb
+	.long	0x6905
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xb9
+	.byte	0xb
+	.long	0x692b
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xba
+	.byte	0xb
+	.long	0x6941
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xbb
+	.byte	0xb
+	.long	0x6961
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xbc
+	.byte	0xb
+	.long	0x6981
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xbd
+	.byte	0xb
+	.long	0x69a1
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xbe
+	.byte	0xb
+	.long	0x69cc
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xbf
+	.byte	0xb
+	.long	0x69e7
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xc1
+	.byte	0xb
+	.long	0x6a08
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xc3
+	.byte	0xb
+	.long	0x6a24
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xc4
+	.byte	0xb
+	.long	0x6a44
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xc5
+	.byte	0xb
+	.long	0x6a65
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xc6
+	.byte	0xb
+	.long	0x6a86
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xc7
+	.byte	0xb
+	.long	0x6aa6
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xc8
+	.byte	0xb
+	.long	0x6abd
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xc9
+	.byte	0xb
+	.long	0x6ade
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xca
+	.byte	0xb
+	.long	0x6aff
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xcb
+	.byte	0xb
+	.long	0x6b20
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xcc
+	.byte	0xb
+	.long	0x6b41
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xcd
+	.byte	0xb
+	.long	0x6b59
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xce
+	.byte	0xb
+	.long	0x6b75
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xce
+	.byte	0xb
+	.long	0x6b94
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xcf
+	.byte	0xb
+	.long	0x6bb3
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xcf
+	.byte	0xb
+	.long	0x6bd2
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xd0
+	.byte	0xb
+	.long	0x6bf1
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xd0
+	.byte	0xb
+	.long	0x6c10
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xd1
+	.byte	0xb
+	.long	0x6c2f
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xd1
+	.byte	0xb
+	.long	0x6c4e
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xd2
+	.byte	0xb
+	.long	0x6c6d
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xd2
+	.byte	0xb
+	.long	0x6c91
+	.uleb128 0x16
+	.byte	0x15
+	.value	0x10b
+	.byte	0x16
+	.long	0x6cb5
+	.uleb128 0x16
+	.byte	0x15
+	.value	0x10c
+	.byte	0x16
+	.long	0x6cd1
+	.uleb128 0x16
+	.byte	0x15
+	.value	0x10d
+	.byte	0x16
+	.long	0x6cf2
+	.uleb128 0x16
+	.byte	0x15
+	.value	0x11b
+	.byte	0xe
+	.long	0x6a08
+	.uleb128 0x16
+	.byte	0x15
+	.value	0x11e
+	.byte	0xe
+	.long	0x67b1
+	.uleb128 0x16
+	.byte	0x15
+	.value	0x121
+	.byte	0xe
+	.long	0x67fc
+	.uleb128 0x16
+	.byte	0x15
+	.value	0x124
+	.byte	0xe
+	.long	0x683d
+	.uleb128 0x16
+	.byte	0x15
+	.value	0x128
+	.byte	0xe
+	.long	0x6cb5
+	.uleb128 0x16
+	.byte	0x15
+	.value	0x129
+	.byte	0xe
+	.long	0x6cd1
+	.uleb128 0x16
+	.byte	0x15
+	.value	0x12a
+	.byte	0xe
+	.long	0x6cf2
+	.uleb128 0x3e
+	.long	.LASF2232
+	.byte	0x16
+	.value	0x14f
+	.long	0x12c3
+	.uleb128 0x22
+	.long	.LASF2246
+	.byte	0x16
+	.value	0x15b
+	.byte	0x7
+	.long	.LASF2380
+	.long	0x1105
+	.uleb128 0x1
+	.long	0x6d13
+	.uleb128 0x1
+	.long	0x6d18
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2233
+	.byte	0x16
+	.value	0x151
+	.byte	0x14
+	.long	0x5827
+	.uleb128 0x7
+	.long	0x1105
+	.uleb128 0x5a
+	.string	"eq"
+	.value	0x166
+	.long	.LASF2234
+	.long	0x509b
+	.long	0x1134
+	.uleb128 0x1
+	.long	0x6d18
+	.uleb128 0x1
+	.long	0x6d18
+	.byte	0
+	.uleb128 0x5a
+	.string	"lt"
+	.value	0x16a
+	.long	.LASF2235
+	.long	0x509b
+	.long	0x1151
+	.uleb128 0x1
+	.long	0x6d18
+	.uleb128 0x1
+	.long	0x6d18
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2236
+	.byte	0x16
+	.value	0x172
+	.byte	0x7
+	.long	.LASF2237
+	.long	0x56fc
+	.long	0x1176
+	.uleb128 0x1
+	.long	0x6d1d
+	.uleb128 0x1
+	.long	0x6d1d
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2238
+	.byte	0x16
+	.value	0x185
+	.byte	0x7
+	.long	.LASF2239
+	.long	0x123
+	.long	0x1191
+	.uleb128 0x1
+	.long	0x6d1d
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2240
+	.byte	0x16
+	.value	0x18f
+	.byte	0x7
+	.long	.LASF2241
+	.long	0x6d1d
+	.long	0x11b6
+	.uleb128 0x1
+	.long	0x6d1d
+	.uleb128 0x1
+	.long	0x123
+	.uleb128 0x1
+	.long	0x6d18
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2242
+	.byte	0x16
+	.value	0x19b
+	.byte	0x7
+	.long	.LASF2243
+	.long	0x6d22
+	.long	0x11db
+	.uleb128 0x1
+	.long	0x6d22
+	.uleb128 0x1
+	.long	0x6d1d
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2244
+	.byte	0x16
+	.value	0x1a7
+	.byte	0x7
+	.long	.LASF2245
+	.long	0x6d22
+	.long	0x1200
+	.uleb128 0x1
+	.long	0x6d22
+	.uleb128 0x1
+	.long	0x6d1d
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2246
+	.byte	0x16
+	.value	0x1b3
+	.byte	0x7
+	.long	.LASF2247
+	.long	0x6d22
+	.long	0x1225
+	.uleb128 0x1
+	.long	0x6d22
+	.uleb128 0x1
+	.long	0x123
+	.uleb128 0x1
+	.long	0x1105
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2248
+	.byte	0x16
+	.value	0x1bf
+	.byte	0x7
+	.long	.LASF2249
+	.long	0x1105
+	.long	0x1240
+	.uleb128 0x1
+	.long	0x6d27
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2250
+	.byte	0x16
+	.value	0x152
+	.byte	0x13
+	.long	0x56fc
+	.uleb128 0x7
+	.long	0x1240
+	.uleb128 0xe
+	.long	.LASF2251
+	.byte	0x16
+	.value	0x1c5
+	.byte	0x7
+	.long	.LASF2252
+	.long	0x1240
+	.long	0x126d
+	.uleb128 0x1
+	.long	0x6d18
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2253
+	.byte	0x16
+	.value	0x1c9
+	.byte	0x7
+	.long	.LASF2254
+	.long	0x509b
+	.long	0x128d
+	.uleb128 0x1
+	.long	0x6d27
+	.uleb128 0x1
+	.long	0x6d27
+	.byte	0
+	.uleb128 0x7a
+	.string	"eof"
+	.byte	0x16
+	.value	0x1cd
+	.byte	0x7
+	.long	.LASF3180
+	.long	0x1240
+	.uleb128 0xe
+	.long	.LASF2255
+	.byte	0x16
+	.value	0x1d1
+	.byte	0x7
+	.long	.LASF2256
+	.long	0x1240
+	.long	0x12b9
+	.uleb128 0x1
+	.long	0x6d27
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2257
+	.long	0x5827
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2258
+	.byte	0x1
+	.value	0x12b
+	.byte	0x14
+	.long	0x5709
+	.uleb128 0x2a
+	.long	.LASF2281
+	.byte	0x1
+	.byte	0xd
+	.byte	0x38
+	.byte	0xb
+	.long	0x1452
+	.uleb128 0x26
+	.long	.LASF2259
+	.byte	0xd
+	.byte	0x50
+	.byte	0x7
+	.long	.LASF2260
+	.long	0x12f1
+	.long	0x12f7
+	.uleb128 0x2
+	.long	0x6d2c
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2259
+	.byte	0xd
+	.byte	0x53
+	.byte	0x7
+	.long	.LASF2261
+	.long	0x130b
+	.long	0x1316
+	.uleb128 0x2
+	.long	0x6d2c
+	.uleb128 0x1
+	.long	0x6d36
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2262
+	.byte	0xd
+	.byte	0x5a
+	.byte	0x7
+	.long	.LASF2263
+	.long	0x132a
+	.long	0x1335
+	.uleb128 0x2
+	.long	0x6d2c
+	.uleb128 0x2
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2265
+	.byte	0xd
+	.byte	0x3f
+	.byte	0x14
+	.long	0x594a
+	.byte	0x1
+	.uleb128 0x13
+	.long	.LASF2266
+	.byte	0xd
+	.byte	0x5d
+	.byte	0x7
+	.long	.LASF2269
+	.long	0x1335
+	.byte	0x1
+	.long	0x135b
+	.long	0x1366
+	.uleb128 0x2
+	.long	0x6d3b
+	.uleb128 0x1
+	.long	0x1366
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2267
+	.byte	0xd
+	.byte	0x41
+	.byte	0x14
+	.long	0x6d45
+	.byte	0x1
+	.uleb128 0x15
+	.long	.LASF2268
+	.byte	0xd
+	.byte	0x40
+	.byte	0x1a
+	.long	0x581d
+	.byte	0x1
+	.uleb128 0x13
+	.long	.LASF2266
+	.byte	0xd
+	.byte	0x61
+	.byte	0x7
+	.long	.LASF2270
+	.long	0x1373
+	.byte	0x1
+	.long	0x1399
+	.long	0x13a4
+	.uleb128 0x2
+	.long	0x6d3b
+	.uleb128 0x1
+	.long	0x13a4
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2271
+	.byte	0xd
+	.byte	0x42
+	.byte	0x1a
+	.long	0x6d4a
+	.byte	0x1
+	.uleb128 0x13
+	.long	.LASF2272
+	.byte	0xd
+	.byte	0x70
+	.byte	0x7
+	.long	.LASF2273
+	.long	0x594a
+	.byte	0x1
+	.long	0x13ca
+	.long	0x13da
+	.uleb128 0x2
+	.long	0x6d2c
+	.uleb128 0x1
+	.long	0x13da
+	.uleb128 0x1
+	.long	0x5a00
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2274
+	.byte	0xd
+	.byte	0x3c
+	.byte	0x1b
+	.long	0x123
+	.byte	0x1
+	.uleb128 0x26
+	.long	.LASF2275
+	.byte	0xd
+	.byte	0x8e
+	.byte	0x7
+	.long	.LASF2276
+	.long	0x13fb
+	.long	0x140b
+	.uleb128 0x2
+	.long	0x6d2c
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x13da
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2277
+	.byte	0xd
+	.byte	0xa7
+	.byte	0x7
+	.long	.LASF2278
+	.long	0x13da
+	.byte	0x1
+	.long	0x1424
+	.long	0x142a
+	.uleb128 0x2
+	.long	0x6d3b
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2279
+	.byte	0xd
+	.byte	0xd2
+	.byte	0x7
+	.long	.LASF2280
+	.long	0x13da
+	.long	0x1442
+	.long	0x1448
+	.uleb128 0x2
+	.long	0x6d3b
+	.byte	0
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.byte	0
+	.uleb128 0x7
+	.long	0x12d0
+	.uleb128 0x2a
+	.long	.LASF2282
+	.byte	0x1
+	.byte	0x17
+	.byte	0x7c
+	.byte	0xb
+	.long	0x14e3
+	.uleb128 0x5b
+	.long	0x12d0
+	.byte	0x1
+	.uleb128 0x26
+	.long	.LASF2283
+	.byte	0x17
+	.byte	0x9c
+	.byte	0x7
+	.long	.LASF2284
+	.long	0x147e
+	.long	0x1484
+	.uleb128 0x2
+	.long	0x6d4f
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2283
+	.byte	0x17
+	.byte	0x9f
+	.byte	0x7
+	.long	.LASF2285
+	.long	0x1498
+	.long	0x14a3
+	.uleb128 0x2
+	.long	0x6d4f
+	.uleb128 0x1
+	.long	0x6d54
+	.byte	0
+	.uleb128 0x5c
+	.long	.LASF2149
+	.byte	0x17
+	.byte	0xa4
+	.byte	0x12
+	.long	.LASF2293
+	.long	0x6d59
+	.long	0x14bb
+	.long	0x14c6
+	.uleb128 0x2
+	.long	0x6d4f
+	.uleb128 0x1
+	.long	0x6d54
+	.byte	0
+	.uleb128 0x7b
+	.long	.LASF2286
+	.byte	0x17
+	.byte	0xae
+	.byte	0x7
+	.long	.LASF2388
+	.byte	0x1
+	.long	0x14d7
+	.uleb128 0x2
+	.long	0x6d4f
+	.uleb128 0x2
+	.long	0x56fc
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x1457
+	.uleb128 0x4
+	.byte	0x18
+	.byte	0x35
+	.byte	0xb
+	.long	0x6d5e
+	.uleb128 0x4
+	.byte	0x18
+	.byte	0x36
+	.byte	0xb
+	.long	0x6ea4
+	.uleb128 0x4
+	.byte	0x18
+	.byte	0x37
+	.byte	0xb
+	.long	0x6ebf
+	.uleb128 0x2a
+	.long	.LASF2287
+	.byte	0x10
+	.byte	0x19
+	.byte	0x64
+	.byte	0xb
+	.long	0x1e45
+	.uleb128 0x15
+	.long	.LASF2274
+	.byte	0x19
+	.byte	0x77
+	.byte	0xd
+	.long	0x123
+	.byte	0x1
+	.uleb128 0x26
+	.long	.LASF2288
+	.byte	0x19
+	.byte	0x7e
+	.byte	0x7
+	.long	.LASF2289
+	.long	0x152e
+	.long	0x1534
+	.uleb128 0x2
+	.long	0x6ed6
+	.byte	0
+	.uleb128 0x7c
+	.long	.LASF2288
+	.byte	0x19
+	.byte	0x82
+	.byte	0x11
+	.long	.LASF2290
+	.byte	0x1
+	.byte	0x1
+	.long	0x154a
+	.long	0x1555
+	.uleb128 0x2
+	.long	0x6ed6
+	.uleb128 0x1
+	.long	0x6edb
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2288
+	.byte	0x19
+	.byte	0x85
+	.byte	0x7
+	.long	.LASF2291
+	.long	0x1569
+	.long	0x1574
+	.uleb128 0x2
+	.long	0x6ed6
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2288
+	.byte	0x19
+	.byte	0x8b
+	.byte	0x7
+	.long	.LASF2292
+	.long	0x1588
+	.long	0x1598
+	.uleb128 0x2
+	.long	0x6ed6
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x5c
+	.long	.LASF2149
+	.byte	0x19
+	.byte	0xb1
+	.byte	0x7
+	.long	.LASF2294
+	.long	0x6ee0
+	.long	0x15b0
+	.long	0x15bb
+	.uleb128 0x2
+	.long	0x6ed6
+	.uleb128 0x1
+	.long	0x6edb
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2295
+	.byte	0x19
+	.byte	0x73
+	.byte	0xd
+	.long	0x6ee5
+	.byte	0x1
+	.uleb128 0x15
+	.long	.LASF2117
+	.byte	0x19
+	.byte	0x6e
+	.byte	0xd
+	.long	0x5827
+	.byte	0x1
+	.uleb128 0x7
+	.long	0x15c8
+	.uleb128 0x13
+	.long	.LASF2296
+	.byte	0x19
+	.byte	0xb6
+	.byte	0x7
+	.long	.LASF2297
+	.long	0x15bb
+	.byte	0x1
+	.long	0x15f3
+	.long	0x15f9
+	.uleb128 0x2
+	.long	0x6eea
+	.byte	0
+	.uleb128 0x49
+	.string	"end"
+	.byte	0x19
+	.byte	0xba
+	.long	.LASF2319
+	.long	0x15bb
+	.long	0x1610
+	.long	0x1616
+	.uleb128 0x2
+	.long	0x6eea
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2298
+	.byte	0x19
+	.byte	0xbe
+	.byte	0x7
+	.long	.LASF2299
+	.long	0x15bb
+	.byte	0x1
+	.long	0x162f
+	.long	0x1635
+	.uleb128 0x2
+	.long	0x6eea
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2300
+	.byte	0x19
+	.byte	0xc2
+	.byte	0x7
+	.long	.LASF2301
+	.long	0x15bb
+	.byte	0x1
+	.long	0x164e
+	.long	0x1654
+	.uleb128 0x2
+	.long	0x6eea
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2302
+	.byte	0x19
+	.byte	0x75
+	.byte	0xd
+	.long	0x1e4a
+	.byte	0x1
+	.uleb128 0x13
+	.long	.LASF2303
+	.byte	0x19
+	.byte	0xc6
+	.byte	0x7
+	.long	.LASF2304
+	.long	0x1654
+	.byte	0x1
+	.long	0x167a
+	.long	0x1680
+	.uleb128 0x2
+	.long	0x6eea
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2305
+	.byte	0x19
+	.byte	0xca
+	.byte	0x7
+	.long	.LASF2306
+	.long	0x1654
+	.byte	0x1
+	.long	0x1699
+	.long	0x169f
+	.uleb128 0x2
+	.long	0x6eea
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2307
+	.byte	0x19
+	.byte	0xce
+	.byte	0x7
+	.long	.LASF2308
+	.long	0x1654
+	.byte	0x1
+	.long	0x16b8
+	.long	0x16be
+	.uleb128 0x2
+	.long	0x6eea
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2309
+	.byte	0x19
+	.byte	0xd2
+	.byte	0x7
+	.long	.LASF2310
+	.long	0x1654
+	.byte	0x1
+	.long	0x16d7
+	.long	0x16dd
+	.uleb128 0x2
+	.long	0x6eea
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2311
+	.byte	0x19
+	.byte	0xd8
+	.byte	0x7
+	.long	.LASF2312
+	.long	0x150d
+	.byte	0x1
+	.long	0x16f6
+	.long	0x16fc
+	.uleb128 0x2
+	.long	0x6eea
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2238
+	.byte	0x19
+	.byte	0xdc
+	.byte	0x7
+	.long	.LASF2313
+	.long	0x150d
+	.byte	0x1
+	.long	0x1715
+	.long	0x171b
+	.uleb128 0x2
+	.long	0x6eea
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2277
+	.byte	0x19
+	.byte	0xe0
+	.byte	0x7
+	.long	.LASF2314
+	.long	0x150d
+	.byte	0x1
+	.long	0x1734
+	.long	0x173a
+	.uleb128 0x2
+	.long	0x6eea
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2315
+	.byte	0x19
+	.byte	0xe7
+	.byte	0x7
+	.long	.LASF2316
+	.long	0x509b
+	.byte	0x1
+	.long	0x1753
+	.long	0x1759
+	.uleb128 0x2
+	.long	0x6eea
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2271
+	.byte	0x19
+	.byte	0x72
+	.byte	0xd
+	.long	0x6eef
+	.byte	0x1
+	.uleb128 0x13
+	.long	.LASF2317
+	.byte	0x19
+	.byte	0xed
+	.byte	0x7
+	.long	.LASF2318
+	.long	0x1759
+	.byte	0x1
+	.long	0x177f
+	.long	0x178a
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x49
+	.string	"at"
+	.byte	0x19
+	.byte	0xf4
+	.long	.LASF2320
+	.long	0x1759
+	.long	0x17a0
+	.long	0x17ab
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2321
+	.byte	0x19
+	.byte	0xfe
+	.byte	0x7
+	.long	.LASF2322
+	.long	0x1759
+	.byte	0x1
+	.long	0x17c4
+	.long	0x17ca
+	.uleb128 0x2
+	.long	0x6eea
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2323
+	.byte	0x19
+	.value	0x105
+	.byte	0x7
+	.long	.LASF2324
+	.long	0x1759
+	.byte	0x1
+	.long	0x17e4
+	.long	0x17ea
+	.uleb128 0x2
+	.long	0x6eea
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2268
+	.byte	0x19
+	.byte	0x70
+	.byte	0xd
+	.long	0x6ee5
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2325
+	.byte	0x19
+	.value	0x10c
+	.byte	0x7
+	.long	.LASF2326
+	.long	0x17ea
+	.byte	0x1
+	.long	0x1811
+	.long	0x1817
+	.uleb128 0x2
+	.long	0x6eea
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2327
+	.byte	0x19
+	.value	0x112
+	.byte	0x7
+	.long	.LASF2328
+	.byte	0x1
+	.long	0x182d
+	.long	0x1838
+	.uleb128 0x2
+	.long	0x6ed6
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2329
+	.byte	0x19
+	.value	0x11a
+	.byte	0x7
+	.long	.LASF2330
+	.byte	0x1
+	.long	0x184e
+	.long	0x1859
+	.uleb128 0x2
+	.long	0x6ed6
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2331
+	.byte	0x19
+	.value	0x11e
+	.byte	0x7
+	.long	.LASF2332
+	.byte	0x1
+	.long	0x186f
+	.long	0x187a
+	.uleb128 0x2
+	.long	0x6ed6
+	.uleb128 0x1
+	.long	0x6ee0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2244
+	.byte	0x19
+	.value	0x129
+	.byte	0x7
+	.long	.LASF2333
+	.long	0x150d
+	.byte	0x1
+	.long	0x1894
+	.long	0x18a9
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2334
+	.byte	0x19
+	.value	0x135
+	.byte	0x7
+	.long	.LASF2335
+	.long	0x1500
+	.byte	0x1
+	.long	0x18c3
+	.long	0x18d3
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2236
+	.byte	0x19
+	.value	0x13d
+	.byte	0x7
+	.long	.LASF2336
+	.long	0x56fc
+	.byte	0x1
+	.long	0x18ed
+	.long	0x18f8
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x1500
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2236
+	.byte	0x19
+	.value	0x147
+	.byte	0x7
+	.long	.LASF2337
+	.long	0x56fc
+	.byte	0x1
+	.long	0x1912
+	.long	0x1927
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x1500
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2236
+	.byte	0x19
+	.value	0x14b
+	.byte	0x7
+	.long	.LASF2338
+	.long	0x56fc
+	.byte	0x1
+	.long	0x1941
+	.long	0x1960
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x1500
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2236
+	.byte	0x19
+	.value	0x152
+	.byte	0x7
+	.long	.LASF2339
+	.long	0x56fc
+	.byte	0x1
+	.long	0x197a
+	.long	0x1985
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2236
+	.byte	0x19
+	.value	0x156
+	.byte	0x7
+	.long	.LASF2340
+	.long	0x56fc
+	.byte	0x1
+	.long	0x199f
+	.long	0x19b4
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2236
+	.byte	0x19
+	.value	0x15a
+	.byte	0x7
+	.long	.LASF2341
+	.long	0x56fc
+	.byte	0x1
+	.long	0x19ce
+	.long	0x19e8
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2240
+	.byte	0x19
+	.value	0x193
+	.byte	0x7
+	.long	.LASF2342
+	.long	0x150d
+	.byte	0x1
+	.long	0x1a02
+	.long	0x1a12
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x1500
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2240
+	.byte	0x19
+	.value	0x197
+	.byte	0x7
+	.long	.LASF2343
+	.long	0x150d
+	.byte	0x1
+	.long	0x1a2c
+	.long	0x1a3c
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2240
+	.byte	0x19
+	.value	0x19a
+	.byte	0x7
+	.long	.LASF2344
+	.long	0x150d
+	.byte	0x1
+	.long	0x1a56
+	.long	0x1a6b
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2240
+	.byte	0x19
+	.value	0x19d
+	.byte	0x7
+	.long	.LASF2345
+	.long	0x150d
+	.byte	0x1
+	.long	0x1a85
+	.long	0x1a95
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2346
+	.byte	0x19
+	.value	0x1a1
+	.byte	0x7
+	.long	.LASF2347
+	.long	0x150d
+	.byte	0x1
+	.long	0x1aaf
+	.long	0x1abf
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x1500
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2346
+	.byte	0x19
+	.value	0x1a5
+	.byte	0x7
+	.long	.LASF2348
+	.long	0x150d
+	.byte	0x1
+	.long	0x1ad9
+	.long	0x1ae9
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2346
+	.byte	0x19
+	.value	0x1a8
+	.byte	0x7
+	.long	.LASF2349
+	.long	0x150d
+	.byte	0x1
+	.long	0x1b03
+	.long	0x1b18
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2346
+	.byte	0x19
+	.value	0x1ab
+	.byte	0x7
+	.long	.LASF2350
+	.long	0x150d
+	.byte	0x1
+	.long	0x1b32
+	.long	0x1b42
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2351
+	.byte	0x19
+	.value	0x1af
+	.byte	0x7
+	.long	.LASF2352
+	.long	0x150d
+	.byte	0x1
+	.long	0x1b5c
+	.long	0x1b6c
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x1500
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2351
+	.byte	0x19
+	.value	0x1b3
+	.byte	0x7
+	.long	.LASF2353
+	.long	0x150d
+	.byte	0x1
+	.long	0x1b86
+	.long	0x1b96
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2351
+	.byte	0x19
+	.value	0x1b7
+	.byte	0x7
+	.long	.LASF2354
+	.long	0x150d
+	.byte	0x1
+	.long	0x1bb0
+	.long	0x1bc5
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2351
+	.byte	0x19
+	.value	0x1bb
+	.byte	0x7
+	.long	.LASF2355
+	.long	0x150d
+	.byte	0x1
+	.long	0x1bdf
+	.long	0x1bef
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2356
+	.byte	0x19
+	.value	0x1bf
+	.byte	0x7
+	.long	.LASF2357
+	.long	0x150d
+	.byte	0x1
+	.long	0x1c09
+	.long	0x1c19
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x1500
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2356
+	.byte	0x19
+	.value	0x1c4
+	.byte	0x7
+	.long	.LASF2358
+	.long	0x150d
+	.byte	0x1
+	.long	0x1c33
+	.long	0x1c43
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2356
+	.byte	0x19
+	.value	0x1c8
+	.byte	0x7
+	.long	.LASF2359
+	.long	0x150d
+	.byte	0x1
+	.long	0x1c5d
+	.long	0x1c72
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2356
+	.byte	0x19
+	.value	0x1cc
+	.byte	0x7
+	.long	.LASF2360
+	.long	0x150d
+	.byte	0x1
+	.long	0x1c8c
+	.long	0x1c9c
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2361
+	.byte	0x19
+	.value	0x1d0
+	.byte	0x7
+	.long	.LASF2362
+	.long	0x150d
+	.byte	0x1
+	.long	0x1cb6
+	.long	0x1cc6
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x1500
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2361
+	.byte	0x19
+	.value	0x1d5
+	.byte	0x7
+	.long	.LASF2363
+	.long	0x150d
+	.byte	0x1
+	.long	0x1ce0
+	.long	0x1cf0
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2361
+	.byte	0x19
+	.value	0x1d8
+	.byte	0x7
+	.long	.LASF2364
+	.long	0x150d
+	.byte	0x1
+	.long	0x1d0a
+	.long	0x1d1f
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2361
+	.byte	0x19
+	.value	0x1dc
+	.byte	0x7
+	.long	.LASF2365
+	.long	0x150d
+	.byte	0x1
+	.long	0x1d39
+	.long	0x1d49
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2366
+	.byte	0x19
+	.value	0x1e3
+	.byte	0x7
+	.long	.LASF2367
+	.long	0x150d
+	.byte	0x1
+	.long	0x1d63
+	.long	0x1d73
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x1500
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2366
+	.byte	0x19
+	.value	0x1e8
+	.byte	0x7
+	.long	.LASF2368
+	.long	0x150d
+	.byte	0x1
+	.long	0x1d8d
+	.long	0x1d9d
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2366
+	.byte	0x19
+	.value	0x1eb
+	.byte	0x7
+	.long	.LASF2369
+	.long	0x150d
+	.byte	0x1
+	.long	0x1db7
+	.long	0x1dcc
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2366
+	.byte	0x19
+	.value	0x1ef
+	.byte	0x7
+	.long	.LASF2370
+	.long	0x150d
+	.byte	0x1
+	.long	0x1de6
+	.long	0x1df6
+	.uleb128 0x2
+	.long	0x6eea
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2371
+	.byte	0x19
+	.value	0x1f9
+	.byte	0x7
+	.long	.LASF2372
+	.long	0x56fc
+	.long	0x1e16
+	.uleb128 0x1
+	.long	0x150d
+	.uleb128 0x1
+	.long	0x150d
+	.byte	0
+	.uleb128 0x4a
+	.long	.LASF2373
+	.byte	0x19
+	.value	0x204
+	.byte	0xe
+	.long	0x123
+	.byte	0
+	.uleb128 0x4a
+	.long	.LASF2374
+	.byte	0x19
+	.value	0x205
+	.byte	0x15
+	.long	0x581d
+	.byte	0x8
+	.uleb128 0xc
+	.long	.LASF2257
+	.long	0x5827
+	.uleb128 0x3f
+	.long	.LASF2612
+	.long	0x10dd
+	.byte	0
+	.uleb128 0x7
+	.long	0x1500
+	.uleb128 0x32
+	.long	.LASF2622
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x62
+	.byte	0xb
+	.long	0x6550
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x63
+	.byte	0xb
+	.long	0x6f79
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x65
+	.byte	0xb
+	.long	0x6f8f
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x66
+	.byte	0xb
+	.long	0x6fa1
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x67
+	.byte	0xb
+	.long	0x6fb7
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x68
+	.byte	0xb
+	.long	0x6fce
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x69
+	.byte	0xb
+	.long	0x6fe5
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x6a
+	.byte	0xb
+	.long	0x6ffb
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x6b
+	.byte	0xb
+	.long	0x7012
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x6c
+	.byte	0xb
+	.long	0x7033
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x6d
+	.byte	0xb
+	.long	0x7054
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x71
+	.byte	0xb
+	.long	0x7070
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x72
+	.byte	0xb
+	.long	0x7096
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x74
+	.byte	0xb
+	.long	0x70b7
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x75
+	.byte	0xb
+	.long	0x70d8
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x76
+	.byte	0xb
+	.long	0x70f9
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x78
+	.byte	0xb
+	.long	0x7110
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x79
+	.byte	0xb
+	.long	0x7127
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x7e
+	.byte	0xb
+	.long	0x7134
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x83
+	.byte	0xb
+	.long	0x7146
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x84
+	.byte	0xb
+	.long	0x715c
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x85
+	.byte	0xb
+	.long	0x7177
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x87
+	.byte	0xb
+	.long	0x7189
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x88
+	.byte	0xb
+	.long	0x71a0
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x8b
+	.byte	0xb
+	.long	0x71c6
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x8d
+	.byte	0xb
+	.long	0x71d2
+	.uleb128 0x4
+	.byte	0x1a
+	.byte	0x8f
+	.byte	0xb
+	.long	0x71e8
+	.uleb128 0x3e
+	.long	.LASF2375
+	.byte	0x8
+	.value	0x19b
+	.long	0x2030
+	.uleb128 0x1d
+	.long	.LASF2265
+	.byte	0x8
+	.value	0x1a4
+	.byte	0xd
+	.long	0x594a
+	.uleb128 0xe
+	.long	.LASF2272
+	.byte	0x8
+	.value	0x1cf
+	.byte	0x7
+	.long	.LASF2376
+	.long	0x1f33
+	.long	0x1f60
+	.uleb128 0x1
+	.long	0x7204
+	.uleb128 0x1
+	.long	0x1f72
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2377
+	.byte	0x8
+	.value	0x19e
+	.byte	0xd
+	.long	0x1457
+	.uleb128 0x7
+	.long	0x1f60
+	.uleb128 0x1d
+	.long	.LASF2274
+	.byte	0x8
+	.value	0x1b3
+	.byte	0xd
+	.long	0x123
+	.uleb128 0xe
+	.long	.LASF2272
+	.byte	0x8
+	.value	0x1dd
+	.byte	0x7
+	.long	.LASF2378
+	.long	0x1f33
+	.long	0x1fa4
+	.uleb128 0x1
+	.long	0x7204
+	.uleb128 0x1
+	.long	0x1f72
+	.uleb128 0x1
+	.long	0x1fa4
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2379
+	.byte	0x8
+	.value	0x1ad
+	.byte	0xd
+	.long	0x5a00
+	.uleb128 0x22
+	.long	.LASF2275
+	.byte	0x8
+	.value	0x1ef
+	.byte	0x7
+	.long	.LASF2381
+	.long	0x1fd2
+	.uleb128 0x1
+	.long	0x7204
+	.uleb128 0x1
+	.long	0x1f33
+	.uleb128 0x1
+	.long	0x1f72
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2277
+	.byte	0x8
+	.value	0x223
+	.byte	0x7
+	.long	.LASF2382
+	.long	0x1f72
+	.long	0x1fed
+	.uleb128 0x1
+	.long	0x7209
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2383
+	.byte	0x8
+	.value	0x232
+	.byte	0x7
+	.long	.LASF2384
+	.long	0x1f60
+	.long	0x2008
+	.uleb128 0x1
+	.long	0x7209
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2117
+	.byte	0x8
+	.value	0x1a1
+	.byte	0xd
+	.long	0x5827
+	.uleb128 0x1d
+	.long	.LASF2268
+	.byte	0x8
+	.value	0x1a7
+	.byte	0xd
+	.long	0x581d
+	.uleb128 0x1d
+	.long	.LASF2385
+	.byte	0x8
+	.value	0x1c2
+	.byte	0x8
+	.long	0x1457
+	.byte	0
+	.uleb128 0x7d
+	.long	.LASF3181
+	.byte	0x1
+	.value	0x14b
+	.byte	0x41
+	.long	0x3adc
+	.uleb128 0x2a
+	.long	.LASF2386
+	.byte	0x20
+	.byte	0x1b
+	.byte	0x55
+	.byte	0xb
+	.long	0x3ad6
+	.uleb128 0x19
+	.long	.LASF2387
+	.byte	0x8
+	.byte	0x1b
+	.byte	0xc0
+	.byte	0xe
+	.long	0x20b2
+	.uleb128 0x2c
+	.long	0x1457
+	.uleb128 0x20
+	.long	.LASF2387
+	.byte	0x1b
+	.byte	0xc7
+	.byte	0x2
+	.long	.LASF2389
+	.long	0x2070
+	.long	0x2080
+	.uleb128 0x2
+	.long	0x7218
+	.uleb128 0x1
+	.long	0x20b2
+	.uleb128 0x1
+	.long	0x6d54
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2387
+	.byte	0x1b
+	.byte	0xcb
+	.byte	0x2
+	.long	.LASF2390
+	.long	0x2094
+	.long	0x20a4
+	.uleb128 0x2
+	.long	0x7218
+	.uleb128 0x1
+	.long	0x20b2
+	.uleb128 0x1
+	.long	0x721d
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2391
+	.byte	0x1b
+	.byte	0xcf
+	.byte	0xa
+	.long	0x20b2
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2265
+	.byte	0x1b
+	.byte	0x82
+	.byte	0x2f
+	.long	0x51ed
+	.byte	0x1
+	.uleb128 0x5d
+	.byte	0x10
+	.byte	0x1b
+	.byte	0xd8
+	.byte	0x7
+	.long	0x20e1
+	.uleb128 0x40
+	.long	.LASF2392
+	.byte	0x1b
+	.byte	0xd9
+	.byte	0x9
+	.long	0x7222
+	.uleb128 0x40
+	.long	.LASF2393
+	.byte	0x1b
+	.byte	0xda
+	.byte	0xc
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2274
+	.byte	0x1b
+	.byte	0x7e
+	.byte	0x31
+	.long	0x5205
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF2394
+	.byte	0x1b
+	.byte	0x98
+	.byte	0x32
+	.long	0x1500
+	.uleb128 0x17
+	.long	.LASF2395
+	.byte	0x1b
+	.byte	0xa4
+	.byte	0x7
+	.long	.LASF2396
+	.long	0x20ee
+	.long	0x2114
+	.uleb128 0x1
+	.long	0x20ee
+	.byte	0
+	.uleb128 0x5e
+	.long	.LASF2397
+	.byte	0xbb
+	.byte	0x7
+	.long	.LASF2398
+	.long	0x2127
+	.long	0x2137
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x2137
+	.uleb128 0x1
+	.long	0x6d54
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2399
+	.byte	0x10
+	.byte	0x1b
+	.byte	0xab
+	.byte	0xe
+	.long	0x2170
+	.uleb128 0x5e
+	.long	.LASF2399
+	.byte	0xae
+	.byte	0x2
+	.long	.LASF2400
+	.long	0x2157
+	.long	0x2162
+	.uleb128 0x2
+	.long	0x7264
+	.uleb128 0x1
+	.long	0x20ee
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2401
+	.byte	0x1b
+	.byte	0xb0
+	.byte	0xc
+	.long	0x20ee
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2402
+	.byte	0x1b
+	.byte	0xd2
+	.byte	0x14
+	.long	0x204a
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2403
+	.byte	0x1b
+	.byte	0xd3
+	.byte	0x11
+	.long	0x20e1
+	.byte	0x8
+	.uleb128 0x7e
+	.long	0x20bf
+	.byte	0x10
+	.uleb128 0x20
+	.long	.LASF2404
+	.byte	0x1b
+	.byte	0xdf
+	.byte	0x7
+	.long	.LASF2405
+	.long	0x21a4
+	.long	0x21af
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20b2
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2406
+	.byte	0x1b
+	.byte	0xe4
+	.byte	0x7
+	.long	.LASF2407
+	.long	0x21c3
+	.long	0x21ce
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2404
+	.byte	0x1b
+	.byte	0xe9
+	.byte	0x7
+	.long	.LASF2408
+	.long	0x20b2
+	.long	0x21e6
+	.long	0x21ec
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2409
+	.byte	0x1b
+	.byte	0xee
+	.byte	0x7
+	.long	.LASF2410
+	.long	0x20b2
+	.long	0x2204
+	.long	0x220a
+	.uleb128 0x2
+	.long	0x7232
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2268
+	.byte	0x1b
+	.byte	0x83
+	.byte	0x35
+	.long	0x51f9
+	.byte	0x1
+	.uleb128 0x2b
+	.long	.LASF2409
+	.byte	0x1b
+	.byte	0xf9
+	.byte	0x7
+	.long	.LASF2411
+	.long	0x220a
+	.long	0x222f
+	.long	0x2235
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2412
+	.byte	0x1b
+	.value	0x104
+	.byte	0x7
+	.long	.LASF2413
+	.long	0x224a
+	.long	0x2255
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2414
+	.byte	0x1b
+	.value	0x109
+	.byte	0x7
+	.long	.LASF2415
+	.long	0x226a
+	.long	0x2275
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2416
+	.byte	0x1b
+	.value	0x111
+	.byte	0x7
+	.long	.LASF2417
+	.long	0x509b
+	.long	0x228e
+	.long	0x2294
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2418
+	.byte	0x1b
+	.value	0x117
+	.byte	0x7
+	.long	.LASF2419
+	.long	0x20b2
+	.long	0x22ad
+	.long	0x22bd
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x7246
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2420
+	.byte	0x1b
+	.value	0x11b
+	.byte	0x7
+	.long	.LASF2421
+	.long	0x22d2
+	.long	0x22d8
+	.uleb128 0x2
+	.long	0x7232
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2422
+	.byte	0x1b
+	.value	0x123
+	.byte	0x7
+	.long	.LASF2423
+	.long	0x22ed
+	.long	0x22f8
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2424
+	.byte	0x1b
+	.value	0x14f
+	.byte	0x7
+	.long	.LASF2425
+	.long	0x230d
+	.long	0x231d
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x5827
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2377
+	.byte	0x1b
+	.byte	0x7d
+	.byte	0x20
+	.long	0x232f
+	.byte	0x1
+	.uleb128 0x7
+	.long	0x231d
+	.uleb128 0x5
+	.long	.LASF2426
+	.byte	0x1b
+	.byte	0x58
+	.byte	0x18
+	.long	0x5236
+	.uleb128 0xa
+	.long	.LASF2427
+	.byte	0x1b
+	.value	0x153
+	.byte	0x7
+	.long	.LASF2428
+	.long	0x724b
+	.long	0x2354
+	.long	0x235a
+	.uleb128 0x2
+	.long	0x7232
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2427
+	.byte	0x1b
+	.value	0x158
+	.byte	0x7
+	.long	.LASF2429
+	.long	0x7250
+	.long	0x2373
+	.long	0x2379
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2430
+	.byte	0x1b
+	.value	0x15f
+	.byte	0x7
+	.long	.LASF2431
+	.long	0x20b2
+	.long	0x2392
+	.long	0x2398
+	.uleb128 0x2
+	.long	0x7232
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2432
+	.byte	0x1b
+	.value	0x17b
+	.byte	0x7
+	.long	.LASF2433
+	.long	0x20e1
+	.long	0x23b1
+	.long	0x23c1
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2434
+	.byte	0x1b
+	.value	0x186
+	.byte	0x7
+	.long	.LASF2435
+	.long	0x23d6
+	.long	0x23eb
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2436
+	.byte	0x1b
+	.value	0x190
+	.byte	0x7
+	.long	.LASF2437
+	.long	0x20e1
+	.long	0x2404
+	.long	0x2414
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2438
+	.byte	0x1b
+	.value	0x198
+	.byte	0x7
+	.long	.LASF2439
+	.long	0x509b
+	.long	0x242d
+	.long	0x2438
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2440
+	.byte	0x1b
+	.value	0x1a2
+	.byte	0x7
+	.long	.LASF2441
+	.long	0x2459
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2442
+	.byte	0x1b
+	.value	0x1ac
+	.byte	0x7
+	.long	.LASF2443
+	.long	0x247a
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2444
+	.byte	0x1b
+	.value	0x1b6
+	.byte	0x7
+	.long	.LASF2445
+	.long	0x249b
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x5827
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2446
+	.byte	0x1b
+	.value	0x1cb
+	.byte	0x7
+	.long	.LASF2447
+	.long	0x24bc
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x24bc
+	.uleb128 0x1
+	.long	0x24bc
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2448
+	.byte	0x1b
+	.byte	0x84
+	.byte	0x43
+	.long	0x5256
+	.byte	0x1
+	.uleb128 0x22
+	.long	.LASF2446
+	.byte	0x1b
+	.value	0x1d0
+	.byte	0x7
+	.long	.LASF2449
+	.long	0x24ea
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x24ea
+	.uleb128 0x1
+	.long	0x24ea
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2295
+	.byte	0x1b
+	.byte	0x86
+	.byte	0x8
+	.long	0x548c
+	.byte	0x1
+	.uleb128 0x22
+	.long	.LASF2446
+	.byte	0x1b
+	.value	0x1d6
+	.byte	0x7
+	.long	.LASF2450
+	.long	0x2518
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x594a
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2446
+	.byte	0x1b
+	.value	0x1db
+	.byte	0x7
+	.long	.LASF2451
+	.long	0x2539
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2371
+	.byte	0x1b
+	.value	0x1e1
+	.byte	0x7
+	.long	.LASF2452
+	.long	0x56fc
+	.long	0x2559
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2453
+	.byte	0x1b
+	.value	0x1ef
+	.byte	0x7
+	.long	.LASF2454
+	.long	0x256e
+	.long	0x2579
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x7255
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2455
+	.byte	0x1b
+	.value	0x1f3
+	.byte	0x7
+	.long	.LASF2456
+	.long	0x258e
+	.long	0x25a8
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2457
+	.byte	0x1b
+	.value	0x1f8
+	.byte	0x7
+	.long	.LASF2458
+	.long	0x25bd
+	.long	0x25cd
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2397
+	.byte	0x1b
+	.value	0x203
+	.byte	0x7
+	.long	.LASF2459
+	.byte	0x1
+	.long	0x25e3
+	.long	0x25e9
+	.uleb128 0x2
+	.long	0x7232
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF2397
+	.byte	0x1b
+	.value	0x210
+	.long	.LASF2460
+	.long	0x25fd
+	.long	0x2608
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x6d54
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2397
+	.byte	0x1b
+	.value	0x21c
+	.byte	0x7
+	.long	.LASF2461
+	.byte	0x1
+	.long	0x261e
+	.long	0x2629
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x7255
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2397
+	.byte	0x1b
+	.value	0x22d
+	.byte	0x7
+	.long	.LASF2462
+	.byte	0x1
+	.long	0x263f
+	.long	0x2654
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x7255
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x6d54
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2397
+	.byte	0x1b
+	.value	0x23e
+	.byte	0x7
+	.long	.LASF2463
+	.byte	0x1
+	.long	0x266a
+	.long	0x267f
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x7255
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2397
+	.byte	0x1b
+	.value	0x250
+	.byte	0x7
+	.long	.LASF2464
+	.byte	0x1
+	.long	0x2695
+	.long	0x26af
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x7255
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x6d54
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2397
+	.byte	0x1b
+	.value	0x264
+	.byte	0x7
+	.long	.LASF2465
+	.byte	0x1
+	.long	0x26c5
+	.long	0x26da
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x6d54
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2397
+	.byte	0x1b
+	.value	0x29e
+	.byte	0x7
+	.long	.LASF2466
+	.byte	0x1
+	.long	0x26f0
+	.long	0x26fb
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x725a
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2397
+	.byte	0x1b
+	.value	0x2ba
+	.byte	0x7
+	.long	.LASF2467
+	.byte	0x1
+	.long	0x2711
+	.long	0x2721
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x3adc
+	.uleb128 0x1
+	.long	0x6d54
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2397
+	.byte	0x1b
+	.value	0x2bf
+	.byte	0x7
+	.long	.LASF2468
+	.byte	0x1
+	.long	0x2737
+	.long	0x2747
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x7255
+	.uleb128 0x1
+	.long	0x6d54
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2397
+	.byte	0x1b
+	.value	0x2c4
+	.byte	0x7
+	.long	.LASF2469
+	.byte	0x1
+	.long	0x275d
+	.long	0x276d
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x725a
+	.uleb128 0x1
+	.long	0x6d54
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2470
+	.byte	0x1b
+	.value	0x31a
+	.byte	0x7
+	.long	.LASF2471
+	.byte	0x1
+	.long	0x2783
+	.long	0x278e
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x2
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2149
+	.byte	0x1b
+	.value	0x323
+	.byte	0x7
+	.long	.LASF2472
+	.long	0x725f
+	.byte	0x1
+	.long	0x27a8
+	.long	0x27b3
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x7255
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2149
+	.byte	0x1b
+	.value	0x32e
+	.byte	0x7
+	.long	.LASF2473
+	.long	0x725f
+	.byte	0x1
+	.long	0x27cd
+	.long	0x27d8
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2149
+	.byte	0x1b
+	.value	0x33a
+	.byte	0x7
+	.long	.LASF2474
+	.long	0x725f
+	.byte	0x1
+	.long	0x27f2
+	.long	0x27fd
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x5827
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2149
+	.byte	0x1b
+	.value	0x34c
+	.byte	0x7
+	.long	.LASF2475
+	.long	0x725f
+	.byte	0x1
+	.long	0x2817
+	.long	0x2822
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x725a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2149
+	.byte	0x1b
+	.value	0x391
+	.byte	0x7
+	.long	.LASF2476
+	.long	0x725f
+	.byte	0x1
+	.long	0x283c
+	.long	0x2847
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x3adc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2477
+	.byte	0x1b
+	.value	0x3a8
+	.byte	0x7
+	.long	.LASF2478
+	.long	0x20ee
+	.byte	0x1
+	.long	0x2861
+	.long	0x2867
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2296
+	.byte	0x1b
+	.value	0x3b3
+	.byte	0x7
+	.long	.LASF2479
+	.long	0x24bc
+	.byte	0x1
+	.long	0x2881
+	.long	0x2887
+	.uleb128 0x2
+	.long	0x7232
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2296
+	.byte	0x1b
+	.value	0x3bc
+	.byte	0x7
+	.long	.LASF2480
+	.long	0x24ea
+	.byte	0x1
+	.long	0x28a1
+	.long	0x28a7
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x2d
+	.string	"end"
+	.byte	0x1b
+	.value	0x3c5
+	.long	.LASF2481
+	.long	0x24bc
+	.long	0x28bf
+	.long	0x28c5
+	.uleb128 0x2
+	.long	0x7232
+	.byte	0
+	.uleb128 0x2d
+	.string	"end"
+	.byte	0x1b
+	.value	0x3ce
+	.long	.LASF2482
+	.long	0x24ea
+	.long	0x28dd
+	.long	0x28e3
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2483
+	.byte	0x1b
+	.byte	0x88
+	.byte	0x2f
+	.long	0x3bd1
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2303
+	.byte	0x1b
+	.value	0x3d8
+	.byte	0x7
+	.long	.LASF2484
+	.long	0x28e3
+	.byte	0x1
+	.long	0x290a
+	.long	0x2910
+	.uleb128 0x2
+	.long	0x7232
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2302
+	.byte	0x1b
+	.byte	0x87
+	.byte	0x35
+	.long	0x3bd6
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2303
+	.byte	0x1b
+	.value	0x3e2
+	.byte	0x7
+	.long	.LASF2485
+	.long	0x2910
+	.byte	0x1
+	.long	0x2937
+	.long	0x293d
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2305
+	.byte	0x1b
+	.value	0x3ec
+	.byte	0x7
+	.long	.LASF2486
+	.long	0x28e3
+	.byte	0x1
+	.long	0x2957
+	.long	0x295d
+	.uleb128 0x2
+	.long	0x7232
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2305
+	.byte	0x1b
+	.value	0x3f6
+	.byte	0x7
+	.long	.LASF2487
+	.long	0x2910
+	.byte	0x1
+	.long	0x2977
+	.long	0x297d
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2298
+	.byte	0x1b
+	.value	0x400
+	.byte	0x7
+	.long	.LASF2488
+	.long	0x24ea
+	.byte	0x1
+	.long	0x2997
+	.long	0x299d
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2300
+	.byte	0x1b
+	.value	0x409
+	.byte	0x7
+	.long	.LASF2489
+	.long	0x24ea
+	.byte	0x1
+	.long	0x29b7
+	.long	0x29bd
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2307
+	.byte	0x1b
+	.value	0x413
+	.byte	0x7
+	.long	.LASF2490
+	.long	0x2910
+	.byte	0x1
+	.long	0x29d7
+	.long	0x29dd
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2309
+	.byte	0x1b
+	.value	0x41d
+	.byte	0x7
+	.long	.LASF2491
+	.long	0x2910
+	.byte	0x1
+	.long	0x29f7
+	.long	0x29fd
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2311
+	.byte	0x1b
+	.value	0x427
+	.byte	0x7
+	.long	.LASF2492
+	.long	0x20e1
+	.byte	0x1
+	.long	0x2a17
+	.long	0x2a1d
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2238
+	.byte	0x1b
+	.value	0x42e
+	.byte	0x7
+	.long	.LASF2493
+	.long	0x20e1
+	.byte	0x1
+	.long	0x2a37
+	.long	0x2a3d
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2277
+	.byte	0x1b
+	.value	0x434
+	.byte	0x7
+	.long	.LASF2494
+	.long	0x20e1
+	.byte	0x1
+	.long	0x2a57
+	.long	0x2a5d
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2495
+	.byte	0x1b
+	.value	0x443
+	.byte	0x7
+	.long	.LASF2496
+	.byte	0x1
+	.long	0x2a73
+	.long	0x2a83
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x5827
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2495
+	.byte	0x1b
+	.value	0x451
+	.byte	0x7
+	.long	.LASF2497
+	.byte	0x1
+	.long	0x2a99
+	.long	0x2aa4
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2498
+	.byte	0x1b
+	.value	0x45a
+	.byte	0x7
+	.long	.LASF2499
+	.byte	0x1
+	.long	0x2aba
+	.long	0x2ac0
+	.uleb128 0x2
+	.long	0x7232
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2500
+	.byte	0x1b
+	.value	0x46c
+	.byte	0x7
+	.long	.LASF2501
+	.long	0x20e1
+	.byte	0x1
+	.long	0x2ada
+	.long	0x2ae0
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2502
+	.byte	0x1b
+	.value	0x485
+	.byte	0x7
+	.long	.LASF2503
+	.byte	0x1
+	.long	0x2af6
+	.long	0x2b01
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2502
+	.byte	0x1b
+	.value	0x48f
+	.byte	0x7
+	.long	.LASF2504
+	.byte	0x1
+	.long	0x2b17
+	.long	0x2b1d
+	.uleb128 0x2
+	.long	0x7232
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2505
+	.byte	0x1b
+	.value	0x496
+	.byte	0x7
+	.long	.LASF2506
+	.byte	0x1
+	.long	0x2b33
+	.long	0x2b39
+	.uleb128 0x2
+	.long	0x7232
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2315
+	.byte	0x1b
+	.value	0x49f
+	.byte	0x7
+	.long	.LASF2507
+	.long	0x509b
+	.byte	0x1
+	.long	0x2b53
+	.long	0x2b59
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2271
+	.byte	0x1b
+	.byte	0x81
+	.byte	0x37
+	.long	0x521d
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2317
+	.byte	0x1b
+	.value	0x4af
+	.byte	0x7
+	.long	.LASF2508
+	.long	0x2b59
+	.byte	0x1
+	.long	0x2b80
+	.long	0x2b8b
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2267
+	.byte	0x1b
+	.byte	0x80
+	.byte	0x31
+	.long	0x5211
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2317
+	.byte	0x1b
+	.value	0x4c1
+	.byte	0x7
+	.long	.LASF2509
+	.long	0x2b8b
+	.byte	0x1
+	.long	0x2bb2
+	.long	0x2bbd
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x2d
+	.string	"at"
+	.byte	0x1b
+	.value	0x4d7
+	.long	.LASF2510
+	.long	0x2b59
+	.long	0x2bd4
+	.long	0x2bdf
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x2d
+	.string	"at"
+	.byte	0x1b
+	.value	0x4ed
+	.long	.LASF2511
+	.long	0x2b8b
+	.long	0x2bf6
+	.long	0x2c01
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2321
+	.byte	0x1b
+	.value	0x4fe
+	.byte	0x7
+	.long	.LASF2512
+	.long	0x2b8b
+	.byte	0x1
+	.long	0x2c1b
+	.long	0x2c21
+	.uleb128 0x2
+	.long	0x7232
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2321
+	.byte	0x1b
+	.value	0x50a
+	.byte	0x7
+	.long	.LASF2513
+	.long	0x2b59
+	.byte	0x1
+	.long	0x2c3b
+	.long	0x2c41
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2323
+	.byte	0x1b
+	.value	0x516
+	.byte	0x7
+	.long	.LASF2514
+	.long	0x2b8b
+	.byte	0x1
+	.long	0x2c5b
+	.long	0x2c61
+	.uleb128 0x2
+	.long	0x7232
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2323
+	.byte	0x1b
+	.value	0x522
+	.byte	0x7
+	.long	.LASF2515
+	.long	0x2b59
+	.byte	0x1
+	.long	0x2c7b
+	.long	0x2c81
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2167
+	.byte	0x1b
+	.value	0x531
+	.byte	0x7
+	.long	.LASF2516
+	.long	0x725f
+	.byte	0x1
+	.long	0x2c9b
+	.long	0x2ca6
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x7255
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2167
+	.byte	0x1b
+	.value	0x53b
+	.byte	0x7
+	.long	.LASF2517
+	.long	0x725f
+	.byte	0x1
+	.long	0x2cc0
+	.long	0x2ccb
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2167
+	.byte	0x1b
+	.value	0x545
+	.byte	0x7
+	.long	.LASF2518
+	.long	0x725f
+	.byte	0x1
+	.long	0x2ce5
+	.long	0x2cf0
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x5827
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2167
+	.byte	0x1b
+	.value	0x553
+	.byte	0x7
+	.long	.LASF2519
+	.long	0x725f
+	.byte	0x1
+	.long	0x2d0a
+	.long	0x2d15
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x3adc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2520
+	.byte	0x1b
+	.value	0x56b
+	.byte	0x7
+	.long	.LASF2521
+	.long	0x725f
+	.byte	0x1
+	.long	0x2d2f
+	.long	0x2d3a
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x7255
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2520
+	.byte	0x1b
+	.value	0x57d
+	.byte	0x7
+	.long	.LASF2522
+	.long	0x725f
+	.byte	0x1
+	.long	0x2d54
+	.long	0x2d69
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x7255
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2520
+	.byte	0x1b
+	.value	0x58a
+	.byte	0x7
+	.long	.LASF2523
+	.long	0x725f
+	.byte	0x1
+	.long	0x2d83
+	.long	0x2d93
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2520
+	.byte	0x1b
+	.value	0x598
+	.byte	0x7
+	.long	.LASF2524
+	.long	0x725f
+	.byte	0x1
+	.long	0x2dad
+	.long	0x2db8
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2520
+	.byte	0x1b
+	.value	0x5aa
+	.byte	0x7
+	.long	.LASF2525
+	.long	0x725f
+	.byte	0x1
+	.long	0x2dd2
+	.long	0x2de2
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x5827
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2520
+	.byte	0x1b
+	.value	0x5b5
+	.byte	0x7
+	.long	.LASF2526
+	.long	0x725f
+	.byte	0x1
+	.long	0x2dfc
+	.long	0x2e07
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x3adc
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2527
+	.byte	0x1b
+	.value	0x5f4
+	.byte	0x7
+	.long	.LASF2528
+	.byte	0x1
+	.long	0x2e1d
+	.long	0x2e28
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x5827
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2246
+	.byte	0x1b
+	.value	0x604
+	.byte	0x7
+	.long	.LASF2529
+	.long	0x725f
+	.byte	0x1
+	.long	0x2e42
+	.long	0x2e4d
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x7255
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2246
+	.byte	0x1b
+	.value	0x632
+	.byte	0x7
+	.long	.LASF2530
+	.long	0x725f
+	.byte	0x1
+	.long	0x2e67
+	.long	0x2e72
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x725a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2246
+	.byte	0x1b
+	.value	0x64a
+	.byte	0x7
+	.long	.LASF2531
+	.long	0x725f
+	.byte	0x1
+	.long	0x2e8c
+	.long	0x2ea1
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x7255
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2246
+	.byte	0x1b
+	.value	0x65b
+	.byte	0x7
+	.long	.LASF2532
+	.long	0x725f
+	.byte	0x1
+	.long	0x2ebb
+	.long	0x2ecb
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2246
+	.byte	0x1b
+	.value	0x66c
+	.byte	0x7
+	.long	.LASF2533
+	.long	0x725f
+	.byte	0x1
+	.long	0x2ee5
+	.long	0x2ef0
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2246
+	.byte	0x1b
+	.value	0x67e
+	.byte	0x7
+	.long	.LASF2534
+	.long	0x725f
+	.byte	0x1
+	.long	0x2f0a
+	.long	0x2f1a
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x5827
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2246
+	.byte	0x1b
+	.value	0x69c
+	.byte	0x7
+	.long	.LASF2535
+	.long	0x725f
+	.byte	0x1
+	.long	0x2f34
+	.long	0x2f3f
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x3adc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2536
+	.byte	0x1b
+	.value	0x6d5
+	.byte	0x7
+	.long	.LASF2537
+	.long	0x24bc
+	.byte	0x1
+	.long	0x2f59
+	.long	0x2f6e
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x24ea
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x5827
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2536
+	.byte	0x1b
+	.value	0x725
+	.byte	0x7
+	.long	.LASF2538
+	.long	0x24bc
+	.byte	0x1
+	.long	0x2f88
+	.long	0x2f98
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x24ea
+	.uleb128 0x1
+	.long	0x3adc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2536
+	.byte	0x1b
+	.value	0x741
+	.byte	0x7
+	.long	.LASF2539
+	.long	0x725f
+	.byte	0x1
+	.long	0x2fb2
+	.long	0x2fc2
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x7255
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2536
+	.byte	0x1b
+	.value	0x759
+	.byte	0x7
+	.long	.LASF2540
+	.long	0x725f
+	.byte	0x1
+	.long	0x2fdc
+	.long	0x2ff6
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x7255
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2536
+	.byte	0x1b
+	.value	0x771
+	.byte	0x7
+	.long	.LASF2541
+	.long	0x725f
+	.byte	0x1
+	.long	0x3010
+	.long	0x3025
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2536
+	.byte	0x1b
+	.value	0x785
+	.byte	0x7
+	.long	.LASF2542
+	.long	0x725f
+	.byte	0x1
+	.long	0x303f
+	.long	0x304f
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2536
+	.byte	0x1b
+	.value	0x79e
+	.byte	0x7
+	.long	.LASF2543
+	.long	0x725f
+	.byte	0x1
+	.long	0x3069
+	.long	0x307e
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x5827
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2536
+	.byte	0x1b
+	.value	0x7b1
+	.byte	0x7
+	.long	.LASF2544
+	.long	0x24bc
+	.byte	0x1
+	.long	0x3098
+	.long	0x30a8
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x5827
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2545
+	.byte	0x1b
+	.byte	0x92
+	.byte	0x1e
+	.long	0x24ea
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF2546
+	.byte	0x1b
+	.value	0x7f0
+	.byte	0x7
+	.long	.LASF2547
+	.long	0x725f
+	.byte	0x1
+	.long	0x30cf
+	.long	0x30df
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2546
+	.byte	0x1b
+	.value	0x804
+	.byte	0x7
+	.long	.LASF2548
+	.long	0x24bc
+	.byte	0x1
+	.long	0x30f9
+	.long	0x3104
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x30a8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2546
+	.byte	0x1b
+	.value	0x818
+	.byte	0x7
+	.long	.LASF2549
+	.long	0x24bc
+	.byte	0x1
+	.long	0x311e
+	.long	0x312e
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x30a8
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2550
+	.byte	0x1b
+	.value	0x82c
+	.byte	0x7
+	.long	.LASF2551
+	.byte	0x1
+	.long	0x3144
+	.long	0x314a
+	.uleb128 0x2
+	.long	0x7232
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2552
+	.byte	0x1b
+	.value	0x846
+	.byte	0x7
+	.long	.LASF2553
+	.long	0x725f
+	.byte	0x1
+	.long	0x3164
+	.long	0x3179
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x7255
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2552
+	.byte	0x1b
+	.value	0x85d
+	.byte	0x7
+	.long	.LASF2554
+	.long	0x725f
+	.byte	0x1
+	.long	0x3193
+	.long	0x31b2
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x7255
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2552
+	.byte	0x1b
+	.value	0x877
+	.byte	0x7
+	.long	.LASF2555
+	.long	0x725f
+	.byte	0x1
+	.long	0x31cc
+	.long	0x31e6
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2552
+	.byte	0x1b
+	.value	0x891
+	.byte	0x7
+	.long	.LASF2556
+	.long	0x725f
+	.byte	0x1
+	.long	0x3200
+	.long	0x3215
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2552
+	.byte	0x1b
+	.value	0x8aa
+	.byte	0x7
+	.long	.LASF2557
+	.long	0x725f
+	.byte	0x1
+	.long	0x322f
+	.long	0x3249
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x5827
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2552
+	.byte	0x1b
+	.value	0x8bd
+	.byte	0x7
+	.long	.LASF2558
+	.long	0x725f
+	.byte	0x1
+	.long	0x3263
+	.long	0x3278
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x7255
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2552
+	.byte	0x1b
+	.value	0x8d2
+	.byte	0x7
+	.long	.LASF2559
+	.long	0x725f
+	.byte	0x1
+	.long	0x3292
+	.long	0x32ac
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2552
+	.byte	0x1b
+	.value	0x8e9
+	.byte	0x7
+	.long	.LASF2560
+	.long	0x725f
+	.byte	0x1
+	.long	0x32c6
+	.long	0x32db
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2552
+	.byte	0x1b
+	.value	0x8ff
+	.byte	0x7
+	.long	.LASF2561
+	.long	0x725f
+	.byte	0x1
+	.long	0x32f5
+	.long	0x330f
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x5827
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2552
+	.byte	0x1b
+	.value	0x93a
+	.byte	0x7
+	.long	.LASF2562
+	.long	0x725f
+	.byte	0x1
+	.long	0x3329
+	.long	0x3343
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x594a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2552
+	.byte	0x1b
+	.value	0x946
+	.byte	0x7
+	.long	.LASF2563
+	.long	0x725f
+	.byte	0x1
+	.long	0x335d
+	.long	0x3377
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2552
+	.byte	0x1b
+	.value	0x952
+	.byte	0x7
+	.long	.LASF2564
+	.long	0x725f
+	.byte	0x1
+	.long	0x3391
+	.long	0x33ab
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x24bc
+	.uleb128 0x1
+	.long	0x24bc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2552
+	.byte	0x1b
+	.value	0x95e
+	.byte	0x7
+	.long	.LASF2565
+	.long	0x725f
+	.byte	0x1
+	.long	0x33c5
+	.long	0x33df
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x24ea
+	.uleb128 0x1
+	.long	0x24ea
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2552
+	.byte	0x1b
+	.value	0x978
+	.byte	0x15
+	.long	.LASF2566
+	.long	0x725f
+	.byte	0x1
+	.long	0x33f9
+	.long	0x340e
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x24ea
+	.uleb128 0x1
+	.long	0x24ea
+	.uleb128 0x1
+	.long	0x3adc
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2567
+	.byte	0x1b
+	.value	0x9c8
+	.byte	0x7
+	.long	.LASF2568
+	.long	0x725f
+	.long	0x3427
+	.long	0x3441
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x5827
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2569
+	.byte	0x1b
+	.value	0x9cd
+	.byte	0x7
+	.long	.LASF2570
+	.long	0x725f
+	.long	0x345a
+	.long	0x3474
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2571
+	.byte	0x1b
+	.value	0x9d2
+	.byte	0x7
+	.long	.LASF2572
+	.long	0x725f
+	.long	0x348d
+	.long	0x349d
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2244
+	.byte	0x1b
+	.value	0x9e4
+	.byte	0x7
+	.long	.LASF2573
+	.long	0x20e1
+	.byte	0x1
+	.long	0x34b7
+	.long	0x34cc
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2331
+	.byte	0x1b
+	.value	0x9ef
+	.byte	0x7
+	.long	.LASF2574
+	.byte	0x1
+	.long	0x34e2
+	.long	0x34ed
+	.uleb128 0x2
+	.long	0x7232
+	.uleb128 0x1
+	.long	0x725f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2575
+	.byte	0x1b
+	.value	0x9fa
+	.byte	0x7
+	.long	.LASF2576
+	.long	0x581d
+	.byte	0x1
+	.long	0x3507
+	.long	0x350d
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2325
+	.byte	0x1b
+	.value	0xa07
+	.byte	0x7
+	.long	.LASF2577
+	.long	0x581d
+	.byte	0x1
+	.long	0x3527
+	.long	0x352d
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2325
+	.byte	0x1b
+	.value	0xa13
+	.byte	0x7
+	.long	.LASF2578
+	.long	0x594a
+	.byte	0x1
+	.long	0x3547
+	.long	0x354d
+	.uleb128 0x2
+	.long	0x7232
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2579
+	.byte	0x1b
+	.value	0xa1c
+	.byte	0x7
+	.long	.LASF2580
+	.long	0x231d
+	.byte	0x1
+	.long	0x3567
+	.long	0x356d
+	.uleb128 0x2
+	.long	0x723c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2240
+	.byte	0x1b
+	.value	0xa2d
+	.byte	0x7
+	.long	.LASF2581
+	.long	0x20e1
+	.byte	0x1
+	.long	0x3587
+	.long	0x359c
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2240
+	.byte	0x1b
+	.value	0xa3c
+	.byte	0x7
+	.long	.LASF2582
+	.long	0x20e1
+	.byte	0x1
+	.long	0x35b6
+	.long	0x35c6
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x7255
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2240
+	.byte	0x1b
+	.value	0xa5e
+	.byte	0x7
+	.long	.LASF2583
+	.long	0x20e1
+	.byte	0x1
+	.long	0x35e0
+	.long	0x35f0
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2240
+	.byte	0x1b
+	.value	0xa70
+	.byte	0x7
+	.long	.LASF2584
+	.long	0x20e1
+	.byte	0x1
+	.long	0x360a
+	.long	0x361a
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2346
+	.byte	0x1b
+	.value	0xa7e
+	.byte	0x7
+	.long	.LASF2585
+	.long	0x20e1
+	.byte	0x1
+	.long	0x3634
+	.long	0x3644
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x7255
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2346
+	.byte	0x1b
+	.value	0xaa2
+	.byte	0x7
+	.long	.LASF2586
+	.long	0x20e1
+	.byte	0x1
+	.long	0x365e
+	.long	0x3673
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2346
+	.byte	0x1b
+	.value	0xab1
+	.byte	0x7
+	.long	.LASF2587
+	.long	0x20e1
+	.byte	0x1
+	.long	0x368d
+	.long	0x369d
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2346
+	.byte	0x1b
+	.value	0xac3
+	.byte	0x7
+	.long	.LASF2588
+	.long	0x20e1
+	.byte	0x1
+	.long	0x36b7
+	.long	0x36c7
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2351
+	.byte	0x1b
+	.value	0xad2
+	.byte	0x7
+	.long	.LASF2589
+	.long	0x20e1
+	.byte	0x1
+	.long	0x36e1
+	.long	0x36f1
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x7255
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2351
+	.byte	0x1b
+	.value	0xaf7
+	.byte	0x7
+	.long	.LASF2590
+	.long	0x20e1
+	.byte	0x1
+	.long	0x370b
+	.long	0x3720
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2351
+	.byte	0x1b
+	.value	0xb06
+	.byte	0x7
+	.long	.LASF2591
+	.long	0x20e1
+	.byte	0x1
+	.long	0x373a
+	.long	0x374a
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2351
+	.byte	0x1b
+	.value	0xb1b
+	.byte	0x7
+	.long	.LASF2592
+	.long	0x20e1
+	.byte	0x1
+	.long	0x3764
+	.long	0x3774
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2356
+	.byte	0x1b
+	.value	0xb2b
+	.byte	0x7
+	.long	.LASF2593
+	.long	0x20e1
+	.byte	0x1
+	.long	0x378e
+	.long	0x379e
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x7255
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2356
+	.byte	0x1b
+	.value	0xb50
+	.byte	0x7
+	.long	.LASF2594
+	.long	0x20e1
+	.byte	0x1
+	.long	0x37b8
+	.long	0x37cd
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2356
+	.byte	0x1b
+	.value	0xb5f
+	.byte	0x7
+	.long	.LASF2595
+	.long	0x20e1
+	.byte	0x1
+	.long	0x37e7
+	.long	0x37f7
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2356
+	.byte	0x1b
+	.value	0xb74
+	.byte	0x7
+	.long	.LASF2596
+	.long	0x20e1
+	.byte	0x1
+	.long	0x3811
+	.long	0x3821
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2361
+	.byte	0x1b
+	.value	0xb83
+	.byte	0x7
+	.long	.LASF2597
+	.long	0x20e1
+	.byte	0x1
+	.long	0x383b
+	.long	0x384b
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x7255
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2361
+	.byte	0x1b
+	.value	0xba8
+	.byte	0x7
+	.long	.LASF2598
+	.long	0x20e1
+	.byte	0x1
+	.long	0x3865
+	.long	0x387a
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2361
+	.byte	0x1b
+	.value	0xbb7
+	.byte	0x7
+	.long	.LASF2599
+	.long	0x20e1
+	.byte	0x1
+	.long	0x3894
+	.long	0x38a4
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2361
+	.byte	0x1b
+	.value	0xbca
+	.byte	0x7
+	.long	.LASF2600
+	.long	0x20e1
+	.byte	0x1
+	.long	0x38be
+	.long	0x38ce
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2366
+	.byte	0x1b
+	.value	0xbda
+	.byte	0x7
+	.long	.LASF2601
+	.long	0x20e1
+	.byte	0x1
+	.long	0x38e8
+	.long	0x38f8
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x7255
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2366
+	.byte	0x1b
+	.value	0xbff
+	.byte	0x7
+	.long	.LASF2602
+	.long	0x20e1
+	.byte	0x1
+	.long	0x3912
+	.long	0x3927
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2366
+	.byte	0x1b
+	.value	0xc0e
+	.byte	0x7
+	.long	.LASF2603
+	.long	0x20e1
+	.byte	0x1
+	.long	0x3941
+	.long	0x3951
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2366
+	.byte	0x1b
+	.value	0xc21
+	.byte	0x7
+	.long	.LASF2604
+	.long	0x20e1
+	.byte	0x1
+	.long	0x396b
+	.long	0x397b
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2334
+	.byte	0x1b
+	.value	0xc32
+	.byte	0x7
+	.long	.LASF2605
+	.long	0x203d
+	.byte	0x1
+	.long	0x3995
+	.long	0x39a5
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2236
+	.byte	0x1b
+	.value	0xc46
+	.byte	0x7
+	.long	.LASF2606
+	.long	0x56fc
+	.byte	0x1
+	.long	0x39bf
+	.long	0x39ca
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x7255
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2236
+	.byte	0x1b
+	.value	0xca7
+	.byte	0x7
+	.long	.LASF2607
+	.long	0x56fc
+	.byte	0x1
+	.long	0x39e4
+	.long	0x39f9
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x7255
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2236
+	.byte	0x1b
+	.value	0xcc2
+	.byte	0x7
+	.long	.LASF2608
+	.long	0x56fc
+	.byte	0x1
+	.long	0x3a13
+	.long	0x3a32
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x7255
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2236
+	.byte	0x1b
+	.value	0xcd5
+	.byte	0x7
+	.long	.LASF2609
+	.long	0x56fc
+	.byte	0x1
+	.long	0x3a4c
+	.long	0x3a57
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2236
+	.byte	0x1b
+	.value	0xcee
+	.byte	0x7
+	.long	.LASF2610
+	.long	0x56fc
+	.byte	0x1
+	.long	0x3a71
+	.long	0x3a86
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2236
+	.byte	0x1b
+	.value	0xd0a
+	.byte	0x7
+	.long	.LASF2611
+	.long	0x56fc
+	.byte	0x1
+	.long	0x3aa0
+	.long	0x3aba
+	.uleb128 0x2
+	.long	0x723c
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x20e1
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x20e1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2257
+	.long	0x5827
+	.uleb128 0x3f
+	.long	.LASF2612
+	.long	0x10dd
+	.uleb128 0x3f
+	.long	.LASF2613
+	.long	0x1457
+	.byte	0
+	.uleb128 0x7
+	.long	0x203d
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF2614
+	.byte	0x10
+	.byte	0x1c
+	.byte	0x2f
+	.byte	0xb
+	.long	0x3bcc
+	.uleb128 0x15
+	.long	.LASF2448
+	.byte	0x1c
+	.byte	0x36
+	.byte	0x19
+	.long	0x581d
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF2615
+	.byte	0x1c
+	.byte	0x3a
+	.byte	0x10
+	.long	0x3ae9
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2274
+	.byte	0x1c
+	.byte	0x35
+	.byte	0x16
+	.long	0x123
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF2373
+	.byte	0x1c
+	.byte	0x3b
+	.byte	0x11
+	.long	0x3b03
+	.byte	0x8
+	.uleb128 0x20
+	.long	.LASF2616
+	.byte	0x1c
+	.byte	0x3e
+	.byte	0x11
+	.long	.LASF2617
+	.long	0x3b31
+	.long	0x3b41
+	.uleb128 0x2
+	.long	0x7269
+	.uleb128 0x1
+	.long	0x3b41
+	.uleb128 0x1
+	.long	0x3b03
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2295
+	.byte	0x1c
+	.byte	0x37
+	.byte	0x19
+	.long	0x581d
+	.byte	0x1
+	.uleb128 0x26
+	.long	.LASF2616
+	.byte	0x1c
+	.byte	0x42
+	.byte	0x11
+	.long	.LASF2618
+	.long	0x3b62
+	.long	0x3b68
+	.uleb128 0x2
+	.long	0x7269
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2311
+	.byte	0x1c
+	.byte	0x47
+	.byte	0x7
+	.long	.LASF2619
+	.long	0x3b03
+	.byte	0x1
+	.long	0x3b81
+	.long	0x3b87
+	.uleb128 0x2
+	.long	0x726e
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2296
+	.byte	0x1c
+	.byte	0x4b
+	.byte	0x7
+	.long	.LASF2620
+	.long	0x3b41
+	.byte	0x1
+	.long	0x3ba0
+	.long	0x3ba6
+	.uleb128 0x2
+	.long	0x726e
+	.byte	0
+	.uleb128 0x49
+	.string	"end"
+	.byte	0x1c
+	.byte	0x4f
+	.long	.LASF2621
+	.long	0x3b41
+	.long	0x3bbd
+	.long	0x3bc3
+	.uleb128 0x2
+	.long	0x726e
+	.byte	0
+	.uleb128 0x10
+	.string	"_E"
+	.long	0x5827
+	.byte	0
+	.uleb128 0x7
+	.long	0x3adc
+	.uleb128 0x32
+	.long	.LASF2623
+	.uleb128 0x32
+	.long	.LASF2624
+	.uleb128 0x5
+	.long	.LASF2625
+	.byte	0x1d
+	.byte	0x4d
+	.byte	0x1e
+	.long	0x203d
+	.uleb128 0x3e
+	.long	.LASF2626
+	.byte	0xc
+	.value	0x28a
+	.long	0x3c30
+	.uleb128 0xe
+	.long	.LASF2627
+	.byte	0xc
+	.value	0x28f
+	.byte	0x9
+	.long	.LASF2628
+	.long	0x594a
+	.long	0x3c25
+	.uleb128 0xc
+	.long	.LASF2130
+	.long	0x594a
+	.uleb128 0xc
+	.long	.LASF2629
+	.long	0x56db
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x56db
+	.byte	0
+	.uleb128 0x7f
+	.long	.LASF2630
+	.long	0x509b
+	.byte	0x1
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2631
+	.byte	0x18
+	.byte	0x6
+	.byte	0x55
+	.byte	0xc
+	.long	0x3ff6
+	.uleb128 0x19
+	.long	.LASF2632
+	.byte	0x18
+	.byte	0x6
+	.byte	0x5c
+	.byte	0xe
+	.long	0x3ce6
+	.uleb128 0x6
+	.long	.LASF2633
+	.byte	0x6
+	.byte	0x5e
+	.byte	0xa
+	.long	0x3ceb
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2634
+	.byte	0x6
+	.byte	0x5f
+	.byte	0xa
+	.long	0x3ceb
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF2635
+	.byte	0x6
+	.byte	0x60
+	.byte	0xa
+	.long	0x3ceb
+	.byte	0x10
+	.uleb128 0x20
+	.long	.LASF2632
+	.byte	0x6
+	.byte	0x63
+	.byte	0x2
+	.long	.LASF2636
+	.long	0x3c85
+	.long	0x3c8b
+	.uleb128 0x2
+	.long	0x7422
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2632
+	.byte	0x6
+	.byte	0x69
+	.byte	0x2
+	.long	.LASF2637
+	.long	0x3c9f
+	.long	0x3caa
+	.uleb128 0x2
+	.long	0x7422
+	.uleb128 0x1
+	.long	0x742c
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2638
+	.byte	0x6
+	.byte	0x71
+	.byte	0x2
+	.long	.LASF2639
+	.long	0x3cbe
+	.long	0x3cc9
+	.uleb128 0x2
+	.long	0x7422
+	.uleb128 0x1
+	.long	0x7431
+	.byte	0
+	.uleb128 0x80
+	.long	.LASF2640
+	.byte	0x6
+	.byte	0x7a
+	.byte	0x2
+	.long	.LASF2798
+	.long	0x3cda
+	.uleb128 0x2
+	.long	0x7422
+	.uleb128 0x1
+	.long	0x7436
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x3c3d
+	.uleb128 0x5
+	.long	.LASF2265
+	.byte	0x6
+	.byte	0x5a
+	.byte	0x9
+	.long	0x51ed
+	.uleb128 0x19
+	.long	.LASF2641
+	.byte	0x18
+	.byte	0x6
+	.byte	0x85
+	.byte	0xe
+	.long	0x3dc3
+	.uleb128 0x2c
+	.long	0x1457
+	.uleb128 0x2c
+	.long	0x3c3d
+	.uleb128 0x20
+	.long	.LASF2641
+	.byte	0x6
+	.byte	0x89
+	.byte	0x2
+	.long	.LASF2642
+	.long	0x3d22
+	.long	0x3d28
+	.uleb128 0x2
+	.long	0x743b
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2641
+	.byte	0x6
+	.byte	0x8f
+	.byte	0x2
+	.long	.LASF2643
+	.long	0x3d3c
+	.long	0x3d47
+	.uleb128 0x2
+	.long	0x743b
+	.uleb128 0x1
+	.long	0x7445
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2641
+	.byte	0x6
+	.byte	0x97
+	.byte	0x2
+	.long	.LASF2644
+	.long	0x3d5b
+	.long	0x3d66
+	.uleb128 0x2
+	.long	0x743b
+	.uleb128 0x1
+	.long	0x744a
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2641
+	.byte	0x6
+	.byte	0x9c
+	.byte	0x2
+	.long	.LASF2645
+	.long	0x3d7a
+	.long	0x3d85
+	.uleb128 0x2
+	.long	0x743b
+	.uleb128 0x1
+	.long	0x744f
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2641
+	.byte	0x6
+	.byte	0xa1
+	.byte	0x2
+	.long	.LASF2646
+	.long	0x3d99
+	.long	0x3da9
+	.uleb128 0x2
+	.long	0x743b
+	.uleb128 0x1
+	.long	0x744f
+	.uleb128 0x1
+	.long	0x744a
+	.byte	0
+	.uleb128 0x81
+	.long	.LASF3121
+	.long	.LASF3182
+	.long	0x3db7
+	.uleb128 0x2
+	.long	0x743b
+	.uleb128 0x2
+	.long	0x56fc
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2647
+	.byte	0x6
+	.byte	0x58
+	.byte	0x15
+	.long	0x5236
+	.uleb128 0x7
+	.long	0x3dc3
+	.uleb128 0xa
+	.long	.LASF2648
+	.byte	0x6
+	.value	0x12a
+	.byte	0x7
+	.long	.LASF2649
+	.long	0x7454
+	.long	0x3ded
+	.long	0x3df3
+	.uleb128 0x2
+	.long	0x7459
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2648
+	.byte	0x6
+	.value	0x12f
+	.byte	0x7
+	.long	.LASF2650
+	.long	0x7445
+	.long	0x3e0c
+	.long	0x3e12
+	.uleb128 0x2
+	.long	0x7463
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2377
+	.byte	0x6
+	.value	0x126
+	.byte	0x16
+	.long	0x1457
+	.uleb128 0x7
+	.long	0x3e12
+	.uleb128 0xa
+	.long	.LASF2579
+	.byte	0x6
+	.value	0x134
+	.byte	0x7
+	.long	.LASF2651
+	.long	0x3e12
+	.long	0x3e3d
+	.long	0x3e43
+	.uleb128 0x2
+	.long	0x7463
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF2652
+	.byte	0x6
+	.value	0x138
+	.long	.LASF2653
+	.long	0x3e57
+	.long	0x3e5d
+	.uleb128 0x2
+	.long	0x7459
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2652
+	.byte	0x6
+	.value	0x13e
+	.byte	0x7
+	.long	.LASF2654
+	.long	0x3e72
+	.long	0x3e7d
+	.uleb128 0x2
+	.long	0x7459
+	.uleb128 0x1
+	.long	0x746d
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2652
+	.byte	0x6
+	.value	0x144
+	.byte	0x7
+	.long	.LASF2655
+	.long	0x3e92
+	.long	0x3e9d
+	.uleb128 0x2
+	.long	0x7459
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2652
+	.byte	0x6
+	.value	0x14a
+	.byte	0x7
+	.long	.LASF2656
+	.long	0x3eb2
+	.long	0x3ec2
+	.uleb128 0x2
+	.long	0x7459
+	.uleb128 0x1
+	.long	0x123
+	.uleb128 0x1
+	.long	0x746d
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF2652
+	.byte	0x6
+	.value	0x14f
+	.long	.LASF2657
+	.long	0x3ed6
+	.long	0x3ee1
+	.uleb128 0x2
+	.long	0x7459
+	.uleb128 0x1
+	.long	0x7472
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2652
+	.byte	0x6
+	.value	0x154
+	.byte	0x7
+	.long	.LASF2658
+	.long	0x3ef6
+	.long	0x3f01
+	.uleb128 0x2
+	.long	0x7459
+	.uleb128 0x1
+	.long	0x744f
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2652
+	.byte	0x6
+	.value	0x158
+	.byte	0x7
+	.long	.LASF2659
+	.long	0x3f16
+	.long	0x3f26
+	.uleb128 0x2
+	.long	0x7459
+	.uleb128 0x1
+	.long	0x7472
+	.uleb128 0x1
+	.long	0x746d
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2652
+	.byte	0x6
+	.value	0x166
+	.byte	0x7
+	.long	.LASF2660
+	.long	0x3f3b
+	.long	0x3f4b
+	.uleb128 0x2
+	.long	0x7459
+	.uleb128 0x1
+	.long	0x746d
+	.uleb128 0x1
+	.long	0x7472
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2661
+	.byte	0x6
+	.value	0x16c
+	.byte	0x7
+	.long	.LASF2662
+	.long	0x3f60
+	.long	0x3f6b
+	.uleb128 0x2
+	.long	0x7459
+	.uleb128 0x2
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x4a
+	.long	.LASF2663
+	.byte	0x6
+	.value	0x173
+	.byte	0x14
+	.long	0x3cf7
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2664
+	.byte	0x6
+	.value	0x177
+	.byte	0x7
+	.long	.LASF2665
+	.long	0x3ceb
+	.long	0x3f92
+	.long	0x3f9d
+	.uleb128 0x2
+	.long	0x7459
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2666
+	.byte	0x6
+	.value	0x17f
+	.byte	0x7
+	.long	.LASF2667
+	.long	0x3fb2
+	.long	0x3fc2
+	.uleb128 0x2
+	.long	0x7459
+	.uleb128 0x1
+	.long	0x3ceb
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2668
+	.byte	0x6
+	.value	0x189
+	.byte	0x7
+	.long	.LASF2669
+	.byte	0x2
+	.long	0x3fd8
+	.long	0x3fe3
+	.uleb128 0x2
+	.long	0x7459
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0xc
+	.long	.LASF2613
+	.long	0x1457
+	.byte	0
+	.uleb128 0x7
+	.long	0x3c30
+	.uleb128 0x19
+	.long	.LASF2670
+	.byte	0x1
+	.byte	0xf
+	.byte	0x7c
+	.byte	0xc
+	.long	0x401e
+	.uleb128 0x5
+	.long	.LASF2671
+	.byte	0xf
+	.byte	0x7d
+	.byte	0xd
+	.long	0x1457
+	.uleb128 0xc
+	.long	.LASF2672
+	.long	0x1457
+	.byte	0
+	.uleb128 0x4b
+	.long	.LASF2673
+	.byte	0x18
+	.byte	0x6
+	.value	0x1a7
+	.long	0x4c4e
+	.uleb128 0x16
+	.byte	0x6
+	.value	0x1a7
+	.byte	0xb
+	.long	0x3f79
+	.uleb128 0x16
+	.byte	0x6
+	.value	0x1a7
+	.byte	0xb
+	.long	0x3f9d
+	.uleb128 0x16
+	.byte	0x6
+	.value	0x1a7
+	.byte	0xb
+	.long	0x3f6b
+	.uleb128 0x16
+	.byte	0x6
+	.value	0x1a7
+	.byte	0xb
+	.long	0x3df3
+	.uleb128 0x16
+	.byte	0x6
+	.value	0x1a7
+	.byte	0xb
+	.long	0x3dd4
+	.uleb128 0x16
+	.byte	0x6
+	.value	0x1a7
+	.byte	0xb
+	.long	0x3e24
+	.uleb128 0x5b
+	.long	0x3c30
+	.byte	0x2
+	.uleb128 0xe
+	.long	.LASF2674
+	.byte	0x6
+	.value	0x1d1
+	.byte	0x7
+	.long	.LASF2675
+	.long	0x509b
+	.long	0x4082
+	.uleb128 0x1
+	.long	0x2c9
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2674
+	.byte	0x6
+	.value	0x1da
+	.byte	0x7
+	.long	.LASF2676
+	.long	0x509b
+	.long	0x409d
+	.uleb128 0x1
+	.long	0x117
+	.byte	0
+	.uleb128 0x5f
+	.long	.LASF2677
+	.byte	0x6
+	.value	0x1de
+	.byte	0x7
+	.long	.LASF2832
+	.long	0x509b
+	.uleb128 0x1e
+	.long	.LASF2265
+	.byte	0x6
+	.value	0x1c1
+	.byte	0x27
+	.long	0x3ceb
+	.byte	0x1
+	.uleb128 0xe
+	.long	.LASF2678
+	.byte	0x6
+	.value	0x1e7
+	.byte	0x7
+	.long	.LASF2679
+	.long	0x40ae
+	.long	0x40eb
+	.uleb128 0x1
+	.long	0x40ae
+	.uleb128 0x1
+	.long	0x40ae
+	.uleb128 0x1
+	.long	0x40ae
+	.uleb128 0x1
+	.long	0x7477
+	.uleb128 0x1
+	.long	0x2c9
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2647
+	.byte	0x6
+	.value	0x1bc
+	.byte	0x2e
+	.long	0x3dc3
+	.uleb128 0x7
+	.long	0x40eb
+	.uleb128 0xe
+	.long	.LASF2678
+	.byte	0x6
+	.value	0x1ee
+	.byte	0x7
+	.long	.LASF2680
+	.long	0x40ae
+	.long	0x412c
+	.uleb128 0x1
+	.long	0x40ae
+	.uleb128 0x1
+	.long	0x40ae
+	.uleb128 0x1
+	.long	0x40ae
+	.uleb128 0x1
+	.long	0x7477
+	.uleb128 0x1
+	.long	0x117
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2681
+	.byte	0x6
+	.value	0x1f3
+	.byte	0x7
+	.long	.LASF2682
+	.long	0x40ae
+	.long	0x4156
+	.uleb128 0x1
+	.long	0x40ae
+	.uleb128 0x1
+	.long	0x40ae
+	.uleb128 0x1
+	.long	0x40ae
+	.uleb128 0x1
+	.long	0x7477
+	.byte	0
+	.uleb128 0x60
+	.long	.LASF2683
+	.value	0x20e
+	.long	.LASF2684
+	.long	0x4169
+	.long	0x416f
+	.uleb128 0x2
+	.long	0x747c
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF2683
+	.byte	0x6
+	.value	0x219
+	.long	.LASF2685
+	.long	0x4183
+	.long	0x418e
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x7486
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2377
+	.byte	0x6
+	.value	0x1cc
+	.byte	0x16
+	.long	0x1457
+	.byte	0x1
+	.uleb128 0x7
+	.long	0x418e
+	.uleb128 0x39
+	.long	.LASF2683
+	.byte	0x6
+	.value	0x227
+	.long	.LASF2686
+	.long	0x41b5
+	.long	0x41c5
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x41c5
+	.uleb128 0x1
+	.long	0x7486
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2274
+	.byte	0x6
+	.value	0x1ca
+	.byte	0x16
+	.long	0x123
+	.byte	0x1
+	.uleb128 0x7
+	.long	0x41c5
+	.uleb128 0xb
+	.long	.LASF2683
+	.byte	0x6
+	.value	0x234
+	.byte	0x7
+	.long	.LASF2687
+	.byte	0x1
+	.long	0x41ee
+	.long	0x4203
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x41c5
+	.uleb128 0x1
+	.long	0x748b
+	.uleb128 0x1
+	.long	0x7486
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2117
+	.byte	0x6
+	.value	0x1c0
+	.byte	0x13
+	.long	0x5827
+	.byte	0x1
+	.uleb128 0x7
+	.long	0x4203
+	.uleb128 0xb
+	.long	.LASF2683
+	.byte	0x6
+	.value	0x254
+	.byte	0x7
+	.long	.LASF2688
+	.byte	0x1
+	.long	0x422c
+	.long	0x4237
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x7490
+	.byte	0
+	.uleb128 0x60
+	.long	.LASF2683
+	.value	0x267
+	.long	.LASF2689
+	.long	0x424a
+	.long	0x4255
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x7495
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2683
+	.byte	0x6
+	.value	0x26b
+	.byte	0x7
+	.long	.LASF2690
+	.byte	0x1
+	.long	0x426b
+	.long	0x427b
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x7490
+	.uleb128 0x1
+	.long	0x749a
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2683
+	.byte	0x6
+	.value	0x276
+	.byte	0x7
+	.long	.LASF2691
+	.long	0x4290
+	.long	0x42a5
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x7495
+	.uleb128 0x1
+	.long	0x7486
+	.uleb128 0x1
+	.long	0x2c9
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2683
+	.byte	0x6
+	.value	0x27b
+	.byte	0x7
+	.long	.LASF2692
+	.long	0x42ba
+	.long	0x42cf
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x7495
+	.uleb128 0x1
+	.long	0x7486
+	.uleb128 0x1
+	.long	0x117
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2683
+	.byte	0x6
+	.value	0x28e
+	.byte	0x7
+	.long	.LASF2693
+	.byte	0x1
+	.long	0x42e5
+	.long	0x42f5
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x7495
+	.uleb128 0x1
+	.long	0x749a
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2683
+	.byte	0x6
+	.value	0x2a1
+	.byte	0x7
+	.long	.LASF2694
+	.byte	0x1
+	.long	0x430b
+	.long	0x431b
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x3adc
+	.uleb128 0x1
+	.long	0x7486
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2695
+	.byte	0x6
+	.value	0x2d8
+	.byte	0x7
+	.long	.LASF2696
+	.byte	0x1
+	.long	0x4331
+	.long	0x433c
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x2
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2149
+	.byte	0x9
+	.byte	0xcc
+	.byte	0x5
+	.long	.LASF2697
+	.long	0x749f
+	.byte	0x1
+	.long	0x4355
+	.long	0x4360
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x7490
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2149
+	.byte	0x6
+	.value	0x2f9
+	.byte	0x7
+	.long	.LASF2698
+	.long	0x749f
+	.byte	0x1
+	.long	0x437a
+	.long	0x4385
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x7495
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2149
+	.byte	0x6
+	.value	0x30f
+	.byte	0x7
+	.long	.LASF2699
+	.long	0x749f
+	.byte	0x1
+	.long	0x439f
+	.long	0x43aa
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x3adc
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2246
+	.byte	0x6
+	.value	0x323
+	.byte	0x7
+	.long	.LASF2700
+	.byte	0x1
+	.long	0x43c0
+	.long	0x43d0
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x41c5
+	.uleb128 0x1
+	.long	0x748b
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2246
+	.byte	0x6
+	.value	0x352
+	.byte	0x7
+	.long	.LASF2701
+	.byte	0x1
+	.long	0x43e6
+	.long	0x43f1
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x3adc
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2448
+	.byte	0x6
+	.value	0x1c5
+	.byte	0x3d
+	.long	0x56c2
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2296
+	.byte	0x6
+	.value	0x364
+	.byte	0x7
+	.long	.LASF2702
+	.long	0x43f1
+	.byte	0x1
+	.long	0x4419
+	.long	0x441f
+	.uleb128 0x2
+	.long	0x747c
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2295
+	.byte	0x6
+	.value	0x1c7
+	.byte	0x7
+	.long	0x56c7
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2296
+	.byte	0x6
+	.value	0x36e
+	.byte	0x7
+	.long	.LASF2703
+	.long	0x441f
+	.byte	0x1
+	.long	0x4447
+	.long	0x444d
+	.uleb128 0x2
+	.long	0x74a4
+	.byte	0
+	.uleb128 0x2d
+	.string	"end"
+	.byte	0x6
+	.value	0x378
+	.long	.LASF2704
+	.long	0x43f1
+	.long	0x4465
+	.long	0x446b
+	.uleb128 0x2
+	.long	0x747c
+	.byte	0
+	.uleb128 0x2d
+	.string	"end"
+	.byte	0x6
+	.value	0x382
+	.long	.LASF2705
+	.long	0x441f
+	.long	0x4483
+	.long	0x4489
+	.uleb128 0x2
+	.long	0x74a4
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2483
+	.byte	0x6
+	.value	0x1c9
+	.byte	0x2f
+	.long	0x4c64
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2303
+	.byte	0x6
+	.value	0x38c
+	.byte	0x7
+	.long	.LASF2706
+	.long	0x4489
+	.byte	0x1
+	.long	0x44b1
+	.long	0x44b7
+	.uleb128 0x2
+	.long	0x747c
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2302
+	.byte	0x6
+	.value	0x1c8
+	.byte	0x35
+	.long	0x4c69
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2303
+	.byte	0x6
+	.value	0x396
+	.byte	0x7
+	.long	.LASF2707
+	.long	0x44b7
+	.byte	0x1
+	.long	0x44df
+	.long	0x44e5
+	.uleb128 0x2
+	.long	0x74a4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2305
+	.byte	0x6
+	.value	0x3a0
+	.byte	0x7
+	.long	.LASF2708
+	.long	0x4489
+	.byte	0x1
+	.long	0x44ff
+	.long	0x4505
+	.uleb128 0x2
+	.long	0x747c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2305
+	.byte	0x6
+	.value	0x3aa
+	.byte	0x7
+	.long	.LASF2709
+	.long	0x44b7
+	.byte	0x1
+	.long	0x451f
+	.long	0x4525
+	.uleb128 0x2
+	.long	0x74a4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2298
+	.byte	0x6
+	.value	0x3b5
+	.byte	0x7
+	.long	.LASF2710
+	.long	0x441f
+	.byte	0x1
+	.long	0x453f
+	.long	0x4545
+	.uleb128 0x2
+	.long	0x74a4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2300
+	.byte	0x6
+	.value	0x3bf
+	.byte	0x7
+	.long	.LASF2711
+	.long	0x441f
+	.byte	0x1
+	.long	0x455f
+	.long	0x4565
+	.uleb128 0x2
+	.long	0x74a4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2307
+	.byte	0x6
+	.value	0x3c9
+	.byte	0x7
+	.long	.LASF2712
+	.long	0x44b7
+	.byte	0x1
+	.long	0x457f
+	.long	0x4585
+	.uleb128 0x2
+	.long	0x74a4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2309
+	.byte	0x6
+	.value	0x3d3
+	.byte	0x7
+	.long	.LASF2713
+	.long	0x44b7
+	.byte	0x1
+	.long	0x459f
+	.long	0x45a5
+	.uleb128 0x2
+	.long	0x74a4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2311
+	.byte	0x6
+	.value	0x3db
+	.byte	0x7
+	.long	.LASF2714
+	.long	0x41c5
+	.byte	0x1
+	.long	0x45bf
+	.long	0x45c5
+	.uleb128 0x2
+	.long	0x74a4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2277
+	.byte	0x6
+	.value	0x3e1
+	.byte	0x7
+	.long	.LASF2715
+	.long	0x41c5
+	.byte	0x1
+	.long	0x45df
+	.long	0x45e5
+	.uleb128 0x2
+	.long	0x74a4
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2495
+	.byte	0x6
+	.value	0x3f0
+	.byte	0x7
+	.long	.LASF2716
+	.byte	0x1
+	.long	0x45fb
+	.long	0x4606
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x41c5
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2495
+	.byte	0x6
+	.value	0x405
+	.byte	0x7
+	.long	.LASF2717
+	.byte	0x1
+	.long	0x461c
+	.long	0x462c
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x41c5
+	.uleb128 0x1
+	.long	0x748b
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2498
+	.byte	0x6
+	.value	0x427
+	.byte	0x7
+	.long	.LASF2718
+	.byte	0x1
+	.long	0x4642
+	.long	0x4648
+	.uleb128 0x2
+	.long	0x747c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2500
+	.byte	0x6
+	.value	0x431
+	.byte	0x7
+	.long	.LASF2719
+	.long	0x41c5
+	.byte	0x1
+	.long	0x4662
+	.long	0x4668
+	.uleb128 0x2
+	.long	0x74a4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2315
+	.byte	0x6
+	.value	0x43b
+	.byte	0x7
+	.long	.LASF2720
+	.long	0x509b
+	.byte	0x1
+	.long	0x4682
+	.long	0x4688
+	.uleb128 0x2
+	.long	0x74a4
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2502
+	.byte	0x9
+	.byte	0x43
+	.byte	0x5
+	.long	.LASF2721
+	.long	0x469c
+	.long	0x46a7
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x41c5
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2267
+	.byte	0x6
+	.value	0x1c3
+	.byte	0x31
+	.long	0x5211
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2317
+	.byte	0x6
+	.value	0x461
+	.byte	0x7
+	.long	.LASF2722
+	.long	0x46a7
+	.byte	0x1
+	.long	0x46cf
+	.long	0x46da
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x41c5
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2271
+	.byte	0x6
+	.value	0x1c4
+	.byte	0x37
+	.long	0x521d
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2317
+	.byte	0x6
+	.value	0x474
+	.byte	0x7
+	.long	.LASF2723
+	.long	0x46da
+	.byte	0x1
+	.long	0x4702
+	.long	0x470d
+	.uleb128 0x2
+	.long	0x74a4
+	.uleb128 0x1
+	.long	0x41c5
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2724
+	.byte	0x6
+	.value	0x47e
+	.byte	0x7
+	.long	.LASF2725
+	.byte	0x2
+	.long	0x4723
+	.long	0x472e
+	.uleb128 0x2
+	.long	0x74a4
+	.uleb128 0x1
+	.long	0x41c5
+	.byte	0
+	.uleb128 0x2d
+	.string	"at"
+	.byte	0x6
+	.value	0x495
+	.long	.LASF2726
+	.long	0x46a7
+	.long	0x4745
+	.long	0x4750
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x41c5
+	.byte	0
+	.uleb128 0x2d
+	.string	"at"
+	.byte	0x6
+	.value	0x4a8
+	.long	.LASF2727
+	.long	0x46da
+	.long	0x4767
+	.long	0x4772
+	.uleb128 0x2
+	.long	0x74a4
+	.uleb128 0x1
+	.long	0x41c5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2321
+	.byte	0x6
+	.value	0x4b4
+	.byte	0x7
+	.long	.LASF2728
+	.long	0x46a7
+	.byte	0x1
+	.long	0x478c
+	.long	0x4792
+	.uleb128 0x2
+	.long	0x747c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2321
+	.byte	0x6
+	.value	0x4c0
+	.byte	0x7
+	.long	.LASF2729
+	.long	0x46da
+	.byte	0x1
+	.long	0x47ac
+	.long	0x47b2
+	.uleb128 0x2
+	.long	0x74a4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2323
+	.byte	0x6
+	.value	0x4cc
+	.byte	0x7
+	.long	.LASF2730
+	.long	0x46a7
+	.byte	0x1
+	.long	0x47cc
+	.long	0x47d2
+	.uleb128 0x2
+	.long	0x747c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2323
+	.byte	0x6
+	.value	0x4d8
+	.byte	0x7
+	.long	.LASF2731
+	.long	0x46da
+	.byte	0x1
+	.long	0x47ec
+	.long	0x47f2
+	.uleb128 0x2
+	.long	0x74a4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2325
+	.byte	0x6
+	.value	0x4e7
+	.byte	0x7
+	.long	.LASF2732
+	.long	0x594a
+	.byte	0x1
+	.long	0x480c
+	.long	0x4812
+	.uleb128 0x2
+	.long	0x747c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2325
+	.byte	0x6
+	.value	0x4ec
+	.byte	0x7
+	.long	.LASF2733
+	.long	0x581d
+	.byte	0x1
+	.long	0x482c
+	.long	0x4832
+	.uleb128 0x2
+	.long	0x74a4
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2527
+	.byte	0x6
+	.value	0x4fc
+	.byte	0x7
+	.long	.LASF2734
+	.byte	0x1
+	.long	0x4848
+	.long	0x4853
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x748b
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2527
+	.byte	0x6
+	.value	0x50d
+	.byte	0x7
+	.long	.LASF2735
+	.byte	0x1
+	.long	0x4869
+	.long	0x4874
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x74ae
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2550
+	.byte	0x6
+	.value	0x525
+	.byte	0x7
+	.long	.LASF2736
+	.byte	0x1
+	.long	0x488a
+	.long	0x4890
+	.uleb128 0x2
+	.long	0x747c
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2536
+	.byte	0x9
+	.byte	0x85
+	.byte	0x5
+	.long	.LASF2737
+	.long	0x43f1
+	.byte	0x1
+	.long	0x48a9
+	.long	0x48b9
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x441f
+	.uleb128 0x1
+	.long	0x748b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2536
+	.byte	0x6
+	.value	0x56c
+	.byte	0x7
+	.long	.LASF2738
+	.long	0x43f1
+	.byte	0x1
+	.long	0x48d3
+	.long	0x48e3
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x441f
+	.uleb128 0x1
+	.long	0x74ae
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2536
+	.byte	0x6
+	.value	0x57e
+	.byte	0x7
+	.long	.LASF2739
+	.long	0x43f1
+	.byte	0x1
+	.long	0x48fd
+	.long	0x490d
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x441f
+	.uleb128 0x1
+	.long	0x3adc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2536
+	.byte	0x6
+	.value	0x598
+	.byte	0x7
+	.long	.LASF2740
+	.long	0x43f1
+	.byte	0x1
+	.long	0x4927
+	.long	0x493c
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x441f
+	.uleb128 0x1
+	.long	0x41c5
+	.uleb128 0x1
+	.long	0x748b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2546
+	.byte	0x6
+	.value	0x5f9
+	.byte	0x7
+	.long	.LASF2741
+	.long	0x43f1
+	.byte	0x1
+	.long	0x4956
+	.long	0x4961
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x441f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2546
+	.byte	0x6
+	.value	0x615
+	.byte	0x7
+	.long	.LASF2742
+	.long	0x43f1
+	.byte	0x1
+	.long	0x497b
+	.long	0x498b
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x441f
+	.uleb128 0x1
+	.long	0x441f
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2331
+	.byte	0x6
+	.value	0x62d
+	.byte	0x7
+	.long	.LASF2743
+	.byte	0x1
+	.long	0x49a1
+	.long	0x49ac
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x749f
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2505
+	.byte	0x6
+	.value	0x640
+	.byte	0x7
+	.long	.LASF2744
+	.byte	0x1
+	.long	0x49c2
+	.long	0x49c8
+	.uleb128 0x2
+	.long	0x747c
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2745
+	.byte	0x6
+	.value	0x6a3
+	.byte	0x7
+	.long	.LASF2746
+	.byte	0x2
+	.long	0x49de
+	.long	0x49ee
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x41c5
+	.uleb128 0x1
+	.long	0x748b
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2747
+	.byte	0x6
+	.value	0x6ae
+	.byte	0x7
+	.long	.LASF2748
+	.byte	0x2
+	.long	0x4a04
+	.long	0x4a0f
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x41c5
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2749
+	.byte	0x9
+	.value	0x108
+	.byte	0x5
+	.long	.LASF2750
+	.byte	0x2
+	.long	0x4a25
+	.long	0x4a35
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x123
+	.uleb128 0x1
+	.long	0x748b
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2751
+	.byte	0x9
+	.value	0x20b
+	.byte	0x5
+	.long	.LASF2752
+	.byte	0x2
+	.long	0x4a4b
+	.long	0x4a60
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x43f1
+	.uleb128 0x1
+	.long	0x41c5
+	.uleb128 0x1
+	.long	0x748b
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2753
+	.byte	0x9
+	.value	0x272
+	.byte	0x5
+	.long	.LASF2754
+	.byte	0x2
+	.long	0x4a76
+	.long	0x4a81
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x41c5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2755
+	.byte	0x9
+	.value	0x2bf
+	.byte	0x5
+	.long	.LASF2756
+	.long	0x509b
+	.byte	0x2
+	.long	0x4a9b
+	.long	0x4aa1
+	.uleb128 0x2
+	.long	0x747c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2757
+	.byte	0x9
+	.value	0x15e
+	.byte	0x5
+	.long	.LASF2758
+	.long	0x43f1
+	.byte	0x2
+	.long	0x4abb
+	.long	0x4acb
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x441f
+	.uleb128 0x1
+	.long	0x74ae
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2759
+	.byte	0x6
+	.value	0x75c
+	.byte	0x7
+	.long	.LASF2760
+	.long	0x43f1
+	.byte	0x2
+	.long	0x4ae5
+	.long	0x4af5
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x441f
+	.uleb128 0x1
+	.long	0x74ae
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2761
+	.byte	0x6
+	.value	0x763
+	.byte	0x7
+	.long	.LASF2762
+	.long	0x41c5
+	.byte	0x2
+	.long	0x4b0f
+	.long	0x4b1f
+	.uleb128 0x2
+	.long	0x74a4
+	.uleb128 0x1
+	.long	0x41c5
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x61
+	.long	.LASF2763
+	.value	0x76e
+	.long	.LASF2764
+	.long	0x41c5
+	.long	0x4b3d
+	.uleb128 0x1
+	.long	0x41c5
+	.uleb128 0x1
+	.long	0x7486
+	.byte	0
+	.uleb128 0x61
+	.long	.LASF2765
+	.value	0x777
+	.long	.LASF2766
+	.long	0x41c5
+	.long	0x4b56
+	.uleb128 0x1
+	.long	0x74b3
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2767
+	.byte	0x6
+	.value	0x788
+	.byte	0x7
+	.long	.LASF2768
+	.byte	0x2
+	.long	0x4b6c
+	.long	0x4b77
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x40ae
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2457
+	.byte	0x9
+	.byte	0xaf
+	.byte	0x5
+	.long	.LASF2769
+	.long	0x43f1
+	.byte	0x2
+	.long	0x4b90
+	.long	0x4b9b
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x43f1
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2457
+	.byte	0x9
+	.byte	0xbd
+	.byte	0x5
+	.long	.LASF2770
+	.long	0x43f1
+	.byte	0x2
+	.long	0x4bb4
+	.long	0x4bc4
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x43f1
+	.uleb128 0x1
+	.long	0x43f1
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2771
+	.byte	0x6
+	.value	0x7a2
+	.byte	0x7
+	.long	.LASF2772
+	.long	0x4bd9
+	.long	0x4be9
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x7495
+	.uleb128 0x1
+	.long	0x2c9
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2771
+	.byte	0x6
+	.value	0x7ae
+	.byte	0x7
+	.long	.LASF2773
+	.long	0x4bfe
+	.long	0x4c0e
+	.uleb128 0x2
+	.long	0x747c
+	.uleb128 0x1
+	.long	0x7495
+	.uleb128 0x1
+	.long	0x117
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2774
+	.byte	0x6
+	.value	0x7c1
+	.byte	0x2
+	.long	.LASF2775
+	.long	0x594a
+	.long	0x4c30
+	.long	0x4c3b
+	.uleb128 0x10
+	.string	"_Up"
+	.long	0x5827
+	.uleb128 0x2
+	.long	0x74a4
+	.uleb128 0x1
+	.long	0x594a
+	.byte	0
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x3f
+	.long	.LASF2613
+	.long	0x1457
+	.byte	0
+	.uleb128 0x7
+	.long	0x401e
+	.uleb128 0x5
+	.long	.LASF2776
+	.byte	0xf
+	.byte	0x80
+	.byte	0xb
+	.long	0x4008
+	.uleb128 0x7
+	.long	0x4c53
+	.uleb128 0x32
+	.long	.LASF2777
+	.uleb128 0x32
+	.long	.LASF2778
+	.uleb128 0x19
+	.long	.LASF2779
+	.byte	0x1
+	.byte	0xa
+	.byte	0xd2
+	.byte	0xc
+	.long	0x4cb8
+	.uleb128 0x5
+	.long	.LASF2780
+	.byte	0xa
+	.byte	0xd4
+	.byte	0x2a
+	.long	0x172
+	.uleb128 0x5
+	.long	.LASF2117
+	.byte	0xa
+	.byte	0xd5
+	.byte	0x13
+	.long	0x5827
+	.uleb128 0x5
+	.long	.LASF2781
+	.byte	0xa
+	.byte	0xd6
+	.byte	0x19
+	.long	0x12c3
+	.uleb128 0x5
+	.long	.LASF2265
+	.byte	0xa
+	.byte	0xd7
+	.byte	0x14
+	.long	0x594a
+	.uleb128 0x5
+	.long	.LASF2267
+	.byte	0xa
+	.byte	0xd8
+	.byte	0x14
+	.long	0x6d45
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2782
+	.byte	0x1
+	.byte	0xa
+	.byte	0xdd
+	.byte	0xc
+	.long	0x4cea
+	.uleb128 0x5
+	.long	.LASF2781
+	.byte	0xa
+	.byte	0xe1
+	.byte	0x19
+	.long	0x12c3
+	.uleb128 0x5
+	.long	.LASF2265
+	.byte	0xa
+	.byte	0xe2
+	.byte	0x1a
+	.long	0x581d
+	.uleb128 0x5
+	.long	.LASF2267
+	.byte	0xa
+	.byte	0xe3
+	.byte	0x1a
+	.long	0x6d4a
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF2783
+	.byte	0xf
+	.value	0x8b9
+	.long	0x4d0d
+	.uleb128 0x1d
+	.long	.LASF2671
+	.byte	0xf
+	.value	0x8ba
+	.byte	0x13
+	.long	0x594a
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x594a
+	.byte	0
+	.uleb128 0x82
+	.long	.LASF2784
+	.byte	0x1e
+	.byte	0x34
+	.byte	0x3
+	.long	.LASF2844
+	.uleb128 0x83
+	.long	.LASF2785
+	.byte	0x1e
+	.byte	0x4b
+	.byte	0x3
+	.long	.LASF2786
+	.long	0x4d31
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2787
+	.byte	0x2
+	.value	0x3a2
+	.byte	0x5
+	.long	.LASF2788
+	.long	0x4d5b
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x6d4a
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2789
+	.byte	0x2
+	.value	0x3c7
+	.byte	0x5
+	.long	.LASF2790
+	.long	0x4d8e
+	.uleb128 0xc
+	.long	.LASF2791
+	.long	0x594a
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x6d4a
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2792
+	.byte	0x2
+	.value	0x454
+	.byte	0x5
+	.long	.LASF2793
+	.long	0x594a
+	.long	0x4dd3
+	.uleb128 0xc
+	.long	.LASF2794
+	.long	0x594a
+	.uleb128 0xc
+	.long	.LASF2629
+	.long	0x56db
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x56db
+	.uleb128 0x1
+	.long	0x6d4a
+	.uleb128 0x1
+	.long	0x172
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2795
+	.byte	0x2
+	.value	0x477
+	.byte	0x5
+	.long	.LASF2796
+	.long	0x594a
+	.long	0x4e13
+	.uleb128 0x10
+	.string	"_OI"
+	.long	0x594a
+	.uleb128 0xc
+	.long	.LASF2629
+	.long	0x56db
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x56db
+	.uleb128 0x1
+	.long	0x6d4a
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF2797
+	.byte	0xb
+	.byte	0x6d
+	.byte	0x5
+	.long	.LASF2799
+	.long	0x4e37
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x62
+	.long	.LASF3127
+	.uleb128 0x1
+	.long	0x594a
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2800
+	.byte	0xf
+	.value	0x8c0
+	.byte	0xb
+	.long	0x4cf6
+	.uleb128 0xe
+	.long	.LASF2801
+	.byte	0xc
+	.value	0x44c
+	.byte	0x5
+	.long	.LASF2802
+	.long	0x4e37
+	.long	0x4e80
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x10
+	.string	"_Up"
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x6d59
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2803
+	.byte	0x2
+	.value	0x139
+	.byte	0x5
+	.long	.LASF2804
+	.long	0x594a
+	.long	0x4ea4
+	.uleb128 0xc
+	.long	.LASF2805
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x594a
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2806
+	.byte	0xe
+	.byte	0x31
+	.byte	0x5
+	.long	.LASF2807
+	.long	0x594a
+	.long	0x4ec7
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x6d45
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2808
+	.byte	0xc
+	.value	0x467
+	.byte	0x5
+	.long	.LASF2809
+	.long	0x594a
+	.long	0x4f0c
+	.uleb128 0xc
+	.long	.LASF2810
+	.long	0x594a
+	.uleb128 0xc
+	.long	.LASF2130
+	.long	0x594a
+	.uleb128 0xc
+	.long	.LASF2811
+	.long	0x1457
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x6d59
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2812
+	.byte	0x2
+	.byte	0xfe
+	.byte	0x5
+	.long	.LASF2813
+	.long	0x7a5a
+	.long	0x4f34
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x56db
+	.uleb128 0x1
+	.long	0x7a5a
+	.uleb128 0x1
+	.long	0x7a5a
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2814
+	.byte	0xc
+	.value	0x2b3
+	.byte	0x5
+	.long	.LASF2815
+	.long	0x594a
+	.long	0x4f66
+	.uleb128 0xc
+	.long	.LASF2130
+	.long	0x594a
+	.uleb128 0xc
+	.long	.LASF2629
+	.long	0x56db
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x56db
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2816
+	.byte	0xc
+	.value	0x2fc
+	.byte	0x5
+	.long	.LASF2817
+	.long	0x594a
+	.long	0x4fa6
+	.uleb128 0xc
+	.long	.LASF2130
+	.long	0x594a
+	.uleb128 0xc
+	.long	.LASF2629
+	.long	0x56db
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x56db
+	.uleb128 0x1
+	.long	0x6d59
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF2818
+	.byte	0xb
+	.byte	0xb6
+	.byte	0x5
+	.long	.LASF2819
+	.long	0x4fca
+	.uleb128 0xc
+	.long	.LASF2130
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x594a
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2820
+	.byte	0xa
+	.byte	0xee
+	.byte	0x5
+	.long	.LASF2821
+	.long	0x4c7b
+	.long	0x4fed
+	.uleb128 0xc
+	.long	.LASF2822
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x74e0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2823
+	.byte	0x8
+	.value	0x34f
+	.byte	0x5
+	.long	.LASF2824
+	.long	0x5020
+	.uleb128 0xc
+	.long	.LASF2130
+	.long	0x594a
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x6d59
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2825
+	.byte	0x2
+	.byte	0xe6
+	.byte	0x5
+	.long	.LASF2826
+	.long	0x7a5a
+	.long	0x5048
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x56db
+	.uleb128 0x1
+	.long	0x7a5a
+	.uleb128 0x1
+	.long	0x7a5a
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2827
+	.byte	0x4
+	.byte	0x68
+	.byte	0x3
+	.long	.LASF2828
+	.long	0x33b
+	.long	0x5067
+	.uleb128 0x1
+	.long	0x33b
+	.uleb128 0x1
+	.long	0x309
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2829
+	.byte	0x2
+	.value	0x3f1
+	.byte	0x3
+	.long	.LASF2830
+	.long	0x56db
+	.long	0x5082
+	.uleb128 0x1
+	.long	0x56db
+	.byte	0
+	.uleb128 0x5f
+	.long	.LASF2831
+	.byte	0x1
+	.value	0x204
+	.byte	0x3
+	.long	.LASF2833
+	.long	0x509b
+	.byte	0
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2834
+	.uleb128 0x1a
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2835
+	.uleb128 0x7
+	.long	0x509b
+	.uleb128 0x84
+	.long	.LASF2836
+	.byte	0x1
+	.value	0x14d
+	.byte	0xb
+	.long	0x56cd
+	.uleb128 0x55
+	.long	.LASF2837
+	.byte	0x1f
+	.byte	0x25
+	.byte	0xb
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xc8
+	.byte	0xb
+	.long	0x5811
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xd8
+	.byte	0xb
+	.long	0x5c6d
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xe3
+	.byte	0xb
+	.long	0x5c89
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xe4
+	.byte	0xb
+	.long	0x5c9f
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xe5
+	.byte	0xb
+	.long	0x5cbf
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xe7
+	.byte	0xb
+	.long	0x5cdf
+	.uleb128 0x4
+	.byte	0x11
+	.byte	0xe8
+	.byte	0xb
+	.long	0x5cfa
+	.uleb128 0x85
+	.string	"div"
+	.byte	0x11
+	.byte	0xd5
+	.byte	0x3
+	.long	.LASF3183
+	.long	0x5811
+	.long	0x5115
+	.uleb128 0x1
+	.long	0x5710
+	.uleb128 0x1
+	.long	0x5710
+	.byte	0
+	.uleb128 0x4
+	.byte	0x15
+	.byte	0xfb
+	.byte	0xb
+	.long	0x6cb5
+	.uleb128 0x16
+	.byte	0x15
+	.value	0x104
+	.byte	0xb
+	.long	0x6cd1
+	.uleb128 0x16
+	.byte	0x15
+	.value	0x105
+	.byte	0xb
+	.long	0x6cf2
+	.uleb128 0x19
+	.long	.LASF2838
+	.byte	0x1
+	.byte	0x20
+	.byte	0x30
+	.byte	0xa
+	.long	0x5256
+	.uleb128 0x4
+	.byte	0x20
+	.byte	0x30
+	.byte	0xa
+	.long	0x1f7f
+	.uleb128 0x4
+	.byte	0x20
+	.byte	0x30
+	.byte	0xa
+	.long	0x1f40
+	.uleb128 0x4
+	.byte	0x20
+	.byte	0x30
+	.byte	0xa
+	.long	0x1fb1
+	.uleb128 0x4
+	.byte	0x20
+	.byte	0x30
+	.byte	0xa
+	.long	0x1fd2
+	.uleb128 0x2c
+	.long	0x1f27
+	.uleb128 0x17
+	.long	.LASF2839
+	.byte	0x20
+	.byte	0x61
+	.byte	0x1d
+	.long	.LASF2840
+	.long	0x1457
+	.long	0x517b
+	.uleb128 0x1
+	.long	0x6d54
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF2841
+	.byte	0x20
+	.byte	0x64
+	.byte	0x1b
+	.long	.LASF2842
+	.long	0x5196
+	.uleb128 0x1
+	.long	0x6d59
+	.uleb128 0x1
+	.long	0x6d59
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF2843
+	.byte	0x67
+	.long	.LASF2845
+	.long	0x509b
+	.uleb128 0x3a
+	.long	.LASF2846
+	.byte	0x6a
+	.long	.LASF2847
+	.long	0x509b
+	.uleb128 0x3a
+	.long	.LASF2848
+	.byte	0x6d
+	.long	.LASF2849
+	.long	0x509b
+	.uleb128 0x3a
+	.long	.LASF2850
+	.byte	0x70
+	.long	.LASF2851
+	.long	0x509b
+	.uleb128 0x3a
+	.long	.LASF2852
+	.byte	0x73
+	.long	.LASF2853
+	.long	0x509b
+	.uleb128 0x5
+	.long	.LASF2117
+	.byte	0x20
+	.byte	0x38
+	.byte	0x2d
+	.long	0x2008
+	.uleb128 0x7
+	.long	0x51dc
+	.uleb128 0x5
+	.long	.LASF2265
+	.byte	0x20
+	.byte	0x39
+	.byte	0x2a
+	.long	0x1f33
+	.uleb128 0x5
+	.long	.LASF2268
+	.byte	0x20
+	.byte	0x3a
+	.byte	0x30
+	.long	0x2015
+	.uleb128 0x5
+	.long	.LASF2274
+	.byte	0x20
+	.byte	0x3b
+	.byte	0x2c
+	.long	0x1f72
+	.uleb128 0x5
+	.long	.LASF2267
+	.byte	0x20
+	.byte	0x3e
+	.byte	0x19
+	.long	0x720e
+	.uleb128 0x5
+	.long	.LASF2271
+	.byte	0x20
+	.byte	0x3f
+	.byte	0x1f
+	.long	0x7213
+	.uleb128 0x19
+	.long	.LASF2854
+	.byte	0x1
+	.byte	0x20
+	.byte	0x77
+	.byte	0xe
+	.long	0x524c
+	.uleb128 0x5
+	.long	.LASF2855
+	.byte	0x20
+	.byte	0x78
+	.byte	0x41
+	.long	0x2022
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2613
+	.long	0x1457
+	.byte	0
+	.uleb128 0x4b
+	.long	.LASF2856
+	.byte	0x8
+	.byte	0x21
+	.value	0x413
+	.long	0x5487
+	.uleb128 0x63
+	.long	.LASF2879
+	.long	0x594a
+	.uleb128 0xb
+	.long	.LASF2857
+	.byte	0x21
+	.value	0x42c
+	.byte	0x11
+	.long	.LASF2858
+	.byte	0x1
+	.long	0x5282
+	.long	0x5288
+	.uleb128 0x2
+	.long	0x74f9
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF2857
+	.byte	0x21
+	.value	0x430
+	.long	.LASF2859
+	.long	0x529c
+	.long	0x52a7
+	.uleb128 0x2
+	.long	0x74f9
+	.uleb128 0x1
+	.long	0x74e0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2267
+	.byte	0x21
+	.value	0x425
+	.byte	0x31
+	.long	0x4cab
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2860
+	.byte	0x21
+	.value	0x447
+	.byte	0x7
+	.long	.LASF2861
+	.long	0x52a7
+	.byte	0x1
+	.long	0x52cf
+	.long	0x52d5
+	.uleb128 0x2
+	.long	0x74fe
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2265
+	.byte	0x21
+	.value	0x426
+	.byte	0x2f
+	.long	0x4c9f
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2862
+	.byte	0x21
+	.value	0x44c
+	.byte	0x7
+	.long	.LASF2863
+	.long	0x52d5
+	.byte	0x1
+	.long	0x52fd
+	.long	0x5303
+	.uleb128 0x2
+	.long	0x74fe
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2157
+	.byte	0x21
+	.value	0x451
+	.byte	0x7
+	.long	.LASF2864
+	.long	0x7503
+	.byte	0x1
+	.long	0x531d
+	.long	0x5323
+	.uleb128 0x2
+	.long	0x74f9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2157
+	.byte	0x21
+	.value	0x459
+	.byte	0x7
+	.long	.LASF2865
+	.long	0x5256
+	.byte	0x1
+	.long	0x533d
+	.long	0x5348
+	.uleb128 0x2
+	.long	0x74f9
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2160
+	.byte	0x21
+	.value	0x45f
+	.byte	0x7
+	.long	.LASF2866
+	.long	0x7503
+	.byte	0x1
+	.long	0x5362
+	.long	0x5368
+	.uleb128 0x2
+	.long	0x74f9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2160
+	.byte	0x21
+	.value	0x467
+	.byte	0x7
+	.long	.LASF2867
+	.long	0x5256
+	.byte	0x1
+	.long	0x5382
+	.long	0x538d
+	.uleb128 0x2
+	.long	0x74f9
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2317
+	.byte	0x21
+	.value	0x46d
+	.byte	0x7
+	.long	.LASF2868
+	.long	0x52a7
+	.byte	0x1
+	.long	0x53a7
+	.long	0x53b2
+	.uleb128 0x2
+	.long	0x74fe
+	.uleb128 0x1
+	.long	0x53b2
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2781
+	.byte	0x21
+	.value	0x424
+	.byte	0x37
+	.long	0x4c93
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2167
+	.byte	0x21
+	.value	0x472
+	.byte	0x7
+	.long	.LASF2869
+	.long	0x7503
+	.byte	0x1
+	.long	0x53da
+	.long	0x53e5
+	.uleb128 0x2
+	.long	0x74f9
+	.uleb128 0x1
+	.long	0x53b2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2870
+	.byte	0x21
+	.value	0x477
+	.byte	0x7
+	.long	.LASF2871
+	.long	0x5256
+	.byte	0x1
+	.long	0x53ff
+	.long	0x540a
+	.uleb128 0x2
+	.long	0x74fe
+	.uleb128 0x1
+	.long	0x53b2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2170
+	.byte	0x21
+	.value	0x47c
+	.byte	0x7
+	.long	.LASF2872
+	.long	0x7503
+	.byte	0x1
+	.long	0x5424
+	.long	0x542f
+	.uleb128 0x2
+	.long	0x74f9
+	.uleb128 0x1
+	.long	0x53b2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2873
+	.byte	0x21
+	.value	0x481
+	.byte	0x7
+	.long	.LASF2874
+	.long	0x5256
+	.byte	0x1
+	.long	0x5449
+	.long	0x5454
+	.uleb128 0x2
+	.long	0x74fe
+	.uleb128 0x1
+	.long	0x53b2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2875
+	.byte	0x21
+	.value	0x486
+	.byte	0x7
+	.long	.LASF2876
+	.long	0x74e0
+	.byte	0x1
+	.long	0x546e
+	.long	0x5474
+	.uleb128 0x2
+	.long	0x74fe
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2805
+	.long	0x594a
+	.uleb128 0xc
+	.long	.LASF2877
+	.long	0x203d
+	.byte	0
+	.uleb128 0x7
+	.long	0x5256
+	.uleb128 0x4b
+	.long	.LASF2878
+	.byte	0x8
+	.byte	0x21
+	.value	0x413
+	.long	0x56bd
+	.uleb128 0x63
+	.long	.LASF2879
+	.long	0x581d
+	.uleb128 0xb
+	.long	.LASF2857
+	.byte	0x21
+	.value	0x42c
+	.byte	0x11
+	.long	.LASF2880
+	.byte	0x1
+	.long	0x54b8
+	.long	0x54be
+	.uleb128 0x2
+	.long	0x74e5
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF2857
+	.byte	0x21
+	.value	0x430
+	.long	.LASF2881
+	.long	0x54d2
+	.long	0x54dd
+	.uleb128 0x2
+	.long	0x74e5
+	.uleb128 0x1
+	.long	0x74ea
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2267
+	.byte	0x21
+	.value	0x425
+	.byte	0x31
+	.long	0x4cdd
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2860
+	.byte	0x21
+	.value	0x447
+	.byte	0x7
+	.long	.LASF2882
+	.long	0x54dd
+	.byte	0x1
+	.long	0x5505
+	.long	0x550b
+	.uleb128 0x2
+	.long	0x74ef
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2265
+	.byte	0x21
+	.value	0x426
+	.byte	0x2f
+	.long	0x4cd1
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2862
+	.byte	0x21
+	.value	0x44c
+	.byte	0x7
+	.long	.LASF2883
+	.long	0x550b
+	.byte	0x1
+	.long	0x5533
+	.long	0x5539
+	.uleb128 0x2
+	.long	0x74ef
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2157
+	.byte	0x21
+	.value	0x451
+	.byte	0x7
+	.long	.LASF2884
+	.long	0x74f4
+	.byte	0x1
+	.long	0x5553
+	.long	0x5559
+	.uleb128 0x2
+	.long	0x74e5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2157
+	.byte	0x21
+	.value	0x459
+	.byte	0x7
+	.long	.LASF2885
+	.long	0x548c
+	.byte	0x1
+	.long	0x5573
+	.long	0x557e
+	.uleb128 0x2
+	.long	0x74e5
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2160
+	.byte	0x21
+	.value	0x45f
+	.byte	0x7
+	.long	.LASF2886
+	.long	0x74f4
+	.byte	0x1
+	.long	0x5598
+	.long	0x559e
+	.uleb128 0x2
+	.long	0x74e5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2160
+	.byte	0x21
+	.value	0x467
+	.byte	0x7
+	.long	.LASF2887
+	.long	0x548c
+	.byte	0x1
+	.long	0x55b8
+	.long	0x55c3
+	.uleb128 0x2
+	.long	0x74e5
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2317
+	.byte	0x21
+	.value	0x46d
+	.byte	0x7
+	.long	.LASF2888
+	.long	0x54dd
+	.byte	0x1
+	.long	0x55dd
+	.long	0x55e8
+	.uleb128 0x2
+	.long	0x74ef
+	.uleb128 0x1
+	.long	0x55e8
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2781
+	.byte	0x21
+	.value	0x424
+	.byte	0x37
+	.long	0x4cc5
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2167
+	.byte	0x21
+	.value	0x472
+	.byte	0x7
+	.long	.LASF2889
+	.long	0x74f4
+	.byte	0x1
+	.long	0x5610
+	.long	0x561b
+	.uleb128 0x2
+	.long	0x74e5
+	.uleb128 0x1
+	.long	0x55e8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2870
+	.byte	0x21
+	.value	0x477
+	.byte	0x7
+	.long	.LASF2890
+	.long	0x548c
+	.byte	0x1
+	.long	0x5635
+	.long	0x5640
+	.uleb128 0x2
+	.long	0x74ef
+	.uleb128 0x1
+	.long	0x55e8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2170
+	.byte	0x21
+	.value	0x47c
+	.byte	0x7
+	.long	.LASF2891
+	.long	0x74f4
+	.byte	0x1
+	.long	0x565a
+	.long	0x5665
+	.uleb128 0x2
+	.long	0x74e5
+	.uleb128 0x1
+	.long	0x55e8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2873
+	.byte	0x21
+	.value	0x481
+	.byte	0x7
+	.long	.LASF2892
+	.long	0x548c
+	.byte	0x1
+	.long	0x567f
+	.long	0x568a
+	.uleb128 0x2
+	.long	0x74ef
+	.uleb128 0x1
+	.long	0x55e8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2875
+	.byte	0x21
+	.value	0x486
+	.byte	0x7
+	.long	.LASF2893
+	.long	0x74ea
+	.byte	0x1
+	.long	0x56a4
+	.long	0x56aa
+	.uleb128 0x2
+	.long	0x74ef
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2805
+	.long	0x581d
+	.uleb128 0xc
+	.long	.LASF2877
+	.long	0x203d
+	.byte	0
+	.uleb128 0x7
+	.long	0x548c
+	.uleb128 0x32
+	.long	.LASF2894
+	.uleb128 0x32
+	.long	.LASF2895
+	.byte	0
+	.uleb128 0x1a
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2896
+	.uleb128 0x1a
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2897
+	.uleb128 0x1a
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2898
+	.uleb128 0x7
+	.long	0x56db
+	.uleb128 0x1a
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2899
+	.uleb128 0x1a
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2900
+	.uleb128 0x1a
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2901
+	.uleb128 0x86
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.long	0x56fc
+	.uleb128 0x1a
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2902
+	.uleb128 0x1a
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2903
+	.uleb128 0x1a
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF2904
+	.uleb128 0x1a
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2905
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2906
+	.uleb128 0x8
+	.long	0xa4
+	.uleb128 0x8
+	.long	0x112
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.long	.LASF2907
+	.uleb128 0x7
+	.long	0x5736
+	.uleb128 0x1a
+	.byte	0x2
+	.byte	0x10
+	.long	.LASF2908
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x10
+	.long	.LASF2909
+	.uleb128 0x4c
+	.long	.LASF2910
+	.byte	0x10
+	.byte	0x38
+	.long	0x5765
+	.uleb128 0x87
+	.byte	0x10
+	.byte	0x3a
+	.byte	0x18
+	.long	0x185
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2122
+	.byte	0x22
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x56db
+	.uleb128 0x7
+	.long	0x5765
+	.uleb128 0x1a
+	.byte	0x20
+	.byte	0x3
+	.long	.LASF2911
+	.uleb128 0x1a
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF2912
+	.uleb128 0x42
+	.byte	0x8
+	.byte	0x23
+	.byte	0x3c
+	.byte	0x3
+	.long	.LASF2915
+	.long	0x57ab
+	.uleb128 0x6
+	.long	.LASF2913
+	.byte	0x23
+	.byte	0x3d
+	.byte	0x9
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x4d
+	.string	"rem"
+	.byte	0x3e
+	.byte	0x9
+	.long	0x56fc
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2914
+	.byte	0x23
+	.byte	0x3f
+	.byte	0x5
+	.long	0x5784
+	.uleb128 0x42
+	.byte	0x10
+	.byte	0x23
+	.byte	0x44
+	.byte	0x3
+	.long	.LASF2916
+	.long	0x57de
+	.uleb128 0x6
+	.long	.LASF2913
+	.byte	0x23
+	.byte	0x45
+	.byte	0xe
+	.long	0x5709
+	.byte	0
+	.uleb128 0x4d
+	.string	"rem"
+	.byte	0x46
+	.byte	0xe
+	.long	0x5709
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2917
+	.byte	0x23
+	.byte	0x47
+	.byte	0x5
+	.long	0x57b7
+	.uleb128 0x42
+	.byte	0x10
+	.byte	0x23
+	.byte	0x4e
+	.byte	0x3
+	.long	.LASF2918
+	.long	0x5811
+	.uleb128 0x6
+	.long	.LASF2913
+	.byte	0x23
+	.byte	0x4f
+	.byte	0x13
+	.long	0x5710
+	.byte	0
+	.uleb128 0x4d
+	.string	"rem"
+	.byte	0x50
+	.byte	0x13
+	.long	0x5710
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2919
+	.byte	0x23
+	.byte	0x51
+	.byte	0x5
+	.long	0x57ea
+	.uleb128 0x8
+	.long	0x582e
+	.uleb128 0x7
+	.long	0x581d
+	.uleb128 0x1a
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2920
+	.uleb128 0x7
+	.long	0x5827
+	.uleb128 0x5
+	.long	.LASF2921
+	.byte	0x24
+	.byte	0x25
+	.byte	0x15
+	.long	0x56ee
+	.uleb128 0x5
+	.long	.LASF2922
+	.byte	0x24
+	.byte	0x26
+	.byte	0x17
+	.long	0x56cd
+	.uleb128 0x5
+	.long	.LASF2923
+	.byte	0x24
+	.byte	0x27
+	.byte	0x1a
+	.long	0x56f5
+	.uleb128 0x5
+	.long	.LASF2924
+	.byte	0x24
+	.byte	0x28
+	.byte	0x1c
+	.long	0x56d4
+	.uleb128 0x5
+	.long	.LASF2925
+	.byte	0x24
+	.byte	0x29
+	.byte	0x14
+	.long	0x56fc
+	.uleb128 0x5
+	.long	.LASF2926
+	.byte	0x24
+	.byte	0x2a
+	.byte	0x16
+	.long	0x5094
+	.uleb128 0x5
+	.long	.LASF2927
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x19
+	.long	0x5709
+	.uleb128 0x5
+	.long	.LASF2928
+	.byte	0x24
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x56db
+	.uleb128 0x5
+	.long	.LASF2929
+	.byte	0x24
+	.byte	0x34
+	.byte	0x12
+	.long	0x5833
+	.uleb128 0x5
+	.long	.LASF2930
+	.byte	0x24
+	.byte	0x35
+	.byte	0x13
+	.long	0x583f
+	.uleb128 0x5
+	.long	.LASF2931
+	.byte	0x24
+	.byte	0x36
+	.byte	0x13
+	.long	0x584b
+	.uleb128 0x5
+	.long	.LASF2932
+	.byte	0x24
+	.byte	0x37
+	.byte	0x14
+	.long	0x5857
+	.uleb128 0x5
+	.long	.LASF2933
+	.byte	0x24
+	.byte	0x38
+	.byte	0x13
+	.long	0x5863
+	.uleb128 0x5
+	.long	.LASF2934
+	.byte	0x24
+	.byte	0x39
+	.byte	0x14
+	.long	0x586f
+	.uleb128 0x5
+	.long	.LASF2935
+	.byte	0x24
+	.byte	0x3a
+	.byte	0x13
+	.long	0x587b
+	.uleb128 0x5
+	.long	.LASF2936
+	.byte	0x24
+	.byte	0x3b
+	.byte	0x14
+	.long	0x5887
+	.uleb128 0x5
+	.long	.LASF2937
+	.byte	0x24
+	.byte	0x48
+	.byte	0x12
+	.long	0x5709
+	.uleb128 0x5
+	.long	.LASF2938
+	.byte	0x24
+	.byte	0x49
+	.byte	0x1b
+	.long	0x56db
+	.uleb128 0x5
+	.long	.LASF2939
+	.byte	0x24
+	.byte	0x98
+	.byte	0x12
+	.long	0x5709
+	.uleb128 0x5
+	.long	.LASF2940
+	.byte	0x24
+	.byte	0x99
+	.byte	0x12
+	.long	0x5709
+	.uleb128 0x5
+	.long	.LASF2941
+	.byte	0x24
+	.byte	0x9c
+	.byte	0x12
+	.long	0x5709
+	.uleb128 0x5
+	.long	.LASF2942
+	.byte	0x24
+	.byte	0xa0
+	.byte	0x12
+	.long	0x5709
+	.uleb128 0x88
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF2943
+	.byte	0x24
+	.byte	0xc5
+	.byte	0x12
+	.long	0x5709
+	.uleb128 0x8
+	.long	0x5827
+	.uleb128 0x7
+	.long	0x594a
+	.uleb128 0x5
+	.long	.LASF2944
+	.byte	0x25
+	.byte	0x7
+	.byte	0x13
+	.long	0x5923
+	.uleb128 0x5
+	.long	.LASF2945
+	.byte	0x26
+	.byte	0xa
+	.byte	0x12
+	.long	0x592f
+	.uleb128 0x7
+	.long	0x5960
+	.uleb128 0x5
+	.long	.LASF2946
+	.byte	0x27
+	.byte	0x18
+	.byte	0x12
+	.long	0x5833
+	.uleb128 0x5
+	.long	.LASF2947
+	.byte	0x27
+	.byte	0x19
+	.byte	0x13
+	.long	0x584b
+	.uleb128 0x5
+	.long	.LASF2948
+	.byte	0x27
+	.byte	0x1a
+	.byte	0x13
+	.long	0x5863
+	.uleb128 0x5
+	.long	.LASF2949
+	.byte	0x27
+	.byte	0x1b
+	.byte	0x13
+	.long	0x587b
+	.uleb128 0x19
+	.long	.LASF2950
+	.byte	0x10
+	.byte	0x28
+	.byte	0xb
+	.byte	0x8
+	.long	0x59c9
+	.uleb128 0x6
+	.long	.LASF2951
+	.byte	0x28
+	.byte	0x10
+	.byte	0xc
+	.long	0x592f
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2952
+	.byte	0x28
+	.byte	0x15
+	.byte	0x15
+	.long	0x593e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x43
+	.long	0x5827
+	.long	0x59d9
+	.uleb128 0x44
+	.long	0x56db
+	.byte	0x3
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2953
+	.byte	0x23
+	.value	0x33d
+	.byte	0xf
+	.long	0x59e6
+	.uleb128 0x8
+	.long	0x59eb
+	.uleb128 0x89
+	.long	0x56fc
+	.long	0x5a00
+	.uleb128 0x1
+	.long	0x5a00
+	.uleb128 0x1
+	.long	0x5a00
+	.byte	0
+	.uleb128 0x8
+	.long	0x5a05
+	.uleb128 0x8a
+	.uleb128 0x9
+	.long	.LASF1404
+	.byte	0x23
+	.value	0x267
+	.byte	0xc
+	.long	0x56fc
+	.long	0x5a1e
+	.uleb128 0x1
+	.long	0x5a1e
+	.byte	0
+	.uleb128 0x8
+	.long	0x5a23
+	.uleb128 0x8b
+	.uleb128 0xe
+	.long	.LASF1405
+	.byte	0x23
+	.value	0x26c
+	.byte	0x12
+	.long	.LASF1405
+	.long	0x56fc
+	.long	0x5a40
+	.uleb128 0x1
+	.long	0x5a1e
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1406
+	.byte	0x23
+	.byte	0x66
+	.byte	0xf
+	.long	0x571e
+	.long	0x5a56
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1407
+	.byte	0x23
+	.byte	0x69
+	.byte	0xc
+	.long	0x56fc
+	.long	0x5a6c
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1408
+	.byte	0x23
+	.byte	0x6c
+	.byte	0x11
+	.long	0x5709
+	.long	0x5a82
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1409
+	.byte	0x23
+	.value	0x349
+	.byte	0xe
+	.long	0x593b
+	.long	0x5aad
+	.uleb128 0x1
+	.long	0x5a00
+	.uleb128 0x1
+	.long	0x5a00
+	.uleb128 0x1
+	.long	0x5765
+	.uleb128 0x1
+	.long	0x5765
+	.uleb128 0x1
+	.long	0x59d9
+	.byte	0
+	.uleb128 0x8c
+	.string	"div"
+	.byte	0x23
+	.value	0x369
+	.byte	0xe
+	.long	0x57ab
+	.long	0x5aca
+	.uleb128 0x1
+	.long	0x56fc
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1413
+	.byte	0x23
+	.value	0x28e
+	.byte	0xe
+	.long	0x594a
+	.long	0x5ae1
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1415
+	.byte	0x23
+	.value	0x36b
+	.byte	0xf
+	.long	0x57de
+	.long	0x5afd
+	.uleb128 0x1
+	.long	0x5709
+	.uleb128 0x1
+	.long	0x5709
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1417
+	.byte	0x23
+	.value	0x3af
+	.byte	0xc
+	.long	0x56fc
+	.long	0x5b19
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1418
+	.byte	0x23
+	.value	0x3ba
+	.byte	0xf
+	.long	0x5765
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x8
+	.long	0x5736
+	.uleb128 0x9
+	.long	.LASF1419
+	.byte	0x23
+	.value	0x3b2
+	.byte	0xc
+	.long	0x56fc
+	.long	0x5b60
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF1420
+	.byte	0x23
+	.value	0x353
+	.long	0x5b81
+	.uleb128 0x1
+	.long	0x593b
+	.uleb128 0x1
+	.long	0x5765
+	.uleb128 0x1
+	.long	0x5765
+	.uleb128 0x1
+	.long	0x59d9
+	.byte	0
+	.uleb128 0x8d
+	.long	.LASF1421
+	.byte	0x23
+	.value	0x283
+	.byte	0xd
+	.long	0x5b95
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF1422
+	.byte	0x23
+	.value	0x1c6
+	.byte	0xc
+	.long	0x56fc
+	.uleb128 0x36
+	.long	.LASF1424
+	.byte	0x23
+	.value	0x1c8
+	.long	0x5bb4
+	.uleb128 0x1
+	.long	0x5094
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1425
+	.byte	0x23
+	.byte	0x76
+	.byte	0xf
+	.long	0x571e
+	.long	0x5bcf
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x5bcf
+	.byte	0
+	.uleb128 0x8
+	.long	0x594a
+	.uleb128 0xf
+	.long	.LASF1426
+	.byte	0x23
+	.byte	0xb1
+	.byte	0x11
+	.long	0x5709
+	.long	0x5bf4
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x5bcf
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1427
+	.byte	0x23
+	.byte	0xb5
+	.byte	0x1a
+	.long	0x56db
+	.long	0x5c14
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x5bcf
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1428
+	.byte	0x23
+	.value	0x324
+	.byte	0xc
+	.long	0x56fc
+	.long	0x5c2b
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1429
+	.byte	0x23
+	.value	0x3be
+	.byte	0xf
+	.long	0x5765
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x8
+	.long	0x573d
+	.uleb128 0x9
+	.long	.LASF1430
+	.byte	0x23
+	.value	0x3b6
+	.byte	0xc
+	.long	0x56fc
+	.long	0x5c6d
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x5736
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1433
+	.byte	0x23
+	.value	0x36f
+	.byte	0x1e
+	.long	0x5811
+	.long	0x5c89
+	.uleb128 0x1
+	.long	0x5710
+	.uleb128 0x1
+	.long	0x5710
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1434
+	.byte	0x23
+	.byte	0x71
+	.byte	0x24
+	.long	0x5710
+	.long	0x5c9f
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1435
+	.byte	0x23
+	.byte	0xc9
+	.byte	0x16
+	.long	0x5710
+	.long	0x5cbf
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x5bcf
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1436
+	.byte	0x23
+	.byte	0xce
+	.byte	0x1f
+	.long	0x56e7
+	.long	0x5cdf
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x5bcf
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1437
+	.byte	0x23
+	.byte	0x7c
+	.byte	0xe
+	.long	0x5725
+	.long	0x5cfa
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x5bcf
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1438
+	.byte	0x23
+	.byte	0x7f
+	.byte	0x14
+	.long	0x5717
+	.long	0x5d15
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x5bcf
+	.byte	0
+	.uleb128 0x4c
+	.long	.LASF2955
+	.byte	0x29
+	.byte	0xf
+	.long	0x5e5c
+	.uleb128 0x8e
+	.long	.LASF3184
+	.byte	0x29
+	.byte	0x11
+	.byte	0xb
+	.uleb128 0x8f
+	.string	"v1"
+	.byte	0x29
+	.byte	0x13
+	.byte	0x12
+	.uleb128 0x2a
+	.long	.LASF2956
+	.byte	0x1
+	.byte	0x29
+	.byte	0x17
+	.byte	0x7
+	.long	0x5d69
+	.uleb128 0x23
+	.long	.LASF2957
+	.byte	0x1c
+	.long	.LASF2959
+	.long	0x117
+	.uleb128 0x23
+	.long	.LASF2958
+	.byte	0x21
+	.long	.LASF2960
+	.long	0x117
+	.uleb128 0x23
+	.long	.LASF2961
+	.byte	0x26
+	.long	.LASF2962
+	.long	0x117
+	.byte	0
+	.uleb128 0x7
+	.long	0x5d31
+	.uleb128 0x2a
+	.long	.LASF2963
+	.byte	0x1
+	.byte	0x29
+	.byte	0x2d
+	.byte	0x7
+	.long	0x5da6
+	.uleb128 0x23
+	.long	.LASF2957
+	.byte	0x32
+	.long	.LASF2964
+	.long	0x117
+	.uleb128 0x23
+	.long	.LASF2958
+	.byte	0x37
+	.long	.LASF2965
+	.long	0x117
+	.uleb128 0x23
+	.long	.LASF2961
+	.byte	0x3c
+	.long	.LASF2966
+	.long	0x2c9
+	.byte	0
+	.uleb128 0x7
+	.long	0x5d6e
+	.uleb128 0x2a
+	.long	.LASF2967
+	.byte	0x1
+	.byte	0x29
+	.byte	0x43
+	.byte	0x7
+	.long	0x5de3
+	.uleb128 0x23
+	.long	.LASF2957
+	.byte	0x48
+	.long	.LASF2968
+	.long	0x2c9
+	.uleb128 0x23
+	.long	.LASF2958
+	.byte	0x4d
+	.long	.LASF2969
+	.long	0x2c9
+	.uleb128 0x23
+	.long	.LASF2961
+	.byte	0x52
+	.long	.LASF2970
+	.long	0x2c9
+	.byte	0
+	.uleb128 0x7
+	.long	0x5dab
+	.uleb128 0x2a
+	.long	.LASF2971
+	.byte	0x1
+	.byte	0x29
+	.byte	0x58
+	.byte	0x7
+	.long	0x5e20
+	.uleb128 0x23
+	.long	.LASF2957
+	.byte	0x5d
+	.long	.LASF2972
+	.long	0x2c9
+	.uleb128 0x23
+	.long	.LASF2958
+	.byte	0x62
+	.long	.LASF2973
+	.long	0x2c9
+	.uleb128 0x23
+	.long	.LASF2961
+	.byte	0x67
+	.long	.LASF2974
+	.long	0x117
+	.byte	0
+	.uleb128 0x7
+	.long	0x5de8
+	.uleb128 0x64
+	.string	"seq"
+	.byte	0x6e
+	.byte	0x1c
+	.long	0x5d69
+	.byte	0x1
+	.byte	0
+	.uleb128 0x64
+	.string	"par"
+	.byte	0x6f
+	.byte	0x1b
+	.long	0x5da6
+	.byte	0x1
+	.byte	0
+	.uleb128 0x65
+	.long	.LASF2975
+	.byte	0x70
+	.byte	0x27
+	.long	0x5de3
+	.byte	0x1
+	.byte	0
+	.uleb128 0x65
+	.long	.LASF2976
+	.byte	0x71
+	.byte	0x1e
+	.long	0x5e20
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.long	0x5e25
+	.uleb128 0x45
+	.long	0x5e32
+	.uleb128 0x45
+	.long	0x5e3f
+	.uleb128 0x45
+	.long	0x5e4c
+	.uleb128 0x5
+	.long	.LASF2977
+	.byte	0x2a
+	.byte	0x18
+	.byte	0x13
+	.long	0x583f
+	.uleb128 0x5
+	.long	.LASF2978
+	.byte	0x2a
+	.byte	0x19
+	.byte	0x14
+	.long	0x5857
+	.uleb128 0x5
+	.long	.LASF2979
+	.byte	0x2a
+	.byte	0x1a
+	.byte	0x14
+	.long	0x586f
+	.uleb128 0x7
+	.long	0x5e88
+	.uleb128 0x5
+	.long	.LASF2980
+	.byte	0x2a
+	.byte	0x1b
+	.byte	0x14
+	.long	0x5887
+	.uleb128 0x7
+	.long	0x5e99
+	.uleb128 0x5
+	.long	.LASF2981
+	.byte	0x2b
+	.byte	0x2b
+	.byte	0x18
+	.long	0x5893
+	.uleb128 0x5
+	.long	.LASF2982
+	.byte	0x2b
+	.byte	0x2c
+	.byte	0x19
+	.long	0x58ab
+	.uleb128 0x5
+	.long	.LASF2983
+	.byte	0x2b
+	.byte	0x2d
+	.byte	0x19
+	.long	0x58c3
+	.uleb128 0x5
+	.long	.LASF2984
+	.byte	0x2b
+	.byte	0x2e
+	.byte	0x19
+	.long	0x58db
+	.uleb128 0x5
+	.long	.LASF2985
+	.byte	0x2b
+	.byte	0x31
+	.byte	0x19
+	.long	0x589f
+	.uleb128 0x5
+	.long	.LASF2986
+	.byte	0x2b
+	.byte	0x32
+	.byte	0x1a
+	.long	0x58b7
+	.uleb128 0x5
+	.long	.LASF2987
+	.byte	0x2b
+	.byte	0x33
+	.byte	0x1a
+	.long	0x58cf
+	.uleb128 0x5
+	.long	.LASF2988
+	.byte	0x2b
+	.byte	0x34
+	.byte	0x1a
+	.long	0x58e7
+	.uleb128 0x5
+	.long	.LASF2989
+	.byte	0x2b
+	.byte	0x3a
+	.byte	0x15
+	.long	0x56ee
+	.uleb128 0x5
+	.long	.LASF2990
+	.byte	0x2b
+	.byte	0x3c
+	.byte	0x12
+	.long	0x5709
+	.uleb128 0x5
+	.long	.LASF2991
+	.byte	0x2b
+	.byte	0x3d
+	.byte	0x12
+	.long	0x5709
+	.uleb128 0x5
+	.long	.LASF2992
+	.byte	0x2b
+	.byte	0x3e
+	.byte	0x12
+	.long	0x5709
+	.uleb128 0x5
+	.long	.LASF2993
+	.byte	0x2b
+	.byte	0x47
+	.byte	0x17
+	.long	0x56cd
+	.uleb128 0x5
+	.long	.LASF2994
+	.byte	0x2b
+	.byte	0x49
+	.byte	0x1b
+	.long	0x56db
+	.uleb128 0x5
+	.long	.LASF2995
+	.byte	0x2b
+	.byte	0x4a
+	.byte	0x1b
+	.long	0x56db
+	.uleb128 0x5
+	.long	.LASF2996
+	.byte	0x2b
+	.byte	0x4b
+	.byte	0x1b
+	.long	0x56db
+	.uleb128 0x5
+	.long	.LASF2997
+	.byte	0x2b
+	.byte	0x57
+	.byte	0x12
+	.long	0x5709
+	.uleb128 0x5
+	.long	.LASF2998
+	.byte	0x2b
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x56db
+	.uleb128 0x5
+	.long	.LASF2999
+	.byte	0x2b
+	.byte	0x65
+	.byte	0x14
+	.long	0x58f3
+	.uleb128 0x5
+	.long	.LASF3000
+	.byte	0x2b
+	.byte	0x66
+	.byte	0x15
+	.long	0x58ff
+	.uleb128 0x8
+	.long	0x347
+	.uleb128 0x7
+	.long	0x5f9a
+	.uleb128 0xd
+	.long	0xb89
+	.uleb128 0xd
+	.long	0x347
+	.uleb128 0x8
+	.long	0xb8e
+	.uleb128 0x8
+	.long	0xb89
+	.uleb128 0x7
+	.long	0x5fb3
+	.uleb128 0x8
+	.long	0xb93
+	.uleb128 0xd
+	.long	0x367
+	.uleb128 0x8
+	.long	0xb98
+	.uleb128 0x7
+	.long	0x5fc7
+	.uleb128 0xd
+	.long	0xcc9
+	.uleb128 0xd
+	.long	0xb98
+	.uleb128 0x8
+	.long	0xcce
+	.uleb128 0x17
+	.long	.LASF1577
+	.byte	0x2c
+	.byte	0x59
+	.byte	0x14
+	.long	.LASF1577
+	.long	0x5a00
+	.long	0x6004
+	.uleb128 0x1
+	.long	0x5a00
+	.uleb128 0x1
+	.long	0x56fc
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1577
+	.byte	0x2c
+	.byte	0x57
+	.byte	0xe
+	.long	.LASF1577
+	.long	0x593b
+	.long	0x6028
+	.uleb128 0x1
+	.long	0x593b
+	.uleb128 0x1
+	.long	0x56fc
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1585
+	.byte	0x2c
+	.byte	0xa3
+	.byte	0xc
+	.long	0x56fc
+	.long	0x6043
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1588
+	.byte	0x2c
+	.value	0x1a3
+	.byte	0xe
+	.long	0x594a
+	.long	0x605a
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1597
+	.byte	0x2c
+	.value	0x164
+	.byte	0xe
+	.long	0x594a
+	.long	0x6076
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1598
+	.byte	0x2c
+	.byte	0xa6
+	.byte	0xf
+	.long	0x5765
+	.long	0x6096
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1583
+	.byte	0x2c
+	.byte	0xe4
+	.byte	0x14
+	.long	.LASF1583
+	.long	0x581d
+	.long	0x60b5
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1583
+	.byte	0x2c
+	.byte	0xe2
+	.byte	0xe
+	.long	.LASF1583
+	.long	0x594a
+	.long	0x60d4
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1593
+	.byte	0x2c
+	.value	0x131
+	.byte	0x14
+	.long	.LASF1593
+	.long	0x581d
+	.long	0x60f4
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1593
+	.byte	0x2c
+	.value	0x12f
+	.byte	0xe
+	.long	.LASF1593
+	.long	0x594a
+	.long	0x6114
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1594
+	.byte	0x2c
+	.byte	0xff
+	.byte	0x14
+	.long	.LASF1594
+	.long	0x581d
+	.long	0x6133
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1594
+	.byte	0x2c
+	.byte	0xfd
+	.byte	0xe
+	.long	.LASF1594
+	.long	0x594a
+	.long	0x6152
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1596
+	.byte	0x2c
+	.value	0x14c
+	.byte	0x14
+	.long	.LASF1596
+	.long	0x581d
+	.long	0x6172
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1596
+	.byte	0x2c
+	.value	0x14a
+	.byte	0xe
+	.long	.LASF1596
+	.long	0x594a
+	.long	0x6192
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x90
+	.string	"tm"
+	.byte	0x38
+	.byte	0x2d
+	.byte	0x7
+	.byte	0x8
+	.long	0x622f
+	.uleb128 0x6
+	.long	.LASF3001
+	.byte	0x2d
+	.byte	0x9
+	.byte	0x7
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3002
+	.byte	0x2d
+	.byte	0xa
+	.byte	0x7
+	.long	0x56fc
+	.byte	0x4
+	.uleb128 0x6
+	.long	.LASF3003
+	.byte	0x2d
+	.byte	0xb
+	.byte	0x7
+	.long	0x56fc
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF3004
+	.byte	0x2d
+	.byte	0xc
+	.byte	0x7
+	.long	0x56fc
+	.byte	0xc
+	.uleb128 0x6
+	.long	.LASF3005
+	.byte	0x2d
+	.byte	0xd
+	.byte	0x7
+	.long	0x56fc
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF3006
+	.byte	0x2d
+	.byte	0xe
+	.byte	0x7
+	.long	0x56fc
+	.byte	0x14
+	.uleb128 0x6
+	.long	.LASF3007
+	.byte	0x2d
+	.byte	0xf
+	.byte	0x7
+	.long	0x56fc
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF3008
+	.byte	0x2d
+	.byte	0x10
+	.byte	0x7
+	.long	0x56fc
+	.byte	0x1c
+	.uleb128 0x6
+	.long	.LASF3009
+	.byte	0x2d
+	.byte	0x11
+	.byte	0x7
+	.long	0x56fc
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF3010
+	.byte	0x2d
+	.byte	0x14
+	.byte	0xc
+	.long	0x5709
+	.byte	0x28
+	.uleb128 0x6
+	.long	.LASF3011
+	.byte	0x2d
+	.byte	0x15
+	.byte	0xf
+	.long	0x581d
+	.byte	0x30
+	.byte	0
+	.uleb128 0x7
+	.long	0x6192
+	.uleb128 0x4f
+	.long	.LASF1661
+	.byte	0x2e
+	.byte	0x48
+	.byte	0x10
+	.long	0x5954
+	.uleb128 0xf
+	.long	.LASF1662
+	.byte	0x2e
+	.byte	0x4f
+	.byte	0xf
+	.long	0x571e
+	.long	0x625b
+	.uleb128 0x1
+	.long	0x5960
+	.uleb128 0x1
+	.long	0x5960
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1663
+	.byte	0x2e
+	.byte	0x53
+	.byte	0xf
+	.long	0x5960
+	.long	0x6271
+	.uleb128 0x1
+	.long	0x6271
+	.byte	0
+	.uleb128 0x8
+	.long	0x6192
+	.uleb128 0xf
+	.long	.LASF1664
+	.byte	0x2e
+	.byte	0x4c
+	.byte	0xf
+	.long	0x5960
+	.long	0x628c
+	.uleb128 0x1
+	.long	0x628c
+	.byte	0
+	.uleb128 0x8
+	.long	0x5960
+	.uleb128 0xf
+	.long	.LASF1665
+	.byte	0x2e
+	.byte	0xb3
+	.byte	0xe
+	.long	0x594a
+	.long	0x62a7
+	.uleb128 0x1
+	.long	0x62a7
+	.byte	0
+	.uleb128 0x8
+	.long	0x622f
+	.uleb128 0xf
+	.long	.LASF1666
+	.byte	0x2e
+	.byte	0xb7
+	.byte	0xe
+	.long	0x594a
+	.long	0x62c2
+	.uleb128 0x1
+	.long	0x62c2
+	.byte	0
+	.uleb128 0x8
+	.long	0x596c
+	.uleb128 0xf
+	.long	.LASF1667
+	.byte	0x2e
+	.byte	0x84
+	.byte	0x13
+	.long	0x6271
+	.long	0x62dd
+	.uleb128 0x1
+	.long	0x62c2
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1668
+	.byte	0x2e
+	.byte	0x88
+	.byte	0x13
+	.long	0x6271
+	.long	0x62f3
+	.uleb128 0x1
+	.long	0x62c2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1670
+	.byte	0x2e
+	.value	0x17f
+	.byte	0xc
+	.long	0x56fc
+	.long	0x630f
+	.uleb128 0x1
+	.long	0x630f
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x8
+	.long	0x59a1
+	.uleb128 0x91
+	.long	.LASF3185
+	.byte	0x18
+	.byte	0x2f
+	.byte	0
+	.long	0x634a
+	.uleb128 0x46
+	.long	.LASF3012
+	.long	0x5094
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF3013
+	.long	0x5094
+	.byte	0x4
+	.uleb128 0x46
+	.long	.LASF3014
+	.long	0x593b
+	.byte	0x8
+	.uleb128 0x46
+	.long	.LASF3015
+	.long	0x593b
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3016
+	.byte	0x30
+	.byte	0x14
+	.byte	0x16
+	.long	0x5094
+	.uleb128 0x42
+	.byte	0x8
+	.byte	0x31
+	.byte	0xe
+	.byte	0x1
+	.long	.LASF3017
+	.long	0x63a0
+	.uleb128 0x5d
+	.byte	0x4
+	.byte	0x31
+	.byte	0x11
+	.byte	0x3
+	.long	0x6385
+	.uleb128 0x40
+	.long	.LASF3018
+	.byte	0x31
+	.byte	0x12
+	.byte	0x12
+	.long	0x5094
+	.uleb128 0x40
+	.long	.LASF3019
+	.byte	0x31
+	.byte	0x13
+	.byte	0xa
+	.long	0x59c9
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3020
+	.byte	0x31
+	.byte	0xf
+	.byte	0x7
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3021
+	.byte	0x31
+	.byte	0x14
+	.byte	0x5
+	.long	0x6363
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3022
+	.byte	0x31
+	.byte	0x15
+	.byte	0x3
+	.long	0x6356
+	.uleb128 0x5
+	.long	.LASF3023
+	.byte	0x32
+	.byte	0x6
+	.byte	0x15
+	.long	0x63a0
+	.uleb128 0x7
+	.long	0x63ac
+	.uleb128 0x5
+	.long	.LASF3024
+	.byte	0x33
+	.byte	0x5
+	.byte	0x19
+	.long	0x63c9
+	.uleb128 0x19
+	.long	.LASF3025
+	.byte	0xd8
+	.byte	0x34
+	.byte	0x31
+	.byte	0x8
+	.long	0x6550
+	.uleb128 0x6
+	.long	.LASF3026
+	.byte	0x34
+	.byte	0x33
+	.byte	0x7
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3027
+	.byte	0x34
+	.byte	0x36
+	.byte	0x9
+	.long	0x594a
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF3028
+	.byte	0x34
+	.byte	0x37
+	.byte	0x9
+	.long	0x594a
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF3029
+	.byte	0x34
+	.byte	0x38
+	.byte	0x9
+	.long	0x594a
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF3030
+	.byte	0x34
+	.byte	0x39
+	.byte	0x9
+	.long	0x594a
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF3031
+	.byte	0x34
+	.byte	0x3a
+	.byte	0x9
+	.long	0x594a
+	.byte	0x28
+	.uleb128 0x6
+	.long	.LASF3032
+	.byte	0x34
+	.byte	0x3b
+	.byte	0x9
+	.long	0x594a
+	.byte	0x30
+	.uleb128 0x6
+	.long	.LASF3033
+	.byte	0x34
+	.byte	0x3c
+	.byte	0x9
+	.long	0x594a
+	.byte	0x38
+	.uleb128 0x6
+	.long	.LASF3034
+	.byte	0x34
+	.byte	0x3d
+	.byte	0x9
+	.long	0x594a
+	.byte	0x40
+	.uleb128 0x6
+	.long	.LASF3035
+	.byte	0x34
+	.byte	0x40
+	.byte	0x9
+	.long	0x594a
+	.byte	0x48
+	.uleb128 0x6
+	.long	.LASF3036
+	.byte	0x34
+	.byte	0x41
+	.byte	0x9
+	.long	0x594a
+	.byte	0x50
+	.uleb128 0x6
+	.long	.LASF3037
+	.byte	0x34
+	.byte	0x42
+	.byte	0x9
+	.long	0x594a
+	.byte	0x58
+	.uleb128 0x6
+	.long	.LASF3038
+	.byte	0x34
+	.byte	0x44
+	.byte	0x16
+	.long	0x6f36
+	.byte	0x60
+	.uleb128 0x6
+	.long	.LASF3039
+	.byte	0x34
+	.byte	0x46
+	.byte	0x14
+	.long	0x6f3b
+	.byte	0x68
+	.uleb128 0x6
+	.long	.LASF3040
+	.byte	0x34
+	.byte	0x48
+	.byte	0x7
+	.long	0x56fc
+	.byte	0x70
+	.uleb128 0x6
+	.long	.LASF3041
+	.byte	0x34
+	.byte	0x49
+	.byte	0x7
+	.long	0x56fc
+	.byte	0x74
+	.uleb128 0x6
+	.long	.LASF3042
+	.byte	0x34
+	.byte	0x4a
+	.byte	0xb
+	.long	0x590b
+	.byte	0x78
+	.uleb128 0x6
+	.long	.LASF3043
+	.byte	0x34
+	.byte	0x4d
+	.byte	0x12
+	.long	0x56d4
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF3044
+	.byte	0x34
+	.byte	0x4e
+	.byte	0xf
+	.long	0x56ee
+	.byte	0x82
+	.uleb128 0x6
+	.long	.LASF3045
+	.byte	0x34
+	.byte	0x4f
+	.byte	0x8
+	.long	0x6f40
+	.byte	0x83
+	.uleb128 0x6
+	.long	.LASF3046
+	.byte	0x34
+	.byte	0x51
+	.byte	0xf
+	.long	0x6f50
+	.byte	0x88
+	.uleb128 0x6
+	.long	.LASF3047
+	.byte	0x34
+	.byte	0x59
+	.byte	0xd
+	.long	0x5917
+	.byte	0x90
+	.uleb128 0x6
+	.long	.LASF3048
+	.byte	0x34
+	.byte	0x5b
+	.byte	0x17
+	.long	0x6f5a
+	.byte	0x98
+	.uleb128 0x6
+	.long	.LASF3049
+	.byte	0x34
+	.byte	0x5c
+	.byte	0x19
+	.long	0x6f64
+	.byte	0xa0
+	.uleb128 0x6
+	.long	.LASF3050
+	.byte	0x34
+	.byte	0x5d
+	.byte	0x14
+	.long	0x6f3b
+	.byte	0xa8
+	.uleb128 0x6
+	.long	.LASF3051
+	.byte	0x34
+	.byte	0x5e
+	.byte	0x9
+	.long	0x593b
+	.byte	0xb0
+	.uleb128 0x6
+	.long	.LASF3052
+	.byte	0x34
+	.byte	0x5f
+	.byte	0xa
+	.long	0x5765
+	.byte	0xb8
+	.uleb128 0x6
+	.long	.LASF3053
+	.byte	0x34
+	.byte	0x60
+	.byte	0x7
+	.long	0x56fc
+	.byte	0xc0
+	.uleb128 0x6
+	.long	.LASF3054
+	.byte	0x34
+	.byte	0x62
+	.byte	0x8
+	.long	0x6f69
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3055
+	.byte	0x35
+	.byte	0x7
+	.byte	0x19
+	.long	0x63c9
+	.uleb128 0x9
+	.long	.LASF1690
+	.byte	0x36
+	.value	0x11d
+	.byte	0xf
+	.long	0x634a
+	.long	0x6573
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1691
+	.byte	0x36
+	.value	0x2e8
+	.byte	0xf
+	.long	0x634a
+	.long	0x658a
+	.uleb128 0x1
+	.long	0x658a
+	.byte	0
+	.uleb128 0x8
+	.long	0x63bd
+	.uleb128 0x9
+	.long	.LASF1692
+	.byte	0x36
+	.value	0x305
+	.byte	0x11
+	.long	0x5b3a
+	.long	0x65b0
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x56fc
+	.uleb128 0x1
+	.long	0x658a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1693
+	.byte	0x36
+	.value	0x2f6
+	.byte	0xf
+	.long	0x634a
+	.long	0x65cc
+	.uleb128 0x1
+	.long	0x5736
+	.uleb128 0x1
+	.long	0x658a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1694
+	.byte	0x36
+	.value	0x30c
+	.byte	0xc
+	.long	0x56fc
+	.long	0x65e8
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x658a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1695
+	.byte	0x36
+	.value	0x24c
+	.byte	0xc
+	.long	0x56fc
+	.long	0x6604
+	.uleb128 0x1
+	.long	0x658a
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1696
+	.byte	0x36
+	.value	0x253
+	.byte	0xc
+	.long	0x56fc
+	.long	0x6621
+	.uleb128 0x1
+	.long	0x658a
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1697
+	.byte	0x36
+	.value	0x291
+	.byte	0xc
+	.long	.LASF3056
+	.long	0x56fc
+	.long	0x6642
+	.uleb128 0x1
+	.long	0x658a
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1698
+	.byte	0x36
+	.value	0x2e9
+	.byte	0xf
+	.long	0x634a
+	.long	0x6659
+	.uleb128 0x1
+	.long	0x658a
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF1699
+	.byte	0x36
+	.value	0x2ef
+	.byte	0xf
+	.long	0x634a
+	.uleb128 0x9
+	.long	.LASF1700
+	.byte	0x36
+	.value	0x134
+	.byte	0xf
+	.long	0x5765
+	.long	0x6687
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x5765
+	.uleb128 0x1
+	.long	0x6687
+	.byte	0
+	.uleb128 0x8
+	.long	0x63ac
+	.uleb128 0x9
+	.long	.LASF1701
+	.byte	0x36
+	.value	0x129
+	.byte	0xf
+	.long	0x5765
+	.long	0x66b2
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x5765
+	.uleb128 0x1
+	.long	0x6687
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1702
+	.byte	0x36
+	.value	0x125
+	.byte	0xc
+	.long	0x56fc
+	.long	0x66c9
+	.uleb128 0x1
+	.long	0x66c9
+	.byte	0
+	.uleb128 0x8
+	.long	0x63b8
+	.uleb128 0x9
+	.long	.LASF1703
+	.byte	0x36
+	.value	0x152
+	.byte	0xf
+	.long	0x5765
+	.long	0x66f4
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x66f4
+	.uleb128 0x1
+	.long	0x5765
+	.uleb128 0x1
+	.long	0x6687
+	.byte	0
+	.uleb128 0x8
+	.long	0x581d
+	.uleb128 0x9
+	.long	.LASF1704
+	.byte	0x36
+	.value	0x2f7
+	.byte	0xf
+	.long	0x634a
+	.long	0x6715
+	.uleb128 0x1
+	.long	0x5736
+	.uleb128 0x1
+	.long	0x658a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1705
+	.byte	0x36
+	.value	0x2fd
+	.byte	0xf
+	.long	0x634a
+	.long	0x672c
+	.uleb128 0x1
+	.long	0x5736
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1706
+	.byte	0x36
+	.value	0x25d
+	.byte	0xc
+	.long	0x56fc
+	.long	0x674e
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5765
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1707
+	.byte	0x36
+	.value	0x298
+	.byte	0xc
+	.long	.LASF3057
+	.long	0x56fc
+	.long	0x676f
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1708
+	.byte	0x36
+	.value	0x314
+	.byte	0xf
+	.long	0x634a
+	.long	0x678b
+	.uleb128 0x1
+	.long	0x634a
+	.uleb128 0x1
+	.long	0x658a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1709
+	.byte	0x36
+	.value	0x265
+	.byte	0xc
+	.long	0x56fc
+	.long	0x67ac
+	.uleb128 0x1
+	.long	0x658a
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x67ac
+	.byte	0
+	.uleb128 0x8
+	.long	0x6314
+	.uleb128 0xe
+	.long	.LASF1710
+	.byte	0x36
+	.value	0x2c7
+	.byte	0xc
+	.long	.LASF3058
+	.long	0x56fc
+	.long	0x67d6
+	.uleb128 0x1
+	.long	0x658a
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x67ac
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1711
+	.byte	0x36
+	.value	0x272
+	.byte	0xc
+	.long	0x56fc
+	.long	0x67fc
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5765
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x67ac
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1712
+	.byte	0x36
+	.value	0x2ce
+	.byte	0xc
+	.long	.LASF3059
+	.long	0x56fc
+	.long	0x6821
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x67ac
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1713
+	.byte	0x36
+	.value	0x26d
+	.byte	0xc
+	.long	0x56fc
+	.long	0x683d
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x67ac
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1714
+	.byte	0x36
+	.value	0x2cb
+	.byte	0xc
+	.long	.LASF3060
+	.long	0x56fc
+	.long	0x685d
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x67ac
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1715
+	.byte	0x36
+	.value	0x12e
+	.byte	0xf
+	.long	0x5765
+	.long	0x687e
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x5736
+	.uleb128 0x1
+	.long	0x6687
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1716
+	.byte	0x36
+	.byte	0x61
+	.byte	0x11
+	.long	0x5b3a
+	.long	0x6899
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5c4c
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1718
+	.byte	0x36
+	.byte	0x6a
+	.byte	0xc
+	.long	0x56fc
+	.long	0x68b4
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5c4c
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1719
+	.byte	0x36
+	.byte	0x83
+	.byte	0xc
+	.long	0x56fc
+	.long	0x68cf
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5c4c
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1720
+	.byte	0x36
+	.byte	0x57
+	.byte	0x11
+	.long	0x5b3a
+	.long	0x68ea
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5c4c
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1721
+	.byte	0x36
+	.byte	0xbc
+	.byte	0xf
+	.long	0x5765
+	.long	0x6905
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5c4c
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1722
+	.byte	0x36
+	.value	0x354
+	.byte	0xf
+	.long	0x5765
+	.long	0x692b
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5765
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x62a7
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1723
+	.byte	0x36
+	.byte	0xdf
+	.byte	0xf
+	.long	0x5765
+	.long	0x6941
+	.uleb128 0x1
+	.long	0x5c4c
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1724
+	.byte	0x36
+	.byte	0x65
+	.byte	0x11
+	.long	0x5b3a
+	.long	0x6961
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1725
+	.byte	0x36
+	.byte	0x6d
+	.byte	0xc
+	.long	0x56fc
+	.long	0x6981
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1726
+	.byte	0x36
+	.byte	0x5c
+	.byte	0x11
+	.long	0x5b3a
+	.long	0x69a1
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1729
+	.byte	0x36
+	.value	0x158
+	.byte	0xf
+	.long	0x5765
+	.long	0x69c7
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x69c7
+	.uleb128 0x1
+	.long	0x5765
+	.uleb128 0x1
+	.long	0x6687
+	.byte	0
+	.uleb128 0x8
+	.long	0x5c4c
+	.uleb128 0xf
+	.long	.LASF1730
+	.byte	0x36
+	.byte	0xc0
+	.byte	0xf
+	.long	0x5765
+	.long	0x69e7
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5c4c
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1732
+	.byte	0x36
+	.value	0x17a
+	.byte	0xf
+	.long	0x571e
+	.long	0x6a03
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x6a03
+	.byte	0
+	.uleb128 0x8
+	.long	0x5b3a
+	.uleb128 0x9
+	.long	.LASF1733
+	.byte	0x36
+	.value	0x17f
+	.byte	0xe
+	.long	0x5725
+	.long	0x6a24
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x6a03
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1734
+	.byte	0x36
+	.byte	0xda
+	.byte	0x11
+	.long	0x5b3a
+	.long	0x6a44
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x6a03
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1735
+	.byte	0x36
+	.value	0x1ad
+	.byte	0x11
+	.long	0x5709
+	.long	0x6a65
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x6a03
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1736
+	.byte	0x36
+	.value	0x1b2
+	.byte	0x1a
+	.long	0x56db
+	.long	0x6a86
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x6a03
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1737
+	.byte	0x36
+	.byte	0x87
+	.byte	0xf
+	.long	0x5765
+	.long	0x6aa6
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1738
+	.byte	0x36
+	.value	0x121
+	.byte	0xc
+	.long	0x56fc
+	.long	0x6abd
+	.uleb128 0x1
+	.long	0x634a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1740
+	.byte	0x36
+	.value	0x103
+	.byte	0xc
+	.long	0x56fc
+	.long	0x6ade
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1741
+	.byte	0x36
+	.value	0x107
+	.byte	0x11
+	.long	0x5b3a
+	.long	0x6aff
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1742
+	.byte	0x36
+	.value	0x10c
+	.byte	0x11
+	.long	0x5b3a
+	.long	0x6b20
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1743
+	.byte	0x36
+	.value	0x110
+	.byte	0x11
+	.long	0x5b3a
+	.long	0x6b41
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5736
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1744
+	.byte	0x36
+	.value	0x25a
+	.byte	0xc
+	.long	0x56fc
+	.long	0x6b59
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1745
+	.byte	0x36
+	.value	0x295
+	.byte	0xc
+	.long	.LASF3061
+	.long	0x56fc
+	.long	0x6b75
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1717
+	.byte	0x36
+	.byte	0xa2
+	.byte	0x1d
+	.long	.LASF1717
+	.long	0x5c4c
+	.long	0x6b94
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5736
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1717
+	.byte	0x36
+	.byte	0xa0
+	.byte	0x17
+	.long	.LASF1717
+	.long	0x5b3a
+	.long	0x6bb3
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5736
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1727
+	.byte	0x36
+	.byte	0xc6
+	.byte	0x1d
+	.long	.LASF1727
+	.long	0x5c4c
+	.long	0x6bd2
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5c4c
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1727
+	.byte	0x36
+	.byte	0xc4
+	.byte	0x17
+	.long	.LASF1727
+	.long	0x5b3a
+	.long	0x6bf1
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5c4c
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1728
+	.byte	0x36
+	.byte	0xac
+	.byte	0x1d
+	.long	.LASF1728
+	.long	0x5c4c
+	.long	0x6c10
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5736
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1728
+	.byte	0x36
+	.byte	0xaa
+	.byte	0x17
+	.long	.LASF1728
+	.long	0x5b3a
+	.long	0x6c2f
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5736
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1731
+	.byte	0x36
+	.byte	0xd1
+	.byte	0x1d
+	.long	.LASF1731
+	.long	0x5c4c
+	.long	0x6c4e
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5c4c
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1731
+	.byte	0x36
+	.byte	0xcf
+	.byte	0x17
+	.long	.LASF1731
+	.long	0x5b3a
+	.long	0x6c6d
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5c4c
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1739
+	.byte	0x36
+	.byte	0xfa
+	.byte	0x1d
+	.long	.LASF1739
+	.long	0x5c4c
+	.long	0x6c91
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x5736
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1739
+	.byte	0x36
+	.byte	0xf8
+	.byte	0x17
+	.long	.LASF1739
+	.long	0x5b3a
+	.long	0x6cb5
+	.uleb128 0x1
+	.long	0x5b3a
+	.uleb128 0x1
+	.long	0x5736
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1746
+	.byte	0x36
+	.value	0x181
+	.byte	0x14
+	.long	0x5717
+	.long	0x6cd1
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x6a03
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1747
+	.byte	0x36
+	.value	0x1ba
+	.byte	0x16
+	.long	0x5710
+	.long	0x6cf2
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x6a03
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1748
+	.byte	0x36
+	.value	0x1c1
+	.byte	0x1f
+	.long	0x56e7
+	.long	0x6d13
+	.uleb128 0x1
+	.long	0x5c4c
+	.uleb128 0x1
+	.long	0x6a03
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0xd
+	.long	0x1105
+	.uleb128 0xd
+	.long	0x1112
+	.uleb128 0x8
+	.long	0x1112
+	.uleb128 0x8
+	.long	0x1105
+	.uleb128 0xd
+	.long	0x124d
+	.uleb128 0x8
+	.long	0x12d0
+	.uleb128 0x7
+	.long	0x6d2c
+	.uleb128 0xd
+	.long	0x1452
+	.uleb128 0x8
+	.long	0x1452
+	.uleb128 0x7
+	.long	0x6d3b
+	.uleb128 0xd
+	.long	0x5827
+	.uleb128 0xd
+	.long	0x582e
+	.uleb128 0x8
+	.long	0x1457
+	.uleb128 0xd
+	.long	0x14e3
+	.uleb128 0xd
+	.long	0x1457
+	.uleb128 0x19
+	.long	.LASF3062
+	.byte	0x60
+	.byte	0x37
+	.byte	0x33
+	.byte	0x8
+	.long	0x6ea4
+	.uleb128 0x6
+	.long	.LASF3063
+	.byte	0x37
+	.byte	0x37
+	.byte	0x9
+	.long	0x594a
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3064
+	.byte	0x37
+	.byte	0x38
+	.byte	0x9
+	.long	0x594a
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF3065
+	.byte	0x37
+	.byte	0x3e
+	.byte	0x9
+	.long	0x594a
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF3066
+	.byte	0x37
+	.byte	0x44
+	.byte	0x9
+	.long	0x594a
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF3067
+	.byte	0x37
+	.byte	0x45
+	.byte	0x9
+	.long	0x594a
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF3068
+	.byte	0x37
+	.byte	0x46
+	.byte	0x9
+	.long	0x594a
+	.byte	0x28
+	.uleb128 0x6
+	.long	.LASF3069
+	.byte	0x37
+	.byte	0x47
+	.byte	0x9
+	.long	0x594a
+	.byte	0x30
+	.uleb128 0x6
+	.long	.LASF3070
+	.byte	0x37
+	.byte	0x48
+	.byte	0x9
+	.long	0x594a
+	.byte	0x38
+	.uleb128 0x6
+	.long	.LASF3071
+	.byte	0x37
+	.byte	0x49
+	.byte	0x9
+	.long	0x594a
+	.byte	0x40
+	.uleb128 0x6
+	.long	.LASF3072
+	.byte	0x37
+	.byte	0x4a
+	.byte	0x9
+	.long	0x594a
+	.byte	0x48
+	.uleb128 0x6
+	.long	.LASF3073
+	.byte	0x37
+	.byte	0x4b
+	.byte	0x8
+	.long	0x5827
+	.byte	0x50
+	.uleb128 0x6
+	.long	.LASF3074
+	.byte	0x37
+	.byte	0x4c
+	.byte	0x8
+	.long	0x5827
+	.byte	0x51
+	.uleb128 0x6
+	.long	.LASF3075
+	.byte	0x37
+	.byte	0x4e
+	.byte	0x8
+	.long	0x5827
+	.byte	0x52
+	.uleb128 0x6
+	.long	.LASF3076
+	.byte	0x37
+	.byte	0x50
+	.byte	0x8
+	.long	0x5827
+	.byte	0x53
+	.uleb128 0x6
+	.long	.LASF3077
+	.byte	0x37
+	.byte	0x52
+	.byte	0x8
+	.long	0x5827
+	.byte	0x54
+	.uleb128 0x6
+	.long	.LASF3078
+	.byte	0x37
+	.byte	0x54
+	.byte	0x8
+	.long	0x5827
+	.byte	0x55
+	.uleb128 0x6
+	.long	.LASF3079
+	.byte	0x37
+	.byte	0x5b
+	.byte	0x8
+	.long	0x5827
+	.byte	0x56
+	.uleb128 0x6
+	.long	.LASF3080
+	.byte	0x37
+	.byte	0x5c
+	.byte	0x8
+	.long	0x5827
+	.byte	0x57
+	.uleb128 0x6
+	.long	.LASF3081
+	.byte	0x37
+	.byte	0x5f
+	.byte	0x8
+	.long	0x5827
+	.byte	0x58
+	.uleb128 0x6
+	.long	.LASF3082
+	.byte	0x37
+	.byte	0x61
+	.byte	0x8
+	.long	0x5827
+	.byte	0x59
+	.uleb128 0x6
+	.long	.LASF3083
+	.byte	0x37
+	.byte	0x63
+	.byte	0x8
+	.long	0x5827
+	.byte	0x5a
+	.uleb128 0x6
+	.long	.LASF3084
+	.byte	0x37
+	.byte	0x65
+	.byte	0x8
+	.long	0x5827
+	.byte	0x5b
+	.uleb128 0x6
+	.long	.LASF3085
+	.byte	0x37
+	.byte	0x6c
+	.byte	0x8
+	.long	0x5827
+	.byte	0x5c
+	.uleb128 0x6
+	.long	.LASF3086
+	.byte	0x37
+	.byte	0x6d
+	.byte	0x8
+	.long	0x5827
+	.byte	0x5d
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1806
+	.byte	0x37
+	.byte	0x7a
+	.byte	0xe
+	.long	0x594a
+	.long	0x6ebf
+	.uleb128 0x1
+	.long	0x56fc
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x4f
+	.long	.LASF1807
+	.byte	0x37
+	.byte	0x7d
+	.byte	0x16
+	.long	0x6ecb
+	.uleb128 0x8
+	.long	0x6d5e
+	.uleb128 0x92
+	.long	.LASF3186
+	.uleb128 0x8
+	.long	0x1500
+	.uleb128 0xd
+	.long	0x1e45
+	.uleb128 0xd
+	.long	0x1500
+	.uleb128 0x8
+	.long	0x15d5
+	.uleb128 0x8
+	.long	0x1e45
+	.uleb128 0xd
+	.long	0x15d5
+	.uleb128 0x19
+	.long	.LASF3087
+	.byte	0x10
+	.byte	0x38
+	.byte	0xa
+	.byte	0x10
+	.long	0x6f1c
+	.uleb128 0x6
+	.long	.LASF3088
+	.byte	0x38
+	.byte	0xc
+	.byte	0xb
+	.long	0x590b
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3089
+	.byte	0x38
+	.byte	0xd
+	.byte	0xf
+	.long	0x63a0
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3090
+	.byte	0x38
+	.byte	0xe
+	.byte	0x3
+	.long	0x6ef4
+	.uleb128 0x93
+	.long	.LASF3187
+	.byte	0x34
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x50
+	.long	.LASF3091
+	.uleb128 0x8
+	.long	0x6f31
+	.uleb128 0x8
+	.long	0x63c9
+	.uleb128 0x43
+	.long	0x5827
+	.long	0x6f50
+	.uleb128 0x44
+	.long	0x56db
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x6f28
+	.uleb128 0x50
+	.long	.LASF3092
+	.uleb128 0x8
+	.long	0x6f55
+	.uleb128 0x50
+	.long	.LASF3093
+	.uleb128 0x8
+	.long	0x6f5f
+	.uleb128 0x43
+	.long	0x5827
+	.long	0x6f79
+	.uleb128 0x44
+	.long	0x56db
+	.byte	0x13
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3094
+	.byte	0x39
+	.byte	0x54
+	.byte	0x12
+	.long	0x6f1c
+	.uleb128 0x7
+	.long	0x6f79
+	.uleb128 0x8
+	.long	0x6550
+	.uleb128 0x36
+	.long	.LASF1902
+	.byte	0x39
+	.value	0x312
+	.long	0x6fa1
+	.uleb128 0x1
+	.long	0x6f8a
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1903
+	.byte	0x39
+	.byte	0xb2
+	.byte	0xc
+	.long	0x56fc
+	.long	0x6fb7
+	.uleb128 0x1
+	.long	0x6f8a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1904
+	.byte	0x39
+	.value	0x314
+	.byte	0xc
+	.long	0x56fc
+	.long	0x6fce
+	.uleb128 0x1
+	.long	0x6f8a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1905
+	.byte	0x39
+	.value	0x316
+	.byte	0xc
+	.long	0x56fc
+	.long	0x6fe5
+	.uleb128 0x1
+	.long	0x6f8a
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1906
+	.byte	0x39
+	.byte	0xe6
+	.byte	0xc
+	.long	0x56fc
+	.long	0x6ffb
+	.uleb128 0x1
+	.long	0x6f8a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1907
+	.byte	0x39
+	.value	0x201
+	.byte	0xc
+	.long	0x56fc
+	.long	0x7012
+	.uleb128 0x1
+	.long	0x6f8a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1908
+	.byte	0x39
+	.value	0x2f8
+	.byte	0xc
+	.long	0x56fc
+	.long	0x702e
+	.uleb128 0x1
+	.long	0x6f8a
+	.uleb128 0x1
+	.long	0x702e
+	.byte	0
+	.uleb128 0x8
+	.long	0x6f79
+	.uleb128 0x9
+	.long	.LASF1909
+	.byte	0x39
+	.value	0x250
+	.byte	0xe
+	.long	0x594a
+	.long	0x7054
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x56fc
+	.uleb128 0x1
+	.long	0x6f8a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1910
+	.byte	0x39
+	.value	0x102
+	.byte	0xe
+	.long	0x6f8a
+	.long	0x7070
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1914
+	.byte	0x39
+	.value	0x2a3
+	.byte	0xf
+	.long	0x5765
+	.long	0x7096
+	.uleb128 0x1
+	.long	0x593b
+	.uleb128 0x1
+	.long	0x5765
+	.uleb128 0x1
+	.long	0x5765
+	.uleb128 0x1
+	.long	0x6f8a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1915
+	.byte	0x39
+	.value	0x109
+	.byte	0xe
+	.long	0x6f8a
+	.long	0x70b7
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x6f8a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1917
+	.byte	0x39
+	.value	0x2c9
+	.byte	0xc
+	.long	0x56fc
+	.long	0x70d8
+	.uleb128 0x1
+	.long	0x6f8a
+	.uleb128 0x1
+	.long	0x5709
+	.uleb128 0x1
+	.long	0x56fc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1918
+	.byte	0x39
+	.value	0x2fd
+	.byte	0xc
+	.long	0x56fc
+	.long	0x70f4
+	.uleb128 0x1
+	.long	0x6f8a
+	.uleb128 0x1
+	.long	0x70f4
+	.byte	0
+	.uleb128 0x8
+	.long	0x6f85
+	.uleb128 0x9
+	.long	.LASF1919
+	.byte	0x39
+	.value	0x2ce
+	.byte	0x11
+	.long	0x5709
+	.long	0x7110
+	.uleb128 0x1
+	.long	0x6f8a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1921
+	.byte	0x39
+	.value	0x202
+	.byte	0xc
+	.long	0x56fc
+	.long	0x7127
+	.uleb128 0x1
+	.long	0x6f8a
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF1922
+	.byte	0x39
+	.value	0x208
+	.byte	0xc
+	.long	0x56fc
+	.uleb128 0x36
+	.long	.LASF1923
+	.byte	0x39
+	.value	0x324
+	.long	0x7146
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1928
+	.byte	0x39
+	.byte	0x98
+	.byte	0xc
+	.long	0x56fc
+	.long	0x715c
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1929
+	.byte	0x39
+	.byte	0x9a
+	.byte	0xc
+	.long	0x56fc
+	.long	0x7177
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x581d
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF1930
+	.byte	0x39
+	.value	0x2d3
+	.long	0x7189
+	.uleb128 0x1
+	.long	0x6f8a
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF1932
+	.byte	0x39
+	.value	0x148
+	.long	0x71a0
+	.uleb128 0x1
+	.long	0x6f8a
+	.uleb128 0x1
+	.long	0x594a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1933
+	.byte	0x39
+	.value	0x14c
+	.byte	0xc
+	.long	0x56fc
+	.long	0x71c6
+	.uleb128 0x1
+	.long	0x6f8a
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x56fc
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x4f
+	.long	.LASF1936
+	.byte	0x39
+	.byte	0xbc
+	.byte	0xe
+	.long	0x6f8a
+	.uleb128 0xf
+	.long	.LASF1937
+	.byte	0x39
+	.byte	0xcd
+	.byte	0xe
+	.long	0x594a
+	.long	0x71e8
+	.uleb128 0x1
+	.long	0x594a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1938
+	.byte	0x39
+	.value	0x29c
+	.byte	0xc
+	.long	0x56fc
+	.long	0x7204
+	.uleb128 0x1
+	.long	0x56fc
+	.uleb128 0x1
+	.long	0x6f8a
+	.byte	0
+	.uleb128 0xd
+	.long	0x1f60
+	.uleb128 0xd
+	.long	0x1f6d
+	.uleb128 0xd
+	.long	0x51dc
+	.uleb128 0xd
+	.long	0x51e8
+	.uleb128 0x8
+	.long	0x204a
+	.uleb128 0x2e
+	.long	0x1457
+	.uleb128 0x43
+	.long	0x5827
+	.long	0x7232
+	.uleb128 0x44
+	.long	0x56db
+	.byte	0xf
+	.byte	0
+	.uleb128 0x8
+	.long	0x203d
+	.uleb128 0x7
+	.long	0x7232
+	.uleb128 0x8
+	.long	0x3ad6
+	.uleb128 0x7
+	.long	0x723c
+	.uleb128 0xd
+	.long	0x20e1
+	.uleb128 0xd
+	.long	0x231d
+	.uleb128 0xd
+	.long	0x232a
+	.uleb128 0xd
+	.long	0x3ad6
+	.uleb128 0x2e
+	.long	0x203d
+	.uleb128 0xd
+	.long	0x203d
+	.uleb128 0x8
+	.long	0x2137
+	.uleb128 0x8
+	.long	0x3adc
+	.uleb128 0x8
+	.long	0x3bcc
+	.uleb128 0x4c
+	.long	.LASF3095
+	.byte	0x3a
+	.byte	0xa
+	.long	0x7422
+	.uleb128 0x94
+	.long	.LASF3099
+	.byte	0xc0
+	.byte	0x40
+	.byte	0x3a
+	.byte	0x10
+	.byte	0x7
+	.long	0x741c
+	.uleb128 0x19
+	.long	.LASF3096
+	.byte	0x10
+	.byte	0x3a
+	.byte	0x21
+	.byte	0xb
+	.long	0x72b5
+	.uleb128 0x6
+	.long	.LASF3097
+	.byte	0x3a
+	.byte	0x23
+	.byte	0x13
+	.long	0x5960
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3098
+	.byte	0x3a
+	.byte	0x24
+	.byte	0x10
+	.long	0x5e88
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	0x728d
+	.uleb128 0x95
+	.long	.LASF3099
+	.byte	0x3a
+	.byte	0x14
+	.byte	0xd
+	.long	.LASF3100
+	.byte	0x1
+	.long	0x72d0
+	.long	0x72db
+	.uleb128 0x2
+	.long	0x74b8
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3101
+	.byte	0x3a
+	.byte	0x17
+	.byte	0x9
+	.long	.LASF3102
+	.long	0x509b
+	.byte	0x1
+	.long	0x72f4
+	.long	0x7309
+	.uleb128 0x2
+	.long	0x74b8
+	.uleb128 0x1
+	.long	0x5960
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x5e88
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3103
+	.byte	0x3a
+	.byte	0x19
+	.byte	0x9
+	.long	.LASF3104
+	.long	0x509b
+	.byte	0x1
+	.long	0x7322
+	.long	0x7332
+	.uleb128 0x2
+	.long	0x74b8
+	.uleb128 0x1
+	.long	0x74c2
+	.uleb128 0x1
+	.long	0x74c7
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3105
+	.byte	0x3a
+	.byte	0x1b
+	.byte	0xb
+	.long	.LASF3106
+	.long	0x5765
+	.byte	0x1
+	.long	0x734b
+	.long	0x7351
+	.uleb128 0x2
+	.long	0x74cc
+	.byte	0
+	.uleb128 0x96
+	.long	.LASF3099
+	.byte	0x3a
+	.byte	0x1d
+	.byte	0x4
+	.long	.LASF3107
+	.byte	0x1
+	.long	0x7367
+	.long	0x7372
+	.uleb128 0x2
+	.long	0x74b8
+	.uleb128 0x1
+	.long	0x74d6
+	.byte	0
+	.uleb128 0x97
+	.long	.LASF2149
+	.byte	0x3a
+	.byte	0x1e
+	.byte	0xe
+	.long	.LASF3108
+	.long	0x74db
+	.byte	0x1
+	.long	0x738c
+	.long	0x7397
+	.uleb128 0x2
+	.long	0x74b8
+	.uleb128 0x1
+	.long	0x74d6
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF3109
+	.byte	0x3a
+	.byte	0x27
+	.byte	0x9
+	.long	.LASF3110
+	.long	0x73ab
+	.long	0x73c0
+	.uleb128 0x2
+	.long	0x74b8
+	.uleb128 0x1
+	.long	0x5e99
+	.uleb128 0x1
+	.long	0x581d
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF3111
+	.byte	0x3a
+	.byte	0x28
+	.byte	0x9
+	.long	.LASF3112
+	.long	0x73d4
+	.long	0x73e9
+	.uleb128 0x2
+	.long	0x74cc
+	.uleb128 0x1
+	.long	0x5e99
+	.uleb128 0x1
+	.long	0x594a
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3113
+	.byte	0x3a
+	.byte	0x2a
+	.byte	0x16
+	.long	0x401e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3114
+	.byte	0x3a
+	.byte	0x2b
+	.byte	0xd
+	.long	0x5e99
+	.byte	0x18
+	.uleb128 0x66
+	.long	.LASF3115
+	.byte	0x2d
+	.long	0xb98
+	.byte	0x40
+	.byte	0x40
+	.uleb128 0x66
+	.long	.LASF3116
+	.byte	0x2e
+	.long	0xb98
+	.byte	0x40
+	.byte	0x80
+	.byte	0
+	.uleb128 0x7
+	.long	0x727e
+	.byte	0
+	.uleb128 0x8
+	.long	0x3c3d
+	.uleb128 0x7
+	.long	0x7422
+	.uleb128 0x2e
+	.long	0x3c3d
+	.uleb128 0xd
+	.long	0x3ce6
+	.uleb128 0xd
+	.long	0x3c3d
+	.uleb128 0x8
+	.long	0x3cf7
+	.uleb128 0x7
+	.long	0x743b
+	.uleb128 0xd
+	.long	0x3dcf
+	.uleb128 0x2e
+	.long	0x3cf7
+	.uleb128 0x2e
+	.long	0x3dc3
+	.uleb128 0xd
+	.long	0x3dc3
+	.uleb128 0x8
+	.long	0x3c30
+	.uleb128 0x7
+	.long	0x7459
+	.uleb128 0x8
+	.long	0x3ff6
+	.uleb128 0x7
+	.long	0x7463
+	.uleb128 0xd
+	.long	0x3e1f
+	.uleb128 0x2e
+	.long	0x3c30
+	.uleb128 0xd
+	.long	0x40eb
+	.uleb128 0x8
+	.long	0x401e
+	.uleb128 0x7
+	.long	0x747c
+	.uleb128 0xd
+	.long	0x419c
+	.uleb128 0xd
+	.long	0x4211
+	.uleb128 0xd
+	.long	0x4c4e
+	.uleb128 0x2e
+	.long	0x401e
+	.uleb128 0xd
+	.long	0x4c5f
+	.uleb128 0xd
+	.long	0x401e
+	.uleb128 0x8
+	.long	0x4c4e
+	.uleb128 0x7
+	.long	0x74a4
+	.uleb128 0x2e
+	.long	0x4203
+	.uleb128 0xd
+	.long	0x40f8
+	.uleb128 0x8
+	.long	0x727e
+	.uleb128 0x7
+	.long	0x74b8
+	.uleb128 0xd
+	.long	0x5960
+	.uleb128 0xd
+	.long	0x3bdb
+	.uleb128 0x8
+	.long	0x741c
+	.uleb128 0x7
+	.long	0x74cc
+	.uleb128 0xd
+	.long	0x741c
+	.uleb128 0xd
+	.long	0x727e
+	.uleb128 0xd
+	.long	0x594f
+	.uleb128 0x8
+	.long	0x548c
+	.uleb128 0xd
+	.long	0x5822
+	.uleb128 0x8
+	.long	0x56bd
+	.uleb128 0xd
+	.long	0x548c
+	.uleb128 0x8
+	.long	0x5256
+	.uleb128 0x8
+	.long	0x5487
+	.uleb128 0xd
+	.long	0x5256
+	.uleb128 0xf
+	.long	.LASF1579
+	.byte	0x2c
+	.byte	0x2b
+	.byte	0xe
+	.long	0x593b
+	.long	0x7528
+	.uleb128 0x1
+	.long	0x593b
+	.uleb128 0x1
+	.long	0x5a00
+	.uleb128 0x1
+	.long	0x5765
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF3117
+	.byte	0x3
+	.byte	0x87
+	.byte	0x6
+	.long	.LASF3118
+	.long	0x7543
+	.uleb128 0x1
+	.long	0x593b
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF3119
+	.byte	0x3
+	.byte	0x7e
+	.byte	0x19
+	.long	.LASF3120
+	.long	0x593b
+	.long	0x755d
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0x98
+	.long	.LASF3188
+	.uleb128 0x99
+	.long	.LASF3189
+	.uleb128 0x9a
+	.long	.LASF3122
+	.long	0x593b
+	.long	0x757d
+	.uleb128 0x1
+	.long	0x593b
+	.byte	0
+	.uleb128 0x1f
+	.long	0x4d31
+	.quad	.LFB2658
+	.quad	.LFE2658-.LFB2658
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7604
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x11
+	.long	.LASF3123
+	.byte	0x2
+	.value	0x3a2
+	.byte	0x14
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x11
+	.long	.LASF3124
+	.byte	0x2
+	.value	0x3a2
+	.byte	0x22
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1b
+	.string	"__c"
+	.byte	0x2
+	.value	0x3a2
+	.byte	0x35
+	.long	0x6d4a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x27
+	.long	.LASF3125
+	.byte	0x2
+	.value	0x3a4
+	.byte	0x11
+	.long	0x582e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -17
+	.uleb128 0x51
+	.quad	.LBB52
+	.quad	.LBE52-.LBB52
+	.uleb128 0x27
+	.long	.LASF3126
+	.byte	0x2
+	.value	0x3ad
+	.byte	0x18
+	.long	0x130
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	0x4d5b
+	.quad	.LFB2657
+	.quad	.LFE2657-.LFB2657
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7662
+	.uleb128 0xc
+	.long	.LASF2791
+	.long	0x594a
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x11
+	.long	.LASF3123
+	.byte	0x2
+	.value	0x3c7
+	.byte	0x14
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x11
+	.long	.LASF3124
+	.byte	0x2
+	.value	0x3c7
+	.byte	0x23
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x11
+	.long	.LASF3021
+	.byte	0x2
+	.value	0x3c7
+	.byte	0x36
+	.long	0x6d4a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x1f
+	.long	0x4d8e
+	.quad	.LFB2656
+	.quad	.LFE2656-.LFB2656
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x76d1
+	.uleb128 0xc
+	.long	.LASF2794
+	.long	0x594a
+	.uleb128 0xc
+	.long	.LASF2629
+	.long	0x56db
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x11
+	.long	.LASF3123
+	.byte	0x2
+	.value	0x454
+	.byte	0x20
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1b
+	.string	"__n"
+	.byte	0x2
+	.value	0x454
+	.byte	0x2f
+	.long	0x56db
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x11
+	.long	.LASF3021
+	.byte	0x2
+	.value	0x454
+	.byte	0x3f
+	.long	0x6d4a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x2f
+	.long	0x172
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3b
+	.long	0x142a
+	.long	0x76f0
+	.quad	.LFB2652
+	.quad	.LFE2652-.LFB2652
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x76fd
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x6d40
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x1f
+	.long	0x4dd3
+	.quad	.LFB2651
+	.quad	.LFE2651-.LFB2651
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7764
+	.uleb128 0x10
+	.string	"_OI"
+	.long	0x594a
+	.uleb128 0xc
+	.long	.LASF2629
+	.long	0x56db
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x11
+	.long	.LASF3123
+	.byte	0x2
+	.value	0x477
+	.byte	0x10
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1b
+	.string	"__n"
+	.byte	0x2
+	.value	0x477
+	.byte	0x1f
+	.long	0x56db
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x11
+	.long	.LASF3021
+	.byte	0x2
+	.value	0x477
+	.byte	0x2f
+	.long	0x6d4a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x1f
+	.long	0x4e13
+	.quad	.LFB2650
+	.quad	.LFE2650-.LFB2650
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x77a2
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x62
+	.long	.LASF3127
+	.uleb128 0x28
+	.string	"__p"
+	.byte	0xb
+	.byte	0x6d
+	.byte	0x15
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x9b
+	.byte	0xb
+	.byte	0x6d
+	.byte	0x21
+	.byte	0
+	.uleb128 0x24
+	.long	0x140b
+	.long	0x77c1
+	.quad	.LFB2649
+	.quad	.LFE2649-.LFB2649
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x77ce
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x6d40
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x1f
+	.long	0x4e44
+	.quad	.LFB2640
+	.quad	.LFE2640-.LFB2640
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x784c
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x10
+	.string	"_Up"
+	.long	0x5827
+	.uleb128 0x11
+	.long	.LASF3123
+	.byte	0xc
+	.value	0x44c
+	.byte	0x19
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x11
+	.long	.LASF3124
+	.byte	0xc
+	.value	0x44c
+	.byte	0x27
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x11
+	.long	.LASF3129
+	.byte	0xc
+	.value	0x44d
+	.byte	0xb
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x11
+	.long	.LASF3130
+	.byte	0xc
+	.value	0x44e
+	.byte	0x2b
+	.long	0x6d59
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x27
+	.long	.LASF3020
+	.byte	0xc
+	.value	0x450
+	.byte	0x11
+	.long	0x12c3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x30
+	.long	0x4e80
+	.quad	.LFB2639
+	.quad	.LFE2639-.LFB2639
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7881
+	.uleb128 0xc
+	.long	.LASF2805
+	.long	0x594a
+	.uleb128 0x11
+	.long	.LASF3131
+	.byte	0x2
+	.value	0x139
+	.byte	0x1c
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x24
+	.long	0x13b1
+	.long	0x78a0
+	.quad	.LFB2638
+	.quad	.LFE2638-.LFB2638
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x78d2
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x6d31
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x28
+	.string	"__n"
+	.byte	0xd
+	.byte	0x70
+	.byte	0x1a
+	.long	0x13da
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x2f
+	.long	0x5a00
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x67
+	.uleb128 0x68
+	.long	.LASF3139
+	.byte	0xd
+	.byte	0x84
+	.byte	0x17
+	.long	0x18d
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	0x3bf3
+	.quad	.LFB2637
+	.quad	.LFE2637-.LFB2637
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7942
+	.uleb128 0xc
+	.long	.LASF2130
+	.long	0x594a
+	.uleb128 0xc
+	.long	.LASF2629
+	.long	0x56db
+	.uleb128 0x11
+	.long	.LASF3123
+	.byte	0xc
+	.value	0x28f
+	.byte	0x2d
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x1b
+	.string	"__n"
+	.byte	0xc
+	.value	0x28f
+	.byte	0x3c
+	.long	0x56db
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x51
+	.quad	.LBB51
+	.quad	.LBE51-.LBB51
+	.uleb128 0x27
+	.long	.LASF3132
+	.byte	0xc
+	.value	0x293
+	.byte	0x40
+	.long	0x7942
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x4c87
+	.uleb128 0x1f
+	.long	0x1fd2
+	.quad	.LFB2636
+	.quad	.LFE2636-.LFB2636
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7973
+	.uleb128 0x1b
+	.string	"__a"
+	.byte	0x8
+	.value	0x223
+	.byte	0x26
+	.long	0x7209
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x30
+	.long	0x4ea4
+	.quad	.LFB2617
+	.quad	.LFE2617-.LFB2617
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x79a7
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x28
+	.string	"__r"
+	.byte	0xe
+	.byte	0x31
+	.byte	0x16
+	.long	0x6d45
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x1f
+	.long	0x4ec7
+	.quad	.LFB2616
+	.quad	.LFE2616-.LFB2616
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7a1e
+	.uleb128 0xc
+	.long	.LASF2810
+	.long	0x594a
+	.uleb128 0xc
+	.long	.LASF2130
+	.long	0x594a
+	.uleb128 0xc
+	.long	.LASF2811
+	.long	0x1457
+	.uleb128 0x11
+	.long	.LASF3123
+	.byte	0xc
+	.value	0x467
+	.byte	0x21
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x11
+	.long	.LASF3124
+	.byte	0xc
+	.value	0x467
+	.byte	0x39
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x11
+	.long	.LASF3129
+	.byte	0xc
+	.value	0x468
+	.byte	0x15
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x11
+	.long	.LASF3130
+	.byte	0xc
+	.value	0x468
+	.byte	0x2b
+	.long	0x6d59
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.uleb128 0x1f
+	.long	0x1f40
+	.quad	.LFB2615
+	.quad	.LFE2615-.LFB2615
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7a5a
+	.uleb128 0x1b
+	.string	"__a"
+	.byte	0x8
+	.value	0x1cf
+	.byte	0x20
+	.long	0x7204
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1b
+	.string	"__n"
+	.byte	0x8
+	.value	0x1cf
+	.byte	0x2f
+	.long	0x1f72
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0xd
+	.long	0x56e2
+	.uleb128 0x30
+	.long	0x4f0c
+	.quad	.LFB2614
+	.quad	.LFE2614-.LFB2614
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7aa2
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x56db
+	.uleb128 0x28
+	.string	"__a"
+	.byte	0x2
+	.byte	0xfe
+	.byte	0x14
+	.long	0x7a5a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x28
+	.string	"__b"
+	.byte	0x2
+	.byte	0xfe
+	.byte	0x24
+	.long	0x7a5a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x1f
+	.long	0x4f34
+	.quad	.LFB2613
+	.quad	.LFE2613-.LFB2613
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7b01
+	.uleb128 0xc
+	.long	.LASF2130
+	.long	0x594a
+	.uleb128 0xc
+	.long	.LASF2629
+	.long	0x56db
+	.uleb128 0x11
+	.long	.LASF3123
+	.byte	0xc
+	.value	0x2b3
+	.byte	0x30
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x1b
+	.string	"__n"
+	.byte	0xc
+	.value	0x2b3
+	.byte	0x3f
+	.long	0x56db
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x9c
+	.long	.LASF3190
+	.byte	0xc
+	.value	0x2b8
+	.byte	0x16
+	.long	0x50a2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -17
+	.byte	0
+	.uleb128 0x3b
+	.long	0x3df3
+	.long	0x7b20
+	.quad	.LFB2612
+	.quad	.LFE2612-.LFB2612
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7b2d
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x7468
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x1f
+	.long	0x4b3d
+	.quad	.LFB2611
+	.quad	.LFE2611-.LFB2611
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7b79
+	.uleb128 0x1b
+	.string	"__a"
+	.byte	0x6
+	.value	0x777
+	.byte	0x29
+	.long	0x74b3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x27
+	.long	.LASF3133
+	.byte	0x6
+	.value	0x77c
+	.byte	0xf
+	.long	0x130
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x27
+	.long	.LASF3134
+	.byte	0x6
+	.value	0x77e
+	.byte	0xf
+	.long	0x130
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x30
+	.long	0x1a8
+	.quad	.LFB2610
+	.quad	.LFE2610-.LFB2610
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7bae
+	.uleb128 0xc
+	.long	.LASF2130
+	.long	0x594a
+	.uleb128 0x2f
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x2f
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x24
+	.long	0x13e7
+	.long	0x7bcd
+	.quad	.LFB2609
+	.quad	.LFE2609-.LFB2609
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7bf8
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x6d31
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x28
+	.string	"__p"
+	.byte	0xd
+	.byte	0x8e
+	.byte	0x17
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x28
+	.string	"__n"
+	.byte	0xd
+	.byte	0x8e
+	.byte	0x26
+	.long	0x13da
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x1f
+	.long	0x412c
+	.quad	.LFB2559
+	.quad	.LFE2559-.LFB2559
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7c54
+	.uleb128 0x11
+	.long	.LASF3123
+	.byte	0x6
+	.value	0x1f3
+	.byte	0x1b
+	.long	0x40ae
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x11
+	.long	.LASF3124
+	.byte	0x6
+	.value	0x1f3
+	.byte	0x2c
+	.long	0x40ae
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x11
+	.long	.LASF3129
+	.byte	0x6
+	.value	0x1f3
+	.byte	0x3c
+	.long	0x40ae
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x11
+	.long	.LASF3130
+	.byte	0x6
+	.value	0x1f4
+	.byte	0x15
+	.long	0x7477
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0x24
+	.long	0x3f79
+	.long	0x7c73
+	.quad	.LFB2558
+	.quad	.LFE2558-.LFB2558
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7c90
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x745e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1b
+	.string	"__n"
+	.byte	0x6
+	.value	0x177
+	.byte	0x1a
+	.long	0x123
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x24
+	.long	0x4af5
+	.long	0x7caf
+	.quad	.LFB2557
+	.quad	.LFE2557-.LFB2557
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7ced
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x74a9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x1b
+	.string	"__n"
+	.byte	0x6
+	.value	0x763
+	.byte	0x1e
+	.long	0x41c5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x1b
+	.string	"__s"
+	.byte	0x6
+	.value	0x763
+	.byte	0x2f
+	.long	0x581d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x27
+	.long	.LASF3126
+	.byte	0x6
+	.value	0x768
+	.byte	0x12
+	.long	0x41d3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x1f
+	.long	0x4f66
+	.quad	.LFB2556
+	.quad	.LFE2556-.LFB2556
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7d4c
+	.uleb128 0xc
+	.long	.LASF2130
+	.long	0x594a
+	.uleb128 0xc
+	.long	.LASF2629
+	.long	0x56db
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x11
+	.long	.LASF3123
+	.byte	0xc
+	.value	0x2fc
+	.byte	0x32
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1b
+	.string	"__n"
+	.byte	0xc
+	.value	0x2fc
+	.byte	0x41
+	.long	0x56db
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x2f
+	.long	0x6d59
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x24
+	.long	0x45c5
+	.long	0x7d6b
+	.quad	.LFB2555
+	.quad	.LFE2555-.LFB2555
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7d78
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x74a9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x1f
+	.long	0x4fa6
+	.quad	.LFB2554
+	.quad	.LFE2554-.LFB2554
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7dbb
+	.uleb128 0xc
+	.long	.LASF2130
+	.long	0x594a
+	.uleb128 0x21
+	.long	.LASF3123
+	.byte	0xb
+	.byte	0xb6
+	.byte	0x1f
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x21
+	.long	.LASF3124
+	.byte	0xb
+	.byte	0xb6
+	.byte	0x39
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x1f
+	.long	0x1fb1
+	.quad	.LFB2553
+	.quad	.LFE2553-.LFB2553
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7e07
+	.uleb128 0x1b
+	.string	"__a"
+	.byte	0x8
+	.value	0x1ef
+	.byte	0x22
+	.long	0x7204
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1b
+	.string	"__p"
+	.byte	0x8
+	.value	0x1ef
+	.byte	0x2f
+	.long	0x1f33
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x1b
+	.string	"__n"
+	.byte	0x8
+	.value	0x1ef
+	.byte	0x3e
+	.long	0x1f72
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x30
+	.long	0x4fca
+	.quad	.LFB2496
+	.quad	.LFE2496-.LFB2496
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7e34
+	.uleb128 0xc
+	.long	.LASF2822
+	.long	0x594a
+	.uleb128 0x2f
+	.long	0x74e0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x3b
+	.long	0x4c0e
+	.long	0x7e5c
+	.quad	.LFB2489
+	.quad	.LFE2489-.LFB2489
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7e79
+	.uleb128 0x10
+	.string	"_Up"
+	.long	0x5827
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x74a9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x11
+	.long	.LASF3135
+	.byte	0x6
+	.value	0x7c1
+	.byte	0x13
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x24
+	.long	0x4b56
+	.long	0x7e98
+	.quad	.LFB2488
+	.quad	.LFE2488-.LFB2488
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7ed8
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x7481
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x11
+	.long	.LASF3088
+	.byte	0x6
+	.value	0x788
+	.byte	0x1f
+	.long	0x40ae
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x51
+	.quad	.LBB49
+	.quad	.LBE49-.LBB49
+	.uleb128 0x9d
+	.string	"__n"
+	.byte	0x6
+	.value	0x78a
+	.byte	0x10
+	.long	0x41c5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	0x4a60
+	.long	0x7ef7
+	.quad	.LFB2484
+	.quad	.LFE2484-.LFB2484
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7f62
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x7481
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x1b
+	.string	"__n"
+	.byte	0x9
+	.value	0x273
+	.byte	0x21
+	.long	0x41c5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x69
+	.long	.LLRL0
+	.uleb128 0x27
+	.long	.LASF3136
+	.byte	0x9
+	.value	0x277
+	.byte	0x14
+	.long	0x41d3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x27
+	.long	.LASF3137
+	.byte	0x9
+	.value	0x278
+	.byte	0xe
+	.long	0x41c5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x69
+	.long	.LLRL1
+	.uleb128 0x27
+	.long	.LASF3126
+	.byte	0x9
+	.value	0x288
+	.byte	0x18
+	.long	0x41d3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x27
+	.long	.LASF3138
+	.byte	0x9
+	.value	0x28a
+	.byte	0x10
+	.long	0x40ae
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	0x4fed
+	.quad	.LFB2483
+	.quad	.LFE2483-.LFB2483
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7fb8
+	.uleb128 0xc
+	.long	.LASF2130
+	.long	0x594a
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x5827
+	.uleb128 0x11
+	.long	.LASF3123
+	.byte	0x8
+	.value	0x34f
+	.byte	0x1f
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x11
+	.long	.LASF3124
+	.byte	0x8
+	.value	0x34f
+	.byte	0x39
+	.long	0x594a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x2f
+	.long	0x6d59
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x3b
+	.long	0x3dd4
+	.long	0x7fd7
+	.quad	.LFB2482
+	.quad	.LFE2482-.LFB2482
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7fe4
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x745e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x24
+	.long	0x3f9d
+	.long	0x8003
+	.quad	.LFB2481
+	.quad	.LFE2481-.LFB2481
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8030
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x745e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1b
+	.string	"__p"
+	.byte	0x6
+	.value	0x17f
+	.byte	0x1d
+	.long	0x3ceb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x1b
+	.string	"__n"
+	.byte	0x6
+	.value	0x17f
+	.byte	0x29
+	.long	0x123
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x29
+	.long	0x3c71
+	.long	0x803e
+	.byte	0x2
+	.long	0x8048
+	.uleb128 0x1c
+	.long	.LASF3128
+	.long	0x7427
+	.byte	0
+	.uleb128 0x6a
+	.long	0x8030
+	.long	.LASF3142
+	.long	0x806b
+	.quad	.LFB2479
+	.quad	.LFE2479-.LFB2479
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8074
+	.uleb128 0x12
+	.long	0x803e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x24
+	.long	0x4812
+	.long	0x8093
+	.quad	.LFB2382
+	.quad	.LFE2382-.LFB2382
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x80a0
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x74a9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x24
+	.long	0x47f2
+	.long	0x80bf
+	.quad	.LFB2381
+	.quad	.LFE2381-.LFB2381
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x80cc
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x7481
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x30
+	.long	0x5020
+	.quad	.LFB2380
+	.quad	.LFE2380-.LFB2380
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x810f
+	.uleb128 0x10
+	.string	"_Tp"
+	.long	0x56db
+	.uleb128 0x28
+	.string	"__a"
+	.byte	0x2
+	.byte	0xe6
+	.byte	0x14
+	.long	0x7a5a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x28
+	.string	"__b"
+	.byte	0x2
+	.byte	0xe6
+	.byte	0x24
+	.long	0x7a5a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x52
+	.long	0x352d
+	.long	0x811c
+	.long	0x8126
+	.uleb128 0x1c
+	.long	.LASF3128
+	.long	0x7237
+	.byte	0
+	.uleb128 0x52
+	.long	0x2a83
+	.long	0x8133
+	.long	0x814a
+	.uleb128 0x1c
+	.long	.LASF3128
+	.long	0x7237
+	.uleb128 0x38
+	.string	"__n"
+	.byte	0x1b
+	.value	0x451
+	.byte	0x18
+	.long	0x20e1
+	.byte	0
+	.uleb128 0x29
+	.long	0x77d
+	.long	0x8158
+	.byte	0x3
+	.long	0x8187
+	.uleb128 0x1c
+	.long	.LASF3128
+	.long	0x5f9f
+	.uleb128 0x38
+	.string	"__i"
+	.byte	0x4
+	.value	0x1c8
+	.byte	0x18
+	.long	0x367
+	.uleb128 0x38
+	.string	"__m"
+	.byte	0x4
+	.value	0x1c8
+	.byte	0x2a
+	.long	0x33b
+	.uleb128 0x6b
+	.string	"__b"
+	.value	0x1ca
+	.long	0x33b
+	.byte	0
+	.uleb128 0x3b
+	.long	0x45a5
+	.long	0x81a6
+	.quad	.LFB2376
+	.quad	.LFE2376-.LFB2376
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x81b3
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x74a9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x29
+	.long	0x7c7
+	.long	0x81c1
+	.byte	0x3
+	.long	0x81e3
+	.uleb128 0x1c
+	.long	.LASF3128
+	.long	0x5fb8
+	.uleb128 0x38
+	.string	"__m"
+	.byte	0x4
+	.value	0x1e1
+	.byte	0x19
+	.long	0x33b
+	.uleb128 0x6b
+	.string	"__b"
+	.value	0x1e3
+	.long	0x33b
+	.byte	0
+	.uleb128 0x24
+	.long	0x45e5
+	.long	0x8202
+	.quad	.LFB2374
+	.quad	.LFE2374-.LFB2374
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x821f
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x7481
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x11
+	.long	.LASF3140
+	.byte	0x6
+	.value	0x3f0
+	.byte	0x18
+	.long	0x41c5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x29
+	.long	0x431b
+	.long	0x822d
+	.byte	0x2
+	.long	0x8240
+	.uleb128 0x1c
+	.long	.LASF3128
+	.long	0x7481
+	.uleb128 0x1c
+	.long	.LASF3141
+	.long	0x5704
+	.byte	0
+	.uleb128 0x31
+	.long	0x821f
+	.long	.LASF3143
+	.long	0x8263
+	.quad	.LFB2372
+	.quad	.LFE2372-.LFB2372
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x826c
+	.uleb128 0x12
+	.long	0x822d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x29
+	.long	0x3f4b
+	.long	0x827a
+	.byte	0x2
+	.long	0x828d
+	.uleb128 0x1c
+	.long	.LASF3128
+	.long	0x745e
+	.uleb128 0x1c
+	.long	.LASF3141
+	.long	0x5704
+	.byte	0
+	.uleb128 0x31
+	.long	0x826c
+	.long	.LASF3144
+	.long	0x82b0
+	.quad	.LFB2369
+	.quad	.LFE2369-.LFB2369
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x82b9
+	.uleb128 0x12
+	.long	0x827a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x29
+	.long	0x3d0e
+	.long	0x82c7
+	.byte	0x2
+	.long	0x82d1
+	.uleb128 0x1c
+	.long	.LASF3128
+	.long	0x7440
+	.byte	0
+	.uleb128 0x31
+	.long	0x82b9
+	.long	.LASF3145
+	.long	0x82f4
+	.quad	.LFB2366
+	.quad	.LFE2366-.LFB2366
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x82fd
+	.uleb128 0x12
+	.long	0x82c7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x52
+	.long	0x29fd
+	.long	0x830a
+	.long	0x8314
+	.uleb128 0x1c
+	.long	.LASF3128
+	.long	0x7241
+	.byte	0
+	.uleb128 0x6c
+	.long	0x14c6
+	.uleb128 0x6d
+	.long	0x8314
+	.long	.LASF3146
+	.long	0x832a
+	.long	0x832c
+	.uleb128 0x6e
+	.byte	0
+	.uleb128 0x6c
+	.long	0x146a
+	.uleb128 0x6d
+	.long	0x832c
+	.long	.LASF3147
+	.long	0x8342
+	.long	0x8344
+	.uleb128 0x6e
+	.byte	0
+	.uleb128 0x29
+	.long	0x425
+	.long	0x8352
+	.byte	0x2
+	.long	0x8369
+	.uleb128 0x1c
+	.long	.LASF3128
+	.long	0x5f9f
+	.uleb128 0x38
+	.string	"__i"
+	.byte	0x4
+	.value	0x159
+	.byte	0x2a
+	.long	0x367
+	.byte	0
+	.uleb128 0x6a
+	.long	0x8344
+	.long	.LASF3148
+	.long	0x838c
+	.quad	.LFB2091
+	.quad	.LFE2091-.LFB2091
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x839d
+	.uleb128 0x12
+	.long	0x8352
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x12
+	.long	0x835b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x3c
+	.long	0x73c0
+	.byte	0x51
+	.byte	0x6
+	.long	0x83be
+	.quad	.LFB2044
+	.quad	.LFE2044-.LFB2044
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8418
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x74d1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x21
+	.long	.LASF3149
+	.byte	0x7
+	.byte	0x51
+	.byte	0x28
+	.long	0x5ea5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x21
+	.long	.LASF3150
+	.byte	0x7
+	.byte	0x51
+	.byte	0x38
+	.long	0x594a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x21
+	.long	.LASF2311
+	.byte	0x7
+	.byte	0x51
+	.byte	0x52
+	.long	0x5771
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x25
+	.long	.LASF3151
+	.byte	0x53
+	.byte	0x11
+	.long	0x5771
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x25
+	.long	.LASF3152
+	.byte	0x54
+	.byte	0x11
+	.long	0x5771
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0x3c
+	.long	0x7397
+	.byte	0x48
+	.byte	0x6
+	.long	0x8439
+	.quad	.LFB2043
+	.quad	.LFE2043-.LFB2043
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8493
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x74bd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x21
+	.long	.LASF3149
+	.byte	0x7
+	.byte	0x48
+	.byte	0x27
+	.long	0x5ea5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x21
+	.long	.LASF3153
+	.byte	0x7
+	.byte	0x48
+	.byte	0x3d
+	.long	0x581d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x21
+	.long	.LASF2311
+	.byte	0x7
+	.byte	0x48
+	.byte	0x52
+	.long	0x5771
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x25
+	.long	.LASF3151
+	.byte	0x4b
+	.byte	0x11
+	.long	0x5771
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x25
+	.long	.LASF3152
+	.byte	0x4c
+	.byte	0x11
+	.long	0x5771
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0x3c
+	.long	0x7332
+	.byte	0x43
+	.byte	0x8
+	.long	0x84b4
+	.quad	.LFB2042
+	.quad	.LFE2042-.LFB2042
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x84c1
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x74d1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x3c
+	.long	0x7309
+	.byte	0x2f
+	.byte	0x6
+	.long	0x84e2
+	.quad	.LFB2041
+	.quad	.LFE2041-.LFB2041
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x85ef
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x74bd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x21
+	.long	.LASF3154
+	.byte	0x7
+	.byte	0x2f
+	.byte	0x25
+	.long	0x74c2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x21
+	.long	.LASF3155
+	.byte	0x7
+	.byte	0x2f
+	.byte	0x3d
+	.long	0x74c7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x25
+	.long	.LASF3156
+	.byte	0x32
+	.byte	0x13
+	.long	0x5ea5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x25
+	.long	.LASF3157
+	.byte	0x33
+	.byte	0x13
+	.long	0x5ea5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x25
+	.long	.LASF3158
+	.byte	0x39
+	.byte	0x12
+	.long	0x728d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x25
+	.long	.LASF3159
+	.byte	0x3b
+	.byte	0x11
+	.long	0x5771
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x47
+	.long	0x81b3
+	.quad	.LBB27
+	.quad	.LBE27-.LBB27
+	.byte	0x32
+	.long	0x857e
+	.uleb128 0x12
+	.long	0x81ca
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x12
+	.long	0x81c1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x33
+	.long	0x81d7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+	.uleb128 0x47
+	.long	0x81b3
+	.quad	.LBB29
+	.quad	.LBE29-.LBB29
+	.byte	0x33
+	.long	0x85b3
+	.uleb128 0x12
+	.long	0x81ca
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x12
+	.long	0x81c1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x33
+	.long	0x81d7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+	.uleb128 0x6f
+	.long	0x814a
+	.quad	.LBB31
+	.quad	.LBE31-.LBB31
+	.byte	0x3f
+	.uleb128 0x12
+	.long	0x816e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.uleb128 0x12
+	.long	0x8161
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x12
+	.long	0x8158
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x33
+	.long	0x817b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.long	0x72db
+	.byte	0x1d
+	.byte	0x6
+	.long	0x8610
+	.quad	.LFB2040
+	.quad	.LFE2040-.LFB2040
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x872a
+	.uleb128 0x18
+	.long	.LASF3128
+	.long	0x74bd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x21
+	.long	.LASF3154
+	.byte	0x7
+	.byte	0x1d
+	.byte	0x2b
+	.long	0x596c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x21
+	.long	.LASF3155
+	.byte	0x7
+	.byte	0x1d
+	.byte	0x42
+	.long	0x581d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x21
+	.long	.LASF2238
+	.byte	0x7
+	.byte	0x1d
+	.byte	0x5a
+	.long	0x5e94
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -140
+	.uleb128 0x25
+	.long	.LASF3160
+	.byte	0x1f
+	.byte	0x11
+	.long	0x5771
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x25
+	.long	.LASF3157
+	.byte	0x21
+	.byte	0x13
+	.long	0x5ea5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x25
+	.long	.LASF3156
+	.byte	0x22
+	.byte	0x13
+	.long	0x5ea5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x25
+	.long	.LASF3158
+	.byte	0x28
+	.byte	0x18
+	.long	0x72b5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x47
+	.long	0x81b3
+	.quad	.LBB21
+	.quad	.LBE21-.LBB21
+	.byte	0x21
+	.long	0x86bb
+	.uleb128 0x12
+	.long	0x81ca
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x12
+	.long	0x81c1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x33
+	.long	0x81d7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+	.uleb128 0x47
+	.long	0x81b3
+	.quad	.LBB23
+	.quad	.LBE23-.LBB23
+	.byte	0x22
+	.long	0x86ee
+	.uleb128 0x12
+	.long	0x81ca
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x12
+	.long	0x81c1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x33
+	.long	0x81d7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.uleb128 0x6f
+	.long	0x814a
+	.quad	.LBB25
+	.quad	.LBE25-.LBB25
+	.byte	0x2b
+	.uleb128 0x12
+	.long	0x816e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.uleb128 0x12
+	.long	0x8161
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x12
+	.long	0x8158
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x33
+	.long	0x817b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+	.byte	0
+	.uleb128 0x70
+	.long	0x72ba
+	.byte	0x7
+	.byte	0xe
+	.byte	0x1
+	.long	0x873b
+	.byte	0
+	.long	0x8760
+	.uleb128 0x1c
+	.long	.LASF3128
+	.long	0x74bd
+	.uleb128 0x9e
+	.long	.LASF2500
+	.byte	0x7
+	.byte	0xe
+	.byte	0x21
+	.long	0x5771
+	.uleb128 0x67
+	.uleb128 0x68
+	.long	.LASF3161
+	.byte	0x7
+	.byte	0x14
+	.byte	0xb
+	.long	0x5765
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.long	0x872a
+	.long	.LASF3162
+	.long	0x8783
+	.quad	.LFB2038
+	.quad	.LFE2038-.LFB2038
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x87c4
+	.uleb128 0x12
+	.long	0x873b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x12
+	.long	0x8744
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x9f
+	.long	0x8751
+	.long	0x87a4
+	.uleb128 0xa0
+	.long	0x8752
+	.byte	0
+	.uleb128 0xa1
+	.long	0x8751
+	.quad	.LBB19
+	.quad	.LBE19-.LBB19
+	.uleb128 0x33
+	.long	0x8752
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	0x4156
+	.long	0x87d2
+	.byte	0x2
+	.long	0x87dc
+	.uleb128 0x1c
+	.long	.LASF3128
+	.long	0x7481
+	.byte	0
+	.uleb128 0x31
+	.long	0x87c4
+	.long	.LASF3163
+	.long	0x87ff
+	.quad	.LFB2036
+	.quad	.LFE2036-.LFB2036
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8808
+	.uleb128 0x12
+	.long	0x87d2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x29
+	.long	0x3e43
+	.long	0x8816
+	.byte	0x2
+	.long	0x8820
+	.uleb128 0x1c
+	.long	.LASF3128
+	.long	0x745e
+	.byte	0
+	.uleb128 0x31
+	.long	0x8808
+	.long	.LASF3164
+	.long	0x8843
+	.quad	.LFB2034
+	.quad	.LFE2034-.LFB2034
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x884c
+	.uleb128 0x12
+	.long	0x8816
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x70
+	.long	0x3da9
+	.byte	0x6
+	.byte	0x85
+	.byte	0xe
+	.long	0x885d
+	.byte	0x2
+	.long	0x8870
+	.uleb128 0x1c
+	.long	.LASF3128
+	.long	0x7440
+	.uleb128 0x1c
+	.long	.LASF3141
+	.long	0x5704
+	.byte	0
+	.uleb128 0x31
+	.long	0x884c
+	.long	.LASF3165
+	.long	0x8893
+	.quad	.LFB2032
+	.quad	.LFE2032-.LFB2032
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x889c
+	.uleb128 0x12
+	.long	0x885d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x29
+	.long	0xc7f
+	.long	0x88aa
+	.byte	0x2
+	.long	0x88c1
+	.uleb128 0x1c
+	.long	.LASF3128
+	.long	0x5fcc
+	.uleb128 0x38
+	.string	"__i"
+	.byte	0x5
+	.value	0x388
+	.byte	0x28
+	.long	0xc9f
+	.byte	0
+	.uleb128 0x31
+	.long	0x889c
+	.long	.LASF3166
+	.long	0x88e4
+	.quad	.LFB874
+	.quad	.LFE874-.LFB874
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x88f5
+	.uleb128 0x12
+	.long	0x88aa
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x12
+	.long	0x88b3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x30
+	.long	0x5048
+	.quad	.LFB669
+	.quad	.LFE669-.LFB669
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x892f
+	.uleb128 0x28
+	.string	"__m"
+	.byte	0x4
+	.byte	0x68
+	.byte	0x1a
+	.long	0x33b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x21
+	.long	.LASF3167
+	.byte	0x4
+	.byte	0x68
+	.byte	0x37
+	.long	0x309
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0xa2
+	.long	.LASF3119
+	.byte	0x3
+	.byte	0xae
+	.byte	0x20
+	.long	.LASF3168
+	.long	0x593b
+	.quad	.LFB408
+	.quad	.LFE408-.LFB408
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x896e
+	.uleb128 0x2f
+	.long	0x123
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x28
+	.string	"__p"
+	.byte	0x3
+	.byte	0xae
+	.byte	0x40
+	.long	0x593b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x30
+	.long	0x5067
+	.quad	.LFB314
+	.quad	.LFE314-.LFB314
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x899a
+	.uleb128 0x1b
+	.string	"__n"
+	.byte	0x2
+	.value	0x3f1
+	.byte	0x23
+	.long	0x56db
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0xa3
+	.long	0x5082
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1a
+	.byte	0x10
+	.byte	0x5
+	.long	.LASF3169
+	.uleb128 0x1a
+	.byte	0x10
+	.byte	0x7
+	.long	.LASF3170
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x10
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 41
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x1c
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x42
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 32
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8a
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1e
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 47
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 35
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x2
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 35
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x30
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x88
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8a
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5b
+	.uleb128 0x1c
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x60
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x61
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x62
+	.uleb128 0x4107
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x63
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 33
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 1046
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 2
+	.byte	0
+	.byte	0
+	.uleb128 0x64
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 41
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xa
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x65
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 41
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xa
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x66
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 58
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 38
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x67
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x68
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x69
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 2
+	.byte	0
+	.byte	0
+	.uleb128 0x6d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6e
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6f
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 15
+	.byte	0
+	.byte	0
+	.uleb128 0x70
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x71
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x72
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x73
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x74
+	.uleb128 0x4
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x6d
+	.uleb128 0x19
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x75
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x76
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x77
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xb
+	.uleb128 0x6c
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x78
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0xb
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x79
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xb
+	.uleb128 0x6c
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x7b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0xb
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x89
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7f
+	.uleb128 0x30
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x80
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x81
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x82
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x83
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x84
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x85
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x86
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x87
+	.uleb128 0x3a
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x88
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x89
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8a
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8b
+	.uleb128 0x15
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8e
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8f
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x89
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x90
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x91
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x92
+	.uleb128 0x3b
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x93
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x94
+	.uleb128 0x2
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x95
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x96
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8a
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x97
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8a
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x98
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x99
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x9a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9b
+	.uleb128 0x4108
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x6c
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x9d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x9e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa0
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa1
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0xa2
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa3
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x37c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.quad	.LFB314
+	.quad	.LFE314-.LFB314
+	.quad	.LFB408
+	.quad	.LFE408-.LFB408
+	.quad	.LFB669
+	.quad	.LFE669-.LFB669
+	.quad	.LFB874
+	.quad	.LFE874-.LFB874
+	.quad	.LFB2032
+	.quad	.LFE2032-.LFB2032
+	.quad	.LFB2034
+	.quad	.LFE2034-.LFB2034
+	.quad	.LFB2036
+	.quad	.LFE2036-.LFB2036
+	.quad	.LFB2091
+	.quad	.LFE2091-.LFB2091
+	.quad	.LFB2366
+	.quad	.LFE2366-.LFB2366
+	.quad	.LFB2369
+	.quad	.LFE2369-.LFB2369
+	.quad	.LFB2372
+	.quad	.LFE2372-.LFB2372
+	.quad	.LFB2374
+	.quad	.LFE2374-.LFB2374
+	.quad	.LFB2376
+	.quad	.LFE2376-.LFB2376
+	.quad	.LFB2380
+	.quad	.LFE2380-.LFB2380
+	.quad	.LFB2381
+	.quad	.LFE2381-.LFB2381
+	.quad	.LFB2382
+	.quad	.LFE2382-.LFB2382
+	.quad	.LFB2479
+	.quad	.LFE2479-.LFB2479
+	.quad	.LFB2481
+	.quad	.LFE2481-.LFB2481
+	.quad	.LFB2482
+	.quad	.LFE2482-.LFB2482
+	.quad	.LFB2483
+	.quad	.LFE2483-.LFB2483
+	.quad	.LFB2484
+	.quad	.LFE2484-.LFB2484
+	.quad	.LFB2488
+	.quad	.LFE2488-.LFB2488
+	.quad	.LFB2489
+	.quad	.LFE2489-.LFB2489
+	.quad	.LFB2496
+	.quad	.LFE2496-.LFB2496
+	.quad	.LFB2553
+	.quad	.LFE2553-.LFB2553
+	.quad	.LFB2554
+	.quad	.LFE2554-.LFB2554
+	.quad	.LFB2555
+	.quad	.LFE2555-.LFB2555
+	.quad	.LFB2556
+	.quad	.LFE2556-.LFB2556
+	.quad	.LFB2557
+	.quad	.LFE2557-.LFB2557
+	.quad	.LFB2558
+	.quad	.LFE2558-.LFB2558
+	.quad	.LFB2559
+	.quad	.LFE2559-.LFB2559
+	.quad	.LFB2609
+	.quad	.LFE2609-.LFB2609
+	.quad	.LFB2610
+	.quad	.LFE2610-.LFB2610
+	.quad	.LFB2611
+	.quad	.LFE2611-.LFB2611
+	.quad	.LFB2612
+	.quad	.LFE2612-.LFB2612
+	.quad	.LFB2613
+	.quad	.LFE2613-.LFB2613
+	.quad	.LFB2614
+	.quad	.LFE2614-.LFB2614
+	.quad	.LFB2615
+	.quad	.LFE2615-.LFB2615
+	.quad	.LFB2616
+	.quad	.LFE2616-.LFB2616
+	.quad	.LFB2617
+	.quad	.LFE2617-.LFB2617
+	.quad	.LFB2636
+	.quad	.LFE2636-.LFB2636
+	.quad	.LFB2637
+	.quad	.LFE2637-.LFB2637
+	.quad	.LFB2638
+	.quad	.LFE2638-.LFB2638
+	.quad	.LFB2639
+	.quad	.LFE2639-.LFB2639
+	.quad	.LFB2640
+	.quad	.LFE2640-.LFB2640
+	.quad	.LFB2649
+	.quad	.LFE2649-.LFB2649
+	.quad	.LFB2650
+	.quad	.LFE2650-.LFB2650
+	.quad	.LFB2651
+	.quad	.LFE2651-.LFB2651
+	.quad	.LFB2652
+	.quad	.LFE2652-.LFB2652
+	.quad	.LFB2656
+	.quad	.LFE2656-.LFB2656
+	.quad	.LFB2657
+	.quad	.LFE2657-.LFB2657
+	.quad	.LFB2658
+	.quad	.LFE2658-.LFB2658
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL0:
+	.byte	0x5
+	.quad	.LBB39
+	.byte	0x4
+	.uleb128 .LBB39-.LBB39
+	.uleb128 .LBE39-.LBB39
+	.byte	0x4
+	.uleb128 .LBB45-.LBB39
+	.uleb128 .LBE45-.LBB39
+	.byte	0x4
+	.uleb128 .LBB46-.LBB39
+	.uleb128 .LBE46-.LBB39
+	.byte	0
+.LLRL1:
+	.byte	0x5
+	.quad	.LBB41
+	.byte	0x4
+	.uleb128 .LBB41-.LBB41
+	.uleb128 .LBE41-.LBB41
+	.byte	0x4
+	.uleb128 .LBB42-.LBB41
+	.uleb128 .LBE42-.LBB41
+	.byte	0
+.LLRL2:
+	.byte	0x7
+	.quad	.Ltext0
+	.uleb128 .Letext0-.Ltext0
+	.byte	0x7
+	.quad	.LFB1
+	.uleb128 .LFE1-.LFB1
+	.byte	0x7
+	.quad	.LFB314
+	.uleb128 .LFE314-.LFB314
+	.byte	0x7
+	.quad	.LFB408
+	.uleb128 .LFE408-.LFB408
+	.byte	0x7
+	.quad	.LFB669
+	.uleb128 .LFE669-.LFB669
+	.byte	0x7
+	.quad	.LFB874
+	.uleb128 .LFE874-.LFB874
+	.byte	0x7
+	.quad	.LFB2032
+	.uleb128 .LFE2032-.LFB2032
+	.byte	0x7
+	.quad	.LFB2034
+	.uleb128 .LFE2034-.LFB2034
+	.byte	0x7
+	.quad	.LFB2036
+	.uleb128 .LFE2036-.LFB2036
+	.byte	0x7
+	.quad	.LFB2091
+	.uleb128 .LFE2091-.LFB2091
+	.byte	0x7
+	.quad	.LFB2366
+	.uleb128 .LFE2366-.LFB2366
+	.byte	0x7
+	.quad	.LFB2369
+	.uleb128 .LFE2369-.LFB2369
+	.byte	0x7
+	.quad	.LFB2372
+	.uleb128 .LFE2372-.LFB2372
+	.byte	0x7
+	.quad	.LFB2374
+	.uleb128 .LFE2374-.LFB2374
+	.byte	0x7
+	.quad	.LFB2376
+	.uleb128 .LFE2376-.LFB2376
+	.byte	0x7
+	.quad	.LFB2380
+	.uleb128 .LFE2380-.LFB2380
+	.byte	0x7
+	.quad	.LFB2381
+	.uleb128 .LFE2381-.LFB2381
+	.byte	0x7
+	.quad	.LFB2382
+	.uleb128 .LFE2382-.LFB2382
+	.byte	0x7
+	.quad	.LFB2479
+	.uleb128 .LFE2479-.LFB2479
+	.byte	0x7
+	.quad	.LFB2481
+	.uleb128 .LFE2481-.LFB2481
+	.byte	0x7
+	.quad	.LFB2482
+	.uleb128 .LFE2482-.LFB2482
+	.byte	0x7
+	.quad	.LFB2483
+	.uleb128 .LFE2483-.LFB2483
+	.byte	0x7
+	.quad	.LFB2484
+	.uleb128 .LFE2484-.LFB2484
+	.byte	0x7
+	.quad	.LFB2488
+	.uleb128 .LFE2488-.LFB2488
+	.byte	0x7
+	.quad	.LFB2489
+	.uleb128 .LFE2489-.LFB2489
+	.byte	0x7
+	.quad	.LFB2496
+	.uleb128 .LFE2496-.LFB2496
+	.byte	0x7
+	.quad	.LFB2553
+	.uleb128 .LFE2553-.LFB2553
+	.byte	0x7
+	.quad	.LFB2554
+	.uleb128 .LFE2554-.LFB2554
+	.byte	0x7
+	.quad	.LFB2555
+	.uleb128 .LFE2555-.LFB2555
+	.byte	0x7
+	.quad	.LFB2556
+	.uleb128 .LFE2556-.LFB2556
+	.byte	0x7
+	.quad	.LFB2557
+	.uleb128 .LFE2557-.LFB2557
+	.byte	0x7
+	.quad	.LFB2558
+	.uleb128 .LFE2558-.LFB2558
+	.byte	0x7
+	.quad	.LFB2559
+	.uleb128 .LFE2559-.LFB2559
+	.byte	0x7
+	.quad	.LFB2609
+	.uleb128 .LFE2609-.LFB2609
+	.byte	0x7
+	.quad	.LFB2610
+	.uleb128 .LFE2610-.LFB2610
+	.byte	0x7
+	.quad	.LFB2611
+	.uleb128 .LFE2611-.LFB2611
+	.byte	0x7
+	.quad	.LFB2612
+	.uleb128 .LFE2612-.LFB2612
+	.byte	0x7
+	.quad	.LFB2613
+	.uleb128 .LFE2613-.LFB2613
+	.byte	0x7
+	.quad	.LFB2614
+	.uleb128 .LFE2614-.LFB2614
+	.byte	0x7
+	.quad	.LFB2615
+	.uleb128 .LFE2615-.LFB2615
+	.byte	0x7
+	.quad	.LFB2616
+	.uleb128 .LFE2616-.LFB2616
+	.byte	0x7
+	.quad	.LFB2617
+	.uleb128 .LFE2617-.LFB2617
+	.byte	0x7
+	.quad	.LFB2636
+	.uleb128 .LFE2636-.LFB2636
+	.byte	0x7
+	.quad	.LFB2637
+	.uleb128 .LFE2637-.LFB2637
+	.byte	0x7
+	.quad	.LFB2638
+	.uleb128 .LFE2638-.LFB2638
+	.byte	0x7
+	.quad	.LFB2639
+	.uleb128 .LFE2639-.LFB2639
+	.byte	0x7
+	.quad	.LFB2640
+	.uleb128 .LFE2640-.LFB2640
+	.byte	0x7
+	.quad	.LFB2649
+	.uleb128 .LFE2649-.LFB2649
+	.byte	0x7
+	.quad	.LFB2650
+	.uleb128 .LFE2650-.LFB2650
+	.byte	0x7
+	.quad	.LFB2651
+	.uleb128 .LFE2651-.LFB2651
+	.byte	0x7
+	.quad	.LFB2652
+	.uleb128 .LFE2652-.LFB2652
+	.byte	0x7
+	.quad	.LFB2656
+	.uleb128 .LFE2656-.LFB2656
+	.byte	0x7
+	.quad	.LFB2657
+	.uleb128 .LFE2657-.LFB2657
+	.byte	0x7
+	.quad	.LFB2658
+	.uleb128 .LFE2658-.LFB2658
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF440
+	.file 59 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 60 "/usr/include/c++/12/algorithm"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF447
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF448
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 61 "/usr/include/x86_64-linux-gnu/c++/12/bits/os_defines.h"
+	.byte	0x3
+	.uleb128 0x28f
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 62 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 63 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x3f
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x41
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF599
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 66 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF674
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.file 68 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x44
+	.file 69 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.file 70 "/usr/include/x86_64-linux-gnu/c++/12/bits/cpu_defines.h"
+	.byte	0x3
+	.uleb128 0x292
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF704
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 71 "/usr/include/c++/12/pstl/pstl_config.h"
+	.byte	0x3
+	.uleb128 0x349
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1001
+	.file 72 "/usr/include/c++/12/bits/exception_defines.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x4
+	.file 73 "/usr/include/c++/12/bits/cpp_type_traits.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.file 74 "/usr/include/c++/12/ext/type_traits.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1009
+	.byte	0x4
+	.file 75 "/usr/include/c++/12/ext/numeric_traits.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 76 "/usr/include/c++/12/bits/stl_pair.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x4c
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1021
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 77 "/usr/include/c++/12/bits/utility.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1048
+	.byte	0x4
+	.file 78 "/usr/include/c++/12/bits/stl_iterator_base_funcs.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1049
+	.file 79 "/usr/include/c++/12/bits/concept_check.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 80 "/usr/include/c++/12/debug/assertions.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1063
+	.file 81 "/usr/include/c++/12/bits/ptr_traits.h"
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1064
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1091
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 82 "/usr/include/c++/12/bits/stl_algo.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1095
+	.file 83 "/usr/include/c++/12/bits/algorithmfwd.h"
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x53
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1096
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1097
+	.byte	0x4
+	.byte	0x4
+	.file 84 "/usr/include/c++/12/bits/stl_heap.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1098
+	.byte	0x4
+	.file 85 "/usr/include/c++/12/bits/stl_tempbuf.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x55
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1099
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1100
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1101
+	.file 86 "/usr/include/c++/12/bits/exception.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x56
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1102
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 87 "/usr/include/c++/12/bits/uniform_int_dist.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1105
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1108
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1167
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 91 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x5b
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 92 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x5c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1203
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF674
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 93 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0x111
+	.uleb128 0x5d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1231
+	.file 94 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1232
+	.byte	0x4
+	.byte	0x4
+	.file 95 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x5f
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1233
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1234
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x41
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF599
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 96 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 97 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x61
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF1294
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1310
+	.byte	0x4
+	.file 98 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x62
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1311
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1312
+	.byte	0x4
+	.file 99 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x63
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1313
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1316
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1317
+	.file 100 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x64
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1318
+	.file 101 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.file 102 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x66
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 103 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x67
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 104 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x68
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1335
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 105 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x69
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1348
+	.file 106 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x6a
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 107 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x6b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1353
+	.file 108 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x4
+	.file 109 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x6d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1356
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1357
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 110 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x6e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1373
+	.file 111 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x6f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1374
+	.file 112 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x70
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1375
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 113 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x71
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1387
+	.byte	0x4
+	.file 114 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x72
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 115 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x73
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1394
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1395
+	.byte	0x4
+	.byte	0x4
+	.file 116 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x74
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1399
+	.file 117 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x75
+	.byte	0x4
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1400
+	.file 118 "/usr/include/c++/12/bits/std_abs.h"
+	.byte	0x3
+	.uleb128 0x4d
+	.uleb128 0x76
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 119 "/usr/include/c++/12/pstl/glue_algorithm_defs.h"
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x77
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1441
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1442
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1445
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1446
+	.file 120 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x78
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 121 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x79
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1455
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1551
+	.byte	0x4
+	.file 122 "/usr/include/c++/12/bits/atomic_lockfree_defines.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x7a
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1569
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.file 123 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x7b
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1575
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.file 124 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x7c
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.file 125 "/usr/include/x86_64-linux-gnu/bits/timex.h"
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x7d
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1656
+	.byte	0x4
+	.file 126 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x7e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1657
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.file 127 "/usr/include/c++/12/string"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x7f
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1671
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1672
+	.file 128 "/usr/include/c++/12/bits/memoryfwd.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x80
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1673
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1674
+	.file 129 "/usr/include/c++/12/bits/postypes.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x81
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1675
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1677
+	.file 130 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x82
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1682
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1683
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1684
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1685
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1749
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1750
+	.file 131 "/usr/include/x86_64-linux-gnu/c++/12/bits/c++allocator.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x83
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1751
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.file 132 "/usr/include/c++/12/bits/localefwd.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x84
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1761
+	.file 133 "/usr/include/x86_64-linux-gnu/c++/12/bits/c++locale.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x85
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1762
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.byte	0x4
+	.file 134 "/usr/include/x86_64-linux-gnu/bits/locale.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x86
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro93
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro94
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro95
+	.byte	0x4
+	.file 135 "/usr/include/c++/12/iosfwd"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x87
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1810
+	.byte	0x4
+	.file 136 "/usr/include/c++/12/cctype"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x88
+	.file 137 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x89
+	.byte	0x7
+	.long	.Ldebug_macro96
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro97
+	.byte	0x4
+	.byte	0x4
+	.file 138 "/usr/include/c++/12/bits/ostream_insert.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x8a
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1834
+	.file 139 "/usr/include/c++/12/bits/cxxabi_forced.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x8b
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1835
+	.byte	0x4
+	.byte	0x4
+	.file 140 "/usr/include/c++/12/bits/stl_function.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x8c
+	.byte	0x7
+	.long	.Ldebug_macro98
+	.file 141 "/usr/include/c++/12/backward/binders.h"
+	.byte	0x3
+	.uleb128 0x59e
+	.uleb128 0x8d
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1838
+	.byte	0x4
+	.byte	0x4
+	.file 142 "/usr/include/c++/12/bits/refwrap.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x8e
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1839
+	.file 143 "/usr/include/c++/12/bits/invoke.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x8f
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1840
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro99
+	.byte	0x4
+	.file 144 "/usr/include/c++/12/bits/range_access.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x90
+	.byte	0x7
+	.long	.Ldebug_macro100
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1847
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1848
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro101
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1851
+	.file 145 "/usr/include/c++/12/bits/functional_hash.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x91
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1852
+	.file 146 "/usr/include/c++/12/bits/hash_bytes.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x92
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1853
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro102
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1856
+	.file 147 "/usr/include/c++/12/bits/string_view.tcc"
+	.byte	0x3
+	.uleb128 0x32b
+	.uleb128 0x93
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1857
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1858
+	.file 148 "/usr/include/c++/12/ext/string_conversions.h"
+	.byte	0x3
+	.uleb128 0xf78
+	.uleb128 0x94
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1859
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x1a
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro103
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro104
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1677
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x82
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF1678
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1861
+	.byte	0x4
+	.file 149 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x95
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1862
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro105
+	.byte	0x4
+	.file 150 "/usr/include/x86_64-linux-gnu/bits/types/cookie_io_functions_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x96
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1871
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro106
+	.file 151 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x97
+	.byte	0x7
+	.long	.Ldebug_macro107
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro108
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro109
+	.byte	0x4
+	.file 152 "/usr/include/c++/12/cerrno"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x98
+	.file 153 "/usr/include/errno.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x99
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1947
+	.file 154 "/usr/include/x86_64-linux-gnu/bits/errno.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x9a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1948
+	.file 155 "/usr/include/linux/errno.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9b
+	.file 156 "/usr/include/x86_64-linux-gnu/asm/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x9c
+	.file 157 "/usr/include/asm-generic/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x9d
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1949
+	.file 158 "/usr/include/asm-generic/errno-base.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x9e
+	.byte	0x7
+	.long	.Ldebug_macro110
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro111
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2084
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2085
+	.file 159 "/usr/include/x86_64-linux-gnu/bits/types/error_t.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x9f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2086
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2087
+	.byte	0x4
+	.byte	0x4
+	.file 160 "/usr/include/c++/12/bits/charconv.h"
+	.byte	0x3
+	.uleb128 0xf79
+	.uleb128 0xa0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2088
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro112
+	.byte	0x4
+	.file 161 "/usr/include/c++/12/bits/basic_string.tcc"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0xa1
+	.byte	0x7
+	.long	.Ldebug_macro113
+	.byte	0x4
+	.byte	0x4
+	.file 162 "/usr/include/c++/12/vector"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0xa2
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2093
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro114
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro115
+	.byte	0x4
+	.file 163 "/usr/include/c++/12/bits/stl_bvector.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0xa3
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2104
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro116
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2110
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cconfig.h.31.df082077f834a39f35188f826939cbaf,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1b8
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x1c1
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF500
+	.byte	0x6
+	.uleb128 0x1c8
+	.long	.LASF501
+	.byte	0x6
+	.uleb128 0x1cd
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x274
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF517
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.os_defines.h.31.00ac2dfcc18ce0a4ccd7d724c7e326ea,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF519
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.8bb74df3432ebf32d12aa273dc4e2b55,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF522
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF523
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF525
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF527
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF528
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF529
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF530
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF531
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF532
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF533
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF534
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF535
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF536
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF537
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF538
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF539
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF540
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF541
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF542
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF543
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF544
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF546
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF569
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF571
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF573
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF575
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF578
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF579
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF586
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF579
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF595
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF598
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF611
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.3f6fbb2e3c0c264dcfdfde864c5fdd1b,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF612
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF659
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF671
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF673
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.b7837895c567d58e9cee3302a50c1713,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF699
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.os_defines.h.45.f148d4a84cf4a3ecbc01407f292c5e79,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF703
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cconfig.h.663.a93c6e25512001f7d5462d991a9bab78,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x2b9
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x2cd
+	.long	.LASF712
+	.byte	0x2
+	.uleb128 0x2d0
+	.string	"min"
+	.byte	0x2
+	.uleb128 0x2d1
+	.string	"max"
+	.byte	0x5
+	.uleb128 0x2d7
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x2dd
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x2e0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x315
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x31d
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x326
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF725
+	.byte	0x6
+	.uleb128 0x331
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x341
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF730
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pstl_config.h.11.160effd7011329c1d43041d1565e18a1,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF771
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cconfig.h.850.7229f6afd40226d28eea9e8579fdf96f,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x352
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x355
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x35b
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x35e
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x364
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x367
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x36d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x370
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x376
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x379
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x37f
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x382
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x388
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x38b
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x391
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x39b
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x3a4
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x3ad
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x3b6
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x3bf
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x3c8
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x3d1
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x3e3
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x3ec
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x3f5
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x410
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x419
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x42b
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x434
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x43d
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x45b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x45e
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x467
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x46a
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x476
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x479
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x498
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x49b
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x4ad
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x4b3
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x4b6
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x4b9
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x4cb
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x4dd
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x4ed
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x4fc
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x50b
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x50e
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x511
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x514
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x517
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x520
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x523
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x526
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x529
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x52c
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x52f
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x532
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x535
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x538
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x53b
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x541
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x544
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x54a
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x54d
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x550
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x553
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x556
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x559
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x55c
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x562
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x62b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x62e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x632
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x638
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x63b
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x63e
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x641
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x644
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x647
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x659
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x660
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x669
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x66d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x671
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x675
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x679
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x67e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x682
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x686
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x68a
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x68e
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x691
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x698
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x69b
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x69e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x6a6
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x6b2
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x6b8
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x6bb
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x6be
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x6c1
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x6c7
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x6d1
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x6d5
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x6da
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x6de
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x6e2
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x6e6
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x6ea
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x6ee
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x6f2
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x6f9
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x6fc
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x700
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x704
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x707
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x70a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x70d
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x710
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x713
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x716
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x719
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x71c
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x71f
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x725
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x728
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x72c
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x72f
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x733
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x736
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x739
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x73c
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x742
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x748
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x74e
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x752
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x756
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x759
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x75d
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x760
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x763
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x766
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x769
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x76c
+	.long	.LASF1000
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.exception_defines.h.31.ca6841b9be3287386aafc5c717935b2e,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1005
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cpp_type_traits.h.33.b2288289d5c7729e9da760b2466185ce,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x11c
+	.long	.LASF1008
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.numeric_traits.h.30.957646dabc9a8fb118982f20f532c073,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1016
+	.byte	0x6
+	.uleb128 0xb5
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0xb6
+	.long	.LASF1018
+	.byte	0x6
+	.uleb128 0xb7
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0xb8
+	.long	.LASF1020
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.type_traits.30.75af74c7e9830e1b4beccd1a5f43dc02,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x63d
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x966
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xa4a
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xa72
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0xad3
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0xbca
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0xc20
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xce3
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0xcf7
+	.long	.LASF1036
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.move.h.31.5af84b00763b00bcae296ba743af608b,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1041
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.utility.h.34.dd9cf844d8a4a9176a3f477269f82bef,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1044
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stl_pair.h.452.a6f34712c2fc60d9a2cdfa651049c735,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x20d
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1047
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.concept_check.h.31.f19605d278e56917c68a56d378be308c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1055
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.assertions.h.30.4b26900d71edbfc7f7e26fdb00cf8caf,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1062
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stl_iterator.h.77.2bf5837b394bf8fec5da6eede2a468c2,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xa0d
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xa0e
+	.long	.LASF1068
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.debug.h.30.14675c66734128005fe180e1012feff9,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1090
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stl_algobase.h.656.e99e6c2c242c7feaa3d42a9ce1f8245f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x670
+	.long	.LASF1094
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.new.189.2cd7ee79d5ffcb5e2c57e673dc7076ea,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1104
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cstdlib.44.52c5efdfb0f3c176bd11e611a0b94959,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1107
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1109
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1111
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1115
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1117
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1121
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1123
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1126
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.a9c6b5033e0435729857614eafcaa7c4,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1144
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1161
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1166
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1176
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1188
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1195
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.8017ac324f1165161bc8e1ff29a2719b,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1202
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.636061892ab0c3d217b3470ad02277d6,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1224
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1230
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1249
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1291
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1293
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.40.18f72bab8242c2bb4c532a2aa95b5f00,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1309
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.135.9eeb6b52c2522ad7aff16ad95342972e,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1124
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1166
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1322
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1324
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1326
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1330
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1334
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1347
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1352
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1355
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.52.4f882364bb7424384ae71496b52638dc,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1368
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1372
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1386
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1390
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1124
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1398
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.std_abs.h.31.4587ba001d85390d152353c24c92c0c8,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1107
+	.byte	0x6
+	.uleb128 0x2a
+	.long	.LASF1400
+	.byte	0x2
+	.uleb128 0x2c
+	.string	"abs"
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cstdlib.80.27624e0a6399c87156de13aacc7f184d,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1402
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1403
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1407
+	.byte	0x6
+	.uleb128 0x5c
+	.long	.LASF1408
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1409
+	.byte	0x6
+	.uleb128 0x5e
+	.long	.LASF1410
+	.byte	0x2
+	.uleb128 0x5f
+	.string	"div"
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF1411
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1412
+	.byte	0x6
+	.uleb128 0x62
+	.long	.LASF1413
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1414
+	.byte	0x6
+	.uleb128 0x64
+	.long	.LASF1415
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1416
+	.byte	0x6
+	.uleb128 0x66
+	.long	.LASF1417
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1418
+	.byte	0x6
+	.uleb128 0x68
+	.long	.LASF1419
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1420
+	.byte	0x6
+	.uleb128 0x6c
+	.long	.LASF1421
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1422
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1423
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1424
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1425
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1426
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1427
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1428
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1429
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1430
+	.byte	0x6
+	.uleb128 0xba
+	.long	.LASF1431
+	.byte	0x6
+	.uleb128 0xbb
+	.long	.LASF1432
+	.byte	0x6
+	.uleb128 0xbc
+	.long	.LASF1433
+	.byte	0x6
+	.uleb128 0xbd
+	.long	.LASF1434
+	.byte	0x6
+	.uleb128 0xbe
+	.long	.LASF1435
+	.byte	0x6
+	.uleb128 0xbf
+	.long	.LASF1436
+	.byte	0x6
+	.uleb128 0xc0
+	.long	.LASF1437
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF1438
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stl_algo.h.3606.47e82be5ff2ba38e0f24334558556f04,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xe16
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x16e5
+	.long	.LASF1440
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.algorithm.74.ae62b22c0b7153ce15e165b57163fb60,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1444
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.4.659be5aa44c4ab4eb7c7cc2b24d8ceee,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x4
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1448
+	.byte	0x6
+	.uleb128 0x6
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1450
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1108
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1454
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1550
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.atomic_lockfree_defines.h.31.da6db0ab2dffa9ec5b0c3458204c2db5,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1562
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.atomic_base.h.45.cba1d7adb36c4f47959604effad3324b,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1566
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.atomic.53.133eecb7bc17633faa2def8e3e0d68c4,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1564
+	.byte	0x6
+	.uleb128 0x19b
+	.long	.LASF1568
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1108
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1126
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.d09d9f11d864d06cb637bfdc57d51c58,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1166
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.38.5e57f557920b43aac91880039d9f0c7a,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1573
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1124
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cstring.45.6ab09de7fb97b576e744347688ddc8d7,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1576
+	.byte	0x6
+	.uleb128 0x30
+	.long	.LASF1577
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1578
+	.byte	0x6
+	.uleb128 0x32
+	.long	.LASF1579
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1580
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1581
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1582
+	.byte	0x6
+	.uleb128 0x36
+	.long	.LASF1583
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1584
+	.byte	0x6
+	.uleb128 0x38
+	.long	.LASF1585
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1586
+	.byte	0x6
+	.uleb128 0x3a
+	.long	.LASF1587
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1588
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1589
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1590
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1591
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1592
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1593
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1594
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1595
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1596
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1597
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1598
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1126
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1613
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.timex.h.19.68c3118fc57dd4af71155e57fb45153a,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1655
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time.h.65.ad8b7cdf304665ee800a89090a0d61aa,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1659
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.ctime.45.7776db63ea95fa3a7f790b607da2ad08,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1660
+	.byte	0x6
+	.uleb128 0x30
+	.long	.LASF1661
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1662
+	.byte	0x6
+	.uleb128 0x32
+	.long	.LASF1663
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1664
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1665
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1666
+	.byte	0x6
+	.uleb128 0x36
+	.long	.LASF1667
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1668
+	.byte	0x6
+	.uleb128 0x38
+	.long	.LASF1669
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1670
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.24.10c1a3649a347ee5acc556316eedb15a,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1108
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.32.859ec9de6e76762773b13581955bbb2b,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1126
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.7fd16e771e5a0d39b1003075da64d7ac,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1166
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1679
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wint_t.h.2.b153cb48df5337e6e56fe1404a1b29c5,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1681
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.54.46f5a6b49c3c455da808167e015392d9,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1688
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cwchar.48.a808e6bf69aa5ec51aed28c280b25195,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1689
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1690
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1691
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1692
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1693
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1694
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1695
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1696
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1697
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1698
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1699
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1700
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1701
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1702
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1703
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1704
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1705
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1706
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1707
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1708
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1709
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1710
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1711
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1712
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1713
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1714
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1715
+	.byte	0x6
+	.uleb128 0x64
+	.long	.LASF1716
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1717
+	.byte	0x6
+	.uleb128 0x66
+	.long	.LASF1718
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1719
+	.byte	0x6
+	.uleb128 0x68
+	.long	.LASF1720
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1721
+	.byte	0x6
+	.uleb128 0x6a
+	.long	.LASF1722
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1723
+	.byte	0x6
+	.uleb128 0x6c
+	.long	.LASF1724
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1725
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1726
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1727
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1728
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1729
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1730
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1731
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1732
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1733
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1734
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1735
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1736
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1737
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1738
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1739
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1740
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1741
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1742
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1743
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF1744
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1745
+	.byte	0x6
+	.uleb128 0xf0
+	.long	.LASF1746
+	.byte	0x6
+	.uleb128 0xf1
+	.long	.LASF1747
+	.byte	0x6
+	.uleb128 0xf2
+	.long	.LASF1748
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.new_allocator.h.31.a11ca39dca7f3a187f4fe84911a0c01e,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1755
+	.byte	0x6
+	.uleb128 0xa1
+	.long	.LASF1756
+	.byte	0x6
+	.uleb128 0xa2
+	.long	.LASF1757
+	.byte	0x6
+	.uleb128 0xa3
+	.long	.LASF1758
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.allocator.h.52.d59538e198940f2c9c98ac32d87130d0,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1759
+	.byte	0x6
+	.uleb128 0x10b
+	.long	.LASF1760
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.locale.h.23.9b5006b0bf779abe978bf85cb308a947,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1126
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.399.7a3102024c6edbb40a4d2d700b0cfd8b,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1166
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.locale.h.24.c0c42b9681163ce124f9e0123f9f1018,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1777
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.locale.h.35.3ee615a657649f1422c6ddf5c47af7af,comdat
+.Ldebug_macro93:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1804
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.clocale.45.c36d2d5b631a875aa5273176b54fdf0f,comdat
+.Ldebug_macro94:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1805
+	.byte	0x6
+	.uleb128 0x30
+	.long	.LASF1806
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1807
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.clocale.h.43.6fb8f0ab2ff3c0d6599e5be7ec2cdfb5,comdat
+.Ldebug_macro95:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1809
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.ctype.h.23.61a99fb2d9a53286fbe40801035355a7,comdat
+.Ldebug_macro96:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1818
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cctype.45.0da5714876b0be7f2d816b53d9670403,comdat
+.Ldebug_macro97:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1819
+	.byte	0x6
+	.uleb128 0x30
+	.long	.LASF1820
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1821
+	.byte	0x6
+	.uleb128 0x32
+	.long	.LASF1822
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1823
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1824
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1825
+	.byte	0x6
+	.uleb128 0x36
+	.long	.LASF1826
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1827
+	.byte	0x6
+	.uleb128 0x38
+	.long	.LASF1828
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1829
+	.byte	0x6
+	.uleb128 0x3a
+	.long	.LASF1830
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1831
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1832
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1833
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stl_function.h.57.e56de502139ad017ca0a60ed04a45b1d,comdat
+.Ldebug_macro98:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1837
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.refwrap.h.83.ff9e1880dda1ffdebe61bc6f06312903,comdat
+.Ldebug_macro99:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1842
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1843
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1844
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.range_access.h.31.6250e60d28cd752dc5288e0a9eafbde0,comdat
+.Ldebug_macro100:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1846
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloc_traits.h.31.49d5a5cdb30935564af2ee0e81ac7289,comdat
+.Ldebug_macro101:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1850
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.functional_hash.h.115.65cf6efd7a84eda722b763626a008a7b,comdat
+.Ldebug_macro102:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1854
+	.byte	0x6
+	.uleb128 0xc7
+	.long	.LASF1855
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro103:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1108
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro104:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1126
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro105:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1870
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.53.cf5f00b4593d5e549db7a2d61cb78f91,comdat
+.Ldebug_macro106:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1883
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio_lim.h.19.86760ef34d2b7513aac6ce30cb73c6f8,comdat
+.Ldebug_macro107:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1889
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1891
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.138.ba977b5ae4e90303e95ec5db0bd05792,comdat
+.Ldebug_macro108:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1898
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1900
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cstdio.45.1ffaea3e7c26dce1e03f5847a7439edb,comdat
+.Ldebug_macro109:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1901
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1902
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1903
+	.byte	0x6
+	.uleb128 0x36
+	.long	.LASF1904
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1905
+	.byte	0x6
+	.uleb128 0x38
+	.long	.LASF1906
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1907
+	.byte	0x6
+	.uleb128 0x3a
+	.long	.LASF1908
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1909
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1910
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1911
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1912
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1913
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1914
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1915
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1916
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1917
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1918
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1919
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1920
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1921
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1922
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1923
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1924
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1925
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1926
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1927
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1928
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1929
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1930
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1931
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1932
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1933
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1934
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1935
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1936
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1937
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1938
+	.byte	0x6
+	.uleb128 0x5c
+	.long	.LASF1939
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1940
+	.byte	0x6
+	.uleb128 0x5e
+	.long	.LASF1941
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF1942
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF1943
+	.byte	0x6
+	.uleb128 0x99
+	.long	.LASF1944
+	.byte	0x6
+	.uleb128 0x9a
+	.long	.LASF1945
+	.byte	0x6
+	.uleb128 0x9b
+	.long	.LASF1946
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.errnobase.h.3.496c97749cc421db8c7f3a88bb19be3e,comdat
+.Ldebug_macro110:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1984
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.errno.h.7.abb72fb4c24e8d4d14afee66cc0be915,comdat
+.Ldebug_macro111:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2083
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.basic_string.h.4312.435c4ebd7c0e4911685d1ad64cb019c1,comdat
+.Ldebug_macro112:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x10d8
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x10e4
+	.long	.LASF2090
+	.byte	0x6
+	.uleb128 0x1102
+	.long	.LASF2091
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.basic_string.tcc.40.04c61d5139c0f95c983b2c44518d88b7,comdat
+.Ldebug_macro113:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF2090
+	.byte	0x6
+	.uleb128 0x3a7
+	.long	.LASF2091
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stl_uninitialized.h.57.d6534ca7342d60742d4dd46c1751601c,comdat
+.Ldebug_macro114:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2095
+	.byte	0x6
+	.uleb128 0x14a
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2097
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stl_vector.h.57.d2d0b8a1f885ab5ababffbbd81191f29,comdat
+.Ldebug_macro115:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF2103
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.vector.tcc.57.08a6a9ad9893483e5dbb662b6b977795,comdat
+.Ldebug_macro116:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2105
+	.byte	0x6
+	.uleb128 0x407
+	.long	.LASF2106
+	.byte	0x6
+	.uleb128 0x408
+	.long	.LASF2107
+	.byte	0x6
+	.uleb128 0x409
+	.long	.LASF2108
+	.byte	0x6
+	.uleb128 0x40a
+	.long	.LASF2109
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF2316:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5emptyEv"
+.LASF999:
+	.string	"_GLIBCXX_X86_RDSEED 1"
+.LASF2193:
+	.string	"_ZNSt13__atomic_baseImE8exchangeEmSt12memory_order"
+.LASF2903:
+	.string	"long long int"
+.LASF156:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF923:
+	.string	"_GLIBCXX_HAVE_WCHAR_H 1"
+.LASF1440:
+	.string	"__cpp_lib_sample 201603L"
+.LASF1232:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF370:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF711:
+	.string	"_GLIBCXX_FAST_MATH 0"
+.LASF1481:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF2342:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4findES2_m"
+.LASF3071:
+	.string	"positive_sign"
+.LASF638:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF1540:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF2714:
+	.string	"_ZNKSt6vectorIcSaIcEE4sizeEv"
+.LASF2574:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4swapERS4_"
+.LASF1667:
+	.string	"gmtime"
+.LASF118:
+	.string	"__cpp_inline_variables 201606L"
+.LASF1418:
+	.string	"mbstowcs"
+.LASF2568:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE14_M_replace_auxEmmmc"
+.LASF1864:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF838:
+	.string	"_GLIBCXX_HAVE_LIMIT_VMEM 0"
+.LASF997:
+	.string	"_GLIBCXX_VERBOSE 1"
+.LASF1219:
+	.string	"__f32x(x) x"
+.LASF218:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF387:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1113:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF2199:
+	.string	"_ZNVSt13__atomic_baseImE21compare_exchange_weakERmmSt12memory_order"
+.LASF869:
+	.string	"_GLIBCXX_HAVE_SINCOS 1"
+.LASF179:
+	.string	"__INT32_C(c) c"
+.LASF1167:
+	.string	"_STDLIB_H 1"
+.LASF1573:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1811:
+	.string	"_CTYPE_H 1"
+.LASF1847:
+	.string	"_BASIC_STRING_H 1"
+.LASF2198:
+	.string	"_ZNSt13__atomic_baseImE21compare_exchange_weakERmmSt12memory_order"
+.LASF444:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF2304:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE6rbeginEv"
+.LASF1951:
+	.string	"EPERM 1"
+.LASF1427:
+	.string	"strtoul"
+.LASF1823:
+	.string	"isdigit"
+.LASF1699:
+	.string	"getwchar"
+.LASF2898:
+	.string	"long unsigned int"
+.LASF517:
+	.string	"_GLIBCXX_USE_ALLOCATOR_NEW 1"
+.LASF1828:
+	.string	"isspace"
+.LASF181:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2955:
+	.string	"__pstl"
+.LASF1588:
+	.string	"strerror"
+.LASF321:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2441:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7_S_copyEPcPKcm"
+.LASF2810:
+	.string	"_InputIterator"
+.LASF1936:
+	.string	"tmpfile"
+.LASF2092:
+	.string	"_BASIC_STRING_TCC 1"
+.LASF335:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF3159:
+	.string	"offset"
+.LASF2968:
+	.string	"_ZN6__pstl9execution2v127parallel_unsequenced_policy19__allow_unsequencedEv"
+.LASF1944:
+	.string	"vscanf"
+.LASF163:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1770:
+	.string	"__LC_MESSAGES 5"
+.LASF2616:
+	.string	"initializer_list"
+.LASF1881:
+	.string	"SEEK_DATA 3"
+.LASF802:
+	.string	"_GLIBCXX_HAVE_FABSF 1"
+.LASF2063:
+	.string	"EHOSTUNREACH 113"
+.LASF615:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF3051:
+	.string	"_freeres_buf"
+.LASF1763:
+	.string	"_LOCALE_H 1"
+.LASF2720:
+	.string	"_ZNKSt6vectorIcSaIcEE5emptyEv"
+.LASF2415:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_M_set_lengthEm"
+.LASF2498:
+	.string	"shrink_to_fit"
+.LASF1566:
+	.string	"ATOMIC_FLAG_INIT { 0 }"
+.LASF2229:
+	.string	"_ZNVSt6atomicImEaSERKS0_"
+.LASF2619:
+	.string	"_ZNKSt16initializer_listIcE4sizeEv"
+.LASF724:
+	.string	"_GLIBCXX_HAVE_BUILTIN_IS_SAME 1"
+.LASF333:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF3139:
+	.string	"__al"
+.LASF2594:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12find_last_ofEPKcmm"
+.LASF1916:
+	.string	"fscanf"
+.LASF191:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF2203:
+	.string	"_ZNSt13__atomic_baseImE23compare_exchange_strongERmmSt12memory_order"
+.LASF2739:
+	.string	"_ZNSt6vectorIcSaIcEE6insertEN9__gnu_cxx17__normal_iteratorIPKcS1_EESt16initializer_listIcE"
+.LASF2502:
+	.string	"reserve"
+.LASF1320:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF2256:
+	.string	"_ZNSt11char_traitsIcE7not_eofERKi"
+.LASF2037:
+	.string	"EUSERS 87"
+.LASF2829:
+	.string	"__size_to_integer"
+.LASF2374:
+	.string	"_M_str"
+.LASF2490:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7crbeginEv"
+.LASF2599:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17find_first_not_ofEPKcm"
+.LASF3105:
+	.string	"get_capacity"
+.LASF1756:
+	.string	"_GLIBCXX_SIZED_DEALLOC"
+.LASF2421:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_M_disposeEv"
+.LASF2588:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5rfindEcm"
+.LASF88:
+	.string	"__cpp_lambdas 200907L"
+.LASF812:
+	.string	"_GLIBCXX_HAVE_FLOORL 1"
+.LASF354:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF663:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF479:
+	.string	"_GLIBCXX_USE_NOEXCEPT noexcept"
+.LASF1181:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF1677:
+	.string	"__need___va_list "
+.LASF2745:
+	.string	"_M_fill_initialize"
+.LASF1871:
+	.string	"__cookie_io_functions_t_defined 1"
+.LASF2108:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_GREW"
+.LASF2145:
+	.string	"~__atomic_base"
+.LASF2182:
+	.string	"is_lock_free"
+.LASF3065:
+	.string	"grouping"
+.LASF2307:
+	.string	"crbegin"
+.LASF129:
+	.string	"__STDCPP_DEFAULT_NEW_ALIGNMENT__ 16"
+.LASF1581:
+	.string	"memset"
+.LASF2132:
+	.string	"memory_order_relaxed"
+.LASF1551:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2998:
+	.string	"uintptr_t"
+.LASF2857:
+	.string	"__normal_iterator"
+.LASF363:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2822:
+	.string	"_Iter"
+.LASF2408:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7_M_dataEv"
+.LASF2459:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4Ev"
+.LASF132:
+	.string	"__STDCPP_THREADS__ 1"
+.LASF2971:
+	.string	"unsequenced_policy"
+.LASF2317:
+	.string	"operator[]"
+.LASF938:
+	.string	"_GLIBCXX11_USE_C99_COMPLEX 1"
+.LASF2575:
+	.string	"c_str"
+.LASF577:
+	.string	"__USE_ISOC11 1"
+.LASF3063:
+	.string	"decimal_point"
+.LASF2151:
+	.string	"_ZNVSt13__atomic_baseImEaSERKS0_"
+.LASF1380:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF2670:
+	.string	"__type_identity<std::allocator<char> >"
+.LASF301:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF991:
+	.string	"_GLIBCXX_USE_TMPNAM 1"
+.LASF2443:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7_S_moveEPcPKcm"
+.LASF1281:
+	.string	"__TIMER_T_TYPE void *"
+.LASF898:
+	.string	"_GLIBCXX_HAVE_SYS_SEM_H 1"
+.LASF626:
+	.string	"__STRING(x) #x"
+.LASF2366:
+	.string	"find_last_not_of"
+.LASF1758:
+	.string	"_GLIBCXX_OPERATOR_NEW"
+.LASF2795:
+	.string	"fill_n<char*, long unsigned int, char>"
+.LASF2320:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE2atEm"
+.LASF2705:
+	.string	"_ZNKSt6vectorIcSaIcEE3endEv"
+.LASF631:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF2742:
+	.string	"_ZNSt6vectorIcSaIcEE5eraseEN9__gnu_cxx17__normal_iteratorIPKcS1_EES6_"
+.LASF2159:
+	.string	"_ZNVSt13__atomic_baseImEppEi"
+.LASF529:
+	.string	"__USE_XOPEN"
+.LASF2769:
+	.string	"_ZNSt6vectorIcSaIcEE8_M_eraseEN9__gnu_cxx17__normal_iteratorIPcS1_EE"
+.LASF1083:
+	.string	"__glibcxx_requires_heap(_First,_Last) "
+.LASF2101:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_GREW(n) "
+.LASF2470:
+	.string	"~basic_string"
+.LASF2164:
+	.string	"_ZNVSt13__atomic_baseImEppEv"
+.LASF96:
+	.string	"__cpp_nsdmi 200809L"
+.LASF2589:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13find_first_ofERKS4_m"
+.LASF2451:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_S_copy_charsEPcPKcS7_"
+.LASF584:
+	.string	"__USE_POSIX199506 1"
+.LASF1641:
+	.string	"STA_PPSTIME 0x0004"
+.LASF3149:
+	.string	"position"
+.LASF1217:
+	.string	"__f32(x) x ##f"
+.LASF1661:
+	.string	"clock"
+.LASF250:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1938:
+	.string	"ungetc"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF2138:
+	.string	"memory_order"
+.LASF3017:
+	.string	"11__mbstate_t"
+.LASF2882:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEdeEv"
+.LASF1985:
+	.string	"EDEADLK 35"
+.LASF1321:
+	.string	"__BIG_ENDIAN 4321"
+.LASF2007:
+	.string	"EBADSLT 57"
+.LASF895:
+	.string	"_GLIBCXX_HAVE_SYS_PARAM_H 1"
+.LASF909:
+	.string	"_GLIBCXX_HAVE_TANHL 1"
+.LASF2790:
+	.string	"_ZSt8__fill_aIPccEvT_S1_RKT0_"
+.LASF2017:
+	.string	"ENOLINK 67"
+.LASF1940:
+	.string	"vprintf"
+.LASF858:
+	.string	"_GLIBCXX_HAVE_OPENAT 1"
+.LASF2181:
+	.string	"_ZNVSt13__atomic_baseImEeOEm"
+.LASF1439:
+	.string	"__cpp_lib_clamp 201603L"
+.LASF2393:
+	.string	"_M_allocated_capacity"
+.LASF697:
+	.string	"__stub_setlogin "
+.LASF1231:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2399:
+	.string	"__sv_wrapper"
+.LASF1801:
+	.string	"LC_MEASUREMENT_MASK (1 << __LC_MEASUREMENT)"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF256:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2937:
+	.string	"__intmax_t"
+.LASF2888:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEixEl"
+.LASF2429:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16_M_get_allocatorEv"
+.LASF236:
+	.string	"__DBL_MAX__ double(1.79769313486231570814527423731704357e+308L)"
+.LASF178:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF549:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1220:
+	.string	"__f64x(x) x ##l"
+.LASF637:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF3062:
+	.string	"lconv"
+.LASF300:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2179:
+	.string	"operator^="
+.LASF815:
+	.string	"_GLIBCXX_HAVE_FREXPF 1"
+.LASF878:
+	.string	"_GLIBCXX_HAVE_SQRTL 1"
+.LASF737:
+	.string	"_PSTL_PRAGMA(x) _Pragma(#x)"
+.LASF901:
+	.string	"_GLIBCXX_HAVE_SYS_STAT_H 1"
+.LASF3059:
+	.string	"__isoc99_vswscanf"
+.LASF513:
+	.string	"_GLIBCXX_SYNCHRONIZATION_HAPPENS_BEFORE(A) "
+.LASF1591:
+	.string	"strncmp"
+.LASF2865:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEppEi"
+.LASF940:
+	.string	"_GLIBCXX11_USE_C99_STDIO 1"
+.LASF1253:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF2650:
+	.string	"_ZNKSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv"
+.LASF2864:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEppEv"
+.LASF3057:
+	.string	"__isoc99_swscanf"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1583:
+	.string	"strchr"
+.LASF1339:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF2600:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17find_first_not_ofEcm"
+.LASF2067:
+	.string	"EUCLEAN 117"
+.LASF789:
+	.string	"_GLIBCXX_HAVE_COSF 1"
+.LASF1521:
+	.string	"UINT16_WIDTH 16"
+.LASF1647:
+	.string	"STA_PPSSIGNAL 0x0100"
+.LASF1009:
+	.string	"_EXT_TYPE_TRAITS 1"
+.LASF1788:
+	.string	"LC_TELEPHONE __LC_TELEPHONE"
+.LASF2373:
+	.string	"_M_len"
+.LASF1284:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1894:
+	.string	"stdout stdout"
+.LASF947:
+	.string	"_GLIBCXX98_USE_C99_WCHAR 1"
+.LASF917:
+	.string	"_GLIBCXX_HAVE_UNLINKAT 1"
+.LASF3184:
+	.string	"execution"
+.LASF1610:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF700:
+	.string	"_GLIBCXX_HAVE_GETS"
+.LASF438:
+	.string	"LOGGING 1"
+.LASF446:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF2806:
+	.string	"__addressof<char>"
+.LASF2597:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17find_first_not_ofERKS4_m"
+.LASF2257:
+	.string	"_CharT"
+.LASF1450:
+	.string	"__STDC_CONSTANT_MACROS "
+.LASF1655:
+	.string	"STA_RONLY (STA_PPSSIGNAL | STA_PPSJITTER | STA_PPSWANDER | STA_PPSERROR | STA_CLOCKERR | STA_NANO | STA_MODE | STA_CLK)"
+.LASF1913:
+	.string	"fputs"
+.LASF1006:
+	.string	"_CPP_TYPE_TRAITS_H 1"
+.LASF1499:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1145:
+	.string	"__need_size_t"
+.LASF1557:
+	.string	"ATOMIC_CHAR32_T_LOCK_FREE __GCC_ATOMIC_CHAR32_T_LOCK_FREE"
+.LASF3004:
+	.string	"tm_mday"
+.LASF2637:
+	.string	"_ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC4EOS2_"
+.LASF2174:
+	.string	"_ZNSt13__atomic_baseImEaNEm"
+.LASF2246:
+	.string	"assign"
+.LASF2458:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8_M_eraseEmm"
+.LASF365:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF772:
+	.string	"_GLIBCXX_HAVE_ACOSF 1"
+.LASF2641:
+	.string	"_Vector_impl"
+.LASF413:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1900:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF602:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF2979:
+	.string	"uint32_t"
+.LASF2267:
+	.string	"reference"
+.LASF1846:
+	.string	"__cpp_lib_nonmember_container_access 201411L"
+.LASF813:
+	.string	"_GLIBCXX_HAVE_FMODF 1"
+.LASF275:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF2242:
+	.string	"move"
+.LASF1917:
+	.string	"fseek"
+.LASF2511:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE2atEm"
+.LASF670:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF2677:
+	.string	"_S_use_relocate"
+.LASF109:
+	.string	"__cpp_namespace_attributes 201411L"
+.LASF2001:
+	.string	"EL2HLT 51"
+.LASF3058:
+	.string	"__isoc99_vfwscanf"
+.LASF3011:
+	.string	"tm_zone"
+.LASF884:
+	.string	"_GLIBCXX_HAVE_STRERROR_R 1"
+.LASF474:
+	.string	"_GLIBCXX20_CONSTEXPR "
+.LASF1688:
+	.string	"__attr_dealloc_fclose "
+.LASF907:
+	.string	"_GLIBCXX_HAVE_TANF 1"
+.LASF416:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF958:
+	.string	"_GLIBCXX_SYMVER_GNU 1"
+.LASF1028:
+	.string	"__cpp_lib_transformation_trait_aliases 201304L"
+.LASF599:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF749:
+	.string	"_PSTL_PRAGMA_SIMD_INCLUSIVE_SCAN(PRM) "
+.LASF792:
+	.string	"_GLIBCXX_HAVE_COSL 1"
+.LASF404:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2044:
+	.string	"ESOCKTNOSUPPORT 94"
+.LASF2689:
+	.string	"_ZNSt6vectorIcSaIcEEC4EOS1_"
+.LASF2643:
+	.string	"_ZNSt12_Vector_baseIcSaIcEE12_Vector_implC4ERKS0_"
+.LASF2702:
+	.string	"_ZNSt6vectorIcSaIcEE5beginEv"
+.LASF1446:
+	.string	"_GLIBCXX_ATOMIC_BASE_H 1"
+.LASF1887:
+	.string	"FILENAME_MAX 4096"
+.LASF1724:
+	.string	"wcsncat"
+.LASF1018:
+	.string	"__glibcxx_max_digits10"
+.LASF33:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1592:
+	.string	"strncpy"
+.LASF1109:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1420:
+	.string	"qsort"
+.LASF2760:
+	.string	"_ZNSt6vectorIcSaIcEE14_M_emplace_auxEN9__gnu_cxx17__normal_iteratorIPKcS1_EEOc"
+.LASF2412:
+	.string	"_M_capacity"
+.LASF1025:
+	.string	"__cpp_lib_logical_traits 201510L"
+.LASF2448:
+	.string	"iterator"
+.LASF1825:
+	.string	"islower"
+.LASF86:
+	.string	"__cpp_unicode_literals 200710L"
+.LASF2904:
+	.string	"long double"
+.LASF2884:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEppEv"
+.LASF104:
+	.string	"__cpp_aggregate_nsdmi 201304L"
+.LASF500:
+	.string	"_GLIBCXX_END_NAMESPACE_ALGO "
+.LASF1205:
+	.string	"__HAVE_FLOAT32 1"
+.LASF974:
+	.string	"_GLIBCXX_USE_GETTIMEOFDAY 1"
+.LASF1526:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF1839:
+	.string	"_GLIBCXX_REFWRAP_H 1"
+.LASF1361:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1290:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2355:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE13find_first_ofEPKcm"
+.LASF1935:
+	.string	"sscanf"
+.LASF1563:
+	.string	"_GLIBCXX_ALWAYS_INLINE inline __attribute__((__always_inline__))"
+.LASF3167:
+	.string	"__mod"
+.LASF751:
+	.string	"_PSTL_CPP17_EXECUTION_POLICIES_PRESENT (_MSC_VER >= 1912)"
+.LASF1239:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2732:
+	.string	"_ZNSt6vectorIcSaIcEE4dataEv"
+.LASF2660:
+	.string	"_ZNSt12_Vector_baseIcSaIcEEC4ERKS0_OS1_"
+.LASF1066:
+	.string	"__cpp_lib_make_reverse_iterator 201402L"
+.LASF2669:
+	.string	"_ZNSt12_Vector_baseIcSaIcEE17_M_create_storageEm"
+.LASF2085:
+	.string	"errno (*__errno_location ())"
+.LASF1523:
+	.string	"UINT32_WIDTH 32"
+.LASF336:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF374:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1783:
+	.string	"LC_MESSAGES __LC_MESSAGES"
+.LASF899:
+	.string	"_GLIBCXX_HAVE_SYS_SOCKET_H 1"
+.LASF2098:
+	.string	"_STL_VECTOR_H 1"
+.LASF1017:
+	.string	"__glibcxx_floating"
+.LASF3036:
+	.string	"_IO_backup_base"
+.LASF3180:
+	.string	"_ZNSt11char_traitsIcE3eofEv"
+.LASF3093:
+	.string	"_IO_wide_data"
+.LASF91:
+	.string	"__cpp_rvalue_reference 200610L"
+.LASF2133:
+	.string	"memory_order_consume"
+.LASF2455:
+	.string	"_M_mutate"
+.LASF353:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF674:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1691:
+	.string	"fgetwc"
+.LASF980:
+	.string	"_GLIBCXX_USE_NLS 1"
+.LASF1681:
+	.string	"_WINT_T 1"
+.LASF693:
+	.string	"__stub_chflags "
+.LASF1172:
+	.string	"WCONTINUED 8"
+.LASF3097:
+	.string	"mTimestamp"
+.LASF1692:
+	.string	"fgetws"
+.LASF1868:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF2758:
+	.string	"_ZNSt6vectorIcSaIcEE14_M_insert_rvalEN9__gnu_cxx17__normal_iteratorIPKcS1_EEOc"
+.LASF2581:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4findEPKcmm"
+.LASF2796:
+	.string	"_ZSt6fill_nIPcmcET_S1_T0_RKT1_"
+.LASF235:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1779:
+	.string	"LC_NUMERIC __LC_NUMERIC"
+.LASF1998:
+	.string	"ELNRNG 48"
+.LASF2080:
+	.string	"EOWNERDEAD 130"
+.LASF763:
+	.string	"_PSTL_PRAGMA_DECLARE_REDUCTION(NAME,OP) _PSTL_PRAGMA(omp declare reduction(NAME:OP : omp_out(omp_in)) initializer(omp_priv = omp_orig))"
+.LASF2367:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE16find_last_not_ofES2_m"
+.LASF3181:
+	.string	"__cxx11"
+.LASF893:
+	.string	"_GLIBCXX_HAVE_SYS_IOCTL_H 1"
+.LASF1356:
+	.string	"__timeval_defined 1"
+.LASF2685:
+	.string	"_ZNSt6vectorIcSaIcEEC4ERKS0_"
+.LASF94:
+	.string	"__cpp_initializer_lists 200806L"
+.LASF2989:
+	.string	"int_fast8_t"
+.LASF2126:
+	.string	"bidirectional_iterator_tag"
+.LASF2473:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEaSEPKc"
+.LASF861:
+	.string	"_GLIBCXX_HAVE_POSIX_MEMALIGN 1"
+.LASF2059:
+	.string	"ETOOMANYREFS 109"
+.LASF2016:
+	.string	"EREMOTE 66"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF101:
+	.string	"__cpp_init_captures 201304L"
+.LASF377:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2128:
+	.string	"__debug"
+.LASF1322:
+	.string	"__PDP_ENDIAN 3412"
+.LASF215:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1831:
+	.string	"tolower"
+.LASF2288:
+	.string	"basic_string_view"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF972:
+	.string	"_GLIBCXX_USE_FCHMOD 1"
+.LASF2271:
+	.string	"const_reference"
+.LASF401:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF946:
+	.string	"_GLIBCXX98_USE_C99_STDLIB 1"
+.LASF1794:
+	.string	"LC_COLLATE_MASK (1 << __LC_COLLATE)"
+.LASF1609:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF1553:
+	.string	"ATOMIC_BOOL_LOCK_FREE __GCC_ATOMIC_BOOL_LOCK_FREE"
+.LASF2100:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_GROW(n) "
+.LASF397:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF881:
+	.string	"_GLIBCXX_HAVE_STDINT_H 1"
+.LASF427:
+	.string	"__SEG_FS 1"
+.LASF1251:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF2047:
+	.string	"EAFNOSUPPORT 97"
+.LASF174:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF939:
+	.string	"_GLIBCXX11_USE_C99_MATH 1"
+.LASF2688:
+	.string	"_ZNSt6vectorIcSaIcEEC4ERKS1_"
+.LASF1275:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF889:
+	.string	"_GLIBCXX_HAVE_STRUCT_DIRENT_D_TYPE 1"
+.LASF92:
+	.string	"__cpp_rvalue_references 200610L"
+.LASF502:
+	.string	"_GLIBCXX_LONG_DOUBLE_ALT128_COMPAT"
+.LASF588:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF849:
+	.string	"_GLIBCXX_HAVE_MBSTATE_T 1"
+.LASF1620:
+	.string	"ADJ_TIMECONST 0x0020"
+.LASF2496:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6resizeEmc"
+.LASF608:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2915:
+	.string	"5div_t"
+.LASF2835:
+	.string	"bool"
+.LASF834:
+	.string	"_GLIBCXX_HAVE_LIMIT_AS 1"
+.LASF871:
+	.string	"_GLIBCXX_HAVE_SINCOSL 1"
+.LASF534:
+	.string	"__USE_XOPEN2K8"
+.LASF1461:
+	.string	"INT8_MAX (127)"
+.LASF659:
+	.string	"__wur "
+.LASF2681:
+	.string	"_S_relocate"
+.LASF382:
+	.string	"__NO_INLINE__ 1"
+.LASF2039:
+	.string	"EDESTADDRREQ 89"
+.LASF2305:
+	.string	"rend"
+.LASF1463:
+	.string	"INT32_MAX (2147483647)"
+.LASF1891:
+	.string	"FOPEN_MAX 16"
+.LASF762:
+	.string	"_PSTL_PRAGMA_SIMD_ORDERED_MONOTONIC_2ARGS(PRM1,PRM2) "
+.LASF2664:
+	.string	"_M_allocate"
+.LASF1186:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF269:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1229:
+	.string	"EXIT_SUCCESS 0"
+.LASF1469:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF37:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF963:
+	.string	"_GLIBCXX_USE_C99_FENV_TR1 1"
+.LASF266:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF445:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF2564:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_NS6_IPcS4_EESB_"
+.LASF2090:
+	.string	"_GLIBCXX_STRING_CONSTEXPR "
+.LASF1812:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF1991:
+	.string	"EWOULDBLOCK EAGAIN"
+.LASF966:
+	.string	"_GLIBCXX_USE_C99_MATH_TR1 1"
+.LASF2934:
+	.string	"__uint_least32_t"
+.LASF1291:
+	.string	"__FD_SETSIZE 1024"
+.LASF1007:
+	.string	"__INT_N(TYPE) __extension__ template<> struct __is_integer<TYPE> { enum { __value = 1 }; typedef __true_type __type; }; __extension__ template<> struct __is_integer<unsigned TYPE> { enum { __value = 1 }; typedef __true_type __type; };"
+.LASF1986:
+	.string	"ENAMETOOLONG 36"
+.LASF885:
+	.string	"_GLIBCXX_HAVE_STRINGS_H 1"
+.LASF2434:
+	.string	"_M_check_length"
+.LASF289:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2311:
+	.string	"size"
+.LASF2546:
+	.string	"erase"
+.LASF2306:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4rendEv"
+.LASF2812:
+	.string	"max<long unsigned int>"
+.LASF557:
+	.string	"_ISOC11_SOURCE 1"
+.LASF2192:
+	.string	"exchange"
+.LASF2634:
+	.string	"_M_finish"
+.LASF1343:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF2060:
+	.string	"ETIMEDOUT 110"
+.LASF1572:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF2880:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEC4Ev"
+.LASF2519:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEpLESt16initializer_listIcE"
+.LASF383:
+	.string	"__STRICT_ANSI__ 1"
+.LASF1586:
+	.string	"strcpy"
+.LASF2278:
+	.string	"_ZNKSt15__new_allocatorIcE8max_sizeEv"
+.LASF2456:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_mutateEmmPKcm"
+.LASF1398:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF2102:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_SHRINK(n) "
+.LASF2375:
+	.string	"allocator_traits<std::allocator<char> >"
+.LASF2371:
+	.string	"_S_compare"
+.LASF2592:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13find_first_ofEcm"
+.LASF265:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1421:
+	.string	"quick_exit"
+.LASF493:
+	.string	"_GLIBCXX_BEGIN_NAMESPACE_VERSION "
+.LASF1257:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF3002:
+	.string	"tm_min"
+.LASF1531:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF3067:
+	.string	"currency_symbol"
+.LASF1259:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2721:
+	.string	"_ZNSt6vectorIcSaIcEE7reserveEm"
+.LASF1876:
+	.string	"BUFSIZ 8192"
+.LASF1695:
+	.string	"fwide"
+.LASF1406:
+	.string	"atof"
+.LASF2788:
+	.string	"_ZSt9__fill_a1IcEN9__gnu_cxx11__enable_ifIXsrSt9__is_byteIT_E7__valueEvE6__typeEPS3_S7_RKS3_"
+.LASF2508:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEixEm"
+.LASF1407:
+	.string	"atoi"
+.LASF1408:
+	.string	"atol"
+.LASF1318:
+	.string	"_ENDIAN_H 1"
+.LASF2439:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE11_M_disjunctEPKc"
+.LASF965:
+	.string	"_GLIBCXX_USE_C99_INTTYPES_WCHAR_T_TR1 1"
+.LASF2535:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignESt16initializer_listIcE"
+.LASF3110:
+	.string	"_ZN9simulator8log_ring7copy_inEmPKcm"
+.LASF1773:
+	.string	"__LC_NAME 8"
+.LASF381:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF296:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1266:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF641:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF774:
+	.string	"_GLIBCXX_HAVE_ALIGNED_ALLOC 1"
+.LASF1372:
+	.string	"__fsfilcnt_t_defined "
+.LASF26:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2590:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13find_first_ofEPKcmm"
+.LASF2842:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE10_S_on_swapERS1_S3_"
+.LASF2019:
+	.string	"ESRMNT 69"
+.LASF726:
+	.string	"_GLIBCXX_HAS_BUILTIN"
+.LASF286:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF506:
+	.string	"_GLIBCXX_NAMESPACE_LDBL_OR_CXX11 _GLIBCXX_NAMESPACE_CXX11"
+.LASF3054:
+	.string	"_unused2"
+.LASF305:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF982:
+	.string	"_GLIBCXX_USE_PTHREAD_MUTEX_CLOCKLOCK 1"
+.LASF956:
+	.string	"_GLIBCXX_STDIO_SEEK_END 2"
+.LASF3131:
+	.string	"__it"
+.LASF603:
+	.string	"__USE_GNU 1"
+.LASF564:
+	.string	"_XOPEN_SOURCE"
+.LASF572:
+	.string	"_ATFILE_SOURCE"
+.LASF2122:
+	.string	"size_t"
+.LASF1174:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF597:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1188:
+	.string	"__WCOREFLAG 0x80"
+.LASF95:
+	.string	"__cpp_delegating_constructors 200604L"
+.LASF3108:
+	.string	"_ZN9simulator8log_ringaSERKS0_"
+.LASF380:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1820:
+	.string	"isalnum"
+.LASF2627:
+	.string	"__uninit_default_n<char*, long unsigned int>"
+.LASF2847:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE27_S_propagate_on_move_assignEv"
+.LASF1685:
+	.string	"__FILE_defined 1"
+.LASF2486:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4rendEv"
+.LASF574:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF579:
+	.string	"__USE_ISOC95 1"
+.LASF355:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1974:
+	.string	"EMFILE 24"
+.LASF1328:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF2062:
+	.string	"EHOSTDOWN 112"
+.LASF3061:
+	.string	"__isoc99_wscanf"
+.LASF1375:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF2351:
+	.string	"find_first_of"
+.LASF153:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1561:
+	.string	"ATOMIC_LLONG_LOCK_FREE __GCC_ATOMIC_LLONG_LOCK_FREE"
+.LASF1166:
+	.string	"__need_NULL"
+.LASF784:
+	.string	"_GLIBCXX_HAVE_ATOMIC_LOCK_POLICY 1"
+.LASF689:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1444:
+	.string	"__cpp_lib_parallel_algorithm 201603L"
+.LASF2396:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17_S_to_string_viewESt17basic_string_viewIcS2_E"
+.LASF710:
+	.string	"_GLIBCXX_USE_STD_SPEC_FUNCS 1"
+.LASF431:
+	.string	"__linux__ 1"
+.LASF2550:
+	.string	"pop_back"
+.LASF850:
+	.string	"_GLIBCXX_HAVE_MEMALIGN 1"
+.LASF451:
+	.string	"__GLIBCXX__ 20220819"
+.LASF1874:
+	.string	"_IOLBF 1"
+.LASF1184:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF2945:
+	.string	"time_t"
+.LASF2015:
+	.string	"ENOPKG 65"
+.LASF1631:
+	.string	"MOD_ESTERROR ADJ_ESTERROR"
+.LASF2298:
+	.string	"cbegin"
+.LASF2987:
+	.string	"uint_least32_t"
+.LASF2577:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4dataEv"
+.LASF82:
+	.string	"__GXX_EXPERIMENTAL_CXX0X__ 1"
+.LASF760:
+	.string	"_PSTL_PRAGMA_SIMD_EARLYEXIT "
+.LASF2764:
+	.string	"_ZNSt6vectorIcSaIcEE17_S_check_init_lenEmRKS0_"
+.LASF937:
+	.string	"_GLIBCXX_DARWIN_USE_64_BIT_INODE 1"
+.LASF2428:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16_M_get_allocatorEv"
+.LASF766:
+	.string	"_PSTL_PRAGMA_LOCATION \" [Parallel STL message]: \""
+.LASF1213:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF2638:
+	.string	"_M_copy_data"
+.LASF1189:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF2951:
+	.string	"tv_sec"
+.LASF3128:
+	.string	"this"
+.LASF840:
+	.string	"_GLIBCXX_HAVE_LINK_H 1"
+.LASF1349:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF2183:
+	.string	"_ZNKSt13__atomic_baseImE12is_lock_freeEv"
+.LASF293:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF741:
+	.string	"_PSTL_HIDE_FROM_ABI_PUSH "
+.LASF1981:
+	.string	"EMLINK 31"
+.LASF182:
+	.string	"__INT64_C(c) c ## L"
+.LASF681:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1384:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF351:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF2077:
+	.string	"EKEYEXPIRED 127"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF3171:
+	.string	"GNU C++17 12.2.0 -mtune=generic -march=x86-64 -g3 -O0 -pedantic-errors -std=c++17 -p -fprofile-arcs -ftest-coverage -fprofile-update=prefer-atomic -fasynchronous-unwind-tables"
+.LASF1851:
+	.string	"_GLIBCXX_STRING_VIEW 1"
+.LASF648:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1629:
+	.string	"MOD_FREQUENCY ADJ_FREQUENCY"
+.LASF2061:
+	.string	"ECONNREFUSED 111"
+.LASF1024:
+	.string	"__cpp_lib_bool_constant 201505L"
+.LASF780:
+	.string	"_GLIBCXX_HAVE_ATAN2F 1"
+.LASF721:
+	.string	"_GLIBCXX_HAS_BUILTIN(B) __has_builtin(B)"
+.LASF234:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF969:
+	.string	"_GLIBCXX_USE_CLOCK_REALTIME 1"
+.LASF2096:
+	.string	"_GLIBCXX_USE_ASSIGN_FOR_INIT"
+.LASF1771:
+	.string	"__LC_ALL 6"
+.LASF2113:
+	.string	"_ZNKSt17integral_constantIbLb0EEcvbEv"
+.LASF3148:
+	.string	"_ZNSt13__atomic_baseImEC2Em"
+.LASF146:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1543:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF854:
+	.string	"_GLIBCXX_HAVE_MODFL 1"
+.LASF117:
+	.string	"__cpp_capture_star_this 201603L"
+.LASF2561:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_mc"
+.LASF2000:
+	.string	"ENOCSI 50"
+.LASF1867:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF916:
+	.string	"_GLIBCXX_HAVE_UNISTD_H 1"
+.LASF1834:
+	.string	"_OSTREAM_INSERT_H 1"
+.LASF2337:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareEmmS2_"
+.LASF722:
+	.string	"_GLIBCXX_HAVE_BUILTIN_HAS_UNIQ_OBJ_REP 1"
+.LASF2695:
+	.string	"~vector"
+.LASF1637:
+	.string	"MOD_MICRO ADJ_MICRO"
+.LASF516:
+	.string	"_GLIBCXX_END_EXTERN_C }"
+.LASF459:
+	.string	"_GLIBCXX_DEPRECATED_SUGGEST(ALT) __attribute__ ((__deprecated__ (\"use '\" ALT \"' instead\")))"
+.LASF2051:
+	.string	"ENETUNREACH 101"
+.LASF560:
+	.string	"_POSIX_SOURCE"
+.LASF1892:
+	.string	"_PRINTF_NAN_LEN_MAX 4"
+.LASF384:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF3056:
+	.string	"__isoc99_fwscanf"
+.LASF2131:
+	.string	"true_type"
+.LASF2687:
+	.string	"_ZNSt6vectorIcSaIcEEC4EmRKcRKS0_"
+.LASF682:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2269:
+	.string	"_ZNKSt15__new_allocatorIcE7addressERc"
+.LASF1094:
+	.string	"__cpp_lib_robust_nonmodifying_seq_ops 201304L"
+.LASF315:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1708:
+	.string	"ungetwc"
+.LASF2566:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_St16initializer_listIcE"
+.LASF3085:
+	.string	"int_p_sign_posn"
+.LASF2913:
+	.string	"quot"
+.LASF1391:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF2308:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7crbeginEv"
+.LASF1999:
+	.string	"EUNATCH 49"
+.LASF3019:
+	.string	"__wchb"
+.LASF1616:
+	.string	"ADJ_FREQUENCY 0x0002"
+.LASF1392:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF452:
+	.string	"_GLIBCXX_PURE __attribute__ ((__pure__))"
+.LASF887:
+	.string	"_GLIBCXX_HAVE_STRTOF 1"
+.LASF2065:
+	.string	"EINPROGRESS 115"
+.LASF1255:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF2245:
+	.string	"_ZNSt11char_traitsIcE4copyEPcPKcm"
+.LASF2635:
+	.string	"_M_end_of_storage"
+.LASF1656:
+	.string	"__struct_tm_defined 1"
+.LASF739:
+	.string	"_PSTL_STRING(x) _PSTL_STRING_AUX(x)"
+.LASF892:
+	.string	"_GLIBCXX_HAVE_SYMVER_SYMBOL_RENAMING_RUNTIME_SUPPORT 1"
+.LASF1955:
+	.string	"EIO 5"
+.LASF3005:
+	.string	"tm_mon"
+.LASF1613:
+	.string	"TIMER_ABSTIME 1"
+.LASF1429:
+	.string	"wcstombs"
+.LASF943:
+	.string	"_GLIBCXX98_USE_C99_COMPLEX 1"
+.LASF953:
+	.string	"_GLIBCXX_RES_LIMITS 1"
+.LASF1805:
+	.string	"_GLIBCXX_CLOCALE 1"
+.LASF350:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1682:
+	.string	"__mbstate_t_defined 1"
+.LASF1767:
+	.string	"__LC_TIME 2"
+.LASF1016:
+	.string	"__glibcxx_max_exponent10(_Tp) __glibcxx_floating(_Tp, __FLT_MAX_10_EXP__, __DBL_MAX_10_EXP__, __LDBL_MAX_10_EXP__)"
+.LASF227:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF2189:
+	.string	"load"
+.LASF2008:
+	.string	"EDEADLOCK EDEADLK"
+.LASF1335:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF915:
+	.string	"_GLIBCXX_HAVE_UCHAR_H 1"
+.LASF1260:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF832:
+	.string	"_GLIBCXX_HAVE_LDEXPL 1"
+.LASF1199:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1079:
+	.string	"__glibcxx_requires_partitioned_lower(_First,_Last,_Value) "
+.LASF246:
+	.string	"__LDBL_DIG__ 18"
+.LASF2587:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5rfindEPKcm"
+.LASF2499:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13shrink_to_fitEv"
+.LASF2698:
+	.string	"_ZNSt6vectorIcSaIcEEaSEOS1_"
+.LASF2809:
+	.string	"_ZSt12__relocate_aIPcS0_SaIcEET0_T_S3_S2_RT1_"
+.LASF1047:
+	.string	"__cpp_lib_tuples_by_type 201304L"
+.LASF1256:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1491:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF3177:
+	.string	"_M_i"
+.LASF297:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF2615:
+	.string	"_M_array"
+.LASF2089:
+	.string	"__cpp_lib_string_udls 201304L"
+.LASF2391:
+	.string	"_M_p"
+.LASF1659:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF3169:
+	.string	"__int128"
+.LASF1475:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF2871:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEplEl"
+.LASF2837:
+	.string	"__ops"
+.LASF1988:
+	.string	"ENOSYS 38"
+.LASF1121:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF2994:
+	.string	"uint_fast16_t"
+.LASF414:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF2736:
+	.string	"_ZNSt6vectorIcSaIcEE8pop_backEv"
+.LASF1089:
+	.string	"__glibcxx_requires_irreflexive_pred(_First,_Last,_Pred) "
+.LASF1050:
+	.string	"_CONCEPT_CHECK_H 1"
+.LASF934:
+	.string	"_GLIBCXX_PACKAGE_URL \"\""
+.LASF1301:
+	.string	"__nlink_t_defined "
+.LASF2385:
+	.string	"rebind_alloc"
+.LASF2922:
+	.string	"__uint8_t"
+.LASF423:
+	.string	"__FXSR__ 1"
+.LASF2686:
+	.string	"_ZNSt6vectorIcSaIcEEC4EmRKS0_"
+.LASF609:
+	.string	"__GLIBC__ 2"
+.LASF3003:
+	.string	"tm_hour"
+.LASF1218:
+	.string	"__f64(x) x"
+.LASF1164:
+	.string	"NULL"
+.LASF1383:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF2832:
+	.string	"_ZNSt6vectorIcSaIcEE15_S_use_relocateEv"
+.LASF2874:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmiEl"
+.LASF2074:
+	.string	"EMEDIUMTYPE 124"
+.LASF862:
+	.string	"_GLIBCXX_HAVE_POSIX_SEMAPHORE 1"
+.LASF1790:
+	.string	"LC_IDENTIFICATION __LC_IDENTIFICATION"
+.LASF2243:
+	.string	"_ZNSt11char_traitsIcE4moveEPcPKcm"
+.LASF157:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF2432:
+	.string	"_M_check"
+.LASF3000:
+	.string	"uintmax_t"
+.LASF2548:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5eraseEN9__gnu_cxx17__normal_iteratorIPKcS4_EE"
+.LASF3044:
+	.string	"_vtable_offset"
+.LASF3127:
+	.string	"_Args"
+.LASF2693:
+	.string	"_ZNSt6vectorIcSaIcEEC4EOS1_RKS0_"
+.LASF272:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2649:
+	.string	"_ZNSt12_Vector_baseIcSaIcEE19_M_get_Tp_allocatorEv"
+.LASF2950:
+	.string	"timespec"
+.LASF945:
+	.string	"_GLIBCXX98_USE_C99_STDIO 1"
+.LASF1761:
+	.string	"_LOCALE_FWD_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1336:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF2152:
+	.string	"operator std::__atomic_base<long unsigned int>::__int_type"
+.LASF1515:
+	.string	"UINT64_C(c) c ## UL"
+.LASF2433:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8_M_checkEmPKc"
+.LASF1369:
+	.string	"__blksize_t_defined "
+.LASF2472:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEaSERKS4_"
+.LASF2700:
+	.string	"_ZNSt6vectorIcSaIcEE6assignEmRKc"
+.LASF2851:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE15_S_always_equalEv"
+.LASF424:
+	.string	"__SSE_MATH__ 1"
+.LASF1117:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF3174:
+	.string	"_ZNSt12_Destroy_auxILb1EE9__destroyIPcEEvT_S3_"
+.LASF930:
+	.string	"_GLIBCXX_PACKAGE_BUGREPORT \"\""
+.LASF42:
+	.string	"__GNUG__ 12"
+.LASF1504:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1351:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF827:
+	.string	"_GLIBCXX_HAVE_ISNANF 1"
+.LASF1382:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1252:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF121:
+	.string	"__cpp_noexcept_function_type 201510L"
+.LASF2785:
+	.string	"__throw_length_error"
+.LASF627:
+	.string	"__ptr_t void *"
+.LASF1963:
+	.string	"EACCES 13"
+.LASF3099:
+	.string	"log_ring"
+.LASF1850:
+	.string	"__cpp_lib_allocator_traits_is_always_equal 201411L"
+.LASF2710:
+	.string	"_ZNKSt6vectorIcSaIcEE6cbeginEv"
+.LASF1226:
+	.string	"__lldiv_t_defined 1"
+.LASF2210:
+	.string	"_ZNVSt13__atomic_baseImE9fetch_subEmSt12memory_order"
+.LASF3115:
+	.string	"mHead"
+.LASF2802:
+	.string	"_ZSt14__relocate_a_1IccENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E"
+.LASF1524:
+	.string	"INT64_WIDTH 64"
+.LASF2212:
+	.string	"_ZNSt13__atomic_baseImE9fetch_andEmSt12memory_order"
+.LASF461:
+	.string	"_GLIBCXX11_DEPRECATED_SUGGEST(ALT) _GLIBCXX_DEPRECATED_SUGGEST(ALT)"
+.LASF273:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1308:
+	.string	"__daddr_t_defined "
+.LASF1082:
+	.string	"__glibcxx_requires_partitioned_upper_pred(_First,_Last,_Value,_Pred) "
+.LASF1173:
+	.string	"WNOWAIT 0x01000000"
+.LASF803:
+	.string	"_GLIBCXX_HAVE_FABSL 1"
+.LASF2674:
+	.string	"_S_nothrow_relocate"
+.LASF1562:
+	.string	"ATOMIC_POINTER_LOCK_FREE __GCC_ATOMIC_POINTER_LOCK_FREE"
+.LASF582:
+	.string	"__USE_POSIX2 1"
+.LASF242:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF210:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF371:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF822:
+	.string	"_GLIBCXX_HAVE_HYPOTL 1"
+.LASF699:
+	.string	"__stub_stty "
+.LASF519:
+	.string	"__NO_CTYPE 1"
+.LASF2310:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5crendEv"
+.LASF2510:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE2atEm"
+.LASF2554:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEmmRKS4_mm"
+.LASF964:
+	.string	"_GLIBCXX_USE_C99_INTTYPES_TR1 1"
+.LASF1068:
+	.string	"_GLIBCXX_MAKE_MOVE_IF_NOEXCEPT_ITERATOR(_Iter) std::__make_move_if_noexcept_iterator(_Iter)"
+.LASF2711:
+	.string	"_ZNKSt6vectorIcSaIcEE4cendEv"
+.LASF161:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF3146:
+	.string	"_ZNSaIcED2Ev"
+.LASF2633:
+	.string	"_M_start"
+.LASF2093:
+	.string	"_GLIBCXX_VECTOR 1"
+.LASF926:
+	.string	"_GLIBCXX_HAVE_WRITEV 1"
+.LASF1415:
+	.string	"ldiv"
+.LASF80:
+	.string	"__GXX_RTTI 1"
+.LASF2628:
+	.string	"_ZNSt27__uninitialized_default_n_1ILb1EE18__uninit_default_nIPcmEET_S3_T0_"
+.LASF115:
+	.string	"__cpp_constexpr 201603L"
+.LASF1969:
+	.string	"ENODEV 19"
+.LASF2117:
+	.string	"value_type"
+.LASF3008:
+	.string	"tm_yday"
+.LASF2069:
+	.string	"ENAVAIL 119"
+.LASF508:
+	.string	"_GLIBCXX_END_NAMESPACE_LDBL_OR_CXX11 _GLIBCXX_END_NAMESPACE_CXX11"
+.LASF3150:
+	.string	"destination"
+.LASF1347:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF2722:
+	.string	"_ZNSt6vectorIcSaIcEEixEm"
+.LASF2312:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4sizeEv"
+.LASF1873:
+	.string	"_IOFBF 0"
+.LASF2024:
+	.string	"EBADMSG 74"
+.LASF1458:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1910:
+	.string	"fopen"
+.LASF343:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1137:
+	.string	"_SIZE_T_DEFINED "
+.LASF2949:
+	.string	"int64_t"
+.LASF1546:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF2521:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendERKS4_"
+.LASF1719:
+	.string	"wcscoll"
+.LASF84:
+	.string	"__cpp_hex_float 201603L"
+.LASF808:
+	.string	"_GLIBCXX_HAVE_FINITEF 1"
+.LASF959:
+	.string	"_GLIBCXX_USE_C11_UCHAR_CXX11 1"
+.LASF25:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1669:
+	.string	"strftime"
+.LASF573:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1642:
+	.string	"STA_FLL 0x0008"
+.LASF2909:
+	.string	"char32_t"
+.LASF1880:
+	.string	"SEEK_END 2"
+.LASF1623:
+	.string	"ADJ_MICRO 0x1000"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1132:
+	.string	"_T_SIZE "
+.LASF1486:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1063:
+	.string	"_STL_ITERATOR_H 1"
+.LASF2264:
+	.string	"__int_type"
+.LASF1443:
+	.string	"_PSTL_ALGORITHM_FORWARD_DECLARED 1"
+.LASF1559:
+	.string	"ATOMIC_INT_LOCK_FREE __GCC_ATOMIC_INT_LOCK_FREE"
+.LASF1159:
+	.string	"_GCC_WCHAR_T "
+.LASF2713:
+	.string	"_ZNKSt6vectorIcSaIcEE5crendEv"
+.LASF2372:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEE10_S_compareEmm"
+.LASF2440:
+	.string	"_S_copy"
+.LASF970:
+	.string	"_GLIBCXX_USE_DECIMAL_FLOAT 1"
+.LASF252:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1055:
+	.string	"__glibcxx_class_requires4(_a,_b,_c,_d,_e) "
+.LASF3109:
+	.string	"copy_in"
+.LASF1680:
+	.string	"__wint_t_defined 1"
+.LASF238:
+	.string	"__DBL_MIN__ double(2.22507385850720138309023271733240406e-308L)"
+.LASF334:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2162:
+	.string	"_ZNVSt13__atomic_baseImEmmEi"
+.LASF1684:
+	.string	"____FILE_defined 1"
+.LASF698:
+	.string	"__stub_sigreturn "
+.LASF2166:
+	.string	"_ZNVSt13__atomic_baseImEmmEv"
+.LASF420:
+	.string	"__MMX__ 1"
+.LASF1652:
+	.string	"STA_NANO 0x2000"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF180:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF219:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF3026:
+	.string	"_flags"
+.LASF1774:
+	.string	"__LC_ADDRESS 9"
+.LASF2766:
+	.string	"_ZNSt6vectorIcSaIcEE11_S_max_sizeERKS0_"
+.LASF593:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF358:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF3074:
+	.string	"frac_digits"
+.LASF847:
+	.string	"_GLIBCXX_HAVE_LOGF 1"
+.LASF2507:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5emptyEv"
+.LASF456:
+	.string	"_GLIBCXX_VISIBILITY(V) __attribute__ ((__visibility__ (#V)))"
+.LASF1334:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1781:
+	.string	"LC_COLLATE __LC_COLLATE"
+.LASF1730:
+	.string	"wcsspn"
+.LASF198:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF498:
+	.string	"_GLIBCXX_STD_A std"
+.LASF851:
+	.string	"_GLIBCXX_HAVE_MEMORY_H 1"
+.LASF3111:
+	.string	"copy_out"
+.LASF2750:
+	.string	"_ZNSt6vectorIcSaIcEE14_M_fill_assignEmRKc"
+.LASF2150:
+	.string	"_ZNSt13__atomic_baseImEaSERKS0_"
+.LASF2444:
+	.string	"_S_assign"
+.LASF1555:
+	.string	"ATOMIC_WCHAR_T_LOCK_FREE __GCC_ATOMIC_WCHAR_T_LOCK_FREE"
+.LASF1352:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF2905:
+	.string	"double"
+.LASF1158:
+	.string	"__INT_WCHAR_T_H "
+.LASF2083:
+	.string	"EHWPOISON 133"
+.LASF1033:
+	.string	"__cpp_lib_is_invocable 201703L"
+.LASF2876:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEE4baseEv"
+.LASF2034:
+	.string	"EILSEQ 84"
+.LASF1080:
+	.string	"__glibcxx_requires_partitioned_upper(_First,_Last,_Value) "
+.LASF1621:
+	.string	"ADJ_TAI 0x0080"
+.LASF2270:
+	.string	"_ZNKSt15__new_allocatorIcE7addressERKc"
+.LASF988:
+	.string	"_GLIBCXX_USE_SC_NPROCESSORS_ONLN 1"
+.LASF2289:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEEC4Ev"
+.LASF2661:
+	.string	"~_Vector_base"
+.LASF1866:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF1984:
+	.string	"ERANGE 34"
+.LASF1971:
+	.string	"EISDIR 21"
+.LASF3165:
+	.string	"_ZNSt12_Vector_baseIcSaIcEE12_Vector_implD2Ev"
+.LASF2731:
+	.string	"_ZNKSt6vectorIcSaIcEE4backEv"
+.LASF810:
+	.string	"_GLIBCXX_HAVE_FLOAT_H 1"
+.LASF2654:
+	.string	"_ZNSt12_Vector_baseIcSaIcEEC4ERKS0_"
+.LASF628:
+	.string	"__BEGIN_DECLS extern \"C\" {"
+.LASF1995:
+	.string	"EL2NSYNC 45"
+.LASF505:
+	.string	"_GLIBCXX_END_NAMESPACE_LDBL "
+.LASF2867:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmmEi"
+.LASF159:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1141:
+	.string	"___int_size_t_h "
+.LASF2036:
+	.string	"ESTRPIPE 86"
+.LASF1478:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1064:
+	.string	"_PTR_TRAITS_H 1"
+.LASF921:
+	.string	"_GLIBCXX_HAVE_VSWSCANF 1"
+.LASF2866:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmmEv"
+.LASF304:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1405:
+	.string	"at_quick_exit"
+.LASF2045:
+	.string	"EOPNOTSUPP 95"
+.LASF2369:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE16find_last_not_ofEPKcmm"
+.LASF3022:
+	.string	"__mbstate_t"
+.LASF3120:
+	.string	"_Znwm"
+.LASF2186:
+	.string	"_ZNSt13__atomic_baseImEC4Em"
+.LASF257:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF2379:
+	.string	"const_void_pointer"
+.LASF833:
+	.string	"_GLIBCXX_HAVE_LIBINTL_H 1"
+.LASF1967:
+	.string	"EEXIST 17"
+.LASF2146:
+	.string	"_ZNSt13__atomic_baseImEC4Ev"
+.LASF2813:
+	.string	"_ZSt3maxImERKT_S2_S2_"
+.LASF1411:
+	.string	"exit"
+.LASF1346:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF2485:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6rbeginEv"
+.LASF3134:
+	.string	"__allocmax"
+.LASF226:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2233:
+	.string	"char_type"
+.LASF2386:
+	.string	"basic_string<char, std::char_traits<char>, std::allocator<char> >"
+.LASF3124:
+	.string	"__last"
+.LASF411:
+	.string	"__x86_64__ 1"
+.LASF141:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF725:
+	.string	"_GLIBCXX_HAVE_BUILTIN_LAUNDER 1"
+.LASF799:
+	.string	"_GLIBCXX_HAVE_EXECINFO_H 1"
+.LASF2048:
+	.string	"EADDRINUSE 98"
+.LASF541:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF3175:
+	.string	"_S_alignment"
+.LASF814:
+	.string	"_GLIBCXX_HAVE_FMODL 1"
+.LASF492:
+	.string	"_GLIBCXX_INLINE_VERSION 0"
+.LASF3084:
+	.string	"int_n_sep_by_space"
+.LASF2120:
+	.string	"_ZNKSt17integral_constantIbLb1EEclEv"
+.LASF1827:
+	.string	"ispunct"
+.LASF281:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF349:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2435:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE15_M_check_lengthEmmPKc"
+.LASF1502:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF3143:
+	.string	"_ZNSt6vectorIcSaIcEED2Ev"
+.LASF345:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2322:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5frontEv"
+.LASF1979:
+	.string	"ESPIPE 29"
+.LASF2840:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE17_S_select_on_copyERKS1_"
+.LASF3113:
+	.string	"mBuffer"
+.LASF860:
+	.string	"_GLIBCXX_HAVE_POLL_H 1"
+.LASF1569:
+	.string	"_GLIBCXX_CSTDINT 1"
+.LASF1031:
+	.string	"_GLIBCXX_HAS_NESTED_TYPE(_NTYPE) template<typename _Tp, typename = __void_t<>> struct __has_ ##_NTYPE : false_type { }; template<typename _Tp> struct __has_ ##_NTYPE<_Tp, __void_t<typename _Tp::_NTYPE>> : true_type { };"
+.LASF1485:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1949:
+	.string	"_ASM_GENERIC_ERRNO_H "
+.LASF1453:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF214:
+	.string	"__FLT_DIG__ 6"
+.LASF1041:
+	.string	"_GLIBCXX_FORWARD(_Tp,__val) std::forward<_Tp>(__val)"
+.LASF2830:
+	.string	"_ZSt17__size_to_integerm"
+.LASF2626:
+	.string	"__uninitialized_default_n_1<true>"
+.LASF2397:
+	.string	"basic_string"
+.LASF188:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF2844:
+	.string	"_ZSt17__throw_bad_allocv"
+.LASF469:
+	.string	"_GLIBCXX_NODISCARD [[__nodiscard__]]"
+.LASF1106:
+	.string	"_GLIBCXX_CSTDLIB 1"
+.LASF3028:
+	.string	"_IO_read_end"
+.LASF1272:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF2527:
+	.string	"push_back"
+.LASF1084:
+	.string	"__glibcxx_requires_heap_pred(_First,_Last,_Pred) "
+.LASF1855:
+	.string	"_Cxx_hashtable_define_trivial_hash"
+.LASF3154:
+	.string	"timestamp"
+.LASF1731:
+	.string	"wcsstr"
+.LASF745:
+	.string	"_PSTL_PRAGMA_DECLARE_SIMD _PSTL_PRAGMA(omp declare simd)"
+.LASF1304:
+	.string	"__off64_t_defined "
+.LASF1179:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF2683:
+	.string	"vector"
+.LASF558:
+	.string	"_ISOC2X_SOURCE"
+.LASF2917:
+	.string	"ldiv_t"
+.LASF1040:
+	.string	"_GLIBCXX_MOVE(__val) std::move(__val)"
+.LASF1026:
+	.string	"__cpp_lib_is_null_pointer 201309L"
+.LASF1264:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF249:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF864:
+	.string	"_GLIBCXX_HAVE_POWL 1"
+.LASF2338:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareEmmS2_mm"
+.LASF2029:
+	.string	"ELIBACC 79"
+.LASF1329:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF2281:
+	.string	"__new_allocator<char>"
+.LASF911:
+	.string	"_GLIBCXX_HAVE_TGMATH_H 1"
+.LASF3035:
+	.string	"_IO_save_base"
+.LASF31:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1924:
+	.string	"printf"
+.LASF664:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2040:
+	.string	"EMSGSIZE 90"
+.LASF1787:
+	.string	"LC_ADDRESS __LC_ADDRESS"
+.LASF1577:
+	.string	"memchr"
+.LASF1854:
+	.string	"_Cxx_hashtable_define_trivial_hash(_Tp) template<> struct hash<_Tp> : public __hash_base<size_t, _Tp> { size_t operator()(_Tp __val) const noexcept { return static_cast<size_t>(__val); } };"
+.LASF1207:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF820:
+	.string	"_GLIBCXX_HAVE_HYPOT 1"
+.LASF1276:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2087:
+	.string	"_GLIBCXX_CERRNO 1"
+.LASF330:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1958:
+	.string	"ENOEXEC 8"
+.LASF1498:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF176:
+	.string	"__INT16_C(c) c"
+.LASF172:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1332:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF2231:
+	.string	"__integral_type"
+.LASF1155:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1548:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF2109:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_SHRINK"
+.LASF695:
+	.string	"__stub_gtty "
+.LASF2729:
+	.string	"_ZNKSt6vectorIcSaIcEE5frontEv"
+.LASF2013:
+	.string	"ENOSR 63"
+.LASF1100:
+	.string	"_STL_CONSTRUCT_H 1"
+.LASF1114:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1246:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1243:
+	.string	"__SWORD_TYPE long int"
+.LASF196:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF743:
+	.string	"_PSTL_GCC_VERSION (__GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__)"
+.LASF2239:
+	.string	"_ZNSt11char_traitsIcE6lengthEPKc"
+.LASF1062:
+	.string	"__glibcxx_requires_subscript(_N) "
+.LASF607:
+	.string	"__GNU_LIBRARY__"
+.LASF2206:
+	.string	"_ZNSt13__atomic_baseImE9fetch_addEmSt12memory_order"
+.LASF1660:
+	.string	"_GLIBCXX_CTIME 1"
+.LASF3069:
+	.string	"mon_thousands_sep"
+.LASF1023:
+	.string	"__cpp_lib_integral_constant_callable 201304L"
+.LASF2478:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEcvSt17basic_string_viewIcS2_EEv"
+.LASF133:
+	.string	"__EXCEPTIONS 1"
+.LASF2800:
+	.string	"__enable_if_t"
+.LASF2318:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEEixEm"
+.LASF2765:
+	.string	"_S_max_size"
+.LASF2228:
+	.string	"_ZNSt6atomicImEaSERKS0_"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2815:
+	.string	"_ZSt25__uninitialized_default_nIPcmET_S1_T0_"
+.LASF1441:
+	.string	"_PSTL_GLUE_ALGORITHM_DEFS_H "
+.LASF253:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2781:
+	.string	"difference_type"
+.LASF2176:
+	.string	"operator|="
+.LASF1302:
+	.string	"__uid_t_defined "
+.LASF328:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1857:
+	.string	"_GLIBCXX_STRING_VIEW_TCC 1"
+.LASF518:
+	.string	"_GLIBCXX_OS_DEFINES 1"
+.LASF2406:
+	.string	"_M_length"
+.LASF267:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF466:
+	.string	"_GLIBCXX20_DEPRECATED(MSG) "
+.LASF1715:
+	.string	"wcrtomb"
+.LASF405:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF302:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1376:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF509:
+	.string	"_GLIBCXX_HAVE_IS_CONSTANT_EVALUATED 1"
+.LASF2463:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS4_mm"
+.LASF367:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF329:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1934:
+	.string	"sprintf"
+.LASF2360:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE12find_last_ofEPKcm"
+.LASF1020:
+	.string	"__glibcxx_max_exponent10"
+.LASF2378:
+	.string	"_ZNSt16allocator_traitsISaIcEE8allocateERS0_mPKv"
+.LASF1201:
+	.string	"__f128(x) x ##q"
+.LASF2248:
+	.string	"to_char_type"
+.LASF2262:
+	.string	"~__new_allocator"
+.LASF3144:
+	.string	"_ZNSt12_Vector_baseIcSaIcEED2Ev"
+.LASF756:
+	.string	"_PSTL_EARLYEXIT_PRESENT (__INTEL_COMPILER >= 1800)"
+.LASF299:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1244:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1393:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF332:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1054:
+	.string	"__glibcxx_class_requires3(_a,_b,_c,_d) "
+.LASF1297:
+	.string	"__ino64_t_defined "
+.LASF3033:
+	.string	"_IO_buf_base"
+.LASF932:
+	.string	"_GLIBCXX_PACKAGE_STRING \"package-unused version-unused\""
+.LASF1869:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF1327:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF138:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF771:
+	.string	"_PSTL_ICC_18_OMP_SIMD_BROKEN (__INTEL_COMPILER == 1800)"
+.LASF2058:
+	.string	"ESHUTDOWN 108"
+.LASF754:
+	.string	"_PSTL_CPP14_INTEGER_SEQUENCE_PRESENT (_MSC_VER >= 1900 || __cplusplus >= 201402L)"
+.LASF2169:
+	.string	"_ZNVSt13__atomic_baseImEpLEm"
+.LASF1832:
+	.string	"toupper"
+.LASF825:
+	.string	"_GLIBCXX_HAVE_ISINFF 1"
+.LASF1476:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF3047:
+	.string	"_offset"
+.LASF1494:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2924:
+	.string	"__uint16_t"
+.LASF1099:
+	.string	"_STL_TEMPBUF_H 1"
+.LASF1918:
+	.string	"fsetpos"
+.LASF114:
+	.string	"__cpp_range_based_for 201603L"
+.LASF1630:
+	.string	"MOD_MAXERROR ADJ_MAXERROR"
+.LASF2389:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_Alloc_hiderC4EPcRKS3_"
+.LASF2388:
+	.string	"_ZNSaIcED4Ei"
+.LASF430:
+	.string	"__linux 1"
+.LASF2744:
+	.string	"_ZNSt6vectorIcSaIcEE5clearEv"
+.LASF1945:
+	.string	"vsnprintf"
+.LASF1085:
+	.string	"__glibcxx_requires_string(_String) "
+.LASF259:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF27:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF511:
+	.string	"_GLIBCXX_VERBOSE_ASSERT 1"
+.LASF1307:
+	.string	"__ssize_t_defined "
+.LASF3157:
+	.string	"tail"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF2130:
+	.string	"_ForwardIterator"
+.LASF1359:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1541:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF1899:
+	.string	"__attr_dealloc_fclose"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF2818:
+	.string	"_Destroy<char*>"
+.LASF1474:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2381:
+	.string	"_ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm"
+.LASF468:
+	.string	"_GLIBCXX_ABI_TAG_CXX11 __attribute ((__abi_tag__ (\"cxx11\")))"
+.LASF531:
+	.string	"__USE_UNIX98"
+.LASF1606:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF1650:
+	.string	"STA_PPSERROR 0x0800"
+.LASF1914:
+	.string	"fread"
+.LASF1416:
+	.string	"malloc"
+.LASF961:
+	.string	"_GLIBCXX_USE_C99_COMPLEX_TR1 1"
+.LASF2377:
+	.string	"allocator_type"
+.LASF1915:
+	.string	"freopen"
+.LASF2980:
+	.string	"uint64_t"
+.LASF2177:
+	.string	"_ZNSt13__atomic_baseImEoREm"
+.LASF90:
+	.string	"__cpp_attributes 200809L"
+.LASF2420:
+	.string	"_M_dispose"
+.LASF1700:
+	.string	"mbrlen"
+.LASF701:
+	.string	"_GLIBCXX_NO_OBSOLETE_ISINF_ISNAN_DYNAMIC __GLIBC_PREREQ(2,23)"
+.LASF2916:
+	.string	"6ldiv_t"
+.LASF1578:
+	.string	"memcmp"
+.LASF2869:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEpLEl"
+.LASF644:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1295:
+	.string	"__u_char_defined "
+.LASF3138:
+	.string	"__new_start"
+.LASF1645:
+	.string	"STA_UNSYNC 0x0040"
+.LASF481:
+	.string	"_GLIBCXX_NOTHROW _GLIBCXX_USE_NOEXCEPT"
+.LASF1745:
+	.string	"wscanf"
+.LASF2071:
+	.string	"EREMOTEIO 121"
+.LASF550:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF3098:
+	.string	"mLength"
+.LASF2500:
+	.string	"capacity"
+.LASF1078:
+	.string	"__glibcxx_requires_sorted_set_pred(_First1,_Last1,_First2,_Pred) "
+.LASF855:
+	.string	"_GLIBCXX_HAVE_NETDB_H 1"
+.LASF1185:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1817:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF2707:
+	.string	"_ZNKSt6vectorIcSaIcEE6rbeginEv"
+.LASF2091:
+	.string	"_GLIBCXX_STRING_CONSTEXPR"
+.LASF1457:
+	.string	"INT8_MIN (-128)"
+.LASF2343:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4findEcm"
+.LASF1582:
+	.string	"strcat"
+.LASF708:
+	.string	"_GLIBCXX_TXN_SAFE "
+.LASF2978:
+	.string	"uint16_t"
+.LASF1500:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1713:
+	.string	"vwprintf"
+.LASF2086:
+	.string	"__error_t_defined 1"
+.LASF1077:
+	.string	"__glibcxx_requires_sorted_set(_First1,_Last1,_First2) "
+.LASF556:
+	.string	"_ISOC11_SOURCE"
+.LASF145:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF254:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF308:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF578:
+	.string	"__USE_ISOC99 1"
+.LASF276:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF3119:
+	.string	"operator new"
+.LASF3091:
+	.string	"_IO_marker"
+.LASF2142:
+	.string	"__memory_order_hle_acquire"
+.LASF311:
+	.string	"__FLT128_DIG__ 33"
+.LASF2679:
+	.string	"_ZNSt6vectorIcSaIcEE14_S_do_relocateEPcS2_S2_RS0_St17integral_constantIbLb1EE"
+.LASF1195:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF547:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF2300:
+	.string	"cend"
+.LASF1658:
+	.string	"TIME_UTC 1"
+.LASF2648:
+	.string	"_M_get_Tp_allocator"
+.LASF2820:
+	.string	"__iterator_category<char*>"
+.LASF924:
+	.string	"_GLIBCXX_HAVE_WCSTOF 1"
+.LASF1169:
+	.string	"WUNTRACED 2"
+.LASF816:
+	.string	"_GLIBCXX_HAVE_FREXPL 1"
+.LASF316:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF2958:
+	.string	"__allow_vector"
+.LASF2751:
+	.string	"_M_fill_insert"
+.LASF2819:
+	.string	"_ZSt8_DestroyIPcEvT_S1_"
+.LASF290:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF189:
+	.string	"__UINT32_C(c) c ## U"
+.LASF2640:
+	.string	"_M_swap_data"
+.LASF1316:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF406:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF587:
+	.string	"__USE_XOPEN 1"
+.LASF2503:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7reserveEm"
+.LASF2141:
+	.string	"__memory_order_modifier_mask"
+.LASF1503:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1849:
+	.string	"_ALLOC_TRAITS_H 1"
+.LASF873:
+	.string	"_GLIBCXX_HAVE_SINHF 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF2302:
+	.string	"const_reverse_iterator"
+.LASF436:
+	.string	"_GNU_SOURCE 1"
+.LASF2504:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7reserveEv"
+.LASF1152:
+	.string	"_WCHAR_T_ "
+.LASF477:
+	.string	"_GLIBCXX_NOEXCEPT noexcept"
+.LASF2410:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_M_local_dataEv"
+.LASF1305:
+	.string	"__pid_t_defined "
+.LASF2226:
+	.string	"_ZNSt6atomicImED4Ev"
+.LASF1535:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF2885:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEppEi"
+.LASF136:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF2526:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendESt16initializer_listIcE"
+.LASF394:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF617:
+	.string	"__LEAF , __leaf__"
+.LASF3182:
+	.string	"_ZNSt12_Vector_baseIcSaIcEE12_Vector_implD4Ev"
+.LASF2217:
+	.string	"fetch_xor"
+.LASF2656:
+	.string	"_ZNSt12_Vector_baseIcSaIcEEC4EmRKS0_"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2116:
+	.string	"integral_constant<bool, true>"
+.LASF1479:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF169:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF2452:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_S_compareEmm"
+.LASF1579:
+	.string	"memcpy"
+.LASF2858:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEC4Ev"
+.LASF1250:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1423:
+	.string	"realloc"
+.LASF158:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF346:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2114:
+	.string	"_ZNKSt17integral_constantIbLb0EEclEv"
+.LASF2272:
+	.string	"allocate"
+.LASF107:
+	.string	"__cpp_unicode_characters 201411L"
+.LASF1059:
+	.string	"_GLIBCXX_DEBUG_ONLY(_Statement) "
+.LASF790:
+	.string	"_GLIBCXX_HAVE_COSHF 1"
+.LASF2775:
+	.string	"_ZNKSt6vectorIcSaIcEE11_M_data_ptrIcEEPT_S4_"
+.LASF1516:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1716:
+	.string	"wcscat"
+.LASF3187:
+	.string	"_IO_lock_t"
+.LASF448:
+	.string	"_STL_ALGOBASE_H 1"
+.LASF660:
+	.string	"__always_inline"
+.LASF1222:
+	.string	"__CFLOAT64 _Complex double"
+.LASF2275:
+	.string	"deallocate"
+.LASF3027:
+	.string	"_IO_read_ptr"
+.LASF523:
+	.string	"__USE_ISOC95"
+.LASF2912:
+	.string	"__float128"
+.LASF522:
+	.string	"__USE_ISOC99"
+.LASF773:
+	.string	"_GLIBCXX_HAVE_ACOSL 1"
+.LASF123:
+	.string	"__cpp_structured_bindings 201606L"
+.LASF1896:
+	.string	"RENAME_NOREPLACE (1 << 0)"
+.LASF1296:
+	.string	"__ino_t_defined "
+.LASF2395:
+	.string	"_S_to_string_view"
+.LASF2629:
+	.string	"_Size"
+.LASF2967:
+	.string	"parallel_unsequenced_policy"
+.LASF307:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF705:
+	.string	"_GLIBCXX_PSEUDO_VISIBILITY(V) "
+.LASF1012:
+	.string	"_GLIBCXX_INT_N_TRAITS"
+.LASF906:
+	.string	"_GLIBCXX_HAVE_S_ISREG 1"
+.LASF223:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2604:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16find_last_not_ofEcm"
+.LASF2699:
+	.string	"_ZNSt6vectorIcSaIcEEaSESt16initializer_listIcE"
+.LASF1468:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF408:
+	.string	"__amd64 1"
+.LASF3041:
+	.string	"_flags2"
+.LASF685:
+	.string	"__HAVE_GENERIC_SELECTION 0"
+.LASF1872:
+	.string	"_VA_LIST_DEFINED "
+.LASF1495:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1484:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1930:
+	.string	"rewind"
+.LASF2156:
+	.string	"_ZNVSt13__atomic_baseImEaSEm"
+.LASF1289:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2696:
+	.string	"_ZNSt6vectorIcSaIcEED4Ev"
+.LASF2327:
+	.string	"remove_prefix"
+.LASF634:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2753:
+	.string	"_M_default_append"
+.LASF2746:
+	.string	"_ZNSt6vectorIcSaIcEE18_M_fill_initializeEmRKc"
+.LASF714:
+	.string	"_GLIBCXX_USE_C99_COMPLEX _GLIBCXX11_USE_C99_COMPLEX"
+.LASF1225:
+	.string	"__ldiv_t_defined 1"
+.LASF2801:
+	.string	"__relocate_a_1<char, char>"
+.LASF3077:
+	.string	"n_cs_precedes"
+.LASF1338:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF3048:
+	.string	"_codecvt"
+.LASF1140:
+	.string	"__DEFINED_size_t "
+.LASF983:
+	.string	"_GLIBCXX_USE_PTHREAD_RWLOCK_CLOCKLOCK 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1605:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF598:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF2185:
+	.string	"store"
+.LASF2936:
+	.string	"__uint_least64_t"
+.LASF497:
+	.string	"_GLIBCXX_END_NAMESPACE_CONTAINER "
+.LASF619:
+	.string	"__THROW noexcept (true)"
+.LASF1049:
+	.string	"_STL_ITERATOR_BASE_FUNCS_H 1"
+.LASF2387:
+	.string	"_Alloc_hider"
+.LASF706:
+	.string	"_GLIBCXX_WEAK_DEFINITION "
+.LASF1120:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF3031:
+	.string	"_IO_write_ptr"
+.LASF2598:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17find_first_not_ofEPKcmm"
+.LASF2563:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_S8_S8_"
+.LASF1496:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1602:
+	.string	"CLOCK_REALTIME 0"
+.LASF1190:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF175:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF2952:
+	.string	"tv_nsec"
+.LASF503:
+	.string	"_GLIBCXX_NAMESPACE_LDBL "
+.LASF40:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF372:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF2413:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE11_M_capacityEm"
+.LASF2010:
+	.string	"ENOSTR 60"
+.LASF859:
+	.string	"_GLIBCXX_HAVE_POLL 1"
+.LASF1052:
+	.string	"__glibcxx_class_requires(_a,_b) "
+.LASF2786:
+	.string	"_ZSt20__throw_length_errorPKc"
+.LASF485:
+	.string	"_GLIBCXX_EXTERN_TEMPLATE 1"
+.LASF2127:
+	.string	"random_access_iterator_tag"
+.LASF1545:
+	.string	"UINTMAX_WIDTH 64"
+.LASF2512:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5frontEv"
+.LASF1431:
+	.string	"_Exit"
+.LASF2647:
+	.string	"_Tp_alloc_type"
+.LASF268:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1859:
+	.string	"_STRING_CONVERSIONS_H 1"
+.LASF2064:
+	.string	"EALREADY 114"
+.LASF2658:
+	.string	"_ZNSt12_Vector_baseIcSaIcEEC4EOS0_"
+.LASF2363:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE17find_first_not_ofEcm"
+.LASF621:
+	.string	"__NTH(fct) __LEAF_ATTR fct __THROW"
+.LASF1162:
+	.string	"_BSD_WCHAR_T_"
+.LASF2784:
+	.string	"__throw_bad_alloc"
+.LASF1388:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1954:
+	.string	"EINTR 4"
+.LASF2027:
+	.string	"EBADFD 77"
+.LASF137:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF703:
+	.string	"_GLIBCXX_GTHREAD_USE_WEAK 0"
+.LASF633:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1192:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF417:
+	.string	"__k8 1"
+.LASF1118:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1294:
+	.string	"__STD_TYPE"
+.LASF1511:
+	.string	"INT64_C(c) c ## L"
+.LASF2219:
+	.string	"_ZNVSt13__atomic_baseImE9fetch_xorEmSt12memory_order"
+.LASF140:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF151:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1567:
+	.string	"__cpp_lib_atomic_is_always_lock_free 201603L"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1214:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF173:
+	.string	"__INT8_C(c) c"
+.LASF1191:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1146:
+	.string	"__wchar_t__ "
+.LASF2657:
+	.string	"_ZNSt12_Vector_baseIcSaIcEEC4EOS1_"
+.LASF1648:
+	.string	"STA_PPSJITTER 0x0200"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF601:
+	.string	"__USE_ATFILE 1"
+.LASF1751:
+	.string	"_GLIBCXX_CXX_ALLOCATOR_H 1"
+.LASF2675:
+	.string	"_ZNSt6vectorIcSaIcEE19_S_nothrow_relocateESt17integral_constantIbLb1EE"
+.LASF2195:
+	.string	"compare_exchange_weak"
+.LASF125:
+	.string	"__cpp_guaranteed_copy_elision 201606L"
+.LASF640:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __THROWNL __asm__ (__ASMNAME (#alias))"
+.LASF2969:
+	.string	"_ZN6__pstl9execution2v127parallel_unsequenced_policy14__allow_vectorEv"
+.LASF975:
+	.string	"_GLIBCXX_USE_GET_NPROCS 1"
+.LASF1097:
+	.string	"_INITIALIZER_LIST "
+.LASF317:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF876:
+	.string	"_GLIBCXX_HAVE_SOCKATMARK 1"
+.LASF839:
+	.string	"_GLIBCXX_HAVE_LINK 1"
+.LASF2625:
+	.string	"string"
+.LASF798:
+	.string	"_GLIBCXX_HAVE_EXCEPTION_PTR_SINCE_GCC46 1"
+.LASF2205:
+	.string	"fetch_add"
+.LASF2014:
+	.string	"ENONET 64"
+.LASF717:
+	.string	"_GLIBCXX_USE_C99_WCHAR _GLIBCXX11_USE_C99_WCHAR"
+.LASF1960:
+	.string	"ECHILD 10"
+.LASF2708:
+	.string	"_ZNSt6vectorIcSaIcEE4rendEv"
+.LASF649:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2208:
+	.string	"fetch_sub"
+.LASF2095:
+	.string	"_GLIBCXX_USE_ASSIGN_FOR_INIT(T,U) __is_trivial(T) && __is_assignable(T&, U) && std::__check_constructible<T, U>()"
+.LASF447:
+	.string	"_GLIBCXX_ALGORITHM 1"
+.LASF2997:
+	.string	"intptr_t"
+.LASF3186:
+	.string	"decltype(nullptr)"
+.LASF2662:
+	.string	"_ZNSt12_Vector_baseIcSaIcEED4Ev"
+.LASF22:
+	.string	"_LP64 1"
+.LASF2153:
+	.string	"_ZNKSt13__atomic_baseImEcvmEv"
+.LASF2617:
+	.string	"_ZNSt16initializer_listIcEC4EPKcm"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF562:
+	.string	"_POSIX_C_SOURCE"
+.LASF2921:
+	.string	"__int8_t"
+.LASF852:
+	.string	"_GLIBCXX_HAVE_MODF 1"
+.LASF2582:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4findERKS4_m"
+.LASF757:
+	.string	"_PSTL_MONOTONIC_PRESENT (__INTEL_COMPILER >= 1800)"
+.LASF2787:
+	.string	"__fill_a1<char>"
+.LASF3078:
+	.string	"n_sep_by_space"
+.LASF144:
+	.string	"__WINT_MIN__ 0U"
+.LASF277:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF730:
+	.string	"_PSTL_ASSERT_MSG(_Condition,_Message) __glibcxx_assert(_Condition)"
+.LASF566:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF536:
+	.string	"__USE_LARGEFILE"
+.LASF2620:
+	.string	"_ZNKSt16initializer_listIcE5beginEv"
+.LASF2631:
+	.string	"_Vector_base<char, std::allocator<char> >"
+.LASF2777:
+	.string	"reverse_iterator<__gnu_cxx::__normal_iterator<char*, std::vector<char, std::allocator<char> > > >"
+.LASF740:
+	.string	"_PSTL_STRING_CONCAT(x,y) x #y"
+.LASF1911:
+	.string	"fprintf"
+.LASF398:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF3064:
+	.string	"thousands_sep"
+.LASF568:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF2392:
+	.string	"_M_local_buf"
+.LASF1176:
+	.string	"__WCLONE 0x80000000"
+.LASF1580:
+	.string	"memmove"
+.LASF166:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF142:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1198:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1037:
+	.string	"_MOVE_H 1"
+.LASF1075:
+	.string	"__glibcxx_requires_sorted(_First,_Last) "
+.LASF1092:
+	.string	"_GLIBCXX_MOVE3(_Tp,_Up,_Vp) std::move(_Tp, _Up, _Vp)"
+.LASF319:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1717:
+	.string	"wcschr"
+.LASF220:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF177:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1396:
+	.string	"_ALLOCA_H 1"
+.LASF2135:
+	.string	"memory_order_release"
+.LASF709:
+	.string	"_GLIBCXX_TXN_SAFE_DYN "
+.LASF1792:
+	.string	"LC_NUMERIC_MASK (1 << __LC_NUMERIC)"
+.LASF1862:
+	.string	"_____fpos64_t_defined 1"
+.LASF3133:
+	.string	"__diffmax"
+.LASF1704:
+	.string	"putwc"
+.LASF195:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1529:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF2268:
+	.string	"const_pointer"
+.LASF1058:
+	.string	"_GLIBCXX_DEBUG_PEDASSERT(_Condition) "
+.LASF866:
+	.string	"_GLIBCXX_HAVE_READLINK 1"
+.LASF1196:
+	.string	"_BITS_FLOATN_H "
+.LASF1371:
+	.string	"__fsblkcnt_t_defined "
+.LASF1973:
+	.string	"ENFILE 23"
+.LASF2734:
+	.string	"_ZNSt6vectorIcSaIcEE9push_backERKc"
+.LASF2544:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEN9__gnu_cxx17__normal_iteratorIPKcS4_EEc"
+.LASF1138:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1804:
+	.string	"LC_GLOBAL_LOCALE ((locale_t) -1L)"
+.LASF2294:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEEaSERKS2_"
+.LASF120:
+	.string	"__cpp_deduction_guides 201703L"
+.LASF457:
+	.string	"_GLIBCXX_USE_DEPRECATED 1"
+.LASF2501:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8capacityEv"
+.LASF2365:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE17find_first_not_ofEPKcm"
+.LASF1957:
+	.string	"E2BIG 7"
+.LASF426:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2893:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEE4baseEv"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF905:
+	.string	"_GLIBCXX_HAVE_SYS_UIO_H 1"
+.LASF1687:
+	.string	"WEOF (0xffffffffu)"
+.LASF1654:
+	.string	"STA_CLK 0x8000"
+.LASF1942:
+	.string	"snprintf"
+.LASF1972:
+	.string	"EINVAL 22"
+.LASF1215:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1837:
+	.string	"__cpp_lib_transparent_operators 201510L"
+.LASF1374:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1358:
+	.string	"__NFDBITS"
+.LASF2558:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_RKS4_"
+.LASF2993:
+	.string	"uint_fast8_t"
+.LASF3046:
+	.string	"_lock"
+.LASF164:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1992:
+	.string	"ENOMSG 42"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF3106:
+	.string	"_ZNK9simulator8log_ring12get_capacityEv"
+.LASF1766:
+	.string	"__LC_NUMERIC 1"
+.LASF2791:
+	.string	"_FIte"
+.LASF2773:
+	.string	"_ZNSt6vectorIcSaIcEE14_M_move_assignEOS1_St17integral_constantIbLb0EE"
+.LASF585:
+	.string	"__USE_XOPEN2K 1"
+.LASF2963:
+	.string	"parallel_policy"
+.LASF2981:
+	.string	"int_least8_t"
+.LASF2497:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6resizeEm"
+.LASF1425:
+	.string	"strtod"
+.LASF1437:
+	.string	"strtof"
+.LASF2531:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignERKS4_mm"
+.LASF788:
+	.string	"_GLIBCXX_HAVE_COMPLEX_H 1"
+.LASF202:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1597:
+	.string	"strtok"
+.LASF1426:
+	.string	"strtol"
+.LASF2931:
+	.string	"__int_least16_t"
+.LASF1397:
+	.string	"alloca"
+.LASF2716:
+	.string	"_ZNSt6vectorIcSaIcEE6resizeEm"
+.LASF2237:
+	.string	"_ZNSt11char_traitsIcE7compareEPKcS2_m"
+.LASF2488:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6cbeginEv"
+.LASF1777:
+	.string	"__LC_IDENTIFICATION 12"
+.LASF260:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF2583:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4findEPKcm"
+.LASF719:
+	.string	"_GLIBCXX_FLOAT_IS_IEEE_BINARY32 1"
+.LASF1323:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1895:
+	.string	"stderr stderr"
+.LASF692:
+	.string	"__stub___compat_bdflush "
+.LASF2204:
+	.string	"_ZNVSt13__atomic_baseImE23compare_exchange_strongERmmSt12memory_order"
+.LASF1886:
+	.string	"TMP_MAX 238328"
+.LASF2119:
+	.string	"_ZNKSt17integral_constantIbLb1EEcvbEv"
+.LASF2995:
+	.string	"uint_fast32_t"
+.LASF2214:
+	.string	"fetch_or"
+.LASF2297:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5beginEv"
+.LASF1737:
+	.string	"wcsxfrm"
+.LASF672:
+	.string	"__attribute_copy__"
+.LASF801:
+	.string	"_GLIBCXX_HAVE_EXPL 1"
+.LASF1197:
+	.string	"__HAVE_FLOAT128 1"
+.LASF3179:
+	.string	"_ZNSt6atomicImE19is_always_lock_freeE"
+.LASF2404:
+	.string	"_M_data"
+.LASF1570:
+	.string	"_STRING_H 1"
+.LASF2301:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4cendEv"
+.LASF2070:
+	.string	"EISNAM 120"
+.LASF3189:
+	.string	"__cxa_rethrow"
+.LASF106:
+	.string	"__cpp_digit_separators 201309L"
+.LASF283:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF620:
+	.string	"__THROWNL __THROW"
+.LASF3034:
+	.string	"_IO_buf_end"
+.LASF287:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF804:
+	.string	"_GLIBCXX_HAVE_FCNTL_H 1"
+.LASF2897:
+	.string	"short unsigned int"
+.LASF1865:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF279:
+	.string	"__FLT32_DIG__ 6"
+.LASF996:
+	.string	"_GLIBCXX_USE_WCHAR_T 1"
+.LASF393:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1746:
+	.string	"wcstold"
+.LASF2982:
+	.string	"int_least16_t"
+.LASF2124:
+	.string	"__swappable_with_details"
+.LASF1747:
+	.string	"wcstoll"
+.LASF1003:
+	.string	"__try try"
+.LASF1931:
+	.string	"scanf"
+.LASF2965:
+	.string	"_ZN6__pstl9execution2v115parallel_policy14__allow_vectorEv"
+.LASF1262:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1400:
+	.string	"_GLIBCXX_INCLUDE_NEXT_C_HEADERS"
+.LASF2364:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE17find_first_not_ofEPKcmm"
+.LASF1885:
+	.string	"L_tmpnam 20"
+.LASF704:
+	.string	"_GLIBCXX_CPU_DEFINES 1"
+.LASF718:
+	.string	"_GLIBCXX_USE_FLOAT128 1"
+.LASF559:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF2052:
+	.string	"ENETRESET 102"
+.LASF1729:
+	.string	"wcsrtombs"
+.LASF1452:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1433:
+	.string	"lldiv"
+.LASF676:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF449:
+	.string	"_GLIBCXX_CXX_CONFIG_H 1"
+.LASF707:
+	.string	"_GLIBCXX_USE_WEAK_REF __GXX_WEAK__"
+.LASF421:
+	.string	"__SSE__ 1"
+.LASF1718:
+	.string	"wcscmp"
+.LASF2923:
+	.string	"__int16_t"
+.LASF2976:
+	.string	"unseq"
+.LASF671:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1165:
+	.string	"NULL __null"
+.LASF1721:
+	.string	"wcscspn"
+.LASF3092:
+	.string	"_IO_codecvt"
+.LASF867:
+	.string	"_GLIBCXX_HAVE_SECURE_GETENV 1"
+.LASF567:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF41:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF143:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF742:
+	.string	"_PSTL_HIDE_FROM_ABI_POP "
+.LASF3029:
+	.string	"_IO_read_base"
+.LASF2222:
+	.string	"atomic<long unsigned int>"
+.LASF418:
+	.string	"__k8__ 1"
+.LASF2703:
+	.string	"_ZNKSt6vectorIcSaIcEE5beginEv"
+.LASF3126:
+	.string	"__len"
+.LASF2491:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5crendEv"
+.LASF419:
+	.string	"__code_model_small__ 1"
+.LASF402:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF366:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF630:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF538:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1447:
+	.string	"__STDC_LIMIT_MACROS"
+.LASF1187:
+	.string	"__W_CONTINUED 0xffff"
+.LASF2717:
+	.string	"_ZNSt6vectorIcSaIcEE6resizeEmRKc"
+.LASF1269:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1344:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF1826:
+	.string	"isprint"
+.LASF1459:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1467:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF2621:
+	.string	"_ZNKSt16initializer_listIcE3endEv"
+.LASF2725:
+	.string	"_ZNKSt6vectorIcSaIcEE14_M_range_checkEm"
+.LASF2514:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4backEv"
+.LASF108:
+	.string	"__cpp_static_assert 201411L"
+.LASF507:
+	.string	"_GLIBCXX_BEGIN_NAMESPACE_LDBL_OR_CXX11 _GLIBCXX_BEGIN_NAMESPACE_CXX11"
+.LASF2009:
+	.string	"EBFONT 59"
+.LASF1051:
+	.string	"__glibcxx_function_requires(...) "
+.LASF2216:
+	.string	"_ZNVSt13__atomic_baseImE8fetch_orEmSt12memory_order"
+.LASF1673:
+	.string	"_MEMORYFWD_H 1"
+.LASF347:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1856:
+	.string	"__cpp_lib_string_view 201803L"
+.LASF197:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF748:
+	.string	"_PSTL_PRAGMA_SIMD_SCAN(PRM) "
+.LASF1697:
+	.string	"fwscanf"
+.LASF3018:
+	.string	"__wch"
+.LASF2690:
+	.string	"_ZNSt6vectorIcSaIcEEC4ERKS1_RKS0_"
+.LASF2761:
+	.string	"_M_check_len"
+.LASF295:
+	.string	"__FLT64_DIG__ 15"
+.LASF2875:
+	.string	"base"
+.LASF2266:
+	.string	"address"
+.LASF2442:
+	.string	"_S_move"
+.LASF2712:
+	.string	"_ZNKSt6vectorIcSaIcEE7crbeginEv"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF3079:
+	.string	"p_sign_posn"
+.LASF2487:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4rendEv"
+.LASF2977:
+	.string	"uint8_t"
+.LASF1674:
+	.string	"_CHAR_TRAITS_H 1"
+.LASF1360:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF2220:
+	.string	"_IntTp"
+.LASF2694:
+	.string	"_ZNSt6vectorIcSaIcEEC4ESt16initializer_listIcERKS0_"
+.LASF1390:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF941:
+	.string	"_GLIBCXX11_USE_C99_STDLIB 1"
+.LASF2737:
+	.string	"_ZNSt6vectorIcSaIcEE6insertEN9__gnu_cxx17__normal_iteratorIPKcS1_EERS4_"
+.LASF818:
+	.string	"_GLIBCXX_HAVE_GETIPINFO 1"
+.LASF3024:
+	.string	"__FILE"
+.LASF2938:
+	.string	"__uintmax_t"
+.LASF2562:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_PcSA_"
+.LASF877:
+	.string	"_GLIBCXX_HAVE_SQRTF 1"
+.LASF2236:
+	.string	"compare"
+.LASF357:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF2524:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendEPKc"
+.LASF920:
+	.string	"_GLIBCXX_HAVE_VFWSCANF 1"
+.LASF2573:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4copyEPcmm"
+.LASF1878:
+	.string	"SEEK_SET 0"
+.LASF1455:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1279:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2211:
+	.string	"fetch_and"
+.LASF1720:
+	.string	"wcscpy"
+.LASF3021:
+	.string	"__value"
+.LASF2539:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEmRKS4_"
+.LASF720:
+	.string	"_GLIBCXX_DOUBLE_IS_IEEE_BINARY64 1"
+.LASF2704:
+	.string	"_ZNSt6vectorIcSaIcEE3endEv"
+.LASF471:
+	.string	"_GLIBCXX_USE_CONSTEXPR constexpr"
+.LASF3045:
+	.string	"_shortbuf"
+.LASF993:
+	.string	"_GLIBCXX_USE_UCHAR_C8RTOMB_MBRTOC8_FCHAR8_T 1"
+.LASF651:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF454:
+	.string	"_GLIBCXX_NORETURN __attribute__ ((__noreturn__))"
+.LASF2158:
+	.string	"_ZNSt13__atomic_baseImEppEi"
+.LASF2329:
+	.string	"remove_suffix"
+.LASF192:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1953:
+	.string	"ESRCH 3"
+.LASF34:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1738:
+	.string	"wctob"
+.LASF2163:
+	.string	"_ZNSt13__atomic_baseImEppEv"
+.LASF1223:
+	.string	"__CFLOAT32X _Complex double"
+.LASF746:
+	.string	"_PSTL_PRAGMA_SIMD_REDUCTION(PRM) _PSTL_PRAGMA(omp simd reduction(PRM))"
+.LASF1462:
+	.string	"INT16_MAX (32767)"
+.LASF1442:
+	.string	"_PSTL_EXECUTION_POLICY_DEFS_H "
+.LASF2899:
+	.string	"long long unsigned int"
+.LASF2652:
+	.string	"_Vector_base"
+.LASF98:
+	.string	"__cpp_ref_qualifiers 200710L"
+.LASF759:
+	.string	"_PSTL_UDS_PRESENT (__INTEL_COMPILER >= 1900 && __INTEL_COMPILER_BUILD_DATE >= 20180626)"
+.LASF1906:
+	.string	"fflush"
+.LASF912:
+	.string	"_GLIBCXX_HAVE_TIMESPEC_GET 1"
+.LASF1544:
+	.string	"INTMAX_WIDTH 64"
+.LASF794:
+	.string	"_GLIBCXX_HAVE_DIRENT_H 1"
+.LASF2350:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5rfindEPKcm"
+.LASF1056:
+	.string	"_GLIBCXX_DEBUG_ASSERTIONS_H 1"
+.LASF1838:
+	.string	"_BACKWARD_BINDERS_H 1"
+.LASF515:
+	.string	"_GLIBCXX_BEGIN_EXTERN_C extern \"C\" {"
+.LASF2906:
+	.string	"float"
+.LASF2020:
+	.string	"ECOMM 70"
+.LASF1799:
+	.string	"LC_ADDRESS_MASK (1 << __LC_ADDRESS)"
+.LASF3032:
+	.string	"_IO_write_end"
+.LASF2465:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4EPKcmRKS3_"
+.LASF2180:
+	.string	"_ZNSt13__atomic_baseImEeOEm"
+.LASF2545:
+	.string	"__const_iterator"
+.LASF2140:
+	.string	"__memory_order_mask"
+.LASF1249:
+	.string	"__STD_TYPE typedef"
+.LASF3020:
+	.string	"__count"
+.LASF2896:
+	.string	"unsigned char"
+.LASF3155:
+	.string	"message"
+.LASF322:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1373:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF3123:
+	.string	"__first"
+.LASF1542:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1333:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1628:
+	.string	"MOD_OFFSET ADJ_OFFSET"
+.LASF409:
+	.string	"__amd64__ 1"
+.LASF843:
+	.string	"_GLIBCXX_HAVE_LINUX_TYPES_H 1"
+.LASF2330:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEE13remove_suffixEm"
+.LASF1698:
+	.string	"getwc"
+.LASF960:
+	.string	"_GLIBCXX_USE_C99 1"
+.LASF1727:
+	.string	"wcspbrk"
+.LASF422:
+	.string	"__SSE2__ 1"
+.LASF2004:
+	.string	"EXFULL 54"
+.LASF1060:
+	.string	"__glibcxx_requires_non_empty_range(_First,_Last) "
+.LASF520:
+	.string	"_FEATURES_H 1"
+.LASF514:
+	.string	"_GLIBCXX_SYNCHRONIZATION_HAPPENS_AFTER(A) "
+.LASF606:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1309:
+	.string	"__key_t_defined "
+.LASF184:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF190:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF679:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF263:
+	.string	"__FLT16_DIG__ 3"
+.LASF1925:
+	.string	"putc"
+.LASF3082:
+	.string	"int_p_sep_by_space"
+.LASF3147:
+	.string	"_ZNSaIcEC2Ev"
+.LASF482:
+	.string	"_GLIBCXX_THROW_OR_ABORT(_EXC) (throw (_EXC))"
+.LASF998:
+	.string	"_GLIBCXX_X86_RDRAND 1"
+.LASF1921:
+	.string	"getc"
+.LASF973:
+	.string	"_GLIBCXX_USE_FCHMODAT 1"
+.LASF842:
+	.string	"_GLIBCXX_HAVE_LINUX_RANDOM_H 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1927:
+	.string	"puts"
+.LASF1103:
+	.string	"__cpp_lib_launder 201606L"
+.LASF2741:
+	.string	"_ZNSt6vectorIcSaIcEE5eraseEN9__gnu_cxx17__normal_iteratorIPKcS1_EE"
+.LASF361:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1904:
+	.string	"feof"
+.LASF2359:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE12find_last_ofEPKcmm"
+.LASF1124:
+	.string	"__need_size_t "
+.LASF1929:
+	.string	"rename"
+.LASF2890:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEplEl"
+.LASF3066:
+	.string	"int_curr_symbol"
+.LASF1702:
+	.string	"mbsinit"
+.LASF1061:
+	.string	"__glibcxx_requires_nonempty() "
+.LASF2462:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS4_mRKS3_"
+.LASF2002:
+	.string	"EBADE 52"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1123:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1706:
+	.string	"swprintf"
+.LASF2776:
+	.string	"__type_identity_t"
+.LASF2352:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE13find_first_ofES2_m"
+.LASF1268:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2384:
+	.string	"_ZNSt16allocator_traitsISaIcEE37select_on_container_copy_constructionERKS0_"
+.LASF1019:
+	.string	"__glibcxx_digits10"
+.LASF340:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1539:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1560:
+	.string	"ATOMIC_LONG_LOCK_FREE __GCC_ATOMIC_LONG_LOCK_FREE"
+.LASF1772:
+	.string	"__LC_PAPER 7"
+.LASF844:
+	.string	"_GLIBCXX_HAVE_LOCALE_H 1"
+.LASF2172:
+	.string	"_ZNVSt13__atomic_baseImEmIEm"
+.LASF2719:
+	.string	"_ZNKSt6vectorIcSaIcEE8capacityEv"
+.LASF2513:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5frontEv"
+.LASF829:
+	.string	"_GLIBCXX_HAVE_ISWBLANK 1"
+.LASF2401:
+	.string	"_M_sv"
+.LASF1743:
+	.string	"wmemset"
+.LASF1490:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF919:
+	.string	"_GLIBCXX_HAVE_UTIME_H 1"
+.LASF1510:
+	.string	"INT32_C(c) c"
+.LASF1722:
+	.string	"wcsftime"
+.LASF1160:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1576:
+	.string	"_GLIBCXX_CSTRING 1"
+.LASF612:
+	.string	"_SYS_CDEFS_H 1"
+.LASF443:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF552:
+	.string	"_ISOC95_SOURCE"
+.LASF563:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1432:
+	.string	"llabs"
+.LASF1679:
+	.string	"__GNUC_VA_LIST "
+.LASF3090:
+	.string	"__fpos_t"
+.LASF1175:
+	.string	"__WALL 0x40000000"
+.LASF657:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2295:
+	.string	"const_iterator"
+.LASF1451:
+	.string	"_STDINT_H 1"
+.LASF1809:
+	.string	"_GLIBCXX_NUM_CATEGORIES 6"
+.LASF1506:
+	.string	"WINT_MIN (0u)"
+.LASF1806:
+	.string	"setlocale"
+.LASF809:
+	.string	"_GLIBCXX_HAVE_FINITEL 1"
+.LASF553:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1830:
+	.string	"isxdigit"
+.LASF1414:
+	.string	"labs"
+.LASF979:
+	.string	"_GLIBCXX_USE_NANOSLEEP 1"
+.LASF403:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1902:
+	.string	"clearerr"
+.LASF1736:
+	.string	"wcstoul"
+.LASF1004:
+	.string	"__catch(X) catch(X)"
+.LASF2747:
+	.string	"_M_default_initialize"
+.LASF1760:
+	.string	"__allocator_base"
+.LASF1277:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF805:
+	.string	"_GLIBCXX_HAVE_FDOPENDIR 1"
+.LASF2770:
+	.string	"_ZNSt6vectorIcSaIcEE8_M_eraseEN9__gnu_cxx17__normal_iteratorIPcS1_EES5_"
+.LASF3053:
+	.string	"_mode"
+.LASF2518:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEpLEc"
+.LASF565:
+	.string	"_XOPEN_SOURCE 700"
+.LASF2296:
+	.string	"begin"
+.LASF1133:
+	.string	"__SIZE_T "
+.LASF2852:
+	.string	"_S_nothrow_move"
+.LASF1354:
+	.string	"____sigset_t_defined "
+.LASF2872:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmIEl"
+.LASF555:
+	.string	"_ISOC99_SOURCE 1"
+.LASF2066:
+	.string	"ESTALE 116"
+.LASF1987:
+	.string	"ENOLCK 37"
+.LASF2678:
+	.string	"_S_do_relocate"
+.LASF204:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2671:
+	.string	"type"
+.LASF1845:
+	.string	"_GLIBCXX_RANGE_ACCESS_H 1"
+.LASF1584:
+	.string	"strcmp"
+.LASF949:
+	.string	"_GLIBCXX_FULLY_DYNAMIC_STRING 0"
+.LASF1712:
+	.string	"vswscanf"
+.LASF734:
+	.string	"_PSTL_VERSION_MINOR ((_PSTL_VERSION % 1000) / 10)"
+.LASF2939:
+	.string	"__off_t"
+.LASF1477:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF2438:
+	.string	"_M_disjunct"
+.LASF694:
+	.string	"__stub_fchflags "
+.LASF1603:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF462:
+	.string	"_GLIBCXX14_DEPRECATED _GLIBCXX_DEPRECATED"
+.LASF2533:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignEPKc"
+.LASF1464:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF3166:
+	.string	"_ZNSt6atomicImEC2Em"
+.LASF2221:
+	.string	"__atomic_base<long unsigned int>"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1928:
+	.string	"remove"
+.LASF848:
+	.string	"_GLIBCXX_HAVE_LOGL 1"
+.LASF2313:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE6lengthEv"
+.LASF2520:
+	.string	"append"
+.LASF3145:
+	.string	"_ZNSt12_Vector_baseIcSaIcEE12_Vector_implC2Ev"
+.LASF3100:
+	.string	"_ZN9simulator8log_ringC4Em"
+.LASF2552:
+	.string	"replace"
+.LASF594:
+	.string	"__USE_LARGEFILE 1"
+.LASF1274:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2565:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_S9_S9_"
+.LASF30:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF29:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF217:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF2144:
+	.string	"__atomic_base"
+.LASF262:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF212:
+	.string	"__FLT_RADIX__ 2"
+.LASF872:
+	.string	"_GLIBCXX_HAVE_SINF 1"
+.LASF1011:
+	.ascii	"_GLIBCXX_INT_N_TRAITS(T,WIDTH) __extension__ template<> stru"
+	.ascii	"ct __is_int"
+	.string	"eger_nonstrict<T> { enum { __value = 1 }; typedef std::__true_type __type; enum { __width = WIDTH }; }; __extension__ template<> struct __is_integer_nonstrict<unsigned T> { enum { __value = 1 }; typedef std::__true_type __type; enum { __width = WIDTH }; };"
+.LASF1707:
+	.string	"swscanf"
+.LASF2966:
+	.string	"_ZN6__pstl9execution2v115parallel_policy16__allow_parallelEv"
+.LASF194:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF490:
+	.string	"_GLIBCXX_END_NAMESPACE_CXX11 }"
+.LASF1564:
+	.string	"_GLIBCXX20_INIT(I) "
+.LASF1611:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF2570:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_M_replaceEmmPKcm"
+.LASF2567:
+	.string	"_M_replace_aux"
+.LASF806:
+	.string	"_GLIBCXX_HAVE_FENV_H 1"
+.LASF170:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF2025:
+	.string	"EOVERFLOW 75"
+.LASF661:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1711:
+	.string	"vswprintf"
+.LASF3107:
+	.string	"_ZN9simulator8log_ringC4ERKS0_"
+.LASF1135:
+	.string	"_BSD_SIZE_T_ "
+.LASF2726:
+	.string	"_ZNSt6vectorIcSaIcEE2atEm"
+.LASF1240:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1053:
+	.string	"__glibcxx_class_requires2(_a,_b,_c) "
+.LASF2814:
+	.string	"__uninitialized_default_n<char*, long unsigned int>"
+.LASF2894:
+	.string	"__normal_iterator<char*, std::vector<char, std::allocator<char> > >"
+.LASF643:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1636:
+	.string	"MOD_TAI ADJ_TAI"
+.LASF857:
+	.string	"_GLIBCXX_HAVE_NETINET_TCP_H 1"
+.LASF1848:
+	.string	"_EXT_ALLOC_TRAITS_H 1"
+.LASF1212:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1412:
+	.string	"free"
+.LASF777:
+	.string	"_GLIBCXX_HAVE_ASINF 1"
+.LASF244:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2887:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmmEi"
+.LASF2505:
+	.string	"clear"
+.LASF1324:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1227:
+	.string	"RAND_MAX 2147483647"
+.LASF2886:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmmEv"
+.LASF455:
+	.string	"_GLIBCXX_HAVE_ATTRIBUTE_VISIBILITY 1"
+.LASF2611:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareEmmPKcm"
+.LASF2839:
+	.string	"_S_select_on_copy"
+.LASF3163:
+	.string	"_ZNSt6vectorIcSaIcEEC2Ev"
+.LASF510:
+	.string	"__glibcxx_constexpr_assert(cond) if (std::__is_constant_evaluated() && !bool(cond)) __builtin_unreachable()"
+.LASF1419:
+	.string	"mbtowc"
+.LASF2339:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareEPKc"
+.LASF248:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2941:
+	.string	"__clock_t"
+.LASF2559:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_S8_m"
+.LASF285:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF495:
+	.string	"_GLIBCXX_STD_C std"
+.LASF1057:
+	.string	"_GLIBCXX_DEBUG_ASSERT(_Condition) "
+.LASF3013:
+	.string	"fp_offset"
+.LASF1780:
+	.string	"LC_TIME __LC_TIME"
+.LASF2479:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5beginEv"
+.LASF942:
+	.string	"_GLIBCXX11_USE_C99_WCHAR 1"
+.LASF1829:
+	.string	"isupper"
+.LASF2464:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS4_mmRKS3_"
+.LASF2926:
+	.string	"__uint32_t"
+.LASF823:
+	.string	"_GLIBCXX_HAVE_ICONV 1"
+.LASF83:
+	.string	"__cpp_binary_literals 201304L"
+.LASF3183:
+	.string	"_ZN9__gnu_cxx3divExx"
+.LASF1014:
+	.string	"__glibcxx_max_digits10(_Tp) (2 + __glibcxx_floating(_Tp, __FLT_MANT_DIG__, __DBL_MANT_DIG__, __LDBL_MANT_DIG__) * 643L / 2136)"
+.LASF1434:
+	.string	"atoll"
+.LASF544:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF464:
+	.string	"_GLIBCXX17_DEPRECATED [[__deprecated__]]"
+.LASF1814:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF2255:
+	.string	"not_eof"
+.LASF1908:
+	.string	"fgetpos"
+.LASF331:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF359:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF2733:
+	.string	"_ZNKSt6vectorIcSaIcEE4dataEv"
+.LASF2279:
+	.string	"_M_max_size"
+.LASF435:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2407:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_lengthEm"
+.LASF1675:
+	.string	"_GLIBCXX_POSTYPES_H 1"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF231:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1487:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF545:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1538:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF1840:
+	.string	"_GLIBCXX_INVOKE_H 1"
+.LASF786:
+	.string	"_GLIBCXX_HAVE_CEILF 1"
+.LASF605:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF2492:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4sizeEv"
+.LASF3049:
+	.string	"_wide_data"
+.LASF1663:
+	.string	"mktime"
+.LASF667:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1156:
+	.string	"_WCHAR_T_H "
+.LASF2018:
+	.string	"EADV 68"
+.LASF2970:
+	.string	"_ZN6__pstl9execution2v127parallel_unsequenced_policy16__allow_parallelEv"
+.LASF150:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1098:
+	.string	"_STL_HEAP_H 1"
+.LASF324:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1907:
+	.string	"fgetc"
+.LASF2358:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE12find_last_ofEcm"
+.LASF576:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF1292:
+	.string	"_BITS_TIME64_H 1"
+.LASF2477:
+	.string	"operator std::__cxx11::basic_string<char>::__sv_type"
+.LASF918:
+	.string	"_GLIBCXX_HAVE_USELOCALE 1"
+.LASF2424:
+	.string	"_M_construct"
+.LASF2263:
+	.string	"_ZNSt15__new_allocatorIcED4Ev"
+.LASF1403:
+	.string	"aligned_alloc"
+.LASF1982:
+	.string	"EPIPE 32"
+.LASF2999:
+	.string	"intmax_t"
+.LASF1909:
+	.string	"fgets"
+.LASF570:
+	.string	"_DEFAULT_SOURCE"
+.LASF1519:
+	.string	"UINT8_WIDTH 8"
+.LASF1841:
+	.ascii	"_GLIBCXX_MEM_FN_TRAITS2(_CV,_REF,_LVAL,_RVAL) template<typen"
+	.ascii	"ame _Res, typename _Class, typename... _ArgTypes> struct _Me"
+	.ascii	"m_fn_traits<_Res (_Class::*)(_ArgTypes...) _CV _REF> : _Mem_"
+	.ascii	"fn_traits_base<_Res, _CV _Class, _ArgTypes"
+	.string	"...> { using __vararg = false_type; }; template<typename _Res, typename _Class, typename... _ArgTypes> struct _Mem_fn_traits<_Res (_Class::*)(_ArgTypes... ...) _CV _REF> : _Mem_fn_traits_base<_Res, _CV _Class, _ArgTypes...> { using __vararg = true_type; };"
+.LASF2584:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4findEcm"
+.LASF913:
+	.string	"_GLIBCXX_HAVE_TLS 1"
+.LASF2534:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignEmc"
+.LASF1370:
+	.string	"__blkcnt_t_defined "
+.LASF470:
+	.string	"_GLIBCXX_CONSTEXPR constexpr"
+.LASF152:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF811:
+	.string	"_GLIBCXX_HAVE_FLOORF 1"
+.LASF1665:
+	.string	"asctime"
+.LASF1497:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF1204:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2094:
+	.string	"_STL_UNINITIALIZED_H 1"
+.LASF665:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1445:
+	.string	"_GLIBCXX_ATOMIC 1"
+.LASF2030:
+	.string	"ELIBBAD 80"
+.LASF1657:
+	.string	"__itimerspec_defined 1"
+.LASF2345:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4findEPKcm"
+.LASF750:
+	.string	"_PSTL_PRAGMA_SIMD_EXCLUSIVE_SCAN(PRM) "
+.LASF2881:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEC4ERKS2_"
+.LASF2596:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12find_last_ofEcm"
+.LASF1193:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF303:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2474:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEaSEc"
+.LASF2663:
+	.string	"_M_impl"
+.LASF1110:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1962:
+	.string	"ENOMEM 12"
+.LASF845:
+	.string	"_GLIBCXX_HAVE_LOG10F 1"
+.LASF410:
+	.string	"__x86_64 1"
+.LASF807:
+	.string	"_GLIBCXX_HAVE_FINITE 1"
+.LASF2334:
+	.string	"substr"
+.LASF1310:
+	.string	"__clock_t_defined 1"
+.LASF702:
+	.string	"_GLIBCXX_NATIVE_THREAD_ID pthread_self()"
+.LASF512:
+	.string	"__glibcxx_assert(cond) do { __glibcxx_constexpr_assert(cond); } while (false)"
+.LASF407:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2646:
+	.string	"_ZNSt12_Vector_baseIcSaIcEE12_Vector_implC4EOS0_OS2_"
+.LASF1575:
+	.string	"__CORRECT_ISO_CPP_STRINGS_H_PROTO "
+.LASF1235:
+	.string	"__S16_TYPE short int"
+.LASF2005:
+	.string	"ENOANO 55"
+.LASF580:
+	.string	"__USE_ISOCXX11 1"
+.LASF3072:
+	.string	"negative_sign"
+.LASF1757:
+	.string	"_GLIBCXX_OPERATOR_DELETE"
+.LASF1038:
+	.string	"__cpp_lib_addressof_constexpr 201603L"
+.LASF3164:
+	.string	"_ZNSt12_Vector_baseIcSaIcEEC2Ev"
+.LASF1666:
+	.string	"ctime"
+.LASF1483:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1668:
+	.string	"localtime"
+.LASF1653:
+	.string	"STA_MODE 0x4000"
+.LASF948:
+	.string	"_GLIBCXX_ATOMIC_BUILTINS 1"
+.LASF1139:
+	.string	"_SIZE_T_DECLARED "
+.LASF472:
+	.string	"_GLIBCXX14_CONSTEXPR constexpr"
+.LASF2495:
+	.string	"resize"
+.LASF3042:
+	.string	"_old_offset"
+.LASF1413:
+	.string	"getenv"
+.LASF1127:
+	.string	"__size_t__ "
+.LASF1505:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1313:
+	.string	"__timer_t_defined 1"
+.LASF1703:
+	.string	"mbsrtowcs"
+.LASF2331:
+	.string	"swap"
+.LASF1330:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF967:
+	.string	"_GLIBCXX_USE_C99_STDINT_TR1 1"
+.LASF779:
+	.string	"_GLIBCXX_HAVE_AS_SYMVER_DIRECTIVE 1"
+.LASF3087:
+	.string	"_G_fpos_t"
+.LASF1492:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1889:
+	.string	"L_cuserid 9"
+.LASF1726:
+	.string	"wcsncpy"
+.LASF1943:
+	.string	"vfscanf"
+.LASF2173:
+	.string	"operator&="
+.LASF228:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2447:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_S_copy_charsEPcN9__gnu_cxx17__normal_iteratorIS5_S4_EES8_"
+.LASF1875:
+	.string	"_IONBF 2"
+.LASF933:
+	.string	"_GLIBCXX_PACKAGE_TARNAME \"libstdc++\""
+.LASF2957:
+	.string	"__allow_unsequenced"
+.LASF2284:
+	.string	"_ZNSaIcEC4Ev"
+.LASF2988:
+	.string	"uint_least64_t"
+.LASF1273:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2235:
+	.string	"_ZNSt11char_traitsIcE2ltERKcS2_"
+.LASF1608:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF2591:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13find_first_ofEPKcm"
+.LASF2863:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEptEv"
+.LASF1997:
+	.string	"EL3RST 47"
+.LASF826:
+	.string	"_GLIBCXX_HAVE_ISINFL 1"
+.LASF229:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF2910:
+	.string	"__gnu_debug"
+.LASF203:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2460:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS3_"
+.LASF2585:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5rfindERKS4_m"
+.LASF2453:
+	.string	"_M_assign"
+.LASF2202:
+	.string	"_ZNVSt13__atomic_baseImE23compare_exchange_strongERmmSt12memory_orderS2_"
+.LASF2560:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_S8_"
+.LASF2402:
+	.string	"_M_dataplus"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2682:
+	.string	"_ZNSt6vectorIcSaIcEE11_S_relocateEPcS2_S2_RS0_"
+.LASF186:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1088:
+	.string	"__glibcxx_requires_irreflexive2(_First,_Last) "
+.LASF1750:
+	.string	"_ALLOCATOR_H 1"
+.LASF2908:
+	.string	"char16_t"
+.LASF1670:
+	.string	"timespec_get"
+.LASF1283:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF473:
+	.string	"_GLIBCXX17_CONSTEXPR constexpr"
+.LASF1086:
+	.string	"__glibcxx_requires_string_len(_String,_Len) "
+.LASF3112:
+	.string	"_ZNK9simulator8log_ring8copy_outEmPcm"
+.LASF2555:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEmmPKcm"
+.LASF3037:
+	.string	"_IO_save_end"
+.LASF589:
+	.string	"__USE_UNIX98 1"
+.LASF2509:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEixEm"
+.LASF2112:
+	.string	"operator()"
+.LASF2323:
+	.string	"back"
+.LASF439:
+	.string	"DBG 1"
+.LASF2328:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEE13remove_prefixEm"
+.LASF2461:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS4_"
+.LASF1035:
+	.string	"__cpp_lib_has_unique_object_representations 201606L"
+.LASF868:
+	.string	"_GLIBCXX_HAVE_SETENV 1"
+.LASF1525:
+	.string	"UINT64_WIDTH 64"
+.LASF1791:
+	.string	"LC_CTYPE_MASK (1 << __LC_CTYPE)"
+.LASF1093:
+	.string	"_GLIBCXX_MOVE_BACKWARD3(_Tp,_Up,_Vp) std::move_backward(_Tp, _Up, _Vp)"
+.LASF2878:
+	.string	"__normal_iterator<char const*, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >"
+.LASF1821:
+	.string	"isalpha"
+.LASF1547:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF904:
+	.string	"_GLIBCXX_HAVE_SYS_TYPES_H 1"
+.LASF735:
+	.string	"_PSTL_VERSION_PATCH (_PSTL_VERSION % 10)"
+.LASF89:
+	.string	"__cpp_decltype 200707L"
+.LASF209:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1042:
+	.string	"_GLIBCXX_UTILITY_H 1"
+.LASF154:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF765:
+	.string	"_PSTL_USE_NONTEMPORAL_STORES_IF_ALLOWED "
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF2768:
+	.string	"_ZNSt6vectorIcSaIcEE15_M_erase_at_endEPc"
+.LASF1216:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 0"
+.LASF1996:
+	.string	"EL3HLT 46"
+.LASF1206:
+	.string	"__HAVE_FLOAT64 1"
+.LASF819:
+	.string	"_GLIBCXX_HAVE_GETS 1"
+.LASF339:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF532:
+	.string	"__USE_XOPEN2K"
+.LASF2055:
+	.string	"ENOBUFS 105"
+.LASF2043:
+	.string	"EPROTONOSUPPORT 93"
+.LASF1074:
+	.string	"__glibcxx_requires_can_decrement_range(_First1,_Last1,_First2) "
+.LASF554:
+	.string	"_ISOC99_SOURCE"
+.LASF1614:
+	.string	"_BITS_TIMEX_H 1"
+.LASF3117:
+	.string	"operator delete"
+.LASF288:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2261:
+	.string	"_ZNSt15__new_allocatorIcEC4ERKS0_"
+.LASF636:
+	.string	"__flexarr []"
+.LASF1404:
+	.string	"atexit"
+.LASF2265:
+	.string	"pointer"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1136:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF3158:
+	.string	"header"
+.LASF2889:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEpLEl"
+.LASF1039:
+	.string	"_GLIBCXX_FWDREF(_Tp) _Tp&&"
+.LASF1395:
+	.string	"__have_pthread_attr_t 1"
+.LASF326:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF2774:
+	.string	"_M_data_ptr<char>"
+.LASF1081:
+	.string	"__glibcxx_requires_partitioned_lower_pred(_First,_Last,_Value,_Pred) "
+.LASF390:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2956:
+	.string	"sequenced_policy"
+.LASF2665:
+	.string	"_ZNSt12_Vector_baseIcSaIcEE11_M_allocateEm"
+.LASF526:
+	.string	"__USE_POSIX2"
+.LASF782:
+	.string	"_GLIBCXX_HAVE_ATANF 1"
+.LASF1601:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF1959:
+	.string	"EBADF 9"
+.LASF168:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF241:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF2282:
+	.string	"allocator<char>"
+.LASF3153:
+	.string	"source"
+.LASF2403:
+	.string	"_M_string_length"
+.LASF1644:
+	.string	"STA_DEL 0x0020"
+.LASF1258:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF890:
+	.string	"_GLIBCXX_HAVE_STRXFRM_L 1"
+.LASF2551:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8pop_backEv"
+.LASF2175:
+	.string	"_ZNVSt13__atomic_baseImEaNEm"
+.LASF3122:
+	.string	"__cxa_begin_catch"
+.LASF1705:
+	.string	"putwchar"
+.LASF1377:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF2333:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4copyEPcmm"
+.LASF2817:
+	.string	"_ZSt27__uninitialized_default_n_aIPcmcET_S1_T0_RSaIT1_E"
+.LASF2230:
+	.string	"_ZNSt6atomicImEC4Em"
+.LASF1978:
+	.string	"ENOSPC 28"
+.LASF2754:
+	.string	"_ZNSt6vectorIcSaIcEE17_M_default_appendEm"
+.LASF1048:
+	.string	"_STL_ITERATOR_BASE_TYPES_H 1"
+.LASF2224:
+	.string	"_ZNSt6atomicImEC4Ev"
+.LASF1671:
+	.string	"_GLIBCXX_STRING 1"
+.LASF79:
+	.string	"__DEPRECATED 1"
+.LASF2651:
+	.string	"_ZNKSt12_Vector_baseIcSaIcEE13get_allocatorEv"
+.LASF3086:
+	.string	"int_n_sign_posn"
+.LASF1153:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1501:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF352:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF2642:
+	.string	"_ZNSt12_Vector_baseIcSaIcEE12_Vector_implC4Ev"
+.LASF935:
+	.string	"_GLIBCXX_PACKAGE__GLIBCXX_VERSION \"version-unused\""
+.LASF222:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1749:
+	.string	"__cpp_lib_constexpr_char_traits 201611L"
+.LASF2286:
+	.string	"~allocator"
+.LASF2123:
+	.string	"__swappable_details"
+.LASF224:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF874:
+	.string	"_GLIBCXX_HAVE_SINHL 1"
+.LASF323:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2157:
+	.string	"operator++"
+.LASF2082:
+	.string	"ERFKILL 132"
+.LASF2666:
+	.string	"_M_deallocate"
+.LASF2457:
+	.string	"_M_erase"
+.LASF1920:
+	.string	"fwrite"
+.LASF1795:
+	.string	"LC_MONETARY_MASK (1 << __LC_MONETARY)"
+.LASF856:
+	.string	"_GLIBCXX_HAVE_NETINET_IN_H 1"
+.LASF2167:
+	.string	"operator+="
+.LASF3089:
+	.string	"__state"
+.LASF2528:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9push_backEc"
+.LASF489:
+	.string	"_GLIBCXX_BEGIN_NAMESPACE_CXX11 namespace __cxx11 {"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF2895:
+	.string	"__normal_iterator<char const*, std::vector<char, std::allocator<char> > >"
+.LASF2907:
+	.string	"wchar_t"
+.LASF3076:
+	.string	"p_sep_by_space"
+.LASF2715:
+	.string	"_ZNKSt6vectorIcSaIcEE8max_sizeEv"
+.LASF2613:
+	.string	"_Alloc"
+.LASF2850:
+	.string	"_S_always_equal"
+.LASF1032:
+	.string	"__cpp_lib_is_swappable 201603L"
+.LASF306:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2431:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17_M_use_local_dataEv"
+.LASF2349:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5rfindEPKcmm"
+.LASF1710:
+	.string	"vfwscanf"
+.LASF2215:
+	.string	"_ZNSt13__atomic_baseImE8fetch_orEmSt12memory_order"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1046:
+	.string	"_GLIBCXX_DEPRECATED_PAIR_CTOR"
+.LASF791:
+	.string	"_GLIBCXX_HAVE_COSHL 1"
+.LASF2482:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE3endEv"
+.LASF162:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF3130:
+	.string	"__alloc"
+.LASF116:
+	.string	"__cpp_if_constexpr 201606L"
+.LASF3129:
+	.string	"__result"
+.LASF1449:
+	.string	"__STDC_CONSTANT_MACROS"
+.LASF2833:
+	.string	"_ZSt23__is_constant_evaluatedv"
+.LASF1748:
+	.string	"wcstoull"
+.LASF1122:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF728:
+	.string	"_PSTL_PAR_BACKEND_TBB "
+.LASF3009:
+	.string	"tm_isdst"
+.LASF1822:
+	.string	"iscntrl"
+.LASF1154:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF2079:
+	.string	"EKEYREJECTED 129"
+.LASF3075:
+	.string	"p_cs_precedes"
+.LASF797:
+	.string	"_GLIBCXX_HAVE_ENDIAN_H 1"
+.LASF2188:
+	.string	"_ZNVSt13__atomic_baseImE5storeEmSt12memory_order"
+.LASF2624:
+	.string	"reverse_iterator<__gnu_cxx::__normal_iterator<char const*, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >"
+.LASF891:
+	.string	"_GLIBCXX_HAVE_SYMLINK 1"
+.LASF2684:
+	.string	"_ZNSt6vectorIcSaIcEEC4Ev"
+.LASF1070:
+	.string	"__glibcxx_requires_cond(_Cond,_Msg) "
+.LASF896:
+	.string	"_GLIBCXX_HAVE_SYS_RESOURCE_H 1"
+.LASF261:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF127:
+	.string	"__cpp_sized_deallocation 201309L"
+.LASF2525:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendEmc"
+.LASF499:
+	.string	"_GLIBCXX_BEGIN_NAMESPACE_ALGO "
+.LASF535:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF2160:
+	.string	"operator--"
+.LASF364:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF3173:
+	.string	"align_val_t"
+.LASF796:
+	.string	"_GLIBCXX_HAVE_DLFCN_H 1"
+.LASF2170:
+	.string	"operator-="
+.LASF2862:
+	.string	"operator->"
+.LASF1946:
+	.string	"vsscanf"
+.LASF1533:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF675:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF375:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1378:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2990:
+	.string	"int_fast16_t"
+.LASF2549:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5eraseEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_"
+.LASF3170:
+	.string	"__int128 unsigned"
+.LASF147:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF313:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2105:
+	.string	"_VECTOR_TCC 1"
+.LASF1977:
+	.string	"EFBIG 27"
+.LASF1627:
+	.string	"ADJ_OFFSET_SS_READ 0xa001"
+.LASF1784:
+	.string	"LC_ALL __LC_ALL"
+.LASF1733:
+	.string	"wcstof"
+.LASF1676:
+	.string	"_WCHAR_H 1"
+.LASF38:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1734:
+	.string	"wcstok"
+.LASF1532:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1530:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF1815:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF2148:
+	.string	"_ZNSt13__atomic_baseImEC4ERKS0_"
+.LASF1489:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1001:
+	.string	"_FUNCTEXCEPT_H 1"
+.LASF2828:
+	.string	"_ZStanSt12memory_orderSt23__memory_order_modifier"
+.LASF2609:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareEPKc"
+.LASF2901:
+	.string	"short int"
+.LASF1326:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1813:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF2692:
+	.string	"_ZNSt6vectorIcSaIcEEC4EOS1_RKS0_St17integral_constantIbLb0EE"
+.LASF2816:
+	.string	"__uninitialized_default_n_a<char*, long unsigned int, char>"
+.LASF2225:
+	.string	"~atomic"
+.LASF1870:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF280:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1877:
+	.string	"EOF (-1)"
+.LASF478:
+	.string	"_GLIBCXX_NOEXCEPT_IF(...) noexcept(__VA_ARGS__)"
+.LASF1893:
+	.string	"stdin stdin"
+.LASF2783:
+	.string	"enable_if<true, char*>"
+.LASF1128:
+	.string	"__SIZE_T__ "
+.LASF1149:
+	.string	"_T_WCHAR_ "
+.LASF1754:
+	.string	"_GLIBCXX_OPERATOR_DELETE ::operator delete"
+.LASF2417:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE11_M_is_localEv"
+.LASF480:
+	.string	"_GLIBCXX_THROW(_EXC) "
+.LASF1471:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF2576:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5c_strEv"
+.LASF2196:
+	.string	"_ZNSt13__atomic_baseImE21compare_exchange_weakERmmSt12memory_orderS2_"
+.LASF2792:
+	.string	"__fill_n_a<char*, long unsigned int, char>"
+.LASF1558:
+	.string	"ATOMIC_SHORT_LOCK_FREE __GCC_ATOMIC_SHORT_LOCK_FREE"
+.LASF1424:
+	.string	"srand"
+.LASF1926:
+	.string	"putchar"
+.LASF1180:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF2811:
+	.string	"_Allocator"
+.LASF1286:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1448:
+	.string	"__STDC_LIMIT_MACROS "
+.LASF1488:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF201:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1168:
+	.string	"WNOHANG 1"
+.LASF1402:
+	.string	"abort"
+.LASF1071:
+	.string	"__glibcxx_requires_valid_range(_First,_Last) "
+.LASF1989:
+	.string	"ENOTEMPTY 39"
+.LASF1807:
+	.string	"localeconv"
+.LASF548:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1941:
+	.string	"vsprintf"
+.LASF2543:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEmmc"
+.LASF1015:
+	.string	"__glibcxx_digits10(_Tp) __glibcxx_floating(_Tp, __FLT_DIG__, __DBL_DIG__, __LDBL_DIG__)"
+.LASF957:
+	.string	"_GLIBCXX_SYMVER 1"
+.LASF623:
+	.string	"__P(args) args"
+.LASF2347:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5rfindES2_m"
+.LASF2370:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE16find_last_not_ofEPKcm"
+.LASF3038:
+	.string	"_markers"
+.LASF1860:
+	.string	"_STDIO_H 1"
+.LASF21:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF3040:
+	.string	"_fileno"
+.LASF632:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF2111:
+	.string	"operator std::integral_constant<bool, false>::value_type"
+.LASF1976:
+	.string	"ETXTBSY 26"
+.LASF2803:
+	.string	"__niter_base<char*>"
+.LASF2933:
+	.string	"__int_least32_t"
+.LASF2480:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5beginEv"
+.LASF925:
+	.string	"_GLIBCXX_HAVE_WCTYPE_H 1"
+.LASF2200:
+	.string	"compare_exchange_strong"
+.LASF1624:
+	.string	"ADJ_NANO 0x2000"
+.LASF2723:
+	.string	"_ZNKSt6vectorIcSaIcEEixEm"
+.LASF1119:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF2419:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_createERmm"
+.LASF1287:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2655:
+	.string	"_ZNSt12_Vector_baseIcSaIcEEC4Em"
+.LASF284:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2632:
+	.string	"_Vector_impl_data"
+.LASF1863:
+	.string	"__struct_FILE_defined 1"
+.LASF1520:
+	.string	"INT16_WIDTH 16"
+.LASF1293:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2653:
+	.string	"_ZNSt12_Vector_baseIcSaIcEEC4Ev"
+.LASF2161:
+	.string	"_ZNSt13__atomic_baseImEmmEi"
+.LASF2767:
+	.string	"_M_erase_at_end"
+.LASF1460:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF785:
+	.string	"_GLIBCXX_HAVE_AT_QUICK_EXIT 1"
+.LASF3083:
+	.string	"int_n_cs_precedes"
+.LASF2165:
+	.string	"_ZNSt13__atomic_baseImEmmEv"
+.LASF1263:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1833:
+	.string	"isblank"
+.LASF1282:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF309:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF2553:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEmmRKS4_"
+.LASF1238:
+	.string	"__U32_TYPE unsigned int"
+.LASF1785:
+	.string	"LC_PAPER __LC_PAPER"
+.LASF320:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF2021:
+	.string	"EPROTO 71"
+.LASF2532:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignEPKcm"
+.LASF2240:
+	.string	"find"
+.LASF986:
+	.string	"_GLIBCXX_USE_REALPATH 1"
+.LASF2961:
+	.string	"__allow_parallel"
+.LASF655:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF561:
+	.string	"_POSIX_SOURCE 1"
+.LASF3104:
+	.string	"_ZN9simulator8log_ring7try_popERlRNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE"
+.LASF1683:
+	.string	"____mbstate_t_defined 1"
+.LASF1340:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF1522:
+	.string	"INT32_WIDTH 32"
+.LASF1975:
+	.string	"ENOTTY 25"
+.LASF2996:
+	.string	"uint_fast64_t"
+.LASF1353:
+	.string	"__sigset_t_defined 1"
+.LASF1842:
+	.string	"_GLIBCXX_MEM_FN_TRAITS(_REF,_LVAL,_RVAL) _GLIBCXX_MEM_FN_TRAITS2( , _REF, _LVAL, _RVAL) _GLIBCXX_MEM_FN_TRAITS2(const , _REF, _LVAL, _RVAL) _GLIBCXX_MEM_FN_TRAITS2(volatile , _REF, _LVAL, _RVAL) _GLIBCXX_MEM_FN_TRAITS2(const volatile, _REF, _LVAL, _RVAL)"
+.LASF258:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF2831:
+	.string	"__is_constant_evaluated"
+.LASF1233:
+	.string	"_SYS_TYPES_H 1"
+.LASF595:
+	.string	"__USE_LARGEFILE64 1"
+.LASF2983:
+	.string	"int_least32_t"
+.LASF1342:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF1922:
+	.string	"getchar"
+.LASF1617:
+	.string	"ADJ_MAXERROR 0x0004"
+.LASF1241:
+	.string	"__SQUAD_TYPE long int"
+.LASF2854:
+	.string	"rebind<char>"
+.LASF1228:
+	.string	"EXIT_FAILURE 1"
+.LASF373:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2041:
+	.string	"EPROTOTYPE 91"
+.LASF1625:
+	.string	"ADJ_TICK 0x4000"
+.LASF1646:
+	.string	"STA_FREQHOLD 0x0080"
+.LASF2356:
+	.string	"find_last_of"
+.LASF1299:
+	.string	"__gid_t_defined "
+.LASF2902:
+	.string	"long int"
+.LASF2468:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS4_RKS3_"
+.LASF1210:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1639:
+	.string	"STA_PLL 0x0001"
+.LASF731:
+	.string	"_PSTL_CONFIG_H "
+.LASF1410:
+	.string	"calloc"
+.LASF1816:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF2845:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE27_S_propagate_on_copy_assignEv"
+.LASF2925:
+	.string	"__int32_t"
+.LASF1394:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1742:
+	.string	"wmemmove"
+.LASF2213:
+	.string	"_ZNVSt13__atomic_baseImE9fetch_andEmSt12memory_order"
+.LASF761:
+	.string	"_PSTL_PRAGMA_SIMD_ORDERED_MONOTONIC(PRM) "
+.LASF2450:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_S_copy_charsEPcS5_S5_"
+.LASF696:
+	.string	"__stub_revoke "
+.LASF3151:
+	.string	"start"
+.LASF429:
+	.string	"__gnu_linux__ 1"
+.LASF2380:
+	.string	"_ZNSt11char_traitsIcE6assignERcRKc"
+.LASF2942:
+	.string	"__time_t"
+.LASF2823:
+	.string	"_Destroy<char*, char>"
+.LASF39:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF237:
+	.string	"__DBL_NORM_MAX__ double(1.79769313486231570814527423731704357e+308L)"
+.LASF2072:
+	.string	"EDQUOT 122"
+.LASF2517:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEpLEPKc"
+.LASF1512:
+	.string	"UINT8_C(c) c"
+.LASF1345:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF2353:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE13find_first_ofEcm"
+.LASF2697:
+	.string	"_ZNSt6vectorIcSaIcEEaSERKS1_"
+.LASF1203:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF2892:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmiEl"
+.LASF2836:
+	.string	"__gnu_cxx"
+.LASF1898:
+	.string	"RENAME_WHITEOUT (1 << 2)"
+.LASF2919:
+	.string	"lldiv_t"
+.LASF2841:
+	.string	"_S_on_swap"
+.LASF2227:
+	.string	"_ZNSt6atomicImEC4ERKS0_"
+.LASF1824:
+	.string	"isgraph"
+.LASF1267:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2354:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE13find_first_ofEPKcmm"
+.LASF990:
+	.string	"_GLIBCXX_USE_ST_MTIM 1"
+.LASF546:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1073:
+	.string	"__glibcxx_requires_can_increment_range(_First1,_Last1,_First2) "
+.LASF2107:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_GROW"
+.LASF93:
+	.string	"__cpp_variadic_templates 200704L"
+.LASF2422:
+	.string	"_M_destroy"
+.LASF795:
+	.string	"_GLIBCXX_HAVE_DIRFD 1"
+.LASF1147:
+	.string	"__WCHAR_T__ "
+.LASF2607:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareEmmRKS4_"
+.LASF733:
+	.string	"_PSTL_VERSION_MAJOR (_PSTL_VERSION / 1000)"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF3116:
+	.string	"mTail"
+.LASF2793:
+	.string	"_ZSt10__fill_n_aIPcmcET_S1_T0_RKT1_St26random_access_iterator_tag"
+.LASF1638:
+	.string	"MOD_NANO ADJ_NANO"
+.LASF2749:
+	.string	"_M_fill_assign"
+.LASF954:
+	.string	"_GLIBCXX_STDIO_EOF -1"
+.LASF3141:
+	.string	"__in_chrg"
+.LASF2738:
+	.string	"_ZNSt6vectorIcSaIcEE6insertEN9__gnu_cxx17__normal_iteratorIPKcS1_EEOc"
+.LASF1315:
+	.string	"__suseconds_t_defined "
+.LASF2556:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEmmPKc"
+.LASF1183:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1607:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF1534:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF1116:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF992:
+	.string	"_GLIBCXX_USE_UCHAR_C8RTOMB_MBRTOC8_CXX20 1"
+.LASF1632:
+	.string	"MOD_STATUS ADJ_STATUS"
+.LASF639:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __THROW __asm__ (__ASMNAME (#alias))"
+.LASF537:
+	.string	"__USE_LARGEFILE64"
+.LASF1585:
+	.string	"strcoll"
+.LASF385:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF527:
+	.string	"__USE_POSIX199309"
+.LASF2449:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_S_copy_charsEPcN9__gnu_cxx17__normal_iteratorIPKcS4_EESA_"
+.LASF1552:
+	.string	"_GLIBCXX_ATOMIC_LOCK_FREE_H 1"
+.LASF2782:
+	.string	"iterator_traits<char const*>"
+.LASF1808:
+	.string	"_GLIBCXX_C_LOCALE_GNU 1"
+.LASF931:
+	.string	"_GLIBCXX_PACKAGE_NAME \"package-unused\""
+.LASF2423:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_M_destroyEm"
+.LASF3030:
+	.string	"_IO_write_base"
+.LASF2730:
+	.string	"_ZNSt6vectorIcSaIcEE4backEv"
+.LASF591:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF3118:
+	.string	"_ZdlPvm"
+.LASF976:
+	.string	"_GLIBCXX_USE_LFS 1"
+.LASF2241:
+	.string	"_ZNSt11char_traitsIcE4findEPKcmRS1_"
+.LASF488:
+	.string	"_GLIBCXX_NAMESPACE_CXX11 __cxx11::"
+.LASF1819:
+	.string	"_GLIBCXX_CCTYPE 1"
+.LASF103:
+	.string	"__cpp_decltype_auto 201304L"
+.LASF160:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1858:
+	.string	"__cpp_lib_constexpr_string 201611L"
+.LASF2748:
+	.string	"_ZNSt6vectorIcSaIcEE21_M_default_initializeEm"
+.LASF2706:
+	.string	"_ZNSt6vectorIcSaIcEE6rbeginEv"
+.LASF1662:
+	.string	"difftime"
+.LASF575:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF483:
+	.string	"_GLIBCXX_NOEXCEPT_PARM , bool _NE"
+.LASF1640:
+	.string	"STA_PPSFREQ 0x0002"
+.LASF2209:
+	.string	"_ZNSt13__atomic_baseImE9fetch_subEmSt12memory_order"
+.LASF1723:
+	.string	"wcslen"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2357:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE12find_last_ofES2_m"
+.LASF2974:
+	.string	"_ZN6__pstl9execution2v118unsequenced_policy16__allow_parallelEv"
+.LASF185:
+	.string	"__UINT8_C(c) c"
+.LASF376:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2115:
+	.string	"integral_constant<bool, false>"
+.LASF2538:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEN9__gnu_cxx17__normal_iteratorIPKcS4_EESt16initializer_listIcE"
+.LASF1300:
+	.string	"__mode_t_defined "
+.LASF1341:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF2340:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareEmmPKc"
+.LASF230:
+	.string	"__DBL_DIG__ 15"
+.LASF1836:
+	.string	"_STL_FUNCTION_H 1"
+.LASF2418:
+	.string	"_M_create"
+.LASF2073:
+	.string	"ENOMEDIUM 123"
+.LASF2253:
+	.string	"eq_int_type"
+.LASF2484:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6rbeginEv"
+.LASF2076:
+	.string	"ENOKEY 126"
+.LASF167:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1013:
+	.string	"__glibcxx_floating(_Tp,_Fval,_Dval,_LDval) (std::__are_same<_Tp, float>::__value ? _Fval : std::__are_same<_Tp, double>::__value ? _Dval : _LDval)"
+.LASF2291:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEEC4EPKc"
+.LASF2947:
+	.string	"int16_t"
+.LASF3142:
+	.string	"_ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC2Ev"
+.LASF837:
+	.string	"_GLIBCXX_HAVE_LIMIT_RSS 1"
+.LASF2057:
+	.string	"ENOTCONN 107"
+.LASF662:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF3088:
+	.string	"__pos"
+.LASF2861:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEdeEv"
+.LASF1888:
+	.string	"L_ctermid 9"
+.LASF1664:
+	.string	"time"
+.LASF1965:
+	.string	"ENOTBLK 15"
+.LASF3136:
+	.string	"__size"
+.LASF542:
+	.string	"__USE_GNU"
+.LASF1472:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1527:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF1966:
+	.string	"EBUSY 16"
+.LASF1903:
+	.string	"fclose"
+.LASF1365:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF611:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1507:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2868:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEixEl"
+.LASF1615:
+	.string	"ADJ_OFFSET 0x0001"
+.LASF1182:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF1633:
+	.string	"MOD_TIMECONST ADJ_TIMECONST"
+.LASF600:
+	.string	"__USE_MISC 1"
+.LASF1247:
+	.string	"__S64_TYPE long int"
+.LASF1348:
+	.string	"_SYS_SELECT_H 1"
+.LASF2537:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEN9__gnu_cxx17__normal_iteratorIPKcS4_EEmc"
+.LASF2088:
+	.string	"_GLIBCXX_CHARCONV_H 1"
+.LASF2436:
+	.string	"_M_limit"
+.LASF747:
+	.string	"_PSTL_PRAGMA_FORCEINLINE "
+.LASF360:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF551:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF2960:
+	.string	"_ZN6__pstl9execution2v116sequenced_policy14__allow_vectorEv"
+.LASF836:
+	.string	"_GLIBCXX_HAVE_LIMIT_FSIZE 1"
+.LASF1101:
+	.string	"_NEW "
+.LASF2601:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16find_last_not_ofERKS4_m"
+.LASF1939:
+	.string	"vfprintf"
+.LASF1002:
+	.string	"_EXCEPTION_DEFINES_H 1"
+.LASF36:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF2752:
+	.string	"_ZNSt6vectorIcSaIcEE14_M_fill_insertEN9__gnu_cxx17__normal_iteratorIPcS1_EEmRKc"
+.LASF2603:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16find_last_not_ofEPKcm"
+.LASF2569:
+	.string	"_M_replace"
+.LASF2848:
+	.string	"_S_propagate_on_swap"
+.LASF524:
+	.string	"__USE_ISOCXX11"
+.LASF596:
+	.string	"__WORDSIZE 64"
+.LASF111:
+	.string	"__cpp_nested_namespace_definitions 201411L"
+.LASF2011:
+	.string	"ENODATA 61"
+.LASF1932:
+	.string	"setbuf"
+.LASF835:
+	.string	"_GLIBCXX_HAVE_LIMIT_DATA 1"
+.LASF2992:
+	.string	"int_fast64_t"
+.LASF944:
+	.string	"_GLIBCXX98_USE_C99_MATH 1"
+.LASF1430:
+	.string	"wctomb"
+.LASF2023:
+	.string	"EDOTDOT 73"
+.LASF1765:
+	.string	"__LC_CTYPE 0"
+.LASF2586:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5rfindEPKcmm"
+.LASF2191:
+	.string	"_ZNVKSt13__atomic_baseImE4loadESt12memory_order"
+.LASF1248:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1752:
+	.string	"_STD_NEW_ALLOCATOR_H 1"
+.LASF2471:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEED4Ei"
+.LASF1027:
+	.string	"__cpp_lib_is_final 201402L"
+.LASF978:
+	.string	"_GLIBCXX_USE_LSTAT 1"
+.LASF3168:
+	.string	"_ZnwmPv"
+.LASF1852:
+	.string	"_FUNCTIONAL_HASH_H 1"
+.LASF853:
+	.string	"_GLIBCXX_HAVE_MODFF 1"
+.LASF1537:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1379:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1102:
+	.string	"__EXCEPTION_H 1"
+.LASF2771:
+	.string	"_M_move_assign"
+.LASF1363:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1126:
+	.string	"__need_NULL "
+.LASF1325:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF2314:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE8max_sizeEv"
+.LASF1242:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF264:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2659:
+	.string	"_ZNSt12_Vector_baseIcSaIcEEC4EOS1_RKS0_"
+.LASF3102:
+	.string	"_ZN9simulator8log_ring8try_pushElPKcj"
+.LASF1672:
+	.string	"_STRINGFWD_H 1"
+.LASF2668:
+	.string	"_M_create_storage"
+.LASF1171:
+	.string	"WEXITED 4"
+.LASF2168:
+	.string	"_ZNSt13__atomic_baseImEpLEm"
+.LASF1686:
+	.string	"__CORRECT_ISO_CPP_WCHAR_H_PROTO "
+.LASF2259:
+	.string	"__new_allocator"
+.LASF902:
+	.string	"_GLIBCXX_HAVE_SYS_SYSINFO_H 1"
+.LASF3043:
+	.string	"_cur_column"
+.LASF2409:
+	.string	"_M_local_data"
+.LASF122:
+	.string	"__cpp_template_auto 201606L"
+.LASF2762:
+	.string	"_ZNKSt6vectorIcSaIcEE12_M_check_lenEmPKc"
+.LASF592:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF2250:
+	.string	"int_type"
+.LASF112:
+	.string	"__cpp_fold_expressions 201603L"
+.LASF1618:
+	.string	"ADJ_ESTERROR 0x0008"
+.LASF908:
+	.string	"_GLIBCXX_HAVE_TANHF 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1470:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF2315:
+	.string	"empty"
+.LASF2595:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12find_last_ofEPKcm"
+.LASF2285:
+	.string	"_ZNSaIcEC4ERKS_"
+.LASF2630:
+	.string	"_TrivialValueType"
+.LASF955:
+	.string	"_GLIBCXX_STDIO_SEEK_CUR 1"
+.LASF1554:
+	.string	"ATOMIC_CHAR_LOCK_FREE __GCC_ATOMIC_CHAR_LOCK_FREE"
+.LASF3114:
+	.string	"mMask"
+.LASF2416:
+	.string	"_M_is_local"
+.LASF929:
+	.string	"_GLIBCXX_LT_OBJDIR \".libs/\""
+.LASF1208:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2877:
+	.string	"_Container"
+.LASF2139:
+	.string	"__memory_order_modifier"
+.LASF2382:
+	.string	"_ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_"
+.LASF968:
+	.string	"_GLIBCXX_USE_CLOCK_MONOTONIC 1"
+.LASF3178:
+	.string	"is_always_lock_free"
+.LASF2743:
+	.string	"_ZNSt6vectorIcSaIcEE4swapERS1_"
+.LASF2672:
+	.string	"_Type"
+.LASF1366:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF294:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1314:
+	.string	"__useconds_t_defined "
+.LASF87:
+	.string	"__cpp_user_defined_literals 200809L"
+.LASF1072:
+	.string	"__glibcxx_requires_can_increment(_First,_Size) "
+.LASF758:
+	.string	"_PSTL_UDR_PRESENT 1"
+.LASF1739:
+	.string	"wmemchr"
+.LASF2606:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareERKS4_"
+.LASF764:
+	.string	"_PSTL_PRAGMA_VECTOR_UNALIGNED "
+.LASF3172:
+	.string	"input_iterator_tag"
+.LASF2797:
+	.string	"_Construct<char>"
+.LASF1417:
+	.string	"mblen"
+.LASF35:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF2580:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13get_allocatorEv"
+.LASF2623:
+	.string	"reverse_iterator<__gnu_cxx::__normal_iterator<char*, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >"
+.LASF1385:
+	.string	"__LOCK_ALIGNMENT "
+.LASF327:
+	.string	"__FLT32X_DIG__ 15"
+.LASF344:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF362:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF3006:
+	.string	"tm_year"
+.LASF2605:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6substrEmm"
+.LASF1095:
+	.string	"_STL_ALGO_H 1"
+.LASF2348:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5rfindEcm"
+.LASF458:
+	.string	"_GLIBCXX_DEPRECATED __attribute__ ((__deprecated__))"
+.LASF642:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1010:
+	.string	"_EXT_NUMERIC_TRAITS 1"
+.LASF460:
+	.string	"_GLIBCXX11_DEPRECATED _GLIBCXX_DEPRECATED"
+.LASF2918:
+	.string	"7lldiv_t"
+.LASF2081:
+	.string	"ENOTRECOVERABLE 131"
+.LASF3135:
+	.string	"__ptr"
+.LASF2251:
+	.string	"to_int_type"
+.LASF2445:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_S_assignEPcmc"
+.LASF2026:
+	.string	"ENOTUNIQ 76"
+.LASF243:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF646:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF2223:
+	.string	"atomic"
+.LASF1236:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2523:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendEPKcm"
+.LASF2125:
+	.string	"forward_iterator_tag"
+.LASF1355:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF310:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF666:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1993:
+	.string	"EIDRM 43"
+.LASF1067:
+	.string	"_GLIBCXX_MAKE_MOVE_ITERATOR(_Iter) std::make_move_iterator(_Iter)"
+.LASF206:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF2718:
+	.string	"_ZNSt6vectorIcSaIcEE13shrink_to_fitEv"
+.LASF583:
+	.string	"__USE_POSIX199309 1"
+.LASF193:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF486:
+	.string	"_GLIBCXX_USE_DUAL_ABI 1"
+.LASF1311:
+	.string	"__clockid_t_defined 1"
+.LASF2075:
+	.string	"ECANCELED 125"
+.LASF2273:
+	.string	"_ZNSt15__new_allocatorIcE8allocateEmPKv"
+.LASF1008:
+	.string	"__INT_N"
+.LASF715:
+	.string	"_GLIBCXX_USE_C99_STDIO _GLIBCXX11_USE_C99_STDIO"
+.LASF1436:
+	.string	"strtoull"
+.LASF569:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF2612:
+	.string	"_Traits"
+.LASF1634:
+	.string	"MOD_CLKB ADJ_TICK"
+.LASF894:
+	.string	"_GLIBCXX_HAVE_SYS_IPC_H 1"
+.LASF2426:
+	.string	"_Char_alloc_type"
+.LASF2489:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4cendEv"
+.LASF2046:
+	.string	"EPFNOSUPPORT 96"
+.LASF2940:
+	.string	"__off64_t"
+.LASF1732:
+	.string	"wcstod"
+.LASF2121:
+	.string	"false_type"
+.LASF2807:
+	.string	"_ZSt11__addressofIcEPT_RS0_"
+.LASF412:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF3007:
+	.string	"tm_wday"
+.LASF1735:
+	.string	"wcstol"
+.LASF1890:
+	.string	"FOPEN_MAX"
+.LASF883:
+	.string	"_GLIBCXX_HAVE_STRERROR_L 1"
+.LASF828:
+	.string	"_GLIBCXX_HAVE_ISNANL 1"
+.LASF3103:
+	.string	"try_pop"
+.LASF1482:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1565:
+	.string	"ATOMIC_VAR_INIT(_VI) { _VI }"
+.LASF2493:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6lengthEv"
+.LASF768:
+	.string	"_PSTL_PRAGMA_MESSAGE(x) "
+.LASF2207:
+	.string	"_ZNVSt13__atomic_baseImE9fetch_addEmSt12memory_order"
+.LASF78:
+	.string	"__GXX_WEAK__ 1"
+.LASF1983:
+	.string	"EDOM 33"
+.LASF2446:
+	.string	"_S_copy_chars"
+.LASF1764:
+	.string	"_BITS_LOCALE_H 1"
+.LASF81:
+	.string	"__cpp_rtti 199711L"
+.LASF2680:
+	.string	"_ZNSt6vectorIcSaIcEE14_S_do_relocateEPcS2_S2_RS0_St17integral_constantIbLb0EE"
+.LASF2727:
+	.string	"_ZNKSt6vectorIcSaIcEE2atEm"
+.LASF1778:
+	.string	"LC_CTYPE __LC_CTYPE"
+.LASF2900:
+	.string	"signed char"
+.LASF232:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1245:
+	.string	"__SLONG32_TYPE int"
+.LASF977:
+	.string	"_GLIBCXX_USE_LONG_LONG 1"
+.LASF2049:
+	.string	"EADDRNOTAVAIL 99"
+.LASF2972:
+	.string	"_ZN6__pstl9execution2v118unsequenced_policy19__allow_unsequencedEv"
+.LASF1947:
+	.string	"_ERRNO_H 1"
+.LASF2515:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4backEv"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF2506:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5clearEv"
+.LASF270:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF128:
+	.string	"__cpp_aligned_new 201606L"
+.LASF875:
+	.string	"_GLIBCXX_HAVE_SINL 1"
+.LASF950:
+	.string	"_GLIBCXX_HAS_GTHREADS 1"
+.LASF1923:
+	.string	"perror"
+.LASF2390:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_Alloc_hiderC4EPcOS3_"
+.LASF652:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF2494:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8max_sizeEv"
+.LASF1994:
+	.string	"ECHRNG 44"
+.LASF1753:
+	.string	"_GLIBCXX_OPERATOR_NEW ::operator new"
+.LASF318:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1069:
+	.string	"_GLIBCXX_DEBUG_MACRO_SWITCH_H 1"
+.LASF1105:
+	.string	"_GLIBCXX_BITS_UNIFORM_INT_DIST_H "
+.LASF1076:
+	.string	"__glibcxx_requires_sorted_pred(_First,_Last,_Pred) "
+.LASF2540:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEmRKS4_mm"
+.LASF1389:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF658:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1270:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2618:
+	.string	"_ZNSt16initializer_listIcEC4Ev"
+.LASF1604:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF897:
+	.string	"_GLIBCXX_HAVE_SYS_SDT_H 1"
+.LASF247:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF618:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF432:
+	.string	"__unix 1"
+.LASF1952:
+	.string	"ENOENT 2"
+.LASF865:
+	.string	"_GLIBCXX_HAVE_QUICK_EXIT 1"
+.LASF126:
+	.string	"__cpp_nontype_template_parameter_auto 201606L"
+.LASF539:
+	.string	"__USE_MISC"
+.LASF1509:
+	.string	"INT16_C(c) c"
+.LASF1678:
+	.string	"__need___va_list"
+.LASF2964:
+	.string	"_ZN6__pstl9execution2v115parallel_policy19__allow_unsequencedEv"
+.LASF1034:
+	.string	"__cpp_lib_type_trait_variable_templates 201510L"
+.LASF3060:
+	.string	"__isoc99_vwscanf"
+.LASF770:
+	.string	"_PSTL_CPP11_STD_ROTATE_BROKEN ((__GLIBCXX__ && __GLIBCXX__ < 20150716) || (_MSC_VER && _MSC_VER < 1800))"
+.LASF1690:
+	.string	"btowc"
+.LASF1230:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF2084:
+	.string	"ENOTSUP EOPNOTSUPP"
+.LASF888:
+	.string	"_GLIBCXX_HAVE_STRTOLD 1"
+.LASF1381:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF1818:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF543:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1970:
+	.string	"ENOTDIR 20"
+.LASF2383:
+	.string	"select_on_container_copy_construction"
+.LASF1536:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF2154:
+	.string	"_ZNVKSt13__atomic_baseImEcvmEv"
+.LASF1912:
+	.string	"fputc"
+.LASF292:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF994:
+	.string	"_GLIBCXX_USE_UTIME 1"
+.LASF2454:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_assignERKS4_"
+.LASF1740:
+	.string	"wmemcmp"
+.LASF2843:
+	.string	"_S_propagate_on_copy_assign"
+.LASF2326:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4dataEv"
+.LASF1111:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF2928:
+	.string	"__uint64_t"
+.LASF2155:
+	.string	"_ZNSt13__atomic_baseImEaSEm"
+.LASF2277:
+	.string	"max_size"
+.LASF491:
+	.string	"_GLIBCXX_DEFAULT_ABI_TAG _GLIBCXX_ABI_TAG_CXX11"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2197:
+	.string	"_ZNVSt13__atomic_baseImE21compare_exchange_weakERmmSt12memory_orderS2_"
+.LASF1844:
+	.string	"_GLIBCXX_MEM_FN_TRAITS2"
+.LASF2232:
+	.string	"char_traits<char>"
+.LASF2724:
+	.string	"_M_range_check"
+.LASF200:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF2031:
+	.string	"ELIBSCN 81"
+.LASF687:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF386:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2106:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_REINIT"
+.LASF1091:
+	.string	"_GLIBCXX_PREDEFINED_OPS_H 1"
+.LASF2332:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEE4swapERS2_"
+.LASF2184:
+	.string	"_ZNVKSt13__atomic_baseImE12is_lock_freeEv"
+.LASF686:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF379:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF113:
+	.string	"__cpp_nontype_template_args 201411L"
+.LASF793:
+	.string	"_GLIBCXX_HAVE_DECL_STRNLEN 1"
+.LASF2104:
+	.string	"_STL_BVECTOR_H 1"
+.LASF1587:
+	.string	"strcspn"
+.LASF1786:
+	.string	"LC_NAME __LC_NAME"
+.LASF677:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF3176:
+	.string	"_ZNSt13__atomic_baseImE12_S_alignmentE"
+.LASF2032:
+	.string	"ELIBMAX 82"
+.LASF2824:
+	.string	"_ZSt8_DestroyIPccEvT_S1_RSaIT0_E"
+.LASF119:
+	.string	"__cpp_aggregate_bases 201603L"
+.LASF2097:
+	.string	"__cpp_lib_raw_memory_algorithms 201606L"
+.LASF487:
+	.string	"_GLIBCXX_USE_CXX11_ABI 1"
+.LASF2578:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4dataEv"
+.LASF2855:
+	.string	"other"
+.LASF528:
+	.string	"__USE_POSIX199506"
+.LASF2398:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ENS4_12__sv_wrapperERKS3_"
+.LASF399:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF987:
+	.string	"_GLIBCXX_USE_SCHED_YIELD 1"
+.LASF1635:
+	.string	"MOD_CLKA ADJ_OFFSET_SINGLESHOT"
+.LASF2780:
+	.string	"iterator_category"
+.LASF208:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF221:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF291:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF494:
+	.string	"_GLIBCXX_END_NAMESPACE_VERSION "
+.LASF501:
+	.string	"_GLIBCXX_LONG_DOUBLE_COMPAT"
+.LASF428:
+	.string	"__SEG_GS 1"
+.LASF1000:
+	.string	"_GTHREAD_USE_MUTEX_TIMEDLOCK 1"
+.LASF32:
+	.string	"__CHAR_BIT__ 8"
+.LASF2430:
+	.string	"_M_use_local_data"
+.LASF622:
+	.string	"__NTHNL(fct) fct __THROW"
+.LASF1693:
+	.string	"fputwc"
+.LASF1782:
+	.string	"LC_MONETARY __LC_MONETARY"
+.LASF2572:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm"
+.LASF3156:
+	.string	"head"
+.LASF690:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF274:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF880:
+	.string	"_GLIBCXX_HAVE_STDBOOL_H 1"
+.LASF2636:
+	.string	"_ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_dataC4Ev"
+.LASF2701:
+	.string	"_ZNSt6vectorIcSaIcEE6assignESt16initializer_listIcE"
+.LASF504:
+	.string	"_GLIBCXX_BEGIN_NAMESPACE_LDBL "
+.LASF1209:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF936:
+	.string	"_GLIBCXX_STDC_HEADERS 1"
+.LASF1796:
+	.string	"LC_MESSAGES_MASK (1 << __LC_MESSAGES)"
+.LASF684:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF635:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF2194:
+	.string	"_ZNVSt13__atomic_baseImE8exchangeEmSt12memory_order"
+.LASF1689:
+	.string	"_GLIBCXX_CWCHAR 1"
+.LASF1612:
+	.string	"CLOCK_TAI 11"
+.LASF2344:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4findEPKcmm"
+.LASF1937:
+	.string	"tmpnam"
+.LASF2849:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE20_S_propagate_on_swapEv"
+.LASF683:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2303:
+	.string	"rbegin"
+.LASF2944:
+	.string	"clock_t"
+.LASF669:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF2691:
+	.string	"_ZNSt6vectorIcSaIcEEC4EOS1_RKS0_St17integral_constantIbLb1EE"
+.LASF2290:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEEC4ERKS2_"
+.LASF2846:
+	.string	"_S_propagate_on_move_assign"
+.LASF1741:
+	.string	"wmemcpy"
+.LASF2346:
+	.string	"rfind"
+.LASF903:
+	.string	"_GLIBCXX_HAVE_SYS_TIME_H 1"
+.LASF388:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF3162:
+	.string	"_ZN9simulator8log_ringC2Em"
+.LASF245:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF3121:
+	.string	"~_Vector_impl"
+.LASF778:
+	.string	"_GLIBCXX_HAVE_ASINL 1"
+.LASF691:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF922:
+	.string	"_GLIBCXX_HAVE_VWSCANF 1"
+.LASF678:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF2466:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4EOS4_"
+.LASF1298:
+	.string	"__dev_t_defined "
+.LASF105:
+	.string	"__cpp_variable_templates 201304L"
+.LASF2244:
+	.string	"copy"
+.LASF2056:
+	.string	"EISCONN 106"
+.LASF2035:
+	.string	"ERESTART 85"
+.LASF1428:
+	.string	"system"
+.LASF1550:
+	.string	"WINT_WIDTH 32"
+.LASF425:
+	.string	"__SSE2_MATH__ 1"
+.LASF952:
+	.string	"_GLIBCXX_MANGLE_SIZE_T m"
+.LASF1045:
+	.string	"_GLIBCXX_DEPRECATED_PAIR_CTOR __attribute__ ((__deprecated__ (\"use 'nullptr' instead of '0' to \" \"initialize std::pair of move-only \" \"type and pointer\")))"
+.LASF581:
+	.string	"__USE_POSIX 1"
+.LASF2838:
+	.string	"__alloc_traits<std::allocator<char>, char>"
+.LASF2789:
+	.string	"__fill_a<char*, char>"
+.LASF2759:
+	.string	"_M_emplace_aux"
+.LASF434:
+	.string	"__ELF__ 1"
+.LASF312:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF348:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2247:
+	.string	"_ZNSt11char_traitsIcE6assignEPcmc"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF2827:
+	.string	"operator&"
+.LASF824:
+	.string	"_GLIBCXX_HAVE_INTTYPES_H 1"
+.LASF2860:
+	.string	"operator*"
+.LASF2362:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE17find_first_not_ofES2_m"
+.LASF2437:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8_M_limitEmm"
+.LASF2873:
+	.string	"operator-"
+.LASF2676:
+	.string	"_ZNSt6vectorIcSaIcEE19_S_nothrow_relocateESt17integral_constantIbLb0EE"
+.LASF647:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF2962:
+	.string	"_ZN6__pstl9execution2v116sequenced_policy16__allow_parallelEv"
+.LASF2914:
+	.string	"div_t"
+.LASF2149:
+	.string	"operator="
+.LASF3152:
+	.string	"firstPart"
+.LASF2571:
+	.string	"_M_append"
+.LASF97:
+	.string	"__cpp_inheriting_constructors 201511L"
+.LASF2778:
+	.string	"reverse_iterator<__gnu_cxx::__normal_iterator<char const*, std::vector<char, std::allocator<char> > > >"
+.LASF680:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1919:
+	.string	"ftell"
+.LASF1221:
+	.string	"__CFLOAT32 _Complex float"
+.LASF2003:
+	.string	"EBADR 53"
+.LASF2118:
+	.string	"operator std::integral_constant<bool, true>::value_type"
+.LASF1306:
+	.string	"__id_t_defined "
+.LASF1108:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1151:
+	.string	"__WCHAR_T "
+.LASF2280:
+	.string	"_ZNKSt15__new_allocatorIcE11_M_max_sizeEv"
+.LASF415:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF2042:
+	.string	"ENOPROTOOPT 92"
+.LASF1422:
+	.string	"rand"
+.LASF2602:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16find_last_not_ofEPKcmm"
+.LASF2033:
+	.string	"ELIBEXEC 83"
+.LASF2427:
+	.string	"_M_get_allocator"
+.LASF668:
+	.string	"__restrict_arr "
+.LASF2260:
+	.string	"_ZNSt15__new_allocatorIcEC4Ev"
+.LASF650:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF453:
+	.string	"_GLIBCXX_CONST __attribute__ ((__const__))"
+.LASF134:
+	.string	"__cpp_exceptions 199711L"
+.LASF521:
+	.string	"__USE_ISOC11"
+.LASF2099:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_REINIT "
+.LASF1194:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF787:
+	.string	"_GLIBCXX_HAVE_CEILL 1"
+.LASF2190:
+	.string	"_ZNKSt13__atomic_baseImE4loadESt12memory_order"
+.LASF2856:
+	.string	"__normal_iterator<char*, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >"
+.LASF1129:
+	.string	"_SIZE_T "
+.LASF1065:
+	.string	"__cpp_lib_array_constexpr 201803L"
+.LASF995:
+	.string	"_GLIBCXX_USE_UTIMENSAT 1"
+.LASF23:
+	.string	"__LP64__ 1"
+.LASF1775:
+	.string	"__LC_TELEPHONE 10"
+.LASF1473:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF3080:
+	.string	"n_sign_posn"
+.LASF1104:
+	.string	"__cpp_lib_hardware_interference_size 201703L"
+.LASF1884:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF841:
+	.string	"_GLIBCXX_HAVE_LINUX_FUTEX 1"
+.LASF2143:
+	.string	"__memory_order_hle_release"
+.LASF1367:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF2973:
+	.string	"_ZN6__pstl9execution2v118unsequenced_policy14__allow_vectorEv"
+.LASF1022:
+	.string	"_GLIBCXX_TYPE_TRAITS 1"
+.LASF1177:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF271:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1882:
+	.string	"SEEK_HOLE 4"
+.LASF2763:
+	.string	"_S_check_init_len"
+.LASF1517:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF2006:
+	.string	"EBADRQC 56"
+.LASF738:
+	.string	"_PSTL_STRING_AUX(x) #x"
+.LASF928:
+	.string	"_GLIBCXX_ICONV_CONST "
+.LASF2529:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignERKS4_"
+.LASF2274:
+	.string	"size_type"
+.LASF1312:
+	.string	"__time_t_defined 1"
+.LASF1980:
+	.string	"EROFS 30"
+.LASF2911:
+	.string	"__unknown__"
+.LASF2804:
+	.string	"_ZSt12__niter_baseIPcET_S1_"
+.LASF1950:
+	.string	"_ASM_GENERIC_ERRNO_BASE_H "
+.LASF2859:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEC4ERKS1_"
+.LASF1769:
+	.string	"__LC_MONETARY 4"
+.LASF2038:
+	.string	"ENOTSOCK 88"
+.LASF530:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1651:
+	.string	"STA_CLOCKERR 0x1000"
+.LASF846:
+	.string	"_GLIBCXX_HAVE_LOG10L 1"
+.LASF1090:
+	.string	"__glibcxx_requires_irreflexive_pred2(_First,_Last,_Pred) "
+.LASF1514:
+	.string	"UINT32_C(c) c ## U"
+.LASF882:
+	.string	"_GLIBCXX_HAVE_STDLIB_H 1"
+.LASF2022:
+	.string	"EMULTIHOP 72"
+.LASF2476:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEaSESt16initializer_listIcE"
+.LASF3055:
+	.string	"FILE"
+.LASF2293:
+	.string	"_ZNSaIcEaSERKS_"
+.LASF199:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2756:
+	.string	"_ZNSt6vectorIcSaIcEE16_M_shrink_to_fitEv"
+.LASF1843:
+	.string	"_GLIBCXX_MEM_FN_TRAITS"
+.LASF1357:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF2541:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEmPKcm"
+.LASF2932:
+	.string	"__uint_least16_t"
+.LASF2411:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_M_local_dataEv"
+.LASF2394:
+	.string	"__sv_type"
+.LASF1030:
+	.string	"__cpp_lib_void_t 201411L"
+.LASF1619:
+	.string	"ADJ_STATUS 0x0010"
+.LASF1157:
+	.string	"___int_wchar_t_h "
+.LASF2376:
+	.string	"_ZNSt16allocator_traitsISaIcEE8allocateERS0_m"
+.LASF1261:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF727:
+	.string	"_GLIBCXX_USE_TBB_PAR_BACKEND __has_include(<tbb/tbb.h>)"
+.LASF496:
+	.string	"_GLIBCXX_BEGIN_NAMESPACE_CONTAINER "
+.LASF1337:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF2137:
+	.string	"memory_order_seq_cst"
+.LASF3096:
+	.string	"record_header"
+.LASF1125:
+	.string	"__need_wchar_t "
+.LASF2400:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12__sv_wrapperC4ESt17basic_string_viewIcS2_E"
+.LASF2639:
+	.string	"_ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_data12_M_copy_dataERKS2_"
+.LASF2920:
+	.string	"char"
+.LASF3095:
+	.string	"simulator"
+.LASF130:
+	.string	"__cpp_template_template_args 201611L"
+.LASF2178:
+	.string	"_ZNVSt13__atomic_baseImEoREm"
+.LASF1556:
+	.string	"ATOMIC_CHAR16_T_LOCK_FREE __GCC_ATOMIC_CHAR16_T_LOCK_FREE"
+.LASF1317:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1362:
+	.string	"__FDS_BITS(set) ((set)->fds_bits)"
+.LASF337:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1148:
+	.string	"_WCHAR_T "
+.LASF1107:
+	.string	"_GLIBCXX_INCLUDE_NEXT_C_HEADERS "
+.LASF2134:
+	.string	"memory_order_acquire"
+.LASF723:
+	.string	"_GLIBCXX_HAVE_BUILTIN_IS_AGGREGATE 1"
+.LASF2673:
+	.string	"vector<char, std::allocator<char> >"
+.LASF1096:
+	.string	"_GLIBCXX_ALGORITHMFWD_H 1"
+.LASF736:
+	.string	"_PSTL_USAGE_WARNINGS 0"
+.LASF1802:
+	.string	"LC_IDENTIFICATION_MASK (1 << __LC_IDENTIFICATION)"
+.LASF100:
+	.string	"__cpp_return_type_deduction 201304L"
+.LASF830:
+	.string	"_GLIBCXX_HAVE_LC_MESSAGES 1"
+.LASF2283:
+	.string	"allocator"
+.LASF1649:
+	.string	"STA_PPSWANDER 0x0400"
+.LASF767:
+	.string	"_PSTL_PRAGMA_MESSAGE_IMPL(x) _PSTL_PRAGMA(message(_PSTL_STRING_CONCAT(_PSTL_PRAGMA_LOCATION, x)))"
+.LASF1271:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1643:
+	.string	"STA_INS 0x0010"
+.LASF1626:
+	.string	"ADJ_OFFSET_SINGLESHOT 0x8001"
+.LASF1879:
+	.string	"SEEK_CUR 1"
+.LASF732:
+	.string	"_PSTL_VERSION 12000"
+.LASF1599:
+	.string	"_TIME_H 1"
+.LASF1466:
+	.string	"UINT16_MAX (65535)"
+.LASF962:
+	.string	"_GLIBCXX_USE_C99_CTYPE_TR1 1"
+.LASF1170:
+	.string	"WSTOPPED 2"
+.LASF673:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2299:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE6cbeginEv"
+.LASF1594:
+	.string	"strrchr"
+.LASF533:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2324:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4backEv"
+.LASF2481:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE3endEv"
+.LASF2883:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEptEv"
+.LASF1789:
+	.string	"LC_MEASUREMENT __LC_MEASUREMENT"
+.LASF3010:
+	.string	"tm_gmtoff"
+.LASF614:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1224:
+	.string	"__CFLOAT64X _Complex long double"
+.LASF2054:
+	.string	"ECONNRESET 104"
+.LASF255:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF437:
+	.string	"_REENTRANT 1"
+.LASF2187:
+	.string	"_ZNSt13__atomic_baseImE5storeEmSt12memory_order"
+.LASF1595:
+	.string	"strspn"
+.LASF2522:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendERKS4_mm"
+.LASF396:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1714:
+	.string	"vwscanf"
+.LASF3070:
+	.string	"mon_grouping"
+.LASF1142:
+	.string	"_GCC_SIZE_T "
+.LASF2254:
+	.string	"_ZNSt11char_traitsIcE11eq_int_typeERKiS2_"
+.LASF2249:
+	.string	"_ZNSt11char_traitsIcE12to_char_typeERKi"
+.LASF831:
+	.string	"_GLIBCXX_HAVE_LDEXPF 1"
+.LASF2579:
+	.string	"get_allocator"
+.LASF2794:
+	.string	"_OutputIterator"
+.LASF755:
+	.string	"_PSTL_CPP14_VARIABLE_TEMPLATES_PRESENT (!__INTEL_COMPILER || __INTEL_COMPILER >= 1700) && (_MSC_FULL_VER >= 190023918 || __cplusplus >= 201402L)"
+.LASF1508:
+	.string	"INT8_C(c) c"
+.LASF1163:
+	.string	"__need_wchar_t"
+.LASF2136:
+	.string	"memory_order_acq_rel"
+.LASF171:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF2991:
+	.string	"int_fast32_t"
+.LASF207:
+	.string	"__GCC_IEC_559 2"
+.LASF2608:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareEmmRKS4_mm"
+.LASF278:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF2709:
+	.string	"_ZNKSt6vectorIcSaIcEE4rendEv"
+.LASF1237:
+	.string	"__S32_TYPE int"
+.LASF1200:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1044:
+	.string	"__cpp_lib_integer_sequence 201304L"
+.LASF2218:
+	.string	"_ZNSt13__atomic_baseImE9fetch_xorEmSt12memory_order"
+.LASF1029:
+	.string	"__cpp_lib_result_of_sfinae 201210L"
+.LASF2728:
+	.string	"_ZNSt6vectorIcSaIcEE5frontEv"
+.LASF1130:
+	.string	"_SYS_SIZE_T_H "
+.LASF148:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2405:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7_M_dataEPc"
+.LASF744:
+	.string	"_PSTL_PRAGMA_SIMD _PSTL_PRAGMA(omp simd)"
+.LASF1285:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1968:
+	.string	"EXDEV 18"
+.LASF3132:
+	.string	"__val"
+.LASF442:
+	.string	"__STDC_IEC_559__ 1"
+.LASF135:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF2610:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareEmmPKc"
+.LASF1319:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF2986:
+	.string	"uint_least16_t"
+.LASF775:
+	.string	"_GLIBCXX_HAVE_ARC4RANDOM 1"
+.LASF1134:
+	.string	"_SIZE_T_ "
+.LASF1800:
+	.string	"LC_TELEPHONE_MASK (1 << __LC_TELEPHONE)"
+.LASF3125:
+	.string	"__tmp"
+.LASF484:
+	.string	"_GLIBCXX_NOEXCEPT_QUAL noexcept (_NE)"
+.LASF389:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF183:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1528:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF3140:
+	.string	"__new_size"
+.LASF2321:
+	.string	"front"
+.LASF356:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF971:
+	.string	"_GLIBCXX_USE_DEV_RANDOM 1"
+.LASF131:
+	.string	"__cpp_threadsafe_static_init 200806L"
+.LASF2536:
+	.string	"insert"
+.LASF783:
+	.string	"_GLIBCXX_HAVE_ATANL 1"
+.LASF2954:
+	.string	"__destroy<char*>"
+.LASF1759:
+	.string	"__cpp_lib_incomplete_container_elements 201505L"
+.LASF914:
+	.string	"_GLIBCXX_HAVE_TRUNCATE 1"
+.LASF2798:
+	.string	"_ZNSt12_Vector_baseIcSaIcEE17_Vector_impl_data12_M_swap_dataERS2_"
+.LASF1465:
+	.string	"UINT8_MAX (255)"
+.LASF613:
+	.string	"__PMT"
+.LASF3160:
+	.string	"recordSize"
+.LASF1853:
+	.string	"_HASH_BYTES_H 1"
+.LASF2325:
+	.string	"data"
+.LASF1021:
+	.string	"_STL_PAIR_H 1"
+.LASF378:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF625:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF753:
+	.string	"_PSTL_CPP14_MAKE_REVERSE_ITERATOR_PRESENT (_MSC_VER >= 1900 || __cplusplus >= 201402L || __cpp_lib_make_reverse_iterator == 201402)"
+.LASF1143:
+	.string	"_SIZET_ "
+.LASF102:
+	.string	"__cpp_generic_lambdas 201304L"
+.LASF1701:
+	.string	"mbrtowc"
+.LASF2361:
+	.string	"find_first_not_of"
+.LASF3068:
+	.string	"mon_decimal_point"
+.LASF475:
+	.string	"_GLIBCXX23_CONSTEXPR "
+.LASF800:
+	.string	"_GLIBCXX_HAVE_EXPF 1"
+.LASF1131:
+	.string	"_T_SIZE_ "
+.LASF2516:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEpLERKS4_"
+.LASF2234:
+	.string	"_ZNSt11char_traitsIcE2eqERKcS2_"
+.LASF2335:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE6substrEmm"
+.LASF467:
+	.string	"_GLIBCXX20_DEPRECATED_SUGGEST(ALT) "
+.LASF1798:
+	.string	"LC_NAME_MASK (1 << __LC_NAME)"
+.LASF3039:
+	.string	"_chain"
+.LASF3185:
+	.string	"typedef __va_list_tag __va_list_tag"
+.LASF2557:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEmmmc"
+.LASF2953:
+	.string	"__compar_fn_t"
+.LASF440:
+	.string	"SIMULATOR_MIN_LOG_LEVEL DEBUG"
+.LASF3161:
+	.string	"roundedCapacity"
+.LASF3188:
+	.string	"__cxa_end_catch"
+.LASF2825:
+	.string	"min<long unsigned int>"
+.LASF951:
+	.string	"_GLIBCXX_HOSTED 1"
+.LASF3094:
+	.string	"fpos_t"
+.LASF2879:
+	.string	"_M_current"
+.LASF2078:
+	.string	"EKEYREVOKED 128"
+.LASF910:
+	.string	"_GLIBCXX_HAVE_TANL 1"
+.LASF342:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2929:
+	.string	"__int_least8_t"
+.LASF688:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1598:
+	.string	"strxfrm"
+.LASF1596:
+	.string	"strstr"
+.LASF2542:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEmPKc"
+.LASF821:
+	.string	"_GLIBCXX_HAVE_HYPOTF 1"
+.LASF476:
+	.string	"_GLIBCXX17_INLINE inline"
+.LASF1454:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2667:
+	.string	"_ZNSt12_Vector_baseIcSaIcEE13_M_deallocateEPcm"
+.LASF817:
+	.string	"_GLIBCXX_HAVE_GETENTROPY 1"
+.LASF3014:
+	.string	"overflow_arg_area"
+.LASF3015:
+	.string	"reg_save_area"
+.LASF2943:
+	.string	"__syscall_slong_t"
+.LASF314:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF2935:
+	.string	"__int_least64_t"
+.LASF1797:
+	.string	"LC_PAPER_MASK (1 << __LC_PAPER)"
+.LASF1364:
+	.string	"NFDBITS __NFDBITS"
+.LASF2050:
+	.string	"ENETDOWN 100"
+.LASF586:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1990:
+	.string	"ELOOP 40"
+.LASF1956:
+	.string	"ENXIO 6"
+.LASF1574:
+	.string	"_STRINGS_H 1"
+.LASF879:
+	.string	"_GLIBCXX_HAVE_STDALIGN_H 1"
+.LASF2469:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4EOS4_RKS3_"
+.LASF2368:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE16find_last_not_ofEcm"
+.LASF984:
+	.string	"_GLIBCXX_USE_PTHREAD_RWLOCK_T 1"
+.LASF1435:
+	.string	"strtoll"
+.LASF233:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF240:
+	.string	"__DBL_DENORM_MIN__ double(4.94065645841246544176568792868221372e-324L)"
+.LASF656:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1861:
+	.string	"_____fpos_t_defined 1"
+.LASF2467:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ESt16initializer_listIcERKS3_"
+.LASF2201:
+	.string	"_ZNSt13__atomic_baseImE23compare_exchange_strongERmmSt12memory_orderS2_"
+.LASF1696:
+	.string	"fwprintf"
+.LASF900:
+	.string	"_GLIBCXX_HAVE_SYS_STATVFS_H 1"
+.LASF571:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF400:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1254:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1568:
+	.string	"_GLIBCXX20_INIT"
+.LASF604:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF629:
+	.string	"__END_DECLS }"
+.LASF716:
+	.string	"_GLIBCXX_USE_C99_STDLIB _GLIBCXX11_USE_C99_STDLIB"
+.LASF624:
+	.string	"__PMT(args) args"
+.LASF729:
+	.string	"_PSTL_ASSERT(_Condition) __glibcxx_assert(_Condition)"
+.LASF610:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1036:
+	.string	"__cpp_lib_is_aggregate 201703L"
+.LASF1493:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF155:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2414:
+	.string	"_M_set_length"
+.LASF2984:
+	.string	"int_least64_t"
+.LASF3073:
+	.string	"int_frac_digits"
+.LASF433:
+	.string	"__unix__ 1"
+.LASF870:
+	.string	"_GLIBCXX_HAVE_SINCOSF 1"
+.LASF2068:
+	.string	"ENOTNAM 118"
+.LASF1803:
+	.string	"LC_ALL_MASK (LC_CTYPE_MASK | LC_NUMERIC_MASK | LC_TIME_MASK | LC_COLLATE_MASK | LC_MONETARY_MASK | LC_MESSAGES_MASK | LC_PAPER_MASK | LC_NAME_MASK | LC_ADDRESS_MASK | LC_TELEPHONE_MASK | LC_MEASUREMENT_MASK | LC_IDENTIFICATION_MASK )"
+.LASF139:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF989:
+	.string	"_GLIBCXX_USE_SENDFILE 1"
+.LASF2808:
+	.string	"__relocate_a<char*, char*, std::allocator<char> >"
+.LASF2593:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12find_last_ofERKS4_m"
+.LASF981:
+	.string	"_GLIBCXX_USE_PTHREAD_COND_CLOCKWAIT 1"
+.LASF886:
+	.string	"_GLIBCXX_HAVE_STRING_H 1"
+.LASF341:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF2614:
+	.string	"initializer_list<char>"
+.LASF2319:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE3endEv"
+.LASF1933:
+	.string	"setvbuf"
+.LASF1211:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF99:
+	.string	"__cpp_alias_templates 200704L"
+.LASF216:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF211:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF3050:
+	.string	"_freeres_list"
+.LASF1278:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF2975:
+	.string	"par_unseq"
+.LASF298:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2927:
+	.string	"__int64_t"
+.LASF3052:
+	.string	"__pad5"
+.LASF1961:
+	.string	"EAGAIN 11"
+.LASF1549:
+	.string	"WCHAR_WIDTH 32"
+.LASF1043:
+	.string	"__cpp_lib_tuple_element_t 201402L"
+.LASF251:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1401:
+	.string	"_GLIBCXX_BITS_STD_ABS_H "
+.LASF2821:
+	.string	"_ZSt19__iterator_categoryIPcENSt15iterator_traitsIT_E17iterator_categoryERKS2_"
+.LASF1480:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2171:
+	.string	"_ZNSt13__atomic_baseImEmIEm"
+.LASF3081:
+	.string	"int_p_cs_precedes"
+.LASF1161:
+	.string	"__DEFINED_wchar_t "
+.LASF712:
+	.string	"__N(msgid) (msgid)"
+.LASF124:
+	.string	"__cpp_variadic_using 201611L"
+.LASF3137:
+	.string	"__navail"
+.LASF654:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1744:
+	.string	"wprintf"
+.LASF1762:
+	.string	"_GLIBCXX_CXX_LOCALE_H 1"
+.LASF2028:
+	.string	"EREMCHG 78"
+.LASF2475:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEaSEOS4_"
+.LASF3025:
+	.string	"_IO_FILE"
+.LASF2276:
+	.string	"_ZNSt15__new_allocatorIcE10deallocateEPcm"
+.LASF653:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1590:
+	.string	"strncat"
+.LASF3101:
+	.string	"try_push"
+.LASF1265:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF325:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1005:
+	.string	"__throw_exception_again throw"
+.LASF2853:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE15_S_nothrow_moveEv"
+.LASF1087:
+	.string	"__glibcxx_requires_irreflexive(_First,_Last) "
+.LASF2012:
+	.string	"ETIME 62"
+.LASF2053:
+	.string	"ECONNABORTED 103"
+.LASF1303:
+	.string	"__off_t_defined "
+.LASF2258:
+	.string	"ptrdiff_t"
+.LASF1387:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF465:
+	.string	"_GLIBCXX17_DEPRECATED_SUGGEST(ALT) _GLIBCXX_DEPRECATED_SUGGEST(ALT)"
+.LASF1768:
+	.string	"__LC_COLLATE 3"
+.LASF781:
+	.string	"_GLIBCXX_HAVE_ATAN2L 1"
+.LASF165:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF2805:
+	.string	"_Iterator"
+.LASF1386:
+	.string	"__ONCE_ALIGNMENT "
+.LASF213:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF2622:
+	.string	"reverse_iterator<char const*>"
+.LASF2287:
+	.string	"basic_string_view<char, std::char_traits<char> >"
+.LASF1755:
+	.string	"_GLIBCXX_SIZED_DEALLOC(p,n) (p), (n) * sizeof(_Tp)"
+.LASF3012:
+	.string	"gp_offset"
+.LASF1600:
+	.string	"_BITS_TIME_H 1"
+.LASF1835:
+	.string	"_CXXABI_FORCED_H 1"
+.LASF225:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2645:
+	.string	"_ZNSt12_Vector_baseIcSaIcEE12_Vector_implC4EOS0_"
+.LASF2547:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5eraseEmm"
+.LASF2309:
+	.string	"crend"
+.LASF3:
+	.string	"__cplusplus 201703L"
+.LASF1150:
+	.string	"_T_WCHAR "
+.LASF2930:
+	.string	"__uint_least8_t"
+.LASF1144:
+	.string	"__size_t "
+.LASF1280:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF2530:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignEOS4_"
+.LASF463:
+	.string	"_GLIBCXX14_DEPRECATED_SUGGEST(ALT) _GLIBCXX_DEPRECATED_SUGGEST(ALT)"
+.LASF2740:
+	.string	"_ZNSt6vectorIcSaIcEE6insertEN9__gnu_cxx17__normal_iteratorIPKcS1_EEmRS4_"
+.LASF3190:
+	.string	"__can_fill"
+.LASF1589:
+	.string	"strlen"
+.LASF2110:
+	.string	"__LOG_RING_H__ "
+.LASF2292:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEEC4EPKcm"
+.LASF616:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF2341:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareEmmPKcm"
+.LASF205:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1901:
+	.string	"_GLIBCXX_CSTDIO 1"
+.LASF1331:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF1905:
+	.string	"ferror"
+.LASF1793:
+	.string	"LC_TIME_MASK (1 << __LC_TIME)"
+.LASF2735:
+	.string	"_ZNSt6vectorIcSaIcEE9push_backEOc"
+.LASF1571:
+	.string	"__CORRECT_ISO_CPP_STRING_H_PROTO "
+.LASF2755:
+	.string	"_M_shrink_to_fit"
+.LASF2959:
+	.string	"_ZN6__pstl9execution2v116sequenced_policy19__allow_unsequencedEv"
+.LASF187:
+	.string	"__UINT16_C(c) c"
+.LASF1350:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF450:
+	.string	"_GLIBCXX_RELEASE 12"
+.LASF110:
+	.string	"__cpp_enumerator_attributes 201411L"
+.LASF1178:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1897:
+	.string	"RENAME_EXCHANGE (1 << 1)"
+.LASF2757:
+	.string	"_M_insert_rval"
+.LASF645:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1438:
+	.string	"strtold"
+.LASF1776:
+	.string	"__LC_MEASUREMENT 11"
+.LASF2252:
+	.string	"_ZNSt11char_traitsIcE11to_int_typeERKc"
+.LASF391:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF85:
+	.string	"__cpp_raw_strings 200710L"
+.LASF1709:
+	.string	"vfwprintf"
+.LASF338:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2948:
+	.string	"int32_t"
+.LASF3001:
+	.string	"tm_sec"
+.LASF776:
+	.string	"_GLIBCXX_HAVE_ARPA_INET_H 1"
+.LASF2870:
+	.string	"operator+"
+.LASF2799:
+	.string	"_ZSt10_ConstructIcJEEvPT_DpOT0_"
+.LASF441:
+	.string	"_STDC_PREDEF_H 1"
+.LASF927:
+	.string	"_GLIBCXX_HAVE___CXA_THREAD_ATEXIT_IMPL 1"
+.LASF2772:
+	.string	"_ZNSt6vectorIcSaIcEE14_M_move_assignEOS1_St17integral_constantIbLb1EE"
+.LASF2238:
+	.string	"length"
+.LASF2147:
+	.string	"_ZNSt13__atomic_baseImED4Ev"
+.LASF1948:
+	.string	"_BITS_ERRNO_H 1"
+.LASF1728:
+	.string	"wcsrchr"
+.LASF2985:
+	.string	"uint_least8_t"
+.LASF769:
+	.string	"_PSTL_PRAGMA_MESSAGE_POLICIES(x) "
+.LASF282:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF2946:
+	.string	"int8_t"
+.LASF1456:
+	.string	"__intptr_t_defined "
+.LASF2644:
+	.string	"_ZNSt12_Vector_baseIcSaIcEE12_Vector_implC4EOS2_"
+.LASF590:
+	.string	"_LARGEFILE_SOURCE"
+.LASF1518:
+	.string	"INT8_WIDTH 8"
+.LASF1694:
+	.string	"fputws"
+.LASF1115:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1810:
+	.string	"_GLIBCXX_IOSFWD 1"
+.LASF525:
+	.string	"__USE_POSIX"
+.LASF1725:
+	.string	"wcsncmp"
+.LASF2779:
+	.string	"iterator_traits<char*>"
+.LASF149:
+	.string	"__INT_WIDTH__ 32"
+.LASF3023:
+	.string	"mbstate_t"
+.LASF752:
+	.string	"_PSTL_CPP14_2RANGE_MISMATCH_EQUAL_PRESENT (_MSC_VER >= 1900 || __cplusplus >= 201300L || __cpp_lib_robust_nonmodifying_seq_ops == 201304)"
+.LASF1593:
+	.string	"strpbrk"
+.LASF2103:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_BEFORE_DEALLOC "
+.LASF2425:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_M_constructEmc"
+.LASF3016:
+	.string	"wint_t"
+.LASF368:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF713:
+	.string	"_GLIBCXX_USE_C99_MATH _GLIBCXX11_USE_C99_MATH"
+.LASF24:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1622:
+	.string	"ADJ_SETOFFSET 0x0100"
+.LASF985:
+	.string	"_GLIBCXX_USE_RANDOM_TR1 1"
+.LASF1234:
+	.string	"_BITS_TYPES_H 1"
+.LASF1883:
+	.string	"P_tmpdir \"/tmp\""
+.LASF1288:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1964:
+	.string	"EFAULT 14"
+.LASF2891:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmIEl"
+.LASF369:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1112:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2336:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareES2_"
+.LASF2826:
+	.string	"_ZSt3minImERKT_S2_S2_"
+.LASF2834:
+	.string	"unsigned int"
+.LASF1513:
+	.string	"UINT16_C(c) c"
+.LASF2483:
+	.string	"reverse_iterator"
+.LASF239:
+	.string	"__DBL_EPSILON__ double(2.22044604925031308084726333618164062e-16L)"
+.LASF2129:
+	.string	"_Destroy_aux<true>"
+.LASF1409:
+	.string	"bsearch"
+.LASF1202:
+	.string	"__CFLOAT128 __cfloat128"
+.LASF395:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF863:
+	.string	"_GLIBCXX_HAVE_POWF 1"
+.LASF540:
+	.string	"__USE_ATFILE"
+.LASF1368:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1399:
+	.string	"__COMPAR_FN_T "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"./src/main/log_ring.cpp"
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
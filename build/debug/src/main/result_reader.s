@@ -0,0 +1,45856 @@
+	.file	"result_reader.cpp"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "./src/main/result_reader.cpp"
+	.section	.text._ZnwmPv,"axG",@progbits,_ZnwmPv,comdat
+	.weak	_ZnwmPv
+	.type	_ZnwmPv, @function
+_ZnwmPv:
+.LFB408:
+	.file 1 "/usr/include/c++/12/new"
+	.loc 1 175 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZnwmPv(%rip)
+	.loc 1 175 10
+	movq	-16(%rbp), %rax
+	.loc 1 175 15
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE408:
+	.size	_ZnwmPv, .-_ZnwmPv
+	.section	.rodata
+	.type	_ZN6__pstl9execution2v1L3seqE, @object
+	.size	_ZN6__pstl9execution2v1L3seqE, 1
+_ZN6__pstl9execution2v1L3seqE:
+	.zero	1
+	.type	_ZN6__pstl9execution2v1L3parE, @object
+	.size	_ZN6__pstl9execution2v1L3parE, 1
+_ZN6__pstl9execution2v1L3parE:
+	.zero	1
+	.type	_ZN6__pstl9execution2v1L9par_unseqE, @object
+	.size	_ZN6__pstl9execution2v1L9par_unseqE, 1
+_ZN6__pstl9execution2v1L9par_unseqE:
+	.zero	1
+	.type	_ZN6__pstl9execution2v1L5unseqE, @object
+	.size	_ZN6__pstl9execution2v1L5unseqE, 1
+_ZN6__pstl9execution2v1L5unseqE:
+	.zero	1
+	.align 4
+	.type	_ZN9__gnu_cxxL21__default_lock_policyE, @object
+	.size	_ZN9__gnu_cxxL21__default_lock_policyE, 4
+_ZN9__gnu_cxxL21__default_lock_policyE:
+	.long	2
+	.align 8
+	.type	_ZN9simulatorL15resultFileMagicE, @object
+	.size	_ZN9simulatorL15resultFileMagicE, 8
+_ZN9simulatorL15resultFileMagicE:
+	.string	"INFPROP"
+	.align 4
+	.type	_ZN9simulatorL17resultFileVersionE, @object
+	.size	_ZN9simulatorL17resultFileVersionE, 4
+_ZN9simulatorL17resultFileVersionE:
+	.long	1
+	.section	.text._ZN9simulator21get_result_chunk_sizeEj,"axG",@progbits,_ZN9simulator21get_result_chunk_sizeEj,comdat
+	.weak	_ZN9simulator21get_result_chunk_sizeEj
+	.type	_ZN9simulator21get_result_chunk_sizeEj, @function
+_ZN9simulator21get_result_chunk_sizeEj:
+.LFB2609:
+	.file 2 "./src/main/inc/result_file.h"
+	.loc 2 42 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$24, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movl	%edi, -20(%rbp)
+	lock addq	$1, __gcov0._ZN9simulator21get_result_chunk_sizeEj(%rip)
+	.loc 2 43 32
+	movl	-20(%rbp), %edx
+	.loc 2 43 19
+	movq	%rdx, %rax
+	addq	%rax, %rax
+	addq	%rdx, %rax
+	salq	$2, %rax
+	movq	%rax, -8(%rbp)
+	.loc 2 44 54
+	movq	-8(%rbp), %rax
+	addq	$7, %rax
+	.loc 2 44 65
+	andq	$-8, %rax
+	.loc 2 44 67
+	addq	$8, %rax
+	.loc 2 45 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2609:
+	.size	_ZN9simulator21get_result_chunk_sizeEj, .-_ZN9simulator21get_result_chunk_sizeEj
+	.section	.text._ZNSt12_Vector_baseImSaImEE12_Vector_implD2Ev,"axG",@progbits,_ZNSt12_Vector_baseImSaImEE12_Vector_implD5Ev,comdat
+	.align 2
+	.weak	_ZNSt12_Vector_baseImSaImEE12_Vector_implD2Ev
+	.type	_ZNSt12_Vector_baseImSaImEE12_Vector_implD2Ev, @function
+_ZNSt12_Vector_baseImSaImEE12_Vector_implD2Ev:
+.LFB2627:
+	.file 3 "/usr/include/c++/12/bits/stl_vector.h"
+	.loc 3 133 14
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Vector_baseImSaImEE12_Vector_implD2Ev(%rip)
+.LBB2:
+	.loc 3 133 14
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSaImED2Ev
+	lock addq	$1, 8+__gcov0._ZNSt12_Vector_baseImSaImEE12_Vector_implD2Ev(%rip)
+.LBE2:
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2627:
+	.size	_ZNSt12_Vector_baseImSaImEE12_Vector_implD2Ev, .-_ZNSt12_Vector_baseImSaImEE12_Vector_implD2Ev
+	.weak	_ZNSt12_Vector_baseImSaImEE12_Vector_implD1Ev
+	.set	_ZNSt12_Vector_baseImSaImEE12_Vector_implD1Ev,_ZNSt12_Vector_baseImSaImEE12_Vector_implD2Ev
+	.section	.text._ZNSt12_Vector_baseImSaImEEC2Ev,"axG",@progbits,_ZNSt12_Vector_baseImSaImEEC5Ev,comdat
+	.align 2
+	.weak	_ZNSt12_Vector_baseImSaImEEC2Ev
+	.type	_ZNSt12_Vector_baseImSaImEEC2Ev, @function
+_ZNSt12_Vector_baseImSaImEEC2Ev:
+.LFB2629:
+	.loc 3 312 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Vector_baseImSaImEEC2Ev(%rip)
+.LBB3:
+	.loc 3 312 7
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseImSaImEE12_Vector_implC1Ev
+	lock addq	$1, 8+__gcov0._ZNSt12_Vector_baseImSaImEEC2Ev(%rip)
+.LBE3:
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2629:
+	.size	_ZNSt12_Vector_baseImSaImEEC2Ev, .-_ZNSt12_Vector_baseImSaImEEC2Ev
+	.weak	_ZNSt12_Vector_baseImSaImEEC1Ev
+	.set	_ZNSt12_Vector_baseImSaImEEC1Ev,_ZNSt12_Vector_baseImSaImEEC2Ev
+	.section	.text._ZNSt6vectorImSaImEEC2Ev,"axG",@progbits,_ZNSt6vectorImSaImEEC5Ev,comdat
+	.align 2
+	.weak	_ZNSt6vectorImSaImEEC2Ev
+	.type	_ZNSt6vectorImSaImEEC2Ev, @function
+_ZNSt6vectorImSaImEEC2Ev:
+.LFB2631:
+	.loc 3 526 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt6vectorImSaImEEC2Ev(%rip)
+.LBB4:
+	.loc 3 526 7
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseImSaImEEC2Ev
+	lock addq	$1, 8+__gcov0._ZNSt6vectorImSaImEEC2Ev(%rip)
+.LBE4:
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2631:
+	.size	_ZNSt6vectorImSaImEEC2Ev, .-_ZNSt6vectorImSaImEEC2Ev
+	.weak	_ZNSt6vectorImSaImEEC1Ev
+	.set	_ZNSt6vectorImSaImEEC1Ev,_ZNSt6vectorImSaImEEC2Ev
+	.section	.rodata
+	.align 8
+.LC0:
+	.string	"simulator::result_reader::result_reader(const std::string&)"
+.LC1:
+	.string	"./src/main/result_reader.cpp"
+.LC2:
+	.string	"-1 != fileDescriptor"
+.LC3:
+	.string	"0 == statResult"
+	.align 8
+.LC4:
+	.string	"sizeof(result_file_header) <= mSize"
+.LC5:
+	.string	"MAP_FAILED != mapping"
+	.align 8
+.LC6:
+	.string	"std::equal(std::begin(resultFileMagic), std::end(resultFileMagic), header.mMagic)"
+	.align 8
+.LC7:
+	.string	"resultFileVersion == header.mVersion"
+	.align 8
+.LC8:
+	.string	"sizeof(time) == header.mTimeSize"
+	.align 8
+.LC9:
+	.string	"sizeof(degree) == header.mDegreeSize"
+	.align 8
+.LC10:
+	.string	"offset + sizeof(result_chunk_header) <= mSize"
+.LC11:
+	.string	"offset == mSize"
+	.text
+	.align 2
+	.globl	_ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE
+	.type	_ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE, @function
+_ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE:
+.LFB2633:
+	.file 4 "./src/main/result_reader.cpp"
+	.loc 4 21 1
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA2633
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	subq	$216, %rsp
+	.cfi_offset 3, -24
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -216(%rbp)
+	movq	%rsi, -224(%rbp)
+	lock addq	$1, __gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+.LBB5:
+	.loc 4 22 6
+	movq	-216(%rbp), %rax
+	movq	$0, (%rax)
+	.loc 4 23 6
+	movq	-216(%rbp), %rax
+	movq	$0, 8(%rax)
+	.loc 4 24 6
+	movq	-216(%rbp), %rax
+	pxor	%xmm0, %xmm0
+	movups	%xmm0, 16(%rax)
+	movq	%xmm0, 32(%rax)
+	movq	-216(%rbp), %rax
+	addq	$16, %rax
+	movq	%rax, %rdi
+	call	_ZNSt6vectorImSaImEEC1Ev
+	lock addq	$1, 8+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+.LBB6:
+	.loc 4 26 34
+	movq	-224(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5c_strEv@PLT
+	lock addq	$1, 16+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	movl	$0, %esi
+	movq	%rax, %rdi
+	movl	$0, %eax
+.LEHB0:
+	call	open@PLT
+.LEHE0:
+	movl	%eax, -20(%rbp)
+	.loc 4 27 5
+	cmpl	$-1, -20(%rbp)
+	jne	.L9
+	lock addq	$1, 40+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 27 32 discriminator 1
+	leaq	.LC0(%rip), %rax
+	movq	%rax, %rcx
+	movl	$27, %edx
+	leaq	.LC1(%rip), %rax
+	movq	%rax, %rsi
+	leaq	.LC2(%rip), %rax
+	movq	%rax, %rdi
+	call	__assert_fail@PLT
+.L9:
+	lock addq	$1, 32+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 29 16
+	leaq	-208(%rbp), %rdx
+	movl	$0, %eax
+	movl	$18, %ecx
+	movq	%rdx, %rdi
+	rep stosq
+	.loc 4 30 48
+	leaq	-208(%rbp), %rdx
+	movl	-20(%rbp), %eax
+	movq	%rdx, %rsi
+	movl	%eax, %edi
+	call	fstat@PLT
+	movl	%eax, -24(%rbp)
+	lock addq	$1, 48+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 31 5
+	cmpl	$0, -24(%rbp)
+	je	.L10
+	.loc 4 31 32 discriminator 1
+	leaq	.LC0(%rip), %rax
+	movq	%rax, %rcx
+	movl	$31, %edx
+	leaq	.LC1(%rip), %rax
+	movq	%rax, %rsi
+	leaq	.LC3(%rip), %rax
+	movq	%rax, %rdi
+	call	__assert_fail@PLT
+.L10:
+	.loc 4 32 43
+	movq	-160(%rbp), %rax
+	.loc 4 32 12
+	movq	%rax, %rdx
+	.loc 4 32 10
+	movq	-216(%rbp), %rax
+	movq	%rdx, 8(%rax)
+	.loc 4 33 33
+	movq	-216(%rbp), %rax
+	movq	8(%rax), %rax
+	.loc 4 33 5
+	cmpq	$15, %rax
+	ja	.L11
+	lock addq	$1, 64+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 33 32 discriminator 1
+	leaq	.LC0(%rip), %rax
+	movq	%rax, %rcx
+	movl	$33, %edx
+	leaq	.LC1(%rip), %rax
+	movq	%rax, %rsi
+	leaq	.LC4(%rip), %rax
+	movq	%rax, %rdi
+	call	__assert_fail@PLT
+.L11:
+	lock addq	$1, 56+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 36 29
+	movq	-216(%rbp), %rax
+	movq	8(%rax), %rax
+	movl	-20(%rbp), %edx
+	movl	$0, %r9d
+	movl	%edx, %r8d
+	movl	$2, %ecx
+	movl	$1, %edx
+	movq	%rax, %rsi
+	movl	$0, %edi
+	call	mmap@PLT
+	movq	%rax, -32(%rbp)
+	lock addq	$1, 72+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 37 9
+	movl	-20(%rbp), %eax
+	movl	%eax, %edi
+.LEHB1:
+	call	close@PLT
+.LEHE1:
+	jmp	.L30
+.L29:
+	lock addq	$1, 80+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	jmp	.L14
+.L30:
+	.loc 4 38 5
+	cmpq	$-1, -32(%rbp)
+	jne	.L15
+	lock addq	$1, 96+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 38 32 discriminator 1
+	leaq	.LC0(%rip), %rax
+	movq	%rax, %rcx
+	movl	$38, %edx
+	leaq	.LC1(%rip), %rax
+	movq	%rax, %rsi
+	leaq	.LC5(%rip), %rax
+	movq	%rax, %rdi
+	call	__assert_fail@PLT
+.L15:
+	lock addq	$1, 88+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 39 11
+	movq	-216(%rbp), %rax
+	movq	8(%rax), %rcx
+	movq	-32(%rbp), %rax
+	movl	$2, %edx
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	madvise@PLT
+	lock addq	$1, 104+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 40 10
+	movq	-216(%rbp), %rax
+	movq	-32(%rbp), %rdx
+	movq	%rdx, (%rax)
+	.loc 4 42 23
+	movq	$0, -48(%rbp)
+	movq	$0, -40(%rbp)
+	.loc 4 43 25
+	movq	-216(%rbp), %rax
+	movq	(%rax), %rax
+	.loc 4 43 15
+	movq	8(%rax), %rdx
+	movq	(%rax), %rax
+	movq	%rax, -48(%rbp)
+	movq	%rdx, -40(%rbp)
+	.loc 4 44 13
+	leaq	_ZN9simulatorL15resultFileMagicE(%rip), %rax
+	movq	%rax, %rdi
+	call	_ZSt3endIKcLm8EEPT_RAT0__S1_
+	movq	%rax, %rbx
+	lock addq	$1, 112+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	leaq	_ZN9simulatorL15resultFileMagicE(%rip), %rax
+	movq	%rax, %rdi
+	call	_ZSt5beginIKcLm8EEPT_RAT0__S1_
+	movq	%rax, %rcx
+	lock addq	$1, 120+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	leaq	-48(%rbp), %rax
+	movq	%rax, %rdx
+	movq	%rbx, %rsi
+	movq	%rcx, %rdi
+.LEHB2:
+	call	_ZSt5equalIPKcPcEbT_S3_T0_
+.LEHE2:
+	.loc 4 44 5
+	testb	%al, %al
+	jne	.L16
+	lock addq	$1, 136+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 44 32 discriminator 2
+	leaq	.LC0(%rip), %rax
+	movq	%rax, %rcx
+	movl	$44, %edx
+	leaq	.LC1(%rip), %rax
+	movq	%rax, %rsi
+	leaq	.LC6(%rip), %rax
+	movq	%rax, %rdi
+	call	__assert_fail@PLT
+.L16:
+	lock addq	$1, 128+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 45 31
+	movl	-40(%rbp), %eax
+	.loc 4 45 5
+	cmpl	$1, %eax
+	je	.L17
+	lock addq	$1, 144+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 45 32 discriminator 1
+	leaq	.LC0(%rip), %rax
+	movq	%rax, %rcx
+	movl	$45, %edx
+	leaq	.LC1(%rip), %rax
+	movq	%rax, %rsi
+	leaq	.LC7(%rip), %rax
+	movq	%rax, %rdi
+	call	__assert_fail@PLT
+.L17:
+	.loc 4 46 26
+	movzwl	-36(%rbp), %eax
+	.loc 4 46 5
+	cmpw	$8, %ax
+	je	.L18
+	lock addq	$1, 152+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 46 32 discriminator 1
+	leaq	.LC0(%rip), %rax
+	movq	%rax, %rcx
+	movl	$46, %edx
+	leaq	.LC1(%rip), %rax
+	movq	%rax, %rsi
+	leaq	.LC8(%rip), %rax
+	movq	%rax, %rdi
+	call	__assert_fail@PLT
+.L18:
+	.loc 4 47 28
+	movzwl	-34(%rbp), %eax
+	.loc 4 47 5
+	cmpw	$4, %ax
+	je	.L19
+	lock addq	$1, 160+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 47 32 discriminator 1
+	leaq	.LC0(%rip), %rax
+	movq	%rax, %rcx
+	movl	$47, %edx
+	leaq	.LC1(%rip), %rax
+	movq	%rax, %rsi
+	leaq	.LC9(%rip), %rax
+	movq	%rax, %rdi
+	call	__assert_fail@PLT
+.L19:
+	.loc 4 50 13
+	movq	$16, -56(%rbp)
+	.loc 4 51 4
+	jmp	.L20
+.L22:
+.LBB7:
+	.loc 4 53 13
+	movq	-56(%rbp), %rax
+	leaq	8(%rax), %rdx
+	.loc 4 53 46
+	movq	-216(%rbp), %rax
+	movq	8(%rax), %rax
+	.loc 4 53 8
+	cmpq	%rdx, %rax
+	jnb	.L21
+	lock addq	$1, 176+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 53 35 discriminator 1
+	leaq	.LC0(%rip), %rax
+	movq	%rax, %rcx
+	movl	$53, %edx
+	leaq	.LC1(%rip), %rax
+	movq	%rax, %rsi
+	leaq	.LC10(%rip), %rax
+	movq	%rax, %rdi
+	call	__assert_fail@PLT
+.L21:
+	lock addq	$1, 168+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 54 27
+	movq	$0, -64(%rbp)
+	.loc 4 55 33
+	movq	-216(%rbp), %rax
+	movq	(%rax), %rdx
+	.loc 4 55 39
+	movq	-56(%rbp), %rax
+	addq	%rdx, %rax
+	.loc 4 55 18
+	movq	(%rax), %rax
+	movq	%rax, -64(%rbp)
+	.loc 4 57 30
+	movq	-216(%rbp), %rax
+	leaq	16(%rax), %rdx
+	leaq	-56(%rbp), %rax
+	movq	%rax, %rsi
+	movq	%rdx, %rdi
+.LEHB3:
+	call	_ZNSt6vectorImSaImEE9push_backERKm
+.LEHE3:
+	lock addq	$1, 192+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 58 38
+	movl	-60(%rbp), %eax
+	movl	%eax, %edi
+	call	_ZN9simulator21get_result_chunk_sizeEj
+	lock addq	$1, 200+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 58 14
+	movq	-56(%rbp), %rdx
+	addq	%rdx, %rax
+	movq	%rax, -56(%rbp)
+.L20:
+.LBE7:
+	.loc 4 51 19
+	movq	-216(%rbp), %rax
+	movq	8(%rax), %rax
+	.loc 4 51 17
+	movq	-56(%rbp), %rdx
+	cmpq	%rax, %rdx
+	jb	.L22
+	.loc 4 60 13
+	movq	-216(%rbp), %rax
+	movq	8(%rax), %rdx
+	.loc 4 60 10
+	movq	-56(%rbp), %rax
+	.loc 4 60 5
+	cmpq	%rax, %rdx
+	je	.L31
+	lock addq	$1, 208+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	.loc 4 60 32 discriminator 1
+	leaq	.LC0(%rip), %rax
+	movq	%rax, %rcx
+	movl	$60, %edx
+	leaq	.LC1(%rip), %rax
+	movq	%rax, %rsi
+	leaq	.LC11(%rip), %rax
+	movq	%rax, %rdi
+	call	__assert_fail@PLT
+.L27:
+	lock addq	$1, 184+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	jmp	.L14
+.L28:
+	lock addq	$1, 24+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	jmp	.L14
+.L26:
+.L14:
+	movq	%rax, %rbx
+	lock addq	$1, 216+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+.LBE6:
+	.loc 4 61 1
+	movq	-216(%rbp), %rax
+	addq	$16, %rax
+	movq	%rax, %rdi
+	call	_ZNSt6vectorImSaImEED1Ev
+	lock addq	$1, 224+__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE(%rip)
+	movq	%rbx, %rax
+	movq	%rax, %rdi
+.LEHB4:
+	call	_Unwind_Resume@PLT
+.LEHE4:
+.L31:
+.LBE5:
+	nop
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2633:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA2633:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE2633-.LLSDACSB2633
+.LLSDACSB2633:
+	.uleb128 .LEHB0-.LFB2633
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 .L28-.LFB2633
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB2633
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L29-.LFB2633
+	.uleb128 0
+	.uleb128 .LEHB2-.LFB2633
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 .L26-.LFB2633
+	.uleb128 0
+	.uleb128 .LEHB3-.LFB2633
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 .L27-.LFB2633
+	.uleb128 0
+	.uleb128 .LEHB4-.LFB2633
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE2633:
+	.text
+	.size	_ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE, .-_ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE
+	.globl	_ZN9simulator13result_readerC1ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE
+	.set	_ZN9simulator13result_readerC1ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE,_ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE
+	.align 2
+	.globl	_ZN9simulator13result_readerD2Ev
+	.type	_ZN9simulator13result_readerD2Ev, @function
+_ZN9simulator13result_readerD2Ev:
+.LFB2636:
+	.loc 4 63 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZN9simulator13result_readerD2Ev(%rip)
+.LBB8:
+	.loc 4 65 10
+	movq	-8(%rbp), %rax
+	movq	8(%rax), %rdx
+	.loc 4 65 30
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rax
+	.loc 4 65 10
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	munmap@PLT
+	lock addq	$1, 8+__gcov0._ZN9simulator13result_readerD2Ev(%rip)
+	.loc 4 66 1
+	movq	-8(%rbp), %rax
+	addq	$16, %rax
+	movq	%rax, %rdi
+	call	_ZNSt6vectorImSaImEED1Ev
+	lock addq	$1, 16+__gcov0._ZN9simulator13result_readerD2Ev(%rip)
+.LBE8:
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2636:
+	.size	_ZN9simulator13result_readerD2Ev, .-_ZN9simulator13result_readerD2Ev
+	.globl	_ZN9simulator13result_readerD1Ev
+	.set	_ZN9simulator13result_readerD1Ev,_ZN9simulator13result_readerD2Ev
+	.align 2
+	.globl	_ZNK9simulator13result_reader17get_num_of_chunksEv
+	.type	_ZNK9simulator13result_reader17get_num_of_chunksEv, @function
+_ZNK9simulator13result_reader17get_num_of_chunksEv:
+.LFB2638:
+	.loc 4 69 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNK9simulator13result_reader17get_num_of_chunksEv(%rip)
+	.loc 4 70 29
+	movq	-8(%rbp), %rax
+	addq	$16, %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorImSaImEE4sizeEv
+	.loc 4 70 30
+	nop
+	lock addq	$1, 8+__gcov0._ZNK9simulator13result_reader17get_num_of_chunksEv(%rip)
+	.loc 4 71 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2638:
+	.size	_ZNK9simulator13result_reader17get_num_of_chunksEv, .-_ZNK9simulator13result_reader17get_num_of_chunksEv
+	.section	.rodata
+	.align 8
+.LC12:
+	.string	"simulator::result_chunk simulator::result_reader::get_chunk(size_t) const"
+.LC13:
+	.string	"index < mChunkOffsets.size()"
+	.text
+	.align 2
+	.globl	_ZNK9simulator13result_reader9get_chunkEm
+	.type	_ZNK9simulator13result_reader9get_chunkEm, @function
+_ZNK9simulator13result_reader9get_chunkEm:
+.LFB2639:
+	.loc 4 74 1
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	subq	$72, %rsp
+	.cfi_offset 3, -24
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -56(%rbp)
+	movq	%rsi, -64(%rbp)
+	movq	%rdx, -72(%rbp)
+	lock addq	$1, __gcov0._ZNK9simulator13result_reader9get_chunkEm(%rip)
+	.loc 4 75 29
+	movq	-64(%rbp), %rax
+	addq	$16, %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorImSaImEE4sizeEv
+	lock addq	$1, 8+__gcov0._ZNK9simulator13result_reader9get_chunkEm(%rip)
+	.loc 4 75 5
+	cmpq	%rax, -72(%rbp)
+	jb	.L36
+	lock addq	$1, 16+__gcov0._ZNK9simulator13result_reader9get_chunkEm(%rip)
+	.loc 4 75 32 discriminator 1
+	leaq	.LC12(%rip), %rax
+	movq	%rax, %rcx
+	movl	$75, %edx
+	leaq	.LC1(%rip), %rax
+	movq	%rax, %rsi
+	leaq	.LC13(%rip), %rax
+	movq	%rax, %rdi
+	call	__assert_fail@PLT
+.L36:
+	.loc 4 77 33
+	movq	-64(%rbp), %rax
+	movq	(%rax), %rbx
+	.loc 4 77 60
+	movq	-64(%rbp), %rax
+	leaq	16(%rax), %rdx
+	movq	-72(%rbp), %rax
+	movq	%rax, %rsi
+	movq	%rdx, %rdi
+	call	_ZNKSt6vectorImSaImEEixEm
+	lock addq	$1, 24+__gcov0._ZNK9simulator13result_reader9get_chunkEm(%rip)
+	.loc 4 77 39
+	movq	(%rax), %rax
+	.loc 4 77 61
+	addq	%rbx, %rax
+	movq	%rax, -24(%rbp)
+	.loc 4 78 24
+	movq	$0, -48(%rbp)
+	.loc 4 79 15
+	movq	-24(%rbp), %rax
+	movq	(%rax), %rax
+	movq	%rax, -48(%rbp)
+	.loc 4 82 22
+	movq	-24(%rbp), %rax
+	addq	$8, %rax
+	movq	%rax, -32(%rbp)
+	.loc 4 83 86
+	movl	-44(%rbp), %eax
+	movl	%eax, %eax
+	.loc 4 83 72
+	leaq	0(,%rax,8), %rdx
+	.loc 4 83 24
+	movq	-32(%rbp), %rax
+	addq	%rdx, %rax
+	movq	%rax, -40(%rbp)
+	.loc 4 84 37
+	movl	-48(%rbp), %edx
+	.loc 4 84 93
+	movq	-56(%rbp), %rax
+	movl	%edx, (%rax)
+	.loc 4 84 64
+	movl	-44(%rbp), %edx
+	.loc 4 84 93
+	movq	-56(%rbp), %rax
+	movl	%edx, 4(%rax)
+	movq	-56(%rbp), %rax
+	movq	-32(%rbp), %rdx
+	movq	%rdx, 8(%rax)
+	movq	-56(%rbp), %rax
+	movq	-40(%rbp), %rdx
+	movq	%rdx, 16(%rax)
+	.loc 4 85 1
+	movq	-56(%rbp), %rax
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2639:
+	.size	_ZNK9simulator13result_reader9get_chunkEm, .-_ZNK9simulator13result_reader9get_chunkEm
+	.align 2
+	.type	_ZZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkEENKUlmjE_clEmj, @function
+_ZZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkEENKUlmjE_clEmj:
+.LFB2641:
+	.loc 4 92 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$40, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	movl	%edx, -36(%rbp)
+	lock addq	$1, __gcov0._ZZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkEENKUlmjE_clEmj(%rip)
+.LBB9:
+	.loc 4 94 30
+	movq	$0, -8(%rbp)
+	.loc 4 92 62
+	movq	-24(%rbp), %rax
+	movq	(%rax), %rax
+	.loc 4 95 36
+	movq	(%rax), %rdx
+	.loc 4 95 21
+	movq	-32(%rbp), %rax
+	addq	%rdx, %rax
+	movq	(%rax), %rax
+	movq	%rax, -8(%rbp)
+	.loc 4 96 29
+	movl	-8(%rbp), %eax
+	.loc 4 96 45
+	cmpl	-36(%rbp), %eax
+	setb	%al
+.LBE9:
+	.loc 4 97 7
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2641:
+	.size	_ZZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkEENKUlmjE_clEmj, .-_ZZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkEENKUlmjE_clEmj
+	.align 2
+	.globl	_ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE
+	.type	_ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE, @function
+_ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE:
+.LFB2640:
+	.loc 4 88 1
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA2640
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r12
+	pushq	%rbx
+	subq	$96, %rsp
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -56(%rbp)
+	movl	%esi, -60(%rbp)
+	movq	%rdx, -72(%rbp)
+	lock addq	$1, __gcov0._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE(%rip)
+	.loc 4 90 42
+	movq	-56(%rbp), %rbx
+	movq	-56(%rbp), %rax
+	addq	$16, %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorImSaImEE3endEv
+	movq	%rax, %r12
+	lock addq	$1, 8+__gcov0._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE(%rip)
+	movq	-56(%rbp), %rax
+	addq	$16, %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorImSaImEE5beginEv
+	movq	%rax, %rdi
+	lock addq	$1, 16+__gcov0._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE(%rip)
+	leaq	-60(%rbp), %rax
+	movq	%rbx, %rcx
+	movq	%rax, %rdx
+	movq	%r12, %rsi
+.LEHB5:
+	call	_ZSt11lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjZNK9simulator13result_reader10find_chunkEjRNS8_12result_chunkEEUlmjE_ET_SD_SD_RKT0_T1_
+.LEHE5:
+	movq	%rax, -40(%rbp)
+	lock addq	$1, 32+__gcov0._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE(%rip)
+	.loc 4 98 24
+	movq	-56(%rbp), %rax
+	addq	$16, %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorImSaImEE3endEv
+	movq	%rax, -32(%rbp)
+	lock addq	$1, 40+__gcov0._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE(%rip)
+	.loc 4 98 27
+	leaq	-40(%rbp), %rdx
+	leaq	-32(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_
+	.loc 4 98 4
+	testb	%al, %al
+	je	.L41
+	.loc 4 100 14
+	movl	$0, %eax
+	lock addq	$1, 56+__gcov0._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE(%rip)
+	jmp	.L43
+.L41:
+	lock addq	$1, 48+__gcov0._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE(%rip)
+	.loc 4 103 72
+	movq	-56(%rbp), %rax
+	addq	$16, %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorImSaImEE5beginEv
+	movq	%rax, -24(%rbp)
+	lock addq	$1, 64+__gcov0._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE(%rip)
+	.loc 4 103 51
+	leaq	-24(%rbp), %rdx
+	leaq	-40(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_
+	lock addq	$1, 72+__gcov0._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE(%rip)
+	.loc 4 103 21
+	movq	%rax, %rdx
+	movq	-72(%rbp), %rbx
+	leaq	-112(%rbp), %rax
+	movq	-56(%rbp), %rcx
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZNK9simulator13result_reader9get_chunkEm
+	movq	-112(%rbp), %rax
+	movq	-104(%rbp), %rdx
+	movq	%rax, (%rbx)
+	movq	%rdx, 8(%rbx)
+	movq	-96(%rbp), %rax
+	movq	%rax, 16(%rbx)
+	.loc 4 104 17
+	movq	-72(%rbp), %rax
+	movl	(%rax), %edx
+	.loc 4 104 34
+	movl	-60(%rbp), %eax
+	cmpl	%eax, %edx
+	sete	%al
+.L43:
+	lock addq	$1, 80+__gcov0._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE(%rip)
+	jmp	.L46
+.L45:
+	lock addq	$1, 24+__gcov0._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE(%rip)
+	movq	%rax, %rdi
+.LEHB6:
+	call	_Unwind_Resume@PLT
+.LEHE6:
+.L46:
+	.loc 4 105 1
+	addq	$96, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2640:
+	.section	.gcc_except_table
+.LLSDA2640:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE2640-.LLSDACSB2640
+.LLSDACSB2640:
+	.uleb128 .LEHB5-.LFB2640
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 .L45-.LFB2640
+	.uleb128 0
+	.uleb128 .LEHB6-.LFB2640
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE2640:
+	.text
+	.size	_ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE, .-_ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE
+	.section	.text._ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev,"axG",@progbits,_ZNSt12_Vector_baseImSaImEE12_Vector_implC5Ev,comdat
+	.align 2
+	.weak	_ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev
+	.type	_ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev, @function
+_ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev:
+.LFB2920:
+	.loc 3 137 2
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev(%rip)
+.LBB10:
+	.loc 3 139 19
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSaImEC2Ev
+	lock addq	$1, 8+__gcov0._ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev(%rip)
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC2Ev
+	lock addq	$1, 16+__gcov0._ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev(%rip)
+.LBE10:
+	.loc 3 140 4
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2920:
+	.size	_ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev, .-_ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev
+	.weak	_ZNSt12_Vector_baseImSaImEE12_Vector_implC1Ev
+	.set	_ZNSt12_Vector_baseImSaImEE12_Vector_implC1Ev,_ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev
+	.section	.text._ZNSaImED2Ev,"axG",@progbits,_ZNSaImED5Ev,comdat
+	.align 2
+	.weak	_ZNSaImED2Ev
+	.type	_ZNSaImED2Ev, @function
+_ZNSaImED2Ev:
+.LFB2923:
+	.file 5 "/usr/include/c++/12/bits/allocator.h"
+	.loc 5 174 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSaImED2Ev(%rip)
+.LBB11:
+	.loc 5 174 31
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt15__new_allocatorImED2Ev
+	lock addq	$1, 8+__gcov0._ZNSaImED2Ev(%rip)
+.LBE11:
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2923:
+	.size	_ZNSaImED2Ev, .-_ZNSaImED2Ev
+	.weak	_ZNSaImED1Ev
+	.set	_ZNSaImED1Ev,_ZNSaImED2Ev
+	.section	.text._ZNSt12_Vector_baseImSaImEED2Ev,"axG",@progbits,_ZNSt12_Vector_baseImSaImEED5Ev,comdat
+	.align 2
+	.weak	_ZNSt12_Vector_baseImSaImEED2Ev
+	.type	_ZNSt12_Vector_baseImSaImEED2Ev, @function
+_ZNSt12_Vector_baseImSaImEED2Ev:
+.LFB2926:
+	.loc 3 364 7
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA2926
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Vector_baseImSaImEED2Ev(%rip)
+.LBB12:
+	.loc 3 367 17
+	movq	-8(%rbp), %rax
+	movq	16(%rax), %rdx
+	.loc 3 367 45
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rax
+	.loc 3 367 35
+	subq	%rax, %rdx
+	movq	%rdx, %rax
+	sarq	$3, %rax
+	.loc 3 366 15
+	movq	%rax, %rdx
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rcx
+	movq	-8(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm
+	lock addq	$1, 8+__gcov0._ZNSt12_Vector_baseImSaImEED2Ev(%rip)
+	.loc 3 368 7
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseImSaImEE12_Vector_implD1Ev
+	lock addq	$1, 16+__gcov0._ZNSt12_Vector_baseImSaImEED2Ev(%rip)
+.LBE12:
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2926:
+	.section	.gcc_except_table
+.LLSDA2926:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE2926-.LLSDACSB2926
+.LLSDACSB2926:
+.LLSDACSE2926:
+	.section	.text._ZNSt12_Vector_baseImSaImEED2Ev,"axG",@progbits,_ZNSt12_Vector_baseImSaImEED5Ev,comdat
+	.size	_ZNSt12_Vector_baseImSaImEED2Ev, .-_ZNSt12_Vector_baseImSaImEED2Ev
+	.weak	_ZNSt12_Vector_baseImSaImEED1Ev
+	.set	_ZNSt12_Vector_baseImSaImEED1Ev,_ZNSt12_Vector_baseImSaImEED2Ev
+	.section	.text._ZNSt6vectorImSaImEED2Ev,"axG",@progbits,_ZNSt6vectorImSaImEED5Ev,comdat
+	.align 2
+	.weak	_ZNSt6vectorImSaImEED2Ev
+	.type	_ZNSt6vectorImSaImEED2Ev, @function
+_ZNSt6vectorImSaImEED2Ev:
+.LFB2929:
+	.loc 3 728 7
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA2929
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt6vectorImSaImEED2Ev(%rip)
+.LBB13:
+	.loc 3 731 28
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv
+	movq	%rax, %rdx
+	lock addq	$1, 8+__gcov0._ZNSt6vectorImSaImEED2Ev(%rip)
+	.loc 3 730 15
+	movq	-8(%rbp), %rax
+	movq	8(%rax), %rcx
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt8_DestroyIPmmEvT_S1_RSaIT0_E
+	lock addq	$1, 16+__gcov0._ZNSt6vectorImSaImEED2Ev(%rip)
+	.loc 3 733 7
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseImSaImEED2Ev
+	lock addq	$1, 24+__gcov0._ZNSt6vectorImSaImEED2Ev(%rip)
+.LBE13:
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2929:
+	.section	.gcc_except_table
+.LLSDA2929:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE2929-.LLSDACSB2929
+.LLSDACSB2929:
+.LLSDACSE2929:
+	.section	.text._ZNSt6vectorImSaImEED2Ev,"axG",@progbits,_ZNSt6vectorImSaImEED5Ev,comdat
+	.size	_ZNSt6vectorImSaImEED2Ev, .-_ZNSt6vectorImSaImEED2Ev
+	.weak	_ZNSt6vectorImSaImEED1Ev
+	.set	_ZNSt6vectorImSaImEED1Ev,_ZNSt6vectorImSaImEED2Ev
+	.section	.text._ZSt5beginIKcLm8EEPT_RAT0__S1_,"axG",@progbits,_ZSt5beginIKcLm8EEPT_RAT0__S1_,comdat
+	.weak	_ZSt5beginIKcLm8EEPT_RAT0__S1_
+	.type	_ZSt5beginIKcLm8EEPT_RAT0__S1_, @function
+_ZSt5beginIKcLm8EEPT_RAT0__S1_:
+.LFB2931:
+	.file 6 "/usr/include/c++/12/bits/range_access.h"
+	.loc 6 95 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZSt5beginIKcLm8EEPT_RAT0__S1_(%rip)
+	.loc 6 96 14
+	movq	-8(%rbp), %rax
+	.loc 6 96 21
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2931:
+	.size	_ZSt5beginIKcLm8EEPT_RAT0__S1_, .-_ZSt5beginIKcLm8EEPT_RAT0__S1_
+	.section	.text._ZSt3endIKcLm8EEPT_RAT0__S1_,"axG",@progbits,_ZSt3endIKcLm8EEPT_RAT0__S1_,comdat
+	.weak	_ZSt3endIKcLm8EEPT_RAT0__S1_
+	.type	_ZSt3endIKcLm8EEPT_RAT0__S1_, @function
+_ZSt3endIKcLm8EEPT_RAT0__S1_:
+.LFB2932:
+	.loc 6 106 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZSt3endIKcLm8EEPT_RAT0__S1_(%rip)
+	.loc 6 107 22
+	movq	-8(%rbp), %rax
+	addq	$8, %rax
+	.loc 6 107 27
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2932:
+	.size	_ZSt3endIKcLm8EEPT_RAT0__S1_, .-_ZSt3endIKcLm8EEPT_RAT0__S1_
+	.section	.text._ZSt5equalIPKcPcEbT_S3_T0_,"axG",@progbits,_ZSt5equalIPKcPcEbT_S3_T0_,comdat
+	.weak	_ZSt5equalIPKcPcEbT_S3_T0_
+	.type	_ZSt5equalIPKcPcEbT_S3_T0_, @function
+_ZSt5equalIPKcPcEbT_S3_T0_:
+.LFB2933:
+	.file 7 "/usr/include/c++/12/bits/stl_algobase.h"
+	.loc 7 1545 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	lock addq	$1, __gcov0._ZSt5equalIPKcPcEbT_S3_T0_(%rip)
+	.loc 7 1555 30
+	movq	-24(%rbp), %rdx
+	movq	-16(%rbp), %rcx
+	movq	-8(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt11__equal_auxIPKcPcEbT_S3_T0_
+	lock addq	$1, 8+__gcov0._ZSt5equalIPKcPcEbT_S3_T0_(%rip)
+	.loc 7 1556 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2933:
+	.size	_ZSt5equalIPKcPcEbT_S3_T0_, .-_ZSt5equalIPKcPcEbT_S3_T0_
+	.section	.text._ZNSt6vectorImSaImEE9push_backERKm,"axG",@progbits,_ZNSt6vectorImSaImEE9push_backERKm,comdat
+	.align 2
+	.weak	_ZNSt6vectorImSaImEE9push_backERKm
+	.type	_ZNSt6vectorImSaImEE9push_backERKm, @function
+_ZNSt6vectorImSaImEE9push_backERKm:
+.LFB2934:
+	.loc 3 1276 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZNSt6vectorImSaImEE9push_backERKm(%rip)
+	.loc 3 1278 20
+	movq	-8(%rbp), %rax
+	movq	8(%rax), %rdx
+	.loc 3 1278 47
+	movq	-8(%rbp), %rax
+	movq	16(%rax), %rax
+	.loc 3 1278 2
+	cmpq	%rax, %rdx
+	je	.L58
+	lock addq	$1, 8+__gcov0._ZNSt6vectorImSaImEE9push_backERKm(%rip)
+	.loc 3 1281 30
+	movq	-8(%rbp), %rax
+	movq	8(%rax), %rcx
+	.loc 3 1281 37
+	movq	-8(%rbp), %rax
+	.loc 3 1281 30
+	movq	-16(%rbp), %rdx
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_
+	lock addq	$1, 16+__gcov0._ZNSt6vectorImSaImEE9push_backERKm(%rip)
+	.loc 3 1283 22
+	movq	-8(%rbp), %rax
+	movq	8(%rax), %rax
+	.loc 3 1283 6
+	leaq	8(%rax), %rdx
+	movq	-8(%rbp), %rax
+	movq	%rdx, 8(%rax)
+	.loc 3 1288 7
+	jmp	.L60
+.L58:
+	.loc 3 1287 21
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt6vectorImSaImEE3endEv
+	movq	%rax, %rcx
+	lock addq	$1, 24+__gcov0._ZNSt6vectorImSaImEE9push_backERKm(%rip)
+	movq	-16(%rbp), %rdx
+	movq	-8(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_
+	lock addq	$1, 32+__gcov0._ZNSt6vectorImSaImEE9push_backERKm(%rip)
+.L60:
+	.loc 3 1288 7
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2934:
+	.size	_ZNSt6vectorImSaImEE9push_backERKm, .-_ZNSt6vectorImSaImEE9push_backERKm
+	.section	.text._ZNKSt6vectorImSaImEE4sizeEv,"axG",@progbits,_ZNKSt6vectorImSaImEE4sizeEv,comdat
+	.align 2
+	.weak	_ZNKSt6vectorImSaImEE4sizeEv
+	.type	_ZNKSt6vectorImSaImEE4sizeEv, @function
+_ZNKSt6vectorImSaImEE4sizeEv:
+.LFB2936:
+	.loc 3 987 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNKSt6vectorImSaImEE4sizeEv(%rip)
+	.loc 3 988 40
+	movq	-8(%rbp), %rax
+	movq	8(%rax), %rdx
+	.loc 3 988 66
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rax
+	.loc 3 988 50
+	subq	%rax, %rdx
+	movq	%rdx, %rax
+	sarq	$3, %rax
+	.loc 3 988 77
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2936:
+	.size	_ZNKSt6vectorImSaImEE4sizeEv, .-_ZNKSt6vectorImSaImEE4sizeEv
+	.section	.text._ZNKSt6vectorImSaImEEixEm,"axG",@progbits,_ZNKSt6vectorImSaImEEixEm,comdat
+	.align 2
+	.weak	_ZNKSt6vectorImSaImEEixEm
+	.type	_ZNKSt6vectorImSaImEEixEm, @function
+_ZNKSt6vectorImSaImEEixEm:
+.LFB2937:
+	.loc 3 1140 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZNKSt6vectorImSaImEEixEm(%rip)
+	.loc 3 1143 25
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rax
+	.loc 3 1143 34
+	movq	-16(%rbp), %rdx
+	salq	$3, %rdx
+	.loc 3 1143 39
+	addq	%rdx, %rax
+	.loc 3 1144 7
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2937:
+	.size	_ZNKSt6vectorImSaImEEixEm, .-_ZNKSt6vectorImSaImEEixEm
+	.section	.text._ZNKSt6vectorImSaImEE5beginEv,"axG",@progbits,_ZNKSt6vectorImSaImEE5beginEv,comdat
+	.align 2
+	.weak	_ZNKSt6vectorImSaImEE5beginEv
+	.type	_ZNKSt6vectorImSaImEE5beginEv, @function
+_ZNKSt6vectorImSaImEE5beginEv:
+.LFB2938:
+	.loc 3 878 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	lock addq	$1, __gcov0._ZNKSt6vectorImSaImEE5beginEv(%rip)
+	.loc 3 879 45
+	movq	-24(%rbp), %rdx
+	.loc 3 879 16
+	leaq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC1ERKS2_
+	lock addq	$1, 8+__gcov0._ZNKSt6vectorImSaImEE5beginEv(%rip)
+	.loc 3 879 53
+	movq	-8(%rbp), %rax
+	.loc 3 879 56
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2938:
+	.size	_ZNKSt6vectorImSaImEE5beginEv, .-_ZNKSt6vectorImSaImEE5beginEv
+	.section	.text._ZNKSt6vectorImSaImEE3endEv,"axG",@progbits,_ZNKSt6vectorImSaImEE3endEv,comdat
+	.align 2
+	.weak	_ZNKSt6vectorImSaImEE3endEv
+	.type	_ZNKSt6vectorImSaImEE3endEv, @function
+_ZNKSt6vectorImSaImEE3endEv:
+.LFB2939:
+	.loc 3 898 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	lock addq	$1, __gcov0._ZNKSt6vectorImSaImEE3endEv(%rip)
+	.loc 3 899 45
+	movq	-24(%rbp), %rax
+	leaq	8(%rax), %rdx
+	.loc 3 899 16
+	leaq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC1ERKS2_
+	lock addq	$1, 8+__gcov0._ZNKSt6vectorImSaImEE3endEv(%rip)
+	.loc 3 899 54
+	movq	-8(%rbp), %rax
+	.loc 3 899 57
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2939:
+	.size	_ZNKSt6vectorImSaImEE3endEv, .-_ZNKSt6vectorImSaImEE3endEv
+	.text
+	.type	_ZSt11lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjZNK9simulator13result_reader10find_chunkEjRNS8_12result_chunkEEUlmjE_ET_SD_SD_RKT0_T1_, @function
+_ZSt11lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjZNK9simulator13result_reader10find_chunkEjRNS8_12result_chunkEEUlmjE_ET_SD_SD_RKT0_T1_:
+.LFB2940:
+	.file 8 "/usr/include/c++/12/bits/stl_algo.h"
+	.loc 8 1994 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	movq	%rcx, -32(%rbp)
+	lock addq	$1, __gcov0._ZSt11lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjZNK9simulator13result_reader10find_chunkEjRNS8_12result_chunkEEUlmjE_ET_SD_SD_RKT0_T1_(%rip)
+	.loc 8 2004 32
+	movq	-32(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZN9__gnu_cxx5__ops15__iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EENS0_14_Iter_comp_valIT_EES8_
+	movq	%rax, %rcx
+	lock addq	$1, 8+__gcov0._ZSt11lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjZNK9simulator13result_reader10find_chunkEjRNS8_12result_chunkEEUlmjE_ET_SD_SD_RKT0_T1_(%rip)
+	movq	-24(%rbp), %rdx
+	movq	-16(%rbp), %rsi
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_
+	.loc 8 2005 46
+	nop
+	lock addq	$1, 16+__gcov0._ZSt11lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjZNK9simulator13result_reader10find_chunkEjRNS8_12result_chunkEEUlmjE_ET_SD_SD_RKT0_T1_(%rip)
+	.loc 8 2006 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2940:
+	.size	_ZSt11lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjZNK9simulator13result_reader10find_chunkEjRNS8_12result_chunkEEUlmjE_ET_SD_SD_RKT0_T1_, .-_ZSt11lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjZNK9simulator13result_reader10find_chunkEjRNS8_12result_chunkEEUlmjE_ET_SD_SD_RKT0_T1_
+	.section	.text._ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_,"axG",@progbits,_ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_,comdat
+	.weak	_ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_
+	.type	_ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_, @function
+_ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_:
+.LFB2941:
+	.file 9 "/usr/include/c++/12/bits/stl_iterator.h"
+	.loc 9 1221 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	subq	$24, %rsp
+	.cfi_offset 3, -24
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	lock addq	$1, __gcov0._ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_(%rip)
+	.loc 9 1224 24
+	movq	-24(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv
+	lock addq	$1, 8+__gcov0._ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_(%rip)
+	.loc 9 1224 27
+	movq	(%rax), %rbx
+	.loc 9 1224 40
+	movq	-32(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv
+	.loc 9 1224 27
+	movq	(%rax), %rax
+	.loc 9 1224 41
+	cmpq	%rax, %rbx
+	sete	%al
+	lock addq	$1, 16+__gcov0._ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_(%rip)
+	.loc 9 1224 44
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2941:
+	.size	_ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_, .-_ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_
+	.section	.text._ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_,"axG",@progbits,_ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_,comdat
+	.weak	_ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_
+	.type	_ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_, @function
+_ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_:
+.LFB2942:
+	.loc 9 1330 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	subq	$24, %rsp
+	.cfi_offset 3, -24
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	lock addq	$1, __gcov0._ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_(%rip)
+	.loc 9 1333 24
+	movq	-24(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv
+	lock addq	$1, 8+__gcov0._ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_(%rip)
+	.loc 9 1333 27
+	movq	(%rax), %rbx
+	.loc 9 1333 39
+	movq	-32(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv
+	.loc 9 1333 27
+	movq	(%rax), %rax
+	movq	%rbx, %rdx
+	subq	%rax, %rdx
+	.loc 9 1333 40
+	movq	%rdx, %rax
+	sarq	$3, %rax
+	lock addq	$1, 16+__gcov0._ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_(%rip)
+	.loc 9 1333 43
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE2942:
+	.size	_ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_, .-_ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_
+	.section	.text._ZNSaImEC2Ev,"axG",@progbits,_ZNSaImEC5Ev,comdat
+	.align 2
+	.weak	_ZNSaImEC2Ev
+	.type	_ZNSaImEC2Ev, @function
+_ZNSaImEC2Ev:
+.LFB3065:
+	.loc 5 156 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSaImEC2Ev(%rip)
+.LBB14:
+	.loc 5 156 28
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt15__new_allocatorImEC2Ev
+	lock addq	$1, 8+__gcov0._ZNSaImEC2Ev(%rip)
+.LBE14:
+	.loc 5 156 30
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3065:
+	.size	_ZNSaImEC2Ev, .-_ZNSaImEC2Ev
+	.weak	_ZNSaImEC1Ev
+	.set	_ZNSaImEC1Ev,_ZNSaImEC2Ev
+	.section	.text._ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC2Ev,"axG",@progbits,_ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC5Ev,comdat
+	.align 2
+	.weak	_ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC2Ev
+	.type	_ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC2Ev, @function
+_ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC2Ev:
+.LFB3068:
+	.loc 3 99 2
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC2Ev(%rip)
+.LBB15:
+	.loc 3 100 4
+	movq	-8(%rbp), %rax
+	movq	$0, (%rax)
+	.loc 3 100 16
+	movq	-8(%rbp), %rax
+	movq	$0, 8(%rax)
+	.loc 3 100 29
+	movq	-8(%rbp), %rax
+	movq	$0, 16(%rax)
+.LBE15:
+	.loc 3 101 4
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3068:
+	.size	_ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC2Ev, .-_ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC2Ev
+	.weak	_ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC1Ev
+	.set	_ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC1Ev,_ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC2Ev
+	.section	.text._ZNSt15__new_allocatorImED2Ev,"axG",@progbits,_ZNSt15__new_allocatorImED5Ev,comdat
+	.align 2
+	.weak	_ZNSt15__new_allocatorImED2Ev
+	.type	_ZNSt15__new_allocatorImED2Ev, @function
+_ZNSt15__new_allocatorImED2Ev:
+.LFB3071:
+	.file 10 "/usr/include/c++/12/bits/new_allocator.h"
+	.loc 10 90 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt15__new_allocatorImED2Ev(%rip)
+	.loc 10 90 37
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3071:
+	.size	_ZNSt15__new_allocatorImED2Ev, .-_ZNSt15__new_allocatorImED2Ev
+	.weak	_ZNSt15__new_allocatorImED1Ev
+	.set	_ZNSt15__new_allocatorImED1Ev,_ZNSt15__new_allocatorImED2Ev
+	.section	.text._ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm,"axG",@progbits,_ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm,comdat
+	.align 2
+	.weak	_ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm
+	.type	_ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm, @function
+_ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm:
+.LFB3073:
+	.loc 3 383 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm(%rip)
+	.loc 3 386 2
+	cmpq	$0, -16(%rbp)
+	je	.L80
+	lock addq	$1, 8+__gcov0._ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm(%rip)
+	.loc 3 387 20
+	movq	-8(%rbp), %rax
+	.loc 3 387 19
+	movq	-24(%rbp), %rdx
+	movq	-16(%rbp), %rcx
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm
+	lock addq	$1, 16+__gcov0._ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm(%rip)
+.L80:
+	.loc 3 388 7
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3073:
+	.size	_ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm, .-_ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm
+	.section	.text._ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv,"axG",@progbits,_ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv,comdat
+	.align 2
+	.weak	_ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv
+	.type	_ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv, @function
+_ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv:
+.LFB3074:
+	.loc 3 298 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv(%rip)
+	.loc 3 299 22
+	movq	-8(%rbp), %rax
+	.loc 3 299 31
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3074:
+	.size	_ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv, .-_ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv
+	.section	.text._ZSt8_DestroyIPmmEvT_S1_RSaIT0_E,"axG",@progbits,_ZSt8_DestroyIPmmEvT_S1_RSaIT0_E,comdat
+	.weak	_ZSt8_DestroyIPmmEvT_S1_RSaIT0_E
+	.type	_ZSt8_DestroyIPmmEvT_S1_RSaIT0_E, @function
+_ZSt8_DestroyIPmmEvT_S1_RSaIT0_E:
+.LFB3075:
+	.file 11 "/usr/include/c++/12/bits/alloc_traits.h"
+	.loc 11 847 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	lock addq	$1, __gcov0._ZSt8_DestroyIPmmEvT_S1_RSaIT0_E(%rip)
+	.loc 11 850 15
+	movq	-16(%rbp), %rdx
+	movq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt8_DestroyIPmEvT_S1_
+	lock addq	$1, 8+__gcov0._ZSt8_DestroyIPmmEvT_S1_RSaIT0_E(%rip)
+	.loc 11 851 5
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3075:
+	.size	_ZSt8_DestroyIPmmEvT_S1_RSaIT0_E, .-_ZSt8_DestroyIPmmEvT_S1_RSaIT0_E
+	.section	.text._ZSt11__equal_auxIPKcPcEbT_S3_T0_,"axG",@progbits,_ZSt11__equal_auxIPKcPcEbT_S3_T0_,comdat
+	.weak	_ZSt11__equal_auxIPKcPcEbT_S3_T0_
+	.type	_ZSt11__equal_auxIPKcPcEbT_S3_T0_, @function
+_ZSt11__equal_auxIPKcPcEbT_S3_T0_:
+.LFB3076:
+	.loc 7 1216 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r12
+	pushq	%rbx
+	subq	$32, %rsp
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	movq	%rdx, -40(%rbp)
+	lock addq	$1, __gcov0._ZSt11__equal_auxIPKcPcEbT_S3_T0_(%rip)
+	.loc 7 1218 31
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt12__niter_baseIPcET_S1_
+	movq	%rax, %r12
+	lock addq	$1, 8+__gcov0._ZSt11__equal_auxIPKcPcEbT_S3_T0_(%rip)
+	movq	-32(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt12__niter_baseIPKcET_S2_
+	movq	%rax, %rbx
+	lock addq	$1, 16+__gcov0._ZSt11__equal_auxIPKcPcEbT_S3_T0_(%rip)
+	movq	-24(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt12__niter_baseIPKcET_S2_
+	lock addq	$1, 24+__gcov0._ZSt11__equal_auxIPKcPcEbT_S3_T0_(%rip)
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt12__equal_aux1IPKcPcEbT_S3_T0_
+	.loc 7 1220 38
+	nop
+	lock addq	$1, 32+__gcov0._ZSt11__equal_auxIPKcPcEbT_S3_T0_(%rip)
+	.loc 7 1221 5
+	addq	$32, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3076:
+	.size	_ZSt11__equal_auxIPKcPcEbT_S3_T0_, .-_ZSt11__equal_auxIPKcPcEbT_S3_T0_
+	.section	.text._ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_,"axG",@progbits,_ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_,comdat
+	.weak	_ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_
+	.type	_ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_, @function
+_ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_:
+.LFB3079:
+	.loc 11 511 2
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	lock addq	$1, __gcov0._ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_(%rip)
+	.loc 11 516 17
+	movq	-24(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE
+	movq	%rax, %rdx
+	lock addq	$1, 8+__gcov0._ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_(%rip)
+	movq	-16(%rbp), %rcx
+	movq	-8(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_
+	lock addq	$1, 16+__gcov0._ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_(%rip)
+	.loc 11 520 2
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3079:
+	.size	_ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_, .-_ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_
+	.section	.text._ZNSt6vectorImSaImEE3endEv,"axG",@progbits,_ZNSt6vectorImSaImEE3endEv,comdat
+	.align 2
+	.weak	_ZNSt6vectorImSaImEE3endEv
+	.type	_ZNSt6vectorImSaImEE3endEv, @function
+_ZNSt6vectorImSaImEE3endEv:
+.LFB3080:
+	.loc 3 888 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	lock addq	$1, __gcov0._ZNSt6vectorImSaImEE3endEv(%rip)
+	.loc 3 889 39
+	movq	-24(%rbp), %rax
+	leaq	8(%rax), %rdx
+	.loc 3 889 16
+	leaq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC1ERKS1_
+	lock addq	$1, 8+__gcov0._ZNSt6vectorImSaImEE3endEv(%rip)
+	.loc 3 889 48
+	movq	-8(%rbp), %rax
+	.loc 3 889 51
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3080:
+	.size	_ZNSt6vectorImSaImEE3endEv, .-_ZNSt6vectorImSaImEE3endEv
+	.section	.rodata
+.LC14:
+	.string	"vector::_M_realloc_insert"
+	.section	.text._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_,"axG",@progbits,_ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_,comdat
+	.align 2
+	.weak	_ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_
+	.type	_ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_, @function
+_ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_:
+.LFB3081:
+	.file 12 "/usr/include/c++/12/bits/vector.tcc"
+	.loc 12 439 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	subq	$104, %rsp
+	.cfi_offset 3, -24
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -88(%rbp)
+	movq	%rsi, -96(%rbp)
+	movq	%rdx, -104(%rbp)
+	lock addq	$1, __gcov0._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_(%rip)
+	.loc 12 449 14
+	movq	-88(%rbp), %rax
+	leaq	.LC14(%rip), %rdx
+	movl	$1, %esi
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorImSaImEE12_M_check_lenEmPKc
+	lock addq	$1, 8+__gcov0._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_(%rip)
+	movq	%rax, -24(%rbp)
+	.loc 12 450 15
+	movq	-88(%rbp), %rax
+	movq	(%rax), %rax
+	movq	%rax, -32(%rbp)
+	.loc 12 451 15
+	movq	-88(%rbp), %rax
+	movq	8(%rax), %rax
+	movq	%rax, -40(%rbp)
+	.loc 12 452 58
+	movq	-88(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt6vectorImSaImEE5beginEv
+	movq	%rax, -72(%rbp)
+	lock addq	$1, 16+__gcov0._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_(%rip)
+	.loc 12 452 51
+	leaq	-72(%rbp), %rdx
+	leaq	-96(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_
+	lock addq	$1, 24+__gcov0._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_(%rip)
+	.loc 12 452 23
+	movq	%rax, -48(%rbp)
+	.loc 12 453 44
+	movq	-88(%rbp), %rax
+	movq	-24(%rbp), %rdx
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseImSaImEE11_M_allocateEm
+	lock addq	$1, 32+__gcov0._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_(%rip)
+	movq	%rax, -56(%rbp)
+	.loc 12 454 15
+	movq	-56(%rbp), %rax
+	movq	%rax, -64(%rbp)
+	.loc 12 462 28
+	movq	-104(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE
+	movq	%rax, %rdx
+	lock addq	$1, 40+__gcov0._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_(%rip)
+	.loc 12 463 20
+	movq	-48(%rbp), %rax
+	leaq	0(,%rax,8), %rcx
+	.loc 12 462 28
+	movq	-56(%rbp), %rax
+	addq	%rax, %rcx
+	.loc 12 462 35
+	movq	-88(%rbp), %rax
+	.loc 12 462 28
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_
+	lock addq	$1, 48+__gcov0._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_(%rip)
+	.loc 12 469 17
+	movq	$0, -64(%rbp)
+	.loc 12 475 39
+	movq	-88(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv
+	movq	%rax, %rbx
+	lock addq	$1, 56+__gcov0._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_(%rip)
+	.loc 12 474 63
+	leaq	-96(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv
+	lock addq	$1, 64+__gcov0._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_(%rip)
+	.loc 12 474 34
+	movq	(%rax), %rsi
+	movq	-56(%rbp), %rdx
+	movq	-32(%rbp), %rax
+	movq	%rbx, %rcx
+	movq	%rax, %rdi
+	call	_ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_
+	movq	%rax, -64(%rbp)
+	lock addq	$1, 72+__gcov0._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_(%rip)
+	.loc 12 477 8
+	addq	$8, -64(%rbp)
+	.loc 12 480 40
+	movq	-88(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv
+	movq	%rax, %rbx
+	lock addq	$1, 80+__gcov0._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_(%rip)
+	.loc 12 479 50
+	leaq	-96(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv
+	lock addq	$1, 88+__gcov0._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_(%rip)
+	.loc 12 479 34
+	movq	(%rax), %rax
+	movq	-64(%rbp), %rdx
+	movq	-40(%rbp), %rsi
+	movq	%rbx, %rcx
+	movq	%rax, %rdi
+	call	_ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_
+	movq	%rax, -64(%rbp)
+	lock addq	$1, 96+__gcov0._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_(%rip)
+	.loc 12 513 20
+	movq	-88(%rbp), %rax
+	.loc 12 514 21
+	movq	-88(%rbp), %rdx
+	movq	16(%rdx), %rdx
+	.loc 12 514 39
+	subq	-32(%rbp), %rdx
+	sarq	$3, %rdx
+	.loc 12 513 20
+	movq	-32(%rbp), %rcx
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm
+	lock addq	$1, 104+__gcov0._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_(%rip)
+	.loc 12 515 30
+	movq	-88(%rbp), %rax
+	movq	-56(%rbp), %rdx
+	movq	%rdx, (%rax)
+	.loc 12 516 31
+	movq	-88(%rbp), %rax
+	movq	-64(%rbp), %rdx
+	movq	%rdx, 8(%rax)
+	.loc 12 517 53
+	movq	-24(%rbp), %rax
+	leaq	0(,%rax,8), %rdx
+	movq	-56(%rbp), %rax
+	addq	%rax, %rdx
+	.loc 12 517 39
+	movq	-88(%rbp), %rax
+	movq	%rdx, 16(%rax)
+	.loc 12 518 5
+	nop
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3081:
+	.size	_ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_, .-_ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_
+	.section	.text._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC2ERKS2_,"axG",@progbits,_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC5ERKS2_,comdat
+	.align 2
+	.weak	_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC2ERKS2_
+	.type	_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC2ERKS2_, @function
+_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC2ERKS2_:
+.LFB3086:
+	.loc 9 1072 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC2ERKS2_(%rip)
+.LBB16:
+	.loc 9 1073 9
+	movq	-16(%rbp), %rax
+	movq	(%rax), %rdx
+	movq	-8(%rbp), %rax
+	movq	%rdx, (%rax)
+.LBE16:
+	.loc 9 1073 27
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3086:
+	.size	_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC2ERKS2_, .-_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC2ERKS2_
+	.weak	_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC1ERKS2_
+	.set	_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC1ERKS2_,_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC2ERKS2_
+	.text
+	.type	_ZN9__gnu_cxx5__ops15__iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EENS0_14_Iter_comp_valIT_EES8_, @function
+_ZN9__gnu_cxx5__ops15__iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EENS0_14_Iter_comp_valIT_EES8_:
+.LFB3088:
+	.file 13 "/usr/include/c++/12/bits/predefined_ops.h"
+	.loc 13 202 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	lock addq	$1, __gcov0._ZN9__gnu_cxx5__ops15__iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EENS0_14_Iter_comp_valIT_EES8_(%rip)
+	.loc 13 203 48
+	leaq	-24(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt4moveIRZNK9simulator13result_reader10find_chunkEjRNS0_12result_chunkEEUlmjE_EONSt16remove_referenceIT_E4typeEOS7_
+	lock addq	$1, 8+__gcov0._ZN9__gnu_cxx5__ops15__iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EENS0_14_Iter_comp_valIT_EES8_(%rip)
+	.loc 13 203 14
+	movq	(%rax), %rdx
+	leaq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EC1ES6_
+	.loc 13 203 56
+	movq	-8(%rbp), %rax
+	lock addq	$1, 16+__gcov0._ZN9__gnu_cxx5__ops15__iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EENS0_14_Iter_comp_valIT_EES8_(%rip)
+	.loc 13 203 59
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3088:
+	.size	_ZN9__gnu_cxx5__ops15__iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EENS0_14_Iter_comp_valIT_EES8_, .-_ZN9__gnu_cxx5__ops15__iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EENS0_14_Iter_comp_valIT_EES8_
+	.type	_ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_, @function
+_ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_:
+.LFB3089:
+	.loc 7 1450 5
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA3089
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$64, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -40(%rbp)
+	movq	%rsi, -48(%rbp)
+	movq	%rdx, -56(%rbp)
+	movq	%rcx, -64(%rbp)
+	lock addq	$1, __gcov0._ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_(%rip)
+	.loc 7 1456 42
+	movq	-48(%rbp), %rdx
+	movq	-40(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+.LEHB7:
+	call	_ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_
+.LEHE7:
+	lock addq	$1, 8+__gcov0._ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_(%rip)
+	movq	%rax, -8(%rbp)
+	.loc 7 1458 7
+	jmp	.L94
+.L97:
+	lock addq	$1, 56+__gcov0._ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_(%rip)
+.LBB17:
+	.loc 7 1460 18
+	movq	-8(%rbp), %rax
+	sarq	%rax
+	movq	%rax, -16(%rbp)
+	.loc 7 1461 21
+	movq	-40(%rbp), %rax
+	movq	%rax, -24(%rbp)
+	.loc 7 1462 16
+	movq	-16(%rbp), %rdx
+	leaq	-24(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+.LEHB8:
+	call	_ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_
+.LEHE8:
+	lock addq	$1, 24+__gcov0._ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_(%rip)
+	.loc 7 1463 14
+	movq	-56(%rbp), %rdx
+	movq	-24(%rbp), %rcx
+	leaq	-64(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EclINS_17__normal_iteratorIPKmSt6vectorImSaImEEEEKjEEbT_RT0_
+	lock addq	$1, 32+__gcov0._ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_(%rip)
+	.loc 7 1463 4
+	testb	%al, %al
+	je	.L95
+	.loc 7 1465 8
+	movq	-24(%rbp), %rax
+	movq	%rax, -40(%rbp)
+	.loc 7 1466 8
+	leaq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEv
+	lock addq	$1, 40+__gcov0._ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_(%rip)
+	.loc 7 1467 22
+	movq	-8(%rbp), %rax
+	subq	-16(%rbp), %rax
+	.loc 7 1467 14
+	subq	$1, %rax
+	movq	%rax, -8(%rbp)
+	jmp	.L94
+.L95:
+	.loc 7 1470 12
+	movq	-16(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	lock addq	$1, 48+__gcov0._ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_(%rip)
+.L94:
+.LBE17:
+	.loc 7 1458 20
+	cmpq	$0, -8(%rbp)
+	jg	.L97
+	.loc 7 1472 14
+	movq	-40(%rbp), %rax
+	jmp	.L101
+.L100:
+	lock addq	$1, 16+__gcov0._ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_(%rip)
+	movq	%rax, %rdi
+.LEHB9:
+	call	_Unwind_Resume@PLT
+.LEHE9:
+.L101:
+	.loc 7 1473 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3089:
+	.section	.gcc_except_table
+.LLSDA3089:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE3089-.LLSDACSB3089
+.LLSDACSB3089:
+	.uleb128 .LEHB7-.LFB3089
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB8-.LFB3089
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 .L100-.LFB3089
+	.uleb128 0
+	.uleb128 .LEHB9-.LFB3089
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE3089:
+	.text
+	.size	_ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_, .-_ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_
+	.section	.text._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv,"axG",@progbits,_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv,comdat
+	.align 2
+	.weak	_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv
+	.type	_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv, @function
+_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv:
+.LFB3090:
+	.loc 9 1158 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv(%rip)
+	.loc 9 1159 16
+	movq	-8(%rbp), %rax
+	.loc 9 1159 28
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3090:
+	.size	_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv, .-_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv
+	.section	.text._ZNSt15__new_allocatorImEC2Ev,"axG",@progbits,_ZNSt15__new_allocatorImEC5Ev,comdat
+	.align 2
+	.weak	_ZNSt15__new_allocatorImEC2Ev
+	.type	_ZNSt15__new_allocatorImEC2Ev, @function
+_ZNSt15__new_allocatorImEC2Ev:
+.LFB3166:
+	.loc 10 80 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt15__new_allocatorImEC2Ev(%rip)
+	.loc 10 80 36
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3166:
+	.size	_ZNSt15__new_allocatorImEC2Ev, .-_ZNSt15__new_allocatorImEC2Ev
+	.weak	_ZNSt15__new_allocatorImEC1Ev
+	.set	_ZNSt15__new_allocatorImEC1Ev,_ZNSt15__new_allocatorImEC2Ev
+	.section	.text._ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm,"axG",@progbits,_ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm,comdat
+	.weak	_ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm
+	.type	_ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm, @function
+_ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm:
+.LFB3168:
+	.loc 11 495 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	lock addq	$1, __gcov0._ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm(%rip)
+	.loc 11 496 23
+	movq	-24(%rbp), %rdx
+	movq	-16(%rbp), %rcx
+	movq	-8(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt15__new_allocatorImE10deallocateEPmm
+	lock addq	$1, 8+__gcov0._ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm(%rip)
+	.loc 11 496 35
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3168:
+	.size	_ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm, .-_ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm
+	.section	.text._ZSt8_DestroyIPmEvT_S1_,"axG",@progbits,_ZSt8_DestroyIPmEvT_S1_,comdat
+	.weak	_ZSt8_DestroyIPmEvT_S1_
+	.type	_ZSt8_DestroyIPmEvT_S1_, @function
+_ZSt8_DestroyIPmEvT_S1_:
+.LFB3169:
+	.file 14 "/usr/include/c++/12/bits/stl_construct.h"
+	.loc 14 182 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZSt8_DestroyIPmEvT_S1_(%rip)
+	.loc 14 196 11
+	movq	-16(%rbp), %rdx
+	movq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt12_Destroy_auxILb1EE9__destroyIPmEEvT_S3_
+	lock addq	$1, 8+__gcov0._ZSt8_DestroyIPmEvT_S1_(%rip)
+	.loc 14 197 5
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3169:
+	.size	_ZSt8_DestroyIPmEvT_S1_, .-_ZSt8_DestroyIPmEvT_S1_
+	.section	.text._ZSt12__niter_baseIPKcET_S2_,"axG",@progbits,_ZSt12__niter_baseIPKcET_S2_,comdat
+	.weak	_ZSt12__niter_baseIPKcET_S2_
+	.type	_ZSt12__niter_baseIPKcET_S2_, @function
+_ZSt12__niter_baseIPKcET_S2_:
+.LFB3170:
+	.loc 7 313 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZSt12__niter_baseIPKcET_S2_(%rip)
+	.loc 7 315 14
+	movq	-8(%rbp), %rax
+	.loc 7 315 20
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3170:
+	.size	_ZSt12__niter_baseIPKcET_S2_, .-_ZSt12__niter_baseIPKcET_S2_
+	.section	.text._ZSt12__niter_baseIPcET_S1_,"axG",@progbits,_ZSt12__niter_baseIPcET_S1_,comdat
+	.weak	_ZSt12__niter_baseIPcET_S1_
+	.type	_ZSt12__niter_baseIPcET_S1_, @function
+_ZSt12__niter_baseIPcET_S1_:
+.LFB3171:
+	.loc 7 313 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZSt12__niter_baseIPcET_S1_(%rip)
+	.loc 7 315 14
+	movq	-8(%rbp), %rax
+	.loc 7 315 20
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3171:
+	.size	_ZSt12__niter_baseIPcET_S1_, .-_ZSt12__niter_baseIPcET_S1_
+	.section	.text._ZSt12__equal_aux1IPKcPcEbT_S3_T0_,"axG",@progbits,_ZSt12__equal_aux1IPKcPcEbT_S3_T0_,comdat
+	.weak	_ZSt12__equal_aux1IPKcPcEbT_S3_T0_
+	.type	_ZSt12__equal_aux1IPKcPcEbT_S3_T0_, @function
+_ZSt12__equal_aux1IPKcPcEbT_S3_T0_:
+.LFB3172:
+	.loc 7 1204 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$48, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	movq	%rdx, -40(%rbp)
+	lock addq	$1, __gcov0._ZSt12__equal_aux1IPKcPcEbT_S3_T0_(%rip)
+	.loc 7 1207 18
+	movb	$1, -1(%rbp)
+	.loc 7 1210 43
+	movq	-40(%rbp), %rdx
+	movq	-32(%rbp), %rcx
+	movq	-24(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_
+	lock addq	$1, 8+__gcov0._ZSt12__equal_aux1IPKcPcEbT_S3_T0_(%rip)
+	.loc 7 1211 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3172:
+	.size	_ZSt12__equal_aux1IPKcPcEbT_S3_T0_, .-_ZSt12__equal_aux1IPKcPcEbT_S3_T0_
+	.section	.text._ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE,"axG",@progbits,_ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE,comdat
+	.weak	_ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE
+	.type	_ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE, @function
+_ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE:
+.LFB3173:
+	.file 15 "/usr/include/c++/12/bits/move.h"
+	.loc 15 77 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE(%rip)
+	.loc 15 78 36
+	movq	-8(%rbp), %rax
+	.loc 15 78 39
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3173:
+	.size	_ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE, .-_ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE
+	.section	.text._ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_,"axG",@progbits,_ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_,comdat
+	.align 2
+	.weak	_ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_
+	.type	_ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_, @function
+_ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_:
+.LFB3174:
+	.loc 10 173 2
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	subq	$40, %rsp
+	.cfi_offset 3, -24
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	movq	%rdx, -40(%rbp)
+	lock addq	$1, __gcov0._ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_(%rip)
+	.loc 10 175 10
+	movq	-32(%rbp), %rax
+	.loc 10 175 4
+	movq	%rax, %rsi
+	movl	$8, %edi
+	call	_ZnwmPv
+	movq	%rax, %rbx
+	lock addq	$1, 8+__gcov0._ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_(%rip)
+	.loc 10 175 46
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE
+	lock addq	$1, 16+__gcov0._ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_(%rip)
+	.loc 10 175 4
+	movq	(%rax), %rax
+	movq	%rax, (%rbx)
+	.loc 10 175 60
+	nop
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3174:
+	.size	_ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_, .-_ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_
+	.section	.text._ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC2ERKS1_,"axG",@progbits,_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC5ERKS1_,comdat
+	.align 2
+	.weak	_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC2ERKS1_
+	.type	_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC2ERKS1_, @function
+_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC2ERKS1_:
+.LFB3176:
+	.loc 9 1072 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC2ERKS1_(%rip)
+.LBB18:
+	.loc 9 1073 9
+	movq	-16(%rbp), %rax
+	movq	(%rax), %rdx
+	movq	-8(%rbp), %rax
+	movq	%rdx, (%rax)
+.LBE18:
+	.loc 9 1073 27
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3176:
+	.size	_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC2ERKS1_, .-_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC2ERKS1_
+	.weak	_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC1ERKS1_
+	.set	_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC1ERKS1_,_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC2ERKS1_
+	.section	.text._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc,"axG",@progbits,_ZNKSt6vectorImSaImEE12_M_check_lenEmPKc,comdat
+	.align 2
+	.weak	_ZNKSt6vectorImSaImEE12_M_check_lenEmPKc
+	.type	_ZNKSt6vectorImSaImEE12_M_check_lenEmPKc, @function
+_ZNKSt6vectorImSaImEE12_M_check_lenEmPKc:
+.LFB3178:
+	.loc 3 1891 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	subq	$56, %rsp
+	.cfi_offset 3, -24
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -40(%rbp)
+	movq	%rsi, -48(%rbp)
+	movq	%rdx, -56(%rbp)
+	lock addq	$1, __gcov0._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc(%rip)
+	.loc 3 1893 14
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorImSaImEE8max_sizeEv
+	movq	%rax, %rbx
+	lock addq	$1, 8+__gcov0._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc(%rip)
+	.loc 3 1893 23
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorImSaImEE4sizeEv
+	.loc 3 1893 17
+	subq	%rax, %rbx
+	movq	%rbx, %rdx
+	.loc 3 1893 26
+	movq	-48(%rbp), %rax
+	cmpq	%rax, %rdx
+	setb	%al
+	.loc 3 1893 2
+	testb	%al, %al
+	je	.L118
+	lock addq	$1, 16+__gcov0._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc(%rip)
+	.loc 3 1894 24
+	movq	-56(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.L118:
+	lock addq	$1, 24+__gcov0._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc(%rip)
+	.loc 3 1896 30
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorImSaImEE4sizeEv
+	movq	%rax, %rbx
+	lock addq	$1, 32+__gcov0._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc(%rip)
+	.loc 3 1896 50
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorImSaImEE4sizeEv
+	lock addq	$1, 40+__gcov0._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc(%rip)
+	movq	%rax, -32(%rbp)
+	.loc 3 1896 45
+	leaq	-48(%rbp), %rdx
+	leaq	-32(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt3maxImERKT_S2_S2_
+	lock addq	$1, 48+__gcov0._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc(%rip)
+	.loc 3 1896 33
+	movq	(%rax), %rax
+	.loc 3 1896 18
+	addq	%rbx, %rax
+	movq	%rax, -24(%rbp)
+	.loc 3 1897 22
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorImSaImEE4sizeEv
+	lock addq	$1, 56+__gcov0._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc(%rip)
+	.loc 3 1897 48
+	cmpq	%rax, -24(%rbp)
+	jb	.L119
+	lock addq	$1, 64+__gcov0._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc(%rip)
+	.loc 3 1897 44 discriminator 2
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorImSaImEE8max_sizeEv
+	lock addq	$1, 72+__gcov0._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc(%rip)
+	.loc 3 1897 25 discriminator 2
+	cmpq	-24(%rbp), %rax
+	jnb	.L120
+.L119:
+	.loc 3 1897 58 discriminator 3
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt6vectorImSaImEE8max_sizeEv
+	.loc 3 1897 48 discriminator 3
+	jmp	.L121
+.L120:
+	.loc 3 1897 48 is_stmt 0 discriminator 4
+	movq	-24(%rbp), %rax
+	lock addq	$1, 80+__gcov0._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc(%rip)
+.L121:
+	.loc 3 1897 63 is_stmt 1 discriminator 6
+	nop
+	lock addq	$1, 88+__gcov0._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc(%rip)
+	.loc 3 1898 7 discriminator 6
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3178:
+	.size	_ZNKSt6vectorImSaImEE12_M_check_lenEmPKc, .-_ZNKSt6vectorImSaImEE12_M_check_lenEmPKc
+	.section	.text._ZNSt6vectorImSaImEE5beginEv,"axG",@progbits,_ZNSt6vectorImSaImEE5beginEv,comdat
+	.align 2
+	.weak	_ZNSt6vectorImSaImEE5beginEv
+	.type	_ZNSt6vectorImSaImEE5beginEv, @function
+_ZNSt6vectorImSaImEE5beginEv:
+.LFB3179:
+	.loc 3 868 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	lock addq	$1, __gcov0._ZNSt6vectorImSaImEE5beginEv(%rip)
+	.loc 3 869 39
+	movq	-24(%rbp), %rdx
+	.loc 3 869 16
+	leaq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC1ERKS1_
+	lock addq	$1, 8+__gcov0._ZNSt6vectorImSaImEE5beginEv(%rip)
+	.loc 3 869 47
+	movq	-8(%rbp), %rax
+	.loc 3 869 50
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3179:
+	.size	_ZNSt6vectorImSaImEE5beginEv, .-_ZNSt6vectorImSaImEE5beginEv
+	.section	.text._ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_,"axG",@progbits,_ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_,comdat
+	.weak	_ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_
+	.type	_ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_, @function
+_ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_:
+.LFB3180:
+	.loc 9 1330 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	subq	$24, %rsp
+	.cfi_offset 3, -24
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	lock addq	$1, __gcov0._ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_(%rip)
+	.loc 9 1333 24
+	movq	-24(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv
+	lock addq	$1, 8+__gcov0._ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_(%rip)
+	.loc 9 1333 27
+	movq	(%rax), %rbx
+	.loc 9 1333 39
+	movq	-32(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv
+	.loc 9 1333 27
+	movq	(%rax), %rax
+	movq	%rbx, %rdx
+	subq	%rax, %rdx
+	.loc 9 1333 40
+	movq	%rdx, %rax
+	sarq	$3, %rax
+	lock addq	$1, 16+__gcov0._ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_(%rip)
+	.loc 9 1333 43
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3180:
+	.size	_ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_, .-_ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_
+	.section	.text._ZNSt12_Vector_baseImSaImEE11_M_allocateEm,"axG",@progbits,_ZNSt12_Vector_baseImSaImEE11_M_allocateEm,comdat
+	.align 2
+	.weak	_ZNSt12_Vector_baseImSaImEE11_M_allocateEm
+	.type	_ZNSt12_Vector_baseImSaImEE11_M_allocateEm, @function
+_ZNSt12_Vector_baseImSaImEE11_M_allocateEm:
+.LFB3181:
+	.loc 3 375 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Vector_baseImSaImEE11_M_allocateEm(%rip)
+	.loc 3 378 18
+	cmpq	$0, -16(%rbp)
+	je	.L128
+	lock addq	$1, 8+__gcov0._ZNSt12_Vector_baseImSaImEE11_M_allocateEm(%rip)
+	.loc 3 378 34 discriminator 1
+	movq	-8(%rbp), %rax
+	.loc 3 378 33 discriminator 1
+	movq	-16(%rbp), %rdx
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt16allocator_traitsISaImEE8allocateERS0_m
+	lock addq	$1, 16+__gcov0._ZNSt12_Vector_baseImSaImEE11_M_allocateEm(%rip)
+	.loc 3 378 58 discriminator 1
+	jmp	.L130
+.L128:
+	.loc 3 378 18 discriminator 2
+	movl	$0, %eax
+.L130:
+	.loc 3 379 7 discriminator 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3181:
+	.size	_ZNSt12_Vector_baseImSaImEE11_M_allocateEm, .-_ZNSt12_Vector_baseImSaImEE11_M_allocateEm
+	.section	.text._ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_,"axG",@progbits,_ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_,comdat
+	.weak	_ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_
+	.type	_ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_, @function
+_ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_:
+.LFB3182:
+	.loc 3 499 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	movq	%rcx, -32(%rbp)
+	lock addq	$1, __gcov0._ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_(%rip)
+	.loc 3 504 26
+	movq	-32(%rbp), %rcx
+	movq	-24(%rbp), %rdx
+	movq	-16(%rbp), %rsi
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_
+	.loc 3 504 61
+	nop
+	lock addq	$1, 8+__gcov0._ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_(%rip)
+	.loc 3 509 7
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3182:
+	.size	_ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_, .-_ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_
+	.section	.text._ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv,"axG",@progbits,_ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv,comdat
+	.align 2
+	.weak	_ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv
+	.type	_ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv, @function
+_ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv:
+.LFB3183:
+	.loc 9 1158 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv(%rip)
+	.loc 9 1159 16
+	movq	-8(%rbp), %rax
+	.loc 9 1159 28
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3183:
+	.size	_ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv, .-_ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv
+	.text
+	.type	_ZSt4moveIRZNK9simulator13result_reader10find_chunkEjRNS0_12result_chunkEEUlmjE_EONSt16remove_referenceIT_E4typeEOS7_, @function
+_ZSt4moveIRZNK9simulator13result_reader10find_chunkEjRNS0_12result_chunkEEUlmjE_EONSt16remove_referenceIT_E4typeEOS7_:
+.LFB3185:
+	.loc 15 104 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZSt4moveIRZNK9simulator13result_reader10find_chunkEjRNS0_12result_chunkEEUlmjE_EONSt16remove_referenceIT_E4typeEOS7_(%rip)
+	.loc 15 105 74
+	movq	-8(%rbp), %rax
+	.loc 15 105 77
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3185:
+	.size	_ZSt4moveIRZNK9simulator13result_reader10find_chunkEjRNS0_12result_chunkEEUlmjE_EONSt16remove_referenceIT_E4typeEOS7_, .-_ZSt4moveIRZNK9simulator13result_reader10find_chunkEjRNS0_12result_chunkEEUlmjE_EONSt16remove_referenceIT_E4typeEOS7_
+	.align 2
+	.type	_ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EC2ES6_, @function
+_ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EC2ES6_:
+.LFB3187:
+	.loc 13 174 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EC2ES6_(%rip)
+.LBB19:
+	.loc 13 175 21
+	leaq	-16(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt4moveIRZNK9simulator13result_reader10find_chunkEjRNS0_12result_chunkEEUlmjE_EONSt16remove_referenceIT_E4typeEOS7_
+	lock addq	$1, 8+__gcov0._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EC2ES6_(%rip)
+	.loc 13 175 4
+	movq	-8(%rbp), %rdx
+	movq	(%rax), %rax
+	movq	%rax, (%rdx)
+.LBE19:
+	.loc 13 176 9
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3187:
+	.size	_ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EC2ES6_, .-_ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EC2ES6_
+	.set	_ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EC1ES6_,_ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EC2ES6_
+	.section	.text._ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_,"axG",@progbits,_ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_,comdat
+	.weak	_ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_
+	.type	_ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_, @function
+_ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_:
+.LFB3189:
+	.file 16 "/usr/include/c++/12/bits/stl_iterator_base_funcs.h"
+	.loc 16 147 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_(%rip)
+	.loc 16 151 33
+	leaq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_
+	lock addq	$1, 8+__gcov0._ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_(%rip)
+	.loc 16 150 29
+	movq	-16(%rbp), %rdx
+	movq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag
+	.loc 16 151 42
+	nop
+	lock addq	$1, 16+__gcov0._ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_(%rip)
+	.loc 16 152 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3189:
+	.size	_ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_, .-_ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_
+	.section	.text._ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_,"axG",@progbits,_ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_,comdat
+	.weak	_ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_
+	.type	_ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_, @function
+_ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_:
+.LFB3190:
+	.loc 16 218 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	lock addq	$1, __gcov0._ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_(%rip)
+	.loc 16 221 65
+	movq	-32(%rbp), %rax
+	movq	%rax, -8(%rbp)
+	.loc 16 222 56
+	movq	-24(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_
+	lock addq	$1, 8+__gcov0._ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_(%rip)
+	.loc 16 222 21
+	movq	-8(%rbp), %rdx
+	movq	-24(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag
+	lock addq	$1, 16+__gcov0._ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_(%rip)
+	.loc 16 223 5
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3190:
+	.size	_ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_, .-_ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_
+	.text
+	.align 2
+	.type	_ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EclINS_17__normal_iteratorIPKmSt6vectorImSaImEEEEKjEEbT_RT0_, @function
+_ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EclINS_17__normal_iteratorIPKmSt6vectorImSaImEEEEKjEEbT_RT0_:
+.LFB3191:
+	.loc 13 195 2
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r12
+	pushq	%rbx
+	subq	$32, %rsp
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	movq	%rdx, -40(%rbp)
+	lock addq	$1, __gcov0._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EclINS_17__normal_iteratorIPKmSt6vectorImSaImEEEEKjEEbT_RT0_(%rip)
+	.loc 13 196 23
+	movq	-24(%rbp), %rbx
+	movq	-40(%rbp), %rax
+	movl	(%rax), %r12d
+	.loc 13 196 24
+	leaq	-32(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEdeEv
+	lock addq	$1, 8+__gcov0._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EclINS_17__normal_iteratorIPKmSt6vectorImSaImEEEEKjEEbT_RT0_(%rip)
+	.loc 13 196 23
+	movq	(%rax), %rax
+	movl	%r12d, %edx
+	movq	%rax, %rsi
+	movq	%rbx, %rdi
+	call	_ZZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkEENKUlmjE_clEmj
+	.loc 13 196 37
+	nop
+	lock addq	$1, 16+__gcov0._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EclINS_17__normal_iteratorIPKmSt6vectorImSaImEEEEKjEEbT_RT0_(%rip)
+	.loc 13 196 40
+	addq	$32, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3191:
+	.size	_ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EclINS_17__normal_iteratorIPKmSt6vectorImSaImEEEEKjEEbT_RT0_, .-_ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EclINS_17__normal_iteratorIPKmSt6vectorImSaImEEEEKjEEbT_RT0_
+	.section	.text._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEv,"axG",@progbits,_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEv,comdat
+	.align 2
+	.weak	_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEv
+	.type	_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEv, @function
+_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEv:
+.LFB3192:
+	.loc 9 1105 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEv(%rip)
+	.loc 9 1107 4
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rax
+	.loc 9 1107 2
+	leaq	8(%rax), %rdx
+	movq	-8(%rbp), %rax
+	movq	%rdx, (%rax)
+	.loc 9 1108 10
+	movq	-8(%rbp), %rax
+	.loc 9 1109 7
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3192:
+	.size	_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEv, .-_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEv
+	.section	.text._ZNSt15__new_allocatorImE10deallocateEPmm,"axG",@progbits,_ZNSt15__new_allocatorImE10deallocateEPmm,comdat
+	.align 2
+	.weak	_ZNSt15__new_allocatorImE10deallocateEPmm
+	.type	_ZNSt15__new_allocatorImE10deallocateEPmm, @function
+_ZNSt15__new_allocatorImE10deallocateEPmm:
+.LFB3244:
+	.loc 10 142 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	lock addq	$1, __gcov0._ZNSt15__new_allocatorImE10deallocateEPmm(%rip)
+	.loc 10 158 19
+	movq	-24(%rbp), %rax
+	leaq	0(,%rax,8), %rdx
+	movq	-16(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZdlPvm@PLT
+	lock addq	$1, 8+__gcov0._ZNSt15__new_allocatorImE10deallocateEPmm(%rip)
+	.loc 10 159 7
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3244:
+	.size	_ZNSt15__new_allocatorImE10deallocateEPmm, .-_ZNSt15__new_allocatorImE10deallocateEPmm
+	.section	.text._ZNSt12_Destroy_auxILb1EE9__destroyIPmEEvT_S3_,"axG",@progbits,_ZNSt12_Destroy_auxILb1EE9__destroyIPmEEvT_S3_,comdat
+	.weak	_ZNSt12_Destroy_auxILb1EE9__destroyIPmEEvT_S3_
+	.type	_ZNSt12_Destroy_auxILb1EE9__destroyIPmEEvT_S3_, @function
+_ZNSt12_Destroy_auxILb1EE9__destroyIPmEEvT_S3_:
+.LFB3245:
+	.loc 14 172 9
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZNSt12_Destroy_auxILb1EE9__destroyIPmEEvT_S3_(%rip)
+	.loc 14 172 57
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3245:
+	.size	_ZNSt12_Destroy_auxILb1EE9__destroyIPmEEvT_S3_, .-_ZNSt12_Destroy_auxILb1EE9__destroyIPmEEvT_S3_
+	.section	.text._ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_,"axG",@progbits,_ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_,comdat
+	.weak	_ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_
+	.type	_ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_, @function
+_ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_:
+.LFB3246:
+	.loc 7 1173 2
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$48, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	movq	%rdx, -40(%rbp)
+	lock addq	$1, __gcov0._ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_(%rip)
+.LBB20:
+	.loc 7 1175 38
+	movq	-32(%rbp), %rax
+	subq	-24(%rbp), %rax
+	.loc 7 1175 21
+	movq	%rax, -8(%rbp)
+	.loc 7 1175 4
+	cmpq	$0, -8(%rbp)
+	je	.L149
+	lock addq	$1, 8+__gcov0._ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_(%rip)
+	.loc 7 1176 27
+	movq	-8(%rbp), %rdx
+	movq	-40(%rbp), %rcx
+	movq	-24(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt8__memcmpIccEiPKT_PKT0_m
+	lock addq	$1, 16+__gcov0._ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_(%rip)
+	.loc 7 1176 53
+	testl	%eax, %eax
+	sete	%al
+	jmp	.L150
+.L149:
+.LBE20:
+	.loc 7 1177 11
+	movl	$1, %eax
+.L150:
+	.loc 7 1178 2
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3246:
+	.size	_ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_, .-_ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_
+	.section	.text._ZNKSt6vectorImSaImEE8max_sizeEv,"axG",@progbits,_ZNKSt6vectorImSaImEE8max_sizeEv,comdat
+	.align 2
+	.weak	_ZNKSt6vectorImSaImEE8max_sizeEv
+	.type	_ZNKSt6vectorImSaImEE8max_sizeEv, @function
+_ZNKSt6vectorImSaImEE8max_sizeEv:
+.LFB3247:
+	.loc 3 993 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNKSt6vectorImSaImEE8max_sizeEv(%rip)
+	.loc 3 994 47
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv
+	lock addq	$1, 8+__gcov0._ZNKSt6vectorImSaImEE8max_sizeEv(%rip)
+	.loc 3 994 27
+	movq	%rax, %rdi
+	call	_ZNSt6vectorImSaImEE11_S_max_sizeERKS0_
+	.loc 3 994 49
+	nop
+	lock addq	$1, 16+__gcov0._ZNKSt6vectorImSaImEE8max_sizeEv(%rip)
+	.loc 3 994 52
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3247:
+	.size	_ZNKSt6vectorImSaImEE8max_sizeEv, .-_ZNKSt6vectorImSaImEE8max_sizeEv
+	.section	.text._ZSt3maxImERKT_S2_S2_,"axG",@progbits,_ZSt3maxImERKT_S2_S2_,comdat
+	.weak	_ZSt3maxImERKT_S2_S2_
+	.type	_ZSt3maxImERKT_S2_S2_, @function
+_ZSt3maxImERKT_S2_S2_:
+.LFB3248:
+	.loc 7 254 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZSt3maxImERKT_S2_S2_(%rip)
+	.loc 7 259 15
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rdx
+	movq	-16(%rbp), %rax
+	movq	(%rax), %rax
+	.loc 7 259 7
+	cmpq	%rax, %rdx
+	jnb	.L154
+	lock addq	$1, 8+__gcov0._ZSt3maxImERKT_S2_S2_(%rip)
+	.loc 7 260 9
+	movq	-16(%rbp), %rax
+	jmp	.L155
+.L154:
+	.loc 7 261 14
+	movq	-8(%rbp), %rax
+.L155:
+	.loc 7 262 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3248:
+	.size	_ZSt3maxImERKT_S2_S2_, .-_ZSt3maxImERKT_S2_S2_
+	.section	.text._ZNSt16allocator_traitsISaImEE8allocateERS0_m,"axG",@progbits,_ZNSt16allocator_traitsISaImEE8allocateERS0_m,comdat
+	.weak	_ZNSt16allocator_traitsISaImEE8allocateERS0_m
+	.type	_ZNSt16allocator_traitsISaImEE8allocateERS0_m, @function
+_ZNSt16allocator_traitsISaImEE8allocateERS0_m:
+.LFB3249:
+	.loc 11 463 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZNSt16allocator_traitsISaImEE8allocateERS0_m(%rip)
+	.loc 11 464 28
+	movq	-16(%rbp), %rcx
+	movq	-8(%rbp), %rax
+	movl	$0, %edx
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	_ZNSt15__new_allocatorImE8allocateEmPKv
+	lock addq	$1, 8+__gcov0._ZNSt16allocator_traitsISaImEE8allocateERS0_m(%rip)
+	.loc 11 464 35
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3249:
+	.size	_ZNSt16allocator_traitsISaImEE8allocateERS0_m, .-_ZNSt16allocator_traitsISaImEE8allocateERS0_m
+	.section	.text._ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_,"axG",@progbits,_ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_,comdat
+	.weak	_ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_
+	.type	_ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_, @function
+_ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_:
+.LFB3250:
+	.file 17 "/usr/include/c++/12/bits/stl_uninitialized.h"
+	.loc 17 1127 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r12
+	pushq	%rbx
+	subq	$32, %rsp
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	movq	%rdx, -40(%rbp)
+	movq	%rcx, -48(%rbp)
+	lock addq	$1, __gcov0._ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_(%rip)
+	.loc 17 1133 33
+	movq	-40(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt12__niter_baseIPmET_S1_
+	movq	%rax, %r12
+	lock addq	$1, 8+__gcov0._ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_(%rip)
+	movq	-32(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt12__niter_baseIPmET_S1_
+	movq	%rax, %rbx
+	lock addq	$1, 16+__gcov0._ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_(%rip)
+	movq	-24(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZSt12__niter_baseIPmET_S1_
+	movq	%rax, %rdi
+	lock addq	$1, 24+__gcov0._ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_(%rip)
+	movq	-48(%rbp), %rax
+	movq	%rax, %rcx
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	call	_ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E
+	.loc 17 1135 42
+	nop
+	lock addq	$1, 32+__gcov0._ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_(%rip)
+	.loc 17 1136 5
+	addq	$32, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3250:
+	.size	_ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_, .-_ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_
+	.section	.text._ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_,"axG",@progbits,_ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_,comdat
+	.weak	_ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_
+	.type	_ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_, @function
+_ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_:
+.LFB3252:
+	.file 18 "/usr/include/c++/12/bits/stl_iterator_base_types.h"
+	.loc 18 238 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_(%rip)
+	.loc 18 239 65
+	nop
+	.loc 18 239 68
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3252:
+	.size	_ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_, .-_ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_
+	.section	.text._ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag,"axG",@progbits,_ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag,comdat
+	.weak	_ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag
+	.type	_ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag, @function
+_ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag:
+.LFB3253:
+	.loc 16 99 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag(%rip)
+	.loc 16 105 21
+	leaq	-8(%rbp), %rdx
+	leaq	-16(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_
+	.loc 16 105 23
+	nop
+	lock addq	$1, 8+__gcov0._ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag(%rip)
+	.loc 16 106 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3253:
+	.size	_ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag, .-_ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag
+	.section	.text._ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag,"axG",@progbits,_ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag,comdat
+	.weak	_ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag
+	.type	_ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag, @function
+_ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag:
+.LFB3254:
+	.loc 16 183 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag(%rip)
+	.loc 16 194 6
+	movq	-16(%rbp), %rdx
+	movq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEpLEl
+	lock addq	$1, 8+__gcov0._ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag(%rip)
+	.loc 16 195 5
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3254:
+	.size	_ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag, .-_ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag
+	.section	.text._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEdeEv,"axG",@progbits,_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEdeEv,comdat
+	.align 2
+	.weak	_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEdeEv
+	.type	_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEdeEv, @function
+_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEdeEv:
+.LFB3255:
+	.loc 9 1095 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEdeEv(%rip)
+	.loc 9 1096 17
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rax
+	.loc 9 1096 29
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3255:
+	.size	_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEdeEv, .-_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEdeEv
+	.section	.text._ZSt8__memcmpIccEiPKT_PKT0_m,"axG",@progbits,_ZSt8__memcmpIccEiPKT_PKT0_m,comdat
+	.weak	_ZSt8__memcmpIccEiPKT_PKT0_m
+	.type	_ZSt8__memcmpIccEiPKT_PKT0_m, @function
+_ZSt8__memcmpIccEiPKT_PKT0_m:
+.LFB3276:
+	.loc 7 90 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	lock addq	$1, __gcov0._ZSt8__memcmpIccEiPKT_PKT0_m(%rip)
+	.loc 7 105 25
+	movq	-24(%rbp), %rdx
+	movq	-16(%rbp), %rcx
+	movq	-8(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	memcmp@PLT
+	.loc 7 106 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3276:
+	.size	_ZSt8__memcmpIccEiPKT_PKT0_m, .-_ZSt8__memcmpIccEiPKT_PKT0_m
+	.section	.text._ZNSt6vectorImSaImEE11_S_max_sizeERKS0_,"axG",@progbits,_ZNSt6vectorImSaImEE11_S_max_sizeERKS0_,comdat
+	.weak	_ZNSt6vectorImSaImEE11_S_max_sizeERKS0_
+	.type	_ZNSt6vectorImSaImEE11_S_max_sizeERKS0_, @function
+_ZNSt6vectorImSaImEE11_S_max_sizeERKS0_:
+.LFB3277:
+	.loc 3 1911 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	lock addq	$1, __gcov0._ZNSt6vectorImSaImEE11_S_max_sizeERKS0_(%rip)
+	.loc 3 1916 15
+	movabsq	$1152921504606846975, %rax
+	movq	%rax, -8(%rbp)
+	.loc 3 1918 51
+	movq	-24(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNSt16allocator_traitsISaImEE8max_sizeERKS0_
+	lock addq	$1, 8+__gcov0._ZNSt6vectorImSaImEE11_S_max_sizeERKS0_(%rip)
+	.loc 3 1918 15
+	movq	%rax, -16(%rbp)
+	.loc 3 1919 19
+	leaq	-16(%rbp), %rdx
+	leaq	-8(%rbp), %rax
+	movq	%rdx, %rsi
+	movq	%rax, %rdi
+	call	_ZSt3minImERKT_S2_S2_
+	.loc 3 1919 41
+	movq	(%rax), %rax
+	lock addq	$1, 16+__gcov0._ZNSt6vectorImSaImEE11_S_max_sizeERKS0_(%rip)
+	.loc 3 1920 7
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3277:
+	.size	_ZNSt6vectorImSaImEE11_S_max_sizeERKS0_, .-_ZNSt6vectorImSaImEE11_S_max_sizeERKS0_
+	.section	.text._ZNKSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv,"axG",@progbits,_ZNKSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv,comdat
+	.align 2
+	.weak	_ZNKSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv
+	.type	_ZNKSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv, @function
+_ZNKSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv:
+.LFB3278:
+	.loc 3 303 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNKSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv(%rip)
+	.loc 3 304 22
+	movq	-8(%rbp), %rax
+	.loc 3 304 31
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3278:
+	.size	_ZNKSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv, .-_ZNKSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv
+	.section	.text._ZNSt15__new_allocatorImE8allocateEmPKv,"axG",@progbits,_ZNSt15__new_allocatorImE8allocateEmPKv,comdat
+	.align 2
+	.weak	_ZNSt15__new_allocatorImE8allocateEmPKv
+	.type	_ZNSt15__new_allocatorImE8allocateEmPKv, @function
+_ZNSt15__new_allocatorImE8allocateEmPKv:
+.LFB3279:
+	.loc 10 112 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$32, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	lock addq	$1, __gcov0._ZNSt15__new_allocatorImE8allocateEmPKv(%rip)
+	.loc 10 120 46
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt15__new_allocatorImE11_M_max_sizeEv
+	lock addq	$1, 8+__gcov0._ZNSt15__new_allocatorImE8allocateEmPKv(%rip)
+	.loc 10 120 27
+	cmpq	-16(%rbp), %rax
+	setb	%al
+	.loc 10 120 22
+	movzbl	%al, %eax
+	testq	%rax, %rax
+	setne	%al
+	.loc 10 120 2
+	testb	%al, %al
+	je	.L174
+	.loc 10 124 6
+	movabsq	$2305843009213693951, %rax
+	cmpq	-16(%rbp), %rax
+	jnb	.L175
+	lock addq	$1, 16+__gcov0._ZNSt15__new_allocatorImE8allocateEmPKv(%rip)
+	.loc 10 125 41
+	call	_ZSt28__throw_bad_array_new_lengthv@PLT
+.L175:
+	lock addq	$1, 24+__gcov0._ZNSt15__new_allocatorImE8allocateEmPKv(%rip)
+	.loc 10 126 28
+	call	_ZSt17__throw_bad_allocv@PLT
+.L174:
+	.loc 10 137 41
+	movq	-16(%rbp), %rax
+	salq	$3, %rax
+	movq	%rax, %rdi
+	call	_Znwm@PLT
+	lock addq	$1, 32+__gcov0._ZNSt15__new_allocatorImE8allocateEmPKv(%rip)
+	.loc 10 137 60
+	nop
+	.loc 10 138 7
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3279:
+	.size	_ZNSt15__new_allocatorImE8allocateEmPKv, .-_ZNSt15__new_allocatorImE8allocateEmPKv
+	.section	.text._ZSt12__niter_baseIPmET_S1_,"axG",@progbits,_ZSt12__niter_baseIPmET_S1_,comdat
+	.weak	_ZSt12__niter_baseIPmET_S1_
+	.type	_ZSt12__niter_baseIPmET_S1_, @function
+_ZSt12__niter_baseIPmET_S1_:
+.LFB3280:
+	.loc 7 313 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZSt12__niter_baseIPmET_S1_(%rip)
+	.loc 7 315 14
+	movq	-8(%rbp), %rax
+	.loc 7 315 20
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3280:
+	.size	_ZSt12__niter_baseIPmET_S1_, .-_ZSt12__niter_baseIPmET_S1_
+	.section	.text._ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E,"axG",@progbits,_ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E,comdat
+	.weak	_ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E
+	.type	_ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E, @function
+_ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E:
+.LFB3281:
+	.loc 17 1100 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$48, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -24(%rbp)
+	movq	%rsi, -32(%rbp)
+	movq	%rdx, -40(%rbp)
+	movq	%rcx, -48(%rbp)
+	lock addq	$1, __gcov0._ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E(%rip)
+	.loc 17 1104 34
+	movq	-32(%rbp), %rax
+	subq	-24(%rbp), %rax
+	.loc 17 1104 17
+	sarq	$3, %rax
+	movq	%rax, -8(%rbp)
+	.loc 17 1105 7
+	cmpq	$0, -8(%rbp)
+	jle	.L180
+	lock addq	$1, 8+__gcov0._ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E(%rip)
+	.loc 17 1117 41
+	movq	-8(%rbp), %rax
+	.loc 17 1117 21
+	leaq	0(,%rax,8), %rdx
+	movq	-24(%rbp), %rcx
+	movq	-40(%rbp), %rax
+	movq	%rcx, %rsi
+	movq	%rax, %rdi
+	call	memmove@PLT
+.L180:
+	.loc 17 1119 25
+	movq	-8(%rbp), %rax
+	.loc 17 1119 23
+	leaq	0(,%rax,8), %rdx
+	.loc 17 1119 25
+	movq	-40(%rbp), %rax
+	addq	%rdx, %rax
+	.loc 17 1120 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3281:
+	.size	_ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E, .-_ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E
+	.section	.text._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEpLEl,"axG",@progbits,_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEpLEl,comdat
+	.align 2
+	.weak	_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEpLEl
+	.type	_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEpLEl, @function
+_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEpLEl:
+.LFB3283:
+	.loc 9 1138 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEpLEl(%rip)
+	.loc 9 1139 9
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rax
+	.loc 9 1139 23
+	movq	-16(%rbp), %rdx
+	.loc 9 1139 20
+	salq	$3, %rdx
+	addq	%rax, %rdx
+	movq	-8(%rbp), %rax
+	movq	%rdx, (%rax)
+	.loc 9 1139 36
+	movq	-8(%rbp), %rax
+	.loc 9 1139 42
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3283:
+	.size	_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEpLEl, .-_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEpLEl
+	.section	.text._ZNSt16allocator_traitsISaImEE8max_sizeERKS0_,"axG",@progbits,_ZNSt16allocator_traitsISaImEE8max_sizeERKS0_,comdat
+	.weak	_ZNSt16allocator_traitsISaImEE8max_sizeERKS0_
+	.type	_ZNSt16allocator_traitsISaImEE8max_sizeERKS0_, @function
+_ZNSt16allocator_traitsISaImEE8max_sizeERKS0_:
+.LFB3292:
+	.loc 11 547 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNSt16allocator_traitsISaImEE8max_sizeERKS0_(%rip)
+	.loc 11 550 21
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt15__new_allocatorImE8max_sizeEv
+	.loc 11 550 22
+	nop
+	lock addq	$1, 8+__gcov0._ZNSt16allocator_traitsISaImEE8max_sizeERKS0_(%rip)
+	.loc 11 554 7
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3292:
+	.size	_ZNSt16allocator_traitsISaImEE8max_sizeERKS0_, .-_ZNSt16allocator_traitsISaImEE8max_sizeERKS0_
+	.section	.text._ZSt3minImERKT_S2_S2_,"axG",@progbits,_ZSt3minImERKT_S2_S2_,comdat
+	.weak	_ZSt3minImERKT_S2_S2_
+	.type	_ZSt3minImERKT_S2_S2_, @function
+_ZSt3minImERKT_S2_S2_:
+.LFB3293:
+	.loc 7 230 5
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	lock addq	$1, __gcov0._ZSt3minImERKT_S2_S2_(%rip)
+	.loc 7 235 15
+	movq	-16(%rbp), %rax
+	movq	(%rax), %rdx
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rax
+	.loc 7 235 7
+	cmpq	%rax, %rdx
+	jnb	.L187
+	lock addq	$1, 8+__gcov0._ZSt3minImERKT_S2_S2_(%rip)
+	.loc 7 236 9
+	movq	-16(%rbp), %rax
+	jmp	.L188
+.L187:
+	.loc 7 237 14
+	movq	-8(%rbp), %rax
+.L188:
+	.loc 7 238 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3293:
+	.size	_ZSt3minImERKT_S2_S2_, .-_ZSt3minImERKT_S2_S2_
+	.section	.text._ZNKSt15__new_allocatorImE11_M_max_sizeEv,"axG",@progbits,_ZNKSt15__new_allocatorImE11_M_max_sizeEv,comdat
+	.align 2
+	.weak	_ZNKSt15__new_allocatorImE11_M_max_sizeEv
+	.type	_ZNKSt15__new_allocatorImE11_M_max_sizeEv, @function
+_ZNKSt15__new_allocatorImE11_M_max_sizeEv:
+.LFB3294:
+	.loc 10 210 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$8, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNKSt15__new_allocatorImE11_M_max_sizeEv(%rip)
+	.loc 10 213 54
+	movabsq	$1152921504606846975, %rax
+	.loc 10 217 7
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3294:
+	.size	_ZNKSt15__new_allocatorImE11_M_max_sizeEv, .-_ZNKSt15__new_allocatorImE11_M_max_sizeEv
+	.section	.text._ZNKSt15__new_allocatorImE8max_sizeEv,"axG",@progbits,_ZNKSt15__new_allocatorImE8max_sizeEv,comdat
+	.align 2
+	.weak	_ZNKSt15__new_allocatorImE8max_sizeEv
+	.type	_ZNKSt15__new_allocatorImE8max_sizeEv, @function
+_ZNKSt15__new_allocatorImE8max_sizeEv:
+.LFB3298:
+	.loc 10 167 7
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	subq	$16, %rsp
+1:	call	*mcount@GOTPCREL(%rip)
+	movq	%rdi, -8(%rbp)
+	lock addq	$1, __gcov0._ZNKSt15__new_allocatorImE8max_sizeEv(%rip)
+	.loc 10 168 27
+	movq	-8(%rbp), %rax
+	movq	%rax, %rdi
+	call	_ZNKSt15__new_allocatorImE11_M_max_sizeEv
+	.loc 10 168 28
+	nop
+	lock addq	$1, 8+__gcov0._ZNKSt15__new_allocatorImE8max_sizeEv(%rip)
+	.loc 10 168 31
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3298:
+	.size	_ZNKSt15__new_allocatorImE8max_sizeEv, .-_ZNKSt15__new_allocatorImE8max_sizeEv
+	.local	__gcov0._ZNKSt15__new_allocatorImE8max_sizeEv
+	.comm	__gcov0._ZNKSt15__new_allocatorImE8max_sizeEv,16,16
+	.local	__gcov0._ZNKSt15__new_allocatorImE11_M_max_sizeEv
+	.comm	__gcov0._ZNKSt15__new_allocatorImE11_M_max_sizeEv,8,8
+	.local	__gcov0._ZSt3minImERKT_S2_S2_
+	.comm	__gcov0._ZSt3minImERKT_S2_S2_,16,16
+	.local	__gcov0._ZNSt16allocator_traitsISaImEE8max_sizeERKS0_
+	.comm	__gcov0._ZNSt16allocator_traitsISaImEE8max_sizeERKS0_,16,16
+	.local	__gcov0._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEpLEl
+	.comm	__gcov0._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEpLEl,8,8
+	.local	__gcov0._ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E
+	.comm	__gcov0._ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E,16,16
+	.local	__gcov0._ZSt12__niter_baseIPmET_S1_
+	.comm	__gcov0._ZSt12__niter_baseIPmET_S1_,8,8
+	.local	__gcov0._ZNSt15__new_allocatorImE8allocateEmPKv
+	.comm	__gcov0._ZNSt15__new_allocatorImE8allocateEmPKv,40,32
+	.local	__gcov0._ZNKSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv
+	.comm	__gcov0._ZNKSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv,8,8
+	.local	__gcov0._ZNSt6vectorImSaImEE11_S_max_sizeERKS0_
+	.comm	__gcov0._ZNSt6vectorImSaImEE11_S_max_sizeERKS0_,24,16
+	.local	__gcov0._ZSt8__memcmpIccEiPKT_PKT0_m
+	.comm	__gcov0._ZSt8__memcmpIccEiPKT_PKT0_m,8,8
+	.local	__gcov0._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEdeEv
+	.comm	__gcov0._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEdeEv,8,8
+	.local	__gcov0._ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag
+	.comm	__gcov0._ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag,16,16
+	.local	__gcov0._ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag
+	.comm	__gcov0._ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag,16,16
+	.local	__gcov0._ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_
+	.comm	__gcov0._ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_,8,8
+	.local	__gcov0._ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_
+	.comm	__gcov0._ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_,40,32
+	.local	__gcov0._ZNSt16allocator_traitsISaImEE8allocateERS0_m
+	.comm	__gcov0._ZNSt16allocator_traitsISaImEE8allocateERS0_m,16,16
+	.local	__gcov0._ZSt3maxImERKT_S2_S2_
+	.comm	__gcov0._ZSt3maxImERKT_S2_S2_,16,16
+	.local	__gcov0._ZNKSt6vectorImSaImEE8max_sizeEv
+	.comm	__gcov0._ZNKSt6vectorImSaImEE8max_sizeEv,24,16
+	.local	__gcov0._ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_
+	.comm	__gcov0._ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_,24,16
+	.local	__gcov0._ZNSt12_Destroy_auxILb1EE9__destroyIPmEEvT_S3_
+	.comm	__gcov0._ZNSt12_Destroy_auxILb1EE9__destroyIPmEEvT_S3_,8,8
+	.local	__gcov0._ZNSt15__new_allocatorImE10deallocateEPmm
+	.comm	__gcov0._ZNSt15__new_allocatorImE10deallocateEPmm,16,16
+	.local	__gcov0._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEv
+	.comm	__gcov0._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEv,8,8
+	.local	__gcov0._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EclINS_17__normal_iteratorIPKmSt6vectorImSaImEEEEKjEEbT_RT0_
+	.comm	__gcov0._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EclINS_17__normal_iteratorIPKmSt6vectorImSaImEEEEKjEEbT_RT0_,24,16
+	.local	__gcov0._ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_
+	.comm	__gcov0._ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_,24,16
+	.local	__gcov0._ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_
+	.comm	__gcov0._ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_,24,16
+	.local	__gcov0._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EC2ES6_
+	.comm	__gcov0._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EC2ES6_,16,16
+	.local	__gcov0._ZSt4moveIRZNK9simulator13result_reader10find_chunkEjRNS0_12result_chunkEEUlmjE_EONSt16remove_referenceIT_E4typeEOS7_
+	.comm	__gcov0._ZSt4moveIRZNK9simulator13result_reader10find_chunkEjRNS0_12result_chunkEEUlmjE_EONSt16remove_referenceIT_E4typeEOS7_,8,8
+	.local	__gcov0._ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv
+	.comm	__gcov0._ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv,8,8
+	.local	__gcov0._ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_
+	.comm	__gcov0._ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_,16,16
+	.local	__gcov0._ZNSt12_Vector_baseImSaImEE11_M_allocateEm
+	.comm	__gcov0._ZNSt12_Vector_baseImSaImEE11_M_allocateEm,24,16
+	.local	__gcov0._ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_
+	.comm	__gcov0._ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_,24,16
+	.local	__gcov0._ZNSt6vectorImSaImEE5beginEv
+	.comm	__gcov0._ZNSt6vectorImSaImEE5beginEv,16,16
+	.local	__gcov0._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc
+	.comm	__gcov0._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc,96,32
+	.local	__gcov0._ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC2ERKS1_
+	.comm	__gcov0._ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC2ERKS1_,8,8
+	.local	__gcov0._ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_
+	.comm	__gcov0._ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_,24,16
+	.local	__gcov0._ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE
+	.comm	__gcov0._ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE,8,8
+	.local	__gcov0._ZSt12__equal_aux1IPKcPcEbT_S3_T0_
+	.comm	__gcov0._ZSt12__equal_aux1IPKcPcEbT_S3_T0_,16,16
+	.local	__gcov0._ZSt12__niter_baseIPcET_S1_
+	.comm	__gcov0._ZSt12__niter_baseIPcET_S1_,8,8
+	.local	__gcov0._ZSt12__niter_baseIPKcET_S2_
+	.comm	__gcov0._ZSt12__niter_baseIPKcET_S2_,8,8
+	.local	__gcov0._ZSt8_DestroyIPmEvT_S1_
+	.comm	__gcov0._ZSt8_DestroyIPmEvT_S1_,16,16
+	.local	__gcov0._ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm
+	.comm	__gcov0._ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm,16,16
+	.local	__gcov0._ZNSt15__new_allocatorImEC2Ev
+	.comm	__gcov0._ZNSt15__new_allocatorImEC2Ev,8,8
+	.local	__gcov0._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv
+	.comm	__gcov0._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv,8,8
+	.local	__gcov0._ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_
+	.comm	__gcov0._ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_,64,32
+	.local	__gcov0._ZN9__gnu_cxx5__ops15__iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EENS0_14_Iter_comp_valIT_EES8_
+	.comm	__gcov0._ZN9__gnu_cxx5__ops15__iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EENS0_14_Iter_comp_valIT_EES8_,24,16
+	.local	__gcov0._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC2ERKS2_
+	.comm	__gcov0._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC2ERKS2_,8,8
+	.local	__gcov0._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_
+	.comm	__gcov0._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_,112,32
+	.local	__gcov0._ZNSt6vectorImSaImEE3endEv
+	.comm	__gcov0._ZNSt6vectorImSaImEE3endEv,16,16
+	.local	__gcov0._ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_
+	.comm	__gcov0._ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_,24,16
+	.local	__gcov0._ZSt11__equal_auxIPKcPcEbT_S3_T0_
+	.comm	__gcov0._ZSt11__equal_auxIPKcPcEbT_S3_T0_,40,32
+	.local	__gcov0._ZSt8_DestroyIPmmEvT_S1_RSaIT0_E
+	.comm	__gcov0._ZSt8_DestroyIPmmEvT_S1_RSaIT0_E,16,16
+	.local	__gcov0._ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv
+	.comm	__gcov0._ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv,8,8
+	.local	__gcov0._ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm
+	.comm	__gcov0._ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm,24,16
+	.local	__gcov0._ZNSt15__new_allocatorImED2Ev
+	.comm	__gcov0._ZNSt15__new_allocatorImED2Ev,8,8
+	.local	__gcov0._ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC2Ev
+	.comm	__gcov0._ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC2Ev,8,8
+	.local	__gcov0._ZNSaImEC2Ev
+	.comm	__gcov0._ZNSaImEC2Ev,16,16
+	.local	__gcov0._ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_
+	.comm	__gcov0._ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_,24,16
+	.local	__gcov0._ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_
+	.comm	__gcov0._ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_,24,16
+	.local	__gcov0._ZSt11lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjZNK9simulator13result_reader10find_chunkEjRNS8_12result_chunkEEUlmjE_ET_SD_SD_RKT0_T1_
+	.comm	__gcov0._ZSt11lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjZNK9simulator13result_reader10find_chunkEjRNS8_12result_chunkEEUlmjE_ET_SD_SD_RKT0_T1_,24,16
+	.local	__gcov0._ZNKSt6vectorImSaImEE3endEv
+	.comm	__gcov0._ZNKSt6vectorImSaImEE3endEv,16,16
+	.local	__gcov0._ZNKSt6vectorImSaImEE5beginEv
+	.comm	__gcov0._ZNKSt6vectorImSaImEE5beginEv,16,16
+	.local	__gcov0._ZNKSt6vectorImSaImEEixEm
+	.comm	__gcov0._ZNKSt6vectorImSaImEEixEm,8,8
+	.local	__gcov0._ZNKSt6vectorImSaImEE4sizeEv
+	.comm	__gcov0._ZNKSt6vectorImSaImEE4sizeEv,8,8
+	.local	__gcov0._ZNSt6vectorImSaImEE9push_backERKm
+	.comm	__gcov0._ZNSt6vectorImSaImEE9push_backERKm,40,32
+	.local	__gcov0._ZSt5equalIPKcPcEbT_S3_T0_
+	.comm	__gcov0._ZSt5equalIPKcPcEbT_S3_T0_,16,16
+	.local	__gcov0._ZSt3endIKcLm8EEPT_RAT0__S1_
+	.comm	__gcov0._ZSt3endIKcLm8EEPT_RAT0__S1_,8,8
+	.local	__gcov0._ZSt5beginIKcLm8EEPT_RAT0__S1_
+	.comm	__gcov0._ZSt5beginIKcLm8EEPT_RAT0__S1_,8,8
+	.local	__gcov0._ZNSt6vectorImSaImEED2Ev
+	.comm	__gcov0._ZNSt6vectorImSaImEED2Ev,32,32
+	.local	__gcov0._ZNSt12_Vector_baseImSaImEED2Ev
+	.comm	__gcov0._ZNSt12_Vector_baseImSaImEED2Ev,24,16
+	.local	__gcov0._ZNSaImED2Ev
+	.comm	__gcov0._ZNSaImED2Ev,16,16
+	.local	__gcov0._ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev
+	.comm	__gcov0._ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev,24,16
+	.local	__gcov0._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE
+	.comm	__gcov0._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE,88,32
+	.local	__gcov0._ZZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkEENKUlmjE_clEmj
+	.comm	__gcov0._ZZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkEENKUlmjE_clEmj,8,8
+	.local	__gcov0._ZNK9simulator13result_reader9get_chunkEm
+	.comm	__gcov0._ZNK9simulator13result_reader9get_chunkEm,32,32
+	.local	__gcov0._ZNK9simulator13result_reader17get_num_of_chunksEv
+	.comm	__gcov0._ZNK9simulator13result_reader17get_num_of_chunksEv,16,16
+	.local	__gcov0._ZN9simulator13result_readerD2Ev
+	.comm	__gcov0._ZN9simulator13result_readerD2Ev,24,16
+	.local	__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE
+	.comm	__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE,232,32
+	.local	__gcov0._ZNSt6vectorImSaImEEC2Ev
+	.comm	__gcov0._ZNSt6vectorImSaImEEC2Ev,16,16
+	.local	__gcov0._ZNSt12_Vector_baseImSaImEEC2Ev
+	.comm	__gcov0._ZNSt12_Vector_baseImSaImEEC2Ev,16,16
+	.local	__gcov0._ZNSt12_Vector_baseImSaImEE12_Vector_implD2Ev
+	.comm	__gcov0._ZNSt12_Vector_baseImSaImEE12_Vector_implD2Ev,16,16
+	.local	__gcov0._ZN9simulator21get_result_chunk_sizeEj
+	.comm	__gcov0._ZN9simulator21get_result_chunk_sizeEj,8,8
+	.local	__gcov0._ZnwmPv
+	.comm	__gcov0._ZnwmPv,8,8
+	.section	.data.rel.local,"aw"
+	.align 32
+	.type	__gcov_._ZNKSt15__new_allocatorImE8max_sizeEv, @object
+	.size	__gcov_._ZNKSt15__new_allocatorImE8max_sizeEv, 40
+__gcov_._ZNKSt15__new_allocatorImE8max_sizeEv:
+	.quad	.LPBX0
+	.long	830237847
+	.long	-456961394
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNKSt15__new_allocatorImE8max_sizeEv
+	.section	.rodata
+	.align 8
+.LC15:
+	.string	"/root/repo/build/debug/./src/main/result_reader.gcda"
+	.section	.data.rel,"aw"
+	.align 32
+	.type	.LPBX0, @object
+	.size	.LPBX0, 112
+.LPBX0:
+	.long	1110585898
+	.zero	4
+	.quad	0
+	.long	1228385795
+	.long	1460555131
+	.quad	.LC15
+	.quad	__gcov_merge_add
+	.quad	0
+	.quad	0
+	.quad	0
+	.quad	0
+	.quad	0
+	.quad	0
+	.quad	0
+	.long	83
+	.zero	4
+	.quad	.LPBX1
+	.section	.data.rel.local
+	.align 32
+	.type	__gcov_._ZNKSt15__new_allocatorImE11_M_max_sizeEv, @object
+	.size	__gcov_._ZNKSt15__new_allocatorImE11_M_max_sizeEv, 40
+__gcov_._ZNKSt15__new_allocatorImE11_M_max_sizeEv:
+	.quad	.LPBX0
+	.long	379590335
+	.long	1592336946
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNKSt15__new_allocatorImE11_M_max_sizeEv
+	.align 32
+	.type	__gcov_._ZSt3minImERKT_S2_S2_, @object
+	.size	__gcov_._ZSt3minImERKT_S2_S2_, 40
+__gcov_._ZSt3minImERKT_S2_S2_:
+	.quad	.LPBX0
+	.long	534093904
+	.long	827727607
+	.long	-1032003044
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt3minImERKT_S2_S2_
+	.align 32
+	.type	__gcov_._ZNSt16allocator_traitsISaImEE8max_sizeERKS0_, @object
+	.size	__gcov_._ZNSt16allocator_traitsISaImEE8max_sizeERKS0_, 40
+__gcov_._ZNSt16allocator_traitsISaImEE8max_sizeERKS0_:
+	.quad	.LPBX0
+	.long	494000838
+	.long	-1434555552
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt16allocator_traitsISaImEE8max_sizeERKS0_
+	.align 32
+	.type	__gcov_._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEpLEl, @object
+	.size	__gcov_._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEpLEl, 40
+__gcov_._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEpLEl:
+	.quad	.LPBX0
+	.long	320004009
+	.long	-889659418
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEpLEl
+	.align 32
+	.type	__gcov_._ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E, @object
+	.size	__gcov_._ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E, 40
+__gcov_._ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E:
+	.quad	.LPBX0
+	.long	1043500136
+	.long	-1589469204
+	.long	-1955494511
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E
+	.align 32
+	.type	__gcov_._ZSt12__niter_baseIPmET_S1_, @object
+	.size	__gcov_._ZSt12__niter_baseIPmET_S1_, 40
+__gcov_._ZSt12__niter_baseIPmET_S1_:
+	.quad	.LPBX0
+	.long	1774409838
+	.long	1743171225
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZSt12__niter_baseIPmET_S1_
+	.align 32
+	.type	__gcov_._ZNSt15__new_allocatorImE8allocateEmPKv, @object
+	.size	__gcov_._ZNSt15__new_allocatorImE8allocateEmPKv, 40
+__gcov_._ZNSt15__new_allocatorImE8allocateEmPKv:
+	.quad	.LPBX0
+	.long	1261954025
+	.long	1859550577
+	.long	-2004153047
+	.zero	4
+	.long	5
+	.zero	4
+	.quad	__gcov0._ZNSt15__new_allocatorImE8allocateEmPKv
+	.align 32
+	.type	__gcov_._ZNKSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv, @object
+	.size	__gcov_._ZNKSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv, 40
+__gcov_._ZNKSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv:
+	.quad	.LPBX0
+	.long	543483092
+	.long	543748641
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNKSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv
+	.align 32
+	.type	__gcov_._ZNSt6vectorImSaImEE11_S_max_sizeERKS0_, @object
+	.size	__gcov_._ZNSt6vectorImSaImEE11_S_max_sizeERKS0_, 40
+__gcov_._ZNSt6vectorImSaImEE11_S_max_sizeERKS0_:
+	.quad	.LPBX0
+	.long	1478438842
+	.long	-215456720
+	.long	-162248067
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZNSt6vectorImSaImEE11_S_max_sizeERKS0_
+	.align 32
+	.type	__gcov_._ZSt8__memcmpIccEiPKT_PKT0_m, @object
+	.size	__gcov_._ZSt8__memcmpIccEiPKT_PKT0_m, 40
+__gcov_._ZSt8__memcmpIccEiPKT_PKT0_m:
+	.quad	.LPBX0
+	.long	1971236877
+	.long	247929555
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZSt8__memcmpIccEiPKT_PKT0_m
+	.align 32
+	.type	__gcov_._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEdeEv, @object
+	.size	__gcov_._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEdeEv, 40
+__gcov_._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEdeEv:
+	.quad	.LPBX0
+	.long	548716496
+	.long	1944863216
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEdeEv
+	.align 32
+	.type	__gcov_._ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag, @object
+	.size	__gcov_._ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag, 40
+__gcov_._ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag:
+	.quad	.LPBX0
+	.long	179385180
+	.long	1128946887
+	.long	-191797997
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag
+	.align 32
+	.type	__gcov_._ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag, @object
+	.size	__gcov_._ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag, 40
+__gcov_._ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag:
+	.quad	.LPBX0
+	.long	930791612
+	.long	-1929345745
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag
+	.align 32
+	.type	__gcov_._ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_, @object
+	.size	__gcov_._ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_, 40
+__gcov_._ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_:
+	.quad	.LPBX0
+	.long	183899617
+	.long	452542104
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_
+	.align 32
+	.type	__gcov_._ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_, @object
+	.size	__gcov_._ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_, 40
+__gcov_._ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_:
+	.quad	.LPBX0
+	.long	1992709382
+	.long	-1381473634
+	.long	260709395
+	.zero	4
+	.long	5
+	.zero	4
+	.quad	__gcov0._ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_
+	.align 32
+	.type	__gcov_._ZNSt16allocator_traitsISaImEE8allocateERS0_m, @object
+	.size	__gcov_._ZNSt16allocator_traitsISaImEE8allocateERS0_m, 40
+__gcov_._ZNSt16allocator_traitsISaImEE8allocateERS0_m:
+	.quad	.LPBX0
+	.long	889834263
+	.long	-549421925
+	.long	2092124921
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt16allocator_traitsISaImEE8allocateERS0_m
+	.align 32
+	.type	__gcov_._ZSt3maxImERKT_S2_S2_, @object
+	.size	__gcov_._ZSt3maxImERKT_S2_S2_, 40
+__gcov_._ZSt3maxImERKT_S2_S2_:
+	.quad	.LPBX0
+	.long	1077455238
+	.long	-1803683750
+	.long	-1032003044
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt3maxImERKT_S2_S2_
+	.align 32
+	.type	__gcov_._ZNKSt6vectorImSaImEE8max_sizeEv, @object
+	.size	__gcov_._ZNKSt6vectorImSaImEE8max_sizeEv, 40
+__gcov_._ZNKSt6vectorImSaImEE8max_sizeEv:
+	.quad	.LPBX0
+	.long	1997232062
+	.long	-162554573
+	.long	-206267174
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZNKSt6vectorImSaImEE8max_sizeEv
+	.align 32
+	.type	__gcov_._ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_, @object
+	.size	__gcov_._ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_, 40
+__gcov_._ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_:
+	.quad	.LPBX0
+	.long	1161871203
+	.long	-1605514358
+	.long	-238344677
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_
+	.align 32
+	.type	__gcov_._ZNSt12_Destroy_auxILb1EE9__destroyIPmEEvT_S3_, @object
+	.size	__gcov_._ZNSt12_Destroy_auxILb1EE9__destroyIPmEEvT_S3_, 40
+__gcov_._ZNSt12_Destroy_auxILb1EE9__destroyIPmEEvT_S3_:
+	.quad	.LPBX0
+	.long	1231538242
+	.long	-1082449638
+	.long	-1540324424
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNSt12_Destroy_auxILb1EE9__destroyIPmEEvT_S3_
+	.align 32
+	.type	__gcov_._ZNSt15__new_allocatorImE10deallocateEPmm, @object
+	.size	__gcov_._ZNSt15__new_allocatorImE10deallocateEPmm, 40
+__gcov_._ZNSt15__new_allocatorImE10deallocateEPmm:
+	.quad	.LPBX0
+	.long	1474253695
+	.long	-1844956739
+	.long	-191797997
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt15__new_allocatorImE10deallocateEPmm
+	.align 32
+	.type	__gcov_._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEv, @object
+	.size	__gcov_._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEv, 40
+__gcov_._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEv:
+	.quad	.LPBX0
+	.long	823862970
+	.long	-2077446926
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEv
+	.align 32
+	.type	__gcov_._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EclINS_17__normal_iteratorIPKmSt6vectorImSaImEEEEKjEEbT_RT0_, @object
+	.size	__gcov_._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EclINS_17__normal_iteratorIPKmSt6vectorImSaImEEEEKjEEbT_RT0_, 40
+__gcov_._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EclINS_17__normal_iteratorIPKmSt6vectorImSaImEEEEKjEEbT_RT0_:
+	.quad	.LPBX0
+	.long	1580944955
+	.long	-1946156334
+	.long	-206267174
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EclINS_17__normal_iteratorIPKmSt6vectorImSaImEEEEKjEEbT_RT0_
+	.align 32
+	.type	__gcov_._ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_, @object
+	.size	__gcov_._ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_, 40
+__gcov_._ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_:
+	.quad	.LPBX0
+	.long	67517528
+	.long	-373394539
+	.long	-206267174
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_
+	.align 32
+	.type	__gcov_._ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_, @object
+	.size	__gcov_._ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_, 40
+__gcov_._ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_:
+	.quad	.LPBX0
+	.long	30285046
+	.long	1048119006
+	.long	-162248067
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_
+	.align 32
+	.type	__gcov_._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EC2ES6_, @object
+	.size	__gcov_._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EC2ES6_, 40
+__gcov_._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EC2ES6_:
+	.quad	.LPBX0
+	.long	460916161
+	.long	444230171
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EC2ES6_
+	.align 32
+	.type	__gcov_._ZSt4moveIRZNK9simulator13result_reader10find_chunkEjRNS0_12result_chunkEEUlmjE_EONSt16remove_referenceIT_E4typeEOS7_, @object
+	.size	__gcov_._ZSt4moveIRZNK9simulator13result_reader10find_chunkEjRNS0_12result_chunkEEUlmjE_EONSt16remove_referenceIT_E4typeEOS7_, 40
+__gcov_._ZSt4moveIRZNK9simulator13result_reader10find_chunkEjRNS0_12result_chunkEEUlmjE_EONSt16remove_referenceIT_E4typeEOS7_:
+	.quad	.LPBX0
+	.long	1585433947
+	.long	-1031529301
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZSt4moveIRZNK9simulator13result_reader10find_chunkEjRNS0_12result_chunkEEUlmjE_EONSt16remove_referenceIT_E4typeEOS7_
+	.align 32
+	.type	__gcov_._ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv, @object
+	.size	__gcov_._ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv, 40
+__gcov_._ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv:
+	.quad	.LPBX0
+	.long	677911863
+	.long	404032420
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv
+	.align 32
+	.type	__gcov_._ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_, @object
+	.size	__gcov_._ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_, 40
+__gcov_._ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_:
+	.quad	.LPBX0
+	.long	1981512264
+	.long	-1300323467
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_
+	.align 32
+	.type	__gcov_._ZNSt12_Vector_baseImSaImEE11_M_allocateEm, @object
+	.size	__gcov_._ZNSt12_Vector_baseImSaImEE11_M_allocateEm, 40
+__gcov_._ZNSt12_Vector_baseImSaImEE11_M_allocateEm:
+	.quad	.LPBX0
+	.long	2056771833
+	.long	-209921296
+	.long	1891682443
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZNSt12_Vector_baseImSaImEE11_M_allocateEm
+	.align 32
+	.type	__gcov_._ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_, @object
+	.size	__gcov_._ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_, 40
+__gcov_._ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_:
+	.quad	.LPBX0
+	.long	864796617
+	.long	-1858445009
+	.long	-162248067
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_
+	.align 32
+	.type	__gcov_._ZNSt6vectorImSaImEE5beginEv, @object
+	.size	__gcov_._ZNSt6vectorImSaImEE5beginEv, 40
+__gcov_._ZNSt6vectorImSaImEE5beginEv:
+	.quad	.LPBX0
+	.long	1293403934
+	.long	-1549009869
+	.long	2092124921
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt6vectorImSaImEE5beginEv
+	.align 32
+	.type	__gcov_._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc, @object
+	.size	__gcov_._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc, 40
+__gcov_._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc:
+	.quad	.LPBX0
+	.long	435786036
+	.long	725422259
+	.long	-284142522
+	.zero	4
+	.long	12
+	.zero	4
+	.quad	__gcov0._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc
+	.align 32
+	.type	__gcov_._ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC2ERKS1_, @object
+	.size	__gcov_._ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC2ERKS1_, 40
+__gcov_._ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC2ERKS1_:
+	.quad	.LPBX0
+	.long	1425076356
+	.long	-1294272471
+	.long	-1540324424
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC2ERKS1_
+	.align 32
+	.type	__gcov_._ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_, @object
+	.size	__gcov_._ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_, 40
+__gcov_._ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_:
+	.quad	.LPBX0
+	.long	1098471670
+	.long	1636215069
+	.long	-206267174
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_
+	.align 32
+	.type	__gcov_._ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE, @object
+	.size	__gcov_._ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE, 40
+__gcov_._ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE:
+	.quad	.LPBX0
+	.long	805507835
+	.long	858522255
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE
+	.align 32
+	.type	__gcov_._ZSt12__equal_aux1IPKcPcEbT_S3_T0_, @object
+	.size	__gcov_._ZSt12__equal_aux1IPKcPcEbT_S3_T0_, 40
+__gcov_._ZSt12__equal_aux1IPKcPcEbT_S3_T0_:
+	.quad	.LPBX0
+	.long	1960329882
+	.long	638547884
+	.long	2092124921
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt12__equal_aux1IPKcPcEbT_S3_T0_
+	.align 32
+	.type	__gcov_._ZSt12__niter_baseIPcET_S1_, @object
+	.size	__gcov_._ZSt12__niter_baseIPcET_S1_, 40
+__gcov_._ZSt12__niter_baseIPcET_S1_:
+	.quad	.LPBX0
+	.long	1615483483
+	.long	1852810412
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZSt12__niter_baseIPcET_S1_
+	.align 32
+	.type	__gcov_._ZSt12__niter_baseIPKcET_S2_, @object
+	.size	__gcov_._ZSt12__niter_baseIPKcET_S2_, 40
+__gcov_._ZSt12__niter_baseIPKcET_S2_:
+	.quad	.LPBX0
+	.long	1216066731
+	.long	-788274271
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZSt12__niter_baseIPKcET_S2_
+	.align 32
+	.type	__gcov_._ZSt8_DestroyIPmEvT_S1_, @object
+	.size	__gcov_._ZSt8_DestroyIPmEvT_S1_, 40
+__gcov_._ZSt8_DestroyIPmEvT_S1_:
+	.quad	.LPBX0
+	.long	1190928764
+	.long	-1702329593
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt8_DestroyIPmEvT_S1_
+	.align 32
+	.type	__gcov_._ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm, @object
+	.size	__gcov_._ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm, 40
+__gcov_._ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm:
+	.quad	.LPBX0
+	.long	362391757
+	.long	-1669122381
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm
+	.align 32
+	.type	__gcov_._ZNSt15__new_allocatorImEC2Ev, @object
+	.size	__gcov_._ZNSt15__new_allocatorImEC2Ev, 40
+__gcov_._ZNSt15__new_allocatorImEC2Ev:
+	.quad	.LPBX0
+	.long	1339618514
+	.long	-604750924
+	.long	-1540324424
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNSt15__new_allocatorImEC2Ev
+	.align 32
+	.type	__gcov_._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv, @object
+	.size	__gcov_._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv, 40
+__gcov_._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv:
+	.quad	.LPBX0
+	.long	482322507
+	.long	899372763
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv
+	.align 32
+	.type	__gcov_._ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_, @object
+	.size	__gcov_._ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_, 40
+__gcov_._ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_:
+	.quad	.LPBX0
+	.long	228099172
+	.long	-1317610844
+	.long	846375537
+	.zero	4
+	.long	8
+	.zero	4
+	.quad	__gcov0._ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_
+	.align 32
+	.type	__gcov_._ZN9__gnu_cxx5__ops15__iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EENS0_14_Iter_comp_valIT_EES8_, @object
+	.size	__gcov_._ZN9__gnu_cxx5__ops15__iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EENS0_14_Iter_comp_valIT_EES8_, 40
+__gcov_._ZN9__gnu_cxx5__ops15__iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EENS0_14_Iter_comp_valIT_EES8_:
+	.quad	.LPBX0
+	.long	1758072915
+	.long	689755877
+	.long	-162248067
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZN9__gnu_cxx5__ops15__iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EENS0_14_Iter_comp_valIT_EES8_
+	.align 32
+	.type	__gcov_._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC2ERKS2_, @object
+	.size	__gcov_._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC2ERKS2_, 40
+__gcov_._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC2ERKS2_:
+	.quad	.LPBX0
+	.long	600013863
+	.long	1457830636
+	.long	-1540324424
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC2ERKS2_
+	.align 32
+	.type	__gcov_._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_, @object
+	.size	__gcov_._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_, 40
+__gcov_._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_:
+	.quad	.LPBX0
+	.long	2041487779
+	.long	688723893
+	.long	-1209868124
+	.zero	4
+	.long	14
+	.zero	4
+	.quad	__gcov0._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_
+	.align 32
+	.type	__gcov_._ZNSt6vectorImSaImEE3endEv, @object
+	.size	__gcov_._ZNSt6vectorImSaImEE3endEv, 40
+__gcov_._ZNSt6vectorImSaImEE3endEv:
+	.quad	.LPBX0
+	.long	1347005483
+	.long	-1111539713
+	.long	2092124921
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt6vectorImSaImEE3endEv
+	.align 32
+	.type	__gcov_._ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_, @object
+	.size	__gcov_._ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_, 40
+__gcov_._ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_:
+	.quad	.LPBX0
+	.long	1758362392
+	.long	-796300689
+	.long	-206267174
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_
+	.align 32
+	.type	__gcov_._ZSt11__equal_auxIPKcPcEbT_S3_T0_, @object
+	.size	__gcov_._ZSt11__equal_auxIPKcPcEbT_S3_T0_, 40
+__gcov_._ZSt11__equal_auxIPKcPcEbT_S3_T0_:
+	.quad	.LPBX0
+	.long	1203518470
+	.long	-1441266342
+	.long	260709395
+	.zero	4
+	.long	5
+	.zero	4
+	.quad	__gcov0._ZSt11__equal_auxIPKcPcEbT_S3_T0_
+	.align 32
+	.type	__gcov_._ZSt8_DestroyIPmmEvT_S1_RSaIT0_E, @object
+	.size	__gcov_._ZSt8_DestroyIPmmEvT_S1_RSaIT0_E, 40
+__gcov_._ZSt8_DestroyIPmmEvT_S1_RSaIT0_E:
+	.quad	.LPBX0
+	.long	194912664
+	.long	875923518
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt8_DestroyIPmmEvT_S1_RSaIT0_E
+	.align 32
+	.type	__gcov_._ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv, @object
+	.size	__gcov_._ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv, 40
+__gcov_._ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv:
+	.quad	.LPBX0
+	.long	489982353
+	.long	-1796719716
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv
+	.align 32
+	.type	__gcov_._ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm, @object
+	.size	__gcov_._ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm, 40
+__gcov_._ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm:
+	.quad	.LPBX0
+	.long	1047249180
+	.long	1831300788
+	.long	-2076400574
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm
+	.align 32
+	.type	__gcov_._ZNSt15__new_allocatorImED2Ev, @object
+	.size	__gcov_._ZNSt15__new_allocatorImED2Ev, 40
+__gcov_._ZNSt15__new_allocatorImED2Ev:
+	.quad	.LPBX0
+	.long	876339142
+	.long	-298832701
+	.long	-1540324424
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNSt15__new_allocatorImED2Ev
+	.align 32
+	.type	__gcov_._ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC2Ev, @object
+	.size	__gcov_._ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC2Ev, 40
+__gcov_._ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC2Ev:
+	.quad	.LPBX0
+	.long	515736933
+	.long	565779202
+	.long	-1540324424
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC2Ev
+	.align 32
+	.type	__gcov_._ZNSaImEC2Ev, @object
+	.size	__gcov_._ZNSaImEC2Ev, 40
+__gcov_._ZNSaImEC2Ev:
+	.quad	.LPBX0
+	.long	903219916
+	.long	399092172
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSaImEC2Ev
+	.align 32
+	.type	__gcov_._ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_, @object
+	.size	__gcov_._ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_, 40
+__gcov_._ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_:
+	.quad	.LPBX0
+	.long	973544705
+	.long	-210463135
+	.long	-162248067
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_
+	.align 32
+	.type	__gcov_._ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_, @object
+	.size	__gcov_._ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_, 40
+__gcov_._ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_:
+	.quad	.LPBX0
+	.long	1509460415
+	.long	1971490606
+	.long	-162248067
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_
+	.align 32
+	.type	__gcov_._ZSt11lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjZNK9simulator13result_reader10find_chunkEjRNS8_12result_chunkEEUlmjE_ET_SD_SD_RKT0_T1_, @object
+	.size	__gcov_._ZSt11lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjZNK9simulator13result_reader10find_chunkEjRNS8_12result_chunkEEUlmjE_ET_SD_SD_RKT0_T1_, 40
+__gcov_._ZSt11lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjZNK9simulator13result_reader10find_chunkEjRNS8_12result_chunkEEUlmjE_ET_SD_SD_RKT0_T1_:
+	.quad	.LPBX0
+	.long	974947091
+	.long	1616105060
+	.long	-162248067
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZSt11lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjZNK9simulator13result_reader10find_chunkEjRNS8_12result_chunkEEUlmjE_ET_SD_SD_RKT0_T1_
+	.align 32
+	.type	__gcov_._ZNKSt6vectorImSaImEE3endEv, @object
+	.size	__gcov_._ZNKSt6vectorImSaImEE3endEv, 40
+__gcov_._ZNKSt6vectorImSaImEE3endEv:
+	.quad	.LPBX0
+	.long	1409019301
+	.long	-1911547772
+	.long	2092124921
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNKSt6vectorImSaImEE3endEv
+	.align 32
+	.type	__gcov_._ZNKSt6vectorImSaImEE5beginEv, @object
+	.size	__gcov_._ZNKSt6vectorImSaImEE5beginEv, 40
+__gcov_._ZNKSt6vectorImSaImEE5beginEv:
+	.quad	.LPBX0
+	.long	1212347973
+	.long	-4051788
+	.long	2092124921
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNKSt6vectorImSaImEE5beginEv
+	.align 32
+	.type	__gcov_._ZNKSt6vectorImSaImEEixEm, @object
+	.size	__gcov_._ZNKSt6vectorImSaImEEixEm, 40
+__gcov_._ZNKSt6vectorImSaImEEixEm:
+	.quad	.LPBX0
+	.long	1308292221
+	.long	-742718004
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNKSt6vectorImSaImEEixEm
+	.align 32
+	.type	__gcov_._ZNKSt6vectorImSaImEE4sizeEv, @object
+	.size	__gcov_._ZNKSt6vectorImSaImEE4sizeEv, 40
+__gcov_._ZNKSt6vectorImSaImEE4sizeEv:
+	.quad	.LPBX0
+	.long	581782478
+	.long	-2052529537
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZNKSt6vectorImSaImEE4sizeEv
+	.align 32
+	.type	__gcov_._ZNSt6vectorImSaImEE9push_backERKm, @object
+	.size	__gcov_._ZNSt6vectorImSaImEE9push_backERKm, 40
+__gcov_._ZNSt6vectorImSaImEE9push_backERKm:
+	.quad	.LPBX0
+	.long	401561519
+	.long	1092924733
+	.long	762240430
+	.zero	4
+	.long	5
+	.zero	4
+	.quad	__gcov0._ZNSt6vectorImSaImEE9push_backERKm
+	.align 32
+	.type	__gcov_._ZSt5equalIPKcPcEbT_S3_T0_, @object
+	.size	__gcov_._ZSt5equalIPKcPcEbT_S3_T0_, 40
+__gcov_._ZSt5equalIPKcPcEbT_S3_T0_:
+	.quad	.LPBX0
+	.long	1324679125
+	.long	-1282080421
+	.long	2092124921
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZSt5equalIPKcPcEbT_S3_T0_
+	.align 32
+	.type	__gcov_._ZSt3endIKcLm8EEPT_RAT0__S1_, @object
+	.size	__gcov_._ZSt3endIKcLm8EEPT_RAT0__S1_, 40
+__gcov_._ZSt3endIKcLm8EEPT_RAT0__S1_:
+	.quad	.LPBX0
+	.long	1230794459
+	.long	-1773326421
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZSt3endIKcLm8EEPT_RAT0__S1_
+	.align 32
+	.type	__gcov_._ZSt5beginIKcLm8EEPT_RAT0__S1_, @object
+	.size	__gcov_._ZSt5beginIKcLm8EEPT_RAT0__S1_, 40
+__gcov_._ZSt5beginIKcLm8EEPT_RAT0__S1_:
+	.quad	.LPBX0
+	.long	1033749676
+	.long	-444100251
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZSt5beginIKcLm8EEPT_RAT0__S1_
+	.align 32
+	.type	__gcov_._ZNSt6vectorImSaImEED2Ev, @object
+	.size	__gcov_._ZNSt6vectorImSaImEED2Ev, 40
+__gcov_._ZNSt6vectorImSaImEED2Ev:
+	.quad	.LPBX0
+	.long	739973917
+	.long	-1208732758
+	.long	-2114763847
+	.zero	4
+	.long	4
+	.zero	4
+	.quad	__gcov0._ZNSt6vectorImSaImEED2Ev
+	.align 32
+	.type	__gcov_._ZNSt12_Vector_baseImSaImEED2Ev, @object
+	.size	__gcov_._ZNSt12_Vector_baseImSaImEED2Ev, 40
+__gcov_._ZNSt12_Vector_baseImSaImEED2Ev:
+	.quad	.LPBX0
+	.long	378556530
+	.long	-1520758394
+	.long	-206267174
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZNSt12_Vector_baseImSaImEED2Ev
+	.align 32
+	.type	__gcov_._ZNSaImED2Ev, @object
+	.size	__gcov_._ZNSaImED2Ev, 40
+__gcov_._ZNSaImED2Ev:
+	.quad	.LPBX0
+	.long	1312104920
+	.long	942741048
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSaImED2Ev
+	.align 32
+	.type	__gcov_._ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev, @object
+	.size	__gcov_._ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev, 40
+__gcov_._ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev:
+	.quad	.LPBX0
+	.long	170293558
+	.long	391405948
+	.long	-206267174
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev
+	.align 32
+	.type	__gcov_._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE, @object
+	.size	__gcov_._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE, 40
+__gcov_._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE:
+	.quad	.LPBX0
+	.long	2042125569
+	.long	426985681
+	.long	-30058504
+	.zero	4
+	.long	11
+	.zero	4
+	.quad	__gcov0._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE
+	.align 32
+	.type	__gcov_._ZZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkEENKUlmjE_clEmj, @object
+	.size	__gcov_._ZZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkEENKUlmjE_clEmj, 40
+__gcov_._ZZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkEENKUlmjE_clEmj:
+	.quad	.LPBX0
+	.long	816720929
+	.long	1130387294
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkEENKUlmjE_clEmj
+	.align 32
+	.type	__gcov_._ZNK9simulator13result_reader9get_chunkEm, @object
+	.size	__gcov_._ZNK9simulator13result_reader9get_chunkEm, 40
+__gcov_._ZNK9simulator13result_reader9get_chunkEm:
+	.quad	.LPBX0
+	.long	757990519
+	.long	-2023713048
+	.long	-1116771038
+	.zero	4
+	.long	4
+	.zero	4
+	.quad	__gcov0._ZNK9simulator13result_reader9get_chunkEm
+	.align 32
+	.type	__gcov_._ZNK9simulator13result_reader17get_num_of_chunksEv, @object
+	.size	__gcov_._ZNK9simulator13result_reader17get_num_of_chunksEv, 40
+__gcov_._ZNK9simulator13result_reader17get_num_of_chunksEv:
+	.quad	.LPBX0
+	.long	981071174
+	.long	-1987162548
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNK9simulator13result_reader17get_num_of_chunksEv
+	.align 32
+	.type	__gcov_._ZN9simulator13result_readerD2Ev, @object
+	.size	__gcov_._ZN9simulator13result_readerD2Ev, 40
+__gcov_._ZN9simulator13result_readerD2Ev:
+	.quad	.LPBX0
+	.long	1634585652
+	.long	-1623408041
+	.long	-206267174
+	.zero	4
+	.long	3
+	.zero	4
+	.quad	__gcov0._ZN9simulator13result_readerD2Ev
+	.align 32
+	.type	__gcov_._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE, @object
+	.size	__gcov_._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE, 40
+__gcov_._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE:
+	.quad	.LPBX0
+	.long	1168895549
+	.long	548241251
+	.long	1884359122
+	.zero	4
+	.long	29
+	.zero	4
+	.quad	__gcov0._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE
+	.align 32
+	.type	__gcov_._ZNSt6vectorImSaImEEC2Ev, @object
+	.size	__gcov_._ZNSt6vectorImSaImEEC2Ev, 40
+__gcov_._ZNSt6vectorImSaImEEC2Ev:
+	.quad	.LPBX0
+	.long	1475883017
+	.long	-1569767486
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt6vectorImSaImEEC2Ev
+	.align 32
+	.type	__gcov_._ZNSt12_Vector_baseImSaImEEC2Ev, @object
+	.size	__gcov_._ZNSt12_Vector_baseImSaImEEC2Ev, 40
+__gcov_._ZNSt12_Vector_baseImSaImEEC2Ev:
+	.quad	.LPBX0
+	.long	1836284774
+	.long	1758203145
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt12_Vector_baseImSaImEEC2Ev
+	.align 32
+	.type	__gcov_._ZNSt12_Vector_baseImSaImEE12_Vector_implD2Ev, @object
+	.size	__gcov_._ZNSt12_Vector_baseImSaImEE12_Vector_implD2Ev, 40
+__gcov_._ZNSt12_Vector_baseImSaImEE12_Vector_implD2Ev:
+	.quad	.LPBX0
+	.long	1908757026
+	.long	363435413
+	.long	-1061440962
+	.zero	4
+	.long	2
+	.zero	4
+	.quad	__gcov0._ZNSt12_Vector_baseImSaImEE12_Vector_implD2Ev
+	.align 32
+	.type	__gcov_._ZN9simulator21get_result_chunk_sizeEj, @object
+	.size	__gcov_._ZN9simulator21get_result_chunk_sizeEj, 40
+__gcov_._ZN9simulator21get_result_chunk_sizeEj:
+	.quad	.LPBX0
+	.long	1059343882
+	.long	-772708122
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZN9simulator21get_result_chunk_sizeEj
+	.align 32
+	.type	__gcov_._ZnwmPv, @object
+	.size	__gcov_._ZnwmPv, 40
+__gcov_._ZnwmPv:
+	.quad	.LPBX0
+	.long	98535094
+	.long	-1137985752
+	.long	-614602264
+	.zero	4
+	.long	1
+	.zero	4
+	.quad	__gcov0._ZnwmPv
+	.align 32
+	.type	.LPBX1, @object
+	.size	.LPBX1, 664
+.LPBX1:
+	.quad	__gcov_._ZNKSt15__new_allocatorImE8max_sizeEv
+	.quad	__gcov_._ZNKSt15__new_allocatorImE11_M_max_sizeEv
+	.quad	__gcov_._ZSt3minImERKT_S2_S2_
+	.quad	__gcov_._ZNSt16allocator_traitsISaImEE8max_sizeERKS0_
+	.quad	__gcov_._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEpLEl
+	.quad	__gcov_._ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E
+	.quad	__gcov_._ZSt12__niter_baseIPmET_S1_
+	.quad	__gcov_._ZNSt15__new_allocatorImE8allocateEmPKv
+	.quad	__gcov_._ZNKSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv
+	.quad	__gcov_._ZNSt6vectorImSaImEE11_S_max_sizeERKS0_
+	.quad	__gcov_._ZSt8__memcmpIccEiPKT_PKT0_m
+	.quad	__gcov_._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEdeEv
+	.quad	__gcov_._ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag
+	.quad	__gcov_._ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag
+	.quad	__gcov_._ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_
+	.quad	__gcov_._ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_
+	.quad	__gcov_._ZNSt16allocator_traitsISaImEE8allocateERS0_m
+	.quad	__gcov_._ZSt3maxImERKT_S2_S2_
+	.quad	__gcov_._ZNKSt6vectorImSaImEE8max_sizeEv
+	.quad	__gcov_._ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_
+	.quad	__gcov_._ZNSt12_Destroy_auxILb1EE9__destroyIPmEEvT_S3_
+	.quad	__gcov_._ZNSt15__new_allocatorImE10deallocateEPmm
+	.quad	__gcov_._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEv
+	.quad	__gcov_._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EclINS_17__normal_iteratorIPKmSt6vectorImSaImEEEEKjEEbT_RT0_
+	.quad	__gcov_._ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_
+	.quad	__gcov_._ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_
+	.quad	__gcov_._ZN9__gnu_cxx5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EC2ES6_
+	.quad	__gcov_._ZSt4moveIRZNK9simulator13result_reader10find_chunkEjRNS0_12result_chunkEEUlmjE_EONSt16remove_referenceIT_E4typeEOS7_
+	.quad	__gcov_._ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv
+	.quad	__gcov_._ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_
+	.quad	__gcov_._ZNSt12_Vector_baseImSaImEE11_M_allocateEm
+	.quad	__gcov_._ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_
+	.quad	__gcov_._ZNSt6vectorImSaImEE5beginEv
+	.quad	__gcov_._ZNKSt6vectorImSaImEE12_M_check_lenEmPKc
+	.quad	__gcov_._ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC2ERKS1_
+	.quad	__gcov_._ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_
+	.quad	__gcov_._ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE
+	.quad	__gcov_._ZSt12__equal_aux1IPKcPcEbT_S3_T0_
+	.quad	__gcov_._ZSt12__niter_baseIPcET_S1_
+	.quad	__gcov_._ZSt12__niter_baseIPKcET_S2_
+	.quad	__gcov_._ZSt8_DestroyIPmEvT_S1_
+	.quad	__gcov_._ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm
+	.quad	__gcov_._ZNSt15__new_allocatorImEC2Ev
+	.quad	__gcov_._ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv
+	.quad	__gcov_._ZSt13__lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjNS0_5__ops14_Iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNSA_12result_chunkEEUlmjE_EEET_SG_SG_RKT0_T1_
+	.quad	__gcov_._ZN9__gnu_cxx5__ops15__iter_comp_valIZNK9simulator13result_reader10find_chunkEjRNS2_12result_chunkEEUlmjE_EENS0_14_Iter_comp_valIT_EES8_
+	.quad	__gcov_._ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC2ERKS2_
+	.quad	__gcov_._ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_
+	.quad	__gcov_._ZNSt6vectorImSaImEE3endEv
+	.quad	__gcov_._ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_
+	.quad	__gcov_._ZSt11__equal_auxIPKcPcEbT_S3_T0_
+	.quad	__gcov_._ZSt8_DestroyIPmmEvT_S1_RSaIT0_E
+	.quad	__gcov_._ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv
+	.quad	__gcov_._ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm
+	.quad	__gcov_._ZNSt15__new_allocatorImED2Ev
+	.quad	__gcov_._ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC2Ev
+	.quad	__gcov_._ZNSaImEC2Ev
+	.quad	__gcov_._ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_
+	.quad	__gcov_._ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_
+	.quad	__gcov_._ZSt11lower_boundIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEjZNK9simulator13result_reader10find_chunkEjRNS8_12result_chunkEEUlmjE_ET_SD_SD_RKT0_T1_
+	.quad	__gcov_._ZNKSt6vectorImSaImEE3endEv
+	.quad	__gcov_._ZNKSt6vectorImSaImEE5beginEv
+	.quad	__gcov_._ZNKSt6vectorImSaImEEixEm
+	.quad	__gcov_._ZNKSt6vectorImSaImEE4sizeEv
+	.quad	__gcov_._ZNSt6vectorImSaImEE9push_backERKm
+	.quad	__gcov_._ZSt5equalIPKcPcEbT_S3_T0_
+	.quad	__gcov_._ZSt3endIKcLm8EEPT_RAT0__S1_
+	.quad	__gcov_._ZSt5beginIKcLm8EEPT_RAT0__S1_
+	.quad	__gcov_._ZNSt6vectorImSaImEED2Ev
+	.quad	__gcov_._ZNSt12_Vector_baseImSaImEED2Ev
+	.quad	__gcov_._ZNSaImED2Ev
+	.quad	__gcov_._ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev
+	.quad	__gcov_._ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE
+	.quad	__gcov_._ZZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkEENKUlmjE_clEmj
+	.quad	__gcov_._ZNK9simulator13result_reader9get_chunkEm
+	.quad	__gcov_._ZNK9simulator13result_reader17get_num_of_chunksEv
+	.quad	__gcov_._ZN9simulator13result_readerD2Ev
+	.quad	__gcov_._ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE
+	.quad	__gcov_._ZNSt6vectorImSaImEEC2Ev
+	.quad	__gcov_._ZNSt12_Vector_baseImSaImEEC2Ev
+	.quad	__gcov_._ZNSt12_Vector_baseImSaImEE12_Vector_implD2Ev
+	.quad	__gcov_._ZN9simulator21get_result_chunk_sizeEj
+	.quad	__gcov_._ZnwmPv
+	.text
+	.type	_sub_I_00100_0, @function
+_sub_I_00100_0:
+.LFB3315:
+	.cfi_startproc
+	.loc 4 107 1
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	leaq	.LPBX0(%rip), %rax
+	movq	%rax, %rdi
+	call	__gcov_init@PLT
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3315:
+	.size	_sub_I_00100_0, .-_sub_I_00100_0
+	.section	.init_array.00100,"aw"
+	.align 8
+	.quad	_sub_I_00100_0
+	.text
+	.type	_sub_D_00100_1, @function
+_sub_D_00100_1:
+.LFB3316:
+	.cfi_startproc
+	.loc 4 107 1
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	call	__gcov_exit@PLT
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE3316:
+	.size	_sub_D_00100_1, .-_sub_D_00100_1
+	.section	.fini_array.00100,"aw"
+	.align 8
+	.quad	_sub_D_00100_1
+	.text
+.Letext0:
+	.file 19 "/usr/include/c++/12/type_traits"
+	.file 20 "/usr/include/x86_64-linux-gnu/c++/12/bits/c++config.h"
+	.file 21 "/usr/include/c++/12/debug/debug.h"
+	.file 22 "/usr/include/c++/12/cstdlib"
+	.file 23 "/usr/include/c++/12/cstdint"
+	.file 24 "/usr/include/c++/12/cstring"
+	.file 25 "/usr/include/c++/12/cwchar"
+	.file 26 "/usr/include/c++/12/bits/char_traits.h"
+	.file 27 "/usr/include/c++/12/clocale"
+	.file 28 "/usr/include/c++/12/string_view"
+	.file 29 "/usr/include/c++/12/cstdio"
+	.file 30 "/usr/include/c++/12/bits/basic_string.h"
+	.file 31 "/usr/include/c++/12/initializer_list"
+	.file 32 "/usr/include/c++/12/bits/stringfwd.h"
+	.file 33 "/usr/include/c++/12/bits/exception_ptr.h"
+	.file 34 "/usr/include/c++/12/bits/shared_ptr_base.h"
+	.file 35 "/usr/include/c++/12/cstddef"
+	.file 36 "/usr/include/c++/12/bits/functexcept.h"
+	.file 37 "/usr/include/c++/12/ext/alloc_traits.h"
+	.file 38 "/usr/include/c++/12/bits/atomic_base.h"
+	.file 39 "/usr/include/c++/12/ext/concurrence.h"
+	.file 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 41 "/usr/include/stdlib.h"
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 45 "/usr/include/c++/12/pstl/execution_defs.h"
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 47 "/usr/include/stdint.h"
+	.file 48 "/usr/include/string.h"
+	.file 49 "<built-in>"
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/types/wint_t.h"
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h"
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 56 "/usr/include/wchar.h"
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.file 58 "/usr/include/locale.h"
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.file 60 "/usr/include/stdio.h"
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.file 62 "./inc/types.h"
+	.file 63 "./src/main/inc/result_reader.h"
+	.file 64 "/usr/include/x86_64-linux-gnu/sys/mman.h"
+	.file 65 "/usr/include/unistd.h"
+	.file 66 "/usr/include/x86_64-linux-gnu/sys/stat.h"
+	.file 67 "/usr/include/assert.h"
+	.file 68 "/usr/include/fcntl.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x976d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x6f
+	.long	.LASF4224
+	.byte	0x21
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL0
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x70
+	.string	"std"
+	.byte	0x14
+	.value	0x128
+	.byte	0xb
+	.long	0x4de4
+	.uleb128 0x12
+	.long	.LASF3054
+	.byte	0x1
+	.byte	0x13
+	.byte	0x3e
+	.byte	0xc
+	.long	0xa4
+	.uleb128 0x6
+	.long	.LASF3056
+	.byte	0x13
+	.byte	0x41
+	.byte	0x13
+	.long	0x4df0
+	.uleb128 0x2e
+	.long	.LASF3050
+	.byte	0x13
+	.byte	0x43
+	.byte	0x11
+	.long	.LASF3052
+	.long	0x48
+	.long	0x6c
+	.long	0x72
+	.uleb128 0x2
+	.long	0x5bc5
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF3051
+	.byte	0x13
+	.byte	0x48
+	.byte	0x1c
+	.long	.LASF3053
+	.long	0x48
+	.long	0x8a
+	.long	0x90
+	.uleb128 0x2
+	.long	0x5bc5
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x4df0
+	.uleb128 0x3f
+	.string	"__v"
+	.long	0x4df0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x3b
+	.uleb128 0x12
+	.long	.LASF3055
+	.byte	0x1
+	.byte	0x13
+	.byte	0x3e
+	.byte	0xc
+	.long	0x112
+	.uleb128 0x6
+	.long	.LASF3056
+	.byte	0x13
+	.byte	0x41
+	.byte	0x13
+	.long	0x4df0
+	.uleb128 0x2e
+	.long	.LASF3057
+	.byte	0x13
+	.byte	0x43
+	.byte	0x11
+	.long	.LASF3058
+	.long	0xb6
+	.long	0xda
+	.long	0xe0
+	.uleb128 0x2
+	.long	0x5bca
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF3051
+	.byte	0x13
+	.byte	0x48
+	.byte	0x1c
+	.long	.LASF3059
+	.long	0xb6
+	.long	0xf8
+	.long	0xfe
+	.uleb128 0x2
+	.long	0x5bca
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x4df0
+	.uleb128 0x3f
+	.string	"__v"
+	.long	0x4df0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x8
+	.long	0xa9
+	.uleb128 0x6
+	.long	.LASF3060
+	.byte	0x13
+	.byte	0x55
+	.byte	0x9
+	.long	0x3b
+	.uleb128 0x16
+	.long	.LASF3061
+	.byte	0x14
+	.value	0x12a
+	.byte	0x1d
+	.long	0x5b74
+	.uleb128 0x8
+	.long	0x123
+	.uleb128 0x5c
+	.long	.LASF3062
+	.value	0xa9f
+	.uleb128 0x5c
+	.long	.LASF3063
+	.value	0xaf5
+	.uleb128 0x71
+	.long	.LASF4225
+	.byte	0x1
+	.byte	0x12
+	.byte	0x5d
+	.byte	0xa
+	.uleb128 0x12
+	.long	.LASF3064
+	.byte	0x1
+	.byte	0x12
+	.byte	0x63
+	.byte	0xa
+	.long	0x15f
+	.uleb128 0x34
+	.long	0x143
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3065
+	.byte	0x1
+	.byte	0x12
+	.byte	0x67
+	.byte	0xa
+	.long	0x172
+	.uleb128 0x34
+	.long	0x14c
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3066
+	.byte	0x1
+	.byte	0x12
+	.byte	0x6b
+	.byte	0xa
+	.long	0x185
+	.uleb128 0x34
+	.long	0x15f
+	.byte	0
+	.uleb128 0x72
+	.long	.LASF3067
+	.byte	0x15
+	.byte	0x32
+	.byte	0xd
+	.uleb128 0x37
+	.long	.LASF3068
+	.byte	0x7
+	.value	0x490
+	.long	0x1d2
+	.uleb128 0xd
+	.long	.LASF3075
+	.byte	0x7
+	.value	0x495
+	.byte	0x2
+	.long	.LASF3079
+	.long	0x4df0
+	.long	0x1c7
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5cc1
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x73
+	.long	.LASF3069
+	.long	0x4df0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x74
+	.long	.LASF4226
+	.byte	0x7
+	.byte	0x8
+	.long	0x5b74
+	.byte	0x1
+	.byte	0x59
+	.byte	0xe
+	.uleb128 0x12
+	.long	.LASF3070
+	.byte	0x1
+	.byte	0xe
+	.byte	0xa8
+	.byte	0xc
+	.long	0x20e
+	.uleb128 0x75
+	.long	.LASF3526
+	.byte	0xe
+	.byte	0xac
+	.byte	0x9
+	.long	.LASF4227
+	.uleb128 0x7
+	.long	.LASF3071
+	.long	0x7a9a
+	.uleb128 0x1
+	.long	0x7a9a
+	.uleb128 0x1
+	.long	0x7a9a
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0x7f
+	.byte	0xb
+	.long	0x5c45
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0x80
+	.byte	0xb
+	.long	0x5c78
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0x86
+	.byte	0xb
+	.long	0x5eed
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0x89
+	.byte	0xb
+	.long	0x5f0b
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0x8c
+	.byte	0xb
+	.long	0x5f26
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0x8d
+	.byte	0xb
+	.long	0x5f3c
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0x8e
+	.byte	0xb
+	.long	0x5f52
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0x8f
+	.byte	0xb
+	.long	0x5f68
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0x91
+	.byte	0xb
+	.long	0x5f93
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0x94
+	.byte	0xb
+	.long	0x5fb0
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0x96
+	.byte	0xb
+	.long	0x5fc7
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0x99
+	.byte	0xb
+	.long	0x5fe3
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0x9a
+	.byte	0xb
+	.long	0x5fff
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0x9b
+	.byte	0xb
+	.long	0x6025
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0x9d
+	.byte	0xb
+	.long	0x6046
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xa0
+	.byte	0xb
+	.long	0x6067
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xa3
+	.byte	0xb
+	.long	0x607b
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xa5
+	.byte	0xb
+	.long	0x6088
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xa6
+	.byte	0xb
+	.long	0x609a
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xa7
+	.byte	0xb
+	.long	0x60ba
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xa8
+	.byte	0xb
+	.long	0x60da
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xa9
+	.byte	0xb
+	.long	0x60fa
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xab
+	.byte	0xb
+	.long	0x6111
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xac
+	.byte	0xb
+	.long	0x6137
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xf0
+	.byte	0x16
+	.long	0x5cab
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xf5
+	.byte	0x16
+	.long	0x4f53
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xf6
+	.byte	0x16
+	.long	0x6153
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xf8
+	.byte	0x16
+	.long	0x616f
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xf9
+	.byte	0x16
+	.long	0x61c5
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xfa
+	.byte	0x16
+	.long	0x6185
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xfb
+	.byte	0x16
+	.long	0x61a5
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xfc
+	.byte	0x16
+	.long	0x61e0
+	.uleb128 0x6
+	.long	.LASF3072
+	.byte	0x13
+	.byte	0x52
+	.byte	0x9
+	.long	0xa9
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x2f
+	.byte	0xb
+	.long	0x5e47
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x30
+	.byte	0xb
+	.long	0x5e53
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x31
+	.byte	0xb
+	.long	0x5e5f
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x32
+	.byte	0xb
+	.long	0x5e6b
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x34
+	.byte	0xb
+	.long	0x63f3
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x35
+	.byte	0xb
+	.long	0x63ff
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x36
+	.byte	0xb
+	.long	0x640b
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x37
+	.byte	0xb
+	.long	0x6417
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x39
+	.byte	0xb
+	.long	0x6393
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x3a
+	.byte	0xb
+	.long	0x639f
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x3b
+	.byte	0xb
+	.long	0x63ab
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x3c
+	.byte	0xb
+	.long	0x63b7
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x3e
+	.byte	0xb
+	.long	0x646b
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x3f
+	.byte	0xb
+	.long	0x6453
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x41
+	.byte	0xb
+	.long	0x6359
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x42
+	.byte	0xb
+	.long	0x6365
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x43
+	.byte	0xb
+	.long	0x6371
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x44
+	.byte	0xb
+	.long	0x6382
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x46
+	.byte	0xb
+	.long	0x6423
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x47
+	.byte	0xb
+	.long	0x642f
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x48
+	.byte	0xb
+	.long	0x643b
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x49
+	.byte	0xb
+	.long	0x6447
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x4b
+	.byte	0xb
+	.long	0x63c3
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x4c
+	.byte	0xb
+	.long	0x63cf
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x4d
+	.byte	0xb
+	.long	0x63db
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x4e
+	.byte	0xb
+	.long	0x63e7
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x50
+	.byte	0xb
+	.long	0x6477
+	.uleb128 0x4
+	.byte	0x17
+	.byte	0x51
+	.byte	0xb
+	.long	0x645f
+	.uleb128 0x4
+	.byte	0x18
+	.byte	0x4d
+	.byte	0xb
+	.long	0x6483
+	.uleb128 0x4
+	.byte	0x18
+	.byte	0x4d
+	.byte	0xb
+	.long	0x64a7
+	.uleb128 0x4
+	.byte	0x18
+	.byte	0x54
+	.byte	0xb
+	.long	0x64cb
+	.uleb128 0x4
+	.byte	0x18
+	.byte	0x57
+	.byte	0xb
+	.long	0x64e6
+	.uleb128 0x4
+	.byte	0x18
+	.byte	0x5d
+	.byte	0xb
+	.long	0x64fd
+	.uleb128 0x4
+	.byte	0x18
+	.byte	0x5e
+	.byte	0xb
+	.long	0x6519
+	.uleb128 0x4
+	.byte	0x18
+	.byte	0x5f
+	.byte	0xb
+	.long	0x6539
+	.uleb128 0x4
+	.byte	0x18
+	.byte	0x5f
+	.byte	0xb
+	.long	0x6558
+	.uleb128 0x4
+	.byte	0x18
+	.byte	0x60
+	.byte	0xb
+	.long	0x6577
+	.uleb128 0x4
+	.byte	0x18
+	.byte	0x60
+	.byte	0xb
+	.long	0x6597
+	.uleb128 0x4
+	.byte	0x18
+	.byte	0x61
+	.byte	0xb
+	.long	0x65b7
+	.uleb128 0x4
+	.byte	0x18
+	.byte	0x61
+	.byte	0xb
+	.long	0x65d6
+	.uleb128 0x4
+	.byte	0x18
+	.byte	0x62
+	.byte	0xb
+	.long	0x65f5
+	.uleb128 0x4
+	.byte	0x18
+	.byte	0x62
+	.byte	0xb
+	.long	0x6615
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x40
+	.byte	0xb
+	.long	0x66cd
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x8d
+	.byte	0xb
+	.long	0x666b
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x8f
+	.byte	0xb
+	.long	0x687d
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x90
+	.byte	0xb
+	.long	0x6894
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x91
+	.byte	0xb
+	.long	0x68b0
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x92
+	.byte	0xb
+	.long	0x68d1
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x93
+	.byte	0xb
+	.long	0x68ed
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x94
+	.byte	0xb
+	.long	0x6909
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x95
+	.byte	0xb
+	.long	0x6925
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x96
+	.byte	0xb
+	.long	0x6942
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x97
+	.byte	0xb
+	.long	0x6963
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x98
+	.byte	0xb
+	.long	0x697a
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x99
+	.byte	0xb
+	.long	0x6987
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x9a
+	.byte	0xb
+	.long	0x69ad
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x9b
+	.byte	0xb
+	.long	0x69d3
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x9c
+	.byte	0xb
+	.long	0x69ef
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x9d
+	.byte	0xb
+	.long	0x6a1a
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0x9e
+	.byte	0xb
+	.long	0x6a36
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xa0
+	.byte	0xb
+	.long	0x6a4d
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xa2
+	.byte	0xb
+	.long	0x6a6f
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xa3
+	.byte	0xb
+	.long	0x6a90
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xa4
+	.byte	0xb
+	.long	0x6aac
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xa6
+	.byte	0xb
+	.long	0x6ad2
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xa9
+	.byte	0xb
+	.long	0x6af7
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xac
+	.byte	0xb
+	.long	0x6b1d
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xae
+	.byte	0xb
+	.long	0x6b42
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xb0
+	.byte	0xb
+	.long	0x6b5e
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xb2
+	.byte	0xb
+	.long	0x6b7e
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xb3
+	.byte	0xb
+	.long	0x6b9f
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xb4
+	.byte	0xb
+	.long	0x6bba
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xb5
+	.byte	0xb
+	.long	0x6bd5
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xb6
+	.byte	0xb
+	.long	0x6bf0
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xb7
+	.byte	0xb
+	.long	0x6c0b
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xb8
+	.byte	0xb
+	.long	0x6c26
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xb9
+	.byte	0xb
+	.long	0x6cf3
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xba
+	.byte	0xb
+	.long	0x6d09
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xbb
+	.byte	0xb
+	.long	0x6d29
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xbc
+	.byte	0xb
+	.long	0x6d49
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xbd
+	.byte	0xb
+	.long	0x6d69
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xbe
+	.byte	0xb
+	.long	0x6d94
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xbf
+	.byte	0xb
+	.long	0x6daf
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xc1
+	.byte	0xb
+	.long	0x6dd0
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xc3
+	.byte	0xb
+	.long	0x6dec
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xc4
+	.byte	0xb
+	.long	0x6e0c
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xc5
+	.byte	0xb
+	.long	0x6e2d
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xc6
+	.byte	0xb
+	.long	0x6e4e
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xc7
+	.byte	0xb
+	.long	0x6e6e
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xc8
+	.byte	0xb
+	.long	0x6e85
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xc9
+	.byte	0xb
+	.long	0x6ea6
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xca
+	.byte	0xb
+	.long	0x6ec7
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xcb
+	.byte	0xb
+	.long	0x6ee8
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xcc
+	.byte	0xb
+	.long	0x6f09
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xcd
+	.byte	0xb
+	.long	0x6f21
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xce
+	.byte	0xb
+	.long	0x6f3d
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xce
+	.byte	0xb
+	.long	0x6f5c
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xcf
+	.byte	0xb
+	.long	0x6f7b
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xcf
+	.byte	0xb
+	.long	0x6f9a
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xd0
+	.byte	0xb
+	.long	0x6fb9
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xd0
+	.byte	0xb
+	.long	0x6fd8
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xd1
+	.byte	0xb
+	.long	0x6ff7
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xd1
+	.byte	0xb
+	.long	0x7016
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xd2
+	.byte	0xb
+	.long	0x7035
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xd2
+	.byte	0xb
+	.long	0x7059
+	.uleb128 0x20
+	.byte	0x19
+	.value	0x10b
+	.byte	0x16
+	.long	0x707d
+	.uleb128 0x20
+	.byte	0x19
+	.value	0x10c
+	.byte	0x16
+	.long	0x7099
+	.uleb128 0x20
+	.byte	0x19
+	.value	0x10d
+	.byte	0x16
+	.long	0x70ba
+	.uleb128 0x20
+	.byte	0x19
+	.value	0x11b
+	.byte	0xe
+	.long	0x6dd0
+	.uleb128 0x20
+	.byte	0x19
+	.value	0x11e
+	.byte	0xe
+	.long	0x6ad2
+	.uleb128 0x20
+	.byte	0x19
+	.value	0x121
+	.byte	0xe
+	.long	0x6b1d
+	.uleb128 0x20
+	.byte	0x19
+	.value	0x124
+	.byte	0xe
+	.long	0x6b5e
+	.uleb128 0x20
+	.byte	0x19
+	.value	0x128
+	.byte	0xe
+	.long	0x707d
+	.uleb128 0x20
+	.byte	0x19
+	.value	0x129
+	.byte	0xe
+	.long	0x7099
+	.uleb128 0x20
+	.byte	0x19
+	.value	0x12a
+	.byte	0xe
+	.long	0x70ba
+	.uleb128 0x37
+	.long	.LASF3073
+	.byte	0x1a
+	.value	0x14f
+	.long	0x8a2
+	.uleb128 0x2c
+	.long	.LASF3089
+	.byte	0x1a
+	.value	0x15b
+	.byte	0x7
+	.long	.LASF3224
+	.long	0x6e4
+	.uleb128 0x1
+	.long	0x70db
+	.uleb128 0x1
+	.long	0x70e0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3074
+	.byte	0x1a
+	.value	0x151
+	.byte	0x14
+	.long	0x5cc1
+	.uleb128 0x8
+	.long	0x6e4
+	.uleb128 0x5d
+	.string	"eq"
+	.value	0x166
+	.long	.LASF3076
+	.long	0x4df0
+	.long	0x713
+	.uleb128 0x1
+	.long	0x70e0
+	.uleb128 0x1
+	.long	0x70e0
+	.byte	0
+	.uleb128 0x5d
+	.string	"lt"
+	.value	0x16a
+	.long	.LASF3077
+	.long	0x4df0
+	.long	0x730
+	.uleb128 0x1
+	.long	0x70e0
+	.uleb128 0x1
+	.long	0x70e0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3078
+	.byte	0x1a
+	.value	0x172
+	.byte	0x7
+	.long	.LASF3080
+	.long	0x5b95
+	.long	0x755
+	.uleb128 0x1
+	.long	0x70e5
+	.uleb128 0x1
+	.long	0x70e5
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3081
+	.byte	0x1a
+	.value	0x185
+	.byte	0x7
+	.long	.LASF3082
+	.long	0x123
+	.long	0x770
+	.uleb128 0x1
+	.long	0x70e5
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3083
+	.byte	0x1a
+	.value	0x18f
+	.byte	0x7
+	.long	.LASF3084
+	.long	0x70e5
+	.long	0x795
+	.uleb128 0x1
+	.long	0x70e5
+	.uleb128 0x1
+	.long	0x123
+	.uleb128 0x1
+	.long	0x70e0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3085
+	.byte	0x1a
+	.value	0x19b
+	.byte	0x7
+	.long	.LASF3086
+	.long	0x70ea
+	.long	0x7ba
+	.uleb128 0x1
+	.long	0x70ea
+	.uleb128 0x1
+	.long	0x70e5
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3087
+	.byte	0x1a
+	.value	0x1a7
+	.byte	0x7
+	.long	.LASF3088
+	.long	0x70ea
+	.long	0x7df
+	.uleb128 0x1
+	.long	0x70ea
+	.uleb128 0x1
+	.long	0x70e5
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3089
+	.byte	0x1a
+	.value	0x1b3
+	.byte	0x7
+	.long	.LASF3090
+	.long	0x70ea
+	.long	0x804
+	.uleb128 0x1
+	.long	0x70ea
+	.uleb128 0x1
+	.long	0x123
+	.uleb128 0x1
+	.long	0x6e4
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3091
+	.byte	0x1a
+	.value	0x1bf
+	.byte	0x7
+	.long	.LASF3092
+	.long	0x6e4
+	.long	0x81f
+	.uleb128 0x1
+	.long	0x70ef
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3093
+	.byte	0x1a
+	.value	0x152
+	.byte	0x13
+	.long	0x5b95
+	.uleb128 0x8
+	.long	0x81f
+	.uleb128 0xd
+	.long	.LASF3094
+	.byte	0x1a
+	.value	0x1c5
+	.byte	0x7
+	.long	.LASF3095
+	.long	0x81f
+	.long	0x84c
+	.uleb128 0x1
+	.long	0x70e0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3096
+	.byte	0x1a
+	.value	0x1c9
+	.byte	0x7
+	.long	.LASF3097
+	.long	0x4df0
+	.long	0x86c
+	.uleb128 0x1
+	.long	0x70ef
+	.uleb128 0x1
+	.long	0x70ef
+	.byte	0
+	.uleb128 0x76
+	.string	"eof"
+	.byte	0x1a
+	.value	0x1cd
+	.byte	0x7
+	.long	.LASF4228
+	.long	0x81f
+	.uleb128 0xd
+	.long	.LASF3098
+	.byte	0x1a
+	.value	0x1d1
+	.byte	0x7
+	.long	.LASF3099
+	.long	0x81f
+	.long	0x898
+	.uleb128 0x1
+	.long	0x70ef
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3100
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3101
+	.byte	0x14
+	.value	0x12b
+	.byte	0x14
+	.long	0x5ba2
+	.uleb128 0x27
+	.long	.LASF3123
+	.byte	0x1
+	.byte	0xa
+	.byte	0x38
+	.byte	0xb
+	.long	0xa31
+	.uleb128 0x18
+	.long	.LASF3102
+	.byte	0xa
+	.byte	0x50
+	.byte	0x7
+	.long	.LASF3103
+	.long	0x8d0
+	.long	0x8d6
+	.uleb128 0x2
+	.long	0x70f4
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3102
+	.byte	0xa
+	.byte	0x53
+	.byte	0x7
+	.long	.LASF3104
+	.long	0x8ea
+	.long	0x8f5
+	.uleb128 0x2
+	.long	0x70f4
+	.uleb128 0x1
+	.long	0x70f9
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3105
+	.byte	0xa
+	.byte	0x5a
+	.byte	0x7
+	.long	.LASF3106
+	.long	0x909
+	.long	0x914
+	.uleb128 0x2
+	.long	0x70f4
+	.uleb128 0x2
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3107
+	.byte	0xa
+	.byte	0x3f
+	.byte	0x14
+	.long	0x5e3d
+	.byte	0x1
+	.uleb128 0x11
+	.long	.LASF3110
+	.byte	0xa
+	.byte	0x5d
+	.byte	0x7
+	.long	.LASF3111
+	.long	0x914
+	.byte	0x1
+	.long	0x93a
+	.long	0x945
+	.uleb128 0x2
+	.long	0x70fe
+	.uleb128 0x1
+	.long	0x945
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3108
+	.byte	0xa
+	.byte	0x41
+	.byte	0x14
+	.long	0x7103
+	.byte	0x1
+	.uleb128 0x13
+	.long	.LASF3109
+	.byte	0xa
+	.byte	0x40
+	.byte	0x1a
+	.long	0x5cb7
+	.byte	0x1
+	.uleb128 0x11
+	.long	.LASF3110
+	.byte	0xa
+	.byte	0x61
+	.byte	0x7
+	.long	.LASF3112
+	.long	0x952
+	.byte	0x1
+	.long	0x978
+	.long	0x983
+	.uleb128 0x2
+	.long	0x70fe
+	.uleb128 0x1
+	.long	0x983
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3113
+	.byte	0xa
+	.byte	0x42
+	.byte	0x1a
+	.long	0x7108
+	.byte	0x1
+	.uleb128 0x11
+	.long	.LASF3114
+	.byte	0xa
+	.byte	0x70
+	.byte	0x7
+	.long	.LASF3115
+	.long	0x5e3d
+	.byte	0x1
+	.long	0x9a9
+	.long	0x9b9
+	.uleb128 0x2
+	.long	0x70f4
+	.uleb128 0x1
+	.long	0x9b9
+	.uleb128 0x1
+	.long	0x5ee6
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3116
+	.byte	0xa
+	.byte	0x3c
+	.byte	0x1b
+	.long	0x123
+	.byte	0x1
+	.uleb128 0x18
+	.long	.LASF3117
+	.byte	0xa
+	.byte	0x8e
+	.byte	0x7
+	.long	.LASF3118
+	.long	0x9da
+	.long	0x9ea
+	.uleb128 0x2
+	.long	0x70f4
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x9b9
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3119
+	.byte	0xa
+	.byte	0xa7
+	.byte	0x7
+	.long	.LASF3120
+	.long	0x9b9
+	.byte	0x1
+	.long	0xa03
+	.long	0xa09
+	.uleb128 0x2
+	.long	0x70fe
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF3121
+	.byte	0xa
+	.byte	0xd2
+	.byte	0x7
+	.long	.LASF3122
+	.long	0x9b9
+	.long	0xa21
+	.long	0xa27
+	.uleb128 0x2
+	.long	0x70fe
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0x8
+	.long	0x8af
+	.uleb128 0x27
+	.long	.LASF3124
+	.byte	0x1
+	.byte	0x5
+	.byte	0x7c
+	.byte	0xb
+	.long	0xabf
+	.uleb128 0x4f
+	.long	0x8af
+	.byte	0x1
+	.uleb128 0x18
+	.long	.LASF3125
+	.byte	0x5
+	.byte	0x9c
+	.byte	0x7
+	.long	.LASF3126
+	.long	0xa5d
+	.long	0xa63
+	.uleb128 0x2
+	.long	0x710d
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3125
+	.byte	0x5
+	.byte	0x9f
+	.byte	0x7
+	.long	.LASF3127
+	.long	0xa77
+	.long	0xa82
+	.uleb128 0x2
+	.long	0x710d
+	.uleb128 0x1
+	.long	0x7112
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF3136
+	.byte	0x5
+	.byte	0xa4
+	.byte	0x12
+	.long	.LASF3137
+	.long	0x7117
+	.long	0xa9a
+	.long	0xaa5
+	.uleb128 0x2
+	.long	0x710d
+	.uleb128 0x1
+	.long	0x7112
+	.byte	0
+	.uleb128 0x5e
+	.long	.LASF3128
+	.byte	0xae
+	.long	.LASF3232
+	.long	0xab3
+	.uleb128 0x2
+	.long	0x710d
+	.uleb128 0x2
+	.long	0x5b95
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0xa36
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x35
+	.byte	0xb
+	.long	0x711c
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x36
+	.byte	0xb
+	.long	0x7262
+	.uleb128 0x4
+	.byte	0x1b
+	.byte	0x37
+	.byte	0xb
+	.long	0x727d
+	.uleb128 0x16
+	.long	.LASF3129
+	.byte	0x14
+	.value	0x12e
+	.byte	0x1d
+	.long	0x728e
+	.uleb128 0x27
+	.long	.LASF3130
+	.byte	0x10
+	.byte	0x1c
+	.byte	0x64
+	.byte	0xb
+	.long	0x142e
+	.uleb128 0x13
+	.long	.LASF3116
+	.byte	0x1c
+	.byte	0x77
+	.byte	0xd
+	.long	0x123
+	.byte	0x1
+	.uleb128 0x18
+	.long	.LASF3131
+	.byte	0x1c
+	.byte	0x7e
+	.byte	0x7
+	.long	.LASF3132
+	.long	0xb17
+	.long	0xb1d
+	.uleb128 0x2
+	.long	0x7294
+	.byte	0
+	.uleb128 0x77
+	.long	.LASF3131
+	.byte	0x1c
+	.byte	0x82
+	.byte	0x11
+	.long	.LASF3133
+	.byte	0x1
+	.byte	0x1
+	.long	0xb33
+	.long	0xb3e
+	.uleb128 0x2
+	.long	0x7294
+	.uleb128 0x1
+	.long	0x7299
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3131
+	.byte	0x1c
+	.byte	0x85
+	.byte	0x7
+	.long	.LASF3134
+	.long	0xb52
+	.long	0xb5d
+	.uleb128 0x2
+	.long	0x7294
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3131
+	.byte	0x1c
+	.byte	0x8b
+	.byte	0x7
+	.long	.LASF3135
+	.long	0xb71
+	.long	0xb81
+	.uleb128 0x2
+	.long	0x7294
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF3136
+	.byte	0x1c
+	.byte	0xb1
+	.byte	0x7
+	.long	.LASF3138
+	.long	0x729e
+	.long	0xb99
+	.long	0xba4
+	.uleb128 0x2
+	.long	0x7294
+	.uleb128 0x1
+	.long	0x7299
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3139
+	.byte	0x1c
+	.byte	0x73
+	.byte	0xd
+	.long	0x72a3
+	.byte	0x1
+	.uleb128 0x13
+	.long	.LASF3056
+	.byte	0x1c
+	.byte	0x6e
+	.byte	0xd
+	.long	0x5cc1
+	.byte	0x1
+	.uleb128 0x8
+	.long	0xbb1
+	.uleb128 0x11
+	.long	.LASF3140
+	.byte	0x1c
+	.byte	0xb6
+	.byte	0x7
+	.long	.LASF3141
+	.long	0xba4
+	.byte	0x1
+	.long	0xbdc
+	.long	0xbe2
+	.uleb128 0x2
+	.long	0x72a8
+	.byte	0
+	.uleb128 0x51
+	.string	"end"
+	.byte	0x1c
+	.byte	0xba
+	.long	.LASF3163
+	.long	0xba4
+	.long	0xbf9
+	.long	0xbff
+	.uleb128 0x2
+	.long	0x72a8
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3142
+	.byte	0x1c
+	.byte	0xbe
+	.byte	0x7
+	.long	.LASF3143
+	.long	0xba4
+	.byte	0x1
+	.long	0xc18
+	.long	0xc1e
+	.uleb128 0x2
+	.long	0x72a8
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3144
+	.byte	0x1c
+	.byte	0xc2
+	.byte	0x7
+	.long	.LASF3145
+	.long	0xba4
+	.byte	0x1
+	.long	0xc37
+	.long	0xc3d
+	.uleb128 0x2
+	.long	0x72a8
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3146
+	.byte	0x1c
+	.byte	0x75
+	.byte	0xd
+	.long	0x1433
+	.byte	0x1
+	.uleb128 0x11
+	.long	.LASF3147
+	.byte	0x1c
+	.byte	0xc6
+	.byte	0x7
+	.long	.LASF3148
+	.long	0xc3d
+	.byte	0x1
+	.long	0xc63
+	.long	0xc69
+	.uleb128 0x2
+	.long	0x72a8
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3149
+	.byte	0x1c
+	.byte	0xca
+	.byte	0x7
+	.long	.LASF3150
+	.long	0xc3d
+	.byte	0x1
+	.long	0xc82
+	.long	0xc88
+	.uleb128 0x2
+	.long	0x72a8
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3151
+	.byte	0x1c
+	.byte	0xce
+	.byte	0x7
+	.long	.LASF3152
+	.long	0xc3d
+	.byte	0x1
+	.long	0xca1
+	.long	0xca7
+	.uleb128 0x2
+	.long	0x72a8
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3153
+	.byte	0x1c
+	.byte	0xd2
+	.byte	0x7
+	.long	.LASF3154
+	.long	0xc3d
+	.byte	0x1
+	.long	0xcc0
+	.long	0xcc6
+	.uleb128 0x2
+	.long	0x72a8
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3155
+	.byte	0x1c
+	.byte	0xd8
+	.byte	0x7
+	.long	.LASF3156
+	.long	0xaf6
+	.byte	0x1
+	.long	0xcdf
+	.long	0xce5
+	.uleb128 0x2
+	.long	0x72a8
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3081
+	.byte	0x1c
+	.byte	0xdc
+	.byte	0x7
+	.long	.LASF3157
+	.long	0xaf6
+	.byte	0x1
+	.long	0xcfe
+	.long	0xd04
+	.uleb128 0x2
+	.long	0x72a8
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3119
+	.byte	0x1c
+	.byte	0xe0
+	.byte	0x7
+	.long	.LASF3158
+	.long	0xaf6
+	.byte	0x1
+	.long	0xd1d
+	.long	0xd23
+	.uleb128 0x2
+	.long	0x72a8
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3159
+	.byte	0x1c
+	.byte	0xe7
+	.byte	0x7
+	.long	.LASF3160
+	.long	0x4df0
+	.byte	0x1
+	.long	0xd3c
+	.long	0xd42
+	.uleb128 0x2
+	.long	0x72a8
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3113
+	.byte	0x1c
+	.byte	0x72
+	.byte	0xd
+	.long	0x72ad
+	.byte	0x1
+	.uleb128 0x11
+	.long	.LASF3161
+	.byte	0x1c
+	.byte	0xed
+	.byte	0x7
+	.long	.LASF3162
+	.long	0xd42
+	.byte	0x1
+	.long	0xd68
+	.long	0xd73
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x51
+	.string	"at"
+	.byte	0x1c
+	.byte	0xf4
+	.long	.LASF3164
+	.long	0xd42
+	.long	0xd89
+	.long	0xd94
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3165
+	.byte	0x1c
+	.byte	0xfe
+	.byte	0x7
+	.long	.LASF3166
+	.long	0xd42
+	.byte	0x1
+	.long	0xdad
+	.long	0xdb3
+	.uleb128 0x2
+	.long	0x72a8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3167
+	.byte	0x1c
+	.value	0x105
+	.byte	0x7
+	.long	.LASF3169
+	.long	0xd42
+	.byte	0x1
+	.long	0xdcd
+	.long	0xdd3
+	.uleb128 0x2
+	.long	0x72a8
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3109
+	.byte	0x1c
+	.byte	0x70
+	.byte	0xd
+	.long	0x72a3
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF3168
+	.byte	0x1c
+	.value	0x10c
+	.byte	0x7
+	.long	.LASF3170
+	.long	0xdd3
+	.byte	0x1
+	.long	0xdfa
+	.long	0xe00
+	.uleb128 0x2
+	.long	0x72a8
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3171
+	.byte	0x1c
+	.value	0x112
+	.byte	0x7
+	.long	.LASF3173
+	.byte	0x1
+	.long	0xe16
+	.long	0xe21
+	.uleb128 0x2
+	.long	0x7294
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3172
+	.byte	0x1c
+	.value	0x11a
+	.byte	0x7
+	.long	.LASF3174
+	.byte	0x1
+	.long	0xe37
+	.long	0xe42
+	.uleb128 0x2
+	.long	0x7294
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3175
+	.byte	0x1c
+	.value	0x11e
+	.byte	0x7
+	.long	.LASF3176
+	.byte	0x1
+	.long	0xe58
+	.long	0xe63
+	.uleb128 0x2
+	.long	0x7294
+	.uleb128 0x1
+	.long	0x729e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3087
+	.byte	0x1c
+	.value	0x129
+	.byte	0x7
+	.long	.LASF3177
+	.long	0xaf6
+	.byte	0x1
+	.long	0xe7d
+	.long	0xe92
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3178
+	.byte	0x1c
+	.value	0x135
+	.byte	0x7
+	.long	.LASF3179
+	.long	0xae9
+	.byte	0x1
+	.long	0xeac
+	.long	0xebc
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3078
+	.byte	0x1c
+	.value	0x13d
+	.byte	0x7
+	.long	.LASF3180
+	.long	0x5b95
+	.byte	0x1
+	.long	0xed6
+	.long	0xee1
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0xae9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3078
+	.byte	0x1c
+	.value	0x147
+	.byte	0x7
+	.long	.LASF3181
+	.long	0x5b95
+	.byte	0x1
+	.long	0xefb
+	.long	0xf10
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0xae9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3078
+	.byte	0x1c
+	.value	0x14b
+	.byte	0x7
+	.long	.LASF3182
+	.long	0x5b95
+	.byte	0x1
+	.long	0xf2a
+	.long	0xf49
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0xae9
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3078
+	.byte	0x1c
+	.value	0x152
+	.byte	0x7
+	.long	.LASF3183
+	.long	0x5b95
+	.byte	0x1
+	.long	0xf63
+	.long	0xf6e
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3078
+	.byte	0x1c
+	.value	0x156
+	.byte	0x7
+	.long	.LASF3184
+	.long	0x5b95
+	.byte	0x1
+	.long	0xf88
+	.long	0xf9d
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3078
+	.byte	0x1c
+	.value	0x15a
+	.byte	0x7
+	.long	.LASF3185
+	.long	0x5b95
+	.byte	0x1
+	.long	0xfb7
+	.long	0xfd1
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3083
+	.byte	0x1c
+	.value	0x193
+	.byte	0x7
+	.long	.LASF3186
+	.long	0xaf6
+	.byte	0x1
+	.long	0xfeb
+	.long	0xffb
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0xae9
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3083
+	.byte	0x1c
+	.value	0x197
+	.byte	0x7
+	.long	.LASF3187
+	.long	0xaf6
+	.byte	0x1
+	.long	0x1015
+	.long	0x1025
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cc1
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3083
+	.byte	0x1c
+	.value	0x19a
+	.byte	0x7
+	.long	.LASF3188
+	.long	0xaf6
+	.byte	0x1
+	.long	0x103f
+	.long	0x1054
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3083
+	.byte	0x1c
+	.value	0x19d
+	.byte	0x7
+	.long	.LASF3189
+	.long	0xaf6
+	.byte	0x1
+	.long	0x106e
+	.long	0x107e
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3190
+	.byte	0x1c
+	.value	0x1a1
+	.byte	0x7
+	.long	.LASF3191
+	.long	0xaf6
+	.byte	0x1
+	.long	0x1098
+	.long	0x10a8
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0xae9
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3190
+	.byte	0x1c
+	.value	0x1a5
+	.byte	0x7
+	.long	.LASF3192
+	.long	0xaf6
+	.byte	0x1
+	.long	0x10c2
+	.long	0x10d2
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cc1
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3190
+	.byte	0x1c
+	.value	0x1a8
+	.byte	0x7
+	.long	.LASF3193
+	.long	0xaf6
+	.byte	0x1
+	.long	0x10ec
+	.long	0x1101
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3190
+	.byte	0x1c
+	.value	0x1ab
+	.byte	0x7
+	.long	.LASF3194
+	.long	0xaf6
+	.byte	0x1
+	.long	0x111b
+	.long	0x112b
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3195
+	.byte	0x1c
+	.value	0x1af
+	.byte	0x7
+	.long	.LASF3196
+	.long	0xaf6
+	.byte	0x1
+	.long	0x1145
+	.long	0x1155
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0xae9
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3195
+	.byte	0x1c
+	.value	0x1b3
+	.byte	0x7
+	.long	.LASF3197
+	.long	0xaf6
+	.byte	0x1
+	.long	0x116f
+	.long	0x117f
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cc1
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3195
+	.byte	0x1c
+	.value	0x1b7
+	.byte	0x7
+	.long	.LASF3198
+	.long	0xaf6
+	.byte	0x1
+	.long	0x1199
+	.long	0x11ae
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3195
+	.byte	0x1c
+	.value	0x1bb
+	.byte	0x7
+	.long	.LASF3199
+	.long	0xaf6
+	.byte	0x1
+	.long	0x11c8
+	.long	0x11d8
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3200
+	.byte	0x1c
+	.value	0x1bf
+	.byte	0x7
+	.long	.LASF3201
+	.long	0xaf6
+	.byte	0x1
+	.long	0x11f2
+	.long	0x1202
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0xae9
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3200
+	.byte	0x1c
+	.value	0x1c4
+	.byte	0x7
+	.long	.LASF3202
+	.long	0xaf6
+	.byte	0x1
+	.long	0x121c
+	.long	0x122c
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cc1
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3200
+	.byte	0x1c
+	.value	0x1c8
+	.byte	0x7
+	.long	.LASF3203
+	.long	0xaf6
+	.byte	0x1
+	.long	0x1246
+	.long	0x125b
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3200
+	.byte	0x1c
+	.value	0x1cc
+	.byte	0x7
+	.long	.LASF3204
+	.long	0xaf6
+	.byte	0x1
+	.long	0x1275
+	.long	0x1285
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3205
+	.byte	0x1c
+	.value	0x1d0
+	.byte	0x7
+	.long	.LASF3206
+	.long	0xaf6
+	.byte	0x1
+	.long	0x129f
+	.long	0x12af
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0xae9
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3205
+	.byte	0x1c
+	.value	0x1d5
+	.byte	0x7
+	.long	.LASF3207
+	.long	0xaf6
+	.byte	0x1
+	.long	0x12c9
+	.long	0x12d9
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cc1
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3205
+	.byte	0x1c
+	.value	0x1d8
+	.byte	0x7
+	.long	.LASF3208
+	.long	0xaf6
+	.byte	0x1
+	.long	0x12f3
+	.long	0x1308
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3205
+	.byte	0x1c
+	.value	0x1dc
+	.byte	0x7
+	.long	.LASF3209
+	.long	0xaf6
+	.byte	0x1
+	.long	0x1322
+	.long	0x1332
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3210
+	.byte	0x1c
+	.value	0x1e3
+	.byte	0x7
+	.long	.LASF3211
+	.long	0xaf6
+	.byte	0x1
+	.long	0x134c
+	.long	0x135c
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0xae9
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3210
+	.byte	0x1c
+	.value	0x1e8
+	.byte	0x7
+	.long	.LASF3212
+	.long	0xaf6
+	.byte	0x1
+	.long	0x1376
+	.long	0x1386
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cc1
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3210
+	.byte	0x1c
+	.value	0x1eb
+	.byte	0x7
+	.long	.LASF3213
+	.long	0xaf6
+	.byte	0x1
+	.long	0x13a0
+	.long	0x13b5
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3210
+	.byte	0x1c
+	.value	0x1ef
+	.byte	0x7
+	.long	.LASF3214
+	.long	0xaf6
+	.byte	0x1
+	.long	0x13cf
+	.long	0x13df
+	.uleb128 0x2
+	.long	0x72a8
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3215
+	.byte	0x1c
+	.value	0x1f9
+	.byte	0x7
+	.long	.LASF3216
+	.long	0x5b95
+	.long	0x13ff
+	.uleb128 0x1
+	.long	0xaf6
+	.uleb128 0x1
+	.long	0xaf6
+	.byte	0
+	.uleb128 0x52
+	.long	.LASF3217
+	.byte	0x1c
+	.value	0x204
+	.byte	0xe
+	.long	0x123
+	.byte	0
+	.uleb128 0x52
+	.long	.LASF3218
+	.byte	0x1c
+	.value	0x205
+	.byte	0x15
+	.long	0x5cb7
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF3100
+	.long	0x5cc1
+	.uleb128 0x47
+	.long	.LASF3457
+	.long	0x6bc
+	.byte	0
+	.uleb128 0x8
+	.long	0xae9
+	.uleb128 0x38
+	.long	.LASF3467
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x62
+	.byte	0xb
+	.long	0x6871
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x63
+	.byte	0xb
+	.long	0x7337
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x65
+	.byte	0xb
+	.long	0x734d
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x66
+	.byte	0xb
+	.long	0x735f
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x67
+	.byte	0xb
+	.long	0x7375
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x68
+	.byte	0xb
+	.long	0x738c
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x69
+	.byte	0xb
+	.long	0x73a3
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x6a
+	.byte	0xb
+	.long	0x73b9
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x6b
+	.byte	0xb
+	.long	0x73d0
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x6c
+	.byte	0xb
+	.long	0x73f1
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x6d
+	.byte	0xb
+	.long	0x7412
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x71
+	.byte	0xb
+	.long	0x742e
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x72
+	.byte	0xb
+	.long	0x7454
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x74
+	.byte	0xb
+	.long	0x7475
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x75
+	.byte	0xb
+	.long	0x7496
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x76
+	.byte	0xb
+	.long	0x74b7
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x78
+	.byte	0xb
+	.long	0x74ce
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x79
+	.byte	0xb
+	.long	0x74e5
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x7e
+	.byte	0xb
+	.long	0x74f2
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x83
+	.byte	0xb
+	.long	0x7504
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x84
+	.byte	0xb
+	.long	0x751a
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x85
+	.byte	0xb
+	.long	0x7535
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x87
+	.byte	0xb
+	.long	0x7547
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x88
+	.byte	0xb
+	.long	0x755e
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x8b
+	.byte	0xb
+	.long	0x7584
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x8d
+	.byte	0xb
+	.long	0x7590
+	.uleb128 0x4
+	.byte	0x1d
+	.byte	0x8f
+	.byte	0xb
+	.long	0x75a6
+	.uleb128 0x37
+	.long	.LASF3219
+	.byte	0xb
+	.value	0x19b
+	.long	0x1619
+	.uleb128 0x16
+	.long	.LASF3107
+	.byte	0xb
+	.value	0x1a4
+	.byte	0xd
+	.long	0x5e3d
+	.uleb128 0xd
+	.long	.LASF3114
+	.byte	0xb
+	.value	0x1cf
+	.byte	0x7
+	.long	.LASF3220
+	.long	0x151c
+	.long	0x1549
+	.uleb128 0x1
+	.long	0x75c2
+	.uleb128 0x1
+	.long	0x155b
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3221
+	.byte	0xb
+	.value	0x19e
+	.byte	0xd
+	.long	0xa36
+	.uleb128 0x8
+	.long	0x1549
+	.uleb128 0x16
+	.long	.LASF3116
+	.byte	0xb
+	.value	0x1b3
+	.byte	0xd
+	.long	0x123
+	.uleb128 0xd
+	.long	.LASF3114
+	.byte	0xb
+	.value	0x1dd
+	.byte	0x7
+	.long	.LASF3222
+	.long	0x151c
+	.long	0x158d
+	.uleb128 0x1
+	.long	0x75c2
+	.uleb128 0x1
+	.long	0x155b
+	.uleb128 0x1
+	.long	0x158d
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3223
+	.byte	0xb
+	.value	0x1ad
+	.byte	0xd
+	.long	0x5ee6
+	.uleb128 0x2c
+	.long	.LASF3117
+	.byte	0xb
+	.value	0x1ef
+	.byte	0x7
+	.long	.LASF3225
+	.long	0x15bb
+	.uleb128 0x1
+	.long	0x75c2
+	.uleb128 0x1
+	.long	0x151c
+	.uleb128 0x1
+	.long	0x155b
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3119
+	.byte	0xb
+	.value	0x223
+	.byte	0x7
+	.long	.LASF3226
+	.long	0x155b
+	.long	0x15d6
+	.uleb128 0x1
+	.long	0x75c7
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3227
+	.byte	0xb
+	.value	0x232
+	.byte	0x7
+	.long	.LASF3228
+	.long	0x1549
+	.long	0x15f1
+	.uleb128 0x1
+	.long	0x75c7
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3056
+	.byte	0xb
+	.value	0x1a1
+	.byte	0xd
+	.long	0x5cc1
+	.uleb128 0x16
+	.long	.LASF3109
+	.byte	0xb
+	.value	0x1a7
+	.byte	0xd
+	.long	0x5cb7
+	.uleb128 0x16
+	.long	.LASF3229
+	.byte	0xb
+	.value	0x1c2
+	.byte	0x8
+	.long	0xa36
+	.byte	0
+	.uleb128 0x78
+	.long	.LASF4229
+	.byte	0x14
+	.value	0x14b
+	.byte	0x41
+	.long	0x30b3
+	.uleb128 0x27
+	.long	.LASF3230
+	.byte	0x20
+	.byte	0x1e
+	.byte	0x55
+	.byte	0xb
+	.long	0x30ad
+	.uleb128 0x12
+	.long	.LASF3231
+	.byte	0x8
+	.byte	0x1e
+	.byte	0xc0
+	.byte	0xe
+	.long	0x169b
+	.uleb128 0x34
+	.long	0xa36
+	.uleb128 0x22
+	.long	.LASF3231
+	.byte	0x1e
+	.byte	0xc7
+	.byte	0x2
+	.long	.LASF3233
+	.long	0x1659
+	.long	0x1669
+	.uleb128 0x2
+	.long	0x75d6
+	.uleb128 0x1
+	.long	0x169b
+	.uleb128 0x1
+	.long	0x7112
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3231
+	.byte	0x1e
+	.byte	0xcb
+	.byte	0x2
+	.long	.LASF3234
+	.long	0x167d
+	.long	0x168d
+	.uleb128 0x2
+	.long	0x75d6
+	.uleb128 0x1
+	.long	0x169b
+	.uleb128 0x1
+	.long	0x75db
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3235
+	.byte	0x1e
+	.byte	0xcf
+	.byte	0xa
+	.long	0x169b
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3107
+	.byte	0x1e
+	.byte	0x82
+	.byte	0x2f
+	.long	0x504b
+	.byte	0x1
+	.uleb128 0x5f
+	.byte	0x10
+	.byte	0x1e
+	.byte	0xd8
+	.byte	0x7
+	.long	0x16ca
+	.uleb128 0x48
+	.long	.LASF3236
+	.byte	0x1e
+	.byte	0xd9
+	.byte	0x9
+	.long	0x75e0
+	.uleb128 0x48
+	.long	.LASF3237
+	.byte	0x1e
+	.byte	0xda
+	.byte	0xc
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3116
+	.byte	0x1e
+	.byte	0x7e
+	.byte	0x31
+	.long	0x5063
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF3238
+	.byte	0x1e
+	.byte	0x98
+	.byte	0x32
+	.long	0xae9
+	.uleb128 0x15
+	.long	.LASF3239
+	.byte	0x1e
+	.byte	0xa4
+	.byte	0x7
+	.long	.LASF3240
+	.long	0x16d7
+	.long	0x16fd
+	.uleb128 0x1
+	.long	0x16d7
+	.byte	0
+	.uleb128 0x53
+	.long	.LASF3241
+	.byte	0x1e
+	.byte	0xbb
+	.byte	0x7
+	.long	.LASF3242
+	.long	0x1711
+	.long	0x1721
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x1721
+	.uleb128 0x1
+	.long	0x7112
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3243
+	.byte	0x10
+	.byte	0x1e
+	.byte	0xab
+	.byte	0xe
+	.long	0x175b
+	.uleb128 0x53
+	.long	.LASF3243
+	.byte	0x1e
+	.byte	0xae
+	.byte	0x2
+	.long	.LASF3244
+	.long	0x1742
+	.long	0x174d
+	.uleb128 0x2
+	.long	0x761d
+	.uleb128 0x1
+	.long	0x16d7
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3245
+	.byte	0x1e
+	.byte	0xb0
+	.byte	0xc
+	.long	0x16d7
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3246
+	.byte	0x1e
+	.byte	0xd2
+	.byte	0x14
+	.long	0x1633
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3247
+	.byte	0x1e
+	.byte	0xd3
+	.byte	0x11
+	.long	0x16ca
+	.byte	0x8
+	.uleb128 0x79
+	.long	0x16a8
+	.byte	0x10
+	.uleb128 0x22
+	.long	.LASF3248
+	.byte	0x1e
+	.byte	0xdf
+	.byte	0x7
+	.long	.LASF3249
+	.long	0x178f
+	.long	0x179a
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x169b
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3250
+	.byte	0x1e
+	.byte	0xe4
+	.byte	0x7
+	.long	.LASF3251
+	.long	0x17ae
+	.long	0x17b9
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF3248
+	.byte	0x1e
+	.byte	0xe9
+	.byte	0x7
+	.long	.LASF3252
+	.long	0x169b
+	.long	0x17d1
+	.long	0x17d7
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF3253
+	.byte	0x1e
+	.byte	0xee
+	.byte	0x7
+	.long	.LASF3254
+	.long	0x169b
+	.long	0x17ef
+	.long	0x17f5
+	.uleb128 0x2
+	.long	0x75f0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3109
+	.byte	0x1e
+	.byte	0x83
+	.byte	0x35
+	.long	0x5057
+	.byte	0x1
+	.uleb128 0x2e
+	.long	.LASF3253
+	.byte	0x1e
+	.byte	0xf9
+	.byte	0x7
+	.long	.LASF3255
+	.long	0x17f5
+	.long	0x181a
+	.long	0x1820
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3256
+	.byte	0x1e
+	.value	0x104
+	.long	.LASF3257
+	.long	0x1834
+	.long	0x183f
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3258
+	.byte	0x1e
+	.value	0x109
+	.long	.LASF3259
+	.long	0x1853
+	.long	0x185e
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF3260
+	.byte	0x1e
+	.value	0x111
+	.long	.LASF3261
+	.long	0x4df0
+	.long	0x1876
+	.long	0x187c
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF3262
+	.byte	0x1e
+	.value	0x117
+	.long	.LASF3263
+	.long	0x169b
+	.long	0x1894
+	.long	0x18a4
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x75ff
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3264
+	.byte	0x1e
+	.value	0x11b
+	.long	.LASF3265
+	.long	0x18b8
+	.long	0x18be
+	.uleb128 0x2
+	.long	0x75f0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3266
+	.byte	0x1e
+	.value	0x123
+	.long	.LASF3267
+	.long	0x18d2
+	.long	0x18dd
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3268
+	.byte	0x1e
+	.value	0x14f
+	.long	.LASF3269
+	.long	0x18f1
+	.long	0x1901
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3221
+	.byte	0x1e
+	.byte	0x7d
+	.byte	0x20
+	.long	0x1913
+	.byte	0x1
+	.uleb128 0x8
+	.long	0x1901
+	.uleb128 0x6
+	.long	.LASF3270
+	.byte	0x1e
+	.byte	0x58
+	.byte	0x18
+	.long	0x5094
+	.uleb128 0x23
+	.long	.LASF3271
+	.byte	0x1e
+	.value	0x153
+	.long	.LASF3272
+	.long	0x7604
+	.long	0x1937
+	.long	0x193d
+	.uleb128 0x2
+	.long	0x75f0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF3271
+	.byte	0x1e
+	.value	0x158
+	.long	.LASF3273
+	.long	0x7609
+	.long	0x1955
+	.long	0x195b
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF3274
+	.byte	0x1e
+	.value	0x15f
+	.long	.LASF3275
+	.long	0x169b
+	.long	0x1973
+	.long	0x1979
+	.uleb128 0x2
+	.long	0x75f0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF3276
+	.byte	0x1e
+	.value	0x17b
+	.long	.LASF3277
+	.long	0x16ca
+	.long	0x1991
+	.long	0x19a1
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3278
+	.byte	0x1e
+	.value	0x186
+	.long	.LASF3279
+	.long	0x19b5
+	.long	0x19ca
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF3280
+	.byte	0x1e
+	.value	0x190
+	.long	.LASF3281
+	.long	0x16ca
+	.long	0x19e2
+	.long	0x19f2
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF3282
+	.byte	0x1e
+	.value	0x198
+	.long	.LASF3283
+	.long	0x4df0
+	.long	0x1a0a
+	.long	0x1a15
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF3284
+	.byte	0x1e
+	.value	0x1a2
+	.byte	0x7
+	.long	.LASF3285
+	.long	0x1a36
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF3286
+	.byte	0x1e
+	.value	0x1ac
+	.byte	0x7
+	.long	.LASF3287
+	.long	0x1a57
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF3288
+	.byte	0x1e
+	.value	0x1b6
+	.byte	0x7
+	.long	.LASF3289
+	.long	0x1a78
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF3290
+	.byte	0x1e
+	.value	0x1cb
+	.byte	0x7
+	.long	.LASF3291
+	.long	0x1a99
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x1a99
+	.uleb128 0x1
+	.long	0x1a99
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3292
+	.byte	0x1e
+	.byte	0x84
+	.byte	0x43
+	.long	0x50b4
+	.byte	0x1
+	.uleb128 0x2c
+	.long	.LASF3290
+	.byte	0x1e
+	.value	0x1d0
+	.byte	0x7
+	.long	.LASF3293
+	.long	0x1ac7
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x1ac7
+	.uleb128 0x1
+	.long	0x1ac7
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3139
+	.byte	0x1e
+	.byte	0x86
+	.byte	0x8
+	.long	0x52e7
+	.byte	0x1
+	.uleb128 0x2c
+	.long	.LASF3290
+	.byte	0x1e
+	.value	0x1d6
+	.byte	0x7
+	.long	.LASF3294
+	.long	0x1af5
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5e3d
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF3290
+	.byte	0x1e
+	.value	0x1db
+	.byte	0x7
+	.long	.LASF3295
+	.long	0x1b16
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3215
+	.byte	0x1e
+	.value	0x1e1
+	.byte	0x7
+	.long	.LASF3296
+	.long	0x5b95
+	.long	0x1b36
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3297
+	.byte	0x1e
+	.value	0x1ef
+	.long	.LASF3298
+	.long	0x1b4a
+	.long	0x1b55
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x760e
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3299
+	.byte	0x1e
+	.value	0x1f3
+	.long	.LASF3300
+	.long	0x1b69
+	.long	0x1b83
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3301
+	.byte	0x1e
+	.value	0x1f8
+	.long	.LASF3302
+	.long	0x1b97
+	.long	0x1ba7
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3241
+	.byte	0x1e
+	.value	0x203
+	.byte	0x7
+	.long	.LASF3303
+	.byte	0x1
+	.long	0x1bbd
+	.long	0x1bc3
+	.uleb128 0x2
+	.long	0x75f0
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF3241
+	.byte	0x1e
+	.value	0x210
+	.long	.LASF3304
+	.long	0x1bd7
+	.long	0x1be2
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x7112
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3241
+	.byte	0x1e
+	.value	0x21c
+	.byte	0x7
+	.long	.LASF3305
+	.byte	0x1
+	.long	0x1bf8
+	.long	0x1c03
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x760e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3241
+	.byte	0x1e
+	.value	0x22d
+	.byte	0x7
+	.long	.LASF3306
+	.byte	0x1
+	.long	0x1c19
+	.long	0x1c2e
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x760e
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x7112
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3241
+	.byte	0x1e
+	.value	0x23e
+	.byte	0x7
+	.long	.LASF3307
+	.byte	0x1
+	.long	0x1c44
+	.long	0x1c59
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x760e
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3241
+	.byte	0x1e
+	.value	0x250
+	.byte	0x7
+	.long	.LASF3308
+	.byte	0x1
+	.long	0x1c6f
+	.long	0x1c89
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x760e
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x7112
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3241
+	.byte	0x1e
+	.value	0x264
+	.byte	0x7
+	.long	.LASF3309
+	.byte	0x1
+	.long	0x1c9f
+	.long	0x1cb4
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x7112
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3241
+	.byte	0x1e
+	.value	0x29e
+	.byte	0x7
+	.long	.LASF3310
+	.byte	0x1
+	.long	0x1cca
+	.long	0x1cd5
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x7613
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3241
+	.byte	0x1e
+	.value	0x2ba
+	.byte	0x7
+	.long	.LASF3311
+	.byte	0x1
+	.long	0x1ceb
+	.long	0x1cfb
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x30b3
+	.uleb128 0x1
+	.long	0x7112
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3241
+	.byte	0x1e
+	.value	0x2bf
+	.byte	0x7
+	.long	.LASF3312
+	.byte	0x1
+	.long	0x1d11
+	.long	0x1d21
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x760e
+	.uleb128 0x1
+	.long	0x7112
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3241
+	.byte	0x1e
+	.value	0x2c4
+	.byte	0x7
+	.long	.LASF3313
+	.byte	0x1
+	.long	0x1d37
+	.long	0x1d47
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x7613
+	.uleb128 0x1
+	.long	0x7112
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3314
+	.byte	0x1e
+	.value	0x31a
+	.byte	0x7
+	.long	.LASF3315
+	.byte	0x1
+	.long	0x1d5d
+	.long	0x1d68
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x2
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3136
+	.byte	0x1e
+	.value	0x323
+	.byte	0x7
+	.long	.LASF3316
+	.long	0x7618
+	.byte	0x1
+	.long	0x1d82
+	.long	0x1d8d
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x760e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3136
+	.byte	0x1e
+	.value	0x32e
+	.byte	0x7
+	.long	.LASF3317
+	.long	0x7618
+	.byte	0x1
+	.long	0x1da7
+	.long	0x1db2
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3136
+	.byte	0x1e
+	.value	0x33a
+	.byte	0x7
+	.long	.LASF3318
+	.long	0x7618
+	.byte	0x1
+	.long	0x1dcc
+	.long	0x1dd7
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3136
+	.byte	0x1e
+	.value	0x34c
+	.byte	0x7
+	.long	.LASF3319
+	.long	0x7618
+	.byte	0x1
+	.long	0x1df1
+	.long	0x1dfc
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x7613
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3136
+	.byte	0x1e
+	.value	0x391
+	.byte	0x7
+	.long	.LASF3320
+	.long	0x7618
+	.byte	0x1
+	.long	0x1e16
+	.long	0x1e21
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x30b3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3321
+	.byte	0x1e
+	.value	0x3a8
+	.byte	0x7
+	.long	.LASF3322
+	.long	0x16d7
+	.byte	0x1
+	.long	0x1e3b
+	.long	0x1e41
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3140
+	.byte	0x1e
+	.value	0x3b3
+	.byte	0x7
+	.long	.LASF3323
+	.long	0x1a99
+	.byte	0x1
+	.long	0x1e5b
+	.long	0x1e61
+	.uleb128 0x2
+	.long	0x75f0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3140
+	.byte	0x1e
+	.value	0x3bc
+	.byte	0x7
+	.long	.LASF3324
+	.long	0x1ac7
+	.byte	0x1
+	.long	0x1e7b
+	.long	0x1e81
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x35
+	.string	"end"
+	.byte	0x1e
+	.value	0x3c5
+	.long	.LASF3325
+	.long	0x1a99
+	.long	0x1e99
+	.long	0x1e9f
+	.uleb128 0x2
+	.long	0x75f0
+	.byte	0
+	.uleb128 0x35
+	.string	"end"
+	.byte	0x1e
+	.value	0x3ce
+	.long	.LASF3326
+	.long	0x1ac7
+	.long	0x1eb7
+	.long	0x1ebd
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3327
+	.byte	0x1e
+	.byte	0x88
+	.byte	0x2f
+	.long	0x31a8
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF3147
+	.byte	0x1e
+	.value	0x3d8
+	.byte	0x7
+	.long	.LASF3328
+	.long	0x1ebd
+	.byte	0x1
+	.long	0x1ee4
+	.long	0x1eea
+	.uleb128 0x2
+	.long	0x75f0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3146
+	.byte	0x1e
+	.byte	0x87
+	.byte	0x35
+	.long	0x31ad
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF3147
+	.byte	0x1e
+	.value	0x3e2
+	.byte	0x7
+	.long	.LASF3329
+	.long	0x1eea
+	.byte	0x1
+	.long	0x1f11
+	.long	0x1f17
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3149
+	.byte	0x1e
+	.value	0x3ec
+	.byte	0x7
+	.long	.LASF3330
+	.long	0x1ebd
+	.byte	0x1
+	.long	0x1f31
+	.long	0x1f37
+	.uleb128 0x2
+	.long	0x75f0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3149
+	.byte	0x1e
+	.value	0x3f6
+	.byte	0x7
+	.long	.LASF3331
+	.long	0x1eea
+	.byte	0x1
+	.long	0x1f51
+	.long	0x1f57
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3142
+	.byte	0x1e
+	.value	0x400
+	.byte	0x7
+	.long	.LASF3332
+	.long	0x1ac7
+	.byte	0x1
+	.long	0x1f71
+	.long	0x1f77
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3144
+	.byte	0x1e
+	.value	0x409
+	.byte	0x7
+	.long	.LASF3333
+	.long	0x1ac7
+	.byte	0x1
+	.long	0x1f91
+	.long	0x1f97
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3151
+	.byte	0x1e
+	.value	0x413
+	.byte	0x7
+	.long	.LASF3334
+	.long	0x1eea
+	.byte	0x1
+	.long	0x1fb1
+	.long	0x1fb7
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3153
+	.byte	0x1e
+	.value	0x41d
+	.byte	0x7
+	.long	.LASF3335
+	.long	0x1eea
+	.byte	0x1
+	.long	0x1fd1
+	.long	0x1fd7
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3155
+	.byte	0x1e
+	.value	0x427
+	.byte	0x7
+	.long	.LASF3336
+	.long	0x16ca
+	.byte	0x1
+	.long	0x1ff1
+	.long	0x1ff7
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3081
+	.byte	0x1e
+	.value	0x42e
+	.byte	0x7
+	.long	.LASF3337
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2011
+	.long	0x2017
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3119
+	.byte	0x1e
+	.value	0x434
+	.byte	0x7
+	.long	.LASF3338
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2031
+	.long	0x2037
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3339
+	.byte	0x1e
+	.value	0x443
+	.byte	0x7
+	.long	.LASF3340
+	.byte	0x1
+	.long	0x204d
+	.long	0x205d
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3339
+	.byte	0x1e
+	.value	0x451
+	.byte	0x7
+	.long	.LASF3341
+	.byte	0x1
+	.long	0x2073
+	.long	0x207e
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3342
+	.byte	0x1e
+	.value	0x45a
+	.byte	0x7
+	.long	.LASF3343
+	.byte	0x1
+	.long	0x2094
+	.long	0x209a
+	.uleb128 0x2
+	.long	0x75f0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3344
+	.byte	0x1e
+	.value	0x46c
+	.byte	0x7
+	.long	.LASF3345
+	.long	0x16ca
+	.byte	0x1
+	.long	0x20b4
+	.long	0x20ba
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3346
+	.byte	0x1e
+	.value	0x485
+	.byte	0x7
+	.long	.LASF3347
+	.byte	0x1
+	.long	0x20d0
+	.long	0x20db
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3346
+	.byte	0x1e
+	.value	0x48f
+	.byte	0x7
+	.long	.LASF3348
+	.byte	0x1
+	.long	0x20f1
+	.long	0x20f7
+	.uleb128 0x2
+	.long	0x75f0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3349
+	.byte	0x1e
+	.value	0x496
+	.byte	0x7
+	.long	.LASF3350
+	.byte	0x1
+	.long	0x210d
+	.long	0x2113
+	.uleb128 0x2
+	.long	0x75f0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3159
+	.byte	0x1e
+	.value	0x49f
+	.byte	0x7
+	.long	.LASF3351
+	.long	0x4df0
+	.byte	0x1
+	.long	0x212d
+	.long	0x2133
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3113
+	.byte	0x1e
+	.byte	0x81
+	.byte	0x37
+	.long	0x507b
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF3161
+	.byte	0x1e
+	.value	0x4af
+	.byte	0x7
+	.long	.LASF3352
+	.long	0x2133
+	.byte	0x1
+	.long	0x215a
+	.long	0x2165
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3108
+	.byte	0x1e
+	.byte	0x80
+	.byte	0x31
+	.long	0x506f
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF3161
+	.byte	0x1e
+	.value	0x4c1
+	.byte	0x7
+	.long	.LASF3353
+	.long	0x2165
+	.byte	0x1
+	.long	0x218c
+	.long	0x2197
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x35
+	.string	"at"
+	.byte	0x1e
+	.value	0x4d7
+	.long	.LASF3354
+	.long	0x2133
+	.long	0x21ae
+	.long	0x21b9
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x35
+	.string	"at"
+	.byte	0x1e
+	.value	0x4ed
+	.long	.LASF3355
+	.long	0x2165
+	.long	0x21d0
+	.long	0x21db
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3165
+	.byte	0x1e
+	.value	0x4fe
+	.byte	0x7
+	.long	.LASF3356
+	.long	0x2165
+	.byte	0x1
+	.long	0x21f5
+	.long	0x21fb
+	.uleb128 0x2
+	.long	0x75f0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3165
+	.byte	0x1e
+	.value	0x50a
+	.byte	0x7
+	.long	.LASF3357
+	.long	0x2133
+	.byte	0x1
+	.long	0x2215
+	.long	0x221b
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3167
+	.byte	0x1e
+	.value	0x516
+	.byte	0x7
+	.long	.LASF3358
+	.long	0x2165
+	.byte	0x1
+	.long	0x2235
+	.long	0x223b
+	.uleb128 0x2
+	.long	0x75f0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3167
+	.byte	0x1e
+	.value	0x522
+	.byte	0x7
+	.long	.LASF3359
+	.long	0x2133
+	.byte	0x1
+	.long	0x2255
+	.long	0x225b
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3360
+	.byte	0x1e
+	.value	0x531
+	.byte	0x7
+	.long	.LASF3361
+	.long	0x7618
+	.byte	0x1
+	.long	0x2275
+	.long	0x2280
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x760e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3360
+	.byte	0x1e
+	.value	0x53b
+	.byte	0x7
+	.long	.LASF3362
+	.long	0x7618
+	.byte	0x1
+	.long	0x229a
+	.long	0x22a5
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3360
+	.byte	0x1e
+	.value	0x545
+	.byte	0x7
+	.long	.LASF3363
+	.long	0x7618
+	.byte	0x1
+	.long	0x22bf
+	.long	0x22ca
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3360
+	.byte	0x1e
+	.value	0x553
+	.byte	0x7
+	.long	.LASF3364
+	.long	0x7618
+	.byte	0x1
+	.long	0x22e4
+	.long	0x22ef
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x30b3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3365
+	.byte	0x1e
+	.value	0x56b
+	.byte	0x7
+	.long	.LASF3366
+	.long	0x7618
+	.byte	0x1
+	.long	0x2309
+	.long	0x2314
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x760e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3365
+	.byte	0x1e
+	.value	0x57d
+	.byte	0x7
+	.long	.LASF3367
+	.long	0x7618
+	.byte	0x1
+	.long	0x232e
+	.long	0x2343
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x760e
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3365
+	.byte	0x1e
+	.value	0x58a
+	.byte	0x7
+	.long	.LASF3368
+	.long	0x7618
+	.byte	0x1
+	.long	0x235d
+	.long	0x236d
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3365
+	.byte	0x1e
+	.value	0x598
+	.byte	0x7
+	.long	.LASF3369
+	.long	0x7618
+	.byte	0x1
+	.long	0x2387
+	.long	0x2392
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3365
+	.byte	0x1e
+	.value	0x5aa
+	.byte	0x7
+	.long	.LASF3370
+	.long	0x7618
+	.byte	0x1
+	.long	0x23ac
+	.long	0x23bc
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3365
+	.byte	0x1e
+	.value	0x5b5
+	.byte	0x7
+	.long	.LASF3371
+	.long	0x7618
+	.byte	0x1
+	.long	0x23d6
+	.long	0x23e1
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x30b3
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3372
+	.byte	0x1e
+	.value	0x5f4
+	.byte	0x7
+	.long	.LASF3373
+	.byte	0x1
+	.long	0x23f7
+	.long	0x2402
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3089
+	.byte	0x1e
+	.value	0x604
+	.byte	0x7
+	.long	.LASF3374
+	.long	0x7618
+	.byte	0x1
+	.long	0x241c
+	.long	0x2427
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x760e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3089
+	.byte	0x1e
+	.value	0x632
+	.byte	0x7
+	.long	.LASF3375
+	.long	0x7618
+	.byte	0x1
+	.long	0x2441
+	.long	0x244c
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x7613
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3089
+	.byte	0x1e
+	.value	0x64a
+	.byte	0x7
+	.long	.LASF3376
+	.long	0x7618
+	.byte	0x1
+	.long	0x2466
+	.long	0x247b
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x760e
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3089
+	.byte	0x1e
+	.value	0x65b
+	.byte	0x7
+	.long	.LASF3377
+	.long	0x7618
+	.byte	0x1
+	.long	0x2495
+	.long	0x24a5
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3089
+	.byte	0x1e
+	.value	0x66c
+	.byte	0x7
+	.long	.LASF3378
+	.long	0x7618
+	.byte	0x1
+	.long	0x24bf
+	.long	0x24ca
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3089
+	.byte	0x1e
+	.value	0x67e
+	.byte	0x7
+	.long	.LASF3379
+	.long	0x7618
+	.byte	0x1
+	.long	0x24e4
+	.long	0x24f4
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3089
+	.byte	0x1e
+	.value	0x69c
+	.byte	0x7
+	.long	.LASF3380
+	.long	0x7618
+	.byte	0x1
+	.long	0x250e
+	.long	0x2519
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x30b3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3381
+	.byte	0x1e
+	.value	0x6d5
+	.byte	0x7
+	.long	.LASF3382
+	.long	0x1a99
+	.byte	0x1
+	.long	0x2533
+	.long	0x2548
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x1ac7
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3381
+	.byte	0x1e
+	.value	0x725
+	.byte	0x7
+	.long	.LASF3383
+	.long	0x1a99
+	.byte	0x1
+	.long	0x2562
+	.long	0x2572
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x1ac7
+	.uleb128 0x1
+	.long	0x30b3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3381
+	.byte	0x1e
+	.value	0x741
+	.byte	0x7
+	.long	.LASF3384
+	.long	0x7618
+	.byte	0x1
+	.long	0x258c
+	.long	0x259c
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x760e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3381
+	.byte	0x1e
+	.value	0x759
+	.byte	0x7
+	.long	.LASF3385
+	.long	0x7618
+	.byte	0x1
+	.long	0x25b6
+	.long	0x25d0
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x760e
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3381
+	.byte	0x1e
+	.value	0x771
+	.byte	0x7
+	.long	.LASF3386
+	.long	0x7618
+	.byte	0x1
+	.long	0x25ea
+	.long	0x25ff
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3381
+	.byte	0x1e
+	.value	0x785
+	.byte	0x7
+	.long	.LASF3387
+	.long	0x7618
+	.byte	0x1
+	.long	0x2619
+	.long	0x2629
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3381
+	.byte	0x1e
+	.value	0x79e
+	.byte	0x7
+	.long	.LASF3388
+	.long	0x7618
+	.byte	0x1
+	.long	0x2643
+	.long	0x2658
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3381
+	.byte	0x1e
+	.value	0x7b1
+	.byte	0x7
+	.long	.LASF3389
+	.long	0x1a99
+	.byte	0x1
+	.long	0x2672
+	.long	0x2682
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3390
+	.byte	0x1e
+	.byte	0x92
+	.byte	0x1e
+	.long	0x1ac7
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF3391
+	.byte	0x1e
+	.value	0x7f0
+	.byte	0x7
+	.long	.LASF3392
+	.long	0x7618
+	.byte	0x1
+	.long	0x26a9
+	.long	0x26b9
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3391
+	.byte	0x1e
+	.value	0x804
+	.byte	0x7
+	.long	.LASF3393
+	.long	0x1a99
+	.byte	0x1
+	.long	0x26d3
+	.long	0x26de
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x2682
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3391
+	.byte	0x1e
+	.value	0x818
+	.byte	0x7
+	.long	.LASF3394
+	.long	0x1a99
+	.byte	0x1
+	.long	0x26f8
+	.long	0x2708
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x2682
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3395
+	.byte	0x1e
+	.value	0x82c
+	.byte	0x7
+	.long	.LASF3396
+	.byte	0x1
+	.long	0x271e
+	.long	0x2724
+	.uleb128 0x2
+	.long	0x75f0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3397
+	.byte	0x1e
+	.value	0x846
+	.byte	0x7
+	.long	.LASF3398
+	.long	0x7618
+	.byte	0x1
+	.long	0x273e
+	.long	0x2753
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x760e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3397
+	.byte	0x1e
+	.value	0x85d
+	.byte	0x7
+	.long	.LASF3399
+	.long	0x7618
+	.byte	0x1
+	.long	0x276d
+	.long	0x278c
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x760e
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3397
+	.byte	0x1e
+	.value	0x877
+	.byte	0x7
+	.long	.LASF3400
+	.long	0x7618
+	.byte	0x1
+	.long	0x27a6
+	.long	0x27c0
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3397
+	.byte	0x1e
+	.value	0x891
+	.byte	0x7
+	.long	.LASF3401
+	.long	0x7618
+	.byte	0x1
+	.long	0x27da
+	.long	0x27ef
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3397
+	.byte	0x1e
+	.value	0x8aa
+	.byte	0x7
+	.long	.LASF3402
+	.long	0x7618
+	.byte	0x1
+	.long	0x2809
+	.long	0x2823
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3397
+	.byte	0x1e
+	.value	0x8bd
+	.byte	0x7
+	.long	.LASF3403
+	.long	0x7618
+	.byte	0x1
+	.long	0x283d
+	.long	0x2852
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x760e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3397
+	.byte	0x1e
+	.value	0x8d2
+	.byte	0x7
+	.long	.LASF3404
+	.long	0x7618
+	.byte	0x1
+	.long	0x286c
+	.long	0x2886
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3397
+	.byte	0x1e
+	.value	0x8e9
+	.byte	0x7
+	.long	.LASF3405
+	.long	0x7618
+	.byte	0x1
+	.long	0x28a0
+	.long	0x28b5
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3397
+	.byte	0x1e
+	.value	0x8ff
+	.byte	0x7
+	.long	.LASF3406
+	.long	0x7618
+	.byte	0x1
+	.long	0x28cf
+	.long	0x28e9
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3397
+	.byte	0x1e
+	.value	0x93a
+	.byte	0x7
+	.long	.LASF3407
+	.long	0x7618
+	.byte	0x1
+	.long	0x2903
+	.long	0x291d
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5e3d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3397
+	.byte	0x1e
+	.value	0x946
+	.byte	0x7
+	.long	.LASF3408
+	.long	0x7618
+	.byte	0x1
+	.long	0x2937
+	.long	0x2951
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3397
+	.byte	0x1e
+	.value	0x952
+	.byte	0x7
+	.long	.LASF3409
+	.long	0x7618
+	.byte	0x1
+	.long	0x296b
+	.long	0x2985
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x1a99
+	.uleb128 0x1
+	.long	0x1a99
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3397
+	.byte	0x1e
+	.value	0x95e
+	.byte	0x7
+	.long	.LASF3410
+	.long	0x7618
+	.byte	0x1
+	.long	0x299f
+	.long	0x29b9
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x2682
+	.uleb128 0x1
+	.long	0x1ac7
+	.uleb128 0x1
+	.long	0x1ac7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3397
+	.byte	0x1e
+	.value	0x978
+	.byte	0x15
+	.long	.LASF3411
+	.long	0x7618
+	.byte	0x1
+	.long	0x29d3
+	.long	0x29e8
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x1ac7
+	.uleb128 0x1
+	.long	0x1ac7
+	.uleb128 0x1
+	.long	0x30b3
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF3412
+	.byte	0x1e
+	.value	0x9c8
+	.long	.LASF3413
+	.long	0x7618
+	.long	0x2a00
+	.long	0x2a1a
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF3414
+	.byte	0x1e
+	.value	0x9cd
+	.long	.LASF3415
+	.long	0x7618
+	.long	0x2a32
+	.long	0x2a4c
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF3416
+	.byte	0x1e
+	.value	0x9d2
+	.long	.LASF3417
+	.long	0x7618
+	.long	0x2a64
+	.long	0x2a74
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3087
+	.byte	0x1e
+	.value	0x9e4
+	.byte	0x7
+	.long	.LASF3418
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2a8e
+	.long	0x2aa3
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3175
+	.byte	0x1e
+	.value	0x9ef
+	.byte	0x7
+	.long	.LASF3419
+	.byte	0x1
+	.long	0x2ab9
+	.long	0x2ac4
+	.uleb128 0x2
+	.long	0x75f0
+	.uleb128 0x1
+	.long	0x7618
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3420
+	.byte	0x1e
+	.value	0x9fa
+	.byte	0x7
+	.long	.LASF3421
+	.long	0x5cb7
+	.byte	0x1
+	.long	0x2ade
+	.long	0x2ae4
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3168
+	.byte	0x1e
+	.value	0xa07
+	.byte	0x7
+	.long	.LASF3422
+	.long	0x5cb7
+	.byte	0x1
+	.long	0x2afe
+	.long	0x2b04
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3168
+	.byte	0x1e
+	.value	0xa13
+	.byte	0x7
+	.long	.LASF3423
+	.long	0x5e3d
+	.byte	0x1
+	.long	0x2b1e
+	.long	0x2b24
+	.uleb128 0x2
+	.long	0x75f0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3424
+	.byte	0x1e
+	.value	0xa1c
+	.byte	0x7
+	.long	.LASF3425
+	.long	0x1901
+	.byte	0x1
+	.long	0x2b3e
+	.long	0x2b44
+	.uleb128 0x2
+	.long	0x75f5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3083
+	.byte	0x1e
+	.value	0xa2d
+	.byte	0x7
+	.long	.LASF3426
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2b5e
+	.long	0x2b73
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3083
+	.byte	0x1e
+	.value	0xa3c
+	.byte	0x7
+	.long	.LASF3427
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2b8d
+	.long	0x2b9d
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x760e
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3083
+	.byte	0x1e
+	.value	0xa5e
+	.byte	0x7
+	.long	.LASF3428
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2bb7
+	.long	0x2bc7
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3083
+	.byte	0x1e
+	.value	0xa70
+	.byte	0x7
+	.long	.LASF3429
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2be1
+	.long	0x2bf1
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cc1
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3190
+	.byte	0x1e
+	.value	0xa7e
+	.byte	0x7
+	.long	.LASF3430
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2c0b
+	.long	0x2c1b
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x760e
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3190
+	.byte	0x1e
+	.value	0xaa2
+	.byte	0x7
+	.long	.LASF3431
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2c35
+	.long	0x2c4a
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3190
+	.byte	0x1e
+	.value	0xab1
+	.byte	0x7
+	.long	.LASF3432
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2c64
+	.long	0x2c74
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3190
+	.byte	0x1e
+	.value	0xac3
+	.byte	0x7
+	.long	.LASF3433
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2c8e
+	.long	0x2c9e
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cc1
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3195
+	.byte	0x1e
+	.value	0xad2
+	.byte	0x7
+	.long	.LASF3434
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2cb8
+	.long	0x2cc8
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x760e
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3195
+	.byte	0x1e
+	.value	0xaf7
+	.byte	0x7
+	.long	.LASF3435
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2ce2
+	.long	0x2cf7
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3195
+	.byte	0x1e
+	.value	0xb06
+	.byte	0x7
+	.long	.LASF3436
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2d11
+	.long	0x2d21
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3195
+	.byte	0x1e
+	.value	0xb1b
+	.byte	0x7
+	.long	.LASF3437
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2d3b
+	.long	0x2d4b
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cc1
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3200
+	.byte	0x1e
+	.value	0xb2b
+	.byte	0x7
+	.long	.LASF3438
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2d65
+	.long	0x2d75
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x760e
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3200
+	.byte	0x1e
+	.value	0xb50
+	.byte	0x7
+	.long	.LASF3439
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2d8f
+	.long	0x2da4
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3200
+	.byte	0x1e
+	.value	0xb5f
+	.byte	0x7
+	.long	.LASF3440
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2dbe
+	.long	0x2dce
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3200
+	.byte	0x1e
+	.value	0xb74
+	.byte	0x7
+	.long	.LASF3441
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2de8
+	.long	0x2df8
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cc1
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3205
+	.byte	0x1e
+	.value	0xb83
+	.byte	0x7
+	.long	.LASF3442
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2e12
+	.long	0x2e22
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x760e
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3205
+	.byte	0x1e
+	.value	0xba8
+	.byte	0x7
+	.long	.LASF3443
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2e3c
+	.long	0x2e51
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3205
+	.byte	0x1e
+	.value	0xbb7
+	.byte	0x7
+	.long	.LASF3444
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2e6b
+	.long	0x2e7b
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3205
+	.byte	0x1e
+	.value	0xbca
+	.byte	0x7
+	.long	.LASF3445
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2e95
+	.long	0x2ea5
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cc1
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3210
+	.byte	0x1e
+	.value	0xbda
+	.byte	0x7
+	.long	.LASF3446
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2ebf
+	.long	0x2ecf
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x760e
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3210
+	.byte	0x1e
+	.value	0xbff
+	.byte	0x7
+	.long	.LASF3447
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2ee9
+	.long	0x2efe
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3210
+	.byte	0x1e
+	.value	0xc0e
+	.byte	0x7
+	.long	.LASF3448
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2f18
+	.long	0x2f28
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3210
+	.byte	0x1e
+	.value	0xc21
+	.byte	0x7
+	.long	.LASF3449
+	.long	0x16ca
+	.byte	0x1
+	.long	0x2f42
+	.long	0x2f52
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cc1
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3178
+	.byte	0x1e
+	.value	0xc32
+	.byte	0x7
+	.long	.LASF3450
+	.long	0x1626
+	.byte	0x1
+	.long	0x2f6c
+	.long	0x2f7c
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3078
+	.byte	0x1e
+	.value	0xc46
+	.byte	0x7
+	.long	.LASF3451
+	.long	0x5b95
+	.byte	0x1
+	.long	0x2f96
+	.long	0x2fa1
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x760e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3078
+	.byte	0x1e
+	.value	0xca7
+	.byte	0x7
+	.long	.LASF3452
+	.long	0x5b95
+	.byte	0x1
+	.long	0x2fbb
+	.long	0x2fd0
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x760e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3078
+	.byte	0x1e
+	.value	0xcc2
+	.byte	0x7
+	.long	.LASF3453
+	.long	0x5b95
+	.byte	0x1
+	.long	0x2fea
+	.long	0x3009
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x760e
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3078
+	.byte	0x1e
+	.value	0xcd5
+	.byte	0x7
+	.long	.LASF3454
+	.long	0x5b95
+	.byte	0x1
+	.long	0x3023
+	.long	0x302e
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3078
+	.byte	0x1e
+	.value	0xcee
+	.byte	0x7
+	.long	.LASF3455
+	.long	0x5b95
+	.byte	0x1
+	.long	0x3048
+	.long	0x305d
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3078
+	.byte	0x1e
+	.value	0xd0a
+	.byte	0x7
+	.long	.LASF3456
+	.long	0x5b95
+	.byte	0x1
+	.long	0x3077
+	.long	0x3091
+	.uleb128 0x2
+	.long	0x75f5
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x16ca
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x16ca
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3100
+	.long	0x5cc1
+	.uleb128 0x47
+	.long	.LASF3457
+	.long	0x6bc
+	.uleb128 0x47
+	.long	.LASF3458
+	.long	0xa36
+	.byte	0
+	.uleb128 0x8
+	.long	0x1626
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF3459
+	.byte	0x10
+	.byte	0x1f
+	.byte	0x2f
+	.byte	0xb
+	.long	0x31a3
+	.uleb128 0x13
+	.long	.LASF3292
+	.byte	0x1f
+	.byte	0x36
+	.byte	0x19
+	.long	0x5cb7
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF3460
+	.byte	0x1f
+	.byte	0x3a
+	.byte	0x10
+	.long	0x30c0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3116
+	.byte	0x1f
+	.byte	0x35
+	.byte	0x16
+	.long	0x123
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF3217
+	.byte	0x1f
+	.byte	0x3b
+	.byte	0x11
+	.long	0x30da
+	.byte	0x8
+	.uleb128 0x22
+	.long	.LASF3461
+	.byte	0x1f
+	.byte	0x3e
+	.byte	0x11
+	.long	.LASF3462
+	.long	0x3108
+	.long	0x3118
+	.uleb128 0x2
+	.long	0x7622
+	.uleb128 0x1
+	.long	0x3118
+	.uleb128 0x1
+	.long	0x30da
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3139
+	.byte	0x1f
+	.byte	0x37
+	.byte	0x19
+	.long	0x5cb7
+	.byte	0x1
+	.uleb128 0x18
+	.long	.LASF3461
+	.byte	0x1f
+	.byte	0x42
+	.byte	0x11
+	.long	.LASF3463
+	.long	0x3139
+	.long	0x313f
+	.uleb128 0x2
+	.long	0x7622
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3155
+	.byte	0x1f
+	.byte	0x47
+	.byte	0x7
+	.long	.LASF3464
+	.long	0x30da
+	.byte	0x1
+	.long	0x3158
+	.long	0x315e
+	.uleb128 0x2
+	.long	0x7627
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3140
+	.byte	0x1f
+	.byte	0x4b
+	.byte	0x7
+	.long	.LASF3465
+	.long	0x3118
+	.byte	0x1
+	.long	0x3177
+	.long	0x317d
+	.uleb128 0x2
+	.long	0x7627
+	.byte	0
+	.uleb128 0x51
+	.string	"end"
+	.byte	0x1f
+	.byte	0x4f
+	.long	.LASF3466
+	.long	0x3118
+	.long	0x3194
+	.long	0x319a
+	.uleb128 0x2
+	.long	0x7627
+	.byte	0
+	.uleb128 0xe
+	.string	"_E"
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0x8
+	.long	0x30b3
+	.uleb128 0x38
+	.long	.LASF3468
+	.uleb128 0x38
+	.long	.LASF3469
+	.uleb128 0x6
+	.long	.LASF3470
+	.byte	0x20
+	.byte	0x4d
+	.byte	0x1e
+	.long	0x1626
+	.uleb128 0x8
+	.long	0x31b2
+	.uleb128 0x44
+	.long	.LASF3471
+	.byte	0x21
+	.byte	0x3f
+	.byte	0xd
+	.long	0x33a0
+	.uleb128 0x27
+	.long	.LASF3472
+	.byte	0x8
+	.byte	0x21
+	.byte	0x5a
+	.byte	0xb
+	.long	0x3392
+	.uleb128 0x5
+	.long	.LASF3473
+	.byte	0x21
+	.byte	0x5c
+	.byte	0xd
+	.long	0x5e11
+	.byte	0
+	.uleb128 0x53
+	.long	.LASF3472
+	.byte	0x21
+	.byte	0x5e
+	.byte	0x10
+	.long	.LASF3474
+	.long	0x31fd
+	.long	0x3208
+	.uleb128 0x2
+	.long	0x7753
+	.uleb128 0x1
+	.long	0x5e11
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3475
+	.byte	0x21
+	.byte	0x60
+	.byte	0xc
+	.long	.LASF3476
+	.long	0x321c
+	.long	0x3222
+	.uleb128 0x2
+	.long	0x7753
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3477
+	.byte	0x21
+	.byte	0x61
+	.byte	0xc
+	.long	.LASF3478
+	.long	0x3236
+	.long	0x323c
+	.uleb128 0x2
+	.long	0x7753
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF3479
+	.byte	0x21
+	.byte	0x63
+	.byte	0xd
+	.long	.LASF3480
+	.long	0x5e11
+	.long	0x3254
+	.long	0x325a
+	.uleb128 0x2
+	.long	0x7758
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3472
+	.byte	0x21
+	.byte	0x6b
+	.byte	0x7
+	.long	.LASF3481
+	.long	0x326e
+	.long	0x3274
+	.uleb128 0x2
+	.long	0x7753
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3472
+	.byte	0x21
+	.byte	0x6d
+	.byte	0x7
+	.long	.LASF3482
+	.long	0x3288
+	.long	0x3293
+	.uleb128 0x2
+	.long	0x7753
+	.uleb128 0x1
+	.long	0x775d
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3472
+	.byte	0x21
+	.byte	0x70
+	.byte	0x7
+	.long	.LASF3483
+	.long	0x32a7
+	.long	0x32b2
+	.uleb128 0x2
+	.long	0x7753
+	.uleb128 0x1
+	.long	0xadc
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3472
+	.byte	0x21
+	.byte	0x74
+	.byte	0x7
+	.long	.LASF3484
+	.long	0x32c6
+	.long	0x32d1
+	.uleb128 0x2
+	.long	0x7753
+	.uleb128 0x1
+	.long	0x7762
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3136
+	.byte	0x21
+	.byte	0x81
+	.byte	0x7
+	.long	.LASF3485
+	.long	0x7767
+	.byte	0x1
+	.long	0x32ea
+	.long	0x32f5
+	.uleb128 0x2
+	.long	0x7753
+	.uleb128 0x1
+	.long	0x775d
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3136
+	.byte	0x21
+	.byte	0x85
+	.byte	0x7
+	.long	.LASF3486
+	.long	0x7767
+	.byte	0x1
+	.long	0x330e
+	.long	0x3319
+	.uleb128 0x2
+	.long	0x7753
+	.uleb128 0x1
+	.long	0x7762
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3487
+	.byte	0x21
+	.byte	0x8c
+	.byte	0x7
+	.long	.LASF3488
+	.long	0x332d
+	.long	0x3338
+	.uleb128 0x2
+	.long	0x7753
+	.uleb128 0x2
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3175
+	.byte	0x21
+	.byte	0x8f
+	.byte	0x7
+	.long	.LASF3489
+	.long	0x334c
+	.long	0x3357
+	.uleb128 0x2
+	.long	0x7753
+	.uleb128 0x1
+	.long	0x7767
+	.byte	0
+	.uleb128 0x7a
+	.long	.LASF3490
+	.byte	0x21
+	.byte	0x9b
+	.byte	0x10
+	.long	.LASF3491
+	.long	0x4df0
+	.byte	0x1
+	.long	0x3370
+	.long	0x3376
+	.uleb128 0x2
+	.long	0x7758
+	.byte	0
+	.uleb128 0x7b
+	.long	.LASF3492
+	.byte	0x21
+	.byte	0xb0
+	.byte	0x7
+	.long	.LASF3493
+	.long	0x776c
+	.byte	0x1
+	.long	0x338b
+	.uleb128 0x2
+	.long	0x7758
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x31cf
+	.uleb128 0x4
+	.byte	0x21
+	.byte	0x54
+	.byte	0x10
+	.long	0x33a8
+	.byte	0
+	.uleb128 0x4
+	.byte	0x21
+	.byte	0x44
+	.byte	0x1a
+	.long	0x31cf
+	.uleb128 0x60
+	.long	.LASF3494
+	.byte	0x21
+	.byte	0x50
+	.byte	0x8
+	.long	.LASF3495
+	.long	0x33be
+	.uleb128 0x1
+	.long	0x31cf
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF3496
+	.uleb128 0x8
+	.long	0x33be
+	.uleb128 0x4
+	.byte	0x22
+	.byte	0x62
+	.byte	0x14
+	.long	0x551a
+	.uleb128 0x4
+	.byte	0x22
+	.byte	0x63
+	.byte	0x14
+	.long	0x7771
+	.uleb128 0x4
+	.byte	0x22
+	.byte	0x64
+	.byte	0x14
+	.long	0x552a
+	.uleb128 0x4
+	.byte	0x22
+	.byte	0x65
+	.byte	0x14
+	.long	0x5530
+	.uleb128 0x4
+	.byte	0x22
+	.byte	0x66
+	.byte	0x14
+	.long	0x5536
+	.uleb128 0x61
+	.long	.LASF3819
+	.long	0x4de4
+	.byte	0x26
+	.byte	0x4e
+	.byte	0x10
+	.long	0x3425
+	.uleb128 0x17
+	.long	.LASF3497
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF3498
+	.byte	0x1
+	.uleb128 0x17
+	.long	.LASF3499
+	.byte	0x2
+	.uleb128 0x17
+	.long	.LASF3500
+	.byte	0x3
+	.uleb128 0x17
+	.long	.LASF3501
+	.byte	0x4
+	.uleb128 0x17
+	.long	.LASF3502
+	.byte	0x5
+	.byte	0
+	.uleb128 0x4
+	.byte	0x23
+	.byte	0x3a
+	.byte	0xb
+	.long	0x7744
+	.uleb128 0x27
+	.long	.LASF3503
+	.byte	0x1
+	.byte	0xa
+	.byte	0x38
+	.byte	0xb
+	.long	0x35eb
+	.uleb128 0x18
+	.long	.LASF3102
+	.byte	0xa
+	.byte	0x50
+	.byte	0x7
+	.long	.LASF3504
+	.long	0x344e
+	.long	0x3454
+	.uleb128 0x2
+	.long	0x7a8b
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3102
+	.byte	0xa
+	.byte	0x53
+	.byte	0x7
+	.long	.LASF3505
+	.long	0x3468
+	.long	0x3473
+	.uleb128 0x2
+	.long	0x7a8b
+	.uleb128 0x1
+	.long	0x7a95
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3105
+	.byte	0xa
+	.byte	0x5a
+	.byte	0x7
+	.long	.LASF3506
+	.long	0x3487
+	.long	0x3492
+	.uleb128 0x2
+	.long	0x7a8b
+	.uleb128 0x2
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3107
+	.byte	0xa
+	.byte	0x3f
+	.byte	0x14
+	.long	0x7a9a
+	.byte	0x1
+	.uleb128 0x11
+	.long	.LASF3110
+	.byte	0xa
+	.byte	0x5d
+	.byte	0x7
+	.long	.LASF3507
+	.long	0x3492
+	.byte	0x1
+	.long	0x34b8
+	.long	0x34c3
+	.uleb128 0x2
+	.long	0x7aa4
+	.uleb128 0x1
+	.long	0x34c3
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3108
+	.byte	0xa
+	.byte	0x41
+	.byte	0x14
+	.long	0x7aae
+	.byte	0x1
+	.uleb128 0x13
+	.long	.LASF3109
+	.byte	0xa
+	.byte	0x40
+	.byte	0x1a
+	.long	0x7ab3
+	.byte	0x1
+	.uleb128 0x11
+	.long	.LASF3110
+	.byte	0xa
+	.byte	0x61
+	.byte	0x7
+	.long	.LASF3508
+	.long	0x34d0
+	.byte	0x1
+	.long	0x34f6
+	.long	0x3501
+	.uleb128 0x2
+	.long	0x7aa4
+	.uleb128 0x1
+	.long	0x3501
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3113
+	.byte	0xa
+	.byte	0x42
+	.byte	0x1a
+	.long	0x7abd
+	.byte	0x1
+	.uleb128 0x11
+	.long	.LASF3114
+	.byte	0xa
+	.byte	0x70
+	.byte	0x7
+	.long	.LASF3509
+	.long	0x7a9a
+	.byte	0x1
+	.long	0x3527
+	.long	0x3537
+	.uleb128 0x2
+	.long	0x7a8b
+	.uleb128 0x1
+	.long	0x3537
+	.uleb128 0x1
+	.long	0x5ee6
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3116
+	.byte	0xa
+	.byte	0x3c
+	.byte	0x1b
+	.long	0x123
+	.byte	0x1
+	.uleb128 0x18
+	.long	.LASF3117
+	.byte	0xa
+	.byte	0x8e
+	.byte	0x7
+	.long	.LASF3510
+	.long	0x3558
+	.long	0x3568
+	.uleb128 0x2
+	.long	0x7a8b
+	.uleb128 0x1
+	.long	0x7a9a
+	.uleb128 0x1
+	.long	0x3537
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3119
+	.byte	0xa
+	.byte	0xa7
+	.byte	0x7
+	.long	.LASF3511
+	.long	0x3537
+	.byte	0x1
+	.long	0x3581
+	.long	0x3587
+	.uleb128 0x2
+	.long	0x7aa4
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF3121
+	.byte	0xa
+	.byte	0xd2
+	.byte	0x7
+	.long	.LASF3512
+	.long	0x3537
+	.long	0x359f
+	.long	0x35a5
+	.uleb128 0x2
+	.long	0x7aa4
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3513
+	.byte	0xa
+	.byte	0xad
+	.byte	0x2
+	.long	.LASF3514
+	.long	0x35d1
+	.long	0x35e1
+	.uleb128 0xe
+	.string	"_Up"
+	.long	0x5b74
+	.uleb128 0x40
+	.long	.LASF3527
+	.long	0x35d1
+	.uleb128 0x41
+	.long	0x7abd
+	.byte	0
+	.uleb128 0x2
+	.long	0x7a8b
+	.uleb128 0x1
+	.long	0x7a9a
+	.uleb128 0x1
+	.long	0x7abd
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5b74
+	.byte	0
+	.uleb128 0x8
+	.long	0x342d
+	.uleb128 0x27
+	.long	.LASF3515
+	.byte	0x1
+	.byte	0x5
+	.byte	0x7c
+	.byte	0xb
+	.long	0x3679
+	.uleb128 0x4f
+	.long	0x342d
+	.byte	0x1
+	.uleb128 0x18
+	.long	.LASF3125
+	.byte	0x5
+	.byte	0x9c
+	.byte	0x7
+	.long	.LASF3516
+	.long	0x3617
+	.long	0x361d
+	.uleb128 0x2
+	.long	0x7ac2
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3125
+	.byte	0x5
+	.byte	0x9f
+	.byte	0x7
+	.long	.LASF3517
+	.long	0x3631
+	.long	0x363c
+	.uleb128 0x2
+	.long	0x7ac2
+	.uleb128 0x1
+	.long	0x7acc
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF3136
+	.byte	0x5
+	.byte	0xa4
+	.byte	0x12
+	.long	.LASF3518
+	.long	0x7ad1
+	.long	0x3654
+	.long	0x365f
+	.uleb128 0x2
+	.long	0x7ac2
+	.uleb128 0x1
+	.long	0x7acc
+	.byte	0
+	.uleb128 0x5e
+	.long	.LASF3128
+	.byte	0xae
+	.long	.LASF3519
+	.long	0x366d
+	.uleb128 0x2
+	.long	0x7ac2
+	.uleb128 0x2
+	.long	0x5b95
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x35f0
+	.uleb128 0x37
+	.long	.LASF3520
+	.byte	0xb
+	.value	0x19b
+	.long	0x37af
+	.uleb128 0x16
+	.long	.LASF3107
+	.byte	0xb
+	.value	0x1a4
+	.byte	0xd
+	.long	0x7a9a
+	.uleb128 0xd
+	.long	.LASF3114
+	.byte	0xb
+	.value	0x1cf
+	.byte	0x7
+	.long	.LASF3521
+	.long	0x368a
+	.long	0x36b7
+	.uleb128 0x1
+	.long	0x7ad6
+	.uleb128 0x1
+	.long	0x36c9
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3221
+	.byte	0xb
+	.value	0x19e
+	.byte	0xd
+	.long	0x35f0
+	.uleb128 0x8
+	.long	0x36b7
+	.uleb128 0x16
+	.long	.LASF3116
+	.byte	0xb
+	.value	0x1b3
+	.byte	0xd
+	.long	0x123
+	.uleb128 0xd
+	.long	.LASF3114
+	.byte	0xb
+	.value	0x1dd
+	.byte	0x7
+	.long	.LASF3522
+	.long	0x368a
+	.long	0x36fb
+	.uleb128 0x1
+	.long	0x7ad6
+	.uleb128 0x1
+	.long	0x36c9
+	.uleb128 0x1
+	.long	0x36fb
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3223
+	.byte	0xb
+	.value	0x1ad
+	.byte	0xd
+	.long	0x5ee6
+	.uleb128 0x2c
+	.long	.LASF3117
+	.byte	0xb
+	.value	0x1ef
+	.byte	0x7
+	.long	.LASF3523
+	.long	0x3729
+	.uleb128 0x1
+	.long	0x7ad6
+	.uleb128 0x1
+	.long	0x368a
+	.uleb128 0x1
+	.long	0x36c9
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3119
+	.byte	0xb
+	.value	0x223
+	.byte	0x7
+	.long	.LASF3524
+	.long	0x36c9
+	.long	0x3744
+	.uleb128 0x1
+	.long	0x7adb
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3227
+	.byte	0xb
+	.value	0x232
+	.byte	0x7
+	.long	.LASF3525
+	.long	0x36b7
+	.long	0x375f
+	.uleb128 0x1
+	.long	0x7adb
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3056
+	.byte	0xb
+	.value	0x1a1
+	.byte	0xd
+	.long	0x5b74
+	.uleb128 0x16
+	.long	.LASF3229
+	.byte	0xb
+	.value	0x1c2
+	.byte	0x8
+	.long	0x35f0
+	.uleb128 0x7c
+	.long	.LASF3513
+	.byte	0xb
+	.value	0x1ff
+	.byte	0x2
+	.long	.LASF4230
+	.uleb128 0xe
+	.string	"_Up"
+	.long	0x5b74
+	.uleb128 0x40
+	.long	.LASF3527
+	.long	0x379e
+	.uleb128 0x41
+	.long	0x7abd
+	.byte	0
+	.uleb128 0x1
+	.long	0x7ad6
+	.uleb128 0x1
+	.long	0x7a9a
+	.uleb128 0x1
+	.long	0x7abd
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3528
+	.byte	0x18
+	.byte	0x3
+	.byte	0x55
+	.byte	0xc
+	.long	0x3b65
+	.uleb128 0x12
+	.long	.LASF3529
+	.byte	0x18
+	.byte	0x3
+	.byte	0x5c
+	.byte	0xe
+	.long	0x3864
+	.uleb128 0x5
+	.long	.LASF3530
+	.byte	0x3
+	.byte	0x5e
+	.byte	0xa
+	.long	0x3869
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3531
+	.byte	0x3
+	.byte	0x5f
+	.byte	0xa
+	.long	0x3869
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF3532
+	.byte	0x3
+	.byte	0x60
+	.byte	0xa
+	.long	0x3869
+	.byte	0x10
+	.uleb128 0x22
+	.long	.LASF3529
+	.byte	0x3
+	.byte	0x63
+	.byte	0x2
+	.long	.LASF3533
+	.long	0x3804
+	.long	0x380a
+	.uleb128 0x2
+	.long	0x7aea
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3529
+	.byte	0x3
+	.byte	0x69
+	.byte	0x2
+	.long	.LASF3534
+	.long	0x381e
+	.long	0x3829
+	.uleb128 0x2
+	.long	0x7aea
+	.uleb128 0x1
+	.long	0x7af4
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3535
+	.byte	0x3
+	.byte	0x71
+	.byte	0x2
+	.long	.LASF3536
+	.long	0x383d
+	.long	0x3848
+	.uleb128 0x2
+	.long	0x7aea
+	.uleb128 0x1
+	.long	0x7af9
+	.byte	0
+	.uleb128 0x7d
+	.long	.LASF3537
+	.byte	0x3
+	.byte	0x7a
+	.byte	0x2
+	.long	.LASF3704
+	.long	0x3858
+	.uleb128 0x2
+	.long	0x7aea
+	.uleb128 0x1
+	.long	0x7afe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x37bc
+	.uleb128 0x6
+	.long	.LASF3107
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x9
+	.long	0x560e
+	.uleb128 0x12
+	.long	.LASF3538
+	.byte	0x18
+	.byte	0x3
+	.byte	0x85
+	.byte	0xe
+	.long	0x3940
+	.uleb128 0x34
+	.long	0x35f0
+	.uleb128 0x34
+	.long	0x37bc
+	.uleb128 0x22
+	.long	.LASF3538
+	.byte	0x3
+	.byte	0x89
+	.byte	0x2
+	.long	.LASF3539
+	.long	0x38a0
+	.long	0x38a6
+	.uleb128 0x2
+	.long	0x7b03
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3538
+	.byte	0x3
+	.byte	0x8f
+	.byte	0x2
+	.long	.LASF3540
+	.long	0x38ba
+	.long	0x38c5
+	.uleb128 0x2
+	.long	0x7b03
+	.uleb128 0x1
+	.long	0x7b0d
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3538
+	.byte	0x3
+	.byte	0x97
+	.byte	0x2
+	.long	.LASF3541
+	.long	0x38d9
+	.long	0x38e4
+	.uleb128 0x2
+	.long	0x7b03
+	.uleb128 0x1
+	.long	0x7b12
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3538
+	.byte	0x3
+	.byte	0x9c
+	.byte	0x2
+	.long	.LASF3542
+	.long	0x38f8
+	.long	0x3903
+	.uleb128 0x2
+	.long	0x7b03
+	.uleb128 0x1
+	.long	0x7b17
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3538
+	.byte	0x3
+	.byte	0xa1
+	.byte	0x2
+	.long	.LASF3543
+	.long	0x3917
+	.long	0x3927
+	.uleb128 0x2
+	.long	0x7b03
+	.uleb128 0x1
+	.long	0x7b17
+	.uleb128 0x1
+	.long	0x7b12
+	.byte	0
+	.uleb128 0x7e
+	.long	.LASF4231
+	.long	.LASF4232
+	.long	0x3934
+	.uleb128 0x2
+	.long	0x7b03
+	.uleb128 0x2
+	.long	0x5b95
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3544
+	.byte	0x3
+	.byte	0x58
+	.byte	0x15
+	.long	0x563f
+	.uleb128 0x8
+	.long	0x3940
+	.uleb128 0x23
+	.long	.LASF3545
+	.byte	0x3
+	.value	0x12a
+	.long	.LASF3546
+	.long	0x7b1c
+	.long	0x3969
+	.long	0x396f
+	.uleb128 0x2
+	.long	0x7b21
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF3545
+	.byte	0x3
+	.value	0x12f
+	.long	.LASF3547
+	.long	0x7b0d
+	.long	0x3987
+	.long	0x398d
+	.uleb128 0x2
+	.long	0x7b2b
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3221
+	.byte	0x3
+	.value	0x126
+	.byte	0x16
+	.long	0x35f0
+	.uleb128 0x8
+	.long	0x398d
+	.uleb128 0x23
+	.long	.LASF3424
+	.byte	0x3
+	.value	0x134
+	.long	.LASF3548
+	.long	0x398d
+	.long	0x39b7
+	.long	0x39bd
+	.uleb128 0x2
+	.long	0x7b2b
+	.byte	0
+	.uleb128 0x62
+	.long	.LASF3549
+	.value	0x138
+	.long	.LASF3550
+	.long	0x39d0
+	.long	0x39d6
+	.uleb128 0x2
+	.long	0x7b21
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3549
+	.byte	0x3
+	.value	0x13e
+	.long	.LASF3551
+	.long	0x39ea
+	.long	0x39f5
+	.uleb128 0x2
+	.long	0x7b21
+	.uleb128 0x1
+	.long	0x7b35
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3549
+	.byte	0x3
+	.value	0x144
+	.long	.LASF3552
+	.long	0x3a09
+	.long	0x3a14
+	.uleb128 0x2
+	.long	0x7b21
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3549
+	.byte	0x3
+	.value	0x14a
+	.long	.LASF3553
+	.long	0x3a28
+	.long	0x3a38
+	.uleb128 0x2
+	.long	0x7b21
+	.uleb128 0x1
+	.long	0x123
+	.uleb128 0x1
+	.long	0x7b35
+	.byte	0
+	.uleb128 0x62
+	.long	.LASF3549
+	.value	0x14f
+	.long	.LASF3554
+	.long	0x3a4b
+	.long	0x3a56
+	.uleb128 0x2
+	.long	0x7b21
+	.uleb128 0x1
+	.long	0x7b3a
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3549
+	.byte	0x3
+	.value	0x154
+	.long	.LASF3555
+	.long	0x3a6a
+	.long	0x3a75
+	.uleb128 0x2
+	.long	0x7b21
+	.uleb128 0x1
+	.long	0x7b17
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3549
+	.byte	0x3
+	.value	0x158
+	.long	.LASF3556
+	.long	0x3a89
+	.long	0x3a99
+	.uleb128 0x2
+	.long	0x7b21
+	.uleb128 0x1
+	.long	0x7b3a
+	.uleb128 0x1
+	.long	0x7b35
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3549
+	.byte	0x3
+	.value	0x166
+	.long	.LASF3557
+	.long	0x3aad
+	.long	0x3abd
+	.uleb128 0x2
+	.long	0x7b21
+	.uleb128 0x1
+	.long	0x7b35
+	.uleb128 0x1
+	.long	0x7b3a
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3558
+	.byte	0x3
+	.value	0x16c
+	.long	.LASF3559
+	.long	0x3ad1
+	.long	0x3adc
+	.uleb128 0x2
+	.long	0x7b21
+	.uleb128 0x2
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x52
+	.long	.LASF3560
+	.byte	0x3
+	.value	0x173
+	.byte	0x14
+	.long	0x3875
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF3561
+	.byte	0x3
+	.value	0x177
+	.long	.LASF3562
+	.long	0x3869
+	.long	0x3b02
+	.long	0x3b0d
+	.uleb128 0x2
+	.long	0x7b21
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3563
+	.byte	0x3
+	.value	0x17f
+	.long	.LASF3564
+	.long	0x3b21
+	.long	0x3b31
+	.uleb128 0x2
+	.long	0x7b21
+	.uleb128 0x1
+	.long	0x3869
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3565
+	.byte	0x3
+	.value	0x189
+	.byte	0x7
+	.long	.LASF3566
+	.byte	0x2
+	.long	0x3b47
+	.long	0x3b52
+	.uleb128 0x2
+	.long	0x7b21
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5b74
+	.uleb128 0x7
+	.long	.LASF3458
+	.long	0x35f0
+	.byte	0
+	.uleb128 0x8
+	.long	0x37af
+	.uleb128 0x12
+	.long	.LASF3567
+	.byte	0x1
+	.byte	0x13
+	.byte	0x7c
+	.byte	0xc
+	.long	0x3b8d
+	.uleb128 0x6
+	.long	.LASF3568
+	.byte	0x13
+	.byte	0x7d
+	.byte	0xd
+	.long	0x35f0
+	.uleb128 0x7
+	.long	.LASF3569
+	.long	0x35f0
+	.byte	0
+	.uleb128 0x45
+	.long	.LASF3570
+	.byte	0x18
+	.byte	0x3
+	.value	0x1a7
+	.long	0x47b7
+	.uleb128 0x20
+	.byte	0x3
+	.value	0x1a7
+	.byte	0xb
+	.long	0x3aea
+	.uleb128 0x20
+	.byte	0x3
+	.value	0x1a7
+	.byte	0xb
+	.long	0x3b0d
+	.uleb128 0x20
+	.byte	0x3
+	.value	0x1a7
+	.byte	0xb
+	.long	0x3adc
+	.uleb128 0x20
+	.byte	0x3
+	.value	0x1a7
+	.byte	0xb
+	.long	0x396f
+	.uleb128 0x20
+	.byte	0x3
+	.value	0x1a7
+	.byte	0xb
+	.long	0x3951
+	.uleb128 0x20
+	.byte	0x3
+	.value	0x1a7
+	.byte	0xb
+	.long	0x399f
+	.uleb128 0x4f
+	.long	0x37af
+	.byte	0x2
+	.uleb128 0xd
+	.long	.LASF3571
+	.byte	0x3
+	.value	0x1d1
+	.byte	0x7
+	.long	.LASF3572
+	.long	0x4df0
+	.long	0x3bf1
+	.uleb128 0x1
+	.long	0x30e
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3571
+	.byte	0x3
+	.value	0x1da
+	.byte	0x7
+	.long	.LASF3573
+	.long	0x4df0
+	.long	0x3c0c
+	.uleb128 0x1
+	.long	0x117
+	.byte	0
+	.uleb128 0x7f
+	.long	.LASF3574
+	.byte	0x3
+	.value	0x1de
+	.byte	0x7
+	.long	.LASF4233
+	.long	0x4df0
+	.uleb128 0x1a
+	.long	.LASF3107
+	.byte	0x3
+	.value	0x1c1
+	.byte	0x27
+	.long	0x3869
+	.uleb128 0xd
+	.long	.LASF3575
+	.byte	0x3
+	.value	0x1e7
+	.byte	0x7
+	.long	.LASF3576
+	.long	0x3c1d
+	.long	0x3c59
+	.uleb128 0x1
+	.long	0x3c1d
+	.uleb128 0x1
+	.long	0x3c1d
+	.uleb128 0x1
+	.long	0x3c1d
+	.uleb128 0x1
+	.long	0x7b3f
+	.uleb128 0x1
+	.long	0x30e
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3544
+	.byte	0x3
+	.value	0x1bc
+	.byte	0x2e
+	.long	0x3940
+	.uleb128 0x8
+	.long	0x3c59
+	.uleb128 0xd
+	.long	.LASF3575
+	.byte	0x3
+	.value	0x1ee
+	.byte	0x7
+	.long	.LASF3577
+	.long	0x3c1d
+	.long	0x3c9a
+	.uleb128 0x1
+	.long	0x3c1d
+	.uleb128 0x1
+	.long	0x3c1d
+	.uleb128 0x1
+	.long	0x3c1d
+	.uleb128 0x1
+	.long	0x7b3f
+	.uleb128 0x1
+	.long	0x117
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3578
+	.byte	0x3
+	.value	0x1f3
+	.byte	0x7
+	.long	.LASF3579
+	.long	0x3c1d
+	.long	0x3cc4
+	.uleb128 0x1
+	.long	0x3c1d
+	.uleb128 0x1
+	.long	0x3c1d
+	.uleb128 0x1
+	.long	0x3c1d
+	.uleb128 0x1
+	.long	0x7b3f
+	.byte	0
+	.uleb128 0x63
+	.long	.LASF3580
+	.value	0x20e
+	.long	.LASF3581
+	.long	0x3cd7
+	.long	0x3cdd
+	.uleb128 0x2
+	.long	0x7b44
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF3580
+	.byte	0x3
+	.value	0x219
+	.long	.LASF3582
+	.long	0x3cf1
+	.long	0x3cfc
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x7b4e
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3221
+	.byte	0x3
+	.value	0x1cc
+	.byte	0x16
+	.long	0x35f0
+	.uleb128 0x8
+	.long	0x3cfc
+	.uleb128 0x39
+	.long	.LASF3580
+	.byte	0x3
+	.value	0x227
+	.long	.LASF3583
+	.long	0x3d22
+	.long	0x3d32
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3d32
+	.uleb128 0x1
+	.long	0x7b4e
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3116
+	.byte	0x3
+	.value	0x1ca
+	.byte	0x16
+	.long	0x123
+	.uleb128 0x8
+	.long	0x3d32
+	.uleb128 0xc
+	.long	.LASF3580
+	.byte	0x3
+	.value	0x234
+	.byte	0x7
+	.long	.LASF3584
+	.byte	0x1
+	.long	0x3d5a
+	.long	0x3d6f
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3d32
+	.uleb128 0x1
+	.long	0x7b53
+	.uleb128 0x1
+	.long	0x7b4e
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3056
+	.byte	0x3
+	.value	0x1c0
+	.byte	0x13
+	.long	0x5b74
+	.uleb128 0x8
+	.long	0x3d6f
+	.uleb128 0xc
+	.long	.LASF3580
+	.byte	0x3
+	.value	0x254
+	.byte	0x7
+	.long	.LASF3585
+	.byte	0x1
+	.long	0x3d97
+	.long	0x3da2
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x7b58
+	.byte	0
+	.uleb128 0x63
+	.long	.LASF3580
+	.value	0x267
+	.long	.LASF3586
+	.long	0x3db5
+	.long	0x3dc0
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x7b5d
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3580
+	.byte	0x3
+	.value	0x26b
+	.byte	0x7
+	.long	.LASF3587
+	.byte	0x1
+	.long	0x3dd6
+	.long	0x3de6
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x7b58
+	.uleb128 0x1
+	.long	0x7b62
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3580
+	.byte	0x3
+	.value	0x276
+	.long	.LASF3588
+	.long	0x3dfa
+	.long	0x3e0f
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x7b5d
+	.uleb128 0x1
+	.long	0x7b4e
+	.uleb128 0x1
+	.long	0x30e
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3580
+	.byte	0x3
+	.value	0x27b
+	.long	.LASF3589
+	.long	0x3e23
+	.long	0x3e38
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x7b5d
+	.uleb128 0x1
+	.long	0x7b4e
+	.uleb128 0x1
+	.long	0x117
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3580
+	.byte	0x3
+	.value	0x28e
+	.byte	0x7
+	.long	.LASF3590
+	.byte	0x1
+	.long	0x3e4e
+	.long	0x3e5e
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x7b5d
+	.uleb128 0x1
+	.long	0x7b62
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3580
+	.byte	0x3
+	.value	0x2a1
+	.byte	0x7
+	.long	.LASF3591
+	.byte	0x1
+	.long	0x3e74
+	.long	0x3e84
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x47cd
+	.uleb128 0x1
+	.long	0x7b4e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3592
+	.byte	0x3
+	.value	0x2d8
+	.byte	0x7
+	.long	.LASF3593
+	.byte	0x1
+	.long	0x3e9a
+	.long	0x3ea5
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x2
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3136
+	.byte	0xc
+	.byte	0xcc
+	.byte	0x5
+	.long	.LASF3594
+	.long	0x7b67
+	.byte	0x1
+	.long	0x3ebe
+	.long	0x3ec9
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x7b58
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3136
+	.byte	0x3
+	.value	0x2f9
+	.byte	0x7
+	.long	.LASF3595
+	.long	0x7b67
+	.byte	0x1
+	.long	0x3ee3
+	.long	0x3eee
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x7b5d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3136
+	.byte	0x3
+	.value	0x30f
+	.byte	0x7
+	.long	.LASF3596
+	.long	0x7b67
+	.byte	0x1
+	.long	0x3f08
+	.long	0x3f13
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x47cd
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3089
+	.byte	0x3
+	.value	0x323
+	.byte	0x7
+	.long	.LASF3597
+	.byte	0x1
+	.long	0x3f29
+	.long	0x3f39
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3d32
+	.uleb128 0x1
+	.long	0x7b53
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3089
+	.byte	0x3
+	.value	0x352
+	.byte	0x7
+	.long	.LASF3598
+	.byte	0x1
+	.long	0x3f4f
+	.long	0x3f5a
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x47cd
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3292
+	.byte	0x3
+	.value	0x1c5
+	.byte	0x3d
+	.long	0x565f
+	.uleb128 0x3
+	.long	.LASF3140
+	.byte	0x3
+	.value	0x364
+	.byte	0x7
+	.long	.LASF3599
+	.long	0x3f5a
+	.byte	0x1
+	.long	0x3f81
+	.long	0x3f87
+	.uleb128 0x2
+	.long	0x7b44
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3139
+	.byte	0x3
+	.value	0x1c7
+	.byte	0x7
+	.long	0x5892
+	.uleb128 0x3
+	.long	.LASF3140
+	.byte	0x3
+	.value	0x36e
+	.byte	0x7
+	.long	.LASF3600
+	.long	0x3f87
+	.byte	0x1
+	.long	0x3fae
+	.long	0x3fb4
+	.uleb128 0x2
+	.long	0x7b6c
+	.byte	0
+	.uleb128 0x35
+	.string	"end"
+	.byte	0x3
+	.value	0x378
+	.long	.LASF3601
+	.long	0x3f5a
+	.long	0x3fcc
+	.long	0x3fd2
+	.uleb128 0x2
+	.long	0x7b44
+	.byte	0
+	.uleb128 0x35
+	.string	"end"
+	.byte	0x3
+	.value	0x382
+	.long	.LASF3602
+	.long	0x3f87
+	.long	0x3fea
+	.long	0x3ff0
+	.uleb128 0x2
+	.long	0x7b6c
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3327
+	.byte	0x3
+	.value	0x1c9
+	.byte	0x2f
+	.long	0x47d2
+	.uleb128 0x3
+	.long	.LASF3147
+	.byte	0x3
+	.value	0x38c
+	.byte	0x7
+	.long	.LASF3603
+	.long	0x3ff0
+	.byte	0x1
+	.long	0x4017
+	.long	0x401d
+	.uleb128 0x2
+	.long	0x7b44
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3146
+	.byte	0x3
+	.value	0x1c8
+	.byte	0x35
+	.long	0x47d7
+	.uleb128 0x3
+	.long	.LASF3147
+	.byte	0x3
+	.value	0x396
+	.byte	0x7
+	.long	.LASF3604
+	.long	0x401d
+	.byte	0x1
+	.long	0x4044
+	.long	0x404a
+	.uleb128 0x2
+	.long	0x7b6c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3149
+	.byte	0x3
+	.value	0x3a0
+	.byte	0x7
+	.long	.LASF3605
+	.long	0x3ff0
+	.byte	0x1
+	.long	0x4064
+	.long	0x406a
+	.uleb128 0x2
+	.long	0x7b44
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3149
+	.byte	0x3
+	.value	0x3aa
+	.byte	0x7
+	.long	.LASF3606
+	.long	0x401d
+	.byte	0x1
+	.long	0x4084
+	.long	0x408a
+	.uleb128 0x2
+	.long	0x7b6c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3142
+	.byte	0x3
+	.value	0x3b5
+	.byte	0x7
+	.long	.LASF3607
+	.long	0x3f87
+	.byte	0x1
+	.long	0x40a4
+	.long	0x40aa
+	.uleb128 0x2
+	.long	0x7b6c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3144
+	.byte	0x3
+	.value	0x3bf
+	.byte	0x7
+	.long	.LASF3608
+	.long	0x3f87
+	.byte	0x1
+	.long	0x40c4
+	.long	0x40ca
+	.uleb128 0x2
+	.long	0x7b6c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3151
+	.byte	0x3
+	.value	0x3c9
+	.byte	0x7
+	.long	.LASF3609
+	.long	0x401d
+	.byte	0x1
+	.long	0x40e4
+	.long	0x40ea
+	.uleb128 0x2
+	.long	0x7b6c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3153
+	.byte	0x3
+	.value	0x3d3
+	.byte	0x7
+	.long	.LASF3610
+	.long	0x401d
+	.byte	0x1
+	.long	0x4104
+	.long	0x410a
+	.uleb128 0x2
+	.long	0x7b6c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3155
+	.byte	0x3
+	.value	0x3db
+	.byte	0x7
+	.long	.LASF3611
+	.long	0x3d32
+	.byte	0x1
+	.long	0x4124
+	.long	0x412a
+	.uleb128 0x2
+	.long	0x7b6c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3119
+	.byte	0x3
+	.value	0x3e1
+	.byte	0x7
+	.long	.LASF3612
+	.long	0x3d32
+	.byte	0x1
+	.long	0x4144
+	.long	0x414a
+	.uleb128 0x2
+	.long	0x7b6c
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3339
+	.byte	0x3
+	.value	0x3f0
+	.byte	0x7
+	.long	.LASF3613
+	.byte	0x1
+	.long	0x4160
+	.long	0x416b
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3d32
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3339
+	.byte	0x3
+	.value	0x405
+	.byte	0x7
+	.long	.LASF3614
+	.byte	0x1
+	.long	0x4181
+	.long	0x4191
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3d32
+	.uleb128 0x1
+	.long	0x7b53
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3342
+	.byte	0x3
+	.value	0x427
+	.byte	0x7
+	.long	.LASF3615
+	.byte	0x1
+	.long	0x41a7
+	.long	0x41ad
+	.uleb128 0x2
+	.long	0x7b44
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3344
+	.byte	0x3
+	.value	0x431
+	.byte	0x7
+	.long	.LASF3616
+	.long	0x3d32
+	.byte	0x1
+	.long	0x41c7
+	.long	0x41cd
+	.uleb128 0x2
+	.long	0x7b6c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3159
+	.byte	0x3
+	.value	0x43b
+	.byte	0x7
+	.long	.LASF3617
+	.long	0x4df0
+	.byte	0x1
+	.long	0x41e7
+	.long	0x41ed
+	.uleb128 0x2
+	.long	0x7b6c
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3346
+	.byte	0xc
+	.byte	0x43
+	.byte	0x5
+	.long	.LASF3618
+	.long	0x4201
+	.long	0x420c
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3d32
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3108
+	.byte	0x3
+	.value	0x1c3
+	.byte	0x31
+	.long	0x561a
+	.uleb128 0x3
+	.long	.LASF3161
+	.byte	0x3
+	.value	0x461
+	.byte	0x7
+	.long	.LASF3619
+	.long	0x420c
+	.byte	0x1
+	.long	0x4233
+	.long	0x423e
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3d32
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3113
+	.byte	0x3
+	.value	0x1c4
+	.byte	0x37
+	.long	0x5626
+	.uleb128 0x3
+	.long	.LASF3161
+	.byte	0x3
+	.value	0x474
+	.byte	0x7
+	.long	.LASF3620
+	.long	0x423e
+	.byte	0x1
+	.long	0x4265
+	.long	0x4270
+	.uleb128 0x2
+	.long	0x7b6c
+	.uleb128 0x1
+	.long	0x3d32
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3621
+	.byte	0x3
+	.value	0x47e
+	.byte	0x7
+	.long	.LASF3622
+	.byte	0x2
+	.long	0x4286
+	.long	0x4291
+	.uleb128 0x2
+	.long	0x7b6c
+	.uleb128 0x1
+	.long	0x3d32
+	.byte	0
+	.uleb128 0x35
+	.string	"at"
+	.byte	0x3
+	.value	0x495
+	.long	.LASF3623
+	.long	0x420c
+	.long	0x42a8
+	.long	0x42b3
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3d32
+	.byte	0
+	.uleb128 0x35
+	.string	"at"
+	.byte	0x3
+	.value	0x4a8
+	.long	.LASF3624
+	.long	0x423e
+	.long	0x42ca
+	.long	0x42d5
+	.uleb128 0x2
+	.long	0x7b6c
+	.uleb128 0x1
+	.long	0x3d32
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3165
+	.byte	0x3
+	.value	0x4b4
+	.byte	0x7
+	.long	.LASF3625
+	.long	0x420c
+	.byte	0x1
+	.long	0x42ef
+	.long	0x42f5
+	.uleb128 0x2
+	.long	0x7b44
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3165
+	.byte	0x3
+	.value	0x4c0
+	.byte	0x7
+	.long	.LASF3626
+	.long	0x423e
+	.byte	0x1
+	.long	0x430f
+	.long	0x4315
+	.uleb128 0x2
+	.long	0x7b6c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3167
+	.byte	0x3
+	.value	0x4cc
+	.byte	0x7
+	.long	.LASF3627
+	.long	0x420c
+	.byte	0x1
+	.long	0x432f
+	.long	0x4335
+	.uleb128 0x2
+	.long	0x7b44
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3167
+	.byte	0x3
+	.value	0x4d8
+	.byte	0x7
+	.long	.LASF3628
+	.long	0x423e
+	.byte	0x1
+	.long	0x434f
+	.long	0x4355
+	.uleb128 0x2
+	.long	0x7b6c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3168
+	.byte	0x3
+	.value	0x4e7
+	.byte	0x7
+	.long	.LASF3629
+	.long	0x7a9a
+	.byte	0x1
+	.long	0x436f
+	.long	0x4375
+	.uleb128 0x2
+	.long	0x7b44
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3168
+	.byte	0x3
+	.value	0x4ec
+	.byte	0x7
+	.long	.LASF3630
+	.long	0x7ab3
+	.byte	0x1
+	.long	0x438f
+	.long	0x4395
+	.uleb128 0x2
+	.long	0x7b6c
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3372
+	.byte	0x3
+	.value	0x4fc
+	.byte	0x7
+	.long	.LASF3631
+	.byte	0x1
+	.long	0x43ab
+	.long	0x43b6
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x7b53
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3372
+	.byte	0x3
+	.value	0x50d
+	.byte	0x7
+	.long	.LASF3632
+	.byte	0x1
+	.long	0x43cc
+	.long	0x43d7
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x7b76
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3395
+	.byte	0x3
+	.value	0x525
+	.byte	0x7
+	.long	.LASF3633
+	.byte	0x1
+	.long	0x43ed
+	.long	0x43f3
+	.uleb128 0x2
+	.long	0x7b44
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3381
+	.byte	0xc
+	.byte	0x85
+	.byte	0x5
+	.long	.LASF3634
+	.long	0x3f5a
+	.byte	0x1
+	.long	0x440c
+	.long	0x441c
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3f87
+	.uleb128 0x1
+	.long	0x7b53
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3381
+	.byte	0x3
+	.value	0x56c
+	.byte	0x7
+	.long	.LASF3635
+	.long	0x3f5a
+	.byte	0x1
+	.long	0x4436
+	.long	0x4446
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3f87
+	.uleb128 0x1
+	.long	0x7b76
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3381
+	.byte	0x3
+	.value	0x57e
+	.byte	0x7
+	.long	.LASF3636
+	.long	0x3f5a
+	.byte	0x1
+	.long	0x4460
+	.long	0x4470
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3f87
+	.uleb128 0x1
+	.long	0x47cd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3381
+	.byte	0x3
+	.value	0x598
+	.byte	0x7
+	.long	.LASF3637
+	.long	0x3f5a
+	.byte	0x1
+	.long	0x448a
+	.long	0x449f
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3f87
+	.uleb128 0x1
+	.long	0x3d32
+	.uleb128 0x1
+	.long	0x7b53
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3391
+	.byte	0x3
+	.value	0x5f9
+	.byte	0x7
+	.long	.LASF3638
+	.long	0x3f5a
+	.byte	0x1
+	.long	0x44b9
+	.long	0x44c4
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3f87
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3391
+	.byte	0x3
+	.value	0x615
+	.byte	0x7
+	.long	.LASF3639
+	.long	0x3f5a
+	.byte	0x1
+	.long	0x44de
+	.long	0x44ee
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3f87
+	.uleb128 0x1
+	.long	0x3f87
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3175
+	.byte	0x3
+	.value	0x62d
+	.byte	0x7
+	.long	.LASF3640
+	.byte	0x1
+	.long	0x4504
+	.long	0x450f
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x7b67
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3349
+	.byte	0x3
+	.value	0x640
+	.byte	0x7
+	.long	.LASF3641
+	.byte	0x1
+	.long	0x4525
+	.long	0x452b
+	.uleb128 0x2
+	.long	0x7b44
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3642
+	.byte	0x3
+	.value	0x6a3
+	.byte	0x7
+	.long	.LASF3643
+	.byte	0x2
+	.long	0x4541
+	.long	0x4551
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3d32
+	.uleb128 0x1
+	.long	0x7b53
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3644
+	.byte	0x3
+	.value	0x6ae
+	.byte	0x7
+	.long	.LASF3645
+	.byte	0x2
+	.long	0x4567
+	.long	0x4572
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3d32
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3646
+	.byte	0xc
+	.value	0x108
+	.byte	0x5
+	.long	.LASF3647
+	.byte	0x2
+	.long	0x4588
+	.long	0x4598
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x123
+	.uleb128 0x1
+	.long	0x7b53
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3648
+	.byte	0xc
+	.value	0x20b
+	.byte	0x5
+	.long	.LASF3649
+	.byte	0x2
+	.long	0x45ae
+	.long	0x45c3
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3f5a
+	.uleb128 0x1
+	.long	0x3d32
+	.uleb128 0x1
+	.long	0x7b53
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3650
+	.byte	0xc
+	.value	0x272
+	.byte	0x5
+	.long	.LASF3651
+	.byte	0x2
+	.long	0x45d9
+	.long	0x45e4
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3d32
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3652
+	.byte	0xc
+	.value	0x2bf
+	.byte	0x5
+	.long	.LASF3653
+	.long	0x4df0
+	.byte	0x2
+	.long	0x45fe
+	.long	0x4604
+	.uleb128 0x2
+	.long	0x7b44
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3654
+	.byte	0xc
+	.value	0x15e
+	.byte	0x5
+	.long	.LASF3655
+	.long	0x3f5a
+	.byte	0x2
+	.long	0x461e
+	.long	0x462e
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3f87
+	.uleb128 0x1
+	.long	0x7b76
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3656
+	.byte	0x3
+	.value	0x75c
+	.byte	0x7
+	.long	.LASF3657
+	.long	0x3f5a
+	.byte	0x2
+	.long	0x4648
+	.long	0x4658
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3f87
+	.uleb128 0x1
+	.long	0x7b76
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3658
+	.byte	0x3
+	.value	0x763
+	.byte	0x7
+	.long	.LASF3659
+	.long	0x3d32
+	.byte	0x2
+	.long	0x4672
+	.long	0x4682
+	.uleb128 0x2
+	.long	0x7b6c
+	.uleb128 0x1
+	.long	0x3d32
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x64
+	.long	.LASF3660
+	.value	0x76e
+	.long	.LASF3661
+	.long	0x3d32
+	.long	0x46a0
+	.uleb128 0x1
+	.long	0x3d32
+	.uleb128 0x1
+	.long	0x7b4e
+	.byte	0
+	.uleb128 0x64
+	.long	.LASF3662
+	.value	0x777
+	.long	.LASF3663
+	.long	0x3d32
+	.long	0x46b9
+	.uleb128 0x1
+	.long	0x7b7b
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3664
+	.byte	0x3
+	.value	0x788
+	.byte	0x7
+	.long	.LASF3665
+	.byte	0x2
+	.long	0x46cf
+	.long	0x46da
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3c1d
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3301
+	.byte	0xc
+	.byte	0xaf
+	.byte	0x5
+	.long	.LASF3666
+	.long	0x3f5a
+	.byte	0x2
+	.long	0x46f3
+	.long	0x46fe
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3f5a
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3301
+	.byte	0xc
+	.byte	0xbd
+	.byte	0x5
+	.long	.LASF3667
+	.long	0x3f5a
+	.byte	0x2
+	.long	0x4717
+	.long	0x4727
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3f5a
+	.uleb128 0x1
+	.long	0x3f5a
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3668
+	.byte	0x3
+	.value	0x7a2
+	.long	.LASF3669
+	.long	0x473b
+	.long	0x474b
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x7b5d
+	.uleb128 0x1
+	.long	0x30e
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3668
+	.byte	0x3
+	.value	0x7ae
+	.long	.LASF3670
+	.long	0x475f
+	.long	0x476f
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x7b5d
+	.uleb128 0x1
+	.long	0x117
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3671
+	.byte	0xc
+	.value	0x1b7
+	.byte	0x7
+	.long	.LASF3672
+	.byte	0x2
+	.long	0x4794
+	.long	0x47a4
+	.uleb128 0x40
+	.long	.LASF3527
+	.long	0x4794
+	.uleb128 0x41
+	.long	0x7abd
+	.byte	0
+	.uleb128 0x2
+	.long	0x7b44
+	.uleb128 0x1
+	.long	0x3f5a
+	.uleb128 0x1
+	.long	0x7abd
+	.byte	0
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5b74
+	.uleb128 0x47
+	.long	.LASF3458
+	.long	0x35f0
+	.byte	0
+	.uleb128 0x8
+	.long	0x3b8d
+	.uleb128 0x6
+	.long	.LASF3673
+	.byte	0x13
+	.byte	0x80
+	.byte	0xb
+	.long	0x3b77
+	.uleb128 0x8
+	.long	0x47bc
+	.uleb128 0x38
+	.long	.LASF3674
+	.uleb128 0x38
+	.long	.LASF3675
+	.uleb128 0x38
+	.long	.LASF3676
+	.uleb128 0x12
+	.long	.LASF3677
+	.byte	0x1
+	.byte	0x12
+	.byte	0xdd
+	.byte	0xc
+	.long	0x481a
+	.uleb128 0x6
+	.long	.LASF3678
+	.byte	0x12
+	.byte	0xdf
+	.byte	0x2a
+	.long	0x172
+	.uleb128 0x6
+	.long	.LASF3679
+	.byte	0x12
+	.byte	0xe1
+	.byte	0x19
+	.long	0x8a2
+	.uleb128 0x6
+	.long	.LASF3107
+	.byte	0x12
+	.byte	0xe2
+	.byte	0x1a
+	.long	0x7ab3
+	.uleb128 0x6
+	.long	.LASF3108
+	.byte	0x12
+	.byte	0xe3
+	.byte	0x1a
+	.long	0x7abd
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3680
+	.byte	0x1
+	.byte	0x12
+	.byte	0xd2
+	.byte	0xc
+	.long	0x484c
+	.uleb128 0x6
+	.long	.LASF3679
+	.byte	0x12
+	.byte	0xd6
+	.byte	0x19
+	.long	0x8a2
+	.uleb128 0x6
+	.long	.LASF3107
+	.byte	0x12
+	.byte	0xd7
+	.byte	0x14
+	.long	0x5e3d
+	.uleb128 0x6
+	.long	.LASF3108
+	.byte	0x12
+	.byte	0xd8
+	.byte	0x14
+	.long	0x7103
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3681
+	.byte	0x1
+	.byte	0x12
+	.byte	0xd2
+	.byte	0xc
+	.long	0x487e
+	.uleb128 0x6
+	.long	.LASF3679
+	.byte	0x12
+	.byte	0xd6
+	.byte	0x19
+	.long	0x8a2
+	.uleb128 0x6
+	.long	.LASF3107
+	.byte	0x12
+	.byte	0xd7
+	.byte	0x14
+	.long	0x7a9a
+	.uleb128 0x6
+	.long	.LASF3108
+	.byte	0x12
+	.byte	0xd8
+	.byte	0x14
+	.long	0x7aae
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3682
+	.byte	0x1
+	.byte	0x12
+	.byte	0xdd
+	.byte	0xc
+	.long	0x48b0
+	.uleb128 0x6
+	.long	.LASF3679
+	.byte	0x12
+	.byte	0xe1
+	.byte	0x19
+	.long	0x8a2
+	.uleb128 0x6
+	.long	.LASF3107
+	.byte	0x12
+	.byte	0xe2
+	.byte	0x1a
+	.long	0x5cb7
+	.uleb128 0x6
+	.long	.LASF3108
+	.byte	0x12
+	.byte	0xe3
+	.byte	0x1a
+	.long	0x7108
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF3683
+	.byte	0x13
+	.value	0x660
+	.long	0x48d3
+	.uleb128 0x16
+	.long	.LASF3568
+	.byte	0x13
+	.value	0x661
+	.byte	0x13
+	.long	0x5b7b
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x7abd
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF3684
+	.byte	0x13
+	.value	0x8b9
+	.long	0x48f6
+	.uleb128 0x16
+	.long	.LASF3568
+	.byte	0x13
+	.value	0x8ba
+	.byte	0x13
+	.long	0x7a9a
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x7a9a
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF3685
+	.byte	0x13
+	.value	0x660
+	.long	0x4919
+	.uleb128 0x16
+	.long	.LASF3568
+	.byte	0x13
+	.value	0x661
+	.byte	0x13
+	.long	0x9279
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x4b9b
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3686
+	.byte	0x1
+	.byte	0x12
+	.byte	0xa1
+	.byte	0xc
+	.long	0x4948
+	.uleb128 0x6
+	.long	.LASF3678
+	.byte	0x12
+	.byte	0xa8
+	.byte	0x35
+	.long	0x5aad
+	.uleb128 0x6
+	.long	.LASF3679
+	.byte	0x12
+	.byte	0xaa
+	.byte	0x33
+	.long	0x59ec
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x5892
+	.byte	0
+	.uleb128 0x65
+	.long	.LASF3688
+	.byte	0x34
+	.long	.LASF3690
+	.uleb128 0x65
+	.long	.LASF3689
+	.byte	0x37
+	.long	.LASF3691
+	.uleb128 0x60
+	.long	.LASF3692
+	.byte	0x24
+	.byte	0x4b
+	.byte	0x3
+	.long	.LASF3693
+	.long	0x4972
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3694
+	.byte	0x7
+	.byte	0xe6
+	.byte	0x5
+	.long	.LASF3695
+	.long	0x7abd
+	.long	0x499a
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5b74
+	.uleb128 0x1
+	.long	0x7abd
+	.uleb128 0x1
+	.long	0x7abd
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3696
+	.byte	0x13
+	.value	0x8c0
+	.byte	0xb
+	.long	0x48df
+	.uleb128 0xd
+	.long	.LASF3697
+	.byte	0x11
+	.value	0x44c
+	.byte	0x5
+	.long	.LASF3698
+	.long	0x499a
+	.long	0x49e3
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5b74
+	.uleb128 0xe
+	.string	"_Up"
+	.long	0x5b74
+	.uleb128 0x1
+	.long	0x7a9a
+	.uleb128 0x1
+	.long	0x7a9a
+	.uleb128 0x1
+	.long	0x7a9a
+	.uleb128 0x1
+	.long	0x7ad1
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3699
+	.byte	0x7
+	.value	0x139
+	.byte	0x5
+	.long	.LASF3700
+	.long	0x7a9a
+	.long	0x4a07
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x7a9a
+	.uleb128 0x1
+	.long	0x7a9a
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3701
+	.byte	0x7
+	.byte	0x5a
+	.byte	0x5
+	.long	.LASF3702
+	.long	0x5b95
+	.long	0x4a3d
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5cc1
+	.uleb128 0xe
+	.string	"_Up"
+	.long	0x5cc1
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF3703
+	.byte	0x10
+	.byte	0xb7
+	.byte	0x5
+	.long	.LASF3705
+	.long	0x4a6f
+	.uleb128 0x7
+	.long	.LASF3706
+	.long	0x5892
+	.uleb128 0x7
+	.long	.LASF3707
+	.long	0x5ba2
+	.uleb128 0x1
+	.long	0x7bbc
+	.uleb128 0x1
+	.long	0x5ba2
+	.uleb128 0x1
+	.long	0x172
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3708
+	.byte	0x10
+	.byte	0x63
+	.byte	0x5
+	.long	.LASF3709
+	.long	0x4932
+	.long	0x4a9c
+	.uleb128 0x7
+	.long	.LASF3706
+	.long	0x5892
+	.uleb128 0x1
+	.long	0x5892
+	.uleb128 0x1
+	.long	0x5892
+	.uleb128 0x1
+	.long	0x172
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3710
+	.byte	0x12
+	.byte	0xee
+	.byte	0x5
+	.long	.LASF3711
+	.long	0x4926
+	.long	0x4abf
+	.uleb128 0x7
+	.long	.LASF3712
+	.long	0x5892
+	.uleb128 0x1
+	.long	0x80ed
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3713
+	.byte	0x11
+	.value	0x467
+	.byte	0x5
+	.long	.LASF3714
+	.long	0x7a9a
+	.long	0x4b04
+	.uleb128 0x7
+	.long	.LASF3715
+	.long	0x7a9a
+	.uleb128 0x7
+	.long	.LASF3071
+	.long	0x7a9a
+	.uleb128 0x7
+	.long	.LASF3716
+	.long	0x35f0
+	.uleb128 0x1
+	.long	0x7a9a
+	.uleb128 0x1
+	.long	0x7a9a
+	.uleb128 0x1
+	.long	0x7a9a
+	.uleb128 0x1
+	.long	0x7ad1
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3717
+	.byte	0x7
+	.byte	0xfe
+	.byte	0x5
+	.long	.LASF3718
+	.long	0x7abd
+	.long	0x4b2c
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5b74
+	.uleb128 0x1
+	.long	0x7abd
+	.uleb128 0x1
+	.long	0x7abd
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF3719
+	.byte	0x10
+	.byte	0xda
+	.byte	0x5
+	.long	.LASF3720
+	.long	0x4b59
+	.uleb128 0x7
+	.long	.LASF3715
+	.long	0x5892
+	.uleb128 0x7
+	.long	.LASF3707
+	.long	0x5ba2
+	.uleb128 0x1
+	.long	0x7bbc
+	.uleb128 0x1
+	.long	0x5ba2
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3721
+	.byte	0x10
+	.byte	0x93
+	.byte	0x5
+	.long	.LASF3722
+	.long	0x4932
+	.long	0x4b81
+	.uleb128 0x7
+	.long	.LASF3715
+	.long	0x5892
+	.uleb128 0x1
+	.long	0x5892
+	.uleb128 0x1
+	.long	0x5892
+	.byte	0
+	.uleb128 0x80
+	.long	.LASF3735
+	.byte	0xf
+	.byte	0x68
+	.byte	0x5
+	.long	0x84b2
+	.long	0x4ba6
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x4b9b
+	.uleb128 0xa
+	.long	0x9279
+	.uleb128 0x1
+	.long	0x4b9b
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3723
+	.byte	0xf
+	.byte	0x4d
+	.byte	0x5
+	.long	.LASF3724
+	.long	0x7abd
+	.long	0x4bc9
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x7abd
+	.uleb128 0x1
+	.long	0x8740
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3725
+	.byte	0x7
+	.value	0x4b4
+	.byte	0x5
+	.long	.LASF3726
+	.long	0x4df0
+	.long	0x4c00
+	.uleb128 0x7
+	.long	.LASF3727
+	.long	0x5cb7
+	.uleb128 0x7
+	.long	.LASF3728
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5e3d
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3729
+	.byte	0x7
+	.value	0x139
+	.byte	0x5
+	.long	.LASF3730
+	.long	0x5e3d
+	.long	0x4c24
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5e3d
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3731
+	.byte	0x7
+	.value	0x139
+	.byte	0x5
+	.long	.LASF3732
+	.long	0x5cb7
+	.long	0x4c48
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF3733
+	.byte	0xe
+	.byte	0xb6
+	.byte	0x5
+	.long	.LASF3734
+	.long	0x4c6c
+	.uleb128 0x7
+	.long	.LASF3071
+	.long	0x7a9a
+	.uleb128 0x1
+	.long	0x7a9a
+	.uleb128 0x1
+	.long	0x7a9a
+	.byte	0
+	.uleb128 0x66
+	.long	.LASF3736
+	.byte	0x7
+	.value	0x5aa
+	.long	0x5892
+	.long	0x4cac
+	.uleb128 0x7
+	.long	.LASF3071
+	.long	0x5892
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x4de4
+	.uleb128 0x7
+	.long	.LASF3737
+	.long	0x4e16
+	.uleb128 0x1
+	.long	0x5892
+	.uleb128 0x1
+	.long	0x5892
+	.uleb128 0x1
+	.long	0x762c
+	.uleb128 0x1
+	.long	0x4e16
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3738
+	.byte	0x7
+	.value	0x4c0
+	.byte	0x5
+	.long	.LASF3739
+	.long	0x4df0
+	.long	0x4ce3
+	.uleb128 0x7
+	.long	.LASF3727
+	.long	0x5cb7
+	.uleb128 0x7
+	.long	.LASF3728
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5e3d
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF3740
+	.byte	0xb
+	.value	0x34f
+	.byte	0x5
+	.long	.LASF3741
+	.long	0x4d16
+	.uleb128 0x7
+	.long	.LASF3071
+	.long	0x7a9a
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5b74
+	.uleb128 0x1
+	.long	0x7a9a
+	.uleb128 0x1
+	.long	0x7a9a
+	.uleb128 0x1
+	.long	0x7ad1
+	.byte	0
+	.uleb128 0x66
+	.long	.LASF3742
+	.byte	0x8
+	.value	0x7ca
+	.long	0x5892
+	.long	0x4d56
+	.uleb128 0x7
+	.long	.LASF3743
+	.long	0x5892
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x4de4
+	.uleb128 0x7
+	.long	.LASF3737
+	.long	0x9279
+	.uleb128 0x1
+	.long	0x5892
+	.uleb128 0x1
+	.long	0x5892
+	.uleb128 0x1
+	.long	0x762c
+	.uleb128 0x1
+	.long	0x9279
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3744
+	.byte	0x7
+	.value	0x609
+	.byte	0x5
+	.long	.LASF3745
+	.long	0x4df0
+	.long	0x4d8d
+	.uleb128 0x7
+	.long	.LASF3727
+	.long	0x5cb7
+	.uleb128 0x7
+	.long	.LASF3728
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5e3d
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3746
+	.byte	0x6
+	.byte	0x6a
+	.byte	0x5
+	.long	.LASF3747
+	.long	0x5cb7
+	.long	0x4dba
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5cc8
+	.uleb128 0x3f
+	.string	"_Nm"
+	.long	0x5b74
+	.byte	0x8
+	.uleb128 0x1
+	.long	0x905c
+	.byte	0
+	.uleb128 0x67
+	.long	.LASF3748
+	.byte	0x6
+	.byte	0x5f
+	.byte	0x5
+	.long	.LASF3749
+	.long	0x5cb7
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5cc8
+	.uleb128 0x3f
+	.string	"_Nm"
+	.long	0x5b74
+	.byte	0x8
+	.uleb128 0x1
+	.long	0x905c
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF3750
+	.uleb128 0x8
+	.long	0x4de4
+	.uleb128 0x1d
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF3751
+	.uleb128 0x8
+	.long	0x4df0
+	.uleb128 0x81
+	.long	.LASF3752
+	.byte	0x14
+	.value	0x14d
+	.byte	0xb
+	.long	0x5b66
+	.uleb128 0x44
+	.long	.LASF3753
+	.byte	0xd
+	.byte	0x25
+	.byte	0xb
+	.long	0x4f1b
+	.uleb128 0x12
+	.long	.LASF3754
+	.byte	0x8
+	.byte	0xd
+	.byte	0xa8
+	.byte	0xc
+	.long	0x4ebc
+	.uleb128 0x5
+	.long	.LASF3755
+	.byte	0xd
+	.byte	0xaa
+	.byte	0x10
+	.long	0x9279
+	.byte	0
+	.uleb128 0x49
+	.long	.LASF3756
+	.byte	0xae
+	.long	0x4e3e
+	.long	0x4e49
+	.uleb128 0x2
+	.long	0x7bf8
+	.uleb128 0x1
+	.long	0x9279
+	.byte	0
+	.uleb128 0x49
+	.long	.LASF3756
+	.byte	0xb4
+	.long	0x4e57
+	.long	0x4e62
+	.uleb128 0x2
+	.long	0x7bf8
+	.uleb128 0x1
+	.long	0x7c02
+	.byte	0
+	.uleb128 0x49
+	.long	.LASF3756
+	.byte	0xbb
+	.long	0x4e70
+	.long	0x4e7b
+	.uleb128 0x2
+	.long	0x7bf8
+	.uleb128 0x1
+	.long	0x7c07
+	.byte	0
+	.uleb128 0x82
+	.long	.LASF3757
+	.byte	0xd
+	.byte	0xc3
+	.byte	0x2
+	.long	0x4df0
+	.long	0x4ea2
+	.long	0x4eb2
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x5892
+	.uleb128 0x7
+	.long	.LASF3758
+	.long	0x4deb
+	.uleb128 0x2
+	.long	0x7bf8
+	.uleb128 0x1
+	.long	0x5892
+	.uleb128 0x1
+	.long	0x762c
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3737
+	.long	0x9279
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3759
+	.byte	0x8
+	.byte	0xd
+	.byte	0x91
+	.byte	0xc
+	.long	0x4ef9
+	.uleb128 0x5
+	.long	.LASF3755
+	.byte	0xd
+	.byte	0x93
+	.byte	0x10
+	.long	0x9279
+	.byte	0
+	.uleb128 0x49
+	.long	.LASF3760
+	.byte	0x96
+	.long	0x4ee4
+	.long	0x4eef
+	.uleb128 0x2
+	.long	0x7c2f
+	.uleb128 0x1
+	.long	0x9279
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3737
+	.long	0x9279
+	.byte	0
+	.uleb128 0x8
+	.long	0x4ebc
+	.uleb128 0x83
+	.long	.LASF4195
+	.byte	0xd
+	.byte	0xca
+	.byte	0x5
+	.long	0x4e16
+	.uleb128 0x7
+	.long	.LASF3737
+	.long	0x9279
+	.uleb128 0x1
+	.long	0x9279
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xc8
+	.byte	0xb
+	.long	0x5cab
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xd8
+	.byte	0xb
+	.long	0x6153
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xe3
+	.byte	0xb
+	.long	0x616f
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xe4
+	.byte	0xb
+	.long	0x6185
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xe5
+	.byte	0xb
+	.long	0x61a5
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xe7
+	.byte	0xb
+	.long	0x61c5
+	.uleb128 0x4
+	.byte	0x16
+	.byte	0xe8
+	.byte	0xb
+	.long	0x61e0
+	.uleb128 0x84
+	.string	"div"
+	.byte	0x16
+	.byte	0xd5
+	.byte	0x3
+	.long	.LASF4234
+	.long	0x5cab
+	.long	0x4f73
+	.uleb128 0x1
+	.long	0x5ba9
+	.uleb128 0x1
+	.long	0x5ba9
+	.byte	0
+	.uleb128 0x4
+	.byte	0x19
+	.byte	0xfb
+	.byte	0xb
+	.long	0x707d
+	.uleb128 0x20
+	.byte	0x19
+	.value	0x104
+	.byte	0xb
+	.long	0x7099
+	.uleb128 0x20
+	.byte	0x19
+	.value	0x105
+	.byte	0xb
+	.long	0x70ba
+	.uleb128 0x12
+	.long	.LASF3761
+	.byte	0x1
+	.byte	0x25
+	.byte	0x30
+	.byte	0xa
+	.long	0x50b4
+	.uleb128 0x4
+	.byte	0x25
+	.byte	0x30
+	.byte	0xa
+	.long	0x1568
+	.uleb128 0x4
+	.byte	0x25
+	.byte	0x30
+	.byte	0xa
+	.long	0x1529
+	.uleb128 0x4
+	.byte	0x25
+	.byte	0x30
+	.byte	0xa
+	.long	0x159a
+	.uleb128 0x4
+	.byte	0x25
+	.byte	0x30
+	.byte	0xa
+	.long	0x15bb
+	.uleb128 0x34
+	.long	0x1510
+	.uleb128 0x15
+	.long	.LASF3762
+	.byte	0x25
+	.byte	0x61
+	.byte	0x1d
+	.long	.LASF3763
+	.long	0xa36
+	.long	0x4fd9
+	.uleb128 0x1
+	.long	0x7112
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF3764
+	.byte	0x25
+	.byte	0x64
+	.byte	0x1b
+	.long	.LASF3765
+	.long	0x4ff4
+	.uleb128 0x1
+	.long	0x7117
+	.uleb128 0x1
+	.long	0x7117
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF3766
+	.byte	0x67
+	.long	.LASF3767
+	.long	0x4df0
+	.uleb128 0x2f
+	.long	.LASF3768
+	.byte	0x6a
+	.long	.LASF3769
+	.long	0x4df0
+	.uleb128 0x2f
+	.long	.LASF3770
+	.byte	0x6d
+	.long	.LASF3771
+	.long	0x4df0
+	.uleb128 0x2f
+	.long	.LASF3772
+	.byte	0x70
+	.long	.LASF3773
+	.long	0x4df0
+	.uleb128 0x2f
+	.long	.LASF3774
+	.byte	0x73
+	.long	.LASF3775
+	.long	0x4df0
+	.uleb128 0x6
+	.long	.LASF3056
+	.byte	0x25
+	.byte	0x38
+	.byte	0x2d
+	.long	0x15f1
+	.uleb128 0x8
+	.long	0x503a
+	.uleb128 0x6
+	.long	.LASF3107
+	.byte	0x25
+	.byte	0x39
+	.byte	0x2a
+	.long	0x151c
+	.uleb128 0x6
+	.long	.LASF3109
+	.byte	0x25
+	.byte	0x3a
+	.byte	0x30
+	.long	0x15fe
+	.uleb128 0x6
+	.long	.LASF3116
+	.byte	0x25
+	.byte	0x3b
+	.byte	0x2c
+	.long	0x155b
+	.uleb128 0x6
+	.long	.LASF3108
+	.byte	0x25
+	.byte	0x3e
+	.byte	0x19
+	.long	0x75cc
+	.uleb128 0x6
+	.long	.LASF3113
+	.byte	0x25
+	.byte	0x3f
+	.byte	0x1f
+	.long	0x75d1
+	.uleb128 0x12
+	.long	.LASF3776
+	.byte	0x1
+	.byte	0x25
+	.byte	0x77
+	.byte	0xe
+	.long	0x50aa
+	.uleb128 0x6
+	.long	.LASF3777
+	.byte	0x25
+	.byte	0x78
+	.byte	0x41
+	.long	0x160b
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5cc1
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3458
+	.long	0xa36
+	.byte	0
+	.uleb128 0x45
+	.long	.LASF3778
+	.byte	0x8
+	.byte	0x9
+	.value	0x413
+	.long	0x52e2
+	.uleb128 0x4a
+	.long	.LASF3804
+	.long	0x5e3d
+	.uleb128 0xc
+	.long	.LASF3779
+	.byte	0x9
+	.value	0x42c
+	.byte	0x11
+	.long	.LASF3780
+	.byte	0x1
+	.long	0x50e0
+	.long	0x50e6
+	.uleb128 0x2
+	.long	0x7c20
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF3779
+	.byte	0x9
+	.value	0x430
+	.long	.LASF3781
+	.long	0x50fa
+	.long	0x5105
+	.uleb128 0x2
+	.long	0x7c20
+	.uleb128 0x1
+	.long	0x7bc1
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3108
+	.byte	0x9
+	.value	0x425
+	.byte	0x31
+	.long	0x483f
+	.uleb128 0x3
+	.long	.LASF3782
+	.byte	0x9
+	.value	0x447
+	.byte	0x7
+	.long	.LASF3783
+	.long	0x5105
+	.byte	0x1
+	.long	0x512c
+	.long	0x5132
+	.uleb128 0x2
+	.long	0x7c25
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3107
+	.byte	0x9
+	.value	0x426
+	.byte	0x2f
+	.long	0x4833
+	.uleb128 0x3
+	.long	.LASF3784
+	.byte	0x9
+	.value	0x44c
+	.byte	0x7
+	.long	.LASF3785
+	.long	0x5132
+	.byte	0x1
+	.long	0x5159
+	.long	0x515f
+	.uleb128 0x2
+	.long	0x7c25
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3786
+	.byte	0x9
+	.value	0x451
+	.byte	0x7
+	.long	.LASF3787
+	.long	0x7c2a
+	.byte	0x1
+	.long	0x5179
+	.long	0x517f
+	.uleb128 0x2
+	.long	0x7c20
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3786
+	.byte	0x9
+	.value	0x459
+	.byte	0x7
+	.long	.LASF3788
+	.long	0x50b4
+	.byte	0x1
+	.long	0x5199
+	.long	0x51a4
+	.uleb128 0x2
+	.long	0x7c20
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3789
+	.byte	0x9
+	.value	0x45f
+	.byte	0x7
+	.long	.LASF3790
+	.long	0x7c2a
+	.byte	0x1
+	.long	0x51be
+	.long	0x51c4
+	.uleb128 0x2
+	.long	0x7c20
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3789
+	.byte	0x9
+	.value	0x467
+	.byte	0x7
+	.long	.LASF3791
+	.long	0x50b4
+	.byte	0x1
+	.long	0x51de
+	.long	0x51e9
+	.uleb128 0x2
+	.long	0x7c20
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3161
+	.byte	0x9
+	.value	0x46d
+	.byte	0x7
+	.long	.LASF3792
+	.long	0x5105
+	.byte	0x1
+	.long	0x5203
+	.long	0x520e
+	.uleb128 0x2
+	.long	0x7c25
+	.uleb128 0x1
+	.long	0x520e
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3679
+	.byte	0x9
+	.value	0x424
+	.byte	0x37
+	.long	0x4827
+	.uleb128 0x3
+	.long	.LASF3360
+	.byte	0x9
+	.value	0x472
+	.byte	0x7
+	.long	.LASF3793
+	.long	0x7c2a
+	.byte	0x1
+	.long	0x5235
+	.long	0x5240
+	.uleb128 0x2
+	.long	0x7c20
+	.uleb128 0x1
+	.long	0x520e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3794
+	.byte	0x9
+	.value	0x477
+	.byte	0x7
+	.long	.LASF3795
+	.long	0x50b4
+	.byte	0x1
+	.long	0x525a
+	.long	0x5265
+	.uleb128 0x2
+	.long	0x7c25
+	.uleb128 0x1
+	.long	0x520e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3796
+	.byte	0x9
+	.value	0x47c
+	.byte	0x7
+	.long	.LASF3797
+	.long	0x7c2a
+	.byte	0x1
+	.long	0x527f
+	.long	0x528a
+	.uleb128 0x2
+	.long	0x7c20
+	.uleb128 0x1
+	.long	0x520e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3798
+	.byte	0x9
+	.value	0x481
+	.byte	0x7
+	.long	.LASF3799
+	.long	0x50b4
+	.byte	0x1
+	.long	0x52a4
+	.long	0x52af
+	.uleb128 0x2
+	.long	0x7c25
+	.uleb128 0x1
+	.long	0x520e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3800
+	.byte	0x9
+	.value	0x486
+	.byte	0x7
+	.long	.LASF3801
+	.long	0x7bc1
+	.byte	0x1
+	.long	0x52c9
+	.long	0x52cf
+	.uleb128 0x2
+	.long	0x7c25
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x5e3d
+	.uleb128 0x7
+	.long	.LASF3802
+	.long	0x1626
+	.byte	0
+	.uleb128 0x8
+	.long	0x50b4
+	.uleb128 0x45
+	.long	.LASF3803
+	.byte	0x8
+	.byte	0x9
+	.value	0x413
+	.long	0x5515
+	.uleb128 0x4a
+	.long	.LASF3804
+	.long	0x5cb7
+	.uleb128 0xc
+	.long	.LASF3779
+	.byte	0x9
+	.value	0x42c
+	.byte	0x11
+	.long	.LASF3805
+	.byte	0x1
+	.long	0x5313
+	.long	0x5319
+	.uleb128 0x2
+	.long	0x7c0c
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF3779
+	.byte	0x9
+	.value	0x430
+	.long	.LASF3806
+	.long	0x532d
+	.long	0x5338
+	.uleb128 0x2
+	.long	0x7c0c
+	.uleb128 0x1
+	.long	0x7c11
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3108
+	.byte	0x9
+	.value	0x425
+	.byte	0x31
+	.long	0x48a3
+	.uleb128 0x3
+	.long	.LASF3782
+	.byte	0x9
+	.value	0x447
+	.byte	0x7
+	.long	.LASF3807
+	.long	0x5338
+	.byte	0x1
+	.long	0x535f
+	.long	0x5365
+	.uleb128 0x2
+	.long	0x7c16
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3107
+	.byte	0x9
+	.value	0x426
+	.byte	0x2f
+	.long	0x4897
+	.uleb128 0x3
+	.long	.LASF3784
+	.byte	0x9
+	.value	0x44c
+	.byte	0x7
+	.long	.LASF3808
+	.long	0x5365
+	.byte	0x1
+	.long	0x538c
+	.long	0x5392
+	.uleb128 0x2
+	.long	0x7c16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3786
+	.byte	0x9
+	.value	0x451
+	.byte	0x7
+	.long	.LASF3809
+	.long	0x7c1b
+	.byte	0x1
+	.long	0x53ac
+	.long	0x53b2
+	.uleb128 0x2
+	.long	0x7c0c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3786
+	.byte	0x9
+	.value	0x459
+	.byte	0x7
+	.long	.LASF3810
+	.long	0x52e7
+	.byte	0x1
+	.long	0x53cc
+	.long	0x53d7
+	.uleb128 0x2
+	.long	0x7c0c
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3789
+	.byte	0x9
+	.value	0x45f
+	.byte	0x7
+	.long	.LASF3811
+	.long	0x7c1b
+	.byte	0x1
+	.long	0x53f1
+	.long	0x53f7
+	.uleb128 0x2
+	.long	0x7c0c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3789
+	.byte	0x9
+	.value	0x467
+	.byte	0x7
+	.long	.LASF3812
+	.long	0x52e7
+	.byte	0x1
+	.long	0x5411
+	.long	0x541c
+	.uleb128 0x2
+	.long	0x7c0c
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3161
+	.byte	0x9
+	.value	0x46d
+	.byte	0x7
+	.long	.LASF3813
+	.long	0x5338
+	.byte	0x1
+	.long	0x5436
+	.long	0x5441
+	.uleb128 0x2
+	.long	0x7c16
+	.uleb128 0x1
+	.long	0x5441
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3679
+	.byte	0x9
+	.value	0x424
+	.byte	0x37
+	.long	0x488b
+	.uleb128 0x3
+	.long	.LASF3360
+	.byte	0x9
+	.value	0x472
+	.byte	0x7
+	.long	.LASF3814
+	.long	0x7c1b
+	.byte	0x1
+	.long	0x5468
+	.long	0x5473
+	.uleb128 0x2
+	.long	0x7c0c
+	.uleb128 0x1
+	.long	0x5441
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3794
+	.byte	0x9
+	.value	0x477
+	.byte	0x7
+	.long	.LASF3815
+	.long	0x52e7
+	.byte	0x1
+	.long	0x548d
+	.long	0x5498
+	.uleb128 0x2
+	.long	0x7c16
+	.uleb128 0x1
+	.long	0x5441
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3796
+	.byte	0x9
+	.value	0x47c
+	.byte	0x7
+	.long	.LASF3816
+	.long	0x7c1b
+	.byte	0x1
+	.long	0x54b2
+	.long	0x54bd
+	.uleb128 0x2
+	.long	0x7c0c
+	.uleb128 0x1
+	.long	0x5441
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3798
+	.byte	0x9
+	.value	0x481
+	.byte	0x7
+	.long	.LASF3817
+	.long	0x52e7
+	.byte	0x1
+	.long	0x54d7
+	.long	0x54e2
+	.uleb128 0x2
+	.long	0x7c16
+	.uleb128 0x1
+	.long	0x5441
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3800
+	.byte	0x9
+	.value	0x486
+	.byte	0x7
+	.long	.LASF3818
+	.long	0x7c11
+	.byte	0x1
+	.long	0x54fc
+	.long	0x5502
+	.uleb128 0x2
+	.long	0x7c16
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x5cb7
+	.uleb128 0x7
+	.long	.LASF3802
+	.long	0x1626
+	.byte	0
+	.uleb128 0x8
+	.long	0x52e7
+	.uleb128 0x61
+	.long	.LASF3820
+	.long	0x4de4
+	.byte	0x27
+	.byte	0x31
+	.byte	0x8
+	.long	0x553d
+	.uleb128 0x17
+	.long	.LASF3821
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF3822
+	.byte	0x1
+	.uleb128 0x17
+	.long	.LASF3823
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	0x551a
+	.uleb128 0x85
+	.long	.LASF4235
+	.byte	0x27
+	.byte	0x35
+	.byte	0x1d
+	.long	0x553d
+	.byte	0x2
+	.uleb128 0x12
+	.long	.LASF3824
+	.byte	0x1
+	.byte	0x25
+	.byte	0x30
+	.byte	0xa
+	.long	0x565f
+	.uleb128 0x4
+	.byte	0x25
+	.byte	0x30
+	.byte	0xa
+	.long	0x36d6
+	.uleb128 0x4
+	.byte	0x25
+	.byte	0x30
+	.byte	0xa
+	.long	0x3697
+	.uleb128 0x4
+	.byte	0x25
+	.byte	0x30
+	.byte	0xa
+	.long	0x3708
+	.uleb128 0x4
+	.byte	0x25
+	.byte	0x30
+	.byte	0xa
+	.long	0x3729
+	.uleb128 0x34
+	.long	0x367e
+	.uleb128 0x15
+	.long	.LASF3762
+	.byte	0x25
+	.byte	0x61
+	.byte	0x1d
+	.long	.LASF3825
+	.long	0x35f0
+	.long	0x559c
+	.uleb128 0x1
+	.long	0x7acc
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF3764
+	.byte	0x25
+	.byte	0x64
+	.byte	0x1b
+	.long	.LASF3826
+	.long	0x55b7
+	.uleb128 0x1
+	.long	0x7ad1
+	.uleb128 0x1
+	.long	0x7ad1
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF3766
+	.byte	0x67
+	.long	.LASF3827
+	.long	0x4df0
+	.uleb128 0x2f
+	.long	.LASF3768
+	.byte	0x6a
+	.long	.LASF3828
+	.long	0x4df0
+	.uleb128 0x2f
+	.long	.LASF3770
+	.byte	0x6d
+	.long	.LASF3829
+	.long	0x4df0
+	.uleb128 0x2f
+	.long	.LASF3772
+	.byte	0x70
+	.long	.LASF3830
+	.long	0x4df0
+	.uleb128 0x2f
+	.long	.LASF3774
+	.byte	0x73
+	.long	.LASF3831
+	.long	0x4df0
+	.uleb128 0x6
+	.long	.LASF3056
+	.byte	0x25
+	.byte	0x38
+	.byte	0x2d
+	.long	0x375f
+	.uleb128 0x8
+	.long	0x55fd
+	.uleb128 0x6
+	.long	.LASF3107
+	.byte	0x25
+	.byte	0x39
+	.byte	0x2a
+	.long	0x368a
+	.uleb128 0x6
+	.long	.LASF3108
+	.byte	0x25
+	.byte	0x3e
+	.byte	0x19
+	.long	0x7ae0
+	.uleb128 0x6
+	.long	.LASF3113
+	.byte	0x25
+	.byte	0x3f
+	.byte	0x1f
+	.long	0x7ae5
+	.uleb128 0x12
+	.long	.LASF3832
+	.byte	0x1
+	.byte	0x25
+	.byte	0x77
+	.byte	0xe
+	.long	0x5655
+	.uleb128 0x6
+	.long	.LASF3777
+	.byte	0x25
+	.byte	0x78
+	.byte	0x41
+	.long	0x376c
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5b74
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3458
+	.long	0x35f0
+	.byte	0
+	.uleb128 0x45
+	.long	.LASF3833
+	.byte	0x8
+	.byte	0x9
+	.value	0x413
+	.long	0x588d
+	.uleb128 0x4a
+	.long	.LASF3804
+	.long	0x7a9a
+	.uleb128 0xc
+	.long	.LASF3779
+	.byte	0x9
+	.value	0x42c
+	.byte	0x11
+	.long	.LASF3834
+	.byte	0x1
+	.long	0x568b
+	.long	0x5691
+	.uleb128 0x2
+	.long	0x7bc6
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF3779
+	.byte	0x9
+	.value	0x430
+	.long	.LASF3835
+	.long	0x56a5
+	.long	0x56b0
+	.uleb128 0x2
+	.long	0x7bc6
+	.uleb128 0x1
+	.long	0x7bd0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3108
+	.byte	0x9
+	.value	0x425
+	.byte	0x31
+	.long	0x4871
+	.uleb128 0x3
+	.long	.LASF3782
+	.byte	0x9
+	.value	0x447
+	.byte	0x7
+	.long	.LASF3836
+	.long	0x56b0
+	.byte	0x1
+	.long	0x56d7
+	.long	0x56dd
+	.uleb128 0x2
+	.long	0x7bd5
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3107
+	.byte	0x9
+	.value	0x426
+	.byte	0x2f
+	.long	0x4865
+	.uleb128 0x3
+	.long	.LASF3784
+	.byte	0x9
+	.value	0x44c
+	.byte	0x7
+	.long	.LASF3837
+	.long	0x56dd
+	.byte	0x1
+	.long	0x5704
+	.long	0x570a
+	.uleb128 0x2
+	.long	0x7bd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3786
+	.byte	0x9
+	.value	0x451
+	.byte	0x7
+	.long	.LASF3838
+	.long	0x7bdf
+	.byte	0x1
+	.long	0x5724
+	.long	0x572a
+	.uleb128 0x2
+	.long	0x7bc6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3786
+	.byte	0x9
+	.value	0x459
+	.byte	0x7
+	.long	.LASF3839
+	.long	0x565f
+	.byte	0x1
+	.long	0x5744
+	.long	0x574f
+	.uleb128 0x2
+	.long	0x7bc6
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3789
+	.byte	0x9
+	.value	0x45f
+	.byte	0x7
+	.long	.LASF3840
+	.long	0x7bdf
+	.byte	0x1
+	.long	0x5769
+	.long	0x576f
+	.uleb128 0x2
+	.long	0x7bc6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3789
+	.byte	0x9
+	.value	0x467
+	.byte	0x7
+	.long	.LASF3841
+	.long	0x565f
+	.byte	0x1
+	.long	0x5789
+	.long	0x5794
+	.uleb128 0x2
+	.long	0x7bc6
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3161
+	.byte	0x9
+	.value	0x46d
+	.byte	0x7
+	.long	.LASF3842
+	.long	0x56b0
+	.byte	0x1
+	.long	0x57ae
+	.long	0x57b9
+	.uleb128 0x2
+	.long	0x7bd5
+	.uleb128 0x1
+	.long	0x57b9
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3679
+	.byte	0x9
+	.value	0x424
+	.byte	0x37
+	.long	0x4859
+	.uleb128 0x3
+	.long	.LASF3360
+	.byte	0x9
+	.value	0x472
+	.byte	0x7
+	.long	.LASF3843
+	.long	0x7bdf
+	.byte	0x1
+	.long	0x57e0
+	.long	0x57eb
+	.uleb128 0x2
+	.long	0x7bc6
+	.uleb128 0x1
+	.long	0x57b9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3794
+	.byte	0x9
+	.value	0x477
+	.byte	0x7
+	.long	.LASF3844
+	.long	0x565f
+	.byte	0x1
+	.long	0x5805
+	.long	0x5810
+	.uleb128 0x2
+	.long	0x7bd5
+	.uleb128 0x1
+	.long	0x57b9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3796
+	.byte	0x9
+	.value	0x47c
+	.byte	0x7
+	.long	.LASF3845
+	.long	0x7bdf
+	.byte	0x1
+	.long	0x582a
+	.long	0x5835
+	.uleb128 0x2
+	.long	0x7bc6
+	.uleb128 0x1
+	.long	0x57b9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3798
+	.byte	0x9
+	.value	0x481
+	.byte	0x7
+	.long	.LASF3846
+	.long	0x565f
+	.byte	0x1
+	.long	0x584f
+	.long	0x585a
+	.uleb128 0x2
+	.long	0x7bd5
+	.uleb128 0x1
+	.long	0x57b9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3800
+	.byte	0x9
+	.value	0x486
+	.byte	0x7
+	.long	.LASF3847
+	.long	0x7bd0
+	.byte	0x1
+	.long	0x5874
+	.long	0x587a
+	.uleb128 0x2
+	.long	0x7bd5
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x7a9a
+	.uleb128 0x7
+	.long	.LASF3802
+	.long	0x3b8d
+	.byte	0
+	.uleb128 0x8
+	.long	0x565f
+	.uleb128 0x45
+	.long	.LASF3848
+	.byte	0x8
+	.byte	0x9
+	.value	0x413
+	.long	0x5acd
+	.uleb128 0x4a
+	.long	.LASF3804
+	.long	0x7ab3
+	.uleb128 0xc
+	.long	.LASF3779
+	.byte	0x9
+	.value	0x42c
+	.byte	0x11
+	.long	.LASF3849
+	.byte	0x1
+	.long	0x58be
+	.long	0x58c4
+	.uleb128 0x2
+	.long	0x7ba3
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF3779
+	.byte	0x9
+	.value	0x430
+	.long	.LASF3850
+	.long	0x58d8
+	.long	0x58e3
+	.uleb128 0x2
+	.long	0x7ba3
+	.uleb128 0x1
+	.long	0x7bad
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3108
+	.byte	0x9
+	.value	0x425
+	.byte	0x31
+	.long	0x480d
+	.uleb128 0x3
+	.long	.LASF3782
+	.byte	0x9
+	.value	0x447
+	.byte	0x7
+	.long	.LASF3851
+	.long	0x58e3
+	.byte	0x1
+	.long	0x590a
+	.long	0x5910
+	.uleb128 0x2
+	.long	0x7bb2
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3107
+	.byte	0x9
+	.value	0x426
+	.byte	0x2f
+	.long	0x4801
+	.uleb128 0x3
+	.long	.LASF3784
+	.byte	0x9
+	.value	0x44c
+	.byte	0x7
+	.long	.LASF3852
+	.long	0x5910
+	.byte	0x1
+	.long	0x5937
+	.long	0x593d
+	.uleb128 0x2
+	.long	0x7bb2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3786
+	.byte	0x9
+	.value	0x451
+	.byte	0x7
+	.long	.LASF3853
+	.long	0x7bbc
+	.byte	0x1
+	.long	0x5957
+	.long	0x595d
+	.uleb128 0x2
+	.long	0x7ba3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3786
+	.byte	0x9
+	.value	0x459
+	.byte	0x7
+	.long	.LASF3854
+	.long	0x5892
+	.byte	0x1
+	.long	0x5977
+	.long	0x5982
+	.uleb128 0x2
+	.long	0x7ba3
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3789
+	.byte	0x9
+	.value	0x45f
+	.byte	0x7
+	.long	.LASF3855
+	.long	0x7bbc
+	.byte	0x1
+	.long	0x599c
+	.long	0x59a2
+	.uleb128 0x2
+	.long	0x7ba3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3789
+	.byte	0x9
+	.value	0x467
+	.byte	0x7
+	.long	.LASF3856
+	.long	0x5892
+	.byte	0x1
+	.long	0x59bc
+	.long	0x59c7
+	.uleb128 0x2
+	.long	0x7ba3
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3161
+	.byte	0x9
+	.value	0x46d
+	.byte	0x7
+	.long	.LASF3857
+	.long	0x58e3
+	.byte	0x1
+	.long	0x59e1
+	.long	0x59ec
+	.uleb128 0x2
+	.long	0x7bb2
+	.uleb128 0x1
+	.long	0x59ec
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3679
+	.byte	0x9
+	.value	0x424
+	.byte	0x37
+	.long	0x47f5
+	.uleb128 0x3
+	.long	.LASF3360
+	.byte	0x9
+	.value	0x472
+	.byte	0x7
+	.long	.LASF3858
+	.long	0x7bbc
+	.byte	0x1
+	.long	0x5a13
+	.long	0x5a1e
+	.uleb128 0x2
+	.long	0x7ba3
+	.uleb128 0x1
+	.long	0x59ec
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3794
+	.byte	0x9
+	.value	0x477
+	.byte	0x7
+	.long	.LASF3859
+	.long	0x5892
+	.byte	0x1
+	.long	0x5a38
+	.long	0x5a43
+	.uleb128 0x2
+	.long	0x7bb2
+	.uleb128 0x1
+	.long	0x59ec
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3796
+	.byte	0x9
+	.value	0x47c
+	.byte	0x7
+	.long	.LASF3860
+	.long	0x7bbc
+	.byte	0x1
+	.long	0x5a5d
+	.long	0x5a68
+	.uleb128 0x2
+	.long	0x7ba3
+	.uleb128 0x1
+	.long	0x59ec
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3798
+	.byte	0x9
+	.value	0x481
+	.byte	0x7
+	.long	.LASF3861
+	.long	0x5892
+	.byte	0x1
+	.long	0x5a82
+	.long	0x5a8d
+	.uleb128 0x2
+	.long	0x7bb2
+	.uleb128 0x1
+	.long	0x59ec
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3800
+	.byte	0x9
+	.value	0x486
+	.byte	0x7
+	.long	.LASF3862
+	.long	0x7bad
+	.byte	0x1
+	.long	0x5aa7
+	.long	0x5aad
+	.uleb128 0x2
+	.long	0x7bb2
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3678
+	.byte	0x9
+	.value	0x422
+	.byte	0x39
+	.long	0x47e9
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x7ab3
+	.uleb128 0x7
+	.long	.LASF3802
+	.long	0x3b8d
+	.byte	0
+	.uleb128 0x8
+	.long	0x5892
+	.uleb128 0xd
+	.long	.LASF3863
+	.byte	0x9
+	.value	0x532
+	.byte	0x5
+	.long	.LASF3864
+	.long	0x57b9
+	.long	0x5b04
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x7a9a
+	.uleb128 0x7
+	.long	.LASF3802
+	.long	0x3b8d
+	.uleb128 0x1
+	.long	0x85af
+	.uleb128 0x1
+	.long	0x85af
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3865
+	.byte	0x9
+	.value	0x532
+	.byte	0x5
+	.long	.LASF3866
+	.long	0x59ec
+	.long	0x5b36
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x7ab3
+	.uleb128 0x7
+	.long	.LASF3802
+	.long	0x3b8d
+	.uleb128 0x1
+	.long	0x80ed
+	.uleb128 0x1
+	.long	0x80ed
+	.byte	0
+	.uleb128 0x86
+	.long	.LASF3867
+	.byte	0x9
+	.value	0x4c5
+	.byte	0x5
+	.long	.LASF3868
+	.long	0x4df0
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x7ab3
+	.uleb128 0x7
+	.long	.LASF3802
+	.long	0x3b8d
+	.uleb128 0x1
+	.long	0x80ed
+	.uleb128 0x1
+	.long	0x80ed
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF3869
+	.uleb128 0x1d
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF3870
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3871
+	.uleb128 0x8
+	.long	0x5b74
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3872
+	.uleb128 0x1d
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF3873
+	.uleb128 0x1d
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3874
+	.uleb128 0x87
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.long	0x5b95
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3875
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3876
+	.uleb128 0x1d
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF3877
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF3878
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF3879
+	.uleb128 0x9
+	.long	0xa4
+	.uleb128 0x9
+	.long	0x112
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x5
+	.long	.LASF3880
+	.uleb128 0x8
+	.long	0x5bcf
+	.uleb128 0x1d
+	.byte	0x2
+	.byte	0x10
+	.long	.LASF3881
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x10
+	.long	.LASF3882
+	.uleb128 0x44
+	.long	.LASF3883
+	.byte	0x15
+	.byte	0x38
+	.byte	0xb
+	.long	0x5bff
+	.uleb128 0x88
+	.byte	0x15
+	.byte	0x3a
+	.byte	0x18
+	.long	0x185
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3061
+	.byte	0x28
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x5b74
+	.uleb128 0x8
+	.long	0x5bff
+	.uleb128 0x1d
+	.byte	0x20
+	.byte	0x3
+	.long	.LASF3884
+	.uleb128 0x1d
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF3885
+	.uleb128 0x4b
+	.byte	0x8
+	.byte	0x29
+	.byte	0x3c
+	.byte	0x3
+	.long	.LASF3888
+	.long	0x5c45
+	.uleb128 0x5
+	.long	.LASF3886
+	.byte	0x29
+	.byte	0x3d
+	.byte	0x9
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x54
+	.string	"rem"
+	.byte	0x3e
+	.byte	0x9
+	.long	0x5b95
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3887
+	.byte	0x29
+	.byte	0x3f
+	.byte	0x5
+	.long	0x5c1e
+	.uleb128 0x4b
+	.byte	0x10
+	.byte	0x29
+	.byte	0x44
+	.byte	0x3
+	.long	.LASF3889
+	.long	0x5c78
+	.uleb128 0x5
+	.long	.LASF3886
+	.byte	0x29
+	.byte	0x45
+	.byte	0xe
+	.long	0x5ba2
+	.byte	0
+	.uleb128 0x54
+	.string	"rem"
+	.byte	0x46
+	.byte	0xe
+	.long	0x5ba2
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3890
+	.byte	0x29
+	.byte	0x47
+	.byte	0x5
+	.long	0x5c51
+	.uleb128 0x4b
+	.byte	0x10
+	.byte	0x29
+	.byte	0x4e
+	.byte	0x3
+	.long	.LASF3891
+	.long	0x5cab
+	.uleb128 0x5
+	.long	.LASF3886
+	.byte	0x29
+	.byte	0x4f
+	.byte	0x13
+	.long	0x5ba9
+	.byte	0
+	.uleb128 0x54
+	.string	"rem"
+	.byte	0x50
+	.byte	0x13
+	.long	0x5ba9
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3892
+	.byte	0x29
+	.byte	0x51
+	.byte	0x5
+	.long	0x5c84
+	.uleb128 0x9
+	.long	0x5cc8
+	.uleb128 0x8
+	.long	0x5cb7
+	.uleb128 0x1d
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF3893
+	.uleb128 0x8
+	.long	0x5cc1
+	.uleb128 0x6
+	.long	.LASF3894
+	.byte	0x2a
+	.byte	0x25
+	.byte	0x15
+	.long	0x5b87
+	.uleb128 0x6
+	.long	.LASF3895
+	.byte	0x2a
+	.byte	0x26
+	.byte	0x17
+	.long	0x5b66
+	.uleb128 0x6
+	.long	.LASF3896
+	.byte	0x2a
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5b8e
+	.uleb128 0x6
+	.long	.LASF3897
+	.byte	0x2a
+	.byte	0x28
+	.byte	0x1c
+	.long	0x5b6d
+	.uleb128 0x6
+	.long	.LASF3898
+	.byte	0x2a
+	.byte	0x29
+	.byte	0x14
+	.long	0x5b95
+	.uleb128 0x6
+	.long	.LASF3899
+	.byte	0x2a
+	.byte	0x2a
+	.byte	0x16
+	.long	0x4de4
+	.uleb128 0x6
+	.long	.LASF3900
+	.byte	0x2a
+	.byte	0x2c
+	.byte	0x19
+	.long	0x5ba2
+	.uleb128 0x6
+	.long	.LASF3901
+	.byte	0x2a
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x5b74
+	.uleb128 0x6
+	.long	.LASF3902
+	.byte	0x2a
+	.byte	0x34
+	.byte	0x12
+	.long	0x5ccd
+	.uleb128 0x6
+	.long	.LASF3903
+	.byte	0x2a
+	.byte	0x35
+	.byte	0x13
+	.long	0x5cd9
+	.uleb128 0x6
+	.long	.LASF3904
+	.byte	0x2a
+	.byte	0x36
+	.byte	0x13
+	.long	0x5ce5
+	.uleb128 0x6
+	.long	.LASF3905
+	.byte	0x2a
+	.byte	0x37
+	.byte	0x14
+	.long	0x5cf1
+	.uleb128 0x6
+	.long	.LASF3906
+	.byte	0x2a
+	.byte	0x38
+	.byte	0x13
+	.long	0x5cfd
+	.uleb128 0x6
+	.long	.LASF3907
+	.byte	0x2a
+	.byte	0x39
+	.byte	0x14
+	.long	0x5d09
+	.uleb128 0x6
+	.long	.LASF3908
+	.byte	0x2a
+	.byte	0x3a
+	.byte	0x13
+	.long	0x5d15
+	.uleb128 0x6
+	.long	.LASF3909
+	.byte	0x2a
+	.byte	0x3b
+	.byte	0x14
+	.long	0x5d21
+	.uleb128 0x6
+	.long	.LASF3910
+	.byte	0x2a
+	.byte	0x48
+	.byte	0x12
+	.long	0x5ba2
+	.uleb128 0x6
+	.long	.LASF3911
+	.byte	0x2a
+	.byte	0x49
+	.byte	0x1b
+	.long	0x5b74
+	.uleb128 0x6
+	.long	.LASF3912
+	.byte	0x2a
+	.byte	0x91
+	.byte	0x1b
+	.long	0x5b74
+	.uleb128 0x6
+	.long	.LASF3913
+	.byte	0x2a
+	.byte	0x92
+	.byte	0x16
+	.long	0x4de4
+	.uleb128 0x6
+	.long	.LASF3914
+	.byte	0x2a
+	.byte	0x93
+	.byte	0x16
+	.long	0x4de4
+	.uleb128 0x6
+	.long	.LASF3915
+	.byte	0x2a
+	.byte	0x94
+	.byte	0x1b
+	.long	0x5b74
+	.uleb128 0x6
+	.long	.LASF3916
+	.byte	0x2a
+	.byte	0x96
+	.byte	0x16
+	.long	0x4de4
+	.uleb128 0x6
+	.long	.LASF3917
+	.byte	0x2a
+	.byte	0x97
+	.byte	0x1b
+	.long	0x5b74
+	.uleb128 0x6
+	.long	.LASF3918
+	.byte	0x2a
+	.byte	0x98
+	.byte	0x12
+	.long	0x5ba2
+	.uleb128 0x6
+	.long	.LASF3919
+	.byte	0x2a
+	.byte	0x99
+	.byte	0x12
+	.long	0x5ba2
+	.uleb128 0x6
+	.long	.LASF3920
+	.byte	0x2a
+	.byte	0xa0
+	.byte	0x12
+	.long	0x5ba2
+	.uleb128 0x89
+	.byte	0x8
+	.uleb128 0x8
+	.long	0x5e11
+	.uleb128 0x6
+	.long	.LASF3921
+	.byte	0x2a
+	.byte	0xaf
+	.byte	0x12
+	.long	0x5ba2
+	.uleb128 0x6
+	.long	.LASF3922
+	.byte	0x2a
+	.byte	0xb4
+	.byte	0x12
+	.long	0x5ba2
+	.uleb128 0x6
+	.long	.LASF3923
+	.byte	0x2a
+	.byte	0xc5
+	.byte	0x12
+	.long	0x5ba2
+	.uleb128 0x9
+	.long	0x5cc1
+	.uleb128 0x8
+	.long	0x5e3d
+	.uleb128 0x6
+	.long	.LASF3924
+	.byte	0x2b
+	.byte	0x18
+	.byte	0x12
+	.long	0x5ccd
+	.uleb128 0x6
+	.long	.LASF3925
+	.byte	0x2b
+	.byte	0x19
+	.byte	0x13
+	.long	0x5ce5
+	.uleb128 0x6
+	.long	.LASF3926
+	.byte	0x2b
+	.byte	0x1a
+	.byte	0x13
+	.long	0x5cfd
+	.uleb128 0x6
+	.long	.LASF3927
+	.byte	0x2b
+	.byte	0x1b
+	.byte	0x13
+	.long	0x5d15
+	.uleb128 0x12
+	.long	.LASF3928
+	.byte	0x10
+	.byte	0x2c
+	.byte	0xb
+	.byte	0x8
+	.long	0x5e9f
+	.uleb128 0x5
+	.long	.LASF3929
+	.byte	0x2c
+	.byte	0x10
+	.byte	0xc
+	.long	0x5e05
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3930
+	.byte	0x2c
+	.byte	0x15
+	.byte	0x15
+	.long	0x5e31
+	.byte	0x8
+	.byte	0
+	.uleb128 0x32
+	.long	0x5cc1
+	.long	0x5eaf
+	.uleb128 0x33
+	.long	0x5b74
+	.byte	0x3
+	.byte	0
+	.uleb128 0x32
+	.long	0x5cc1
+	.long	0x5ebf
+	.uleb128 0x33
+	.long	0x5b74
+	.byte	0x7
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3931
+	.byte	0x29
+	.value	0x33d
+	.byte	0xf
+	.long	0x5ecc
+	.uleb128 0x9
+	.long	0x5ed1
+	.uleb128 0x8a
+	.long	0x5b95
+	.long	0x5ee6
+	.uleb128 0x1
+	.long	0x5ee6
+	.uleb128 0x1
+	.long	0x5ee6
+	.byte	0
+	.uleb128 0x9
+	.long	0x5eeb
+	.uleb128 0x8b
+	.uleb128 0xb
+	.long	.LASF1404
+	.byte	0x29
+	.value	0x267
+	.byte	0xc
+	.long	0x5b95
+	.long	0x5f04
+	.uleb128 0x1
+	.long	0x5f04
+	.byte	0
+	.uleb128 0x9
+	.long	0x5f09
+	.uleb128 0x8c
+	.uleb128 0xd
+	.long	.LASF1405
+	.byte	0x29
+	.value	0x26c
+	.byte	0x12
+	.long	.LASF1405
+	.long	0x5b95
+	.long	0x5f26
+	.uleb128 0x1
+	.long	0x5f04
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1406
+	.byte	0x29
+	.byte	0x66
+	.byte	0xf
+	.long	0x5bb7
+	.long	0x5f3c
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1407
+	.byte	0x29
+	.byte	0x69
+	.byte	0xc
+	.long	0x5b95
+	.long	0x5f52
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1408
+	.byte	0x29
+	.byte	0x6c
+	.byte	0x11
+	.long	0x5ba2
+	.long	0x5f68
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1409
+	.byte	0x29
+	.value	0x349
+	.byte	0xe
+	.long	0x5e11
+	.long	0x5f93
+	.uleb128 0x1
+	.long	0x5ee6
+	.uleb128 0x1
+	.long	0x5ee6
+	.uleb128 0x1
+	.long	0x5bff
+	.uleb128 0x1
+	.long	0x5bff
+	.uleb128 0x1
+	.long	0x5ebf
+	.byte	0
+	.uleb128 0x8d
+	.string	"div"
+	.byte	0x29
+	.value	0x369
+	.byte	0xe
+	.long	0x5c45
+	.long	0x5fb0
+	.uleb128 0x1
+	.long	0x5b95
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1413
+	.byte	0x29
+	.value	0x28e
+	.byte	0xe
+	.long	0x5e3d
+	.long	0x5fc7
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1415
+	.byte	0x29
+	.value	0x36b
+	.byte	0xf
+	.long	0x5c78
+	.long	0x5fe3
+	.uleb128 0x1
+	.long	0x5ba2
+	.uleb128 0x1
+	.long	0x5ba2
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1417
+	.byte	0x29
+	.value	0x3af
+	.byte	0xc
+	.long	0x5b95
+	.long	0x5fff
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1418
+	.byte	0x29
+	.value	0x3ba
+	.byte	0xf
+	.long	0x5bff
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0x9
+	.long	0x5bcf
+	.uleb128 0xb
+	.long	.LASF1419
+	.byte	0x29
+	.value	0x3b2
+	.byte	0xc
+	.long	0x5b95
+	.long	0x6046
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF1420
+	.byte	0x29
+	.value	0x353
+	.long	0x6067
+	.uleb128 0x1
+	.long	0x5e11
+	.uleb128 0x1
+	.long	0x5bff
+	.uleb128 0x1
+	.long	0x5bff
+	.uleb128 0x1
+	.long	0x5ebf
+	.byte	0
+	.uleb128 0x8e
+	.long	.LASF1421
+	.byte	0x29
+	.value	0x283
+	.byte	0xd
+	.long	0x607b
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x55
+	.long	.LASF1422
+	.byte	0x29
+	.value	0x1c6
+	.byte	0xc
+	.long	0x5b95
+	.uleb128 0x43
+	.long	.LASF1424
+	.byte	0x29
+	.value	0x1c8
+	.long	0x609a
+	.uleb128 0x1
+	.long	0x4de4
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1425
+	.byte	0x29
+	.byte	0x76
+	.byte	0xf
+	.long	0x5bb7
+	.long	0x60b5
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x60b5
+	.byte	0
+	.uleb128 0x9
+	.long	0x5e3d
+	.uleb128 0x10
+	.long	.LASF1426
+	.byte	0x29
+	.byte	0xb1
+	.byte	0x11
+	.long	0x5ba2
+	.long	0x60da
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x60b5
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1427
+	.byte	0x29
+	.byte	0xb5
+	.byte	0x1a
+	.long	0x5b74
+	.long	0x60fa
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x60b5
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1428
+	.byte	0x29
+	.value	0x324
+	.byte	0xc
+	.long	0x5b95
+	.long	0x6111
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1429
+	.byte	0x29
+	.value	0x3be
+	.byte	0xf
+	.long	0x5bff
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0x9
+	.long	0x5bd6
+	.uleb128 0xb
+	.long	.LASF1430
+	.byte	0x29
+	.value	0x3b6
+	.byte	0xc
+	.long	0x5b95
+	.long	0x6153
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5bcf
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1433
+	.byte	0x29
+	.value	0x36f
+	.byte	0x1e
+	.long	0x5cab
+	.long	0x616f
+	.uleb128 0x1
+	.long	0x5ba9
+	.uleb128 0x1
+	.long	0x5ba9
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1434
+	.byte	0x29
+	.byte	0x71
+	.byte	0x24
+	.long	0x5ba9
+	.long	0x6185
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1435
+	.byte	0x29
+	.byte	0xc9
+	.byte	0x16
+	.long	0x5ba9
+	.long	0x61a5
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x60b5
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1436
+	.byte	0x29
+	.byte	0xce
+	.byte	0x1f
+	.long	0x5b80
+	.long	0x61c5
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x60b5
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1437
+	.byte	0x29
+	.byte	0x7c
+	.byte	0xe
+	.long	0x5bbe
+	.long	0x61e0
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x60b5
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1438
+	.byte	0x29
+	.byte	0x7f
+	.byte	0x14
+	.long	0x5bb0
+	.long	0x61fb
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x60b5
+	.byte	0
+	.uleb128 0x44
+	.long	.LASF3932
+	.byte	0x2d
+	.byte	0xf
+	.byte	0xb
+	.long	0x6345
+	.uleb128 0x8f
+	.long	.LASF4236
+	.byte	0x2d
+	.byte	0x11
+	.byte	0xb
+	.uleb128 0x90
+	.string	"v1"
+	.byte	0x2d
+	.byte	0x13
+	.byte	0x12
+	.uleb128 0x27
+	.long	.LASF3933
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x17
+	.byte	0x7
+	.long	0x6250
+	.uleb128 0x29
+	.long	.LASF3934
+	.byte	0x1c
+	.long	.LASF3936
+	.long	0x117
+	.uleb128 0x29
+	.long	.LASF3935
+	.byte	0x21
+	.long	.LASF3937
+	.long	0x117
+	.uleb128 0x29
+	.long	.LASF3938
+	.byte	0x26
+	.long	.LASF3939
+	.long	0x117
+	.byte	0
+	.uleb128 0x8
+	.long	0x6218
+	.uleb128 0x27
+	.long	.LASF3940
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x2d
+	.byte	0x7
+	.long	0x628d
+	.uleb128 0x29
+	.long	.LASF3934
+	.byte	0x32
+	.long	.LASF3941
+	.long	0x117
+	.uleb128 0x29
+	.long	.LASF3935
+	.byte	0x37
+	.long	.LASF3942
+	.long	0x117
+	.uleb128 0x29
+	.long	.LASF3938
+	.byte	0x3c
+	.long	.LASF3943
+	.long	0x30e
+	.byte	0
+	.uleb128 0x8
+	.long	0x6255
+	.uleb128 0x27
+	.long	.LASF3944
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x43
+	.byte	0x7
+	.long	0x62ca
+	.uleb128 0x29
+	.long	.LASF3934
+	.byte	0x48
+	.long	.LASF3945
+	.long	0x30e
+	.uleb128 0x29
+	.long	.LASF3935
+	.byte	0x4d
+	.long	.LASF3946
+	.long	0x30e
+	.uleb128 0x29
+	.long	.LASF3938
+	.byte	0x52
+	.long	.LASF3947
+	.long	0x30e
+	.byte	0
+	.uleb128 0x8
+	.long	0x6292
+	.uleb128 0x27
+	.long	.LASF3948
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x58
+	.byte	0x7
+	.long	0x6307
+	.uleb128 0x29
+	.long	.LASF3934
+	.byte	0x5d
+	.long	.LASF3949
+	.long	0x30e
+	.uleb128 0x29
+	.long	.LASF3935
+	.byte	0x62
+	.long	.LASF3950
+	.long	0x30e
+	.uleb128 0x29
+	.long	.LASF3938
+	.byte	0x67
+	.long	.LASF3951
+	.long	0x117
+	.byte	0
+	.uleb128 0x8
+	.long	0x62cf
+	.uleb128 0x68
+	.string	"seq"
+	.byte	0x6e
+	.byte	0x1c
+	.long	0x6250
+	.byte	0x1
+	.byte	0
+	.uleb128 0x68
+	.string	"par"
+	.byte	0x6f
+	.byte	0x1b
+	.long	0x628d
+	.byte	0x1
+	.byte	0
+	.uleb128 0x56
+	.long	.LASF3952
+	.byte	0x2d
+	.byte	0x70
+	.byte	0x27
+	.long	0x62ca
+	.byte	0x1
+	.byte	0
+	.uleb128 0x56
+	.long	.LASF3953
+	.byte	0x2d
+	.byte	0x71
+	.byte	0x1e
+	.long	0x6307
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.long	0x630c
+	.uleb128 0x3a
+	.long	0x6319
+	.uleb128 0x3a
+	.long	0x6326
+	.uleb128 0x3a
+	.long	0x6334
+	.uleb128 0x6
+	.long	.LASF3954
+	.byte	0x2e
+	.byte	0x18
+	.byte	0x13
+	.long	0x5cd9
+	.uleb128 0x6
+	.long	.LASF3955
+	.byte	0x2e
+	.byte	0x19
+	.byte	0x14
+	.long	0x5cf1
+	.uleb128 0x6
+	.long	.LASF3956
+	.byte	0x2e
+	.byte	0x1a
+	.byte	0x14
+	.long	0x5d09
+	.uleb128 0x8
+	.long	0x6371
+	.uleb128 0x6
+	.long	.LASF3957
+	.byte	0x2e
+	.byte	0x1b
+	.byte	0x14
+	.long	0x5d21
+	.uleb128 0x8
+	.long	0x6382
+	.uleb128 0x6
+	.long	.LASF3958
+	.byte	0x2f
+	.byte	0x2b
+	.byte	0x18
+	.long	0x5d2d
+	.uleb128 0x6
+	.long	.LASF3959
+	.byte	0x2f
+	.byte	0x2c
+	.byte	0x19
+	.long	0x5d45
+	.uleb128 0x6
+	.long	.LASF3960
+	.byte	0x2f
+	.byte	0x2d
+	.byte	0x19
+	.long	0x5d5d
+	.uleb128 0x6
+	.long	.LASF3961
+	.byte	0x2f
+	.byte	0x2e
+	.byte	0x19
+	.long	0x5d75
+	.uleb128 0x6
+	.long	.LASF3962
+	.byte	0x2f
+	.byte	0x31
+	.byte	0x19
+	.long	0x5d39
+	.uleb128 0x6
+	.long	.LASF3963
+	.byte	0x2f
+	.byte	0x32
+	.byte	0x1a
+	.long	0x5d51
+	.uleb128 0x6
+	.long	.LASF3964
+	.byte	0x2f
+	.byte	0x33
+	.byte	0x1a
+	.long	0x5d69
+	.uleb128 0x6
+	.long	.LASF3965
+	.byte	0x2f
+	.byte	0x34
+	.byte	0x1a
+	.long	0x5d81
+	.uleb128 0x6
+	.long	.LASF3966
+	.byte	0x2f
+	.byte	0x3a
+	.byte	0x15
+	.long	0x5b87
+	.uleb128 0x6
+	.long	.LASF3967
+	.byte	0x2f
+	.byte	0x3c
+	.byte	0x12
+	.long	0x5ba2
+	.uleb128 0x6
+	.long	.LASF3968
+	.byte	0x2f
+	.byte	0x3d
+	.byte	0x12
+	.long	0x5ba2
+	.uleb128 0x6
+	.long	.LASF3969
+	.byte	0x2f
+	.byte	0x3e
+	.byte	0x12
+	.long	0x5ba2
+	.uleb128 0x6
+	.long	.LASF3970
+	.byte	0x2f
+	.byte	0x47
+	.byte	0x17
+	.long	0x5b66
+	.uleb128 0x6
+	.long	.LASF3971
+	.byte	0x2f
+	.byte	0x49
+	.byte	0x1b
+	.long	0x5b74
+	.uleb128 0x6
+	.long	.LASF3972
+	.byte	0x2f
+	.byte	0x4a
+	.byte	0x1b
+	.long	0x5b74
+	.uleb128 0x6
+	.long	.LASF3973
+	.byte	0x2f
+	.byte	0x4b
+	.byte	0x1b
+	.long	0x5b74
+	.uleb128 0x6
+	.long	.LASF3974
+	.byte	0x2f
+	.byte	0x57
+	.byte	0x12
+	.long	0x5ba2
+	.uleb128 0x6
+	.long	.LASF3975
+	.byte	0x2f
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x5b74
+	.uleb128 0x6
+	.long	.LASF3976
+	.byte	0x2f
+	.byte	0x65
+	.byte	0x14
+	.long	0x5d8d
+	.uleb128 0x6
+	.long	.LASF3977
+	.byte	0x2f
+	.byte	0x66
+	.byte	0x15
+	.long	0x5d99
+	.uleb128 0x15
+	.long	.LASF1564
+	.byte	0x30
+	.byte	0x59
+	.byte	0x14
+	.long	.LASF1564
+	.long	0x5ee6
+	.long	0x64a7
+	.uleb128 0x1
+	.long	0x5ee6
+	.uleb128 0x1
+	.long	0x5b95
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1564
+	.byte	0x30
+	.byte	0x57
+	.byte	0xe
+	.long	.LASF1564
+	.long	0x5e11
+	.long	0x64cb
+	.uleb128 0x1
+	.long	0x5e11
+	.uleb128 0x1
+	.long	0x5b95
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1572
+	.byte	0x30
+	.byte	0xa3
+	.byte	0xc
+	.long	0x5b95
+	.long	0x64e6
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1575
+	.byte	0x30
+	.value	0x1a3
+	.byte	0xe
+	.long	0x5e3d
+	.long	0x64fd
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1584
+	.byte	0x30
+	.value	0x164
+	.byte	0xe
+	.long	0x5e3d
+	.long	0x6519
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1585
+	.byte	0x30
+	.byte	0xa6
+	.byte	0xf
+	.long	0x5bff
+	.long	0x6539
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1570
+	.byte	0x30
+	.byte	0xe4
+	.byte	0x14
+	.long	.LASF1570
+	.long	0x5cb7
+	.long	0x6558
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1570
+	.byte	0x30
+	.byte	0xe2
+	.byte	0xe
+	.long	.LASF1570
+	.long	0x5e3d
+	.long	0x6577
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1580
+	.byte	0x30
+	.value	0x131
+	.byte	0x14
+	.long	.LASF1580
+	.long	0x5cb7
+	.long	0x6597
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1580
+	.byte	0x30
+	.value	0x12f
+	.byte	0xe
+	.long	.LASF1580
+	.long	0x5e3d
+	.long	0x65b7
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1581
+	.byte	0x30
+	.byte	0xff
+	.byte	0x14
+	.long	.LASF1581
+	.long	0x5cb7
+	.long	0x65d6
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1581
+	.byte	0x30
+	.byte	0xfd
+	.byte	0xe
+	.long	.LASF1581
+	.long	0x5e3d
+	.long	0x65f5
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1583
+	.byte	0x30
+	.value	0x14c
+	.byte	0x14
+	.long	.LASF1583
+	.long	0x5cb7
+	.long	0x6615
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1583
+	.byte	0x30
+	.value	0x14a
+	.byte	0xe
+	.long	.LASF1583
+	.long	0x5e3d
+	.long	0x6635
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x91
+	.long	.LASF4237
+	.byte	0x18
+	.byte	0x31
+	.byte	0
+	.long	0x666b
+	.uleb128 0x4c
+	.long	.LASF3978
+	.long	0x4de4
+	.byte	0
+	.uleb128 0x4c
+	.long	.LASF3979
+	.long	0x4de4
+	.byte	0x4
+	.uleb128 0x4c
+	.long	.LASF3980
+	.long	0x5e11
+	.byte	0x8
+	.uleb128 0x4c
+	.long	.LASF3981
+	.long	0x5e11
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3982
+	.byte	0x32
+	.byte	0x14
+	.byte	0x16
+	.long	0x4de4
+	.uleb128 0x4b
+	.byte	0x8
+	.byte	0x33
+	.byte	0xe
+	.byte	0x1
+	.long	.LASF3983
+	.long	0x66c1
+	.uleb128 0x5f
+	.byte	0x4
+	.byte	0x33
+	.byte	0x11
+	.byte	0x3
+	.long	0x66a6
+	.uleb128 0x48
+	.long	.LASF3984
+	.byte	0x33
+	.byte	0x12
+	.byte	0x12
+	.long	0x4de4
+	.uleb128 0x48
+	.long	.LASF3985
+	.byte	0x33
+	.byte	0x13
+	.byte	0xa
+	.long	0x5e9f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3986
+	.byte	0x33
+	.byte	0xf
+	.byte	0x7
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3987
+	.byte	0x33
+	.byte	0x14
+	.byte	0x5
+	.long	0x6684
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3988
+	.byte	0x33
+	.byte	0x15
+	.byte	0x3
+	.long	0x6677
+	.uleb128 0x6
+	.long	.LASF3989
+	.byte	0x34
+	.byte	0x6
+	.byte	0x15
+	.long	0x66c1
+	.uleb128 0x8
+	.long	0x66cd
+	.uleb128 0x6
+	.long	.LASF3990
+	.byte	0x35
+	.byte	0x5
+	.byte	0x19
+	.long	0x66ea
+	.uleb128 0x12
+	.long	.LASF3991
+	.byte	0xd8
+	.byte	0x36
+	.byte	0x31
+	.byte	0x8
+	.long	0x6871
+	.uleb128 0x5
+	.long	.LASF3992
+	.byte	0x36
+	.byte	0x33
+	.byte	0x7
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3993
+	.byte	0x36
+	.byte	0x36
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF3994
+	.byte	0x36
+	.byte	0x37
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF3995
+	.byte	0x36
+	.byte	0x38
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF3996
+	.byte	0x36
+	.byte	0x39
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF3997
+	.byte	0x36
+	.byte	0x3a
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF3998
+	.byte	0x36
+	.byte	0x3b
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF3999
+	.byte	0x36
+	.byte	0x3c
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x38
+	.uleb128 0x5
+	.long	.LASF4000
+	.byte	0x36
+	.byte	0x3d
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x40
+	.uleb128 0x5
+	.long	.LASF4001
+	.byte	0x36
+	.byte	0x40
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x48
+	.uleb128 0x5
+	.long	.LASF4002
+	.byte	0x36
+	.byte	0x41
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x50
+	.uleb128 0x5
+	.long	.LASF4003
+	.byte	0x36
+	.byte	0x42
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x58
+	.uleb128 0x5
+	.long	.LASF4004
+	.byte	0x36
+	.byte	0x44
+	.byte	0x16
+	.long	0x72f4
+	.byte	0x60
+	.uleb128 0x5
+	.long	.LASF4005
+	.byte	0x36
+	.byte	0x46
+	.byte	0x14
+	.long	0x72f9
+	.byte	0x68
+	.uleb128 0x5
+	.long	.LASF4006
+	.byte	0x36
+	.byte	0x48
+	.byte	0x7
+	.long	0x5b95
+	.byte	0x70
+	.uleb128 0x5
+	.long	.LASF4007
+	.byte	0x36
+	.byte	0x49
+	.byte	0x7
+	.long	0x5b95
+	.byte	0x74
+	.uleb128 0x5
+	.long	.LASF4008
+	.byte	0x36
+	.byte	0x4a
+	.byte	0xb
+	.long	0x5ded
+	.byte	0x78
+	.uleb128 0x5
+	.long	.LASF4009
+	.byte	0x36
+	.byte	0x4d
+	.byte	0x12
+	.long	0x5b6d
+	.byte	0x80
+	.uleb128 0x5
+	.long	.LASF4010
+	.byte	0x36
+	.byte	0x4e
+	.byte	0xf
+	.long	0x5b87
+	.byte	0x82
+	.uleb128 0x5
+	.long	.LASF4011
+	.byte	0x36
+	.byte	0x4f
+	.byte	0x8
+	.long	0x72fe
+	.byte	0x83
+	.uleb128 0x5
+	.long	.LASF4012
+	.byte	0x36
+	.byte	0x51
+	.byte	0xf
+	.long	0x730e
+	.byte	0x88
+	.uleb128 0x5
+	.long	.LASF4013
+	.byte	0x36
+	.byte	0x59
+	.byte	0xd
+	.long	0x5df9
+	.byte	0x90
+	.uleb128 0x5
+	.long	.LASF4014
+	.byte	0x36
+	.byte	0x5b
+	.byte	0x17
+	.long	0x7318
+	.byte	0x98
+	.uleb128 0x5
+	.long	.LASF4015
+	.byte	0x36
+	.byte	0x5c
+	.byte	0x19
+	.long	0x7322
+	.byte	0xa0
+	.uleb128 0x5
+	.long	.LASF4016
+	.byte	0x36
+	.byte	0x5d
+	.byte	0x14
+	.long	0x72f9
+	.byte	0xa8
+	.uleb128 0x5
+	.long	.LASF4017
+	.byte	0x36
+	.byte	0x5e
+	.byte	0x9
+	.long	0x5e11
+	.byte	0xb0
+	.uleb128 0x5
+	.long	.LASF4018
+	.byte	0x36
+	.byte	0x5f
+	.byte	0xa
+	.long	0x5bff
+	.byte	0xb8
+	.uleb128 0x5
+	.long	.LASF4019
+	.byte	0x36
+	.byte	0x60
+	.byte	0x7
+	.long	0x5b95
+	.byte	0xc0
+	.uleb128 0x5
+	.long	.LASF4020
+	.byte	0x36
+	.byte	0x62
+	.byte	0x8
+	.long	0x7327
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF4021
+	.byte	0x37
+	.byte	0x7
+	.byte	0x19
+	.long	0x66ea
+	.uleb128 0xb
+	.long	.LASF1605
+	.byte	0x38
+	.value	0x11d
+	.byte	0xf
+	.long	0x666b
+	.long	0x6894
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1606
+	.byte	0x38
+	.value	0x2e8
+	.byte	0xf
+	.long	0x666b
+	.long	0x68ab
+	.uleb128 0x1
+	.long	0x68ab
+	.byte	0
+	.uleb128 0x9
+	.long	0x66de
+	.uleb128 0xb
+	.long	.LASF1607
+	.byte	0x38
+	.value	0x305
+	.byte	0x11
+	.long	0x6020
+	.long	0x68d1
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x5b95
+	.uleb128 0x1
+	.long	0x68ab
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1608
+	.byte	0x38
+	.value	0x2f6
+	.byte	0xf
+	.long	0x666b
+	.long	0x68ed
+	.uleb128 0x1
+	.long	0x5bcf
+	.uleb128 0x1
+	.long	0x68ab
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1609
+	.byte	0x38
+	.value	0x30c
+	.byte	0xc
+	.long	0x5b95
+	.long	0x6909
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x68ab
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1610
+	.byte	0x38
+	.value	0x24c
+	.byte	0xc
+	.long	0x5b95
+	.long	0x6925
+	.uleb128 0x1
+	.long	0x68ab
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1611
+	.byte	0x38
+	.value	0x253
+	.byte	0xc
+	.long	0x5b95
+	.long	0x6942
+	.uleb128 0x1
+	.long	0x68ab
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x3b
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1612
+	.byte	0x38
+	.value	0x291
+	.byte	0xc
+	.long	.LASF4022
+	.long	0x5b95
+	.long	0x6963
+	.uleb128 0x1
+	.long	0x68ab
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x3b
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1613
+	.byte	0x38
+	.value	0x2e9
+	.byte	0xf
+	.long	0x666b
+	.long	0x697a
+	.uleb128 0x1
+	.long	0x68ab
+	.byte	0
+	.uleb128 0x55
+	.long	.LASF1614
+	.byte	0x38
+	.value	0x2ef
+	.byte	0xf
+	.long	0x666b
+	.uleb128 0xb
+	.long	.LASF1615
+	.byte	0x38
+	.value	0x134
+	.byte	0xf
+	.long	0x5bff
+	.long	0x69a8
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5bff
+	.uleb128 0x1
+	.long	0x69a8
+	.byte	0
+	.uleb128 0x9
+	.long	0x66cd
+	.uleb128 0xb
+	.long	.LASF1616
+	.byte	0x38
+	.value	0x129
+	.byte	0xf
+	.long	0x5bff
+	.long	0x69d3
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5bff
+	.uleb128 0x1
+	.long	0x69a8
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1617
+	.byte	0x38
+	.value	0x125
+	.byte	0xc
+	.long	0x5b95
+	.long	0x69ea
+	.uleb128 0x1
+	.long	0x69ea
+	.byte	0
+	.uleb128 0x9
+	.long	0x66d9
+	.uleb128 0xb
+	.long	.LASF1618
+	.byte	0x38
+	.value	0x152
+	.byte	0xf
+	.long	0x5bff
+	.long	0x6a15
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x6a15
+	.uleb128 0x1
+	.long	0x5bff
+	.uleb128 0x1
+	.long	0x69a8
+	.byte	0
+	.uleb128 0x9
+	.long	0x5cb7
+	.uleb128 0xb
+	.long	.LASF1619
+	.byte	0x38
+	.value	0x2f7
+	.byte	0xf
+	.long	0x666b
+	.long	0x6a36
+	.uleb128 0x1
+	.long	0x5bcf
+	.uleb128 0x1
+	.long	0x68ab
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1620
+	.byte	0x38
+	.value	0x2fd
+	.byte	0xf
+	.long	0x666b
+	.long	0x6a4d
+	.uleb128 0x1
+	.long	0x5bcf
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1621
+	.byte	0x38
+	.value	0x25d
+	.byte	0xc
+	.long	0x5b95
+	.long	0x6a6f
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x5bff
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x3b
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1622
+	.byte	0x38
+	.value	0x298
+	.byte	0xc
+	.long	.LASF4023
+	.long	0x5b95
+	.long	0x6a90
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x3b
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1623
+	.byte	0x38
+	.value	0x314
+	.byte	0xf
+	.long	0x666b
+	.long	0x6aac
+	.uleb128 0x1
+	.long	0x666b
+	.uleb128 0x1
+	.long	0x68ab
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1624
+	.byte	0x38
+	.value	0x265
+	.byte	0xc
+	.long	0x5b95
+	.long	0x6acd
+	.uleb128 0x1
+	.long	0x68ab
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6acd
+	.byte	0
+	.uleb128 0x9
+	.long	0x6635
+	.uleb128 0xd
+	.long	.LASF1625
+	.byte	0x38
+	.value	0x2c7
+	.byte	0xc
+	.long	.LASF4024
+	.long	0x5b95
+	.long	0x6af7
+	.uleb128 0x1
+	.long	0x68ab
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6acd
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1626
+	.byte	0x38
+	.value	0x272
+	.byte	0xc
+	.long	0x5b95
+	.long	0x6b1d
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x5bff
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6acd
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1627
+	.byte	0x38
+	.value	0x2ce
+	.byte	0xc
+	.long	.LASF4025
+	.long	0x5b95
+	.long	0x6b42
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6acd
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1628
+	.byte	0x38
+	.value	0x26d
+	.byte	0xc
+	.long	0x5b95
+	.long	0x6b5e
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6acd
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1629
+	.byte	0x38
+	.value	0x2cb
+	.byte	0xc
+	.long	.LASF4026
+	.long	0x5b95
+	.long	0x6b7e
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6acd
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1630
+	.byte	0x38
+	.value	0x12e
+	.byte	0xf
+	.long	0x5bff
+	.long	0x6b9f
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5bcf
+	.uleb128 0x1
+	.long	0x69a8
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1631
+	.byte	0x38
+	.byte	0x61
+	.byte	0x11
+	.long	0x6020
+	.long	0x6bba
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x6132
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1633
+	.byte	0x38
+	.byte	0x6a
+	.byte	0xc
+	.long	0x5b95
+	.long	0x6bd5
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6132
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1634
+	.byte	0x38
+	.byte	0x83
+	.byte	0xc
+	.long	0x5b95
+	.long	0x6bf0
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6132
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1635
+	.byte	0x38
+	.byte	0x57
+	.byte	0x11
+	.long	0x6020
+	.long	0x6c0b
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x6132
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1636
+	.byte	0x38
+	.byte	0xbc
+	.byte	0xf
+	.long	0x5bff
+	.long	0x6c26
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6132
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1637
+	.byte	0x38
+	.value	0x354
+	.byte	0xf
+	.long	0x5bff
+	.long	0x6c4c
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x5bff
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6c4c
+	.byte	0
+	.uleb128 0x9
+	.long	0x6cee
+	.uleb128 0x92
+	.string	"tm"
+	.byte	0x38
+	.byte	0x39
+	.byte	0x7
+	.byte	0x8
+	.long	0x6cee
+	.uleb128 0x5
+	.long	.LASF4027
+	.byte	0x39
+	.byte	0x9
+	.byte	0x7
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF4028
+	.byte	0x39
+	.byte	0xa
+	.byte	0x7
+	.long	0x5b95
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF4029
+	.byte	0x39
+	.byte	0xb
+	.byte	0x7
+	.long	0x5b95
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF4030
+	.byte	0x39
+	.byte	0xc
+	.byte	0x7
+	.long	0x5b95
+	.byte	0xc
+	.uleb128 0x5
+	.long	.LASF4031
+	.byte	0x39
+	.byte	0xd
+	.byte	0x7
+	.long	0x5b95
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF4032
+	.byte	0x39
+	.byte	0xe
+	.byte	0x7
+	.long	0x5b95
+	.byte	0x14
+	.uleb128 0x5
+	.long	.LASF4033
+	.byte	0x39
+	.byte	0xf
+	.byte	0x7
+	.long	0x5b95
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF4034
+	.byte	0x39
+	.byte	0x10
+	.byte	0x7
+	.long	0x5b95
+	.byte	0x1c
+	.uleb128 0x5
+	.long	.LASF4035
+	.byte	0x39
+	.byte	0x11
+	.byte	0x7
+	.long	0x5b95
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF4036
+	.byte	0x39
+	.byte	0x14
+	.byte	0xc
+	.long	0x5ba2
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF4037
+	.byte	0x39
+	.byte	0x15
+	.byte	0xf
+	.long	0x5cb7
+	.byte	0x30
+	.byte	0
+	.uleb128 0x8
+	.long	0x6c51
+	.uleb128 0x10
+	.long	.LASF1638
+	.byte	0x38
+	.byte	0xdf
+	.byte	0xf
+	.long	0x5bff
+	.long	0x6d09
+	.uleb128 0x1
+	.long	0x6132
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1639
+	.byte	0x38
+	.byte	0x65
+	.byte	0x11
+	.long	0x6020
+	.long	0x6d29
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1640
+	.byte	0x38
+	.byte	0x6d
+	.byte	0xc
+	.long	0x5b95
+	.long	0x6d49
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1641
+	.byte	0x38
+	.byte	0x5c
+	.byte	0x11
+	.long	0x6020
+	.long	0x6d69
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1644
+	.byte	0x38
+	.value	0x158
+	.byte	0xf
+	.long	0x5bff
+	.long	0x6d8f
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x6d8f
+	.uleb128 0x1
+	.long	0x5bff
+	.uleb128 0x1
+	.long	0x69a8
+	.byte	0
+	.uleb128 0x9
+	.long	0x6132
+	.uleb128 0x10
+	.long	.LASF1645
+	.byte	0x38
+	.byte	0xc0
+	.byte	0xf
+	.long	0x5bff
+	.long	0x6daf
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6132
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1647
+	.byte	0x38
+	.value	0x17a
+	.byte	0xf
+	.long	0x5bb7
+	.long	0x6dcb
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6dcb
+	.byte	0
+	.uleb128 0x9
+	.long	0x6020
+	.uleb128 0xb
+	.long	.LASF1648
+	.byte	0x38
+	.value	0x17f
+	.byte	0xe
+	.long	0x5bbe
+	.long	0x6dec
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6dcb
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1649
+	.byte	0x38
+	.byte	0xda
+	.byte	0x11
+	.long	0x6020
+	.long	0x6e0c
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6dcb
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1650
+	.byte	0x38
+	.value	0x1ad
+	.byte	0x11
+	.long	0x5ba2
+	.long	0x6e2d
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6dcb
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1651
+	.byte	0x38
+	.value	0x1b2
+	.byte	0x1a
+	.long	0x5b74
+	.long	0x6e4e
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6dcb
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1652
+	.byte	0x38
+	.byte	0x87
+	.byte	0xf
+	.long	0x5bff
+	.long	0x6e6e
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1653
+	.byte	0x38
+	.value	0x121
+	.byte	0xc
+	.long	0x5b95
+	.long	0x6e85
+	.uleb128 0x1
+	.long	0x666b
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1655
+	.byte	0x38
+	.value	0x103
+	.byte	0xc
+	.long	0x5b95
+	.long	0x6ea6
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1656
+	.byte	0x38
+	.value	0x107
+	.byte	0x11
+	.long	0x6020
+	.long	0x6ec7
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1657
+	.byte	0x38
+	.value	0x10c
+	.byte	0x11
+	.long	0x6020
+	.long	0x6ee8
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1658
+	.byte	0x38
+	.value	0x110
+	.byte	0x11
+	.long	0x6020
+	.long	0x6f09
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x5bcf
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1659
+	.byte	0x38
+	.value	0x25a
+	.byte	0xc
+	.long	0x5b95
+	.long	0x6f21
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x3b
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1660
+	.byte	0x38
+	.value	0x295
+	.byte	0xc
+	.long	.LASF4038
+	.long	0x5b95
+	.long	0x6f3d
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x3b
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1632
+	.byte	0x38
+	.byte	0xa2
+	.byte	0x1d
+	.long	.LASF1632
+	.long	0x6132
+	.long	0x6f5c
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x5bcf
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1632
+	.byte	0x38
+	.byte	0xa0
+	.byte	0x17
+	.long	.LASF1632
+	.long	0x6020
+	.long	0x6f7b
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x5bcf
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1642
+	.byte	0x38
+	.byte	0xc6
+	.byte	0x1d
+	.long	.LASF1642
+	.long	0x6132
+	.long	0x6f9a
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6132
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1642
+	.byte	0x38
+	.byte	0xc4
+	.byte	0x17
+	.long	.LASF1642
+	.long	0x6020
+	.long	0x6fb9
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x6132
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1643
+	.byte	0x38
+	.byte	0xac
+	.byte	0x1d
+	.long	.LASF1643
+	.long	0x6132
+	.long	0x6fd8
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x5bcf
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1643
+	.byte	0x38
+	.byte	0xaa
+	.byte	0x17
+	.long	.LASF1643
+	.long	0x6020
+	.long	0x6ff7
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x5bcf
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1646
+	.byte	0x38
+	.byte	0xd1
+	.byte	0x1d
+	.long	.LASF1646
+	.long	0x6132
+	.long	0x7016
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6132
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1646
+	.byte	0x38
+	.byte	0xcf
+	.byte	0x17
+	.long	.LASF1646
+	.long	0x6020
+	.long	0x7035
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x6132
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1654
+	.byte	0x38
+	.byte	0xfa
+	.byte	0x1d
+	.long	.LASF1654
+	.long	0x6132
+	.long	0x7059
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x5bcf
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1654
+	.byte	0x38
+	.byte	0xf8
+	.byte	0x17
+	.long	.LASF1654
+	.long	0x6020
+	.long	0x707d
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x1
+	.long	0x5bcf
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1661
+	.byte	0x38
+	.value	0x181
+	.byte	0x14
+	.long	0x5bb0
+	.long	0x7099
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6dcb
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1662
+	.byte	0x38
+	.value	0x1ba
+	.byte	0x16
+	.long	0x5ba9
+	.long	0x70ba
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6dcb
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1663
+	.byte	0x38
+	.value	0x1c1
+	.byte	0x1f
+	.long	0x5b80
+	.long	0x70db
+	.uleb128 0x1
+	.long	0x6132
+	.uleb128 0x1
+	.long	0x6dcb
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0xa
+	.long	0x6e4
+	.uleb128 0xa
+	.long	0x6f1
+	.uleb128 0x9
+	.long	0x6f1
+	.uleb128 0x9
+	.long	0x6e4
+	.uleb128 0xa
+	.long	0x82c
+	.uleb128 0x9
+	.long	0x8af
+	.uleb128 0xa
+	.long	0xa31
+	.uleb128 0x9
+	.long	0xa31
+	.uleb128 0xa
+	.long	0x5cc1
+	.uleb128 0xa
+	.long	0x5cc8
+	.uleb128 0x9
+	.long	0xa36
+	.uleb128 0xa
+	.long	0xabf
+	.uleb128 0xa
+	.long	0xa36
+	.uleb128 0x12
+	.long	.LASF4039
+	.byte	0x60
+	.byte	0x3a
+	.byte	0x33
+	.byte	0x8
+	.long	0x7262
+	.uleb128 0x5
+	.long	.LASF4040
+	.byte	0x3a
+	.byte	0x37
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF4041
+	.byte	0x3a
+	.byte	0x38
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF4042
+	.byte	0x3a
+	.byte	0x3e
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF4043
+	.byte	0x3a
+	.byte	0x44
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF4044
+	.byte	0x3a
+	.byte	0x45
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF4045
+	.byte	0x3a
+	.byte	0x46
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF4046
+	.byte	0x3a
+	.byte	0x47
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF4047
+	.byte	0x3a
+	.byte	0x48
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x38
+	.uleb128 0x5
+	.long	.LASF4048
+	.byte	0x3a
+	.byte	0x49
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x40
+	.uleb128 0x5
+	.long	.LASF4049
+	.byte	0x3a
+	.byte	0x4a
+	.byte	0x9
+	.long	0x5e3d
+	.byte	0x48
+	.uleb128 0x5
+	.long	.LASF4050
+	.byte	0x3a
+	.byte	0x4b
+	.byte	0x8
+	.long	0x5cc1
+	.byte	0x50
+	.uleb128 0x5
+	.long	.LASF4051
+	.byte	0x3a
+	.byte	0x4c
+	.byte	0x8
+	.long	0x5cc1
+	.byte	0x51
+	.uleb128 0x5
+	.long	.LASF4052
+	.byte	0x3a
+	.byte	0x4e
+	.byte	0x8
+	.long	0x5cc1
+	.byte	0x52
+	.uleb128 0x5
+	.long	.LASF4053
+	.byte	0x3a
+	.byte	0x50
+	.byte	0x8
+	.long	0x5cc1
+	.byte	0x53
+	.uleb128 0x5
+	.long	.LASF4054
+	.byte	0x3a
+	.byte	0x52
+	.byte	0x8
+	.long	0x5cc1
+	.byte	0x54
+	.uleb128 0x5
+	.long	.LASF4055
+	.byte	0x3a
+	.byte	0x54
+	.byte	0x8
+	.long	0x5cc1
+	.byte	0x55
+	.uleb128 0x5
+	.long	.LASF4056
+	.byte	0x3a
+	.byte	0x5b
+	.byte	0x8
+	.long	0x5cc1
+	.byte	0x56
+	.uleb128 0x5
+	.long	.LASF4057
+	.byte	0x3a
+	.byte	0x5c
+	.byte	0x8
+	.long	0x5cc1
+	.byte	0x57
+	.uleb128 0x5
+	.long	.LASF4058
+	.byte	0x3a
+	.byte	0x5f
+	.byte	0x8
+	.long	0x5cc1
+	.byte	0x58
+	.uleb128 0x5
+	.long	.LASF4059
+	.byte	0x3a
+	.byte	0x61
+	.byte	0x8
+	.long	0x5cc1
+	.byte	0x59
+	.uleb128 0x5
+	.long	.LASF4060
+	.byte	0x3a
+	.byte	0x63
+	.byte	0x8
+	.long	0x5cc1
+	.byte	0x5a
+	.uleb128 0x5
+	.long	.LASF4061
+	.byte	0x3a
+	.byte	0x65
+	.byte	0x8
+	.long	0x5cc1
+	.byte	0x5b
+	.uleb128 0x5
+	.long	.LASF4062
+	.byte	0x3a
+	.byte	0x6c
+	.byte	0x8
+	.long	0x5cc1
+	.byte	0x5c
+	.uleb128 0x5
+	.long	.LASF4063
+	.byte	0x3a
+	.byte	0x6d
+	.byte	0x8
+	.long	0x5cc1
+	.byte	0x5d
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1722
+	.byte	0x3a
+	.byte	0x7a
+	.byte	0xe
+	.long	0x5e3d
+	.long	0x727d
+	.uleb128 0x1
+	.long	0x5b95
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x69
+	.long	.LASF1723
+	.byte	0x3a
+	.byte	0x7d
+	.byte	0x16
+	.long	0x7289
+	.uleb128 0x9
+	.long	0x711c
+	.uleb128 0x93
+	.long	.LASF4238
+	.uleb128 0x9
+	.long	0xae9
+	.uleb128 0xa
+	.long	0x142e
+	.uleb128 0xa
+	.long	0xae9
+	.uleb128 0x9
+	.long	0xbbe
+	.uleb128 0x9
+	.long	0x142e
+	.uleb128 0xa
+	.long	0xbbe
+	.uleb128 0x12
+	.long	.LASF4064
+	.byte	0x10
+	.byte	0x3b
+	.byte	0xa
+	.byte	0x10
+	.long	0x72da
+	.uleb128 0x5
+	.long	.LASF4065
+	.byte	0x3b
+	.byte	0xc
+	.byte	0xb
+	.long	0x5ded
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF4066
+	.byte	0x3b
+	.byte	0xd
+	.byte	0xf
+	.long	0x66c1
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF4067
+	.byte	0x3b
+	.byte	0xe
+	.byte	0x3
+	.long	0x72b2
+	.uleb128 0x94
+	.long	.LASF4239
+	.byte	0x36
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x57
+	.long	.LASF4068
+	.uleb128 0x9
+	.long	0x72ef
+	.uleb128 0x9
+	.long	0x66ea
+	.uleb128 0x32
+	.long	0x5cc1
+	.long	0x730e
+	.uleb128 0x33
+	.long	0x5b74
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x72e6
+	.uleb128 0x57
+	.long	.LASF4069
+	.uleb128 0x9
+	.long	0x7313
+	.uleb128 0x57
+	.long	.LASF4070
+	.uleb128 0x9
+	.long	0x731d
+	.uleb128 0x32
+	.long	0x5cc1
+	.long	0x7337
+	.uleb128 0x33
+	.long	0x5b74
+	.byte	0x13
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF4071
+	.byte	0x3c
+	.byte	0x54
+	.byte	0x12
+	.long	0x72da
+	.uleb128 0x8
+	.long	0x7337
+	.uleb128 0x9
+	.long	0x6871
+	.uleb128 0x43
+	.long	.LASF1818
+	.byte	0x3c
+	.value	0x312
+	.long	0x735f
+	.uleb128 0x1
+	.long	0x7348
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1819
+	.byte	0x3c
+	.byte	0xb2
+	.byte	0xc
+	.long	0x5b95
+	.long	0x7375
+	.uleb128 0x1
+	.long	0x7348
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1820
+	.byte	0x3c
+	.value	0x314
+	.byte	0xc
+	.long	0x5b95
+	.long	0x738c
+	.uleb128 0x1
+	.long	0x7348
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1821
+	.byte	0x3c
+	.value	0x316
+	.byte	0xc
+	.long	0x5b95
+	.long	0x73a3
+	.uleb128 0x1
+	.long	0x7348
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1822
+	.byte	0x3c
+	.byte	0xe6
+	.byte	0xc
+	.long	0x5b95
+	.long	0x73b9
+	.uleb128 0x1
+	.long	0x7348
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1823
+	.byte	0x3c
+	.value	0x201
+	.byte	0xc
+	.long	0x5b95
+	.long	0x73d0
+	.uleb128 0x1
+	.long	0x7348
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1824
+	.byte	0x3c
+	.value	0x2f8
+	.byte	0xc
+	.long	0x5b95
+	.long	0x73ec
+	.uleb128 0x1
+	.long	0x7348
+	.uleb128 0x1
+	.long	0x73ec
+	.byte	0
+	.uleb128 0x9
+	.long	0x7337
+	.uleb128 0xb
+	.long	.LASF1825
+	.byte	0x3c
+	.value	0x250
+	.byte	0xe
+	.long	0x5e3d
+	.long	0x7412
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5b95
+	.uleb128 0x1
+	.long	0x7348
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1826
+	.byte	0x3c
+	.value	0x102
+	.byte	0xe
+	.long	0x7348
+	.long	0x742e
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1830
+	.byte	0x3c
+	.value	0x2a3
+	.byte	0xf
+	.long	0x5bff
+	.long	0x7454
+	.uleb128 0x1
+	.long	0x5e11
+	.uleb128 0x1
+	.long	0x5bff
+	.uleb128 0x1
+	.long	0x5bff
+	.uleb128 0x1
+	.long	0x7348
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1831
+	.byte	0x3c
+	.value	0x109
+	.byte	0xe
+	.long	0x7348
+	.long	0x7475
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x7348
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1833
+	.byte	0x3c
+	.value	0x2c9
+	.byte	0xc
+	.long	0x5b95
+	.long	0x7496
+	.uleb128 0x1
+	.long	0x7348
+	.uleb128 0x1
+	.long	0x5ba2
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1834
+	.byte	0x3c
+	.value	0x2fd
+	.byte	0xc
+	.long	0x5b95
+	.long	0x74b2
+	.uleb128 0x1
+	.long	0x7348
+	.uleb128 0x1
+	.long	0x74b2
+	.byte	0
+	.uleb128 0x9
+	.long	0x7343
+	.uleb128 0xb
+	.long	.LASF1835
+	.byte	0x3c
+	.value	0x2ce
+	.byte	0x11
+	.long	0x5ba2
+	.long	0x74ce
+	.uleb128 0x1
+	.long	0x7348
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1837
+	.byte	0x3c
+	.value	0x202
+	.byte	0xc
+	.long	0x5b95
+	.long	0x74e5
+	.uleb128 0x1
+	.long	0x7348
+	.byte	0
+	.uleb128 0x55
+	.long	.LASF1838
+	.byte	0x3c
+	.value	0x208
+	.byte	0xc
+	.long	0x5b95
+	.uleb128 0x43
+	.long	.LASF1839
+	.byte	0x3c
+	.value	0x324
+	.long	0x7504
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1844
+	.byte	0x3c
+	.byte	0x98
+	.byte	0xc
+	.long	0x5b95
+	.long	0x751a
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1845
+	.byte	0x3c
+	.byte	0x9a
+	.byte	0xc
+	.long	0x5b95
+	.long	0x7535
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF1846
+	.byte	0x3c
+	.value	0x2d3
+	.long	0x7547
+	.uleb128 0x1
+	.long	0x7348
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF1848
+	.byte	0x3c
+	.value	0x148
+	.long	0x755e
+	.uleb128 0x1
+	.long	0x7348
+	.uleb128 0x1
+	.long	0x5e3d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1849
+	.byte	0x3c
+	.value	0x14c
+	.byte	0xc
+	.long	0x5b95
+	.long	0x7584
+	.uleb128 0x1
+	.long	0x7348
+	.uleb128 0x1
+	.long	0x5e3d
+	.uleb128 0x1
+	.long	0x5b95
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0x69
+	.long	.LASF1852
+	.byte	0x3c
+	.byte	0xbc
+	.byte	0xe
+	.long	0x7348
+	.uleb128 0x10
+	.long	.LASF1853
+	.byte	0x3c
+	.byte	0xcd
+	.byte	0xe
+	.long	0x5e3d
+	.long	0x75a6
+	.uleb128 0x1
+	.long	0x5e3d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1854
+	.byte	0x3c
+	.value	0x29c
+	.byte	0xc
+	.long	0x5b95
+	.long	0x75c2
+	.uleb128 0x1
+	.long	0x5b95
+	.uleb128 0x1
+	.long	0x7348
+	.byte	0
+	.uleb128 0xa
+	.long	0x1549
+	.uleb128 0xa
+	.long	0x1556
+	.uleb128 0xa
+	.long	0x503a
+	.uleb128 0xa
+	.long	0x5046
+	.uleb128 0x9
+	.long	0x1633
+	.uleb128 0x2a
+	.long	0xa36
+	.uleb128 0x32
+	.long	0x5cc1
+	.long	0x75f0
+	.uleb128 0x33
+	.long	0x5b74
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.long	0x1626
+	.uleb128 0x9
+	.long	0x30ad
+	.uleb128 0x8
+	.long	0x75f5
+	.uleb128 0xa
+	.long	0x16ca
+	.uleb128 0xa
+	.long	0x1901
+	.uleb128 0xa
+	.long	0x190e
+	.uleb128 0xa
+	.long	0x30ad
+	.uleb128 0x2a
+	.long	0x1626
+	.uleb128 0xa
+	.long	0x1626
+	.uleb128 0x9
+	.long	0x1721
+	.uleb128 0x9
+	.long	0x30b3
+	.uleb128 0x9
+	.long	0x31a3
+	.uleb128 0xa
+	.long	0x4deb
+	.uleb128 0xa
+	.long	0x31be
+	.uleb128 0x12
+	.long	.LASF4072
+	.byte	0x90
+	.byte	0x3d
+	.byte	0x1a
+	.byte	0x8
+	.long	0x7707
+	.uleb128 0x5
+	.long	.LASF4073
+	.byte	0x3d
+	.byte	0x1f
+	.byte	0xd
+	.long	0x5da5
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF4074
+	.byte	0x3d
+	.byte	0x24
+	.byte	0xd
+	.long	0x5dc9
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF4075
+	.byte	0x3d
+	.byte	0x2c
+	.byte	0xf
+	.long	0x5de1
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF4076
+	.byte	0x3d
+	.byte	0x2d
+	.byte	0xe
+	.long	0x5dd5
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF4077
+	.byte	0x3d
+	.byte	0x2f
+	.byte	0xd
+	.long	0x5db1
+	.byte	0x1c
+	.uleb128 0x5
+	.long	.LASF4078
+	.byte	0x3d
+	.byte	0x30
+	.byte	0xd
+	.long	0x5dbd
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF4079
+	.byte	0x3d
+	.byte	0x32
+	.byte	0x9
+	.long	0x5b95
+	.byte	0x24
+	.uleb128 0x5
+	.long	.LASF4080
+	.byte	0x3d
+	.byte	0x34
+	.byte	0xd
+	.long	0x5da5
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF4081
+	.byte	0x3d
+	.byte	0x39
+	.byte	0xd
+	.long	0x5ded
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF4082
+	.byte	0x3d
+	.byte	0x3d
+	.byte	0x11
+	.long	0x5e19
+	.byte	0x38
+	.uleb128 0x5
+	.long	.LASF4083
+	.byte	0x3d
+	.byte	0x3f
+	.byte	0x10
+	.long	0x5e25
+	.byte	0x40
+	.uleb128 0x5
+	.long	.LASF4084
+	.byte	0x3d
+	.byte	0x4a
+	.byte	0x15
+	.long	0x5e77
+	.byte	0x48
+	.uleb128 0x5
+	.long	.LASF4085
+	.byte	0x3d
+	.byte	0x4b
+	.byte	0x15
+	.long	0x5e77
+	.byte	0x58
+	.uleb128 0x5
+	.long	.LASF4086
+	.byte	0x3d
+	.byte	0x4c
+	.byte	0x15
+	.long	0x5e77
+	.byte	0x68
+	.uleb128 0x5
+	.long	.LASF4087
+	.byte	0x3d
+	.byte	0x59
+	.byte	0x17
+	.long	0x7707
+	.byte	0x78
+	.byte	0
+	.uleb128 0x32
+	.long	0x5e31
+	.long	0x7717
+	.uleb128 0x33
+	.long	0x5b74
+	.byte	0x2
+	.byte	0
+	.uleb128 0x95
+	.byte	0x20
+	.byte	0x10
+	.byte	0x28
+	.value	0x1a8
+	.byte	0x10
+	.long	.LASF4240
+	.long	0x7744
+	.uleb128 0x6a
+	.long	.LASF4088
+	.value	0x1a9
+	.byte	0xd
+	.long	0x5ba9
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6a
+	.long	.LASF4089
+	.value	0x1aa
+	.byte	0xf
+	.long	0x5bb0
+	.byte	0x10
+	.byte	0x10
+	.byte	0
+	.uleb128 0x96
+	.long	.LASF4090
+	.byte	0x28
+	.value	0x1b3
+	.byte	0x3
+	.long	0x7717
+	.byte	0x10
+	.uleb128 0x9
+	.long	0x31cf
+	.uleb128 0x9
+	.long	0x3392
+	.uleb128 0xa
+	.long	0x3392
+	.uleb128 0x2a
+	.long	0x31cf
+	.uleb128 0xa
+	.long	0x31cf
+	.uleb128 0x9
+	.long	0x33c3
+	.uleb128 0x3a
+	.long	0x5542
+	.uleb128 0x44
+	.long	.LASF4091
+	.byte	0x3e
+	.byte	0xa
+	.byte	0xb
+	.long	0x7a58
+	.uleb128 0x4d
+	.long	.LASF4099
+	.long	0x6359
+	.byte	0x2c
+	.long	0x77bb
+	.uleb128 0x17
+	.long	.LASF4092
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF4093
+	.byte	0x1
+	.uleb128 0x17
+	.long	.LASF4094
+	.byte	0x2
+	.uleb128 0x17
+	.long	.LASF4095
+	.byte	0x3
+	.uleb128 0x17
+	.long	.LASF4096
+	.byte	0x4
+	.uleb128 0x17
+	.long	.LASF4097
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF4098
+	.byte	0xff
+	.byte	0
+	.uleb128 0x4d
+	.long	.LASF4100
+	.long	0x6359
+	.byte	0x39
+	.long	0x77dc
+	.uleb128 0x17
+	.long	.LASF4101
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF4102
+	.byte	0x1
+	.uleb128 0x17
+	.long	.LASF4098
+	.byte	0xff
+	.byte	0
+	.uleb128 0x4d
+	.long	.LASF4103
+	.long	0x6359
+	.byte	0x40
+	.long	0x77fd
+	.uleb128 0x17
+	.long	.LASF4104
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF4105
+	.byte	0x1
+	.uleb128 0x17
+	.long	.LASF4098
+	.byte	0xff
+	.byte	0
+	.uleb128 0x4d
+	.long	.LASF4106
+	.long	0x6359
+	.byte	0x48
+	.long	0x7824
+	.uleb128 0x17
+	.long	.LASF4107
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF3391
+	.byte	0x1
+	.uleb128 0x17
+	.long	.LASF4108
+	.byte	0x2
+	.uleb128 0x17
+	.long	.LASF4098
+	.byte	0xff
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF4109
+	.byte	0x3e
+	.byte	0x10
+	.byte	0x12
+	.long	0x6371
+	.uleb128 0x8
+	.long	0x7824
+	.uleb128 0x6
+	.long	.LASF4110
+	.byte	0x3e
+	.byte	0xd
+	.byte	0x10
+	.long	0x5bb7
+	.uleb128 0x8
+	.long	0x7835
+	.uleb128 0x56
+	.long	.LASF4111
+	.byte	0x2
+	.byte	0x13
+	.byte	0x10
+	.long	0x7a68
+	.byte	0x8
+	.byte	0x49
+	.byte	0x4e
+	.byte	0x46
+	.byte	0x50
+	.byte	0x52
+	.byte	0x4f
+	.byte	0x50
+	.byte	0
+	.uleb128 0x97
+	.long	.LASF4112
+	.byte	0x2
+	.byte	0x14
+	.byte	0x14
+	.long	0x637d
+	.byte	0x1
+	.uleb128 0x12
+	.long	.LASF4113
+	.byte	0x10
+	.byte	0x2
+	.byte	0x16
+	.byte	0x8
+	.long	0x78ab
+	.uleb128 0x5
+	.long	.LASF4114
+	.byte	0x2
+	.byte	0x18
+	.byte	0x9
+	.long	0x5eaf
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF4115
+	.byte	0x2
+	.byte	0x19
+	.byte	0xd
+	.long	0x6371
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF4116
+	.byte	0x2
+	.byte	0x1b
+	.byte	0xd
+	.long	0x6365
+	.byte	0xc
+	.uleb128 0x5
+	.long	.LASF4117
+	.byte	0x2
+	.byte	0x1c
+	.byte	0xd
+	.long	0x6365
+	.byte	0xe
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF4118
+	.byte	0x8
+	.byte	0x2
+	.byte	0x1f
+	.byte	0x8
+	.long	0x78d3
+	.uleb128 0x5
+	.long	.LASF4119
+	.byte	0x2
+	.byte	0x21
+	.byte	0xd
+	.long	0x6371
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF4120
+	.byte	0x2
+	.byte	0x22
+	.byte	0xd
+	.long	0x6371
+	.byte	0x4
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF4121
+	.byte	0x18
+	.byte	0x3f
+	.byte	0x10
+	.byte	0x8
+	.long	0x7915
+	.uleb128 0x5
+	.long	.LASF4119
+	.byte	0x3f
+	.byte	0x12
+	.byte	0xd
+	.long	0x6371
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF4120
+	.byte	0x3f
+	.byte	0x13
+	.byte	0xd
+	.long	0x6371
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF4122
+	.byte	0x3f
+	.byte	0x14
+	.byte	0x10
+	.long	0x7a77
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF4123
+	.byte	0x3f
+	.byte	0x15
+	.byte	0x12
+	.long	0x7a81
+	.byte	0x10
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF4124
+	.byte	0x28
+	.byte	0x3f
+	.byte	0x1a
+	.byte	0x7
+	.long	0x7a3c
+	.uleb128 0x98
+	.long	.LASF4124
+	.byte	0x3f
+	.byte	0x1d
+	.byte	0xd
+	.long	.LASF4125
+	.byte	0x1
+	.long	0x7938
+	.long	0x7943
+	.uleb128 0x2
+	.long	0x7b80
+	.uleb128 0x1
+	.long	0x7631
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF4126
+	.byte	0x3f
+	.byte	0x1e
+	.byte	0x4
+	.long	.LASF4127
+	.long	0x7957
+	.long	0x7962
+	.uleb128 0x2
+	.long	0x7b80
+	.uleb128 0x2
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF4128
+	.byte	0x3f
+	.byte	0x20
+	.byte	0xb
+	.long	.LASF4129
+	.long	0x5bff
+	.byte	0x1
+	.long	0x797b
+	.long	0x7981
+	.uleb128 0x2
+	.long	0x7b8a
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF4130
+	.byte	0x3f
+	.byte	0x21
+	.byte	0x11
+	.long	.LASF4131
+	.long	0x78d3
+	.byte	0x1
+	.long	0x799a
+	.long	0x79a5
+	.uleb128 0x2
+	.long	0x7b8a
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF4132
+	.byte	0x3f
+	.byte	0x23
+	.byte	0x9
+	.long	.LASF4133
+	.long	0x4df0
+	.byte	0x1
+	.long	0x79be
+	.long	0x79ce
+	.uleb128 0x2
+	.long	0x7b8a
+	.uleb128 0x1
+	.long	0x6371
+	.uleb128 0x1
+	.long	0x7b94
+	.byte	0
+	.uleb128 0x99
+	.long	.LASF4124
+	.byte	0x3f
+	.byte	0x25
+	.byte	0x4
+	.long	.LASF4134
+	.byte	0x1
+	.long	0x79e4
+	.long	0x79ef
+	.uleb128 0x2
+	.long	0x7b80
+	.uleb128 0x1
+	.long	0x7b99
+	.byte	0
+	.uleb128 0x9a
+	.long	.LASF3136
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x13
+	.long	.LASF4135
+	.long	0x7b9e
+	.byte	0x1
+	.long	0x7a09
+	.long	0x7a14
+	.uleb128 0x2
+	.long	0x7b80
+	.uleb128 0x1
+	.long	0x7b99
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF4136
+	.byte	0x3f
+	.byte	0x29
+	.byte	0x10
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF4137
+	.byte	0x3f
+	.byte	0x2a
+	.byte	0xb
+	.long	0x5bff
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF4138
+	.byte	0x3f
+	.byte	0x2c
+	.byte	0x1a
+	.long	0x3b8d
+	.byte	0x10
+	.byte	0
+	.uleb128 0x8
+	.long	0x7915
+	.uleb128 0x67
+	.long	.LASF4139
+	.byte	0x2
+	.byte	0x29
+	.byte	0x11
+	.long	.LASF4140
+	.long	0x6382
+	.uleb128 0x1
+	.long	0x6371
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.long	0x5cc8
+	.long	0x7a68
+	.uleb128 0x33
+	.long	0x5b74
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.long	0x7a58
+	.uleb128 0x3a
+	.long	0x7846
+	.uleb128 0x3a
+	.long	0x785b
+	.uleb128 0x9
+	.long	0x7841
+	.uleb128 0x8
+	.long	0x7a77
+	.uleb128 0x9
+	.long	0x7830
+	.uleb128 0x8
+	.long	0x7a81
+	.uleb128 0x9
+	.long	0x342d
+	.uleb128 0x8
+	.long	0x7a8b
+	.uleb128 0xa
+	.long	0x35eb
+	.uleb128 0x9
+	.long	0x5b74
+	.uleb128 0x8
+	.long	0x7a9a
+	.uleb128 0x9
+	.long	0x35eb
+	.uleb128 0x8
+	.long	0x7aa4
+	.uleb128 0xa
+	.long	0x5b74
+	.uleb128 0x9
+	.long	0x5b7b
+	.uleb128 0x8
+	.long	0x7ab3
+	.uleb128 0xa
+	.long	0x5b7b
+	.uleb128 0x9
+	.long	0x35f0
+	.uleb128 0x8
+	.long	0x7ac2
+	.uleb128 0xa
+	.long	0x3679
+	.uleb128 0xa
+	.long	0x35f0
+	.uleb128 0xa
+	.long	0x36b7
+	.uleb128 0xa
+	.long	0x36c4
+	.uleb128 0xa
+	.long	0x55fd
+	.uleb128 0xa
+	.long	0x5609
+	.uleb128 0x9
+	.long	0x37bc
+	.uleb128 0x8
+	.long	0x7aea
+	.uleb128 0x2a
+	.long	0x37bc
+	.uleb128 0xa
+	.long	0x3864
+	.uleb128 0xa
+	.long	0x37bc
+	.uleb128 0x9
+	.long	0x3875
+	.uleb128 0x8
+	.long	0x7b03
+	.uleb128 0xa
+	.long	0x394c
+	.uleb128 0x2a
+	.long	0x3875
+	.uleb128 0x2a
+	.long	0x3940
+	.uleb128 0xa
+	.long	0x3940
+	.uleb128 0x9
+	.long	0x37af
+	.uleb128 0x8
+	.long	0x7b21
+	.uleb128 0x9
+	.long	0x3b65
+	.uleb128 0x8
+	.long	0x7b2b
+	.uleb128 0xa
+	.long	0x399a
+	.uleb128 0x2a
+	.long	0x37af
+	.uleb128 0xa
+	.long	0x3c59
+	.uleb128 0x9
+	.long	0x3b8d
+	.uleb128 0x8
+	.long	0x7b44
+	.uleb128 0xa
+	.long	0x3d09
+	.uleb128 0xa
+	.long	0x3d7c
+	.uleb128 0xa
+	.long	0x47b7
+	.uleb128 0x2a
+	.long	0x3b8d
+	.uleb128 0xa
+	.long	0x47c8
+	.uleb128 0xa
+	.long	0x3b8d
+	.uleb128 0x9
+	.long	0x47b7
+	.uleb128 0x8
+	.long	0x7b6c
+	.uleb128 0x2a
+	.long	0x3d6f
+	.uleb128 0xa
+	.long	0x3c66
+	.uleb128 0x9
+	.long	0x7915
+	.uleb128 0x8
+	.long	0x7b80
+	.uleb128 0x9
+	.long	0x7a3c
+	.uleb128 0x8
+	.long	0x7b8a
+	.uleb128 0xa
+	.long	0x78d3
+	.uleb128 0xa
+	.long	0x7a3c
+	.uleb128 0xa
+	.long	0x7915
+	.uleb128 0x9
+	.long	0x5892
+	.uleb128 0x8
+	.long	0x7ba3
+	.uleb128 0xa
+	.long	0x7ab8
+	.uleb128 0x9
+	.long	0x5acd
+	.uleb128 0x8
+	.long	0x7bb2
+	.uleb128 0xa
+	.long	0x5892
+	.uleb128 0xa
+	.long	0x5e42
+	.uleb128 0x9
+	.long	0x565f
+	.uleb128 0x8
+	.long	0x7bc6
+	.uleb128 0xa
+	.long	0x7a9f
+	.uleb128 0x9
+	.long	0x588d
+	.uleb128 0x8
+	.long	0x7bd5
+	.uleb128 0xa
+	.long	0x565f
+	.uleb128 0x9
+	.long	0x9279
+	.uleb128 0x2a
+	.long	0x9279
+	.uleb128 0xa
+	.long	0x92ae
+	.uleb128 0x9
+	.long	0x92ae
+	.uleb128 0x9
+	.long	0x4e16
+	.uleb128 0x8
+	.long	0x7bf8
+	.uleb128 0xa
+	.long	0x4ef9
+	.uleb128 0x2a
+	.long	0x4ebc
+	.uleb128 0x9
+	.long	0x52e7
+	.uleb128 0xa
+	.long	0x5cbc
+	.uleb128 0x9
+	.long	0x5515
+	.uleb128 0xa
+	.long	0x52e7
+	.uleb128 0x9
+	.long	0x50b4
+	.uleb128 0x9
+	.long	0x52e2
+	.uleb128 0xa
+	.long	0x50b4
+	.uleb128 0x9
+	.long	0x4ebc
+	.uleb128 0x10
+	.long	.LASF4141
+	.byte	0x40
+	.byte	0x4c
+	.byte	0xc
+	.long	0x5b95
+	.long	0x7c4f
+	.uleb128 0x1
+	.long	0x5e11
+	.uleb128 0x1
+	.long	0x5bff
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF4142
+	.byte	0x1
+	.byte	0x87
+	.byte	0x6
+	.long	.LASF4143
+	.long	0x7c6a
+	.uleb128 0x1
+	.long	0x5e11
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF4144
+	.byte	0x1
+	.byte	0x7e
+	.byte	0x19
+	.long	.LASF4145
+	.long	0x5e11
+	.long	0x7c84
+	.uleb128 0x1
+	.long	0x123
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF4146
+	.byte	0x40
+	.byte	0x5e
+	.byte	0xc
+	.long	0x5b95
+	.long	0x7ca4
+	.uleb128 0x1
+	.long	0x5e11
+	.uleb128 0x1
+	.long	0x5bff
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF4147
+	.byte	0x41
+	.value	0x166
+	.byte	0xc
+	.long	0x5b95
+	.long	0x7cbb
+	.uleb128 0x1
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF4148
+	.byte	0x40
+	.byte	0x39
+	.byte	0xe
+	.long	0x5e11
+	.long	0x7cea
+	.uleb128 0x1
+	.long	0x5e11
+	.uleb128 0x1
+	.long	0x5bff
+	.uleb128 0x1
+	.long	0x5b95
+	.uleb128 0x1
+	.long	0x5b95
+	.uleb128 0x1
+	.long	0x5b95
+	.uleb128 0x1
+	.long	0x5ded
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF4149
+	.byte	0x42
+	.byte	0xd2
+	.byte	0xc
+	.long	0x5b95
+	.long	0x7d05
+	.uleb128 0x1
+	.long	0x5b95
+	.uleb128 0x1
+	.long	0x7d05
+	.byte	0
+	.uleb128 0x9
+	.long	0x7636
+	.uleb128 0x9b
+	.long	.LASF4150
+	.byte	0x43
+	.byte	0x45
+	.byte	0xd
+	.long	0x7d2c
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x4de4
+	.uleb128 0x1
+	.long	0x5cb7
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF4151
+	.byte	0x44
+	.byte	0xb5
+	.byte	0xc
+	.long	0x5b95
+	.long	0x7d48
+	.uleb128 0x1
+	.long	0x5cb7
+	.uleb128 0x1
+	.long	0x5b95
+	.uleb128 0x3b
+	.byte	0
+	.uleb128 0x24
+	.long	0x3568
+	.long	0x7d67
+	.quad	.LFB3298
+	.quad	.LFE3298-.LFB3298
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7d74
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7aa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x30
+	.long	0x3587
+	.long	0x7d93
+	.quad	.LFB3294
+	.quad	.LFE3294-.LFB3294
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7da0
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7aa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x2b
+	.long	0x4972
+	.quad	.LFB3293
+	.quad	.LFE3293-.LFB3293
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7de3
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5b74
+	.uleb128 0x25
+	.string	"__a"
+	.byte	0x7
+	.byte	0xe6
+	.byte	0x14
+	.long	0x7abd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x25
+	.string	"__b"
+	.byte	0x7
+	.byte	0xe6
+	.byte	0x24
+	.long	0x7abd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x19
+	.long	0x3729
+	.quad	.LFB3292
+	.quad	.LFE3292-.LFB3292
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7e0f
+	.uleb128 0x21
+	.string	"__a"
+	.byte	0xb
+	.value	0x223
+	.byte	0x26
+	.long	0x7adb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x30
+	.long	0x59f9
+	.long	0x7e2e
+	.quad	.LFB3283
+	.quad	.LFE3283-.LFB3283
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7e4b
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7ba8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x21
+	.string	"__n"
+	.byte	0x9
+	.value	0x472
+	.byte	0x22
+	.long	0x59ec
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x19
+	.long	0x49a7
+	.quad	.LFB3281
+	.quad	.LFE3281-.LFB3281
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7ec9
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5b74
+	.uleb128 0xe
+	.string	"_Up"
+	.long	0x5b74
+	.uleb128 0xf
+	.long	.LASF4153
+	.byte	0x11
+	.value	0x44c
+	.byte	0x19
+	.long	0x7a9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xf
+	.long	.LASF4154
+	.byte	0x11
+	.value	0x44c
+	.byte	0x27
+	.long	0x7a9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xf
+	.long	.LASF4155
+	.byte	0x11
+	.value	0x44d
+	.byte	0xb
+	.long	0x7a9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xf
+	.long	.LASF4156
+	.byte	0x11
+	.value	0x44e
+	.byte	0x2b
+	.long	0x7ad1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x26
+	.long	.LASF3986
+	.byte	0x11
+	.value	0x450
+	.byte	0x11
+	.long	0x8a2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x2b
+	.long	0x49e3
+	.quad	.LFB3280
+	.quad	.LFE3280-.LFB3280
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7efe
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x7a9a
+	.uleb128 0xf
+	.long	.LASF4157
+	.byte	0x7
+	.value	0x139
+	.byte	0x1c
+	.long	0x7a9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x24
+	.long	0x350e
+	.long	0x7f1d
+	.quad	.LFB3279
+	.quad	.LFE3279-.LFB3279
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7f4f
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7a90
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x25
+	.string	"__n"
+	.byte	0xa
+	.byte	0x70
+	.byte	0x1a
+	.long	0x3537
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x2d
+	.long	0x5ee6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x58
+	.uleb128 0x36
+	.long	.LASF4203
+	.byte	0xa
+	.byte	0x84
+	.byte	0x17
+	.long	0x1d2
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	0x396f
+	.long	0x7f6e
+	.quad	.LFB3278
+	.quad	.LFE3278-.LFB3278
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7f7b
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7b30
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x19
+	.long	0x46a0
+	.quad	.LFB3277
+	.quad	.LFE3277-.LFB3277
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7fc7
+	.uleb128 0x21
+	.string	"__a"
+	.byte	0x3
+	.value	0x777
+	.byte	0x29
+	.long	0x7b7b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x26
+	.long	.LASF4158
+	.byte	0x3
+	.value	0x77c
+	.byte	0xf
+	.long	0x130
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x26
+	.long	.LASF4159
+	.byte	0x3
+	.value	0x77e
+	.byte	0xf
+	.long	0x130
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x19
+	.long	0x4a07
+	.quad	.LFB3276
+	.quad	.LFE3276-.LFB3276
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8022
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5cc1
+	.uleb128 0xe
+	.string	"_Up"
+	.long	0x5cc1
+	.uleb128 0x1e
+	.long	.LASF4160
+	.byte	0x7
+	.byte	0x5a
+	.byte	0x19
+	.long	0x5cb7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1e
+	.long	.LASF4161
+	.byte	0x7
+	.byte	0x5a
+	.byte	0x2e
+	.long	0x5cb7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x1e
+	.long	.LASF4162
+	.byte	0x7
+	.byte	0x5a
+	.byte	0x3f
+	.long	0x123
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x30
+	.long	0x58f0
+	.long	0x8041
+	.quad	.LFB3255
+	.quad	.LFE3255-.LFB3255
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x804e
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7bb7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x19
+	.long	0x4a3d
+	.quad	.LFB3254
+	.quad	.LFE3254-.LFB3254
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x80a2
+	.uleb128 0x7
+	.long	.LASF3706
+	.long	0x5892
+	.uleb128 0x7
+	.long	.LASF3707
+	.long	0x5ba2
+	.uleb128 0x25
+	.string	"__i"
+	.byte	0x10
+	.byte	0xb7
+	.byte	0x26
+	.long	0x7bbc
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x25
+	.string	"__n"
+	.byte	0x10
+	.byte	0xb7
+	.byte	0x35
+	.long	0x5ba2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x2d
+	.long	0x172
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.byte	0
+	.uleb128 0x19
+	.long	0x4a6f
+	.quad	.LFB3253
+	.quad	.LFE3253-.LFB3253
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x80ed
+	.uleb128 0x7
+	.long	.LASF3706
+	.long	0x5892
+	.uleb128 0x1e
+	.long	.LASF4153
+	.byte	0x10
+	.byte	0x63
+	.byte	0x26
+	.long	0x5892
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1e
+	.long	.LASF4154
+	.byte	0x10
+	.byte	0x63
+	.byte	0x45
+	.long	0x5892
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x2d
+	.long	0x172
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.long	0x5acd
+	.uleb128 0x2b
+	.long	0x4a9c
+	.quad	.LFB3252
+	.quad	.LFE3252-.LFB3252
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x811f
+	.uleb128 0x7
+	.long	.LASF3712
+	.long	0x5892
+	.uleb128 0x2d
+	.long	0x80ed
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x19
+	.long	0x4abf
+	.quad	.LFB3250
+	.quad	.LFE3250-.LFB3250
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8196
+	.uleb128 0x7
+	.long	.LASF3715
+	.long	0x7a9a
+	.uleb128 0x7
+	.long	.LASF3071
+	.long	0x7a9a
+	.uleb128 0x7
+	.long	.LASF3716
+	.long	0x35f0
+	.uleb128 0xf
+	.long	.LASF4153
+	.byte	0x11
+	.value	0x467
+	.byte	0x21
+	.long	0x7a9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xf
+	.long	.LASF4154
+	.byte	0x11
+	.value	0x467
+	.byte	0x39
+	.long	0x7a9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xf
+	.long	.LASF4155
+	.byte	0x11
+	.value	0x468
+	.byte	0x15
+	.long	0x7a9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xf
+	.long	.LASF4156
+	.byte	0x11
+	.value	0x468
+	.byte	0x2b
+	.long	0x7ad1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.uleb128 0x19
+	.long	0x3697
+	.quad	.LFB3249
+	.quad	.LFE3249-.LFB3249
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x81d2
+	.uleb128 0x21
+	.string	"__a"
+	.byte	0xb
+	.value	0x1cf
+	.byte	0x20
+	.long	0x7ad6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x21
+	.string	"__n"
+	.byte	0xb
+	.value	0x1cf
+	.byte	0x2f
+	.long	0x36c9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x2b
+	.long	0x4b04
+	.quad	.LFB3248
+	.quad	.LFE3248-.LFB3248
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8215
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5b74
+	.uleb128 0x25
+	.string	"__a"
+	.byte	0x7
+	.byte	0xfe
+	.byte	0x14
+	.long	0x7abd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x25
+	.string	"__b"
+	.byte	0x7
+	.byte	0xfe
+	.byte	0x24
+	.long	0x7abd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x24
+	.long	0x412a
+	.long	0x8234
+	.quad	.LFB3247
+	.quad	.LFE3247-.LFB3247
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8241
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7b71
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x19
+	.long	0x199
+	.quad	.LFB3246
+	.quad	.LFE3246-.LFB3246
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x82b8
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5cc1
+	.uleb128 0xf
+	.long	.LASF4160
+	.byte	0x7
+	.value	0x495
+	.byte	0x13
+	.long	0x5cb7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xf
+	.long	.LASF4163
+	.byte	0x7
+	.value	0x495
+	.byte	0x28
+	.long	0x5cb7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xf
+	.long	.LASF4161
+	.byte	0x7
+	.value	0x495
+	.byte	0x3c
+	.long	0x5cb7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4e
+	.quad	.LBB20
+	.quad	.LBE20-.LBB20
+	.uleb128 0x26
+	.long	.LASF4164
+	.byte	0x7
+	.value	0x497
+	.byte	0x15
+	.long	0x130
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	0x1ed
+	.quad	.LFB3245
+	.quad	.LFE3245-.LFB3245
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x82ed
+	.uleb128 0x7
+	.long	.LASF3071
+	.long	0x7a9a
+	.uleb128 0x2d
+	.long	0x7a9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x2d
+	.long	0x7a9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x24
+	.long	0x3544
+	.long	0x830c
+	.quad	.LFB3244
+	.quad	.LFE3244-.LFB3244
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8337
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7a90
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x25
+	.string	"__p"
+	.byte	0xa
+	.byte	0x8e
+	.byte	0x17
+	.long	0x7a9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x25
+	.string	"__n"
+	.byte	0xa
+	.byte	0x8e
+	.byte	0x26
+	.long	0x3537
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x30
+	.long	0x593d
+	.long	0x8356
+	.quad	.LFB3192
+	.quad	.LFE3192-.LFB3192
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8363
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7ba8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x24
+	.long	0x4e7b
+	.long	0x8394
+	.quad	.LFB3191
+	.quad	.LFE3191-.LFB3191
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x83bf
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x5892
+	.uleb128 0x7
+	.long	.LASF3758
+	.long	0x4deb
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7bfd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x1e
+	.long	.LASF4157
+	.byte	0xd
+	.byte	0xc3
+	.byte	0x17
+	.long	0x5892
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1e
+	.long	.LASF4165
+	.byte	0xd
+	.byte	0xc3
+	.byte	0x25
+	.long	0x762c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.uleb128 0x19
+	.long	0x4b2c
+	.quad	.LFB3190
+	.quad	.LFE3190-.LFB3190
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x841b
+	.uleb128 0x7
+	.long	.LASF3715
+	.long	0x5892
+	.uleb128 0x7
+	.long	.LASF3707
+	.long	0x5ba2
+	.uleb128 0x25
+	.string	"__i"
+	.byte	0x10
+	.byte	0xda
+	.byte	0x1d
+	.long	0x7bbc
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x25
+	.string	"__n"
+	.byte	0x10
+	.byte	0xda
+	.byte	0x2c
+	.long	0x5ba2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x9c
+	.string	"__d"
+	.byte	0x10
+	.byte	0xdd
+	.byte	0x41
+	.long	0x4932
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x19
+	.long	0x4b59
+	.quad	.LFB3189
+	.quad	.LFE3189-.LFB3189
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x845e
+	.uleb128 0x7
+	.long	.LASF3715
+	.long	0x5892
+	.uleb128 0x1e
+	.long	.LASF4153
+	.byte	0x10
+	.byte	0x93
+	.byte	0x1d
+	.long	0x5892
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1e
+	.long	.LASF4154
+	.byte	0x10
+	.byte	0x93
+	.byte	0x35
+	.long	0x5892
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x28
+	.long	0x4e30
+	.long	0x846b
+	.long	0x8481
+	.uleb128 0x1b
+	.long	.LASF4152
+	.long	0x7bfd
+	.uleb128 0x6b
+	.long	.LASF4168
+	.byte	0xd
+	.byte	0xae
+	.byte	0x1f
+	.long	0x9279
+	.byte	0
+	.uleb128 0x9d
+	.long	0x845e
+	.long	0x84a1
+	.quad	.LFB3187
+	.quad	.LFE3187-.LFB3187
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x84b2
+	.uleb128 0x1f
+	.long	0x846b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1f
+	.long	0x8474
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x2a
+	.long	0x4902
+	.uleb128 0x2b
+	.long	0x4b81
+	.quad	.LFB3185
+	.quad	.LFE3185-.LFB3185
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x84eb
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x4b9b
+	.uleb128 0x25
+	.string	"__t"
+	.byte	0xf
+	.byte	0x68
+	.byte	0x10
+	.long	0x4b9b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x30
+	.long	0x585a
+	.long	0x850a
+	.quad	.LFB3183
+	.quad	.LFE3183-.LFB3183
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8517
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7bda
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x19
+	.long	0x3c9a
+	.quad	.LFB3182
+	.quad	.LFE3182-.LFB3182
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8573
+	.uleb128 0xf
+	.long	.LASF4153
+	.byte	0x3
+	.value	0x1f3
+	.byte	0x1b
+	.long	0x3c1d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xf
+	.long	.LASF4154
+	.byte	0x3
+	.value	0x1f3
+	.byte	0x2c
+	.long	0x3c1d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xf
+	.long	.LASF4155
+	.byte	0x3
+	.value	0x1f3
+	.byte	0x3c
+	.long	0x3c1d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xf
+	.long	.LASF4156
+	.byte	0x3
+	.value	0x1f4
+	.byte	0x15
+	.long	0x7b3f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0x24
+	.long	0x3aea
+	.long	0x8592
+	.quad	.LFB3181
+	.quad	.LFE3181-.LFB3181
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x85af
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7b26
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x21
+	.string	"__n"
+	.byte	0x3
+	.value	0x177
+	.byte	0x1a
+	.long	0x123
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0xa
+	.long	0x588d
+	.uleb128 0x19
+	.long	0x5ad2
+	.quad	.LFB3180
+	.quad	.LFE3180-.LFB3180
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8602
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x7a9a
+	.uleb128 0x7
+	.long	.LASF3802
+	.long	0x3b8d
+	.uleb128 0xf
+	.long	.LASF4166
+	.byte	0x9
+	.value	0x532
+	.byte	0x3f
+	.long	0x85af
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xf
+	.long	.LASF4167
+	.byte	0x9
+	.value	0x533
+	.byte	0x38
+	.long	0x85af
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0x24
+	.long	0x3f67
+	.long	0x8621
+	.quad	.LFB3179
+	.quad	.LFE3179-.LFB3179
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x862e
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7b49
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x24
+	.long	0x4658
+	.long	0x864d
+	.quad	.LFB3178
+	.quad	.LFE3178-.LFB3178
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x868b
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7b71
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x21
+	.string	"__n"
+	.byte	0x3
+	.value	0x763
+	.byte	0x1e
+	.long	0x3d32
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x21
+	.string	"__s"
+	.byte	0x3
+	.value	0x763
+	.byte	0x2f
+	.long	0x5cb7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x26
+	.long	.LASF4164
+	.byte	0x3
+	.value	0x768
+	.byte	0x12
+	.long	0x3d3f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x28
+	.long	0x5691
+	.long	0x8698
+	.long	0x86ab
+	.uleb128 0x1b
+	.long	.LASF4152
+	.long	0x7bcb
+	.uleb128 0x6c
+	.string	"__i"
+	.long	0x7bd0
+	.byte	0
+	.uleb128 0x46
+	.long	0x868b
+	.long	.LASF4170
+	.long	0x86ce
+	.quad	.LFB3176
+	.quad	.LFE3176-.LFB3176
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x86df
+	.uleb128 0x1f
+	.long	0x8698
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1f
+	.long	0x86a1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x24
+	.long	0x35a5
+	.long	0x8716
+	.quad	.LFB3174
+	.quad	.LFE3174-.LFB3174
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8740
+	.uleb128 0xe
+	.string	"_Up"
+	.long	0x5b74
+	.uleb128 0x40
+	.long	.LASF3527
+	.long	0x8716
+	.uleb128 0x41
+	.long	0x7abd
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7a90
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x25
+	.string	"__p"
+	.byte	0xa
+	.byte	0xad
+	.byte	0x11
+	.long	0x7a9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x9e
+	.byte	0xa
+	.byte	0xad
+	.byte	0x1d
+	.uleb128 0x2d
+	.long	0x7abd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x48bc
+	.uleb128 0x2b
+	.long	0x4ba6
+	.quad	.LFB3173
+	.quad	.LFE3173-.LFB3173
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8779
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x7abd
+	.uleb128 0x25
+	.string	"__t"
+	.byte	0xf
+	.byte	0x4d
+	.byte	0x38
+	.long	0x8740
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x19
+	.long	0x4bc9
+	.quad	.LFB3172
+	.quad	.LFE3172-.LFB3172
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x87e7
+	.uleb128 0x7
+	.long	.LASF3727
+	.long	0x5cb7
+	.uleb128 0x7
+	.long	.LASF3728
+	.long	0x5e3d
+	.uleb128 0xf
+	.long	.LASF4160
+	.byte	0x7
+	.value	0x4b4
+	.byte	0x17
+	.long	0x5cb7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xf
+	.long	.LASF4163
+	.byte	0x7
+	.value	0x4b4
+	.byte	0x26
+	.long	0x5cb7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xf
+	.long	.LASF4161
+	.byte	0x7
+	.value	0x4b4
+	.byte	0x34
+	.long	0x5e3d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x26
+	.long	.LASF4169
+	.byte	0x7
+	.value	0x4b7
+	.byte	0x12
+	.long	0x4df7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -17
+	.byte	0
+	.uleb128 0x2b
+	.long	0x4c00
+	.quad	.LFB3171
+	.quad	.LFE3171-.LFB3171
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x881c
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x5e3d
+	.uleb128 0xf
+	.long	.LASF4157
+	.byte	0x7
+	.value	0x139
+	.byte	0x1c
+	.long	0x5e3d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x2b
+	.long	0x4c24
+	.quad	.LFB3170
+	.quad	.LFE3170-.LFB3170
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8851
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x5cb7
+	.uleb128 0xf
+	.long	.LASF4157
+	.byte	0x7
+	.value	0x139
+	.byte	0x1c
+	.long	0x5cb7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x19
+	.long	0x4c48
+	.quad	.LFB3169
+	.quad	.LFE3169-.LFB3169
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8894
+	.uleb128 0x7
+	.long	.LASF3071
+	.long	0x7a9a
+	.uleb128 0x1e
+	.long	.LASF4153
+	.byte	0xe
+	.byte	0xb6
+	.byte	0x1f
+	.long	0x7a9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1e
+	.long	.LASF4154
+	.byte	0xe
+	.byte	0xb6
+	.byte	0x39
+	.long	0x7a9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x19
+	.long	0x3708
+	.quad	.LFB3168
+	.quad	.LFE3168-.LFB3168
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x88e0
+	.uleb128 0x21
+	.string	"__a"
+	.byte	0xb
+	.value	0x1ef
+	.byte	0x22
+	.long	0x7ad6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x21
+	.string	"__p"
+	.byte	0xb
+	.value	0x1ef
+	.byte	0x2f
+	.long	0x368a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x21
+	.string	"__n"
+	.byte	0xb
+	.value	0x1ef
+	.byte	0x3e
+	.long	0x36c9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x28
+	.long	0x343a
+	.long	0x88ed
+	.long	0x88f7
+	.uleb128 0x1b
+	.long	.LASF4152
+	.long	0x7a90
+	.byte	0
+	.uleb128 0x46
+	.long	0x88e0
+	.long	.LASF4171
+	.long	0x891a
+	.quad	.LFB3166
+	.quad	.LFE3166-.LFB3166
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8923
+	.uleb128 0x1f
+	.long	0x88ed
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x30
+	.long	0x5a8d
+	.long	0x8942
+	.quad	.LFB3090
+	.quad	.LFE3090-.LFB3090
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x894f
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7bb7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x19
+	.long	0x4c6c
+	.quad	.LFB3089
+	.quad	.LFE3089-.LFB3089
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8a17
+	.uleb128 0x7
+	.long	.LASF3071
+	.long	0x5892
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x4de4
+	.uleb128 0x7
+	.long	.LASF3737
+	.long	0x4e16
+	.uleb128 0xf
+	.long	.LASF4153
+	.byte	0x7
+	.value	0x5aa
+	.byte	0x24
+	.long	0x5892
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xf
+	.long	.LASF4154
+	.byte	0x7
+	.value	0x5aa
+	.byte	0x3e
+	.long	0x5892
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xf
+	.long	.LASF4165
+	.byte	0x7
+	.value	0x5ab
+	.byte	0x10
+	.long	0x762c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0xf
+	.long	.LASF4168
+	.byte	0x7
+	.value	0x5ab
+	.byte	0x20
+	.long	0x4e16
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x16
+	.long	.LASF4172
+	.byte	0x7
+	.value	0x5ae
+	.byte	0x2
+	.long	0x4932
+	.uleb128 0x26
+	.long	.LASF4164
+	.byte	0x7
+	.value	0x5b0
+	.byte	0x15
+	.long	0x89c7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4e
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.uleb128 0x26
+	.long	.LASF4173
+	.byte	0x7
+	.value	0x5b4
+	.byte	0x12
+	.long	0x89c7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x26
+	.long	.LASF4174
+	.byte	0x7
+	.value	0x5b5
+	.byte	0x15
+	.long	0x5892
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x4efe
+	.quad	.LFB3088
+	.quad	.LFE3088-.LFB3088
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8a4b
+	.uleb128 0x7
+	.long	.LASF3737
+	.long	0x9279
+	.uleb128 0x1e
+	.long	.LASF4168
+	.byte	0xd
+	.byte	0xca
+	.byte	0x1e
+	.long	0x9279
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x28
+	.long	0x58c4
+	.long	0x8a58
+	.long	0x8a6b
+	.uleb128 0x1b
+	.long	.LASF4152
+	.long	0x7ba8
+	.uleb128 0x6c
+	.string	"__i"
+	.long	0x7bad
+	.byte	0
+	.uleb128 0x46
+	.long	0x8a4b
+	.long	.LASF4175
+	.long	0x8a8e
+	.quad	.LFB3086
+	.quad	.LFE3086-.LFB3086
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8a9f
+	.uleb128 0x1f
+	.long	0x8a58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1f
+	.long	0x8a61
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x24
+	.long	0x476f
+	.long	0x8acd
+	.quad	.LFB3081
+	.quad	.LFE3081-.LFB3081
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8b62
+	.uleb128 0x40
+	.long	.LASF3527
+	.long	0x8acd
+	.uleb128 0x41
+	.long	0x7abd
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7b49
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0xf
+	.long	.LASF4176
+	.byte	0xc
+	.value	0x1b8
+	.byte	0x22
+	.long	0x3f5a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x9f
+	.byte	0xc
+	.value	0x1b8
+	.byte	0x35
+	.long	0x8aff
+	.uleb128 0x2d
+	.long	0x7abd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF4164
+	.byte	0xc
+	.value	0x1c0
+	.byte	0x17
+	.long	0x3d3f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x26
+	.long	.LASF4177
+	.byte	0xc
+	.value	0x1c2
+	.byte	0xf
+	.long	0x3c1d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x26
+	.long	.LASF4178
+	.byte	0xc
+	.value	0x1c3
+	.byte	0xf
+	.long	0x3c1d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x26
+	.long	.LASF4179
+	.byte	0xc
+	.value	0x1c4
+	.byte	0x17
+	.long	0x3d3f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x26
+	.long	.LASF4180
+	.byte	0xc
+	.value	0x1c5
+	.byte	0xf
+	.long	0x3c1d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x26
+	.long	.LASF4181
+	.byte	0xc
+	.value	0x1c6
+	.byte	0xf
+	.long	0x3c1d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x24
+	.long	0x3fb4
+	.long	0x8b81
+	.quad	.LFB3080
+	.quad	.LFE3080-.LFB3080
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8b8e
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7b49
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x19
+	.long	0x3779
+	.quad	.LFB3079
+	.quad	.LFE3079-.LFB3079
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8bf1
+	.uleb128 0xe
+	.string	"_Up"
+	.long	0x5b74
+	.uleb128 0x40
+	.long	.LASF3527
+	.long	0x8bc1
+	.uleb128 0x41
+	.long	0x7abd
+	.byte	0
+	.uleb128 0x21
+	.string	"__a"
+	.byte	0xb
+	.value	0x1ff
+	.byte	0x1c
+	.long	0x7ad6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x21
+	.string	"__p"
+	.byte	0xb
+	.value	0x1ff
+	.byte	0x42
+	.long	0x7a9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xa0
+	.byte	0xb
+	.value	0x200
+	.byte	0xc
+	.uleb128 0x2d
+	.long	0x7abd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x4cac
+	.quad	.LFB3076
+	.quad	.LFE3076-.LFB3076
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8c4f
+	.uleb128 0x7
+	.long	.LASF3727
+	.long	0x5cb7
+	.uleb128 0x7
+	.long	.LASF3728
+	.long	0x5e3d
+	.uleb128 0xf
+	.long	.LASF4160
+	.byte	0x7
+	.value	0x4c0
+	.byte	0x16
+	.long	0x5cb7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xf
+	.long	.LASF4163
+	.byte	0x7
+	.value	0x4c0
+	.byte	0x25
+	.long	0x5cb7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xf
+	.long	.LASF4161
+	.byte	0x7
+	.value	0x4c0
+	.byte	0x33
+	.long	0x5e3d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.uleb128 0x19
+	.long	0x4ce3
+	.quad	.LFB3075
+	.quad	.LFE3075-.LFB3075
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8ca5
+	.uleb128 0x7
+	.long	.LASF3071
+	.long	0x7a9a
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5b74
+	.uleb128 0xf
+	.long	.LASF4153
+	.byte	0xb
+	.value	0x34f
+	.byte	0x1f
+	.long	0x7a9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xf
+	.long	.LASF4154
+	.byte	0xb
+	.value	0x34f
+	.byte	0x39
+	.long	0x7a9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x2d
+	.long	0x7ad1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x30
+	.long	0x3951
+	.long	0x8cc4
+	.quad	.LFB3074
+	.quad	.LFE3074-.LFB3074
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8cd1
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7b26
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x24
+	.long	0x3b0d
+	.long	0x8cf0
+	.quad	.LFB3073
+	.quad	.LFE3073-.LFB3073
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8d1d
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7b26
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x21
+	.string	"__p"
+	.byte	0x3
+	.value	0x17f
+	.byte	0x1d
+	.long	0x3869
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x21
+	.string	"__n"
+	.byte	0x3
+	.value	0x17f
+	.byte	0x29
+	.long	0x123
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x28
+	.long	0x3473
+	.long	0x8d2a
+	.long	0x8d3d
+	.uleb128 0x1b
+	.long	.LASF4152
+	.long	0x7a90
+	.uleb128 0x1b
+	.long	.LASF4182
+	.long	0x5b9d
+	.byte	0
+	.uleb128 0x46
+	.long	0x8d1d
+	.long	.LASF4183
+	.long	0x8d60
+	.quad	.LFB3071
+	.quad	.LFE3071-.LFB3071
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8d69
+	.uleb128 0x1f
+	.long	0x8d2a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x28
+	.long	0x37f0
+	.long	0x8d76
+	.long	0x8d80
+	.uleb128 0x1b
+	.long	.LASF4152
+	.long	0x7aef
+	.byte	0
+	.uleb128 0x46
+	.long	0x8d69
+	.long	.LASF4184
+	.long	0x8da3
+	.quad	.LFB3068
+	.quad	.LFE3068-.LFB3068
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8dac
+	.uleb128 0x1f
+	.long	0x8d76
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x28
+	.long	0x3603
+	.long	0x8db9
+	.long	0x8dc3
+	.uleb128 0x1b
+	.long	.LASF4152
+	.long	0x7ac7
+	.byte	0
+	.uleb128 0x31
+	.long	0x8dac
+	.long	.LASF4185
+	.long	0x8de6
+	.quad	.LFB3065
+	.quad	.LFE3065-.LFB3065
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8def
+	.uleb128 0x1f
+	.long	0x8db9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x19
+	.long	0x5b04
+	.quad	.LFB2942
+	.quad	.LFE2942-.LFB2942
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8e3d
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x7ab3
+	.uleb128 0x7
+	.long	.LASF3802
+	.long	0x3b8d
+	.uleb128 0xf
+	.long	.LASF4166
+	.byte	0x9
+	.value	0x532
+	.byte	0x3f
+	.long	0x80ed
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xf
+	.long	.LASF4167
+	.byte	0x9
+	.value	0x533
+	.byte	0x38
+	.long	0x80ed
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0x19
+	.long	0x5b36
+	.quad	.LFB2941
+	.quad	.LFE2941-.LFB2941
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8e8b
+	.uleb128 0x7
+	.long	.LASF3687
+	.long	0x7ab3
+	.uleb128 0x7
+	.long	.LASF3802
+	.long	0x3b8d
+	.uleb128 0xf
+	.long	.LASF4166
+	.byte	0x9
+	.value	0x4c5
+	.byte	0x40
+	.long	0x80ed
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xf
+	.long	.LASF4167
+	.byte	0x9
+	.value	0x4c6
+	.byte	0x39
+	.long	0x80ed
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0x19
+	.long	0x4d16
+	.quad	.LFB2940
+	.quad	.LFE2940-.LFB2940
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8f02
+	.uleb128 0x7
+	.long	.LASF3743
+	.long	0x5892
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x4de4
+	.uleb128 0x7
+	.long	.LASF3737
+	.long	0x9279
+	.uleb128 0xf
+	.long	.LASF4153
+	.byte	0x8
+	.value	0x7ca
+	.byte	0x22
+	.long	0x5892
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xf
+	.long	.LASF4154
+	.byte	0x8
+	.value	0x7ca
+	.byte	0x3c
+	.long	0x5892
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xf
+	.long	.LASF4165
+	.byte	0x8
+	.value	0x7cb
+	.byte	0xe
+	.long	0x762c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xf
+	.long	.LASF4168
+	.byte	0x8
+	.value	0x7cb
+	.byte	0x1e
+	.long	0x9279
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0x24
+	.long	0x3fd2
+	.long	0x8f21
+	.quad	.LFB2939
+	.quad	.LFE2939-.LFB2939
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8f2e
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7b71
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x24
+	.long	0x3f94
+	.long	0x8f4d
+	.quad	.LFB2938
+	.quad	.LFE2938-.LFB2938
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8f5a
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7b71
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x30
+	.long	0x424b
+	.long	0x8f79
+	.quad	.LFB2937
+	.quad	.LFE2937-.LFB2937
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8f96
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7b71
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x21
+	.string	"__n"
+	.byte	0x3
+	.value	0x474
+	.byte	0x1c
+	.long	0x3d32
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x30
+	.long	0x410a
+	.long	0x8fb5
+	.quad	.LFB2936
+	.quad	.LFE2936-.LFB2936
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8fc2
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7b71
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x24
+	.long	0x4395
+	.long	0x8fe1
+	.quad	.LFB2934
+	.quad	.LFE2934-.LFB2934
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8ffe
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7b49
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x21
+	.string	"__x"
+	.byte	0x3
+	.value	0x4fc
+	.byte	0x23
+	.long	0x7b53
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x19
+	.long	0x4d56
+	.quad	.LFB2933
+	.quad	.LFE2933-.LFB2933
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x905c
+	.uleb128 0x7
+	.long	.LASF3727
+	.long	0x5cb7
+	.uleb128 0x7
+	.long	.LASF3728
+	.long	0x5e3d
+	.uleb128 0xf
+	.long	.LASF4160
+	.byte	0x7
+	.value	0x609
+	.byte	0x10
+	.long	0x5cb7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xf
+	.long	.LASF4163
+	.byte	0x7
+	.value	0x609
+	.byte	0x1f
+	.long	0x5cb7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xf
+	.long	.LASF4161
+	.byte	0x7
+	.value	0x609
+	.byte	0x2d
+	.long	0x5e3d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0xa
+	.long	0x7a58
+	.uleb128 0x2b
+	.long	0x4d8d
+	.quad	.LFB2932
+	.quad	.LFE2932-.LFB2932
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x909f
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5cc8
+	.uleb128 0x3f
+	.string	"_Nm"
+	.long	0x5b74
+	.byte	0x8
+	.uleb128 0x1e
+	.long	.LASF4186
+	.byte	0x6
+	.byte	0x6a
+	.byte	0xf
+	.long	0x905c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x2b
+	.long	0x4dba
+	.quad	.LFB2931
+	.quad	.LFE2931-.LFB2931
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x90dd
+	.uleb128 0xe
+	.string	"_Tp"
+	.long	0x5cc8
+	.uleb128 0x3f
+	.string	"_Nm"
+	.long	0x5b74
+	.byte	0x8
+	.uleb128 0x1e
+	.long	.LASF4186
+	.byte	0x6
+	.byte	0x5f
+	.byte	0x11
+	.long	0x905c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x28
+	.long	0x3e84
+	.long	0x90ea
+	.long	0x90fd
+	.uleb128 0x1b
+	.long	.LASF4152
+	.long	0x7b49
+	.uleb128 0x1b
+	.long	.LASF4182
+	.long	0x5b9d
+	.byte	0
+	.uleb128 0x31
+	.long	0x90dd
+	.long	.LASF4187
+	.long	0x9120
+	.quad	.LFB2929
+	.quad	.LFE2929-.LFB2929
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9129
+	.uleb128 0x1f
+	.long	0x90ea
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x28
+	.long	0x3abd
+	.long	0x9136
+	.long	0x9149
+	.uleb128 0x1b
+	.long	.LASF4152
+	.long	0x7b26
+	.uleb128 0x1b
+	.long	.LASF4182
+	.long	0x5b9d
+	.byte	0
+	.uleb128 0x31
+	.long	0x9129
+	.long	.LASF4188
+	.long	0x916c
+	.quad	.LFB2926
+	.quad	.LFE2926-.LFB2926
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9175
+	.uleb128 0x1f
+	.long	0x9136
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x28
+	.long	0x365f
+	.long	0x9182
+	.long	0x9195
+	.uleb128 0x1b
+	.long	.LASF4152
+	.long	0x7ac7
+	.uleb128 0x1b
+	.long	.LASF4182
+	.long	0x5b9d
+	.byte	0
+	.uleb128 0x31
+	.long	0x9175
+	.long	.LASF4189
+	.long	0x91b8
+	.quad	.LFB2923
+	.quad	.LFE2923-.LFB2923
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x91c1
+	.uleb128 0x1f
+	.long	0x9182
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x28
+	.long	0x388c
+	.long	0x91ce
+	.long	0x91d8
+	.uleb128 0x1b
+	.long	.LASF4152
+	.long	0x7b08
+	.byte	0
+	.uleb128 0x31
+	.long	0x91c1
+	.long	.LASF4190
+	.long	0x91fb
+	.quad	.LFB2920
+	.quad	.LFE2920-.LFB2920
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9204
+	.uleb128 0x1f
+	.long	0x91ce
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0xa1
+	.long	0x2ac4
+	.long	0x9212
+	.long	0x921c
+	.uleb128 0x1b
+	.long	.LASF4152
+	.long	0x75fa
+	.byte	0
+	.uleb128 0x59
+	.long	0x79a5
+	.byte	0x57
+	.byte	0x6
+	.long	0x923d
+	.quad	.LFB2640
+	.quad	.LFE2640-.LFB2640
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x936e
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7b8f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x1e
+	.long	.LASF4191
+	.byte	0x4
+	.byte	0x57
+	.byte	0x2f
+	.long	0x637d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0x1e
+	.long	.LASF4192
+	.byte	0x4
+	.byte	0x57
+	.byte	0x4b
+	.long	0x7b94
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x3c
+	.long	.LASF4193
+	.byte	0x4
+	.byte	0x5a
+	.byte	0xf
+	.long	0x5acd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xa2
+	.byte	0x8
+	.byte	0x4
+	.byte	0x5c
+	.byte	0xc
+	.uleb128 0x5a
+	.long	.LASF4194
+	.long	0x928c
+	.long	0x9297
+	.uleb128 0x2
+	.long	0x7be4
+	.uleb128 0x1
+	.long	0x7be9
+	.byte	0
+	.uleb128 0x5a
+	.long	.LASF4194
+	.long	0x92a4
+	.long	0x92b4
+	.uleb128 0x2
+	.long	0x7be4
+	.uleb128 0x1
+	.long	0x7bee
+	.uleb128 0x8
+	.long	0x9279
+	.byte	0
+	.uleb128 0xa3
+	.long	.LASF4194
+	.long	0x92c2
+	.long	0x92c8
+	.uleb128 0x2
+	.long	0x7be4
+	.byte	0
+	.uleb128 0x5a
+	.long	.LASF4196
+	.long	0x92d5
+	.long	0x92e0
+	.uleb128 0x2
+	.long	0x7be4
+	.uleb128 0x2
+	.long	0x5b95
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF4197
+	.byte	0x4
+	.byte	0x5c
+	.byte	0x8
+	.long	0x7b8a
+	.byte	0
+	.uleb128 0xa4
+	.long	.LASF3051
+	.long	0x4df0
+	.long	0x930d
+	.quad	.LFB2641
+	.quad	.LFE2641-.LFB2641
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x14
+	.long	.LASF4198
+	.long	0x9319
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.long	0x7bf3
+	.uleb128 0x1e
+	.long	.LASF4199
+	.byte	0x4
+	.byte	0x5c
+	.byte	0x1d
+	.long	0x638e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1e
+	.long	.LASF4200
+	.byte	0x4
+	.byte	0x5c
+	.byte	0x34
+	.long	0x637d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0xa5
+	.long	.LASF4152
+	.long	0x7b8f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x6
+	.uleb128 0x4e
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.uleb128 0x3c
+	.long	.LASF4201
+	.byte	0x4
+	.byte	0x5e
+	.byte	0x1e
+	.long	0x78ab
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.long	0x7981
+	.byte	0x49
+	.byte	0xe
+	.long	0x938f
+	.quad	.LFB2639
+	.quad	.LFE2639-.LFB2639
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x93fd
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7b8f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1e
+	.long	.LASF4202
+	.byte	0x4
+	.byte	0x49
+	.byte	0x34
+	.long	0x5c0b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0xa6
+	.long	.LASF4204
+	.long	0x940d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.uleb128 0x3c
+	.long	.LASF4205
+	.byte	0x4
+	.byte	0x4d
+	.byte	0x16
+	.long	0x5cbc
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3c
+	.long	.LASF4201
+	.byte	0x4
+	.byte	0x4e
+	.byte	0x18
+	.long	0x78ab
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x3c
+	.long	.LASF4206
+	.byte	0x4
+	.byte	0x52
+	.byte	0x16
+	.long	0x7a7c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3c
+	.long	.LASF4207
+	.byte	0x4
+	.byte	0x53
+	.byte	0x18
+	.long	0x7a86
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.uleb128 0x32
+	.long	0x5cc8
+	.long	0x940d
+	.uleb128 0x33
+	.long	0x5b74
+	.byte	0x49
+	.byte	0
+	.uleb128 0x8
+	.long	0x93fd
+	.uleb128 0x59
+	.long	0x7962
+	.byte	0x44
+	.byte	0x8
+	.long	0x9433
+	.quad	.LFB2638
+	.quad	.LFE2638-.LFB2638
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9440
+	.uleb128 0x14
+	.long	.LASF4152
+	.long	0x7b8f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x5b
+	.long	0x7943
+	.byte	0x4
+	.byte	0x3f
+	.byte	0x1
+	.long	0x9451
+	.byte	0
+	.long	0x9464
+	.uleb128 0x1b
+	.long	.LASF4152
+	.long	0x7b85
+	.uleb128 0x1b
+	.long	.LASF4182
+	.long	0x5b9d
+	.byte	0
+	.uleb128 0x31
+	.long	0x9440
+	.long	.LASF4208
+	.long	0x9487
+	.quad	.LFB2636
+	.quad	.LFE2636-.LFB2636
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9490
+	.uleb128 0x1f
+	.long	0x9451
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x5b
+	.long	0x7922
+	.byte	0x4
+	.byte	0x15
+	.byte	0x1
+	.long	0x94a1
+	.byte	0
+	.long	0x9519
+	.uleb128 0x1b
+	.long	.LASF4152
+	.long	0x7b85
+	.uleb128 0x6b
+	.long	.LASF4209
+	.byte	0x4
+	.byte	0x15
+	.byte	0x31
+	.long	0x7631
+	.uleb128 0xa7
+	.long	.LASF4204
+	.long	0x9529
+	.uleb128 0x58
+	.uleb128 0x36
+	.long	.LASF4210
+	.byte	0x4
+	.byte	0x1a
+	.byte	0xe
+	.long	0x5b9d
+	.uleb128 0x36
+	.long	.LASF4211
+	.byte	0x4
+	.byte	0x1d
+	.byte	0x10
+	.long	0x7636
+	.uleb128 0x36
+	.long	.LASF4212
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x1f
+	.long	0x5b9d
+	.uleb128 0x36
+	.long	.LASF4213
+	.byte	0x4
+	.byte	0x24
+	.byte	0x10
+	.long	0x5e14
+	.uleb128 0x36
+	.long	.LASF4214
+	.byte	0x4
+	.byte	0x2a
+	.byte	0x17
+	.long	0x7869
+	.uleb128 0x36
+	.long	.LASF4199
+	.byte	0x4
+	.byte	0x32
+	.byte	0xd
+	.long	0x6382
+	.uleb128 0x58
+	.uleb128 0x36
+	.long	.LASF4201
+	.byte	0x4
+	.byte	0x36
+	.byte	0x1b
+	.long	0x78ab
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.long	0x5cc8
+	.long	0x9529
+	.uleb128 0x33
+	.long	0x5b74
+	.byte	0x3b
+	.byte	0
+	.uleb128 0x8
+	.long	0x9519
+	.uleb128 0x31
+	.long	0x9490
+	.long	.LASF4215
+	.long	0x9551
+	.quad	.LFB2633
+	.quad	.LFE2633-.LFB2633
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9613
+	.uleb128 0x1f
+	.long	0x94a1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x1f
+	.long	0x94aa
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0xa8
+	.long	0x9599
+	.uleb128 0x6d
+	.long	0x94c0
+	.uleb128 0x3d
+	.long	0x94c1
+	.uleb128 0x3d
+	.long	0x94cd
+	.uleb128 0x3d
+	.long	0x94d9
+	.uleb128 0x3d
+	.long	0x94e5
+	.uleb128 0x3d
+	.long	0x94f1
+	.uleb128 0x3d
+	.long	0x94fd
+	.uleb128 0x6d
+	.long	0x9509
+	.uleb128 0x3d
+	.long	0x950a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.uleb128 0x6e
+	.long	0x94c0
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.uleb128 0x3e
+	.long	0x94c1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x3e
+	.long	0x94cd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.uleb128 0x3e
+	.long	0x94d9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3e
+	.long	0x94e5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3e
+	.long	0x94f1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x3e
+	.long	0x94fd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x6e
+	.long	0x9509
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.uleb128 0x3e
+	.long	0x950a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	0x3cc4
+	.long	0x9620
+	.long	0x962a
+	.uleb128 0x1b
+	.long	.LASF4152
+	.long	0x7b49
+	.byte	0
+	.uleb128 0x31
+	.long	0x9613
+	.long	.LASF4216
+	.long	0x964d
+	.quad	.LFB2631
+	.quad	.LFE2631-.LFB2631
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9656
+	.uleb128 0x1f
+	.long	0x9620
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x28
+	.long	0x39bd
+	.long	0x9663
+	.long	0x966d
+	.uleb128 0x1b
+	.long	.LASF4152
+	.long	0x7b26
+	.byte	0
+	.uleb128 0x31
+	.long	0x9656
+	.long	.LASF4217
+	.long	0x9690
+	.quad	.LFB2629
+	.quad	.LFE2629-.LFB2629
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9699
+	.uleb128 0x1f
+	.long	0x9663
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x5b
+	.long	0x3927
+	.byte	0x3
+	.byte	0x85
+	.byte	0xe
+	.long	0x96aa
+	.byte	0x2
+	.long	0x96bd
+	.uleb128 0x1b
+	.long	.LASF4152
+	.long	0x7b08
+	.uleb128 0x1b
+	.long	.LASF4182
+	.long	0x5b9d
+	.byte	0
+	.uleb128 0x31
+	.long	0x9699
+	.long	.LASF4218
+	.long	0x96e0
+	.quad	.LFB2627
+	.quad	.LFE2627-.LFB2627
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x96e9
+	.uleb128 0x1f
+	.long	0x96aa
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x2b
+	.long	0x7a41
+	.quad	.LFB2609
+	.quad	.LFE2609-.LFB2609
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9723
+	.uleb128 0x1e
+	.long	.LASF4219
+	.byte	0x2
+	.byte	0x29
+	.byte	0x36
+	.long	0x637d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x3c
+	.long	.LASF4220
+	.byte	0x2
+	.byte	0x2b
+	.byte	0x13
+	.long	0x638e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0xa9
+	.long	.LASF4144
+	.byte	0x1
+	.byte	0xae
+	.byte	0x20
+	.long	.LASF4221
+	.long	0x5e11
+	.quad	.LFB408
+	.quad	.LFE408-.LFB408
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9762
+	.uleb128 0x2d
+	.long	0x123
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x25
+	.string	"__p"
+	.byte	0x1
+	.byte	0xae
+	.byte	0x40
+	.long	0x5e11
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x10
+	.byte	0x5
+	.long	.LASF4222
+	.uleb128 0x1d
+	.byte	0x10
+	.byte	0x7
+	.long	.LASF4223
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x10
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 45
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x42
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 37
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x1c
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x30
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x4107
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x2
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1e
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 1046
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 2
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x6d
+	.uleb128 0x19
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 62
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x1c
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 41
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xa
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5c
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.byte	0
+	.byte	0
+	.uleb128 0x5d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x60
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x61
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x62
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x63
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x64
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x65
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 36
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x66
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x67
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x68
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 45
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xa
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x69
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x6a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 40
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 1072
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 42
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x6f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x70
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x71
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x72
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x73
+	.uleb128 0x30
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x74
+	.uleb128 0x4
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x6d
+	.uleb128 0x19
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x75
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x76
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x77
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8b
+	.uleb128 0xb
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x78
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x89
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x79
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x80
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x81
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x82
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x83
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x84
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x85
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x86
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x87
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x88
+	.uleb128 0x3a
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x89
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8a
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8b
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8c
+	.uleb128 0x15
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8f
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x90
+	.uleb128 0x39
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x89
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x91
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x92
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x93
+	.uleb128 0x3b
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x94
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x95
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x96
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x97
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1c
+	.uleb128 0xb
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x98
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x63
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x99
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8a
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x32
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8a
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x9d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9e
+	.uleb128 0x4108
+	.byte	0x1
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9f
+	.uleb128 0x4108
+	.byte	0x1
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa0
+	.uleb128 0x4108
+	.byte	0x1
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa1
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa2
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa3
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x8a
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa4
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x64
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xa6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x6c
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xa7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x6c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa8
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x49c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	.LFB408
+	.quad	.LFE408-.LFB408
+	.quad	.LFB2609
+	.quad	.LFE2609-.LFB2609
+	.quad	.LFB2627
+	.quad	.LFE2627-.LFB2627
+	.quad	.LFB2629
+	.quad	.LFE2629-.LFB2629
+	.quad	.LFB2631
+	.quad	.LFE2631-.LFB2631
+	.quad	.LFB2920
+	.quad	.LFE2920-.LFB2920
+	.quad	.LFB2923
+	.quad	.LFE2923-.LFB2923
+	.quad	.LFB2926
+	.quad	.LFE2926-.LFB2926
+	.quad	.LFB2929
+	.quad	.LFE2929-.LFB2929
+	.quad	.LFB2931
+	.quad	.LFE2931-.LFB2931
+	.quad	.LFB2932
+	.quad	.LFE2932-.LFB2932
+	.quad	.LFB2933
+	.quad	.LFE2933-.LFB2933
+	.quad	.LFB2934
+	.quad	.LFE2934-.LFB2934
+	.quad	.LFB2936
+	.quad	.LFE2936-.LFB2936
+	.quad	.LFB2937
+	.quad	.LFE2937-.LFB2937
+	.quad	.LFB2938
+	.quad	.LFE2938-.LFB2938
+	.quad	.LFB2939
+	.quad	.LFE2939-.LFB2939
+	.quad	.LFB2941
+	.quad	.LFE2941-.LFB2941
+	.quad	.LFB2942
+	.quad	.LFE2942-.LFB2942
+	.quad	.LFB3065
+	.quad	.LFE3065-.LFB3065
+	.quad	.LFB3068
+	.quad	.LFE3068-.LFB3068
+	.quad	.LFB3071
+	.quad	.LFE3071-.LFB3071
+	.quad	.LFB3073
+	.quad	.LFE3073-.LFB3073
+	.quad	.LFB3074
+	.quad	.LFE3074-.LFB3074
+	.quad	.LFB3075
+	.quad	.LFE3075-.LFB3075
+	.quad	.LFB3076
+	.quad	.LFE3076-.LFB3076
+	.quad	.LFB3079
+	.quad	.LFE3079-.LFB3079
+	.quad	.LFB3080
+	.quad	.LFE3080-.LFB3080
+	.quad	.LFB3081
+	.quad	.LFE3081-.LFB3081
+	.quad	.LFB3086
+	.quad	.LFE3086-.LFB3086
+	.quad	.LFB3090
+	.quad	.LFE3090-.LFB3090
+	.quad	.LFB3166
+	.quad	.LFE3166-.LFB3166
+	.quad	.LFB3168
+	.quad	.LFE3168-.LFB3168
+	.quad	.LFB3169
+	.quad	.LFE3169-.LFB3169
+	.quad	.LFB3170
+	.quad	.LFE3170-.LFB3170
+	.quad	.LFB3171
+	.quad	.LFE3171-.LFB3171
+	.quad	.LFB3172
+	.quad	.LFE3172-.LFB3172
+	.quad	.LFB3173
+	.quad	.LFE3173-.LFB3173
+	.quad	.LFB3174
+	.quad	.LFE3174-.LFB3174
+	.quad	.LFB3176
+	.quad	.LFE3176-.LFB3176
+	.quad	.LFB3178
+	.quad	.LFE3178-.LFB3178
+	.quad	.LFB3179
+	.quad	.LFE3179-.LFB3179
+	.quad	.LFB3180
+	.quad	.LFE3180-.LFB3180
+	.quad	.LFB3181
+	.quad	.LFE3181-.LFB3181
+	.quad	.LFB3182
+	.quad	.LFE3182-.LFB3182
+	.quad	.LFB3183
+	.quad	.LFE3183-.LFB3183
+	.quad	.LFB3189
+	.quad	.LFE3189-.LFB3189
+	.quad	.LFB3190
+	.quad	.LFE3190-.LFB3190
+	.quad	.LFB3192
+	.quad	.LFE3192-.LFB3192
+	.quad	.LFB3244
+	.quad	.LFE3244-.LFB3244
+	.quad	.LFB3245
+	.quad	.LFE3245-.LFB3245
+	.quad	.LFB3246
+	.quad	.LFE3246-.LFB3246
+	.quad	.LFB3247
+	.quad	.LFE3247-.LFB3247
+	.quad	.LFB3248
+	.quad	.LFE3248-.LFB3248
+	.quad	.LFB3249
+	.quad	.LFE3249-.LFB3249
+	.quad	.LFB3250
+	.quad	.LFE3250-.LFB3250
+	.quad	.LFB3252
+	.quad	.LFE3252-.LFB3252
+	.quad	.LFB3253
+	.quad	.LFE3253-.LFB3253
+	.quad	.LFB3254
+	.quad	.LFE3254-.LFB3254
+	.quad	.LFB3255
+	.quad	.LFE3255-.LFB3255
+	.quad	.LFB3276
+	.quad	.LFE3276-.LFB3276
+	.quad	.LFB3277
+	.quad	.LFE3277-.LFB3277
+	.quad	.LFB3278
+	.quad	.LFE3278-.LFB3278
+	.quad	.LFB3279
+	.quad	.LFE3279-.LFB3279
+	.quad	.LFB3280
+	.quad	.LFE3280-.LFB3280
+	.quad	.LFB3281
+	.quad	.LFE3281-.LFB3281
+	.quad	.LFB3283
+	.quad	.LFE3283-.LFB3283
+	.quad	.LFB3292
+	.quad	.LFE3292-.LFB3292
+	.quad	.LFB3293
+	.quad	.LFE3293-.LFB3293
+	.quad	.LFB3294
+	.quad	.LFE3294-.LFB3294
+	.quad	.LFB3298
+	.quad	.LFE3298-.LFB3298
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL0:
+	.byte	0x7
+	.quad	.Ltext0
+	.uleb128 .Letext0-.Ltext0
+	.byte	0x7
+	.quad	.LFB408
+	.uleb128 .LFE408-.LFB408
+	.byte	0x7
+	.quad	.LFB2609
+	.uleb128 .LFE2609-.LFB2609
+	.byte	0x7
+	.quad	.LFB2627
+	.uleb128 .LFE2627-.LFB2627
+	.byte	0x7
+	.quad	.LFB2629
+	.uleb128 .LFE2629-.LFB2629
+	.byte	0x7
+	.quad	.LFB2631
+	.uleb128 .LFE2631-.LFB2631
+	.byte	0x7
+	.quad	.LFB2920
+	.uleb128 .LFE2920-.LFB2920
+	.byte	0x7
+	.quad	.LFB2923
+	.uleb128 .LFE2923-.LFB2923
+	.byte	0x7
+	.quad	.LFB2926
+	.uleb128 .LFE2926-.LFB2926
+	.byte	0x7
+	.quad	.LFB2929
+	.uleb128 .LFE2929-.LFB2929
+	.byte	0x7
+	.quad	.LFB2931
+	.uleb128 .LFE2931-.LFB2931
+	.byte	0x7
+	.quad	.LFB2932
+	.uleb128 .LFE2932-.LFB2932
+	.byte	0x7
+	.quad	.LFB2933
+	.uleb128 .LFE2933-.LFB2933
+	.byte	0x7
+	.quad	.LFB2934
+	.uleb128 .LFE2934-.LFB2934
+	.byte	0x7
+	.quad	.LFB2936
+	.uleb128 .LFE2936-.LFB2936
+	.byte	0x7
+	.quad	.LFB2937
+	.uleb128 .LFE2937-.LFB2937
+	.byte	0x7
+	.quad	.LFB2938
+	.uleb128 .LFE2938-.LFB2938
+	.byte	0x7
+	.quad	.LFB2939
+	.uleb128 .LFE2939-.LFB2939
+	.byte	0x7
+	.quad	.LFB2941
+	.uleb128 .LFE2941-.LFB2941
+	.byte	0x7
+	.quad	.LFB2942
+	.uleb128 .LFE2942-.LFB2942
+	.byte	0x7
+	.quad	.LFB3065
+	.uleb128 .LFE3065-.LFB3065
+	.byte	0x7
+	.quad	.LFB3068
+	.uleb128 .LFE3068-.LFB3068
+	.byte	0x7
+	.quad	.LFB3071
+	.uleb128 .LFE3071-.LFB3071
+	.byte	0x7
+	.quad	.LFB3073
+	.uleb128 .LFE3073-.LFB3073
+	.byte	0x7
+	.quad	.LFB3074
+	.uleb128 .LFE3074-.LFB3074
+	.byte	0x7
+	.quad	.LFB3075
+	.uleb128 .LFE3075-.LFB3075
+	.byte	0x7
+	.quad	.LFB3076
+	.uleb128 .LFE3076-.LFB3076
+	.byte	0x7
+	.quad	.LFB3079
+	.uleb128 .LFE3079-.LFB3079
+	.byte	0x7
+	.quad	.LFB3080
+	.uleb128 .LFE3080-.LFB3080
+	.byte	0x7
+	.quad	.LFB3081
+	.uleb128 .LFE3081-.LFB3081
+	.byte	0x7
+	.quad	.LFB3086
+	.uleb128 .LFE3086-.LFB3086
+	.byte	0x7
+	.quad	.LFB3090
+	.uleb128 .LFE3090-.LFB3090
+	.byte	0x7
+	.quad	.LFB3166
+	.uleb128 .LFE3166-.LFB3166
+	.byte	0x7
+	.quad	.LFB3168
+	.uleb128 .LFE3168-.LFB3168
+	.byte	0x7
+	.quad	.LFB3169
+	.uleb128 .LFE3169-.LFB3169
+	.byte	0x7
+	.quad	.LFB3170
+	.uleb128 .LFE3170-.LFB3170
+	.byte	0x7
+	.quad	.LFB3171
+	.uleb128 .LFE3171-.LFB3171
+	.byte	0x7
+	.quad	.LFB3172
+	.uleb128 .LFE3172-.LFB3172
+	.byte	0x7
+	.quad	.LFB3173
+	.uleb128 .LFE3173-.LFB3173
+	.byte	0x7
+	.quad	.LFB3174
+	.uleb128 .LFE3174-.LFB3174
+	.byte	0x7
+	.quad	.LFB3176
+	.uleb128 .LFE3176-.LFB3176
+	.byte	0x7
+	.quad	.LFB3178
+	.uleb128 .LFE3178-.LFB3178
+	.byte	0x7
+	.quad	.LFB3179
+	.uleb128 .LFE3179-.LFB3179
+	.byte	0x7
+	.quad	.LFB3180
+	.uleb128 .LFE3180-.LFB3180
+	.byte	0x7
+	.quad	.LFB3181
+	.uleb128 .LFE3181-.LFB3181
+	.byte	0x7
+	.quad	.LFB3182
+	.uleb128 .LFE3182-.LFB3182
+	.byte	0x7
+	.quad	.LFB3183
+	.uleb128 .LFE3183-.LFB3183
+	.byte	0x7
+	.quad	.LFB3189
+	.uleb128 .LFE3189-.LFB3189
+	.byte	0x7
+	.quad	.LFB3190
+	.uleb128 .LFE3190-.LFB3190
+	.byte	0x7
+	.quad	.LFB3192
+	.uleb128 .LFE3192-.LFB3192
+	.byte	0x7
+	.quad	.LFB3244
+	.uleb128 .LFE3244-.LFB3244
+	.byte	0x7
+	.quad	.LFB3245
+	.uleb128 .LFE3245-.LFB3245
+	.byte	0x7
+	.quad	.LFB3246
+	.uleb128 .LFE3246-.LFB3246
+	.byte	0x7
+	.quad	.LFB3247
+	.uleb128 .LFE3247-.LFB3247
+	.byte	0x7
+	.quad	.LFB3248
+	.uleb128 .LFE3248-.LFB3248
+	.byte	0x7
+	.quad	.LFB3249
+	.uleb128 .LFE3249-.LFB3249
+	.byte	0x7
+	.quad	.LFB3250
+	.uleb128 .LFE3250-.LFB3250
+	.byte	0x7
+	.quad	.LFB3252
+	.uleb128 .LFE3252-.LFB3252
+	.byte	0x7
+	.quad	.LFB3253
+	.uleb128 .LFE3253-.LFB3253
+	.byte	0x7
+	.quad	.LFB3254
+	.uleb128 .LFE3254-.LFB3254
+	.byte	0x7
+	.quad	.LFB3255
+	.uleb128 .LFE3255-.LFB3255
+	.byte	0x7
+	.quad	.LFB3276
+	.uleb128 .LFE3276-.LFB3276
+	.byte	0x7
+	.quad	.LFB3277
+	.uleb128 .LFE3277-.LFB3277
+	.byte	0x7
+	.quad	.LFB3278
+	.uleb128 .LFE3278-.LFB3278
+	.byte	0x7
+	.quad	.LFB3279
+	.uleb128 .LFE3279-.LFB3279
+	.byte	0x7
+	.quad	.LFB3280
+	.uleb128 .LFE3280-.LFB3280
+	.byte	0x7
+	.quad	.LFB3281
+	.uleb128 .LFE3281-.LFB3281
+	.byte	0x7
+	.quad	.LFB3283
+	.uleb128 .LFE3283-.LFB3283
+	.byte	0x7
+	.quad	.LFB3292
+	.uleb128 .LFE3292-.LFB3292
+	.byte	0x7
+	.quad	.LFB3293
+	.uleb128 .LFE3293-.LFB3293
+	.byte	0x7
+	.quad	.LFB3294
+	.uleb128 .LFE3294-.LFB3294
+	.byte	0x7
+	.quad	.LFB3298
+	.uleb128 .LFE3298-.LFB3298
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF440
+	.file 69 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 70 "/usr/include/c++/12/algorithm"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF447
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF448
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 71 "/usr/include/x86_64-linux-gnu/c++/12/bits/os_defines.h"
+	.byte	0x3
+	.uleb128 0x28f
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 72 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 73 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x49
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF599
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 76 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF674
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x4e
+	.file 79 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/c++/12/bits/cpu_defines.h"
+	.byte	0x3
+	.uleb128 0x292
+	.uleb128 0x50
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF704
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 81 "/usr/include/c++/12/pstl/pstl_config.h"
+	.byte	0x3
+	.uleb128 0x349
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1001
+	.file 82 "/usr/include/c++/12/bits/exception_defines.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x4
+	.file 83 "/usr/include/c++/12/bits/cpp_type_traits.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.file 84 "/usr/include/c++/12/ext/type_traits.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1009
+	.byte	0x4
+	.file 85 "/usr/include/c++/12/ext/numeric_traits.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x55
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 86 "/usr/include/c++/12/bits/stl_pair.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x56
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1021
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 87 "/usr/include/c++/12/bits/utility.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1048
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1049
+	.file 88 "/usr/include/c++/12/bits/concept_check.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 89 "/usr/include/c++/12/debug/assertions.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1063
+	.file 90 "/usr/include/c++/12/bits/ptr_traits.h"
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x5a
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1064
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1091
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1095
+	.file 91 "/usr/include/c++/12/bits/algorithmfwd.h"
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x5b
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1096
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1097
+	.byte	0x4
+	.byte	0x4
+	.file 92 "/usr/include/c++/12/bits/stl_heap.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x5c
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1098
+	.byte	0x4
+	.file 93 "/usr/include/c++/12/bits/stl_tempbuf.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x5d
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1099
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1100
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1101
+	.file 94 "/usr/include/c++/12/bits/exception.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x5e
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1102
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 95 "/usr/include/c++/12/bits/uniform_int_dist.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x5f
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1105
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1108
+	.file 96 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1167
+	.file 97 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x61
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 98 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x62
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 99 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x63
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 100 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x64
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1203
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF674
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 101 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0x111
+	.uleb128 0x65
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1231
+	.file 102 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x66
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1232
+	.byte	0x4
+	.byte	0x4
+	.file 103 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x67
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1233
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1234
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF599
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 104 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x68
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 105 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x69
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF1294
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.file 106 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x6a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1310
+	.byte	0x4
+	.file 107 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x6b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1311
+	.byte	0x4
+	.file 108 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x6c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1312
+	.byte	0x4
+	.file 109 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x6d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1313
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1316
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1317
+	.file 110 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x6e
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1318
+	.file 111 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6f
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.file 112 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x70
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 113 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x71
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 114 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x72
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1335
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 115 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x73
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1348
+	.file 116 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x74
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 117 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x75
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1353
+	.file 118 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x76
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x4
+	.file 119 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x77
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1356
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1357
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 120 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x78
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1373
+	.file 121 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x79
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1374
+	.file 122 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x7a
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1375
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 123 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x7b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1387
+	.byte	0x4
+	.file 124 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x7c
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 125 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x7d
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1394
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1395
+	.byte	0x4
+	.byte	0x4
+	.file 126 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x7e
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1399
+	.file 127 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x7f
+	.byte	0x4
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1400
+	.file 128 "/usr/include/c++/12/bits/std_abs.h"
+	.byte	0x3
+	.uleb128 0x4d
+	.uleb128 0x80
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 129 "/usr/include/c++/12/pstl/glue_algorithm_defs.h"
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x81
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1441
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1442
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 130 "/usr/include/c++/12/cassert"
+	.byte	0x3
+	.uleb128 0x2
+	.uleb128 0x82
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1451
+	.file 131 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x83
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 132 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x84
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1460
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1556
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.file 133 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x85
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1562
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.file 134 "/usr/include/c++/12/string"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x86
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1586
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1587
+	.file 135 "/usr/include/c++/12/bits/memoryfwd.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x87
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1588
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1589
+	.file 136 "/usr/include/c++/12/bits/postypes.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x88
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1590
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1592
+	.file 137 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x89
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1597
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1598
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1599
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1600
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1666
+	.file 138 "/usr/include/x86_64-linux-gnu/c++/12/bits/c++allocator.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x8a
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1667
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.file 139 "/usr/include/c++/12/bits/localefwd.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x8b
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1677
+	.file 140 "/usr/include/x86_64-linux-gnu/c++/12/bits/c++locale.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x8c
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1678
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x4
+	.file 141 "/usr/include/x86_64-linux-gnu/bits/locale.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x8d
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.file 142 "/usr/include/c++/12/iosfwd"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x8e
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1726
+	.byte	0x4
+	.file 143 "/usr/include/c++/12/cctype"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x8f
+	.file 144 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x90
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.byte	0x4
+	.byte	0x4
+	.file 145 "/usr/include/c++/12/bits/ostream_insert.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x91
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1750
+	.file 146 "/usr/include/c++/12/bits/cxxabi_forced.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x92
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1751
+	.byte	0x4
+	.byte	0x4
+	.file 147 "/usr/include/c++/12/bits/stl_function.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x93
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.file 148 "/usr/include/c++/12/backward/binders.h"
+	.byte	0x3
+	.uleb128 0x59e
+	.uleb128 0x94
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1754
+	.byte	0x4
+	.byte	0x4
+	.file 149 "/usr/include/c++/12/bits/refwrap.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x95
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1755
+	.file 150 "/usr/include/c++/12/bits/invoke.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x96
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1756
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro93
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro94
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1763
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1764
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro95
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1767
+	.file 151 "/usr/include/c++/12/bits/functional_hash.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x97
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1768
+	.file 152 "/usr/include/c++/12/bits/hash_bytes.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x98
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1769
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro96
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1772
+	.file 153 "/usr/include/c++/12/bits/string_view.tcc"
+	.byte	0x3
+	.uleb128 0x32b
+	.uleb128 0x99
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1773
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1774
+	.file 154 "/usr/include/c++/12/ext/string_conversions.h"
+	.byte	0x3
+	.uleb128 0xf78
+	.uleb128 0x9a
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1775
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x1d
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro97
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro98
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1592
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x89
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF1593
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1777
+	.byte	0x4
+	.file 155 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x9b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1778
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro99
+	.byte	0x4
+	.file 156 "/usr/include/x86_64-linux-gnu/bits/types/cookie_io_functions_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x9c
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1787
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro100
+	.file 157 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x9d
+	.byte	0x7
+	.long	.Ldebug_macro101
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro102
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro103
+	.byte	0x4
+	.file 158 "/usr/include/c++/12/cerrno"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x9e
+	.file 159 "/usr/include/errno.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x9f
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1863
+	.file 160 "/usr/include/x86_64-linux-gnu/bits/errno.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xa0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1864
+	.file 161 "/usr/include/linux/errno.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa1
+	.file 162 "/usr/include/x86_64-linux-gnu/asm/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0xa2
+	.file 163 "/usr/include/asm-generic/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0xa3
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1865
+	.file 164 "/usr/include/asm-generic/errno-base.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0xa4
+	.byte	0x7
+	.long	.Ldebug_macro104
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro105
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2000
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2001
+	.file 165 "/usr/include/x86_64-linux-gnu/bits/types/error_t.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0xa5
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2002
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2003
+	.byte	0x4
+	.byte	0x4
+	.file 166 "/usr/include/c++/12/bits/charconv.h"
+	.byte	0x3
+	.uleb128 0xf79
+	.uleb128 0xa6
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2004
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro106
+	.byte	0x4
+	.file 167 "/usr/include/c++/12/bits/basic_string.tcc"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0xa7
+	.byte	0x7
+	.long	.Ldebug_macro107
+	.byte	0x4
+	.byte	0x4
+	.file 168 "/usr/include/c++/12/vector"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0xa8
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2009
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro108
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro109
+	.byte	0x4
+	.file 169 "/usr/include/c++/12/bits/stl_bvector.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0xa9
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2020
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro110
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x8
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2026
+	.file 170 "/usr/include/x86_64-linux-gnu/bits/fcntl.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xaa
+	.byte	0x7
+	.long	.Ldebug_macro111
+	.file 171 "/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0xab
+	.file 172 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xac
+	.byte	0x7
+	.long	.Ldebug_macro112
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro113
+	.file 173 "/usr/include/linux/falloc.h"
+	.byte	0x3
+	.uleb128 0x162
+	.uleb128 0xad
+	.byte	0x7
+	.long	.Ldebug_macro114
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro115
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2174
+	.file 174 "/usr/include/x86_64-linux-gnu/bits/stat.h"
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0xae
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2175
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro116
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro117
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro118
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro119
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 175 "/usr/include/x86_64-linux-gnu/bits/mman.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xaf
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2234
+	.file 176 "/usr/include/x86_64-linux-gnu/bits/mman-map-flags-generic.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0xb0
+	.byte	0x7
+	.long	.Ldebug_macro120
+	.byte	0x4
+	.file 177 "/usr/include/x86_64-linux-gnu/bits/mman-linux.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0xb1
+	.byte	0x7
+	.long	.Ldebug_macro121
+	.file 178 "/usr/include/x86_64-linux-gnu/bits/mman-shared.h"
+	.byte	0x3
+	.uleb128 0x77
+	.uleb128 0xb2
+	.byte	0x7
+	.long	.Ldebug_macro122
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2305
+	.file 179 "/usr/include/x86_64-linux-gnu/bits/mman_ext.h"
+	.byte	0x3
+	.uleb128 0x96
+	.uleb128 0xb3
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2306
+	.byte	0x3
+	.uleb128 0x65
+	.uleb128 0xae
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro123
+	.file 180 "/usr/include/x86_64-linux-gnu/bits/statx.h"
+	.byte	0x3
+	.uleb128 0x1d1
+	.uleb128 0xb4
+	.file 181 "/usr/include/linux/stat.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0xb5
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2325
+	.file 182 "/usr/include/linux/types.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0xb6
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2326
+	.file 183 "/usr/include/x86_64-linux-gnu/asm/types.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0xb7
+	.file 184 "/usr/include/asm-generic/types.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0xb8
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2327
+	.file 185 "/usr/include/asm-generic/int-ll64.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0xb9
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF2328
+	.file 186 "/usr/include/x86_64-linux-gnu/asm/bitsperlong.h"
+	.byte	0x3
+	.uleb128 0xc
+	.uleb128 0xba
+	.byte	0x7
+	.long	.Ldebug_macro124
+	.file 187 "/usr/include/asm-generic/bitsperlong.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0xbb
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2331
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 188 "/usr/include/linux/posix_types.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xbc
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2332
+	.file 189 "/usr/include/linux/stddef.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0xbd
+	.byte	0x7
+	.long	.Ldebug_macro125
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro126
+	.file 190 "/usr/include/x86_64-linux-gnu/asm/posix_types.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xbe
+	.file 191 "/usr/include/x86_64-linux-gnu/asm/posix_types_64.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0xbf
+	.byte	0x7
+	.long	.Ldebug_macro127
+	.file 192 "/usr/include/asm-generic/posix_types.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xc0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2341
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro128
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro129
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro130
+	.file 193 "/usr/include/x86_64-linux-gnu/bits/statx-generic.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xc1
+	.file 194 "/usr/include/x86_64-linux-gnu/bits/types/struct_statx_timestamp.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xc2
+	.byte	0x4
+	.file 195 "/usr/include/x86_64-linux-gnu/bits/types/struct_statx.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xc3
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro131
+	.file 196 "/usr/include/x86_64-linux-gnu/bits/posix_opt.h"
+	.byte	0x3
+	.uleb128 0xca
+	.uleb128 0xc4
+	.byte	0x7
+	.long	.Ldebug_macro132
+	.byte	0x4
+	.file 197 "/usr/include/x86_64-linux-gnu/bits/environments.h"
+	.byte	0x3
+	.uleb128 0xce
+	.uleb128 0xc5
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro133
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro134
+	.byte	0x3
+	.uleb128 0xe2
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro135
+	.file 198 "/usr/include/x86_64-linux-gnu/bits/confname.h"
+	.byte	0x3
+	.uleb128 0x276
+	.uleb128 0xc6
+	.byte	0x7
+	.long	.Ldebug_macro136
+	.byte	0x4
+	.file 199 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h"
+	.byte	0x3
+	.uleb128 0x387
+	.uleb128 0xc7
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2780
+	.file 200 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc8
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2781
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2782
+	.file 201 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h"
+	.byte	0x3
+	.uleb128 0x4c2
+	.uleb128 0xc9
+	.file 202 "/usr/include/linux/close_range.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xca
+	.byte	0x7
+	.long	.Ldebug_macro137
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xd
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2786
+	.file 203 "/usr/include/c++/12/memory"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0xcb
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2787
+	.file 204 "/usr/include/c++/12/bits/stl_raw_storage_iter.h"
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0xcc
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2788
+	.byte	0x4
+	.file 205 "/usr/include/c++/12/bits/align.h"
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0xcd
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2789
+	.file 206 "/usr/include/c++/12/bit"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xce
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2790
+	.byte	0x4
+	.byte	0x4
+	.file 207 "/usr/include/c++/12/bits/uses_allocator.h"
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0xcf
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2791
+	.byte	0x4
+	.file 208 "/usr/include/c++/12/bits/unique_ptr.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0xd0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2792
+	.file 209 "/usr/include/c++/12/tuple"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xd1
+	.byte	0x7
+	.long	.Ldebug_macro138
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2796
+	.byte	0x4
+	.file 210 "/usr/include/c++/12/bits/shared_ptr.h"
+	.byte	0x3
+	.uleb128 0x4d
+	.uleb128 0xd2
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2797
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2798
+	.file 211 "/usr/include/c++/12/typeinfo"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0xd3
+	.byte	0x7
+	.long	.Ldebug_macro139
+	.byte	0x4
+	.file 212 "/usr/include/c++/12/bits/allocated_ptr.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0xd4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2802
+	.byte	0x4
+	.file 213 "/usr/include/c++/12/ext/aligned_buffer.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0xd5
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2803
+	.byte	0x4
+	.file 214 "/usr/include/c++/12/ext/atomicity.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0xd6
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2804
+	.file 215 "/usr/include/x86_64-linux-gnu/c++/12/bits/gthr.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xd7
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2805
+	.file 216 "/usr/include/x86_64-linux-gnu/c++/12/bits/gthr-default.h"
+	.byte	0x3
+	.uleb128 0x94
+	.uleb128 0xd8
+	.byte	0x7
+	.long	.Ldebug_macro140
+	.file 217 "/usr/include/pthread.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xd9
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2809
+	.file 218 "/usr/include/sched.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xda
+	.byte	0x7
+	.long	.Ldebug_macro141
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 219 "/usr/include/x86_64-linux-gnu/bits/sched.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xdb
+	.byte	0x7
+	.long	.Ldebug_macro142
+	.file 220 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0xdc
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2846
+	.byte	0x4
+	.byte	0x4
+	.file 221 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xdd
+	.byte	0x7
+	.long	.Ldebug_macro143
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro144
+	.byte	0x4
+	.file 222 "/usr/include/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xde
+	.byte	0x7
+	.long	.Ldebug_macro145
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 223 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xdf
+	.byte	0x7
+	.long	.Ldebug_macro146
+	.file 224 "/usr/include/x86_64-linux-gnu/bits/timex.h"
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0xe0
+	.byte	0x7
+	.long	.Ldebug_macro147
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2943
+	.byte	0x4
+	.file 225 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0xe1
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2944
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro148
+	.byte	0x4
+	.file 226 "/usr/include/x86_64-linux-gnu/bits/setjmp.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2947
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 227 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0xe3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2948
+	.byte	0x4
+	.file 228 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xe4
+	.byte	0x7
+	.long	.Ldebug_macro149
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro150
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro151
+	.byte	0x4
+	.byte	0x4
+	.file 229 "/usr/include/x86_64-linux-gnu/c++/12/bits/atomic_word.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xe5
+	.byte	0x7
+	.long	.Ldebug_macro152
+	.byte	0x4
+	.file 230 "/usr/include/x86_64-linux-gnu/sys/single_threaded.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xe6
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2992
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2993
+	.file 231 "/usr/include/c++/12/exception"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0xe7
+	.byte	0x7
+	.long	.Ldebug_macro153
+	.byte	0x3
+	.uleb128 0xa8
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2996
+	.file 232 "/usr/include/c++/12/bits/cxxabi_init_exception.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xe8
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2997
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro154
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro155
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro156
+	.byte	0x4
+	.file 233 "/usr/include/c++/12/bits/nested_exception.h"
+	.byte	0x3
+	.uleb128 0xa9
+	.uleb128 0xe9
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF3019
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2ce
+	.long	.LASF3020
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro157
+	.byte	0x4
+	.file 234 "/usr/include/c++/12/bits/shared_ptr_atomic.h"
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0xea
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF3023
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF3024
+	.file 235 "/usr/include/c++/12/bits/atomic_lockfree_defines.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xeb
+	.byte	0x7
+	.long	.Ldebug_macro158
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro159
+	.byte	0x4
+	.byte	0x4
+	.file 236 "/usr/include/c++/12/backward/auto_ptr.h"
+	.byte	0x3
+	.uleb128 0x52
+	.uleb128 0xec
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF3039
+	.byte	0x4
+	.file 237 "/usr/include/c++/12/pstl/glue_memory_defs.h"
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0xed
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF3040
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1444
+	.byte	0x4
+	.file 238 "/usr/include/c++/12/utility"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0xee
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF3041
+	.file 239 "/usr/include/c++/12/bits/stl_relops.h"
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0xef
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF3042
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro160
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF3045
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF3046
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro161
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF3049
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cconfig.h.31.df082077f834a39f35188f826939cbaf,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1b8
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x1c1
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF500
+	.byte	0x6
+	.uleb128 0x1c8
+	.long	.LASF501
+	.byte	0x6
+	.uleb128 0x1cd
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x274
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF517
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.os_defines.h.31.00ac2dfcc18ce0a4ccd7d724c7e326ea,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF519
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.8bb74df3432ebf32d12aa273dc4e2b55,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF522
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF523
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF525
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF527
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF528
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF529
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF530
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF531
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF532
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF533
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF534
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF535
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF536
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF537
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF538
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF539
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF540
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF541
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF542
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF543
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF544
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF546
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF569
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF571
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF573
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF575
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF578
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF579
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF586
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF579
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF595
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF598
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF611
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.3f6fbb2e3c0c264dcfdfde864c5fdd1b,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF612
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF659
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF671
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF673
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.b7837895c567d58e9cee3302a50c1713,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF699
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.os_defines.h.45.f148d4a84cf4a3ecbc01407f292c5e79,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF703
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cconfig.h.663.a93c6e25512001f7d5462d991a9bab78,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x2b9
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x2cd
+	.long	.LASF712
+	.byte	0x2
+	.uleb128 0x2d0
+	.string	"min"
+	.byte	0x2
+	.uleb128 0x2d1
+	.string	"max"
+	.byte	0x5
+	.uleb128 0x2d7
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x2dd
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x2e0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x315
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x31d
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x326
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF725
+	.byte	0x6
+	.uleb128 0x331
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x341
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF730
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pstl_config.h.11.160effd7011329c1d43041d1565e18a1,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF771
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cconfig.h.850.7229f6afd40226d28eea9e8579fdf96f,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x352
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x355
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x35b
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x35e
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x364
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x367
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x36d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x370
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x376
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x379
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x37f
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x382
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x388
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x38b
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x391
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x39b
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x3a4
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x3ad
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x3b6
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x3bf
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x3c8
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x3d1
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x3e3
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x3ec
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x3f5
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x410
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x419
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x42b
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x434
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x43d
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x45b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x45e
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x467
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x46a
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x476
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x479
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x498
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x49b
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x4ad
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x4b3
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x4b6
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x4b9
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x4cb
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x4dd
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x4ed
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x4fc
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x50b
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x50e
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x511
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x514
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x517
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x520
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x523
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x526
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x529
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x52c
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x52f
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x532
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x535
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x538
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x53b
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x541
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x544
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x54a
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x54d
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x550
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x553
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x556
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x559
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x55c
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x562
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x62b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x62e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x632
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x638
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x63b
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x63e
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x641
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x644
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x647
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x659
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x660
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x669
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x66d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x671
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x675
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x679
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x67e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x682
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x686
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x68a
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x68e
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x691
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x698
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x69b
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x69e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x6a6
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x6b2
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x6b8
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x6bb
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x6be
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x6c1
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x6c7
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x6d1
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x6d5
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x6da
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x6de
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x6e2
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x6e6
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x6ea
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x6ee
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x6f2
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x6f9
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x6fc
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x700
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x704
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x707
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x70a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x70d
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x710
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x713
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x716
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x719
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x71c
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x71f
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x725
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x728
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x72c
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x72f
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x733
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x736
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x739
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x73c
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x742
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x748
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x74e
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x752
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x756
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x759
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x75d
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x760
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x763
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x766
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x769
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x76c
+	.long	.LASF1000
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.exception_defines.h.31.ca6841b9be3287386aafc5c717935b2e,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1005
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cpp_type_traits.h.33.b2288289d5c7729e9da760b2466185ce,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0x11c
+	.long	.LASF1008
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.numeric_traits.h.30.957646dabc9a8fb118982f20f532c073,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1016
+	.byte	0x6
+	.uleb128 0xb5
+	.long	.LASF1017
+	.byte	0x6
+	.uleb128 0xb6
+	.long	.LASF1018
+	.byte	0x6
+	.uleb128 0xb7
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0xb8
+	.long	.LASF1020
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.type_traits.30.75af74c7e9830e1b4beccd1a5f43dc02,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x63d
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x966
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xa4a
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xa72
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0xad3
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0xbca
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0xc20
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xce3
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0xcf7
+	.long	.LASF1036
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.move.h.31.5af84b00763b00bcae296ba743af608b,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1041
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.utility.h.34.dd9cf844d8a4a9176a3f477269f82bef,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1044
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stl_pair.h.452.a6f34712c2fc60d9a2cdfa651049c735,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x20d
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1047
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.concept_check.h.31.f19605d278e56917c68a56d378be308c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1055
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.assertions.h.30.4b26900d71edbfc7f7e26fdb00cf8caf,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1062
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stl_iterator.h.77.2bf5837b394bf8fec5da6eede2a468c2,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xa0d
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xa0e
+	.long	.LASF1068
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.debug.h.30.14675c66734128005fe180e1012feff9,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1090
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stl_algobase.h.656.e99e6c2c242c7feaa3d42a9ce1f8245f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x670
+	.long	.LASF1094
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.new.189.2cd7ee79d5ffcb5e2c57e673dc7076ea,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1104
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cstdlib.44.52c5efdfb0f3c176bd11e611a0b94959,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1107
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1109
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1111
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1115
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1117
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1121
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1123
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1126
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.a9c6b5033e0435729857614eafcaa7c4,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1144
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1161
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1166
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1176
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1188
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1195
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.8017ac324f1165161bc8e1ff29a2719b,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1202
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.636061892ab0c3d217b3470ad02277d6,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1224
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1230
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1249
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1291
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1293
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.40.18f72bab8242c2bb4c532a2aa95b5f00,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1309
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.135.9eeb6b52c2522ad7aff16ad95342972e,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1124
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1166
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1322
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1324
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1326
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1330
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1334
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1347
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1352
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1355
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.52.4f882364bb7424384ae71496b52638dc,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1368
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1372
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1386
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1390
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1124
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1398
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.std_abs.h.31.4587ba001d85390d152353c24c92c0c8,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1107
+	.byte	0x6
+	.uleb128 0x2a
+	.long	.LASF1400
+	.byte	0x2
+	.uleb128 0x2c
+	.string	"abs"
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cstdlib.80.27624e0a6399c87156de13aacc7f184d,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1402
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1403
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1407
+	.byte	0x6
+	.uleb128 0x5c
+	.long	.LASF1408
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1409
+	.byte	0x6
+	.uleb128 0x5e
+	.long	.LASF1410
+	.byte	0x2
+	.uleb128 0x5f
+	.string	"div"
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF1411
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1412
+	.byte	0x6
+	.uleb128 0x62
+	.long	.LASF1413
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1414
+	.byte	0x6
+	.uleb128 0x64
+	.long	.LASF1415
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1416
+	.byte	0x6
+	.uleb128 0x66
+	.long	.LASF1417
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1418
+	.byte	0x6
+	.uleb128 0x68
+	.long	.LASF1419
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1420
+	.byte	0x6
+	.uleb128 0x6c
+	.long	.LASF1421
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1422
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1423
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1424
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1425
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1426
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1427
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1428
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1429
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1430
+	.byte	0x6
+	.uleb128 0xba
+	.long	.LASF1431
+	.byte	0x6
+	.uleb128 0xbb
+	.long	.LASF1432
+	.byte	0x6
+	.uleb128 0xbc
+	.long	.LASF1433
+	.byte	0x6
+	.uleb128 0xbd
+	.long	.LASF1434
+	.byte	0x6
+	.uleb128 0xbe
+	.long	.LASF1435
+	.byte	0x6
+	.uleb128 0xbf
+	.long	.LASF1436
+	.byte	0x6
+	.uleb128 0xc0
+	.long	.LASF1437
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF1438
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stl_algo.h.3606.47e82be5ff2ba38e0f24334558556f04,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xe16
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x16e5
+	.long	.LASF1440
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.algorithm.74.ae62b22c0b7153ce15e165b57163fb60,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1444
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.assert.h.34.2fd4f1d41272e4c81a0a39bacc11f5d9,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1450
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.4.659be5aa44c4ab4eb7c7cc2b24d8ceee,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x4
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1453
+	.byte	0x6
+	.uleb128 0x6
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1455
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1108
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1459
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1555
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1108
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1126
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.d09d9f11d864d06cb637bfdc57d51c58,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1166
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.38.5e57f557920b43aac91880039d9f0c7a,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1560
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1124
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cstring.45.6ab09de7fb97b576e744347688ddc8d7,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1563
+	.byte	0x6
+	.uleb128 0x30
+	.long	.LASF1564
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1565
+	.byte	0x6
+	.uleb128 0x32
+	.long	.LASF1566
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1567
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1568
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x36
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x38
+	.long	.LASF1572
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1573
+	.byte	0x6
+	.uleb128 0x3a
+	.long	.LASF1574
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1575
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1576
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1577
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1578
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1579
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1580
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1581
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1582
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1583
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1584
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1585
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.24.10c1a3649a347ee5acc556316eedb15a,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1108
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.32.859ec9de6e76762773b13581955bbb2b,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1126
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.7fd16e771e5a0d39b1003075da64d7ac,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1166
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1594
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wint_t.h.2.b153cb48df5337e6e56fe1404a1b29c5,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1596
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.54.46f5a6b49c3c455da808167e015392d9,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1603
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cwchar.48.a808e6bf69aa5ec51aed28c280b25195,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1604
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1605
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1606
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1607
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1608
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1609
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1610
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1611
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1612
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1613
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1614
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1615
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1616
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1617
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1618
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1619
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1620
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1621
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1622
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1623
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1624
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1625
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1626
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1627
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1628
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1629
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1630
+	.byte	0x6
+	.uleb128 0x64
+	.long	.LASF1631
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1632
+	.byte	0x6
+	.uleb128 0x66
+	.long	.LASF1633
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1634
+	.byte	0x6
+	.uleb128 0x68
+	.long	.LASF1635
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1636
+	.byte	0x6
+	.uleb128 0x6a
+	.long	.LASF1637
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1638
+	.byte	0x6
+	.uleb128 0x6c
+	.long	.LASF1639
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1640
+	.byte	0x6
+	.uleb128 0x6e
+	.long	.LASF1641
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1642
+	.byte	0x6
+	.uleb128 0x70
+	.long	.LASF1643
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1644
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1645
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1646
+	.byte	0x6
+	.uleb128 0x74
+	.long	.LASF1647
+	.byte	0x6
+	.uleb128 0x76
+	.long	.LASF1648
+	.byte	0x6
+	.uleb128 0x78
+	.long	.LASF1649
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1650
+	.byte	0x6
+	.uleb128 0x7a
+	.long	.LASF1651
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1652
+	.byte	0x6
+	.uleb128 0x7c
+	.long	.LASF1653
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1654
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF1655
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1656
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1657
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1658
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF1659
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1660
+	.byte	0x6
+	.uleb128 0xf0
+	.long	.LASF1661
+	.byte	0x6
+	.uleb128 0xf1
+	.long	.LASF1662
+	.byte	0x6
+	.uleb128 0xf2
+	.long	.LASF1663
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.char_traits.h.50.184e9d954e14da8517cdf441e7498c31,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1665
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.new_allocator.h.31.a11ca39dca7f3a187f4fe84911a0c01e,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1671
+	.byte	0x6
+	.uleb128 0xa1
+	.long	.LASF1672
+	.byte	0x6
+	.uleb128 0xa2
+	.long	.LASF1673
+	.byte	0x6
+	.uleb128 0xa3
+	.long	.LASF1674
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.allocator.h.52.d59538e198940f2c9c98ac32d87130d0,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1675
+	.byte	0x6
+	.uleb128 0x10b
+	.long	.LASF1676
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.locale.h.23.9b5006b0bf779abe978bf85cb308a947,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1126
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.399.7a3102024c6edbb40a4d2d700b0cfd8b,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1166
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.locale.h.24.c0c42b9681163ce124f9e0123f9f1018,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1693
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.locale.h.35.3ee615a657649f1422c6ddf5c47af7af,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1720
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.clocale.45.c36d2d5b631a875aa5273176b54fdf0f,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1721
+	.byte	0x6
+	.uleb128 0x30
+	.long	.LASF1722
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1723
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.clocale.h.43.6fb8f0ab2ff3c0d6599e5be7ec2cdfb5,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1725
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.ctype.h.23.61a99fb2d9a53286fbe40801035355a7,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1734
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cctype.45.0da5714876b0be7f2d816b53d9670403,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1735
+	.byte	0x6
+	.uleb128 0x30
+	.long	.LASF1736
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1737
+	.byte	0x6
+	.uleb128 0x32
+	.long	.LASF1738
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1739
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1740
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1741
+	.byte	0x6
+	.uleb128 0x36
+	.long	.LASF1742
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1743
+	.byte	0x6
+	.uleb128 0x38
+	.long	.LASF1744
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1745
+	.byte	0x6
+	.uleb128 0x3a
+	.long	.LASF1746
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1747
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1748
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1749
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stl_function.h.57.e56de502139ad017ca0a60ed04a45b1d,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1753
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.refwrap.h.83.ff9e1880dda1ffdebe61bc6f06312903,comdat
+.Ldebug_macro93:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1758
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1759
+	.byte	0x6
+	.uleb128 0x72
+	.long	.LASF1760
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.range_access.h.31.6250e60d28cd752dc5288e0a9eafbde0,comdat
+.Ldebug_macro94:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1762
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloc_traits.h.31.49d5a5cdb30935564af2ee0e81ac7289,comdat
+.Ldebug_macro95:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1766
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.functional_hash.h.115.65cf6efd7a84eda722b763626a008a7b,comdat
+.Ldebug_macro96:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1770
+	.byte	0x6
+	.uleb128 0xc7
+	.long	.LASF1771
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro97:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1108
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro98:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1126
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro99:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1786
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.53.cf5f00b4593d5e549db7a2d61cb78f91,comdat
+.Ldebug_macro100:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1799
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio_lim.h.19.86760ef34d2b7513aac6ce30cb73c6f8,comdat
+.Ldebug_macro101:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1805
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1807
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.138.ba977b5ae4e90303e95ec5db0bd05792,comdat
+.Ldebug_macro102:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1814
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1816
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cstdio.45.1ffaea3e7c26dce1e03f5847a7439edb,comdat
+.Ldebug_macro103:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1817
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1818
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1819
+	.byte	0x6
+	.uleb128 0x36
+	.long	.LASF1820
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1821
+	.byte	0x6
+	.uleb128 0x38
+	.long	.LASF1822
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1823
+	.byte	0x6
+	.uleb128 0x3a
+	.long	.LASF1824
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1825
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1826
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1827
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1828
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1829
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1830
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1831
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1832
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1833
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1834
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1835
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1836
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1837
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1838
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1839
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1840
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1841
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1842
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1843
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1844
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1845
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1846
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1847
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1848
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1849
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1850
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1851
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1852
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1853
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1854
+	.byte	0x6
+	.uleb128 0x5c
+	.long	.LASF1855
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1856
+	.byte	0x6
+	.uleb128 0x5e
+	.long	.LASF1857
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF1858
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF1859
+	.byte	0x6
+	.uleb128 0x99
+	.long	.LASF1860
+	.byte	0x6
+	.uleb128 0x9a
+	.long	.LASF1861
+	.byte	0x6
+	.uleb128 0x9b
+	.long	.LASF1862
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.errnobase.h.3.496c97749cc421db8c7f3a88bb19be3e,comdat
+.Ldebug_macro104:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1900
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.errno.h.7.abb72fb4c24e8d4d14afee66cc0be915,comdat
+.Ldebug_macro105:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1999
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.basic_string.h.4312.435c4ebd7c0e4911685d1ad64cb019c1,comdat
+.Ldebug_macro106:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x10d8
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x10e4
+	.long	.LASF2006
+	.byte	0x6
+	.uleb128 0x1102
+	.long	.LASF2007
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.basic_string.tcc.40.04c61d5139c0f95c983b2c44518d88b7,comdat
+.Ldebug_macro107:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF2006
+	.byte	0x6
+	.uleb128 0x3a7
+	.long	.LASF2007
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stl_uninitialized.h.57.d6534ca7342d60742d4dd46c1751601c,comdat
+.Ldebug_macro108:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2011
+	.byte	0x6
+	.uleb128 0x14a
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2013
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stl_vector.h.57.d2d0b8a1f885ab5ababffbbd81191f29,comdat
+.Ldebug_macro109:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF2019
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.vector.tcc.57.08a6a9ad9893483e5dbb662b6b977795,comdat
+.Ldebug_macro110:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2021
+	.byte	0x6
+	.uleb128 0x407
+	.long	.LASF2022
+	.byte	0x6
+	.uleb128 0x408
+	.long	.LASF2023
+	.byte	0x6
+	.uleb128 0x409
+	.long	.LASF2024
+	.byte	0x6
+	.uleb128 0x40a
+	.long	.LASF2025
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fcntl.h.24.62c7e777a8b210e920ccbb92cfe8b9d8,comdat
+.Ldebug_macro111:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2030
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_iovec.h.20.64e3c6cefa401374951f8ea68dba2a0a,comdat
+.Ldebug_macro112:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1124
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fcntllinux.h.42.66fc3dd2eb9e548124f834f46a09c6d1,comdat
+.Ldebug_macro113:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF2152
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.falloc.h.3.74001d56cdb3f986d217acbf397bd249,comdat
+.Ldebug_macro114:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2160
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fcntllinux.h.367.20dd1433251f22a4594b44d9ff5a02c1,comdat
+.Ldebug_macro115:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x17a
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF2173
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_stat.h.24.58804b9fde232cb81d58c44500307576,comdat
+.Ldebug_macro116:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2182
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stat.h.29.cab33b67e546bcdba0ebb7d142404f85,comdat
+.Ldebug_macro117:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2201
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fcntl.h.80.34001020898245d8535bf89fc94e0aa0,comdat
+.Ldebug_macro118:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF2232
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.mman.h.20.0a69816f5023e7a796431872d8a791ee,comdat
+.Ldebug_macro119:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1124
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.mmanmapflagsgeneric.h.29.e9996815dd608597ffd8554753980063,comdat
+.Ldebug_macro120:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2245
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.mmanlinux.h.32.e3e4130c583298f987457be528e6ddd8,comdat
+.Ldebug_macro121:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2295
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.mmanshared.h.25.3138308e830b109e361078932b8c0590,comdat
+.Ldebug_macro122:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2304
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stat.h.104.75fb58194ba4379fc75175a5977edd6b,comdat
+.Ldebug_macro123:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF2324
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.bitsperlong.h.3.81201f16c5ebf9ebeb0f369d7d7d8e27,comdat
+.Ldebug_macro124:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF2330
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.3.f8c72264735e7d683fe9ee39e5d40802,comdat
+.Ldebug_macro125:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2336
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.posix_types.h.22.ce27b629270cbb91230af7498cb5994b,comdat
+.Ldebug_macro126:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x16
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1291
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.posix_types_64.h.3.c35937438f2f85070758d4696b933189,comdat
+.Ldebug_macro127:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF2340
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.21.289d3f9188ccc1b4f5b3ba629527d096,comdat
+.Ldebug_macro128:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2347
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stat.h.142.90b051455f059d0cf10ec6c3e6ce5565,comdat
+.Ldebug_macro129:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF2373
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.statx.h.33.790099d4164393bf7e0ab7a0f95e4477,comdat
+.Ldebug_macro130:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2375
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unistd.h.23.e34f3a5c100123d9385c8b91a86a6783,comdat
+.Ldebug_macro131:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2388
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2389
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2392
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.posix_opt.h.20.21a42956ee7763f6aa309b86c7756272,comdat
+.Ldebug_macro132:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2393
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2397
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2398
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2400
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2404
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2406
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2408
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2409
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2412
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2419
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2421
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2422
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2427
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF2432
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2433
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF2435
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF2436
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2437
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF2438
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2440
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF2441
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2442
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF2443
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2444
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2445
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2446
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2447
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2448
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2449
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2450
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2451
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2452
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF2453
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2454
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.environments.h.56.c5802092ccc191baeb41f8d355bb878f,comdat
+.Ldebug_macro133:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2455
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2456
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2457
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2458
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2459
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2460
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2461
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2462
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2463
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2464
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2465
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2466
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unistd.h.210.b40c6c15db1d0b653f8dce03f258da9c,comdat
+.Ldebug_macro134:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF2467
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2468
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1126
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unistd.h.275.8c3a605c341d0c36506fbf05c049c0e7,comdat
+.Ldebug_macro135:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2470
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF2471
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF2472
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF2473
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.confname.h.27.257966e7e49af2ab4cb41132b3606cbf,comdat
+.Ldebug_macro136:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2474
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2475
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2476
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2477
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2478
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2479
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2480
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2481
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2482
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2483
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2484
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2485
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2486
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2487
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2488
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2489
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2490
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2491
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2492
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2493
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2494
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2495
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2496
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2497
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2498
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2499
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2500
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2501
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2502
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2503
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2504
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2505
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2506
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2507
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2508
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2509
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2510
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2511
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2512
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2513
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2514
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2515
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2516
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2517
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2518
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2519
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2520
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2521
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2522
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2523
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2524
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF2525
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2526
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2527
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2528
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF2529
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF2530
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF2531
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2532
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF2533
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF2534
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF2535
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2536
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2537
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF2538
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2539
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF2540
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2541
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2542
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2543
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF2544
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2545
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2546
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2547
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2548
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2549
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2550
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2551
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2552
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2553
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2554
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2555
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF2556
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF2557
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2558
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2559
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2560
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF2561
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2562
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2563
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF2564
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF2565
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF2566
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF2567
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF2568
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF2569
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2570
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF2571
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF2572
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF2573
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2574
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2575
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF2576
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF2577
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF2578
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF2579
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF2580
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF2581
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF2582
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2583
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF2584
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF2586
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF2587
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF2588
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF2589
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF2590
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF2591
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF2592
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF2593
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF2594
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2595
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF2596
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF2597
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF2598
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2599
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF2600
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF2601
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF2602
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF2603
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF2604
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF2605
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF2606
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2607
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2608
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF2609
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF2610
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF2611
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF2612
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF2613
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF2614
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF2615
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF2616
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF2617
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF2618
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF2620
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF2621
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF2622
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF2623
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF2624
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF2625
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF2626
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF2627
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF2628
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF2629
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF2630
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF2631
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF2632
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF2633
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF2634
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF2635
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF2636
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF2637
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF2638
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF2639
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF2640
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF2641
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF2642
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF2643
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF2644
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF2645
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF2646
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF2647
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF2648
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF2649
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF2650
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF2651
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF2652
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF2653
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF2654
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF2655
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF2656
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF2657
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF2658
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF2659
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF2660
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF2661
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF2662
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF2663
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF2664
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF2665
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF2666
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF2667
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF2668
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF2669
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF2670
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF2671
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF2672
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF2673
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF2674
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF2675
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF2676
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF2677
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF2678
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF2679
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF2680
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF2681
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF2682
+	.byte	0x5
+	.uleb128 0x1d4
+	.long	.LASF2683
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF2684
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF2685
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF2686
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF2687
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF2688
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF2689
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF2690
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF2691
+	.byte	0x5
+	.uleb128 0x1e6
+	.long	.LASF2692
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF2693
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF2694
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF2695
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF2696
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF2697
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF2698
+	.byte	0x5
+	.uleb128 0x1f7
+	.long	.LASF2699
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF2700
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF2701
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF2702
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF2703
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF2704
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF2705
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF2706
+	.byte	0x5
+	.uleb128 0x209
+	.long	.LASF2707
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF2708
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF2709
+	.byte	0x5
+	.uleb128 0x211
+	.long	.LASF2710
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF2711
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF2712
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF2713
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF2714
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF2715
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF2716
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF2717
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF2718
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF2719
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF2720
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF2721
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF2722
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF2723
+	.byte	0x5
+	.uleb128 0x236
+	.long	.LASF2724
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF2725
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF2726
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF2727
+	.byte	0x5
+	.uleb128 0x23e
+	.long	.LASF2728
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF2729
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF2730
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF2731
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF2732
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF2733
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF2734
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF2735
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF2736
+	.byte	0x5
+	.uleb128 0x251
+	.long	.LASF2737
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF2738
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF2739
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF2740
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF2741
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF2742
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF2743
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF2744
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF2745
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF2746
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF2747
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF2748
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF2749
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF2750
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF2751
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF2752
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF2753
+	.byte	0x5
+	.uleb128 0x274
+	.long	.LASF2754
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF2755
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF2756
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF2757
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF2758
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF2759
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF2760
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF2761
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF2762
+	.byte	0x5
+	.uleb128 0x287
+	.long	.LASF2763
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF2764
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF2765
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF2766
+	.byte	0x5
+	.uleb128 0x28f
+	.long	.LASF2767
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF2768
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF2769
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF2770
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF2771
+	.byte	0x5
+	.uleb128 0x299
+	.long	.LASF2772
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF2773
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF2774
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF2775
+	.byte	0x5
+	.uleb128 0x2a1
+	.long	.LASF2776
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF2777
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF2778
+	.byte	0x5
+	.uleb128 0x2a8
+	.long	.LASF2779
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.close_range.h.3.4d88cbc6c547d67820b4ac3b219a3d11,comdat
+.Ldebug_macro137:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2783
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF2784
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2785
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.tuple.30.78a89c298113b642f9395edc704df168,comdat
+.Ldebug_macro138:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2793
+	.byte	0x5
+	.uleb128 0x588
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x736
+	.long	.LASF2794
+	.byte	0x5
+	.uleb128 0x74c
+	.long	.LASF2795
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typeinfo.30.3bff5517cfefaa2a38f87e09fc8916b5,comdat
+.Ldebug_macro139:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2799
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2800
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2801
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gthrdefault.h.27.30a03623e42919627c5b0e155787471b,comdat
+.Ldebug_macro140:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2806
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2807
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2808
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sched.h.20.a907bc5f65174526cd045cceda75e484,comdat
+.Ldebug_macro141:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2810
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1126
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sched.h.21.3e2b36100b0cc47d3d3bf6c05b7fd6ae,comdat
+.Ldebug_macro142:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2811
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2812
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2813
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2814
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2815
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2816
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2817
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2818
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2819
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2820
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2821
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2822
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2823
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2824
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2825
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2826
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2827
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2828
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2829
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2830
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2831
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2832
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2833
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2834
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2835
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2836
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2837
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2838
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2839
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2840
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2841
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2842
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2843
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2844
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2845
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cpuset.h.21.819c5d0fbb06c94c4652b537360ff25a,comdat
+.Ldebug_macro143:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2847
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2848
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2849
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2850
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2851
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2852
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2853
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2854
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2855
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2856
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2857
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2858
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2859
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2860
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2861
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sched.h.47.e67ad745c847e33c4e7b201dc9f663a6,comdat
+.Ldebug_macro144:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2862
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2863
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2864
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2865
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2866
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2867
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2868
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2869
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2870
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2871
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2872
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2873
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2874
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2875
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2876
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2877
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2878
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2879
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2880
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2881
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2882
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2883
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2884
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2885
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro145:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2886
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1126
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro146:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2887
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2888
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2889
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2890
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2891
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2892
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2893
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2894
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2895
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2896
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2897
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2898
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2899
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2900
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.timex.h.19.68c3118fc57dd4af71155e57fb45153a,comdat
+.Ldebug_macro147:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2901
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2902
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2903
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2904
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2905
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2906
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2907
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2908
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2909
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2910
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2911
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2912
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2913
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2914
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2915
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2916
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2917
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2918
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2919
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2920
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2921
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2922
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2923
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2924
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2925
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2926
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2927
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2928
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2929
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2930
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2931
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2932
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2933
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2934
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2935
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2936
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2937
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2938
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2939
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF2940
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2941
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2942
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time.h.65.ad8b7cdf304665ee800a89090a0d61aa,comdat
+.Ldebug_macro148:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2945
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2946
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthread_stack_mindynamic.h.22.a920bc0766cffdef9d211057c8bee7ba,comdat
+.Ldebug_macro149:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2949
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2950
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthread.h.40.a013871e4141573b14ba97c7b4be2119,comdat
+.Ldebug_macro150:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2951
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2952
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2953
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2954
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2955
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2956
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2957
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2958
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2959
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2960
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2961
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2962
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2963
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2964
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2965
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2966
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2967
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2968
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2969
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2970
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2971
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2972
+	.byte	0x5
+	.uleb128 0x1a6
+	.long	.LASF2973
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2974
+	.byte	0x5
+	.uleb128 0x250
+	.long	.LASF2975
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF2976
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF2977
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF2978
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gthrdefault.h.57.b42db78f517a9cd46fa6476de49046f8,comdat
+.Ldebug_macro151:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2979
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2980
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2981
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2982
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2983
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2984
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2985
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2986
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2987
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2988
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.atomic_word.h.30.9e0ac69fd462d5e650933e05133b4afa,comdat
+.Ldebug_macro152:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2989
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2990
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2991
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.exception.31.e489f9ed97f0b1d388d9c6aef798656c,comdat
+.Ldebug_macro153:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2994
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2995
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.12d4affb468b8a2a1605fcc90737e990,comdat
+.Ldebug_macro154:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2998
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2999
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF3000
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF3001
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF3002
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF3003
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF3004
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF3005
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF3006
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF3007
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF3008
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF3009
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF3010
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF3011
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF3012
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF3013
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF3014
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cxxabi_init_exception.h.42.029852b0f286014c9c193b74ad22df55,comdat
+.Ldebug_macro155:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF3015
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF3016
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.exception_ptr.h.49.5cc14e4dc50a16008f68c9f68ad6d1bc,comdat
+.Ldebug_macro156:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF3017
+	.byte	0x6
+	.uleb128 0x117
+	.long	.LASF3018
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.shared_ptr.h.193.b0389ebcb3ff7229c0215553b67b0a87,comdat
+.Ldebug_macro157:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF3021
+	.byte	0x5
+	.uleb128 0x3ae
+	.long	.LASF3022
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.atomic_lockfree_defines.h.31.da6db0ab2dffa9ec5b0c3458204c2db5,comdat
+.Ldebug_macro158:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF3025
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF3026
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF3027
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF3028
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF3029
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF3030
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF3031
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF3032
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF3033
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF3034
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF3035
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.atomic_base.h.153.cb312b4b76492348235d307d2e65a7ab,comdat
+.Ldebug_macro159:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF3036
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF3037
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF3038
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.utility.87.1c5b6dc03640f755036703dd898ce0bd,comdat
+.Ldebug_macro160:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF3043
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF3044
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cstddef.40.7f59894b65c26f8fc669473914a0ef3e,comdat
+.Ldebug_macro161:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF3047
+	.byte	0x6
+	.uleb128 0x2c
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF3011
+	.byte	0x6
+	.uleb128 0x2e
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1166
+	.byte	0x6
+	.uleb128 0x30
+	.long	.LASF3048
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1991:
+	.string	"ECANCELED 125"
+.LASF3160:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5emptyEv"
+.LASF2670:
+	.string	"_SC_SYMLOOP_MAX _SC_SYMLOOP_MAX"
+.LASF999:
+	.string	"_GLIBCXX_X86_RDSEED 1"
+.LASF3876:
+	.string	"long long int"
+.LASF2500:
+	.string	"_SC_STREAM_MAX _SC_STREAM_MAX"
+.LASF2633:
+	.string	"_SC_C_LANG_SUPPORT_R _SC_C_LANG_SUPPORT_R"
+.LASF156:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF923:
+	.string	"_GLIBCXX_HAVE_WCHAR_H 1"
+.LASF2456:
+	.string	"_POSIX_V6_LPBIG_OFFBIG -1"
+.LASF1440:
+	.string	"__cpp_lib_sample 201603L"
+.LASF1232:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF711:
+	.string	"_GLIBCXX_FAST_MATH 0"
+.LASF3557:
+	.string	"_ZNSt12_Vector_baseImSaImEEC4ERKS0_OS1_"
+.LASF3006:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF3186:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4findES2_m"
+.LASF4048:
+	.string	"positive_sign"
+.LASF638:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF1545:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF2578:
+	.string	"_SC_THREAD_PRIO_PROTECT _SC_THREAD_PRIO_PROTECT"
+.LASF2051:
+	.string	"__O_PATH 010000000"
+.LASF2993:
+	.string	"_CONCURRENCE_H 1"
+.LASF1040:
+	.string	"_GLIBCXX_MOVE(__val) std::move(__val)"
+.LASF3419:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4swapERS4_"
+.LASF2368:
+	.string	"STATX_ATTR_NODUMP 0x00000040"
+.LASF943:
+	.string	"_GLIBCXX98_USE_C99_COMPLEX 1"
+.LASF118:
+	.string	"__cpp_inline_variables 201606L"
+.LASF1418:
+	.string	"mbstowcs"
+.LASF3413:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE14_M_replace_auxEmmmc"
+.LASF1942:
+	.string	"ENOTUNIQ 76"
+.LASF838:
+	.string	"_GLIBCXX_HAVE_LIMIT_VMEM 0"
+.LASF997:
+	.string	"_GLIBCXX_VERBOSE 1"
+.LASF1219:
+	.string	"__f32x(x) x"
+.LASF3476:
+	.string	"_ZNSt15__exception_ptr13exception_ptr9_M_addrefEv"
+.LASF387:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1113:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF869:
+	.string	"_GLIBCXX_HAVE_SINCOS 1"
+.LASF179:
+	.string	"__INT32_C(c) c"
+.LASF4079:
+	.string	"__pad0"
+.LASF1167:
+	.string	"_STDLIB_H 1"
+.LASF1560:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1727:
+	.string	"_CTYPE_H 1"
+.LASF1763:
+	.string	"_BASIC_STRING_H 1"
+.LASF4018:
+	.string	"__pad5"
+.LASF444:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF3148:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE6rbeginEv"
+.LASF4128:
+	.string	"get_num_of_chunks"
+.LASF1427:
+	.string	"strtoul"
+.LASF3704:
+	.string	"_ZNSt12_Vector_baseImSaImEE17_Vector_impl_data12_M_swap_dataERS2_"
+.LASF2842:
+	.string	"CLONE_NEWPID 0x20000000"
+.LASF1614:
+	.string	"getwchar"
+.LASF3871:
+	.string	"long unsigned int"
+.LASF517:
+	.string	"_GLIBCXX_USE_ALLOCATOR_NEW 1"
+.LASF1744:
+	.string	"isspace"
+.LASF181:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF3626:
+	.string	"_ZNKSt6vectorImSaImEE5frontEv"
+.LASF3932:
+	.string	"__pstl"
+.LASF1575:
+	.string	"strerror"
+.LASF321:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2081:
+	.string	"__F_SETOWN_EX 15"
+.LASF2208:
+	.string	"S_IFLNK __S_IFLNK"
+.LASF3285:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7_S_copyEPcPKcm"
+.LASF3715:
+	.string	"_InputIterator"
+.LASF1852:
+	.string	"tmpfile"
+.LASF2008:
+	.string	"_BASIC_STRING_TCC 1"
+.LASF4150:
+	.string	"__assert_fail"
+.LASF3945:
+	.string	"_ZN6__pstl9execution2v127parallel_unsequenced_policy19__allow_unsequencedEv"
+.LASF1860:
+	.string	"vscanf"
+.LASF2106:
+	.string	"LOCK_EX 2"
+.LASF1686:
+	.string	"__LC_MESSAGES 5"
+.LASF3461:
+	.string	"initializer_list"
+.LASF1797:
+	.string	"SEEK_DATA 3"
+.LASF802:
+	.string	"_GLIBCXX_HAVE_FABSF 1"
+.LASF1979:
+	.string	"EHOSTUNREACH 113"
+.LASF2090:
+	.string	"F_SETPIPE_SZ 1031"
+.LASF615:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF3758:
+	.string	"_Value"
+.LASF1679:
+	.string	"_LOCALE_H 1"
+.LASF3700:
+	.string	"_ZSt12__niter_baseIPmET_S1_"
+.LASF1293:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF3259:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_M_set_lengthEm"
+.LASF905:
+	.string	"_GLIBCXX_HAVE_SYS_UIO_H 1"
+.LASF3342:
+	.string	"shrink_to_fit"
+.LASF2530:
+	.string	"_SC_SIGQUEUE_MAX _SC_SIGQUEUE_MAX"
+.LASF3464:
+	.string	"_ZNKSt16initializer_listIcE4sizeEv"
+.LASF2666:
+	.string	"_SC_2_PBS_ACCOUNTING _SC_2_PBS_ACCOUNTING"
+.LASF4107:
+	.string	"keep"
+.LASF2432:
+	.string	"_POSIX_REGEXP 1"
+.LASF724:
+	.string	"_GLIBCXX_HAVE_BUILTIN_IS_SAME 1"
+.LASF333:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF4203:
+	.string	"__al"
+.LASF3439:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12find_last_ofEPKcmm"
+.LASF1832:
+	.string	"fscanf"
+.LASF1009:
+	.string	"_EXT_TYPE_TRAITS 1"
+.LASF191:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF3338:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8max_sizeEv"
+.LASF1448:
+	.string	"assert(expr) (static_cast <bool> (expr) ? void (0) : __assert_fail (#expr, __FILE__, __LINE__, __ASSERT_FUNCTION))"
+.LASF2428:
+	.string	"_LFS64_STDIO 1"
+.LASF3346:
+	.string	"reserve"
+.LASF1112:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF4202:
+	.string	"index"
+.LASF2345:
+	.string	"__aligned_s64 __s64 __attribute__((aligned(8)))"
+.LASF2795:
+	.string	"__cpp_lib_make_from_tuple 201606L"
+.LASF1320:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF3099:
+	.string	"_ZNSt11char_traitsIcE7not_eofERKi"
+.LASF1953:
+	.string	"EUSERS 87"
+.LASF3611:
+	.string	"_ZNKSt6vectorImSaImEE4sizeEv"
+.LASF3218:
+	.string	"_M_str"
+.LASF2714:
+	.string	"_CS_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS"
+.LASF3334:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7crbeginEv"
+.LASF2651:
+	.string	"_SC_SPIN_LOCKS _SC_SPIN_LOCKS"
+.LASF3444:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17find_first_not_ofEPKcm"
+.LASF2197:
+	.string	"__S_IREAD 0400"
+.LASF1672:
+	.string	"_GLIBCXX_SIZED_DEALLOC"
+.LASF3265:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_M_disposeEv"
+.LASF3433:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5rfindEcm"
+.LASF88:
+	.string	"__cpp_lambdas 200907L"
+.LASF2976:
+	.string	"pthread_cleanup_pop(execute) __clframe.__setdoit (execute); } while (0)"
+.LASF812:
+	.string	"_GLIBCXX_HAVE_FLOORL 1"
+.LASF2778:
+	.string	"_CS_V6_ENV _CS_V6_ENV"
+.LASF39:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1752:
+	.string	"_STL_FUNCTION_H 1"
+.LASF663:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF479:
+	.string	"_GLIBCXX_USE_NOEXCEPT noexcept"
+.LASF1181:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF1592:
+	.string	"__need___va_list "
+.LASF3642:
+	.string	"_M_fill_initialize"
+.LASF1787:
+	.string	"__cookie_io_functions_t_defined 1"
+.LASF2688:
+	.string	"_SC_LEVEL2_CACHE_SIZE _SC_LEVEL2_CACHE_SIZE"
+.LASF2790:
+	.string	"_GLIBCXX_BIT 1"
+.LASF3641:
+	.string	"_ZNSt6vectorImSaImEE5clearEv"
+.LASF2741:
+	.string	"_CS_XBS5_LP64_OFF64_LINTFLAGS _CS_XBS5_LP64_OFF64_LINTFLAGS"
+.LASF4042:
+	.string	"grouping"
+.LASF3151:
+	.string	"crbegin"
+.LASF2415:
+	.string	"_POSIX_THREAD_PRIO_INHERIT 200809L"
+.LASF129:
+	.string	"__STDCPP_DEFAULT_NEW_ALIGNMENT__ 16"
+.LASF2280:
+	.string	"MADV_WIPEONFORK 18"
+.LASF1568:
+	.string	"memset"
+.LASF3497:
+	.string	"memory_order_relaxed"
+.LASF1556:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF3975:
+	.string	"uintptr_t"
+.LASF3779:
+	.string	"__normal_iterator"
+.LASF363:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF3712:
+	.string	"_Iter"
+.LASF3252:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7_M_dataEv"
+.LASF3303:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4Ev"
+.LASF2439:
+	.string	"_POSIX_BARRIERS 200809L"
+.LASF132:
+	.string	"__STDCPP_THREADS__ 1"
+.LASF3948:
+	.string	"unsequenced_policy"
+.LASF3161:
+	.string	"operator[]"
+.LASF3670:
+	.string	"_ZNSt6vectorImSaImEE14_M_move_assignEOS1_St17integral_constantIbLb0EE"
+.LASF938:
+	.string	"_GLIBCXX11_USE_C99_COMPLEX 1"
+.LASF3420:
+	.string	"c_str"
+.LASF3572:
+	.string	"_ZNSt6vectorImSaImEE19_S_nothrow_relocateESt17integral_constantIbLb1EE"
+.LASF577:
+	.string	"__USE_ISOC11 1"
+.LASF3075:
+	.string	"equal<char>"
+.LASF4040:
+	.string	"decimal_point"
+.LASF3029:
+	.string	"ATOMIC_CHAR16_T_LOCK_FREE __GCC_ATOMIC_CHAR16_T_LOCK_FREE"
+.LASF2218:
+	.string	"S_IWGRP (S_IWUSR >> 3)"
+.LASF1380:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF3657:
+	.string	"_ZNSt6vectorImSaImEE14_M_emplace_auxEN9__gnu_cxx17__normal_iteratorIPKmS1_EEOm"
+.LASF640:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __THROWNL __asm__ (__ASMNAME (#alias))"
+.LASF3860:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEmIEl"
+.LASF301:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2876:
+	.string	"CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) __CPU_EQUAL_S (setsize, cpusetp1, cpusetp2)"
+.LASF991:
+	.string	"_GLIBCXX_USE_TMPNAM 1"
+.LASF3287:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7_S_moveEPcPKcm"
+.LASF898:
+	.string	"_GLIBCXX_HAVE_SYS_SEM_H 1"
+.LASF626:
+	.string	"__STRING(x) #x"
+.LASF3210:
+	.string	"find_last_not_of"
+.LASF1222:
+	.string	"__CFLOAT64 _Complex double"
+.LASF2414:
+	.string	"_POSIX_THREAD_ATTR_STACKADDR 200809L"
+.LASF3164:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE2atEm"
+.LASF4103:
+	.string	"network_builder_type"
+.LASF631:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF2523:
+	.string	"_SC_MQ_PRIO_MAX _SC_MQ_PRIO_MAX"
+.LASF133:
+	.string	"__EXCEPTIONS 1"
+.LASF4153:
+	.string	"__first"
+.LASF2542:
+	.string	"_SC_2_VERSION _SC_2_VERSION"
+.LASF2668:
+	.string	"_SC_2_PBS_MESSAGE _SC_2_PBS_MESSAGE"
+.LASF529:
+	.string	"__USE_XOPEN"
+.LASF2292:
+	.string	"POSIX_MADV_DONTNEED 4"
+.LASF1083:
+	.string	"__glibcxx_requires_heap(_First,_Last) "
+.LASF2017:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_GREW(n) "
+.LASF3314:
+	.string	"~basic_string"
+.LASF2032:
+	.string	"O_ACCMODE 0003"
+.LASF4140:
+	.string	"_ZN9simulator21get_result_chunk_sizeEj"
+.LASF3434:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13find_first_ofERKS4_m"
+.LASF2659:
+	.string	"_SC_SYSTEM_DATABASE _SC_SYSTEM_DATABASE"
+.LASF3295:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_S_copy_charsEPcPKcS7_"
+.LASF584:
+	.string	"__USE_POSIX199506 1"
+.LASF2928:
+	.string	"STA_PPSTIME 0x0004"
+.LASF4129:
+	.string	"_ZNK9simulator13result_reader17get_num_of_chunksEv"
+.LASF1217:
+	.string	"__f32(x) x ##f"
+.LASF2845:
+	.string	"CLONE_NEWTIME 0x00000080"
+.LASF1533:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF250:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1854:
+	.string	"ungetc"
+.LASF3819:
+	.string	"memory_order"
+.LASF3832:
+	.string	"rebind<long unsigned int>"
+.LASF3807:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEdeEv"
+.LASF2190:
+	.string	"__S_IFSOCK 0140000"
+.LASF1901:
+	.string	"EDEADLK 35"
+.LASF1321:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1923:
+	.string	"EBADSLT 57"
+.LASF895:
+	.string	"_GLIBCXX_HAVE_SYS_PARAM_H 1"
+.LASF2127:
+	.string	"RWH_WRITE_LIFE_NONE 1"
+.LASF2396:
+	.string	"_POSIX_PRIORITY_SCHEDULING 200809L"
+.LASF909:
+	.string	"_GLIBCXX_HAVE_TANHL 1"
+.LASF2219:
+	.string	"S_IXGRP (S_IXUSR >> 3)"
+.LASF2742:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_CFLAGS _CS_XBS5_LPBIG_OFFBIG_CFLAGS"
+.LASF1933:
+	.string	"ENOLINK 67"
+.LASF1856:
+	.string	"vprintf"
+.LASF4133:
+	.string	"_ZNK9simulator13result_reader10find_chunkEjRNS_12result_chunkE"
+.LASF858:
+	.string	"_GLIBCXX_HAVE_OPENAT 1"
+.LASF461:
+	.string	"_GLIBCXX11_DEPRECATED_SUGGEST(ALT) _GLIBCXX_DEPRECATED_SUGGEST(ALT)"
+.LASF1439:
+	.string	"__cpp_lib_clamp 201603L"
+.LASF3237:
+	.string	"_M_allocated_capacity"
+.LASF697:
+	.string	"__stub_setlogin "
+.LASF1231:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2263:
+	.string	"MS_SYNC 4"
+.LASF3243:
+	.string	"__sv_wrapper"
+.LASF2276:
+	.string	"MADV_HUGEPAGE 14"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF256:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF3910:
+	.string	"__intmax_t"
+.LASF3813:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEixEl"
+.LASF3273:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16_M_get_allocatorEv"
+.LASF236:
+	.string	"__DBL_MAX__ double(1.79769313486231570814527423731704357e+308L)"
+.LASF2486:
+	.string	"_PC_SOCK_MAXBUF _PC_SOCK_MAXBUF"
+.LASF178:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF4201:
+	.string	"chunkHeader"
+.LASF1220:
+	.string	"__f64x(x) x ##l"
+.LASF637:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF2221:
+	.string	"S_IROTH (S_IRGRP >> 3)"
+.LASF4039:
+	.string	"lconv"
+.LASF300:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1567:
+	.string	"memmove"
+.LASF815:
+	.string	"_GLIBCXX_HAVE_FREXPF 1"
+.LASF878:
+	.string	"_GLIBCXX_HAVE_SQRTL 1"
+.LASF737:
+	.string	"_PSTL_PRAGMA(x) _Pragma(#x)"
+.LASF901:
+	.string	"_GLIBCXX_HAVE_SYS_STAT_H 1"
+.LASF4025:
+	.string	"__isoc99_vswscanf"
+.LASF2929:
+	.string	"STA_FLL 0x0008"
+.LASF2200:
+	.string	"UTIME_NOW ((1l << 30) - 1l)"
+.LASF4166:
+	.string	"__lhs"
+.LASF513:
+	.string	"_GLIBCXX_SYNCHRONIZATION_HAPPENS_BEFORE(A) "
+.LASF2165:
+	.string	"AT_SYMLINK_FOLLOW 0x400"
+.LASF1578:
+	.string	"strncmp"
+.LASF3788:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEppEi"
+.LASF2765:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LINTFLAGS _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS"
+.LASF1253:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF2386:
+	.string	"_XOPEN_XCU_VERSION 4"
+.LASF2194:
+	.string	"__S_ISUID 04000"
+.LASF3787:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEppEv"
+.LASF3655:
+	.string	"_ZNSt6vectorImSaImEE14_M_insert_rvalEN9__gnu_cxx17__normal_iteratorIPKmS1_EEOm"
+.LASF4023:
+	.string	"__isoc99_swscanf"
+.LASF3851:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEdeEv"
+.LASF4092:
+	.string	"constant"
+.LASF2146:
+	.string	"SYNC_FILE_RANGE_WRITE 2"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1370:
+	.string	"__blkcnt_t_defined "
+.LASF4097:
+	.string	"empirical"
+.LASF1570:
+	.string	"strchr"
+.LASF1339:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF3445:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17find_first_not_ofEcm"
+.LASF1983:
+	.string	"EUCLEAN 117"
+.LASF789:
+	.string	"_GLIBCXX_HAVE_COSF 1"
+.LASF3018:
+	.string	"_GLIBCXX_EH_PTR_USED"
+.LASF2934:
+	.string	"STA_PPSSIGNAL 0x0100"
+.LASF3857:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEixEl"
+.LASF1704:
+	.string	"LC_TELEPHONE __LC_TELEPHONE"
+.LASF3217:
+	.string	"_M_len"
+.LASF1284:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF4179:
+	.string	"__elems_before"
+.LASF2476:
+	.string	"_PC_MAX_INPUT _PC_MAX_INPUT"
+.LASF1810:
+	.string	"stdout stdout"
+.LASF947:
+	.string	"_GLIBCXX98_USE_C99_WCHAR 1"
+.LASF917:
+	.string	"_GLIBCXX_HAVE_UNLINKAT 1"
+.LASF4236:
+	.string	"execution"
+.LASF2897:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF700:
+	.string	"_GLIBCXX_HAVE_GETS"
+.LASF438:
+	.string	"LOGGING 1"
+.LASF570:
+	.string	"_DEFAULT_SOURCE"
+.LASF446:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF2389:
+	.string	"_XOPEN_XPG4 1"
+.LASF1417:
+	.string	"mblen"
+.LASF3442:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17find_first_not_ofERKS4_m"
+.LASF3514:
+	.string	"_ZNSt15__new_allocatorImE9constructImJRKmEEEvPT_DpOT0_"
+.LASF3100:
+	.string	"_CharT"
+.LASF1455:
+	.string	"__STDC_CONSTANT_MACROS "
+.LASF1829:
+	.string	"fputs"
+.LASF3069:
+	.string	"_BoolType"
+.LASF425:
+	.string	"__SSE2_MATH__ 1"
+.LASF1504:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1145:
+	.string	"__need_size_t"
+.LASF2091:
+	.string	"F_GETPIPE_SZ 1032"
+.LASF4030:
+	.string	"tm_mday"
+.LASF2825:
+	.string	"CLONE_PIDFD 0x00001000"
+.LASF82:
+	.string	"__GXX_EXPERIMENTAL_CXX0X__ 1"
+.LASF3523:
+	.string	"_ZNSt16allocator_traitsISaImEE10deallocateERS0_Pmm"
+.LASF3830:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaImEmE15_S_always_equalEv"
+.LASF3480:
+	.string	"_ZNKSt15__exception_ptr13exception_ptr6_M_getEv"
+.LASF2239:
+	.string	"MAP_NORESERVE 0x04000"
+.LASF665:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF2170:
+	.string	"AT_STATX_FORCE_SYNC 0x2000"
+.LASF3302:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8_M_eraseEmm"
+.LASF365:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF772:
+	.string	"_GLIBCXX_HAVE_ACOSF 1"
+.LASF3538:
+	.string	"_Vector_impl"
+.LASF2944:
+	.string	"__itimerspec_defined 1"
+.LASF413:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1816:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF602:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF3956:
+	.string	"uint32_t"
+.LASF3108:
+	.string	"reference"
+.LASF1762:
+	.string	"__cpp_lib_nonmember_container_access 201411L"
+.LASF813:
+	.string	"_GLIBCXX_HAVE_FMODF 1"
+.LASF3635:
+	.string	"_ZNSt6vectorImSaImEE6insertEN9__gnu_cxx17__normal_iteratorIPKmS1_EEOm"
+.LASF3085:
+	.string	"move"
+.LASF1833:
+	.string	"fseek"
+.LASF3355:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE2atEm"
+.LASF670:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF3574:
+	.string	"_S_use_relocate"
+.LASF109:
+	.string	"__cpp_namespace_attributes 201411L"
+.LASF2160:
+	.string	"FALLOC_FL_UNSHARE_RANGE 0x40"
+.LASF1917:
+	.string	"EL2HLT 51"
+.LASF4024:
+	.string	"__isoc99_vfwscanf"
+.LASF4037:
+	.string	"tm_zone"
+.LASF884:
+	.string	"_GLIBCXX_HAVE_STRERROR_R 1"
+.LASF474:
+	.string	"_GLIBCXX20_CONSTEXPR "
+.LASF2199:
+	.string	"__S_IEXEC 0100"
+.LASF2621:
+	.string	"_SC_NL_TEXTMAX _SC_NL_TEXTMAX"
+.LASF2728:
+	.string	"_CS_LFS64_LIBS _CS_LFS64_LIBS"
+.LASF458:
+	.string	"_GLIBCXX_DEPRECATED __attribute__ ((__deprecated__))"
+.LASF416:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF2172:
+	.string	"AT_RECURSIVE 0x8000"
+.LASF958:
+	.string	"_GLIBCXX_SYMVER_GNU 1"
+.LASF1028:
+	.string	"__cpp_lib_transformation_trait_aliases 201304L"
+.LASF2817:
+	.string	"SCHED_IDLE 5"
+.LASF599:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF749:
+	.string	"_PSTL_PRAGMA_SIMD_INCLUSIVE_SCAN(PRM) "
+.LASF1529:
+	.string	"INT64_WIDTH 64"
+.LASF1851:
+	.string	"sscanf"
+.LASF1960:
+	.string	"ESOCKTNOSUPPORT 94"
+.LASF4084:
+	.string	"st_atim"
+.LASF3614:
+	.string	"_ZNSt6vectorImSaImEE6resizeEmRKm"
+.LASF2073:
+	.string	"F_GETFL 3"
+.LASF3024:
+	.string	"_GLIBCXX_ATOMIC_BASE_H 1"
+.LASF1803:
+	.string	"FILENAME_MAX 4096"
+.LASF1639:
+	.string	"wcsncat"
+.LASF1018:
+	.string	"__glibcxx_max_digits10"
+.LASF33:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF2776:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LIBS _CS_POSIX_V7_LPBIG_OFFBIG_LIBS"
+.LASF1579:
+	.string	"strncpy"
+.LASF1109:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF2781:
+	.string	"_GETOPT_CORE_H 1"
+.LASF2772:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LIBS _CS_POSIX_V7_LP64_OFF64_LIBS"
+.LASF3633:
+	.string	"_ZNSt6vectorImSaImEE8pop_backEv"
+.LASF1420:
+	.string	"qsort"
+.LASF2331:
+	.string	"__ASM_GENERIC_BITS_PER_LONG "
+.LASF3256:
+	.string	"_M_capacity"
+.LASF1025:
+	.string	"__cpp_lib_logical_traits 201510L"
+.LASF3292:
+	.string	"iterator"
+.LASF1741:
+	.string	"islower"
+.LASF86:
+	.string	"__cpp_unicode_literals 200710L"
+.LASF3877:
+	.string	"long double"
+.LASF3520:
+	.string	"allocator_traits<std::allocator<long unsigned int> >"
+.LASF3809:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEppEv"
+.LASF2894:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF104:
+	.string	"__cpp_aggregate_nsdmi 201304L"
+.LASF500:
+	.string	"_GLIBCXX_END_NAMESPACE_ALGO "
+.LASF4127:
+	.string	"_ZN9simulator13result_readerD4Ev"
+.LASF974:
+	.string	"_GLIBCXX_USE_GETTIMEOFDAY 1"
+.LASF1531:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF1755:
+	.string	"_GLIBCXX_REFWRAP_H 1"
+.LASF1361:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF3576:
+	.string	"_ZNSt6vectorImSaImEE14_S_do_relocateEPmS2_S2_RS0_St17integral_constantIbLb1EE"
+.LASF3837:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEptEv"
+.LASF3199:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE13find_first_ofEPKcm"
+.LASF3008:
+	.string	"_GCC_PTRDIFF_T "
+.LASF2220:
+	.string	"S_IRWXG (S_IRWXU >> 3)"
+.LASF1664:
+	.string	"_GLIBCXX_ALWAYS_INLINE inline __attribute__((__always_inline__))"
+.LASF198:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF751:
+	.string	"_PSTL_CPP17_EXECUTION_POLICIES_PRESENT (_MSC_VER >= 1912)"
+.LASF2366:
+	.string	"STATX_ATTR_IMMUTABLE 0x00000010"
+.LASF1239:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2302:
+	.string	"MLOCK_ONFAULT 1U"
+.LASF247:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF1066:
+	.string	"__cpp_lib_make_reverse_iterator 201402L"
+.LASF2001:
+	.string	"errno (*__errno_location ())"
+.LASF1528:
+	.string	"UINT32_WIDTH 32"
+.LASF2076:
+	.string	"__F_GETOWN 9"
+.LASF374:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2851:
+	.string	"__CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))"
+.LASF2330:
+	.string	"__BITS_PER_LONG 64"
+.LASF2827:
+	.string	"CLONE_VFORK 0x00004000"
+.LASF2255:
+	.string	"MAP_TYPE 0x0f"
+.LASF1699:
+	.string	"LC_MESSAGES __LC_MESSAGES"
+.LASF2014:
+	.string	"_STL_VECTOR_H 1"
+.LASF3734:
+	.string	"_ZSt8_DestroyIPmEvT_S1_"
+.LASF2594:
+	.string	"_SC_2_UPE _SC_2_UPE"
+.LASF2467:
+	.string	"STDIN_FILENO 0"
+.LASF2243:
+	.string	"MAP_HUGETLB 0x40000"
+.LASF2673:
+	.string	"_SC_V6_ILP32_OFF32 _SC_V6_ILP32_OFF32"
+.LASF1017:
+	.string	"__glibcxx_floating"
+.LASF4228:
+	.string	"_ZNSt11char_traitsIcE3eofEv"
+.LASF4070:
+	.string	"_IO_wide_data"
+.LASF91:
+	.string	"__cpp_rvalue_reference 200610L"
+.LASF3498:
+	.string	"memory_order_consume"
+.LASF3299:
+	.string	"_M_mutate"
+.LASF2830:
+	.string	"CLONE_NEWNS 0x00020000"
+.LASF353:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF674:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1606:
+	.string	"fgetwc"
+.LASF1069:
+	.string	"_GLIBCXX_DEBUG_MACRO_SWITCH_H 1"
+.LASF980:
+	.string	"_GLIBCXX_USE_NLS 1"
+.LASF1596:
+	.string	"_WINT_T 1"
+.LASF2954:
+	.string	"PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_RECURSIVE_NP) } }"
+.LASF1172:
+	.string	"WCONTINUED 8"
+.LASF2421:
+	.string	"_POSIX_ASYNCHRONOUS_IO 200809L"
+.LASF2783:
+	.string	"_LINUX_CLOSE_RANGE_H "
+.LASF1607:
+	.string	"fgetws"
+.LASF4126:
+	.string	"~result_reader"
+.LASF1784:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF2287:
+	.string	"MADV_HWPOISON 100"
+.LASF3426:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4findEPKcmm"
+.LASF1695:
+	.string	"LC_NUMERIC __LC_NUMERIC"
+.LASF1914:
+	.string	"ELNRNG 48"
+.LASF1996:
+	.string	"EOWNERDEAD 130"
+.LASF763:
+	.string	"_PSTL_PRAGMA_DECLARE_REDUCTION(NAME,OP) _PSTL_PRAGMA(omp declare reduction(NAME:OP : omp_out(omp_in)) initializer(omp_priv = omp_orig))"
+.LASF3211:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE16find_last_not_ofES2_m"
+.LASF4229:
+	.string	"__cxx11"
+.LASF893:
+	.string	"_GLIBCXX_HAVE_SYS_IOCTL_H 1"
+.LASF1356:
+	.string	"__timeval_defined 1"
+.LASF2815:
+	.string	"SCHED_BATCH 3"
+.LASF94:
+	.string	"__cpp_initializer_lists 200806L"
+.LASF2403:
+	.string	"_POSIX_CHOWN_RESTRICTED 0"
+.LASF2557:
+	.string	"_SC_IOV_MAX _SC_IOV_MAX"
+.LASF3065:
+	.string	"bidirectional_iterator_tag"
+.LASF3317:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEaSEPKc"
+.LASF2569:
+	.string	"_SC_TTY_NAME_MAX _SC_TTY_NAME_MAX"
+.LASF861:
+	.string	"_GLIBCXX_HAVE_POSIX_MEMALIGN 1"
+.LASF1035:
+	.string	"__cpp_lib_has_unique_object_representations 201606L"
+.LASF1975:
+	.string	"ETOOMANYREFS 109"
+.LASF1932:
+	.string	"EREMOTE 66"
+.LASF3759:
+	.string	"_Iter_comp_iter<simulator::result_reader::find_chunk(uint32_t, simulator::result_chunk&) const::<lambda(uint64_t, uint32_t)> >"
+.LASF101:
+	.string	"__cpp_init_captures 201304L"
+.LASF2694:
+	.string	"_SC_LEVEL4_CACHE_SIZE _SC_LEVEL4_CACHE_SIZE"
+.LASF3922:
+	.string	"__blkcnt_t"
+.LASF377:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF3710:
+	.string	"__iterator_category<__gnu_cxx::__normal_iterator<long unsigned int const*, std::vector<long unsigned int> > >"
+.LASF2253:
+	.string	"MAP_PRIVATE 0x02"
+.LASF3067:
+	.string	"__debug"
+.LASF1322:
+	.string	"__PDP_ENDIAN 3412"
+.LASF215:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1747:
+	.string	"tolower"
+.LASF3131:
+	.string	"basic_string_view"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF3113:
+	.string	"const_reference"
+.LASF401:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF946:
+	.string	"_GLIBCXX98_USE_C99_STDLIB 1"
+.LASF3586:
+	.string	"_ZNSt6vectorImSaImEEC4EOS1_"
+.LASF2896:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF2040:
+	.string	"O_APPEND 02000"
+.LASF2016:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_GROW(n) "
+.LASF397:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF881:
+	.string	"_GLIBCXX_HAVE_STDINT_H 1"
+.LASF3629:
+	.string	"_ZNSt6vectorImSaImEE4dataEv"
+.LASF2192:
+	.string	"__S_TYPEISSEM(buf) ((buf)->st_mode - (buf)->st_mode)"
+.LASF2466:
+	.string	"__LP64_OFF64_LDFLAGS \"-m64\""
+.LASF427:
+	.string	"__SEG_FS 1"
+.LASF1251:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1963:
+	.string	"EAFNOSUPPORT 97"
+.LASF174:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF939:
+	.string	"_GLIBCXX11_USE_C99_MATH 1"
+.LASF3483:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4EDn"
+.LASF4145:
+	.string	"_Znwm"
+.LASF1275:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF2350:
+	.string	"STATX_NLINK 0x00000004U"
+.LASF889:
+	.string	"_GLIBCXX_HAVE_STRUCT_DIRENT_D_TYPE 1"
+.LASF92:
+	.string	"__cpp_rvalue_references 200610L"
+.LASF2959:
+	.string	"PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED"
+.LASF502:
+	.string	"_GLIBCXX_LONG_DOUBLE_ALT128_COMPAT"
+.LASF588:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF849:
+	.string	"_GLIBCXX_HAVE_MBSTATE_T 1"
+.LASF2907:
+	.string	"ADJ_TIMECONST 0x0020"
+.LASF3340:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6resizeEmc"
+.LASF608:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2110:
+	.string	"LOCK_READ 64"
+.LASF3888:
+	.string	"5div_t"
+.LASF3751:
+	.string	"bool"
+.LASF834:
+	.string	"_GLIBCXX_HAVE_LIMIT_AS 1"
+.LASF871:
+	.string	"_GLIBCXX_HAVE_SINCOSL 1"
+.LASF534:
+	.string	"__USE_XOPEN2K8"
+.LASF1067:
+	.string	"_GLIBCXX_MAKE_MOVE_ITERATOR(_Iter) std::make_move_iterator(_Iter)"
+.LASF659:
+	.string	"__wur "
+.LASF3578:
+	.string	"_S_relocate"
+.LASF382:
+	.string	"__NO_INLINE__ 1"
+.LASF3546:
+	.string	"_ZNSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv"
+.LASF3149:
+	.string	"rend"
+.LASF1468:
+	.string	"INT32_MAX (2147483647)"
+.LASF2968:
+	.string	"PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED"
+.LASF1807:
+	.string	"FOPEN_MAX 16"
+.LASF762:
+	.string	"_PSTL_PRAGMA_SIMD_ORDERED_MONOTONIC_2ARGS(PRM1,PRM2) "
+.LASF3561:
+	.string	"_M_allocate"
+.LASF2701:
+	.string	"_SC_V7_LP64_OFF64 _SC_V7_LP64_OFF64"
+.LASF3590:
+	.string	"_ZNSt6vectorImSaImEEC4EOS1_RKS0_"
+.LASF1186:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF3041:
+	.string	"_GLIBCXX_UTILITY 1"
+.LASF269:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1229:
+	.string	"EXIT_SUCCESS 0"
+.LASF677:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1474:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF2802:
+	.string	"_ALLOCATED_PTR_H 1"
+.LASF4219:
+	.string	"numOfRecords"
+.LASF963:
+	.string	"_GLIBCXX_USE_C99_FENV_TR1 1"
+.LASF266:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF445:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF3409:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_NS6_IPcS4_EESB_"
+.LASF2006:
+	.string	"_GLIBCXX_STRING_CONSTEXPR "
+.LASF1728:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF1907:
+	.string	"EWOULDBLOCK EAGAIN"
+.LASF966:
+	.string	"_GLIBCXX_USE_C99_MATH_TR1 1"
+.LASF3907:
+	.string	"__uint_least32_t"
+.LASF1291:
+	.string	"__FD_SETSIZE 1024"
+.LASF2867:
+	.string	"CPU_ISSET(cpu,cpusetp) __CPU_ISSET_S (cpu, sizeof (cpu_set_t), cpusetp)"
+.LASF1007:
+	.string	"__INT_N(TYPE) __extension__ template<> struct __is_integer<TYPE> { enum { __value = 1 }; typedef __true_type __type; }; __extension__ template<> struct __is_integer<unsigned TYPE> { enum { __value = 1 }; typedef __true_type __type; };"
+.LASF4116:
+	.string	"mTimeSize"
+.LASF885:
+	.string	"_GLIBCXX_HAVE_STRINGS_H 1"
+.LASF2069:
+	.string	"O_RSYNC O_SYNC"
+.LASF1108:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF289:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2600:
+	.string	"_SC_CHAR_MIN _SC_CHAR_MIN"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF3155:
+	.string	"size"
+.LASF3391:
+	.string	"erase"
+.LASF2397:
+	.string	"_POSIX_SYNCHRONIZED_IO 200809L"
+.LASF3150:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4rendEv"
+.LASF2328:
+	.string	"_ASM_GENERIC_INT_LL64_H "
+.LASF3038:
+	.string	"ATOMIC_FLAG_INIT { 0 }"
+.LASF3717:
+	.string	"max<long unsigned int>"
+.LASF557:
+	.string	"_ISOC11_SOURCE 1"
+.LASF1170:
+	.string	"WSTOPPED 2"
+.LASF2717:
+	.string	"_CS_GNU_LIBPTHREAD_VERSION _CS_GNU_LIBPTHREAD_VERSION"
+.LASF3531:
+	.string	"_M_finish"
+.LASF2985:
+	.string	"__GTHREAD_TIME_INIT {0,0}"
+.LASF2388:
+	.string	"_XOPEN_XPG3 1"
+.LASF4081:
+	.string	"st_size"
+.LASF1343:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1976:
+	.string	"ETIMEDOUT 110"
+.LASF3543:
+	.string	"_ZNSt12_Vector_baseImSaImEE12_Vector_implC4EOS0_OS2_"
+.LASF1683:
+	.string	"__LC_TIME 2"
+.LASF3364:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEpLESt16initializer_listIcE"
+.LASF2974:
+	.string	"__cleanup_fct_attribute "
+.LASF383:
+	.string	"__STRICT_ANSI__ 1"
+.LASF1573:
+	.string	"strcpy"
+.LASF3120:
+	.string	"_ZNKSt15__new_allocatorIcE8max_sizeEv"
+.LASF3300:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_mutateEmmPKcm"
+.LASF1398:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF2018:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_SHRINK(n) "
+.LASF3219:
+	.string	"allocator_traits<std::allocator<char> >"
+.LASF2315:
+	.string	"S_TYPEISMQ(buf) __S_TYPEISMQ(buf)"
+.LASF2249:
+	.string	"PROT_NONE 0x0"
+.LASF3215:
+	.string	"_S_compare"
+.LASF3437:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13find_first_ofEcm"
+.LASF265:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2358:
+	.string	"STATX_BLOCKS 0x00000400U"
+.LASF1421:
+	.string	"quick_exit"
+.LASF493:
+	.string	"_GLIBCXX_BEGIN_NAMESPACE_VERSION "
+.LASF1257:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF4028:
+	.string	"tm_min"
+.LASF1536:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF4044:
+	.string	"currency_symbol"
+.LASF4095:
+	.string	"power_law"
+.LASF2723:
+	.string	"_CS_LFS_LDFLAGS _CS_LFS_LDFLAGS"
+.LASF1610:
+	.string	"fwide"
+.LASF2675:
+	.string	"_SC_V6_LP64_OFF64 _SC_V6_LP64_OFF64"
+.LASF1406:
+	.string	"atof"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF3352:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEixEm"
+.LASF1407:
+	.string	"atoi"
+.LASF1408:
+	.string	"atol"
+.LASF1318:
+	.string	"_ENDIAN_H 1"
+.LASF3283:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE11_M_disjunctEPKc"
+.LASF965:
+	.string	"_GLIBCXX_USE_C99_INTTYPES_WCHAR_T_TR1 1"
+.LASF3380:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignESt16initializer_listIcE"
+.LASF2555:
+	.string	"_SC_SELECT _SC_SELECT"
+.LASF1689:
+	.string	"__LC_NAME 8"
+.LASF381:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF3705:
+	.string	"_ZSt9__advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_St26random_access_iterator_tag"
+.LASF296:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1266:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF641:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF774:
+	.string	"_GLIBCXX_HAVE_ALIGNED_ALLOC 1"
+.LASF1372:
+	.string	"__fsfilcnt_t_defined "
+.LASF26:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF3435:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13find_first_ofEPKcmm"
+.LASF3765:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE10_S_on_swapERS1_S3_"
+.LASF1935:
+	.string	"ESRMNT 69"
+.LASF2514:
+	.string	"_SC_MEMORY_PROTECTION _SC_MEMORY_PROTECTION"
+.LASF2041:
+	.string	"O_NONBLOCK 04000"
+.LASF726:
+	.string	"_GLIBCXX_HAS_BUILTIN"
+.LASF286:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF506:
+	.string	"_GLIBCXX_NAMESPACE_LDBL_OR_CXX11 _GLIBCXX_NAMESPACE_CXX11"
+.LASF4020:
+	.string	"_unused2"
+.LASF305:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF982:
+	.string	"_GLIBCXX_USE_PTHREAD_MUTEX_CLOCKLOCK 1"
+.LASF2702:
+	.string	"_SC_V7_LPBIG_OFFBIG _SC_V7_LPBIG_OFFBIG"
+.LASF956:
+	.string	"_GLIBCXX_STDIO_SEEK_END 2"
+.LASF2623:
+	.string	"_SC_XBS5_ILP32_OFFBIG _SC_XBS5_ILP32_OFFBIG"
+.LASF4157:
+	.string	"__it"
+.LASF603:
+	.string	"__USE_GNU 1"
+.LASF564:
+	.string	"_XOPEN_SOURCE"
+.LASF572:
+	.string	"_ATFILE_SOURCE"
+.LASF2470:
+	.string	"__socklen_t_defined "
+.LASF3061:
+	.string	"size_t"
+.LASF1174:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF597:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1188:
+	.string	"__WCOREFLAG 0x80"
+.LASF380:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2342:
+	.string	"__bitwise "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF3674:
+	.string	"initializer_list<long unsigned int>"
+.LASF2284:
+	.string	"MADV_POPULATE_READ 22"
+.LASF1736:
+	.string	"isalnum"
+.LASF2223:
+	.string	"S_IXOTH (S_IXGRP >> 3)"
+.LASF2154:
+	.string	"FALLOC_FL_KEEP_SIZE 0x01"
+.LASF3769:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE27_S_propagate_on_move_assignEv"
+.LASF2251:
+	.string	"PROT_GROWSUP 0x02000000"
+.LASF1600:
+	.string	"__FILE_defined 1"
+.LASF3330:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4rendEv"
+.LASF574:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF3490:
+	.string	"operator bool"
+.LASF579:
+	.string	"__USE_ISOC95 1"
+.LASF355:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1890:
+	.string	"EMFILE 24"
+.LASF4230:
+	.string	"_ZNSt16allocator_traitsISaImEE9constructImJRKmEEEvRS0_PT_DpOT0_"
+.LASF3834:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC4Ev"
+.LASF2392:
+	.string	"_XOPEN_LEGACY 1"
+.LASF2359:
+	.string	"STATX_BASIC_STATS 0x000007ffU"
+.LASF1328:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF1978:
+	.string	"EHOSTDOWN 112"
+.LASF4038:
+	.string	"__isoc99_wscanf"
+.LASF1375:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF3195:
+	.string	"find_first_of"
+.LASF153:
+	.string	"__WINT_WIDTH__ 32"
+.LASF3034:
+	.string	"ATOMIC_LLONG_LOCK_FREE __GCC_ATOMIC_LLONG_LOCK_FREE"
+.LASF1166:
+	.string	"__need_NULL"
+.LASF784:
+	.string	"_GLIBCXX_HAVE_ATOMIC_LOCK_POLICY 1"
+.LASF689:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF656:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1444:
+	.string	"__cpp_lib_parallel_algorithm 201603L"
+.LASF3240:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17_S_to_string_viewESt17basic_string_viewIcS2_E"
+.LASF710:
+	.string	"_GLIBCXX_USE_STD_SPEC_FUNCS 1"
+.LASF3129:
+	.string	"nullptr_t"
+.LASF3395:
+	.string	"pop_back"
+.LASF850:
+	.string	"_GLIBCXX_HAVE_MEMALIGN 1"
+.LASF2957:
+	.string	"PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }"
+.LASF451:
+	.string	"__GLIBCXX__ 20220819"
+.LASF1790:
+	.string	"_IOLBF 1"
+.LASF1184:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF1622:
+	.string	"swscanf"
+.LASF1931:
+	.string	"ENOPKG 65"
+.LASF2918:
+	.string	"MOD_ESTERROR ADJ_ESTERROR"
+.LASF3142:
+	.string	"cbegin"
+.LASF3964:
+	.string	"uint_least32_t"
+.LASF3422:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4dataEv"
+.LASF3030:
+	.string	"ATOMIC_CHAR32_T_LOCK_FREE __GCC_ATOMIC_CHAR32_T_LOCK_FREE"
+.LASF3719:
+	.string	"advance<__gnu_cxx::__normal_iterator<long unsigned int const*, std::vector<long unsigned int> >, long int>"
+.LASF2211:
+	.string	"S_ISGID __S_ISGID"
+.LASF760:
+	.string	"_PSTL_PRAGMA_SIMD_EARLYEXIT "
+.LASF623:
+	.string	"__P(args) args"
+.LASF937:
+	.string	"_GLIBCXX_DARWIN_USE_64_BIT_INODE 1"
+.LASF3272:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16_M_get_allocatorEv"
+.LASF766:
+	.string	"_PSTL_PRAGMA_LOCATION \" [Parallel STL message]: \""
+.LASF1213:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF3535:
+	.string	"_M_copy_data"
+.LASF2224:
+	.string	"S_IRWXO (S_IRWXG >> 3)"
+.LASF1189:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF3929:
+	.string	"tv_sec"
+.LASF4152:
+	.string	"this"
+.LASF840:
+	.string	"_GLIBCXX_HAVE_LINK_H 1"
+.LASF1349:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF95:
+	.string	"__cpp_delegating_constructors 200604L"
+.LASF293:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF741:
+	.string	"_PSTL_HIDE_FROM_ABI_PUSH "
+.LASF1897:
+	.string	"EMLINK 31"
+.LASF2655:
+	.string	"_SC_SIGNALS _SC_SIGNALS"
+.LASF182:
+	.string	"__INT64_C(c) c ## L"
+.LASF643:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1447:
+	.string	"_ASSERT_H_DECLS "
+.LASF681:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF2150:
+	.string	"SPLICE_F_NONBLOCK 2"
+.LASF3491:
+	.string	"_ZNKSt15__exception_ptr13exception_ptrcvbEv"
+.LASF1384:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF351:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF2454:
+	.string	"_POSIX_TYPED_MEMORY_OBJECTS -1"
+.LASF2517:
+	.string	"_SC_SHARED_MEMORY_OBJECTS _SC_SHARED_MEMORY_OBJECTS"
+.LASF2323:
+	.string	"DEFFILEMODE (S_IRUSR|S_IWUSR|S_IRGRP|S_IWGRP|S_IROTH|S_IWOTH)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF4224:
+	.string	"GNU C++17 12.2.0 -mtune=generic -march=x86-64 -g3 -O0 -pedantic-errors -std=c++17 -p -fprofile-arcs -ftest-coverage -fprofile-update=prefer-atomic -fasynchronous-unwind-tables"
+.LASF1767:
+	.string	"_GLIBCXX_STRING_VIEW 1"
+.LASF648:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2889:
+	.string	"CLOCK_REALTIME 0"
+.LASF2916:
+	.string	"MOD_FREQUENCY ADJ_FREQUENCY"
+.LASF1977:
+	.string	"ECONNREFUSED 111"
+.LASF2611:
+	.string	"_SC_SHRT_MIN _SC_SHRT_MIN"
+.LASF1024:
+	.string	"__cpp_lib_bool_constant 201505L"
+.LASF780:
+	.string	"_GLIBCXX_HAVE_ATAN2F 1"
+.LASF721:
+	.string	"_GLIBCXX_HAS_BUILTIN(B) __has_builtin(B)"
+.LASF234:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF969:
+	.string	"_GLIBCXX_USE_CLOCK_REALTIME 1"
+.LASF2012:
+	.string	"_GLIBCXX_USE_ASSIGN_FOR_INIT"
+.LASF2452:
+	.string	"_POSIX_TRACE_INHERIT -1"
+.LASF1687:
+	.string	"__LC_ALL 6"
+.LASF3052:
+	.string	"_ZNKSt17integral_constantIbLb0EEcvbEv"
+.LASF3685:
+	.string	"remove_reference<simulator::result_reader::find_chunk(uint32_t, simulator::result_chunk&) const::<lambda(uint64_t, uint32_t)>&>"
+.LASF146:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF4114:
+	.string	"mMagic"
+.LASF2193:
+	.string	"__S_TYPEISSHM(buf) ((buf)->st_mode - (buf)->st_mode)"
+.LASF2278:
+	.string	"MADV_DONTDUMP 16"
+.LASF1548:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF854:
+	.string	"_GLIBCXX_HAVE_MODFL 1"
+.LASF2972:
+	.string	"PTHREAD_BARRIER_SERIAL_THREAD -1"
+.LASF2526:
+	.string	"_SC_PAGE_SIZE _SC_PAGESIZE"
+.LASF117:
+	.string	"__cpp_capture_star_this 201603L"
+.LASF2645:
+	.string	"_SC_FILE_SYSTEM _SC_FILE_SYSTEM"
+.LASF3406:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_mc"
+.LASF1916:
+	.string	"ENOCSI 50"
+.LASF1783:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF916:
+	.string	"_GLIBCXX_HAVE_UNISTD_H 1"
+.LASF1750:
+	.string	"_OSTREAM_INSERT_H 1"
+.LASF3181:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareEmmS2_"
+.LASF3513:
+	.string	"construct<long unsigned int, long unsigned int const&>"
+.LASF3592:
+	.string	"~vector"
+.LASF2924:
+	.string	"MOD_MICRO ADJ_MICRO"
+.LASF516:
+	.string	"_GLIBCXX_END_EXTERN_C }"
+.LASF459:
+	.string	"_GLIBCXX_DEPRECATED_SUGGEST(ALT) __attribute__ ((__deprecated__ (\"use '\" ALT \"' instead\")))"
+.LASF1967:
+	.string	"ENETUNREACH 101"
+.LASF1808:
+	.string	"_PRINTF_NAN_LEN_MAX 4"
+.LASF384:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF4022:
+	.string	"__isoc99_fwscanf"
+.LASF3072:
+	.string	"true_type"
+.LASF682:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF3111:
+	.string	"_ZNKSt15__new_allocatorIcE7addressERc"
+.LASF1094:
+	.string	"__cpp_lib_robust_nonmodifying_seq_ops 201304L"
+.LASF315:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF3013:
+	.string	"_GCC_MAX_ALIGN_T "
+.LASF1880:
+	.string	"EFAULT 14"
+.LASF3411:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_St16initializer_listIcE"
+.LASF4062:
+	.string	"int_p_sign_posn"
+.LASF2879:
+	.string	"CPU_XOR(destset,srcset1,srcset2) __CPU_OP_S (sizeof (cpu_set_t), destset, srcset1, srcset2, ^)"
+.LASF3886:
+	.string	"quot"
+.LASF1391:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF3152:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7crbeginEv"
+.LASF1915:
+	.string	"EUNATCH 49"
+.LASF3985:
+	.string	"__wchb"
+.LASF1210:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2309:
+	.string	"S_ISCHR(mode) __S_ISTYPE((mode), __S_IFCHR)"
+.LASF2903:
+	.string	"ADJ_FREQUENCY 0x0002"
+.LASF4147:
+	.string	"close"
+.LASF2365:
+	.string	"STATX_ATTR_COMPRESSED 0x00000004"
+.LASF1392:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF4100:
+	.string	"sampling_method"
+.LASF452:
+	.string	"_GLIBCXX_PURE __attribute__ ((__pure__))"
+.LASF1841:
+	.string	"putc"
+.LASF887:
+	.string	"_GLIBCXX_HAVE_STRTOF 1"
+.LASF1981:
+	.string	"EINPROGRESS 115"
+.LASF1255:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF3088:
+	.string	"_ZNSt11char_traitsIcE4copyEPcPKcm"
+.LASF3532:
+	.string	"_M_end_of_storage"
+.LASF2088:
+	.string	"F_GETLEASE 1025"
+.LASF2943:
+	.string	"__struct_tm_defined 1"
+.LASF739:
+	.string	"_PSTL_STRING(x) _PSTL_STRING_AUX(x)"
+.LASF2463:
+	.string	"__ILP32_OFFBIG_CFLAGS \"-m32 -D_LARGEFILE_SOURCE -D_FILE_OFFSET_BITS=64\""
+.LASF2849:
+	.string	"__NCPUBITS (8 * sizeof (__cpu_mask))"
+.LASF3600:
+	.string	"_ZNKSt6vectorImSaImEE5beginEv"
+.LASF2692:
+	.string	"_SC_LEVEL3_CACHE_ASSOC _SC_LEVEL3_CACHE_ASSOC"
+.LASF892:
+	.string	"_GLIBCXX_HAVE_SYMVER_SYMBOL_RENAMING_RUNTIME_SUPPORT 1"
+.LASF1871:
+	.string	"EIO 5"
+.LASF4031:
+	.string	"tm_mon"
+.LASF2900:
+	.string	"TIMER_ABSTIME 1"
+.LASF1429:
+	.string	"wcstombs"
+.LASF953:
+	.string	"_GLIBCXX_RES_LIMITS 1"
+.LASF1721:
+	.string	"_GLIBCXX_CLOCALE 1"
+.LASF2859:
+	.string	"__CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))"
+.LASF350:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1597:
+	.string	"__mbstate_t_defined 1"
+.LASF3820:
+	.string	"_Lock_policy"
+.LASF2214:
+	.string	"S_IWUSR __S_IWRITE"
+.LASF1016:
+	.string	"__glibcxx_max_exponent10(_Tp) __glibcxx_floating(_Tp, __FLT_MAX_10_EXP__, __DBL_MAX_10_EXP__, __LDBL_MAX_10_EXP__)"
+.LASF3048:
+	.string	"__need_wint_t"
+.LASF227:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1534:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF2547:
+	.string	"_SC_2_SW_DEV _SC_2_SW_DEV"
+.LASF3132:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEEC4Ev"
+.LASF1924:
+	.string	"EDEADLOCK EDEADLK"
+.LASF3596:
+	.string	"_ZNSt6vectorImSaImEEaSESt16initializer_listImE"
+.LASF1335:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF2305:
+	.string	"MAP_FAILED ((void *) -1)"
+.LASF2226:
+	.string	"W_OK 2"
+.LASF2105:
+	.string	"LOCK_SH 1"
+.LASF3708:
+	.string	"__distance<__gnu_cxx::__normal_iterator<long unsigned int const*, std::vector<long unsigned int> > >"
+.LASF915:
+	.string	"_GLIBCXX_HAVE_UCHAR_H 1"
+.LASF1260:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2095:
+	.string	"F_SET_RW_HINT 1036"
+.LASF832:
+	.string	"_GLIBCXX_HAVE_LDEXPL 1"
+.LASF1199:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF3564:
+	.string	"_ZNSt12_Vector_baseImSaImEE13_M_deallocateEPmm"
+.LASF2854:
+	.string	"__CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))"
+.LASF2166:
+	.string	"AT_NO_AUTOMOUNT 0x800"
+.LASF1079:
+	.string	"__glibcxx_requires_partitioned_lower(_First,_Last,_Value) "
+.LASF3774:
+	.string	"_S_nothrow_move"
+.LASF2406:
+	.string	"_XOPEN_REALTIME 1"
+.LASF2620:
+	.string	"_SC_NL_SETMAX _SC_NL_SETMAX"
+.LASF3432:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5rfindEPKcm"
+.LASF3343:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13shrink_to_fitEv"
+.LASF1314:
+	.string	"__useconds_t_defined "
+.LASF2649:
+	.string	"_SC_NETWORKING _SC_NETWORKING"
+.LASF1047:
+	.string	"__cpp_lib_tuples_by_type 201304L"
+.LASF2319:
+	.string	"S_IWRITE S_IWUSR"
+.LASF1256:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1496:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF297:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF3460:
+	.string	"_M_array"
+.LASF2005:
+	.string	"__cpp_lib_string_udls 201304L"
+.LASF3235:
+	.string	"_M_p"
+.LASF2398:
+	.string	"_POSIX_FSYNC 200809L"
+.LASF2946:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF4222:
+	.string	"__int128"
+.LASF1480:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF3795:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEplEl"
+.LASF3753:
+	.string	"__ops"
+.LASF2877:
+	.string	"CPU_AND(destset,srcset1,srcset2) __CPU_OP_S (sizeof (cpu_set_t), destset, srcset1, srcset2, &)"
+.LASF1904:
+	.string	"ENOSYS 38"
+.LASF1121:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF3971:
+	.string	"uint_fast16_t"
+.LASF414:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1089:
+	.string	"__glibcxx_requires_irreflexive_pred(_First,_Last,_Pred) "
+.LASF1050:
+	.string	"_CONCEPT_CHECK_H 1"
+.LASF3068:
+	.string	"__equal<true>"
+.LASF1301:
+	.string	"__nlink_t_defined "
+.LASF3229:
+	.string	"rebind_alloc"
+.LASF2660:
+	.string	"_SC_SYSTEM_DATABASE_R _SC_SYSTEM_DATABASE_R"
+.LASF3895:
+	.string	"__uint8_t"
+.LASF2838:
+	.string	"CLONE_NEWCGROUP 0x02000000"
+.LASF2079:
+	.string	"__F_SETSIG 10"
+.LASF423:
+	.string	"__FXSR__ 1"
+.LASF2512:
+	.string	"_SC_MEMLOCK _SC_MEMLOCK"
+.LASF2138:
+	.string	"__POSIX_FADV_NOREUSE 5"
+.LASF609:
+	.string	"__GLIBC__ 2"
+.LASF4029:
+	.string	"tm_hour"
+.LASF1218:
+	.string	"__f64(x) x"
+.LASF2667:
+	.string	"_SC_2_PBS_LOCATE _SC_2_PBS_LOCATE"
+.LASF1164:
+	.string	"NULL"
+.LASF1383:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF2774:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS"
+.LASF185:
+	.string	"__UINT8_C(c) c"
+.LASF2381:
+	.string	"_POSIX2_C_BIND __POSIX2_THIS_VERSION"
+.LASF1990:
+	.string	"EMEDIUMTYPE 124"
+.LASF862:
+	.string	"_GLIBCXX_HAVE_POSIX_SEMAPHORE 1"
+.LASF1706:
+	.string	"LC_IDENTIFICATION __LC_IDENTIFICATION"
+.LASF3086:
+	.string	"_ZNSt11char_traitsIcE4moveEPcPKcm"
+.LASF2180:
+	.string	"_STATBUF_ST_BLKSIZE "
+.LASF157:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF864:
+	.string	"_GLIBCXX_HAVE_POWL 1"
+.LASF3276:
+	.string	"_M_check"
+.LASF3977:
+	.string	"uintmax_t"
+.LASF3393:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5eraseEN9__gnu_cxx17__normal_iteratorIPKcS4_EE"
+.LASF4010:
+	.string	"_vtable_offset"
+.LASF3527:
+	.string	"_Args"
+.LASF1717:
+	.string	"LC_MEASUREMENT_MASK (1 << __LC_MEASUREMENT)"
+.LASF272:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2986:
+	.string	"__gthrw2(name,name2,type) "
+.LASF3928:
+	.string	"timespec"
+.LASF945:
+	.string	"_GLIBCXX98_USE_C99_STDIO 1"
+.LASF1677:
+	.string	"_LOCALE_FWD_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2027:
+	.string	"__O_LARGEFILE 0"
+.LASF1336:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF3756:
+	.string	"_Iter_comp_val"
+.LASF1520:
+	.string	"UINT64_C(c) c ## UL"
+.LASF3584:
+	.string	"_ZNSt6vectorImSaImEEC4EmRKmRKS0_"
+.LASF3277:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8_M_checkEmPKc"
+.LASF1369:
+	.string	"__blksize_t_defined "
+.LASF3316:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEaSERKS4_"
+.LASF3474:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4EPv"
+.LASF2097:
+	.string	"F_SET_FILE_RW_HINT 1038"
+.LASF3773:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE15_S_always_equalEv"
+.LASF3671:
+	.string	"_M_realloc_insert<long unsigned int const&>"
+.LASF1117:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF2527:
+	.string	"_SC_RTSIG_MAX _SC_RTSIG_MAX"
+.LASF930:
+	.string	"_GLIBCXX_PACKAGE_BUGREPORT \"\""
+.LASF42:
+	.string	"__GNUG__ 12"
+.LASF2290:
+	.string	"POSIX_MADV_SEQUENTIAL 2"
+.LASF1509:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1351:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF2826:
+	.string	"CLONE_PTRACE 0x00002000"
+.LASF1382:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1252:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF37:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF3692:
+	.string	"__throw_length_error"
+.LASF4212:
+	.string	"statResult"
+.LASF627:
+	.string	"__ptr_t void *"
+.LASF1879:
+	.string	"EACCES 13"
+.LASF2291:
+	.string	"POSIX_MADV_WILLNEED 3"
+.LASF4098:
+	.string	"invalid"
+.LASF1226:
+	.string	"__lldiv_t_defined 1"
+.LASF2045:
+	.string	"O_ASYNC 020000"
+.LASF4075:
+	.string	"st_nlink"
+.LASF2207:
+	.string	"S_IFIFO __S_IFIFO"
+.LASF1525:
+	.string	"INT16_WIDTH 16"
+.LASF149:
+	.string	"__INT_WIDTH__ 32"
+.LASF2706:
+	.string	"_SC_TRACE_SYS_MAX _SC_TRACE_SYS_MAX"
+.LASF4194:
+	.string	"<lambda>"
+.LASF424:
+	.string	"__SSE_MATH__ 1"
+.LASF273:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2178:
+	.string	"st_mtime st_mtim.tv_sec"
+.LASF1308:
+	.string	"__daddr_t_defined "
+.LASF1082:
+	.string	"__glibcxx_requires_partitioned_upper_pred(_First,_Last,_Value,_Pred) "
+.LASF2438:
+	.string	"_POSIX_TIMERS 200809L"
+.LASF3638:
+	.string	"_ZNSt6vectorImSaImEE5eraseEN9__gnu_cxx17__normal_iteratorIPKmS1_EE"
+.LASF4235:
+	.string	"__default_lock_policy"
+.LASF1173:
+	.string	"WNOWAIT 0x01000000"
+.LASF803:
+	.string	"_GLIBCXX_HAVE_FABSL 1"
+.LASF3595:
+	.string	"_ZNSt6vectorImSaImEEaSEOS1_"
+.LASF3571:
+	.string	"_S_nothrow_relocate"
+.LASF3035:
+	.string	"ATOMIC_POINTER_LOCK_FREE __GCC_ATOMIC_POINTER_LOCK_FREE"
+.LASF582:
+	.string	"__USE_POSIX2 1"
+.LASF242:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF3577:
+	.string	"_ZNSt6vectorImSaImEE14_S_do_relocateEPmS2_S2_RS0_St17integral_constantIbLb0EE"
+.LASF210:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF371:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF822:
+	.string	"_GLIBCXX_HAVE_HYPOTL 1"
+.LASF699:
+	.string	"__stub_stty "
+.LASF519:
+	.string	"__NO_CTYPE 1"
+.LASF2482:
+	.string	"_PC_VDISABLE _PC_VDISABLE"
+.LASF3154:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5crendEv"
+.LASF3354:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE2atEm"
+.LASF3399:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEmmRKS4_mm"
+.LASF2635:
+	.string	"_SC_CPUTIME _SC_CPUTIME"
+.LASF964:
+	.string	"_GLIBCXX_USE_C99_INTTYPES_TR1 1"
+.LASF2698:
+	.string	"_SC_RAW_SOCKETS _SC_RAW_SOCKETS"
+.LASF1068:
+	.string	"_GLIBCXX_MAKE_MOVE_IF_NOEXCEPT_ITERATOR(_Iter) std::__make_move_if_noexcept_iterator(_Iter)"
+.LASF3826:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaImEmE10_S_on_swapERS1_S3_"
+.LASF2177:
+	.string	"st_atime st_atim.tv_sec"
+.LASF161:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF3530:
+	.string	"_M_start"
+.LASF2009:
+	.string	"_GLIBCXX_VECTOR 1"
+.LASF2995:
+	.string	"__cpp_lib_uncaught_exceptions 201411L"
+.LASF926:
+	.string	"_GLIBCXX_HAVE_WRITEV 1"
+.LASF1415:
+	.string	"ldiv"
+.LASF80:
+	.string	"__GXX_RTTI 1"
+.LASF2313:
+	.string	"S_ISLNK(mode) __S_ISTYPE((mode), __S_IFLNK)"
+.LASF664:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF115:
+	.string	"__cpp_constexpr 201603L"
+.LASF3805:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEC4Ev"
+.LASF1885:
+	.string	"ENODEV 19"
+.LASF3056:
+	.string	"value_type"
+.LASF4034:
+	.string	"tm_yday"
+.LASF508:
+	.string	"_GLIBCXX_END_NAMESPACE_LDBL_OR_CXX11 _GLIBCXX_END_NAMESPACE_CXX11"
+.LASF2618:
+	.string	"_SC_NL_MSGMAX _SC_NL_MSGMAX"
+.LASF2179:
+	.string	"st_ctime st_ctim.tv_sec"
+.LASF1347:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF2159:
+	.string	"FALLOC_FL_INSERT_RANGE 0x20"
+.LASF2391:
+	.string	"_XOPEN_ENH_I18N 1"
+.LASF2627:
+	.string	"_SC_XOPEN_REALTIME _SC_XOPEN_REALTIME"
+.LASF3156:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4sizeEv"
+.LASF4209:
+	.string	"resultFilename"
+.LASF1789:
+	.string	"_IOFBF 0"
+.LASF1940:
+	.string	"EBADMSG 74"
+.LASF2794:
+	.string	"__cpp_lib_apply 201603L"
+.LASF1463:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1826:
+	.string	"fopen"
+.LASF343:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1137:
+	.string	"_SIZE_T_DEFINED "
+.LASF3477:
+	.string	"_M_release"
+.LASF2588:
+	.string	"_SC_XOPEN_UNIX _SC_XOPEN_UNIX"
+.LASF3927:
+	.string	"int64_t"
+.LASF2626:
+	.string	"_SC_XOPEN_LEGACY _SC_XOPEN_LEGACY"
+.LASF3366:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendERKS4_"
+.LASF1634:
+	.string	"wcscoll"
+.LASF84:
+	.string	"__cpp_hex_float 201603L"
+.LASF2873:
+	.string	"CPU_ZERO_S(setsize,cpusetp) __CPU_ZERO_S (setsize, cpusetp)"
+.LASF808:
+	.string	"_GLIBCXX_HAVE_FINITEF 1"
+.LASF959:
+	.string	"_GLIBCXX_USE_C11_UCHAR_CXX11 1"
+.LASF2144:
+	.string	"POSIX_FADV_NOREUSE __POSIX_FADV_NOREUSE"
+.LASF2750:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_CFLAGS _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS"
+.LASF2685:
+	.string	"_SC_LEVEL1_DCACHE_SIZE _SC_LEVEL1_DCACHE_SIZE"
+.LASF25:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF2475:
+	.string	"_PC_MAX_CANON _PC_MAX_CANON"
+.LASF3588:
+	.string	"_ZNSt6vectorImSaImEEC4EOS1_RKS0_St17integral_constantIbLb1EE"
+.LASF573:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1753:
+	.string	"__cpp_lib_transparent_operators 201510L"
+.LASF1766:
+	.string	"__cpp_lib_allocator_traits_is_always_equal 201411L"
+.LASF3882:
+	.string	"char32_t"
+.LASF1796:
+	.string	"SEEK_END 2"
+.LASF3701:
+	.string	"__memcmp<char, char>"
+.LASF3803:
+	.string	"__normal_iterator<char const*, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >"
+.LASF2507:
+	.string	"_SC_ASYNCHRONOUS_IO _SC_ASYNCHRONOUS_IO"
+.LASF2548:
+	.string	"_SC_2_LOCALEDEF _SC_2_LOCALEDEF"
+.LASF1603:
+	.string	"__attr_dealloc_fclose "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF4220:
+	.string	"columnsSize"
+.LASF1132:
+	.string	"_T_SIZE "
+.LASF1491:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF2931:
+	.string	"STA_DEL 0x0020"
+.LASF1063:
+	.string	"_STL_ITERATOR_H 1"
+.LASF1443:
+	.string	"_PSTL_ALGORITHM_FORWARD_DECLARED 1"
+.LASF3032:
+	.string	"ATOMIC_INT_LOCK_FREE __GCC_ATOMIC_INT_LOCK_FREE"
+.LASF1159:
+	.string	"_GCC_WCHAR_T "
+.LASF404:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF3216:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEE10_S_compareEmm"
+.LASF3284:
+	.string	"_S_copy"
+.LASF970:
+	.string	"_GLIBCXX_USE_DECIMAL_FLOAT 1"
+.LASF252:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1055:
+	.string	"__glibcxx_class_requires4(_a,_b,_c,_d,_e) "
+.LASF1595:
+	.string	"__wint_t_defined 1"
+.LASF2676:
+	.string	"_SC_V6_LPBIG_OFFBIG _SC_V6_LPBIG_OFFBIG"
+.LASF2828:
+	.string	"CLONE_PARENT 0x00008000"
+.LASF3691:
+	.string	"_ZSt28__throw_bad_array_new_lengthv"
+.LASF2430:
+	.string	"_POSIX_CPUTIME 0"
+.LASF334:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2483:
+	.string	"_PC_SYNC_IO _PC_SYNC_IO"
+.LASF3836:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEdeEv"
+.LASF1599:
+	.string	"____FILE_defined 1"
+.LASF642:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF698:
+	.string	"__stub_sigreturn "
+.LASF3713:
+	.string	"__relocate_a<long unsigned int*, long unsigned int*, std::allocator<long unsigned int> >"
+.LASF2699:
+	.string	"_SC_V7_ILP32_OFF32 _SC_V7_ILP32_OFF32"
+.LASF2939:
+	.string	"STA_NANO 0x2000"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF180:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2956:
+	.string	"PTHREAD_ADAPTIVE_MUTEX_INITIALIZER_NP { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_ADAPTIVE_NP) } }"
+.LASF2560:
+	.string	"_SC_PII_OSI_COTS _SC_PII_OSI_COTS"
+.LASF3992:
+	.string	"_flags"
+.LASF1690:
+	.string	"__LC_ADDRESS 9"
+.LASF1176:
+	.string	"__WCLONE 0x80000000"
+.LASF593:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF2103:
+	.string	"F_EXLCK 4"
+.LASF358:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF4051:
+	.string	"frac_digits"
+.LASF3842:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEixEl"
+.LASF3351:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5emptyEv"
+.LASF456:
+	.string	"_GLIBCXX_VISIBILITY(V) __attribute__ ((__visibility__ (#V)))"
+.LASF1334:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1777:
+	.string	"_____fpos_t_defined 1"
+.LASF2050:
+	.string	"__O_NOATIME 01000000"
+.LASF1645:
+	.string	"wcsspn"
+.LASF3025:
+	.string	"_GLIBCXX_ATOMIC_LOCK_FREE_H 1"
+.LASF3608:
+	.string	"_ZNKSt6vectorImSaImEE4cendEv"
+.LASF498:
+	.string	"_GLIBCXX_STD_A std"
+.LASF4197:
+	.string	"__this"
+.LASF851:
+	.string	"_GLIBCXX_HAVE_MEMORY_H 1"
+.LASF4134:
+	.string	"_ZN9simulator13result_readerC4ERKS0_"
+.LASF336:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1559:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF2725:
+	.string	"_CS_LFS_LINTFLAGS _CS_LFS_LINTFLAGS"
+.LASF1623:
+	.string	"ungetwc"
+.LASF3288:
+	.string	"_S_assign"
+.LASF3007:
+	.string	"___int_ptrdiff_t_h "
+.LASF2063:
+	.string	"O_CLOEXEC __O_CLOEXEC"
+.LASF1352:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF2682:
+	.string	"_SC_LEVEL1_ICACHE_SIZE _SC_LEVEL1_ICACHE_SIZE"
+.LASF4122:
+	.string	"mTimes"
+.LASF3878:
+	.string	"double"
+.LASF1158:
+	.string	"__INT_WCHAR_T_H "
+.LASF1999:
+	.string	"EHWPOISON 133"
+.LASF1033:
+	.string	"__cpp_lib_is_invocable 201703L"
+.LASF3801:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEE4baseEv"
+.LASF1950:
+	.string	"EILSEQ 84"
+.LASF1080:
+	.string	"__glibcxx_requires_partitioned_upper(_First,_Last,_Value) "
+.LASF2908:
+	.string	"ADJ_TAI 0x0080"
+.LASF3112:
+	.string	"_ZNKSt15__new_allocatorIcE7addressERKc"
+.LASF2686:
+	.string	"_SC_LEVEL1_DCACHE_ASSOC _SC_LEVEL1_DCACHE_ASSOC"
+.LASF988:
+	.string	"_GLIBCXX_USE_SC_NPROCESSORS_ONLN 1"
+.LASF612:
+	.string	"_SYS_CDEFS_H 1"
+.LASF3558:
+	.string	"~_Vector_base"
+.LASF1782:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF361:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1906:
+	.string	"ELOOP 40"
+.LASF1887:
+	.string	"EISDIR 21"
+.LASF2641:
+	.string	"_SC_FIFO _SC_FIFO"
+.LASF2629:
+	.string	"_SC_ADVISORY_INFO _SC_ADVISORY_INFO"
+.LASF810:
+	.string	"_GLIBCXX_HAVE_FLOAT_H 1"
+.LASF4002:
+	.string	"_IO_backup_base"
+.LASF628:
+	.string	"__BEGIN_DECLS extern \"C\" {"
+.LASF1911:
+	.string	"EL2NSYNC 45"
+.LASF505:
+	.string	"_GLIBCXX_END_NAMESPACE_LDBL "
+.LASF3791:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmmEi"
+.LASF159:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1141:
+	.string	"___int_size_t_h "
+.LASF1952:
+	.string	"ESTRPIPE 86"
+.LASF2975:
+	.string	"pthread_cleanup_push(routine,arg) do { __pthread_cleanup_class __clframe (routine, arg)"
+.LASF1483:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1064:
+	.string	"_PTR_TRAITS_H 1"
+.LASF921:
+	.string	"_GLIBCXX_HAVE_VSWSCANF 1"
+.LASF3790:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmmEv"
+.LASF304:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1405:
+	.string	"at_quick_exit"
+.LASF1961:
+	.string	"EOPNOTSUPP 95"
+.LASF3213:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE16find_last_not_ofEPKcmm"
+.LASF3988:
+	.string	"__mbstate_t"
+.LASF3833:
+	.string	"__normal_iterator<long unsigned int*, std::vector<long unsigned int, std::allocator<long unsigned int> > >"
+.LASF2973:
+	.string	"PTHREAD_ATTR_NO_SIGMASK_NP (-1)"
+.LASF1031:
+	.string	"_GLIBCXX_HAS_NESTED_TYPE(_NTYPE) template<typename _Tp, typename = __void_t<>> struct __has_ ##_NTYPE : false_type { }; template<typename _Tp> struct __has_ ##_NTYPE<_Tp, __void_t<typename _Tp::_NTYPE>> : true_type { };"
+.LASF2271:
+	.string	"MADV_REMOVE 9"
+.LASF257:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF3223:
+	.string	"const_void_pointer"
+.LASF833:
+	.string	"_GLIBCXX_HAVE_LIBINTL_H 1"
+.LASF2856:
+	.string	"__CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)"
+.LASF1883:
+	.string	"EEXIST 17"
+.LASF3983:
+	.string	"11__mbstate_t"
+.LASF836:
+	.string	"_GLIBCXX_HAVE_LIMIT_FSIZE 1"
+.LASF3684:
+	.string	"enable_if<true, long unsigned int*>"
+.LASF2747:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LDFLAGS _CS_POSIX_V6_ILP32_OFF32_LDFLAGS"
+.LASF2153:
+	.string	"_FALLOC_H_ "
+.LASF1411:
+	.string	"exit"
+.LASF2719:
+	.string	"_CS_POSIX_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS"
+.LASF4149:
+	.string	"fstat"
+.LASF1346:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF3329:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6rbeginEv"
+.LASF1716:
+	.string	"LC_TELEPHONE_MASK (1 << __LC_TELEPHONE)"
+.LASF4159:
+	.string	"__allocmax"
+.LASF226:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF3074:
+	.string	"char_type"
+.LASF3230:
+	.string	"basic_string<char, std::char_traits<char>, std::allocator<char> >"
+.LASF4154:
+	.string	"__last"
+.LASF411:
+	.string	"__x86_64__ 1"
+.LASF3737:
+	.string	"_Compare"
+.LASF2411:
+	.string	"_POSIX_THREAD_SAFE_FUNCTIONS 200809L"
+.LASF141:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF725:
+	.string	"_GLIBCXX_HAVE_BUILTIN_LAUNDER 1"
+.LASF986:
+	.string	"_GLIBCXX_USE_REALPATH 1"
+.LASF2743:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LDFLAGS _CS_XBS5_LPBIG_OFFBIG_LDFLAGS"
+.LASF799:
+	.string	"_GLIBCXX_HAVE_EXECINFO_H 1"
+.LASF2260:
+	.string	"MAP_HUGE_SHIFT 26"
+.LASF1964:
+	.string	"EADDRINUSE 98"
+.LASF2232:
+	.string	"F_TEST 3"
+.LASF541:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF3522:
+	.string	"_ZNSt16allocator_traitsISaImEE8allocateERS0_mPKv"
+.LASF814:
+	.string	"_GLIBCXX_HAVE_FMODL 1"
+.LASF492:
+	.string	"_GLIBCXX_INLINE_VERSION 0"
+.LASF4061:
+	.string	"int_n_sep_by_space"
+.LASF3059:
+	.string	"_ZNKSt17integral_constantIbLb1EEclEv"
+.LASF1743:
+	.string	"ispunct"
+.LASF2884:
+	.string	"CPU_ALLOC(count) __CPU_ALLOC (count)"
+.LASF281:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF349:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF3279:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE15_M_check_lengthEmmPKc"
+.LASF2361:
+	.string	"STATX_MNT_ID 0x00001000U"
+.LASF1507:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF2133:
+	.string	"FFSYNC O_FSYNC"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF345:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF3166:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5frontEv"
+.LASF1895:
+	.string	"ESPIPE 29"
+.LASF3740:
+	.string	"_Destroy<long unsigned int*, long unsigned int>"
+.LASF3749:
+	.string	"_ZSt5beginIKcLm8EEPT_RAT0__S1_"
+.LASF1204:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2833:
+	.string	"CLONE_PARENT_SETTID 0x00100000"
+.LASF2340:
+	.string	"__kernel_old_dev_t __kernel_old_dev_t"
+.LASF2168:
+	.string	"AT_STATX_SYNC_TYPE 0x6000"
+.LASF860:
+	.string	"_GLIBCXX_HAVE_POLL_H 1"
+.LASF1451:
+	.string	"_GLIBCXX_CSTDINT 1"
+.LASF2665:
+	.string	"_SC_2_PBS _SC_2_PBS"
+.LASF2478:
+	.string	"_PC_PATH_MAX _PC_PATH_MAX"
+.LASF1490:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1865:
+	.string	"_ASM_GENERIC_ERRNO_H "
+.LASF1458:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF214:
+	.string	"__FLT_DIG__ 6"
+.LASF1041:
+	.string	"_GLIBCXX_FORWARD(_Tp,__val) std::forward<_Tp>(__val)"
+.LASF1785:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF3241:
+	.string	"basic_string"
+.LASF188:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF3690:
+	.string	"_ZSt17__throw_bad_allocv"
+.LASF4077:
+	.string	"st_uid"
+.LASF469:
+	.string	"_GLIBCXX_NODISCARD [[__nodiscard__]]"
+.LASF1106:
+	.string	"_GLIBCXX_CSTDLIB 1"
+.LASF2084:
+	.string	"F_GETSIG __F_GETSIG"
+.LASF2791:
+	.string	"_USES_ALLOCATOR_H 1"
+.LASF1811:
+	.string	"stderr stderr"
+.LASF3994:
+	.string	"_IO_read_end"
+.LASF1272:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF3372:
+	.string	"push_back"
+.LASF3748:
+	.string	"begin<char const, 8>"
+.LASF2407:
+	.string	"_XOPEN_REALTIME_THREADS 1"
+.LASF1771:
+	.string	"_Cxx_hashtable_define_trivial_hash"
+.LASF1646:
+	.string	"wcsstr"
+.LASF745:
+	.string	"_PSTL_PRAGMA_DECLARE_SIMD _PSTL_PRAGMA(omp declare simd)"
+.LASF1304:
+	.string	"__off64_t_defined "
+.LASF1179:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF3580:
+	.string	"vector"
+.LASF4227:
+	.string	"_ZNSt12_Destroy_auxILb1EE9__destroyIPmEEvT_S3_"
+.LASF2164:
+	.string	"AT_REMOVEDIR 0x200"
+.LASF3890:
+	.string	"ldiv_t"
+.LASF2700:
+	.string	"_SC_V7_ILP32_OFFBIG _SC_V7_ILP32_OFFBIG"
+.LASF2285:
+	.string	"MADV_POPULATE_WRITE 23"
+.LASF1026:
+	.string	"__cpp_lib_is_null_pointer 201309L"
+.LASF1264:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF249:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF3651:
+	.string	"_ZNSt6vectorImSaImEE17_M_default_appendEm"
+.LASF3182:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareEmmS2_mm"
+.LASF1945:
+	.string	"ELIBACC 79"
+.LASF1329:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF3123:
+	.string	"__new_allocator<char>"
+.LASF911:
+	.string	"_GLIBCXX_HAVE_TGMATH_H 1"
+.LASF4001:
+	.string	"_IO_save_base"
+.LASF31:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1840:
+	.string	"printf"
+.LASF1956:
+	.string	"EMSGSIZE 90"
+.LASF1703:
+	.string	"LC_ADDRESS __LC_ADDRESS"
+.LASF1564:
+	.string	"memchr"
+.LASF1770:
+	.string	"_Cxx_hashtable_define_trivial_hash(_Tp) template<> struct hash<_Tp> : public __hash_base<size_t, _Tp> { size_t operator()(_Tp __val) const noexcept { return static_cast<size_t>(__val); } };"
+.LASF1207:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF820:
+	.string	"_GLIBCXX_HAVE_HYPOT 1"
+.LASF4177:
+	.string	"__old_start"
+.LASF2003:
+	.string	"_GLIBCXX_CERRNO 1"
+.LASF330:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1874:
+	.string	"ENOEXEC 8"
+.LASF3736:
+	.ascii	"__lowe"
+	.string	"r_bound<__gnu_cxx::__normal_iterator<long unsigned int const*, std::vector<long unsigned int> >, unsigned int, __gnu_cxx::__ops::_Iter_comp_val<simulator::result_reader::find_chunk(uint32_t, simulator::result_chunk&) const::<lambda(uint64_t, uint32_t)> > >"
+.LASF1503:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF3915:
+	.string	"__ino_t"
+.LASF2270:
+	.string	"MADV_FREE 8"
+.LASF2977:
+	.string	"pthread_cleanup_push_defer_np(routine,arg) do { __pthread_cleanup_class __clframe (routine, arg); __clframe.__defer ()"
+.LASF2753:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS"
+.LASF176:
+	.string	"__INT16_C(c) c"
+.LASF2693:
+	.string	"_SC_LEVEL3_CACHE_LINESIZE _SC_LEVEL3_CACHE_LINESIZE"
+.LASF2210:
+	.string	"S_ISUID __S_ISUID"
+.LASF172:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1332:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF3089:
+	.string	"assign"
+.LASF1155:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1553:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF2237:
+	.string	"MAP_EXECUTABLE 0x01000"
+.LASF2025:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_SHRINK"
+.LASF695:
+	.string	"__stub_gtty "
+.LASF1929:
+	.string	"ENOSR 63"
+.LASF2640:
+	.string	"_SC_FD_MGMT _SC_FD_MGMT"
+.LASF1100:
+	.string	"_STL_CONSTRUCT_H 1"
+.LASF1114:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1246:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1243:
+	.string	"__SWORD_TYPE long int"
+.LASF196:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF743:
+	.string	"_PSTL_GCC_VERSION (__GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__)"
+.LASF3082:
+	.string	"_ZNSt11char_traitsIcE6lengthEPKc"
+.LASF1062:
+	.string	"__glibcxx_requires_subscript(_N) "
+.LASF607:
+	.string	"__GNU_LIBRARY__"
+.LASF2559:
+	.string	"_SC_PII_INTERNET_DGRAM _SC_PII_INTERNET_DGRAM"
+.LASF2042:
+	.string	"O_NDELAY O_NONBLOCK"
+.LASF1281:
+	.string	"__TIMER_T_TYPE void *"
+.LASF4046:
+	.string	"mon_thousands_sep"
+.LASF1023:
+	.string	"__cpp_lib_integral_constant_callable 201304L"
+.LASF3322:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEcvSt17basic_string_viewIcS2_EEv"
+.LASF2696:
+	.string	"_SC_LEVEL4_CACHE_LINESIZE _SC_LEVEL4_CACHE_LINESIZE"
+.LASF3696:
+	.string	"__enable_if_t"
+.LASF3162:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEEixEm"
+.LASF3662:
+	.string	"_S_max_size"
+.LASF3618:
+	.string	"_ZNSt6vectorImSaImEE7reserveEm"
+.LASF4130:
+	.string	"get_chunk"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1441:
+	.string	"_PSTL_GLUE_ALGORITHM_DEFS_H "
+.LASF253:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2174:
+	.string	"__OPEN_NEEDS_MODE(oflag) (((oflag) & O_CREAT) != 0 || ((oflag) & __O_TMPFILE) == __O_TMPFILE)"
+.LASF3679:
+	.string	"difference_type"
+.LASF2545:
+	.string	"_SC_2_FORT_DEV _SC_2_FORT_DEV"
+.LASF2793:
+	.string	"_GLIBCXX_TUPLE 1"
+.LASF2265:
+	.string	"MADV_NORMAL 0"
+.LASF1302:
+	.string	"__uid_t_defined "
+.LASF3004:
+	.string	"__PTRDIFF_T "
+.LASF328:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1773:
+	.string	"_GLIBCXX_STRING_VIEW_TCC 1"
+.LASF518:
+	.string	"_GLIBCXX_OS_DEFINES 1"
+.LASF2215:
+	.string	"S_IXUSR __S_IEXEC"
+.LASF3250:
+	.string	"_M_length"
+.LASF267:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF4136:
+	.string	"mData"
+.LASF466:
+	.string	"_GLIBCXX20_DEPRECATED(MSG) "
+.LASF1630:
+	.string	"wcrtomb"
+.LASF405:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF302:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1376:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF2049:
+	.string	"__O_DIRECT 040000"
+.LASF3763:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE17_S_select_on_copyERKS1_"
+.LASF3014:
+	.string	"_GXX_NULLPTR_T "
+.LASF2089:
+	.string	"F_NOTIFY 1026"
+.LASF4213:
+	.string	"mapping"
+.LASF509:
+	.string	"_GLIBCXX_HAVE_IS_CONSTANT_EVALUATED 1"
+.LASF3307:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS4_mm"
+.LASF367:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF329:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1850:
+	.string	"sprintf"
+.LASF3204:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE12find_last_ofEPKcm"
+.LASF1867:
+	.string	"EPERM 1"
+.LASF2745:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LINTFLAGS _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS"
+.LASF238:
+	.string	"__DBL_MIN__ double(2.22507385850720138309023271733240406e-308L)"
+.LASF1020:
+	.string	"__glibcxx_max_exponent10"
+.LASF2992:
+	.string	"_SYS_SINGLE_THREADED_H "
+.LASF2031:
+	.string	"__iovec_defined 1"
+.LASF3222:
+	.string	"_ZNSt16allocator_traitsISaIcEE8allocateERS0_mPKv"
+.LASF1201:
+	.string	"__f128(x) x ##q"
+.LASF3091:
+	.string	"to_char_type"
+.LASF3105:
+	.string	"~__new_allocator"
+.LASF756:
+	.string	"_PSTL_EARLYEXIT_PRESENT (__INTEL_COMPILER >= 1800)"
+.LASF299:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1244:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF2544:
+	.string	"_SC_2_C_DEV _SC_2_C_DEV"
+.LASF1393:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF2807:
+	.string	"__GTHREADS 1"
+.LASF3043:
+	.string	"__cpp_lib_exchange_function 201304L"
+.LASF332:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1054:
+	.string	"__glibcxx_class_requires3(_a,_b,_c,_d) "
+.LASF2646:
+	.string	"_SC_MONOTONIC_CLOCK _SC_MONOTONIC_CLOCK"
+.LASF1297:
+	.string	"__ino64_t_defined "
+.LASF3999:
+	.string	"_IO_buf_base"
+.LASF932:
+	.string	"_GLIBCXX_PACKAGE_STRING \"package-unused version-unused\""
+.LASF2274:
+	.string	"MADV_MERGEABLE 12"
+.LASF2487:
+	.string	"_PC_FILESIZEBITS _PC_FILESIZEBITS"
+.LASF1758:
+	.string	"_GLIBCXX_MEM_FN_TRAITS(_REF,_LVAL,_RVAL) _GLIBCXX_MEM_FN_TRAITS2( , _REF, _LVAL, _RVAL) _GLIBCXX_MEM_FN_TRAITS2(const , _REF, _LVAL, _RVAL) _GLIBCXX_MEM_FN_TRAITS2(volatile , _REF, _LVAL, _RVAL) _GLIBCXX_MEM_FN_TRAITS2(const volatile, _REF, _LVAL, _RVAL)"
+.LASF2672:
+	.string	"_SC_2_PBS_CHECKPOINT _SC_2_PBS_CHECKPOINT"
+.LASF138:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF771:
+	.string	"_PSTL_ICC_18_OMP_SIMD_BROKEN (__INTEL_COMPILER == 1800)"
+.LASF1974:
+	.string	"ESHUTDOWN 108"
+.LASF754:
+	.string	"_PSTL_CPP14_INTEGER_SEQUENCE_PRESENT (_MSC_VER >= 1900 || __cplusplus >= 201402L)"
+.LASF2317:
+	.string	"S_TYPEISSHM(buf) __S_TYPEISSHM(buf)"
+.LASF2678:
+	.string	"_SC_TRACE _SC_TRACE"
+.LASF825:
+	.string	"_GLIBCXX_HAVE_ISINFF 1"
+.LASF4013:
+	.string	"_offset"
+.LASF1499:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF3897:
+	.string	"__uint16_t"
+.LASF1099:
+	.string	"_STL_TEMPBUF_H 1"
+.LASF1739:
+	.string	"isdigit"
+.LASF1834:
+	.string	"fsetpos"
+.LASF114:
+	.string	"__cpp_range_based_for 201603L"
+.LASF2591:
+	.string	"_SC_XOPEN_SHM _SC_XOPEN_SHM"
+.LASF2619:
+	.string	"_SC_NL_NMAX _SC_NL_NMAX"
+.LASF2121:
+	.string	"F_SEAL_SHRINK 0x0002"
+.LASF2595:
+	.string	"_SC_XOPEN_XPG2 _SC_XOPEN_XPG2"
+.LASF3847:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEE4baseEv"
+.LASF3233:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_Alloc_hiderC4EPcRKS3_"
+.LASF2624:
+	.string	"_SC_XBS5_LP64_OFF64 _SC_XBS5_LP64_OFF64"
+.LASF3232:
+	.string	"_ZNSaIcED4Ei"
+.LASF2509:
+	.string	"_SC_SYNCHRONIZED_IO _SC_SYNCHRONIZED_IO"
+.LASF430:
+	.string	"__linux 1"
+.LASF2334:
+	.string	"__struct_group_tag(TAG) "
+.LASF1861:
+	.string	"vsnprintf"
+.LASF1085:
+	.string	"__glibcxx_requires_string(_String) "
+.LASF259:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF2543:
+	.string	"_SC_2_C_BIND _SC_2_C_BIND"
+.LASF2970:
+	.string	"PTHREAD_CANCELED ((void *) -1)"
+.LASF3562:
+	.string	"_ZNSt12_Vector_baseImSaImEE11_M_allocateEm"
+.LASF511:
+	.string	"_GLIBCXX_VERBOSE_ASSERT 1"
+.LASF1307:
+	.string	"__ssize_t_defined "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF3071:
+	.string	"_ForwardIterator"
+.LASF1359:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1546:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1200:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1479:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF3225:
+	.string	"_ZNSt16allocator_traitsISaIcEE10deallocateERS0_Pcm"
+.LASF468:
+	.string	"_GLIBCXX_ABI_TAG_CXX11 __attribute ((__abi_tag__ (\"cxx11\")))"
+.LASF2037:
+	.string	"O_EXCL 0200"
+.LASF531:
+	.string	"__USE_UNIX98"
+.LASF2065:
+	.string	"O_NOATIME __O_NOATIME"
+.LASF2937:
+	.string	"STA_PPSERROR 0x0800"
+.LASF1830:
+	.string	"fread"
+.LASF1416:
+	.string	"malloc"
+.LASF961:
+	.string	"_GLIBCXX_USE_C99_COMPLEX_TR1 1"
+.LASF2597:
+	.string	"_SC_XOPEN_XPG4 _SC_XOPEN_XPG4"
+.LASF3221:
+	.string	"allocator_type"
+.LASF1831:
+	.string	"freopen"
+.LASF2520:
+	.string	"_SC_AIO_PRIO_DELTA_MAX _SC_AIO_PRIO_DELTA_MAX"
+.LASF2171:
+	.string	"AT_STATX_DONT_SYNC 0x4000"
+.LASF3479:
+	.string	"_M_get"
+.LASF3957:
+	.string	"uint64_t"
+.LASF472:
+	.string	"_GLIBCXX14_CONSTEXPR constexpr"
+.LASF2489:
+	.string	"_PC_REC_MAX_XFER_SIZE _PC_REC_MAX_XFER_SIZE"
+.LASF90:
+	.string	"__cpp_attributes 200809L"
+.LASF3264:
+	.string	"_M_dispose"
+.LASF1615:
+	.string	"mbrlen"
+.LASF2425:
+	.string	"_LFS64_ASYNCHRONOUS_IO 1"
+.LASF701:
+	.string	"_GLIBCXX_NO_OBSOLETE_ISINF_ISNAN_DYNAMIC __GLIBC_PREREQ(2,23)"
+.LASF2030:
+	.string	"F_SETLKW64 7"
+.LASF3889:
+	.string	"6ldiv_t"
+.LASF1565:
+	.string	"memcmp"
+.LASF3793:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEpLEl"
+.LASF644:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF3022:
+	.string	"__cpp_lib_enable_shared_from_this 201603L"
+.LASF1295:
+	.string	"__u_char_defined "
+.LASF4180:
+	.string	"__new_start"
+.LASF2932:
+	.string	"STA_UNSYNC 0x0040"
+.LASF481:
+	.string	"_GLIBCXX_NOTHROW _GLIBCXX_USE_NOEXCEPT"
+.LASF1660:
+	.string	"wscanf"
+.LASF2070:
+	.string	"F_DUPFD 0"
+.LASF550:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2116:
+	.string	"DN_DELETE 0x00000008"
+.LASF2958:
+	.string	"PTHREAD_RWLOCK_WRITER_NONRECURSIVE_INITIALIZER_NP { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP) } }"
+.LASF2799:
+	.string	"_TYPEINFO "
+.LASF3344:
+	.string	"capacity"
+.LASF1078:
+	.string	"__glibcxx_requires_sorted_set_pred(_First1,_Last1,_First2,_Pred) "
+.LASF2347:
+	.string	"__aligned_le64 __le64 __attribute__((aligned(8)))"
+.LASF4173:
+	.string	"__half"
+.LASF688:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1733:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF2007:
+	.string	"_GLIBCXX_STRING_CONSTEXPR"
+.LASF1462:
+	.string	"INT8_MIN (-128)"
+.LASF3187:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4findEcm"
+.LASF1569:
+	.string	"strcat"
+.LASF2510:
+	.string	"_SC_FSYNC _SC_FSYNC"
+.LASF2773:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LINTFLAGS _CS_POSIX_V7_LP64_OFF64_LINTFLAGS"
+.LASF708:
+	.string	"_GLIBCXX_TXN_SAFE "
+.LASF3955:
+	.string	"uint16_t"
+.LASF1505:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1628:
+	.string	"vwprintf"
+.LASF2002:
+	.string	"__error_t_defined 1"
+.LASF1077:
+	.string	"__glibcxx_requires_sorted_set(_First1,_Last1,_First2) "
+.LASF3494:
+	.string	"rethrow_exception"
+.LASF2229:
+	.string	"F_ULOCK 0"
+.LASF145:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF254:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2960:
+	.string	"PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED"
+.LASF308:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF578:
+	.string	"__USE_ISOC99 1"
+.LASF276:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF4144:
+	.string	"operator new"
+.LASF2863:
+	.string	"__sched_priority sched_priority"
+.LASF3731:
+	.string	"__niter_base<char const*>"
+.LASF4068:
+	.string	"_IO_marker"
+.LASF515:
+	.string	"_GLIBCXX_BEGIN_EXTERN_C extern \"C\" {"
+.LASF311:
+	.string	"__FLT128_DIG__ 33"
+.LASF941:
+	.string	"_GLIBCXX11_USE_C99_STDLIB 1"
+.LASF2189:
+	.string	"__S_IFLNK 0120000"
+.LASF1195:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF420:
+	.string	"__MMX__ 1"
+.LASF625:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2294:
+	.string	"MCL_FUTURE 2"
+.LASF3755:
+	.string	"_M_comp"
+.LASF3144:
+	.string	"cend"
+.LASF1259:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2945:
+	.string	"TIME_UTC 1"
+.LASF3545:
+	.string	"_M_get_Tp_allocator"
+.LASF2130:
+	.string	"RWH_WRITE_LIFE_LONG 4"
+.LASF2724:
+	.string	"_CS_LFS_LIBS _CS_LFS_LIBS"
+.LASF3849:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC4Ev"
+.LASF924:
+	.string	"_GLIBCXX_HAVE_WCSTOF 1"
+.LASF1169:
+	.string	"WUNTRACED 2"
+.LASF816:
+	.string	"_GLIBCXX_HAVE_FREXPL 1"
+.LASF316:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF3677:
+	.string	"iterator_traits<long unsigned int const*>"
+.LASF3648:
+	.string	"_M_fill_insert"
+.LASF4218:
+	.string	"_ZNSt12_Vector_baseImSaImEE12_Vector_implD2Ev"
+.LASF290:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF189:
+	.string	"__UINT32_C(c) c ## U"
+.LASF3537:
+	.string	"_M_swap_data"
+.LASF4189:
+	.string	"_ZNSaImED2Ev"
+.LASF2293:
+	.string	"MCL_CURRENT 1"
+.LASF1316:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF4119:
+	.string	"mSimulationId"
+.LASF2235:
+	.string	"MAP_GROWSDOWN 0x00100"
+.LASF406:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF587:
+	.string	"__USE_XOPEN 1"
+.LASF3347:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7reserveEm"
+.LASF1508:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1765:
+	.string	"_ALLOC_TRAITS_H 1"
+.LASF873:
+	.string	"_GLIBCXX_HAVE_SINHF 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF3146:
+	.string	"const_reverse_iterator"
+.LASF436:
+	.string	"_GNU_SOURCE 1"
+.LASF3348:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7reserveEv"
+.LASF1152:
+	.string	"_WCHAR_T_ "
+.LASF477:
+	.string	"_GLIBCXX_NOEXCEPT noexcept"
+.LASF3254:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_M_local_dataEv"
+.LASF2054:
+	.string	"F_GETLK F_GETLK64"
+.LASF1305:
+	.string	"__pid_t_defined "
+.LASF3866:
+	.string	"_ZN9__gnu_cxxmiIPKmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS9_SC_"
+.LASF2786:
+	.string	"__TYPES_H__ "
+.LASF3709:
+	.string	"_ZSt10__distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_St26random_access_iterator_tag"
+.LASF1540:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF3810:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEppEi"
+.LASF136:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF3371:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendESt16initializer_listIcE"
+.LASF394:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF617:
+	.string	"__LEAF , __leaf__"
+.LASF2809:
+	.string	"_PTHREAD_H 1"
+.LASF792:
+	.string	"_GLIBCXX_HAVE_COSL 1"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF3055:
+	.string	"integral_constant<bool, true>"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1484:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF169:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF3296:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_S_compareEmm"
+.LASF2348:
+	.string	"STATX_TYPE 0x00000001U"
+.LASF1566:
+	.string	"memcpy"
+.LASF2870:
+	.string	"CPU_SET_S(cpu,setsize,cpusetp) __CPU_SET_S (cpu, setsize, cpusetp)"
+.LASF3780:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEC4Ev"
+.LASF1250:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1423:
+	.string	"realloc"
+.LASF158:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF346:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF3053:
+	.string	"_ZNKSt17integral_constantIbLb0EEclEv"
+.LASF3718:
+	.string	"_ZSt3maxImERKT_S2_S2_"
+.LASF2128:
+	.string	"RWH_WRITE_LIFE_SHORT 2"
+.LASF3114:
+	.string	"allocate"
+.LASF107:
+	.string	"__cpp_unicode_characters 201411L"
+.LASF1059:
+	.string	"_GLIBCXX_DEBUG_ONLY(_Statement) "
+.LASF790:
+	.string	"_GLIBCXX_HAVE_COSHF 1"
+.LASF2074:
+	.string	"F_SETFL 4"
+.LASF558:
+	.string	"_ISOC2X_SOURCE"
+.LASF2176:
+	.string	"_BITS_STRUCT_STAT_H 1"
+.LASF3827:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaImEmE27_S_propagate_on_copy_assignEv"
+.LASF1631:
+	.string	"wcscat"
+.LASF4239:
+	.string	"_IO_lock_t"
+.LASF448:
+	.string	"_STL_ALGOBASE_H 1"
+.LASF660:
+	.string	"__always_inline"
+.LASF3812:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmmEi"
+.LASF3117:
+	.string	"deallocate"
+.LASF3042:
+	.string	"_STL_RELOPS_H 1"
+.LASF3914:
+	.string	"__gid_t"
+.LASF3993:
+	.string	"_IO_read_ptr"
+.LASF523:
+	.string	"__USE_ISOC95"
+.LASF3885:
+	.string	"__float128"
+.LASF522:
+	.string	"__USE_ISOC99"
+.LASF773:
+	.string	"_GLIBCXX_HAVE_ACOSL 1"
+.LASF123:
+	.string	"__cpp_structured_bindings 201606L"
+.LASF2329:
+	.string	"__ASM_X86_BITSPERLONG_H "
+.LASF2369:
+	.string	"STATX_ATTR_ENCRYPTED 0x00000800"
+.LASF1812:
+	.string	"RENAME_NOREPLACE (1 << 0)"
+.LASF2048:
+	.string	"__O_CLOEXEC 02000000"
+.LASF1296:
+	.string	"__ino_t_defined "
+.LASF3239:
+	.string	"_S_to_string_view"
+.LASF2718:
+	.string	"_CS_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS"
+.LASF3944:
+	.string	"parallel_unsequenced_policy"
+.LASF307:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF705:
+	.string	"_GLIBCXX_PSEUDO_VISIBILITY(V) "
+.LASF1012:
+	.string	"_GLIBCXX_INT_N_TRAITS"
+.LASF906:
+	.string	"_GLIBCXX_HAVE_S_ISREG 1"
+.LASF223:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF3449:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16find_last_not_ofEcm"
+.LASF3019:
+	.string	"_GLIBCXX_NESTED_EXCEPTION_H 1"
+.LASF3047:
+	.string	"_GLIBCXX_CSTDDEF 1"
+.LASF2709:
+	.string	"_SC_THREAD_ROBUST_PRIO_INHERIT _SC_THREAD_ROBUST_PRIO_INHERIT"
+.LASF1473:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2785:
+	.string	"CLOSE_RANGE_CLOEXEC (1U << 2)"
+.LASF2787:
+	.string	"_GLIBCXX_MEMORY 1"
+.LASF408:
+	.string	"__amd64 1"
+.LASF4007:
+	.string	"_flags2"
+.LASF685:
+	.string	"__HAVE_GENERIC_SELECTION 0"
+.LASF3566:
+	.string	"_ZNSt12_Vector_baseImSaImEE17_M_create_storageEm"
+.LASF1489:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF4096:
+	.string	"negative_binomial"
+.LASF1846:
+	.string	"rewind"
+.LASF1985:
+	.string	"ENAVAIL 119"
+.LASF1289:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1788:
+	.string	"_VA_LIST_DEFINED "
+.LASF2812:
+	.string	"SCHED_OTHER 0"
+.LASF3171:
+	.string	"remove_prefix"
+.LASF2823:
+	.string	"CLONE_FILES 0x00000400"
+.LASF2531:
+	.string	"_SC_TIMER_MAX _SC_TIMER_MAX"
+.LASF634:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF3650:
+	.string	"_M_default_append"
+.LASF3839:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEppEi"
+.LASF714:
+	.string	"_GLIBCXX_USE_C99_COMPLEX _GLIBCXX11_USE_C99_COMPLEX"
+.LASF1225:
+	.string	"__ldiv_t_defined 1"
+.LASF2831:
+	.string	"CLONE_SYSVSEM 0x00040000"
+.LASF4054:
+	.string	"n_cs_precedes"
+.LASF1338:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF4014:
+	.string	"_codecvt"
+.LASF3838:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEppEv"
+.LASF983:
+	.string	"_GLIBCXX_USE_PTHREAD_RWLOCK_CLOCKLOCK 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF2892:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF598:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1748:
+	.string	"toupper"
+.LASF3909:
+	.string	"__uint_least64_t"
+.LASF497:
+	.string	"_GLIBCXX_END_NAMESPACE_CONTAINER "
+.LASF2363:
+	.string	"STATX__RESERVED 0x80000000U"
+.LASF2546:
+	.string	"_SC_2_FORT_RUN _SC_2_FORT_RUN"
+.LASF619:
+	.string	"__THROW noexcept (true)"
+.LASF3492:
+	.string	"__cxa_exception_type"
+.LASF1049:
+	.string	"_STL_ITERATOR_BASE_FUNCS_H 1"
+.LASF3231:
+	.string	"_Alloc_hider"
+.LASF706:
+	.string	"_GLIBCXX_WEAK_DEFINITION "
+.LASF1120:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF3997:
+	.string	"_IO_write_ptr"
+.LASF3443:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17find_first_not_ofEPKcmm"
+.LASF3408:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_S8_S8_"
+.LASF1501:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF4200:
+	.string	"searchedId"
+.LASF2417:
+	.string	"_POSIX_THREAD_ROBUST_PRIO_INHERIT 200809L"
+.LASF1190:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF175:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF3485:
+	.string	"_ZNSt15__exception_ptr13exception_ptraSERKS0_"
+.LASF503:
+	.string	"_GLIBCXX_NAMESPACE_LDBL "
+.LASF40:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF372:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF3257:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE11_M_capacityEm"
+.LASF1926:
+	.string	"ENOSTR 60"
+.LASF859:
+	.string	"_GLIBCXX_HAVE_POLL 1"
+.LASF1052:
+	.string	"__glibcxx_class_requires(_a,_b) "
+.LASF2462:
+	.string	"__ILP32_OFF32_LDFLAGS \"-m32\""
+.LASF2367:
+	.string	"STATX_ATTR_APPEND 0x00000020"
+.LASF3046:
+	.string	"__RESULT_READER_H__ "
+.LASF3583:
+	.string	"_ZNSt6vectorImSaImEEC4EmRKS0_"
+.LASF485:
+	.string	"_GLIBCXX_EXTERN_TEMPLATE 1"
+.LASF3066:
+	.string	"random_access_iterator_tag"
+.LASF2752:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LIBS _CS_POSIX_V6_ILP32_OFFBIG_LIBS"
+.LASF2965:
+	.string	"PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }"
+.LASF1550:
+	.string	"UINTMAX_WIDTH 64"
+.LASF4233:
+	.string	"_ZNSt6vectorImSaImEE15_S_use_relocateEv"
+.LASF2075:
+	.string	"__F_SETOWN 8"
+.LASF3356:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5frontEv"
+.LASF1431:
+	.string	"_Exit"
+.LASF4094:
+	.string	"poisson"
+.LASF3544:
+	.string	"_Tp_alloc_type"
+.LASF2654:
+	.string	"_SC_SHELL _SC_SHELL"
+.LASF268:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1775:
+	.string	"_STRING_CONVERSIONS_H 1"
+.LASF1980:
+	.string	"EALREADY 114"
+.LASF2355:
+	.string	"STATX_CTIME 0x00000080U"
+.LASF3634:
+	.string	"_ZNSt6vectorImSaImEE6insertEN9__gnu_cxx17__normal_iteratorIPKmS1_EERS4_"
+.LASF1799:
+	.string	"P_tmpdir \"/tmp\""
+.LASF1044:
+	.string	"__cpp_lib_integer_sequence 201304L"
+.LASF3207:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE17find_first_not_ofEcm"
+.LASF621:
+	.string	"__NTH(fct) __LEAF_ATTR fct __THROW"
+.LASF1162:
+	.string	"_BSD_WCHAR_T_"
+.LASF3688:
+	.string	"__throw_bad_alloc"
+.LASF804:
+	.string	"_GLIBCXX_HAVE_FCNTL_H 1"
+.LASF1870:
+	.string	"EINTR 4"
+.LASF2684:
+	.string	"_SC_LEVEL1_ICACHE_LINESIZE _SC_LEVEL1_ICACHE_LINESIZE"
+.LASF1943:
+	.string	"EBADFD 77"
+.LASF2748:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LIBS _CS_POSIX_V6_ILP32_OFF32_LIBS"
+.LASF3607:
+	.string	"_ZNKSt6vectorImSaImEE6cbeginEv"
+.LASF137:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF703:
+	.string	"_GLIBCXX_GTHREAD_USE_WEAK 0"
+.LASF2556:
+	.string	"_SC_UIO_MAXIOV _SC_UIO_MAXIOV"
+.LASF1192:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF2496:
+	.string	"_SC_CHILD_MAX _SC_CHILD_MAX"
+.LASF417:
+	.string	"__k8 1"
+.LASF1118:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF2230:
+	.string	"F_LOCK 1"
+.LASF1294:
+	.string	"__STD_TYPE"
+.LASF1516:
+	.string	"INT64_C(c) c ## L"
+.LASF2638:
+	.string	"_SC_DEVICE_SPECIFIC _SC_DEVICE_SPECIFIC"
+.LASF2481:
+	.string	"_PC_NO_TRUNC _PC_NO_TRUNC"
+.LASF140:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF151:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF2674:
+	.string	"_SC_V6_ILP32_OFFBIG _SC_V6_ILP32_OFFBIG"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1873:
+	.string	"E2BIG 7"
+.LASF1214:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF4138:
+	.string	"mChunkOffsets"
+.LASF173:
+	.string	"__INT8_C(c) c"
+.LASF1191:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1146:
+	.string	"__wchar_t__ "
+.LASF3799:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmiEl"
+.LASF2935:
+	.string	"STA_PPSJITTER 0x0200"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1008:
+	.string	"__INT_N"
+.LASF601:
+	.string	"__USE_ATFILE 1"
+.LASF1667:
+	.string	"_GLIBCXX_CXX_ALLOCATOR_H 1"
+.LASF4199:
+	.string	"offset"
+.LASF3643:
+	.string	"_ZNSt6vectorImSaImEE18_M_fill_initializeEmRKm"
+.LASF125:
+	.string	"__cpp_guaranteed_copy_elision 201606L"
+.LASF2602:
+	.string	"_SC_INT_MIN _SC_INT_MIN"
+.LASF2349:
+	.string	"STATX_MODE 0x00000002U"
+.LASF2157:
+	.string	"FALLOC_FL_COLLAPSE_RANGE 0x08"
+.LASF3946:
+	.string	"_ZN6__pstl9execution2v127parallel_unsequenced_policy14__allow_vectorEv"
+.LASF975:
+	.string	"_GLIBCXX_USE_GET_NPROCS 1"
+.LASF1522:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1097:
+	.string	"_INITIALIZER_LIST "
+.LASF3508:
+	.string	"_ZNKSt15__new_allocatorImE7addressERKm"
+.LASF317:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF876:
+	.string	"_GLIBCXX_HAVE_SOCKATMARK 1"
+.LASF839:
+	.string	"_GLIBCXX_HAVE_LINK 1"
+.LASF3470:
+	.string	"string"
+.LASF2364:
+	.string	"STATX_ALL 0x00000fffU"
+.LASF798:
+	.string	"_GLIBCXX_HAVE_EXCEPTION_PTR_SINCE_GCC46 1"
+.LASF2181:
+	.string	"_STATBUF_ST_RDEV "
+.LASF1930:
+	.string	"ENONET 64"
+.LASF717:
+	.string	"_GLIBCXX_USE_C99_WCHAR _GLIBCXX11_USE_C99_WCHAR"
+.LASF2117:
+	.string	"DN_RENAME 0x00000010"
+.LASF4108:
+	.string	"rewire"
+.LASF1876:
+	.string	"ECHILD 10"
+.LASF649:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF4109:
+	.string	"degree"
+.LASF2011:
+	.string	"_GLIBCXX_USE_ASSIGN_FOR_INIT(T,U) __is_trivial(T) && __is_assignable(T&, U) && std::__check_constructible<T, U>()"
+.LASF447:
+	.string	"_GLIBCXX_ALGORITHM 1"
+.LASF3974:
+	.string	"intptr_t"
+.LASF4238:
+	.string	"decltype(nullptr)"
+.LASF1921:
+	.string	"ENOANO 55"
+.LASF22:
+	.string	"_LP64 1"
+.LASF2763:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LDFLAGS _CS_POSIX_V7_ILP32_OFF32_LDFLAGS"
+.LASF2980:
+	.string	"__GTHREAD_MUTEX_INIT PTHREAD_MUTEX_INITIALIZER"
+.LASF3462:
+	.string	"_ZNSt16initializer_listIcEC4EPKcm"
+.LASF4099:
+	.string	"degree_distribution_type"
+.LASF562:
+	.string	"_POSIX_C_SOURCE"
+.LASF3894:
+	.string	"__int8_t"
+.LASF852:
+	.string	"_GLIBCXX_HAVE_MODF 1"
+.LASF3427:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4findERKS4_m"
+.LASF2820:
+	.string	"CSIGNAL 0x000000ff"
+.LASF757:
+	.string	"_PSTL_MONOTONIC_PRESENT (__INTEL_COMPILER >= 1800)"
+.LASF4055:
+	.string	"n_sep_by_space"
+.LASF144:
+	.string	"__WINT_MIN__ 0U"
+.LASF277:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF730:
+	.string	"_PSTL_ASSERT_MSG(_Condition,_Message) __glibcxx_assert(_Condition)"
+.LASF566:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF536:
+	.string	"__USE_LARGEFILE"
+.LASF2299:
+	.string	"MFD_CLOEXEC 1U"
+.LASF3465:
+	.string	"_ZNKSt16initializer_listIcE5beginEv"
+.LASF3001:
+	.string	"_PTRDIFF_T "
+.LASF2182:
+	.string	"_STATBUF_ST_NSEC "
+.LASF676:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF2535:
+	.string	"_SC_BC_STRING_MAX _SC_BC_STRING_MAX"
+.LASF2303:
+	.string	"PKEY_DISABLE_ACCESS 0x1"
+.LASF740:
+	.string	"_PSTL_STRING_CONCAT(x,y) x #y"
+.LASF1827:
+	.string	"fprintf"
+.LASF398:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF4041:
+	.string	"thousands_sep"
+.LASF568:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF3236:
+	.string	"_M_local_buf"
+.LASF2984:
+	.string	"__GTHREAD_COND_INIT PTHREAD_COND_INITIALIZER"
+.LASF549:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF166:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF142:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1381:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF1198:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1037:
+	.string	"_MOVE_H 1"
+.LASF3555:
+	.string	"_ZNSt12_Vector_baseImSaImEEC4EOS0_"
+.LASF2656:
+	.string	"_SC_SPAWN _SC_SPAWN"
+.LASF2505:
+	.string	"_SC_PRIORITY_SCHEDULING _SC_PRIORITY_SCHEDULING"
+.LASF1075:
+	.string	"__glibcxx_requires_sorted(_First,_Last) "
+.LASF1092:
+	.string	"_GLIBCXX_MOVE3(_Tp,_Up,_Vp) std::move(_Tp, _Up, _Vp)"
+.LASF319:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF3732:
+	.string	"_ZSt12__niter_baseIPKcET_S2_"
+.LASF1632:
+	.string	"wcschr"
+.LASF2775:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS"
+.LASF2625:
+	.string	"_SC_XBS5_LPBIG_OFFBIG _SC_XBS5_LPBIG_OFFBIG"
+.LASF220:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1955:
+	.string	"EDESTADDRREQ 89"
+.LASF177:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF3689:
+	.string	"__throw_bad_array_new_length"
+.LASF1396:
+	.string	"_ALLOCA_H 1"
+.LASF3500:
+	.string	"memory_order_release"
+.LASF709:
+	.string	"_GLIBCXX_TXN_SAFE_DYN "
+.LASF1708:
+	.string	"LC_NUMERIC_MASK (1 << __LC_NUMERIC)"
+.LASF2212:
+	.string	"S_ISVTX __S_ISVTX"
+.LASF2917:
+	.string	"MOD_MAXERROR ADJ_MAXERROR"
+.LASF1778:
+	.string	"_____fpos64_t_defined 1"
+.LASF4158:
+	.string	"__diffmax"
+.LASF1619:
+	.string	"putwc"
+.LASF195:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF3594:
+	.string	"_ZNSt6vectorImSaImEEaSERKS1_"
+.LASF3109:
+	.string	"const_pointer"
+.LASF3663:
+	.string	"_ZNSt6vectorImSaImEE11_S_max_sizeERKS0_"
+.LASF1058:
+	.string	"_GLIBCXX_DEBUG_PEDASSERT(_Condition) "
+.LASF866:
+	.string	"_GLIBCXX_HAVE_READLINK 1"
+.LASF1196:
+	.string	"_BITS_FLOATN_H "
+.LASF1276:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF4168:
+	.string	"__comp"
+.LASF3554:
+	.string	"_ZNSt12_Vector_baseImSaImEEC4EOS1_"
+.LASF1371:
+	.string	"__fsblkcnt_t_defined "
+.LASF1889:
+	.string	"ENFILE 23"
+.LASF693:
+	.string	"__stub_chflags "
+.LASF2488:
+	.string	"_PC_REC_INCR_XFER_SIZE _PC_REC_INCR_XFER_SIZE"
+.LASF3389:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEN9__gnu_cxx17__normal_iteratorIPKcS4_EEc"
+.LASF1138:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1720:
+	.string	"LC_GLOBAL_LOCALE ((locale_t) -1L)"
+.LASF2764:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LIBS _CS_POSIX_V7_ILP32_OFF32_LIBS"
+.LASF3138:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEEaSERKS2_"
+.LASF2450:
+	.string	"_POSIX_TRACE -1"
+.LASF120:
+	.string	"__cpp_deduction_guides 201703L"
+.LASF457:
+	.string	"_GLIBCXX_USE_DEPRECATED 1"
+.LASF2511:
+	.string	"_SC_MAPPED_FILES _SC_MAPPED_FILES"
+.LASF2726:
+	.string	"_CS_LFS64_CFLAGS _CS_LFS64_CFLAGS"
+.LASF3345:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8capacityEv"
+.LASF3209:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE17find_first_not_ofEPKcm"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF2708:
+	.string	"_SC_XOPEN_STREAMS _SC_XOPEN_STREAMS"
+.LASF1084:
+	.string	"__glibcxx_requires_heap_pred(_First,_Last,_Pred) "
+.LASF426:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF3818:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEE4baseEv"
+.LASF4121:
+	.string	"result_chunk"
+.LASF3623:
+	.string	"_ZNSt6vectorImSaImEE2atEm"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF3587:
+	.string	"_ZNSt6vectorImSaImEEC4ERKS1_RKS0_"
+.LASF1602:
+	.string	"WEOF (0xffffffffu)"
+.LASF1869:
+	.string	"ESRCH 3"
+.LASF2055:
+	.string	"F_SETLK F_SETLK64"
+.LASF228:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2320:
+	.string	"S_IEXEC S_IXUSR"
+.LASF1858:
+	.string	"snprintf"
+.LASF3605:
+	.string	"_ZNSt6vectorImSaImEE4rendEv"
+.LASF3475:
+	.string	"_M_addref"
+.LASF1215:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF2727:
+	.string	"_CS_LFS64_LDFLAGS _CS_LFS64_LDFLAGS"
+.LASF1518:
+	.string	"UINT16_C(c) c"
+.LASF1374:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1358:
+	.string	"__NFDBITS"
+.LASF3403:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_RKS4_"
+.LASF3970:
+	.string	"uint_fast8_t"
+.LASF4012:
+	.string	"_lock"
+.LASF164:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF482:
+	.string	"_GLIBCXX_THROW_OR_ABORT(_EXC) (throw (_EXC))"
+.LASF1908:
+	.string	"ENOMSG 42"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1682:
+	.string	"__LC_NUMERIC 1"
+.LASF1303:
+	.string	"__off_t_defined "
+.LASF163:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF585:
+	.string	"__USE_XOPEN2K 1"
+.LASF2801:
+	.string	"__GXX_TYPEINFO_EQUALITY_INLINE 1"
+.LASF3940:
+	.string	"parallel_policy"
+.LASF3760:
+	.string	"_Iter_comp_iter"
+.LASF2756:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LIBS _CS_POSIX_V6_LP64_OFF64_LIBS"
+.LASF3958:
+	.string	"int_least8_t"
+.LASF3341:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6resizeEm"
+.LASF2393:
+	.string	"_BITS_POSIX_OPT_H 1"
+.LASF1425:
+	.string	"strtod"
+.LASF2098:
+	.string	"F_DUPFD_CLOEXEC 1030"
+.LASF1437:
+	.string	"strtof"
+.LASF3376:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignERKS4_mm"
+.LASF2874:
+	.string	"CPU_COUNT_S(setsize,cpusetp) __CPU_COUNT_S (setsize, cpusetp)"
+.LASF788:
+	.string	"_GLIBCXX_HAVE_COMPLEX_H 1"
+.LASF202:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1584:
+	.string	"strtok"
+.LASF1426:
+	.string	"strtol"
+.LASF3904:
+	.string	"__int_least16_t"
+.LASF1397:
+	.string	"alloca"
+.LASF3080:
+	.string	"_ZNSt11char_traitsIcE7compareEPKcS2_m"
+.LASF3570:
+	.string	"vector<long unsigned int, std::allocator<long unsigned int> >"
+.LASF3332:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6cbeginEv"
+.LASF1693:
+	.string	"__LC_IDENTIFICATION 12"
+.LASF260:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF3428:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4findEPKcm"
+.LASF4172:
+	.string	"_DistanceType"
+.LASF719:
+	.string	"_GLIBCXX_FLOAT_IS_IEEE_BINARY32 1"
+.LASF2337:
+	.string	"__FD_SETSIZE"
+.LASF1323:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF275:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF692:
+	.string	"__stub___compat_bdflush "
+.LASF3026:
+	.string	"ATOMIC_BOOL_LOCK_FREE __GCC_ATOMIC_BOOL_LOCK_FREE"
+.LASF1802:
+	.string	"TMP_MAX 238328"
+.LASF3058:
+	.string	"_ZNKSt17integral_constantIbLb1EEcvbEv"
+.LASF3972:
+	.string	"uint_fast32_t"
+.LASF3141:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5beginEv"
+.LASF3519:
+	.string	"_ZNSaImED4Ev"
+.LASF3471:
+	.string	"__exception_ptr"
+.LASF1652:
+	.string	"wcsxfrm"
+.LASF2445:
+	.string	"_POSIX_IPV6 200809L"
+.LASF2996:
+	.string	"_EXCEPTION_PTR_H "
+.LASF672:
+	.string	"__attribute_copy__"
+.LASF2261:
+	.string	"MAP_HUGE_MASK 0x3f"
+.LASF801:
+	.string	"_GLIBCXX_HAVE_EXPL 1"
+.LASF1197:
+	.string	"__HAVE_FLOAT128 1"
+.LASF3009:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2613:
+	.string	"_SC_UINT_MAX _SC_UINT_MAX"
+.LASF1713:
+	.string	"LC_PAPER_MASK (1 << __LC_PAPER)"
+.LASF3248:
+	.string	"_M_data"
+.LASF4131:
+	.string	"_ZNK9simulator13result_reader9get_chunkEm"
+.LASF1557:
+	.string	"_STRING_H 1"
+.LASF3145:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4cendEv"
+.LASF1986:
+	.string	"EISNAM 120"
+.LASF2188:
+	.string	"__S_IFIFO 0010000"
+.LASF2704:
+	.string	"_SC_TRACE_EVENT_NAME_MAX _SC_TRACE_EVENT_NAME_MAX"
+.LASF106:
+	.string	"__cpp_digit_separators 201309L"
+.LASF3665:
+	.string	"_ZNSt6vectorImSaImEE15_M_erase_at_endEPm"
+.LASF2422:
+	.string	"_POSIX_ASYNC_IO 1"
+.LASF3921:
+	.string	"__blksize_t"
+.LASF283:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF620:
+	.string	"__THROWNL __THROW"
+.LASF4000:
+	.string	"_IO_buf_end"
+.LASF2301:
+	.string	"MFD_HUGETLB 4U"
+.LASF3619:
+	.string	"_ZNSt6vectorImSaImEEixEm"
+.LASF287:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF3870:
+	.string	"short unsigned int"
+.LASF1781:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF279:
+	.string	"__FLT32_DIG__ 6"
+.LASF996:
+	.string	"_GLIBCXX_USE_WCHAR_T 1"
+.LASF393:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1661:
+	.string	"wcstold"
+.LASF3959:
+	.string	"int_least16_t"
+.LASF3063:
+	.string	"__swappable_with_details"
+.LASF2442:
+	.string	"_POSIX_MONOTONIC_CLOCK 0"
+.LASF1662:
+	.string	"wcstoll"
+.LASF1003:
+	.string	"__try try"
+.LASF1847:
+	.string	"scanf"
+.LASF3942:
+	.string	"_ZN6__pstl9execution2v115parallel_policy14__allow_vectorEv"
+.LASF1262:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1400:
+	.string	"_GLIBCXX_INCLUDE_NEXT_C_HEADERS"
+.LASF3208:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE17find_first_not_ofEPKcmm"
+.LASF1801:
+	.string	"L_tmpnam 20"
+.LASF2848:
+	.string	"__CPU_SETSIZE 1024"
+.LASF704:
+	.string	"_GLIBCXX_CPU_DEFINES 1"
+.LASF718:
+	.string	"_GLIBCXX_USE_FLOAT128 1"
+.LASF559:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1968:
+	.string	"ENETRESET 102"
+.LASF1644:
+	.string	"wcsrtombs"
+.LASF1457:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1433:
+	.string	"lldiv"
+.LASF2132:
+	.string	"FAPPEND O_APPEND"
+.LASF940:
+	.string	"_GLIBCXX11_USE_C99_STDIO 1"
+.LASF3039:
+	.string	"_BACKWARD_AUTO_PTR_H 1"
+.LASF449:
+	.string	"_GLIBCXX_CXX_CONFIG_H 1"
+.LASF3472:
+	.string	"exception_ptr"
+.LASF707:
+	.string	"_GLIBCXX_USE_WEAK_REF __GXX_WEAK__"
+.LASF2584:
+	.string	"_SC_ATEXIT_MAX _SC_ATEXIT_MAX"
+.LASF421:
+	.string	"__SSE__ 1"
+.LASF1633:
+	.string	"wcscmp"
+.LASF3896:
+	.string	"__int16_t"
+.LASF3953:
+	.string	"unseq"
+.LASF671:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1165:
+	.string	"NULL __null"
+.LASF1636:
+	.string	"wcscspn"
+.LASF4069:
+	.string	"_IO_codecvt"
+.LASF2375:
+	.string	"__statx_defined 1"
+.LASF867:
+	.string	"_GLIBCXX_HAVE_SECURE_GETENV 1"
+.LASF2761:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS"
+.LASF567:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF41:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF143:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF742:
+	.string	"_PSTL_HIDE_FROM_ABI_POP "
+.LASF3995:
+	.string	"_IO_read_base"
+.LASF418:
+	.string	"__k8__ 1"
+.LASF4164:
+	.string	"__len"
+.LASF2325:
+	.string	"_LINUX_STAT_H "
+.LASF3335:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5crendEv"
+.LASF419:
+	.string	"__code_model_small__ 1"
+.LASF402:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2400:
+	.string	"_POSIX_MEMLOCK 200809L"
+.LASF366:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF630:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF3631:
+	.string	"_ZNSt6vectorImSaImEE9push_backERKm"
+.LASF538:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1452:
+	.string	"__STDC_LIMIT_MACROS"
+.LASF1187:
+	.string	"__W_CONTINUED 0xffff"
+.LASF1269:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1344:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF1742:
+	.string	"isprint"
+.LASF1464:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1472:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF3466:
+	.string	"_ZNKSt16initializer_listIcE3endEv"
+.LASF3358:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4backEv"
+.LASF2821:
+	.string	"CLONE_VM 0x00000100"
+.LASF2712:
+	.string	"_SC_SIGSTKSZ _SC_SIGSTKSZ"
+.LASF108:
+	.string	"__cpp_static_assert 201411L"
+.LASF507:
+	.string	"_GLIBCXX_BEGIN_NAMESPACE_LDBL_OR_CXX11 _GLIBCXX_BEGIN_NAMESPACE_CXX11"
+.LASF2759:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS"
+.LASF399:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1925:
+	.string	"EBFONT 59"
+.LASF2058:
+	.string	"F_OFD_SETLK 37"
+.LASF1051:
+	.string	"__glibcxx_function_requires(...) "
+.LASF1469:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF1588:
+	.string	"_MEMORYFWD_H 1"
+.LASF2940:
+	.string	"STA_MODE 0x4000"
+.LASF2419:
+	.string	"_POSIX_SEMAPHORES 200809L"
+.LASF2068:
+	.string	"O_DSYNC __O_DSYNC"
+.LASF347:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF197:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF2033:
+	.string	"O_RDONLY 00"
+.LASF3602:
+	.string	"_ZNKSt6vectorImSaImEE3endEv"
+.LASF2864:
+	.string	"CPU_SETSIZE __CPU_SETSIZE"
+.LASF1612:
+	.string	"fwscanf"
+.LASF2679:
+	.string	"_SC_TRACE_EVENT_FILTER _SC_TRACE_EVENT_FILTER"
+.LASF2738:
+	.string	"_CS_XBS5_LP64_OFF64_CFLAGS _CS_XBS5_LP64_OFF64_CFLAGS"
+.LASF2710:
+	.string	"_SC_THREAD_ROBUST_PRIO_PROTECT _SC_THREAD_ROBUST_PRIO_PROTECT"
+.LASF3984:
+	.string	"__wch"
+.LASF2983:
+	.string	"__GTHREAD_RECURSIVE_MUTEX_INIT PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP"
+.LASF2316:
+	.string	"S_TYPEISSEM(buf) __S_TYPEISSEM(buf)"
+.LASF3658:
+	.string	"_M_check_len"
+.LASF2187:
+	.string	"__S_IFREG 0100000"
+.LASF295:
+	.string	"__FLT64_DIG__ 15"
+.LASF3800:
+	.string	"base"
+.LASF2148:
+	.string	"SYNC_FILE_RANGE_WRITE_AND_WAIT (SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WAIT_AFTER)"
+.LASF2534:
+	.string	"_SC_BC_SCALE_MAX _SC_BC_SCALE_MAX"
+.LASF2353:
+	.string	"STATX_ATIME 0x00000020U"
+.LASF3110:
+	.string	"address"
+.LASF3286:
+	.string	"_S_move"
+.LASF2800:
+	.string	"__GXX_MERGED_TYPEINFO_NAMES 0"
+.LASF2228:
+	.string	"F_OK 0"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2780:
+	.string	"_GETOPT_POSIX_H 1"
+.LASF560:
+	.string	"_POSIX_SOURCE"
+.LASF4056:
+	.string	"p_sign_posn"
+.LASF3331:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4rendEv"
+.LASF3954:
+	.string	"uint8_t"
+.LASF1589:
+	.string	"_CHAR_TRAITS_H 1"
+.LASF1360:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1205:
+	.string	"__HAVE_FLOAT32 1"
+.LASF712:
+	.string	"__N(msgid) (msgid)"
+.LASF1390:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF2952:
+	.string	"PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED"
+.LASF2437:
+	.string	"_POSIX_SPAWN 200809L"
+.LASF2461:
+	.string	"__ILP32_OFF32_CFLAGS \"-m32\""
+.LASF2887:
+	.string	"_BITS_TIME_H 1"
+.LASF818:
+	.string	"_GLIBCXX_HAVE_GETIPINFO 1"
+.LASF865:
+	.string	"_GLIBCXX_HAVE_QUICK_EXIT 1"
+.LASF3990:
+	.string	"__FILE"
+.LASF2994:
+	.string	"__EXCEPTION__ "
+.LASF3911:
+	.string	"__uintmax_t"
+.LASF3407:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_PcSA_"
+.LASF877:
+	.string	"_GLIBCXX_HAVE_SQRTF 1"
+.LASF2585:
+	.string	"_SC_PASS_MAX _SC_PASS_MAX"
+.LASF3078:
+	.string	"compare"
+.LASF357:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF3369:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendEPKc"
+.LASF920:
+	.string	"_GLIBCXX_HAVE_VFWSCANF 1"
+.LASF3418:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4copyEPcmm"
+.LASF2418:
+	.string	"_POSIX_THREAD_ROBUST_PRIO_PROTECT -1"
+.LASF1794:
+	.string	"SEEK_SET 0"
+.LASF2335:
+	.string	"__struct_group(TAG,NAME,ATTRS,MEMBERS...) union { struct { MEMBERS } ATTRS; struct __struct_group_tag(TAG) { MEMBERS } ATTRS NAME; } ATTRS"
+.LASF1460:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1279:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2300:
+	.string	"MFD_ALLOW_SEALING 2U"
+.LASF4101:
+	.string	"piecewise_constant"
+.LASF1635:
+	.string	"wcscpy"
+.LASF3987:
+	.string	"__value"
+.LASF3384:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEmRKS4_"
+.LASF720:
+	.string	"_GLIBCXX_DOUBLE_IS_IEEE_BINARY64 1"
+.LASF1987:
+	.string	"EREMOTEIO 121"
+.LASF471:
+	.string	"_GLIBCXX_USE_CONSTEXPR constexpr"
+.LASF2036:
+	.string	"O_CREAT 0100"
+.LASF4011:
+	.string	"_shortbuf"
+.LASF993:
+	.string	"_GLIBCXX_USE_UCHAR_C8RTOMB_MBRTOC8_FCHAR8_T 1"
+.LASF2306:
+	.string	"_SYS_STAT_H 1"
+.LASF1263:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF454:
+	.string	"_GLIBCXX_NORETURN __attribute__ ((__noreturn__))"
+.LASF3473:
+	.string	"_M_exception_object"
+.LASF1481:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF3172:
+	.string	"remove_suffix"
+.LASF192:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2803:
+	.string	"_ALIGNED_BUFFER_H 1"
+.LASF34:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF2604:
+	.string	"_SC_WORD_BIT _SC_WORD_BIT"
+.LASF1653:
+	.string	"wctob"
+.LASF1223:
+	.string	"__CFLOAT32X _Complex double"
+.LASF3573:
+	.string	"_ZNSt6vectorImSaImEE19_S_nothrow_relocateESt17integral_constantIbLb0EE"
+.LASF746:
+	.string	"_PSTL_PRAGMA_SIMD_REDUCTION(PRM) _PSTL_PRAGMA(omp simd reduction(PRM))"
+.LASF1467:
+	.string	"INT16_MAX (32767)"
+.LASF1442:
+	.string	"_PSTL_EXECUTION_POLICY_DEFS_H "
+.LASF525:
+	.string	"__USE_POSIX"
+.LASF3549:
+	.string	"_Vector_base"
+.LASF98:
+	.string	"__cpp_ref_qualifiers 200710L"
+.LASF759:
+	.string	"_PSTL_UDS_PRESENT (__INTEL_COMPILER >= 1900 && __INTEL_COMPILER_BUILD_DATE >= 20180626)"
+.LASF2240:
+	.string	"MAP_POPULATE 0x08000"
+.LASF1822:
+	.string	"fflush"
+.LASF2057:
+	.string	"F_OFD_GETLK 36"
+.LASF2279:
+	.string	"MADV_DODUMP 17"
+.LASF912:
+	.string	"_GLIBCXX_HAVE_TIMESPEC_GET 1"
+.LASF1549:
+	.string	"INTMAX_WIDTH 64"
+.LASF3495:
+	.string	"_ZSt17rethrow_exceptionNSt15__exception_ptr13exception_ptrE"
+.LASF3194:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5rfindEPKcm"
+.LASF2099:
+	.string	"FD_CLOEXEC 1"
+.LASF1056:
+	.string	"_GLIBCXX_DEBUG_ASSERTIONS_H 1"
+.LASF1754:
+	.string	"_BACKWARD_BINDERS_H 1"
+.LASF2782:
+	.string	"TEMP_FAILURE_RETRY(expression) (__extension__ ({ long int __result; do __result = (long int) (expression); while (__result == -1L && errno == EINTR); __result; }))"
+.LASF4187:
+	.string	"_ZNSt6vectorImSaImEED2Ev"
+.LASF3512:
+	.string	"_ZNKSt15__new_allocatorImE11_M_max_sizeEv"
+.LASF2634:
+	.string	"_SC_CLOCK_SELECTION _SC_CLOCK_SELECTION"
+.LASF3879:
+	.string	"float"
+.LASF1936:
+	.string	"ECOMM 70"
+.LASF1715:
+	.string	"LC_ADDRESS_MASK (1 << __LC_ADDRESS)"
+.LASF3511:
+	.string	"_ZNKSt15__new_allocatorImE8max_sizeEv"
+.LASF3998:
+	.string	"_IO_write_end"
+.LASF3309:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4EPKcmRKS3_"
+.LASF3711:
+	.string	"_ZSt19__iterator_categoryIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E17iterator_categoryERKS9_"
+.LASF2703:
+	.string	"_SC_SS_REPL_MAX _SC_SS_REPL_MAX"
+.LASF3390:
+	.string	"__const_iterator"
+.LASF1249:
+	.string	"__STD_TYPE typedef"
+.LASF3986:
+	.string	"__count"
+.LASF3869:
+	.string	"unsigned char"
+.LASF2262:
+	.string	"MS_ASYNC 1"
+.LASF2579:
+	.string	"_SC_THREAD_PROCESS_SHARED _SC_THREAD_PROCESS_SHARED"
+.LASF322:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF2648:
+	.string	"_SC_SINGLE_PROCESS _SC_SINGLE_PROCESS"
+.LASF1373:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF532:
+	.string	"__USE_XOPEN2K"
+.LASF4093:
+	.string	"uniform"
+.LASF1547:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1333:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF2915:
+	.string	"MOD_OFFSET ADJ_OFFSET"
+.LASF1839:
+	.string	"perror"
+.LASF3174:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEE13remove_suffixEm"
+.LASF2064:
+	.string	"O_DIRECT __O_DIRECT"
+.LASF4080:
+	.string	"st_rdev"
+.LASF2837:
+	.string	"CLONE_CHILD_SETTID 0x01000000"
+.LASF4211:
+	.string	"fileStatus"
+.LASF2577:
+	.string	"_SC_THREAD_PRIO_INHERIT _SC_THREAD_PRIO_INHERIT"
+.LASF2587:
+	.string	"_SC_XOPEN_XCU_VERSION _SC_XOPEN_XCU_VERSION"
+.LASF960:
+	.string	"_GLIBCXX_USE_C99 1"
+.LASF1642:
+	.string	"wcspbrk"
+.LASF422:
+	.string	"__SSE2__ 1"
+.LASF1920:
+	.string	"EXFULL 54"
+.LASF1060:
+	.string	"__glibcxx_requires_non_empty_range(_First,_Last) "
+.LASF520:
+	.string	"_FEATURES_H 1"
+.LASF514:
+	.string	"_GLIBCXX_SYNCHRONIZATION_HAPPENS_AFTER(A) "
+.LASF606:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2424:
+	.string	"_POSIX_PRIORITIZED_IO 200809L"
+.LASF2549:
+	.string	"_SC_PII _SC_PII"
+.LASF1309:
+	.string	"__key_t_defined "
+.LASF184:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF190:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF679:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF263:
+	.string	"__FLT16_DIG__ 3"
+.LASF3505:
+	.string	"_ZNSt15__new_allocatorImEC4ERKS0_"
+.LASF1527:
+	.string	"INT32_WIDTH 32"
+.LASF794:
+	.string	"_GLIBCXX_HAVE_DIRENT_H 1"
+.LASF4059:
+	.string	"int_p_sep_by_space"
+.LASF3496:
+	.string	"type_info"
+.LASF998:
+	.string	"_GLIBCXX_X86_RDRAND 1"
+.LASF3825:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaImEmE17_S_select_on_copyERKS1_"
+.LASF973:
+	.string	"_GLIBCXX_USE_FCHMODAT 1"
+.LASF842:
+	.string	"_GLIBCXX_HAVE_LINUX_RANDOM_H 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1843:
+	.string	"puts"
+.LASF1103:
+	.string	"__cpp_lib_launder 201606L"
+.LASF3741:
+	.string	"_ZSt8_DestroyIPmmEvT_S1_RSaIT0_E"
+.LASF2044:
+	.string	"O_FSYNC O_SYNC"
+.LASF2538:
+	.string	"_SC_EXPR_NEST_MAX _SC_EXPR_NEST_MAX"
+.LASF1820:
+	.string	"feof"
+.LASF3203:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE12find_last_ofEPKcmm"
+.LASF1124:
+	.string	"__need_size_t "
+.LASF1845:
+	.string	"rename"
+.LASF3815:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEplEl"
+.LASF4043:
+	.string	"int_curr_symbol"
+.LASF1617:
+	.string	"mbsinit"
+.LASF1061:
+	.string	"__glibcxx_requires_nonempty() "
+.LASF3306:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS4_mRKS3_"
+.LASF1918:
+	.string	"EBADE 52"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1123:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF2950:
+	.string	"PTHREAD_STACK_MIN __sysconf (__SC_THREAD_STACK_MIN_VALUE)"
+.LASF1621:
+	.string	"swprintf"
+.LASF3673:
+	.string	"__type_identity_t"
+.LASF2233:
+	.string	"_SYS_MMAN_H 1"
+.LASF4196:
+	.string	"~<lambda>"
+.LASF3196:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE13find_first_ofES2_m"
+.LASF1268:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF3228:
+	.string	"_ZNSt16allocator_traitsISaIcEE37select_on_container_copy_constructionERKS0_"
+.LASF1019:
+	.string	"__glibcxx_digits10"
+.LASF340:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF556:
+	.string	"_ISOC11_SOURCE"
+.LASF1544:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF4123:
+	.string	"mDegrees"
+.LASF2163:
+	.string	"AT_SYMLINK_NOFOLLOW 0x100"
+.LASF3033:
+	.string	"ATOMIC_LONG_LOCK_FREE __GCC_ATOMIC_LONG_LOCK_FREE"
+.LASF844:
+	.string	"_GLIBCXX_HAVE_LOCALE_H 1"
+.LASF2872:
+	.string	"CPU_ISSET_S(cpu,setsize,cpusetp) __CPU_ISSET_S (cpu, setsize, cpusetp)"
+.LASF3357:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5frontEv"
+.LASF2664:
+	.string	"_SC_USER_GROUPS_R _SC_USER_GROUPS_R"
+.LASF829:
+	.string	"_GLIBCXX_HAVE_ISWBLANK 1"
+.LASF3245:
+	.string	"_M_sv"
+.LASF1658:
+	.string	"wmemset"
+.LASF3702:
+	.string	"_ZSt8__memcmpIccEiPKT_PKT0_m"
+.LASF3913:
+	.string	"__uid_t"
+.LASF1495:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF919:
+	.string	"_GLIBCXX_HAVE_UTIME_H 1"
+.LASF2213:
+	.string	"S_IRUSR __S_IREAD"
+.LASF1515:
+	.string	"INT32_C(c) c"
+.LASF1637:
+	.string	"wcsftime"
+.LASF1160:
+	.string	"_WCHAR_T_DECLARED "
+.LASF3604:
+	.string	"_ZNKSt6vectorImSaImEE6rbeginEv"
+.LASF2644:
+	.string	"_SC_FILE_LOCKING _SC_FILE_LOCKING"
+.LASF443:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF552:
+	.string	"_ISOC95_SOURCE"
+.LASF563:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1432:
+	.string	"llabs"
+.LASF4137:
+	.string	"mSize"
+.LASF2736:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LIBS _CS_XBS5_ILP32_OFFBIG_LIBS"
+.LASF979:
+	.string	"_GLIBCXX_USE_NANOSLEEP 1"
+.LASF4086:
+	.string	"st_ctim"
+.LASF1594:
+	.string	"__GNUC_VA_LIST "
+.LASF4067:
+	.string	"__fpos_t"
+.LASF1175:
+	.string	"__WALL 0x40000000"
+.LASF3524:
+	.string	"_ZNSt16allocator_traitsISaImEE8max_sizeERKS0_"
+.LASF657:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF3012:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF3139:
+	.string	"const_iterator"
+.LASF3859:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEplEl"
+.LASF1456:
+	.string	"_STDINT_H 1"
+.LASF1725:
+	.string	"_GLIBCXX_NUM_CATEGORIES 6"
+.LASF1511:
+	.string	"WINT_MIN (0u)"
+.LASF2191:
+	.string	"__S_TYPEISMQ(buf) ((buf)->st_mode - (buf)->st_mode)"
+.LASF1722:
+	.string	"setlocale"
+.LASF2096:
+	.string	"F_GET_FILE_RW_HINT 1037"
+.LASF809:
+	.string	"_GLIBCXX_HAVE_FINITEL 1"
+.LASF553:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1746:
+	.string	"isxdigit"
+.LASF2459:
+	.string	"_POSIX_V6_LP64_OFF64 1"
+.LASF1414:
+	.string	"labs"
+.LASF4169:
+	.string	"__simple"
+.LASF3835:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC4ERKS1_"
+.LASF403:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1818:
+	.string	"clearerr"
+.LASF2464:
+	.string	"__ILP32_OFFBIG_LDFLAGS \"-m32\""
+.LASF1651:
+	.string	"wcstoul"
+.LASF1004:
+	.string	"__catch(X) catch(X)"
+.LASF3644:
+	.string	"_M_default_initialize"
+.LASF1676:
+	.string	"__allocator_base"
+.LASF2561:
+	.string	"_SC_PII_OSI_CLTS _SC_PII_OSI_CLTS"
+.LASF1277:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2552:
+	.string	"_SC_PII_INTERNET _SC_PII_INTERNET"
+.LASF805:
+	.string	"_GLIBCXX_HAVE_FDOPENDIR 1"
+.LASF972:
+	.string	"_GLIBCXX_USE_FCHMOD 1"
+.LASF4019:
+	.string	"_mode"
+.LASF3363:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEpLEc"
+.LASF565:
+	.string	"_XOPEN_SOURCE 700"
+.LASF3140:
+	.string	"begin"
+.LASF2805:
+	.string	"_GLIBCXX_GCC_GTHR_H "
+.LASF1133:
+	.string	"__SIZE_T "
+.LASF3553:
+	.string	"_ZNSt12_Vector_baseImSaImEEC4EmRKS0_"
+.LASF1354:
+	.string	"____sigset_t_defined "
+.LASF3797:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmIEl"
+.LASF555:
+	.string	"_ISOC99_SOURCE 1"
+.LASF1982:
+	.string	"ESTALE 116"
+.LASF1903:
+	.string	"ENOLCK 37"
+.LASF3575:
+	.string	"_S_do_relocate"
+.LASF204:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF3568:
+	.string	"type"
+.LASF2161:
+	.string	"MAX_HANDLE_SZ 128"
+.LASF3016:
+	.string	"_GLIBCXX_HAVE_CDTOR_CALLABI 0"
+.LASF1761:
+	.string	"_GLIBCXX_RANGE_ACCESS_H 1"
+.LASF1571:
+	.string	"strcmp"
+.LASF949:
+	.string	"_GLIBCXX_FULLY_DYNAMIC_STRING 0"
+.LASF1627:
+	.string	"vswscanf"
+.LASF734:
+	.string	"_PSTL_VERSION_MINOR ((_PSTL_VERSION % 1000) / 10)"
+.LASF3918:
+	.string	"__off_t"
+.LASF1482:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF3282:
+	.string	"_M_disjunct"
+.LASF694:
+	.string	"__stub_fchflags "
+.LASF2890:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF4176:
+	.string	"__position"
+.LASF462:
+	.string	"_GLIBCXX14_DEPRECATED _GLIBCXX_DEPRECATED"
+.LASF3378:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignEPKc"
+.LASF2152:
+	.string	"SPLICE_F_GIFT 8"
+.LASF392:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1613:
+	.string	"getwc"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF2184:
+	.string	"__S_IFDIR 0040000"
+.LASF1844:
+	.string	"remove"
+.LASF848:
+	.string	"_GLIBCXX_HAVE_LOGL 1"
+.LASF3157:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE6lengthEv"
+.LASF4205:
+	.string	"chunkData"
+.LASF2307:
+	.string	"__S_ISTYPE(mode,mask) (((mode) & __S_IFMT) == (mask))"
+.LASF4191:
+	.string	"simulationId"
+.LASF1902:
+	.string	"ENAMETOOLONG 36"
+.LASF3365:
+	.string	"append"
+.LASF3612:
+	.string	"_ZNKSt6vectorImSaImEE8max_sizeEv"
+.LASF2599:
+	.string	"_SC_CHAR_MAX _SC_CHAR_MAX"
+.LASF2114:
+	.string	"DN_MODIFY 0x00000002"
+.LASF3397:
+	.string	"replace"
+.LASF2583:
+	.string	"_SC_AVPHYS_PAGES _SC_AVPHYS_PAGES"
+.LASF2423:
+	.string	"_LFS_ASYNCHRONOUS_IO 1"
+.LASF4186:
+	.string	"__arr"
+.LASF3507:
+	.string	"_ZNKSt15__new_allocatorImE7addressERm"
+.LASF594:
+	.string	"__USE_LARGEFILE 1"
+.LASF1274:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF3410:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_S9_S9_"
+.LASF30:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF29:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF217:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF2771:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LDFLAGS _CS_POSIX_V7_LP64_OFF64_LDFLAGS"
+.LASF1327:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF262:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF212:
+	.string	"__FLT_RADIX__ 2"
+.LASF2617:
+	.string	"_SC_NL_LANGMAX _SC_NL_LANGMAX"
+.LASF872:
+	.string	"_GLIBCXX_HAVE_SINF 1"
+.LASF1011:
+	.ascii	"_GLIBCXX_INT_N_TRAITS(T,WIDTH) __extension__ template<> stru"
+	.ascii	"ct __is_int"
+	.string	"eger_nonstrict<T> { enum { __value = 1 }; typedef std::__true_type __type; enum { __width = WIDTH }; }; __extension__ template<> struct __is_integer_nonstrict<unsigned T> { enum { __value = 1 }; typedef std::__true_type __type; enum { __width = WIDTH }; };"
+.LASF1029:
+	.string	"__cpp_lib_result_of_sfinae 201210L"
+.LASF3943:
+	.string	"_ZN6__pstl9execution2v115parallel_policy16__allow_parallelEv"
+.LASF194:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF490:
+	.string	"_GLIBCXX_END_NAMESPACE_CXX11 }"
+.LASF2953:
+	.string	"PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }"
+.LASF3036:
+	.string	"_GLIBCXX20_INIT(I) "
+.LASF2898:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF2865:
+	.string	"CPU_SET(cpu,cpusetp) __CPU_SET_S (cpu, sizeof (cpu_set_t), cpusetp)"
+.LASF2910:
+	.string	"ADJ_MICRO 0x1000"
+.LASF3415:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_M_replaceEmmPKcm"
+.LASF3636:
+	.string	"_ZNSt6vectorImSaImEE6insertEN9__gnu_cxx17__normal_iteratorIPKmS1_EESt16initializer_listImE"
+.LASF3412:
+	.string	"_M_replace_aux"
+.LASF806:
+	.string	"_GLIBCXX_HAVE_FENV_H 1"
+.LASF170:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1941:
+	.string	"EOVERFLOW 75"
+.LASF661:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1626:
+	.string	"vswprintf"
+.LASF2989:
+	.string	"_GLIBCXX_ATOMIC_WORD_H 1"
+.LASF2447:
+	.string	"_POSIX2_CHAR_TERM 200809L"
+.LASF1135:
+	.string	"_BSD_SIZE_T_ "
+.LASF1240:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF2339:
+	.string	"__kernel_old_uid_t __kernel_old_uid_t"
+.LASF1053:
+	.string	"__glibcxx_class_requires2(_a,_b,_c) "
+.LASF1688:
+	.string	"__LC_PAPER 7"
+.LASF4112:
+	.string	"resultFileVersion"
+.LASF2690:
+	.string	"_SC_LEVEL2_CACHE_LINESIZE _SC_LEVEL2_CACHE_LINESIZE"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF2923:
+	.string	"MOD_TAI ADJ_TAI"
+.LASF857:
+	.string	"_GLIBCXX_HAVE_NETINET_TCP_H 1"
+.LASF1764:
+	.string	"_EXT_ALLOC_TRAITS_H 1"
+.LASF1212:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1412:
+	.string	"free"
+.LASF2607:
+	.string	"_SC_SSIZE_MAX _SC_SSIZE_MAX"
+.LASF2490:
+	.string	"_PC_REC_MIN_XFER_SIZE _PC_REC_MIN_XFER_SIZE"
+.LASF4192:
+	.string	"chunk"
+.LASF2427:
+	.string	"_LFS64_LARGEFILE 1"
+.LASF244:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF3591:
+	.string	"_ZNSt6vectorImSaImEEC4ESt16initializer_listImERKS0_"
+.LASF3349:
+	.string	"clear"
+.LASF1324:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF2603:
+	.string	"_SC_LONG_BIT _SC_LONG_BIT"
+.LASF1227:
+	.string	"RAND_MAX 2147483647"
+.LASF3811:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmmEv"
+.LASF455:
+	.string	"_GLIBCXX_HAVE_ATTRIBUTE_VISIBILITY 1"
+.LASF3456:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareEmmPKcm"
+.LASF3762:
+	.string	"_S_select_on_copy"
+.LASF1267:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF510:
+	.string	"__glibcxx_constexpr_assert(cond) if (std::__is_constant_evaluated() && !bool(cond)) __builtin_unreachable()"
+.LASF3622:
+	.string	"_ZNKSt6vectorImSaImEE14_M_range_checkEm"
+.LASF1419:
+	.string	"mbtowc"
+.LASF3183:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareEPKc"
+.LASF3609:
+	.string	"_ZNKSt6vectorImSaImEE7crbeginEv"
+.LASF2413:
+	.string	"_POSIX_THREAD_ATTR_STACKSIZE 200809L"
+.LASF248:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1927:
+	.string	"ENODATA 61"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2201:
+	.string	"UTIME_OMIT ((1l << 30) - 2l)"
+.LASF1171:
+	.string	"WEXITED 4"
+.LASF3404:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_S8_m"
+.LASF285:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF495:
+	.string	"_GLIBCXX_STD_C std"
+.LASF3540:
+	.string	"_ZNSt12_Vector_baseImSaImEE12_Vector_implC4ERKS0_"
+.LASF1057:
+	.string	"_GLIBCXX_DEBUG_ASSERT(_Condition) "
+.LASF2469:
+	.string	"STDERR_FILENO 2"
+.LASF3979:
+	.string	"fp_offset"
+.LASF1696:
+	.string	"LC_TIME __LC_TIME"
+.LASF3323:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5beginEv"
+.LASF942:
+	.string	"_GLIBCXX11_USE_C99_WCHAR 1"
+.LASF1745:
+	.string	"isupper"
+.LASF3308:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS4_mmRKS3_"
+.LASF3899:
+	.string	"__uint32_t"
+.LASF823:
+	.string	"_GLIBCXX_HAVE_ICONV 1"
+.LASF83:
+	.string	"__cpp_binary_literals 201304L"
+.LASF4234:
+	.string	"_ZN9__gnu_cxx3divExx"
+.LASF3743:
+	.string	"_FIter"
+.LASF3044:
+	.string	"__cpp_lib_as_const 201510L"
+.LASF1014:
+	.string	"__glibcxx_max_digits10(_Tp) (2 + __glibcxx_floating(_Tp, __FLT_MANT_DIG__, __DBL_MANT_DIG__, __LDBL_MANT_DIG__) * 643L / 2136)"
+.LASF2947:
+	.string	"_BITS_SETJMP_H 1"
+.LASF1434:
+	.string	"atoll"
+.LASF544:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF464:
+	.string	"_GLIBCXX17_DEPRECATED [[__deprecated__]]"
+.LASF1730:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF3098:
+	.string	"not_eof"
+.LASF1824:
+	.string	"fgetpos"
+.LASF331:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF359:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF2632:
+	.string	"_SC_C_LANG_SUPPORT _SC_C_LANG_SUPPORT"
+.LASF2966:
+	.string	"PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE"
+.LASF2568:
+	.string	"_SC_LOGIN_NAME_MAX _SC_LOGIN_NAME_MAX"
+.LASF2378:
+	.string	"__POSIX2_THIS_VERSION 200809L"
+.LASF3121:
+	.string	"_M_max_size"
+.LASF435:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF3251:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_lengthEm"
+.LASF1590:
+	.string	"_GLIBCXX_POSTYPES_H 1"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF2770:
+	.string	"_CS_POSIX_V7_LP64_OFF64_CFLAGS _CS_POSIX_V7_LP64_OFF64_CFLAGS"
+.LASF2344:
+	.string	"__aligned_u64 __u64 __attribute__((aligned(8)))"
+.LASF3854:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEi"
+.LASF2705:
+	.string	"_SC_TRACE_NAME_MAX _SC_TRACE_NAME_MAX"
+.LASF231:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF3853:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEppEv"
+.LASF1492:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF545:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1543:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF1756:
+	.string	"_GLIBCXX_INVOKE_H 1"
+.LASF4083:
+	.string	"st_blocks"
+.LASF786:
+	.string	"_GLIBCXX_HAVE_CEILF 1"
+.LASF3040:
+	.string	"_PSTL_GLUE_MEMORY_DEFS_H "
+.LASF3720:
+	.string	"_ZSt7advanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEElEvRT_T0_"
+.LASF3336:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4sizeEv"
+.LASF4015:
+	.string	"_wide_data"
+.LASF2134:
+	.string	"FASYNC O_ASYNC"
+.LASF667:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1156:
+	.string	"_WCHAR_T_H "
+.LASF1934:
+	.string	"EADV 68"
+.LASF3947:
+	.string	"_ZN6__pstl9execution2v127parallel_unsequenced_policy16__allow_parallelEv"
+.LASF3840:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEmmEv"
+.LASF150:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1098:
+	.string	"_STL_HEAP_H 1"
+.LASF3672:
+	.string	"_ZNSt6vectorImSaImEE17_M_realloc_insertIJRKmEEEvN9__gnu_cxx17__normal_iteratorIPmS1_EEDpOT_"
+.LASF324:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF2981:
+	.string	"__GTHREAD_MUTEX_INIT_FUNCTION __gthread_mutex_init_function"
+.LASF1823:
+	.string	"fgetc"
+.LASF3202:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE12find_last_ofEcm"
+.LASF576:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF1292:
+	.string	"_BITS_TIME64_H 1"
+.LASF3321:
+	.string	"operator std::__cxx11::basic_string<char>::__sv_type"
+.LASF4206:
+	.string	"times"
+.LASF918:
+	.string	"_GLIBCXX_HAVE_USELOCALE 1"
+.LASF4178:
+	.string	"__old_finish"
+.LASF3268:
+	.string	"_M_construct"
+.LASF3106:
+	.string	"_ZNSt15__new_allocatorIcED4Ev"
+.LASF1403:
+	.string	"aligned_alloc"
+.LASF1898:
+	.string	"EPIPE 32"
+.LASF3976:
+	.string	"intmax_t"
+.LASF1825:
+	.string	"fgets"
+.LASF4146:
+	.string	"madvise"
+.LASF2266:
+	.string	"MADV_RANDOM 1"
+.LASF1524:
+	.string	"UINT8_WIDTH 8"
+.LASF1757:
+	.ascii	"_GLIBCXX_MEM_FN_TRAITS2(_CV,_REF,_LVAL,_RVAL) template<typen"
+	.ascii	"ame _Res, typename _Class, typename... _ArgTypes> struct _Me"
+	.ascii	"m_fn_traits<_Res (_Class::*)(_ArgTypes...) _CV _REF> : _Mem_"
+	.ascii	"fn_traits_base<_Res, _CV _Class, _ArgTypes"
+	.string	"...> { using __vararg = false_type; }; template<typename _Res, typename _Class, typename... _ArgTypes> struct _Mem_fn_traits<_Res (_Class::*)(_ArgTypes... ...) _CV _REF> : _Mem_fn_traits_base<_Res, _CV _Class, _ArgTypes...> { using __vararg = true_type; };"
+.LASF3429:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4findEcm"
+.LASF913:
+	.string	"_GLIBCXX_HAVE_TLS 1"
+.LASF3379:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignEmc"
+.LASF3552:
+	.string	"_ZNSt12_Vector_baseImSaImEEC4Em"
+.LASF470:
+	.string	"_GLIBCXX_CONSTEXPR constexpr"
+.LASF3829:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaImEmE20_S_propagate_on_swapEv"
+.LASF152:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF811:
+	.string	"_GLIBCXX_HAVE_FLOORF 1"
+.LASF1502:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF3489:
+	.string	"_ZNSt15__exception_ptr13exception_ptr4swapERS0_"
+.LASF2010:
+	.string	"_STL_UNINITIALIZED_H 1"
+.LASF3550:
+	.string	"_ZNSt12_Vector_baseImSaImEEC4Ev"
+.LASF1946:
+	.string	"ELIBBAD 80"
+.LASF2721:
+	.string	"_CS_POSIX_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS"
+.LASF3189:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4findEPKcm"
+.LASF2203:
+	.string	"S_IFDIR __S_IFDIR"
+.LASF750:
+	.string	"_PSTL_PRAGMA_SIMD_EXCLUSIVE_SCAN(PRM) "
+.LASF2647:
+	.string	"_SC_MULTI_PROCESS _SC_MULTI_PROCESS"
+.LASF3806:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEC4ERKS2_"
+.LASF3441:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12find_last_ofEcm"
+.LASF3649:
+	.string	"_ZNSt6vectorImSaImEE14_M_fill_insertEN9__gnu_cxx17__normal_iteratorIPmS1_EEmRKm"
+.LASF303:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF3318:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEaSEc"
+.LASF3560:
+	.string	"_M_impl"
+.LASF2053:
+	.string	"__O_TMPFILE (020000000 | __O_DIRECTORY)"
+.LASF1110:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1878:
+	.string	"ENOMEM 12"
+.LASF3669:
+	.string	"_ZNSt6vectorImSaImEE14_M_move_assignEOS1_St17integral_constantIbLb1EE"
+.LASF2115:
+	.string	"DN_CREATE 0x00000004"
+.LASF206:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF2059:
+	.string	"F_OFD_SETLKW 38"
+.LASF3597:
+	.string	"_ZNSt6vectorImSaImEE6assignEmRKm"
+.LASF410:
+	.string	"__x86_64 1"
+.LASF807:
+	.string	"_GLIBCXX_HAVE_FINITE 1"
+.LASF3178:
+	.string	"substr"
+.LASF1310:
+	.string	"__clock_t_defined 1"
+.LASF702:
+	.string	"_GLIBCXX_NATIVE_THREAD_ID pthread_self()"
+.LASF2671:
+	.string	"_SC_STREAMS _SC_STREAMS"
+.LASF512:
+	.string	"__glibcxx_assert(cond) do { __glibcxx_constexpr_assert(cond); } while (false)"
+.LASF2695:
+	.string	"_SC_LEVEL4_CACHE_ASSOC _SC_LEVEL4_CACHE_ASSOC"
+.LASF407:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1710:
+	.string	"LC_COLLATE_MASK (1 << __LC_COLLATE)"
+.LASF2131:
+	.string	"RWH_WRITE_LIFE_EXTREME 5"
+.LASF2473:
+	.string	"L_XTND SEEK_END"
+.LASF2441:
+	.string	"_POSIX_THREAD_PROCESS_SHARED 200809L"
+.LASF2522:
+	.string	"_SC_MQ_OPEN_MAX _SC_MQ_OPEN_MAX"
+.LASF1562:
+	.string	"__CORRECT_ISO_CPP_STRINGS_H_PROTO "
+.LASF1235:
+	.string	"__S16_TYPE short int"
+.LASF2282:
+	.string	"MADV_COLD 20"
+.LASF580:
+	.string	"__USE_ISOCXX11 1"
+.LASF4106:
+	.string	"multi_edge_handling"
+.LASF2498:
+	.string	"_SC_NGROUPS_MAX _SC_NGROUPS_MAX"
+.LASF4049:
+	.string	"negative_sign"
+.LASF3003:
+	.string	"_T_PTRDIFF "
+.LASF1673:
+	.string	"_GLIBCXX_OPERATOR_DELETE"
+.LASF3593:
+	.string	"_ZNSt6vectorImSaImEED4Ev"
+.LASF218:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1488:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF899:
+	.string	"_GLIBCXX_HAVE_SYS_SOCKET_H 1"
+.LASF2979:
+	.string	"__GTHREAD_HAS_COND 1"
+.LASF1705:
+	.string	"LC_MEASUREMENT __LC_MEASUREMENT"
+.LASF948:
+	.string	"_GLIBCXX_ATOMIC_BUILTINS 1"
+.LASF1139:
+	.string	"_SIZE_T_DECLARED "
+.LASF3933:
+	.string	"sequenced_policy"
+.LASF3697:
+	.string	"__relocate_a_1<long unsigned int, long unsigned int>"
+.LASF3339:
+	.string	"resize"
+.LASF4008:
+	.string	"_old_offset"
+.LASF2729:
+	.string	"_CS_LFS64_LINTFLAGS _CS_LFS64_LINTFLAGS"
+.LASF2402:
+	.string	"_POSIX_MEMORY_PROTECTION 200809L"
+.LASF2384:
+	.string	"_POSIX2_LOCALEDEF __POSIX2_THIS_VERSION"
+.LASF1413:
+	.string	"getenv"
+.LASF1127:
+	.string	"__size_t__ "
+.LASF2734:
+	.string	"_CS_XBS5_ILP32_OFFBIG_CFLAGS _CS_XBS5_ILP32_OFFBIG_CFLAGS"
+.LASF1510:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1313:
+	.string	"__timer_t_defined 1"
+.LASF1618:
+	.string	"mbsrtowcs"
+.LASF3175:
+	.string	"swap"
+.LASF1330:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF967:
+	.string	"_GLIBCXX_USE_C99_STDINT_TR1 1"
+.LASF636:
+	.string	"__flexarr []"
+.LASF779:
+	.string	"_GLIBCXX_HAVE_AS_SYMVER_DIRECTIVE 1"
+.LASF4064:
+	.string	"_G_fpos_t"
+.LASF1497:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2862:
+	.string	"sched_priority sched_priority"
+.LASF1805:
+	.string	"L_cuserid 9"
+.LASF1641:
+	.string	"wcsncpy"
+.LASF1859:
+	.string	"vfscanf"
+.LASF3917:
+	.string	"__nlink_t"
+.LASF4113:
+	.string	"result_file_header"
+.LASF2202:
+	.string	"S_IFMT __S_IFMT"
+.LASF1486:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF3654:
+	.string	"_M_insert_rval"
+.LASF4139:
+	.string	"get_result_chunk_size"
+.LASF4066:
+	.string	"__state"
+.LASF2209:
+	.string	"S_IFSOCK __S_IFSOCK"
+.LASF3021:
+	.string	"__cpp_lib_shared_ptr_weak_type 201606L"
+.LASF3291:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_S_copy_charsEPcN9__gnu_cxx17__normal_iteratorIS5_S4_EES8_"
+.LASF2573:
+	.string	"_SC_THREAD_THREADS_MAX _SC_THREAD_THREADS_MAX"
+.LASF1791:
+	.string	"_IONBF 2"
+.LASF933:
+	.string	"_GLIBCXX_PACKAGE_TARNAME \"libstdc++\""
+.LASF3934:
+	.string	"__allow_unsequenced"
+.LASF3126:
+	.string	"_ZNSaIcEC4Ev"
+.LASF3965:
+	.string	"uint_least64_t"
+.LASF1273:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF4183:
+	.string	"_ZNSt15__new_allocatorImED2Ev"
+.LASF3077:
+	.string	"_ZNSt11char_traitsIcE2ltERKcS2_"
+.LASF2035:
+	.string	"O_RDWR 02"
+.LASF3436:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13find_first_ofEPKcm"
+.LASF1290:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF3785:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEptEv"
+.LASF1913:
+	.string	"EL3RST 47"
+.LASF2480:
+	.string	"_PC_CHOWN_RESTRICTED _PC_CHOWN_RESTRICTED"
+.LASF826:
+	.string	"_GLIBCXX_HAVE_ISINFL 1"
+.LASF229:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF3883:
+	.string	"__gnu_debug"
+.LASF2109:
+	.string	"LOCK_MAND 32"
+.LASF203:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF3304:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS3_"
+.LASF2683:
+	.string	"_SC_LEVEL1_ICACHE_ASSOC _SC_LEVEL1_ICACHE_ASSOC"
+.LASF3430:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5rfindERKS4_m"
+.LASF2158:
+	.string	"FALLOC_FL_ZERO_RANGE 0x10"
+.LASF3297:
+	.string	"_M_assign"
+.LASF2216:
+	.string	"S_IRWXU (__S_IREAD|__S_IWRITE|__S_IEXEC)"
+.LASF4174:
+	.string	"__middle"
+.LASF3405:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_S8_"
+.LASF3246:
+	.string	"_M_dataplus"
+.LASF2769:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS"
+.LASF4078:
+	.string	"st_gid"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2149:
+	.string	"SPLICE_F_MOVE 1"
+.LASF2850:
+	.string	"__CPUELT(cpu) ((cpu) / __NCPUBITS)"
+.LASF186:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF3515:
+	.string	"allocator<long unsigned int>"
+.LASF1088:
+	.string	"__glibcxx_requires_irreflexive2(_First,_Last) "
+.LASF2354:
+	.string	"STATX_MTIME 0x00000040U"
+.LASF1666:
+	.string	"_ALLOCATOR_H 1"
+.LASF3000:
+	.string	"_ANSI_STDDEF_H "
+.LASF3630:
+	.string	"_ZNKSt6vectorImSaImEE4dataEv"
+.LASF1283:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF473:
+	.string	"_GLIBCXX17_CONSTEXPR constexpr"
+.LASF1086:
+	.string	"__glibcxx_requires_string_len(_String,_Len) "
+.LASF4124:
+	.string	"result_reader"
+.LASF2259:
+	.string	"MAP_ANON MAP_ANONYMOUS"
+.LASF2614:
+	.string	"_SC_ULONG_MAX _SC_ULONG_MAX"
+.LASF3400:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEmmPKcm"
+.LASF4003:
+	.string	"_IO_save_end"
+.LASF589:
+	.string	"__USE_UNIX98 1"
+.LASF2818:
+	.string	"SCHED_DEADLINE 6"
+.LASF3686:
+	.string	"__iterator_traits<__gnu_cxx::__normal_iterator<long unsigned int const*, std::vector<long unsigned int, std::allocator<long unsigned int> > >, void>"
+.LASF3353:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEixEm"
+.LASF2737:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LINTFLAGS _CS_XBS5_ILP32_OFFBIG_LINTFLAGS"
+.LASF3051:
+	.string	"operator()"
+.LASF3167:
+	.string	"back"
+.LASF439:
+	.string	"DBG 1"
+.LASF3173:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEE13remove_prefixEm"
+.LASF3305:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS4_"
+.LASF3613:
+	.string	"_ZNSt6vectorImSaImEE6resizeEm"
+.LASF3828:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaImEmE27_S_propagate_on_move_assignEv"
+.LASF1526:
+	.string	"UINT16_WIDTH 16"
+.LASF2136:
+	.string	"FNDELAY O_NDELAY"
+.LASF1530:
+	.string	"UINT64_WIDTH 64"
+.LASF1707:
+	.string	"LC_CTYPE_MASK (1 << __LC_CTYPE)"
+.LASF1093:
+	.string	"_GLIBCXX_MOVE_BACKWARD3(_Tp,_Up,_Vp) std::move_backward(_Tp, _Up, _Vp)"
+.LASF3542:
+	.string	"_ZNSt12_Vector_baseImSaImEE12_Vector_implC4EOS0_"
+.LASF2541:
+	.string	"_SC_CHARCLASS_NAME_MAX _SC_CHARCLASS_NAME_MAX"
+.LASF2066:
+	.string	"O_PATH __O_PATH"
+.LASF2982:
+	.string	"__GTHREAD_ONCE_INIT PTHREAD_ONCE_INIT"
+.LASF1737:
+	.string	"isalpha"
+.LASF2757:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LINTFLAGS _CS_POSIX_V6_LP64_OFF64_LINTFLAGS"
+.LASF1552:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF904:
+	.string	"_GLIBCXX_HAVE_SYS_TYPES_H 1"
+.LASF735:
+	.string	"_PSTL_VERSION_PATCH (_PSTL_VERSION % 10)"
+.LASF89:
+	.string	"__cpp_decltype 200707L"
+.LASF3027:
+	.string	"ATOMIC_CHAR_LOCK_FREE __GCC_ATOMIC_CHAR_LOCK_FREE"
+.LASF2636:
+	.string	"_SC_THREAD_CPUTIME _SC_THREAD_CPUTIME"
+.LASF209:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1042:
+	.string	"_GLIBCXX_UTILITY_H 1"
+.LASF154:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF765:
+	.string	"_PSTL_USE_NONTEMPORAL_STORES_IF_ALLOWED "
+.LASF2744:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LIBS _CS_XBS5_LPBIG_OFFBIG_LIBS"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1027:
+	.string	"__cpp_lib_is_final 201402L"
+.LASF1216:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 0"
+.LASF1912:
+	.string	"EL3HLT 46"
+.LASF2518:
+	.string	"_SC_AIO_LISTIO_MAX _SC_AIO_LISTIO_MAX"
+.LASF1006:
+	.string	"_CPP_TYPE_TRAITS_H 1"
+.LASF2503:
+	.string	"_SC_SAVED_IDS _SC_SAVED_IDS"
+.LASF1206:
+	.string	"__HAVE_FLOAT64 1"
+.LASF819:
+	.string	"_GLIBCXX_HAVE_GETS 1"
+.LASF339:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF651:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF4117:
+	.string	"mDegreeSize"
+.LASF1971:
+	.string	"ENOBUFS 105"
+.LASF1959:
+	.string	"EPROTONOSUPPORT 93"
+.LASF1074:
+	.string	"__glibcxx_requires_can_decrement_range(_First1,_Last1,_First2) "
+.LASF554:
+	.string	"_ISOC99_SOURCE"
+.LASF2312:
+	.string	"S_ISFIFO(mode) __S_ISTYPE((mode), __S_IFIFO)"
+.LASF2901:
+	.string	"_BITS_TIMEX_H 1"
+.LASF4142:
+	.string	"operator delete"
+.LASF288:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF3104:
+	.string	"_ZNSt15__new_allocatorIcEC4ERKS0_"
+.LASF3676:
+	.string	"reverse_iterator<__gnu_cxx::__normal_iterator<long unsigned int const*, std::vector<long unsigned int, std::allocator<long unsigned int> > > >"
+.LASF1404:
+	.string	"atexit"
+.LASF3107:
+	.string	"pointer"
+.LASF2225:
+	.string	"R_OK 4"
+.LASF1136:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF4214:
+	.string	"header"
+.LASF3814:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEpLEl"
+.LASF1039:
+	.string	"_GLIBCXX_FWDREF(_Tp) _Tp&&"
+.LASF2519:
+	.string	"_SC_AIO_MAX _SC_AIO_MAX"
+.LASF1395:
+	.string	"__have_pthread_attr_t 1"
+.LASF326:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1081:
+	.string	"__glibcxx_requires_partitioned_lower_pred(_First,_Last,_Value,_Pred) "
+.LASF2997:
+	.string	"_CXXABI_INIT_EXCEPTION_H 1"
+.LASF390:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1450:
+	.string	"__ASSERT_FUNCTION __extension__ __PRETTY_FUNCTION__"
+.LASF3667:
+	.string	"_ZNSt6vectorImSaImEE8_M_eraseEN9__gnu_cxx17__normal_iteratorIPmS1_EES5_"
+.LASF907:
+	.string	"_GLIBCXX_HAVE_TANF 1"
+.LASF526:
+	.string	"__USE_POSIX2"
+.LASF2616:
+	.string	"_SC_NL_ARGMAX _SC_NL_ARGMAX"
+.LASF782:
+	.string	"_GLIBCXX_HAVE_ATANF 1"
+.LASF2888:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF4190:
+	.string	"_ZNSt12_Vector_baseImSaImEE12_Vector_implC2Ev"
+.LASF1875:
+	.string	"EBADF 9"
+.LASF168:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF3625:
+	.string	"_ZNSt6vectorImSaImEE5frontEv"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF4185:
+	.string	"_ZNSaImEC2Ev"
+.LASF241:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF3124:
+	.string	"allocator<char>"
+.LASF827:
+	.string	"_GLIBCXX_HAVE_ISNANF 1"
+.LASF3247:
+	.string	"_M_string_length"
+.LASF2196:
+	.string	"__S_ISVTX 01000"
+.LASF1258:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF890:
+	.string	"_GLIBCXX_HAVE_STRXFRM_L 1"
+.LASF3396:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8pop_backEv"
+.LASF323:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1620:
+	.string	"putwchar"
+.LASF1377:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF2409:
+	.string	"_POSIX_THREADS 200809L"
+.LASF3177:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4copyEPcmm"
+.LASF3521:
+	.string	"_ZNSt16allocator_traitsISaImEE8allocateERS0_m"
+.LASF3541:
+	.string	"_ZNSt12_Vector_baseImSaImEE12_Vector_implC4EOS2_"
+.LASF2024:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_GREW"
+.LASF1894:
+	.string	"ENOSPC 28"
+.LASF2749:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LINTFLAGS _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS"
+.LASF2277:
+	.string	"MADV_NOHUGEPAGE 15"
+.LASF1048:
+	.string	"_STL_ITERATOR_BASE_TYPES_H 1"
+.LASF1586:
+	.string	"_GLIBCXX_STRING 1"
+.LASF79:
+	.string	"__DEPRECATED 1"
+.LASF3559:
+	.string	"_ZNSt12_Vector_baseImSaImEED4Ev"
+.LASF4063:
+	.string	"int_n_sign_posn"
+.LASF1153:
+	.string	"_BSD_WCHAR_T_ "
+.LASF4232:
+	.string	"_ZNSt12_Vector_baseImSaImEE12_Vector_implD4Ev"
+.LASF352:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF2967:
+	.string	"PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE"
+.LASF935:
+	.string	"_GLIBCXX_PACKAGE__GLIBCXX_VERSION \"version-unused\""
+.LASF222:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1665:
+	.string	"__cpp_lib_constexpr_char_traits 201611L"
+.LASF3128:
+	.string	"~allocator"
+.LASF3062:
+	.string	"__swappable_details"
+.LASF2087:
+	.string	"F_SETLEASE 1024"
+.LASF2404:
+	.string	"_POSIX_VDISABLE '\\0'"
+.LASF224:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF874:
+	.string	"_GLIBCXX_HAVE_SINHL 1"
+.LASF3786:
+	.string	"operator++"
+.LASF1998:
+	.string	"ERFKILL 132"
+.LASF3563:
+	.string	"_M_deallocate"
+.LASF3301:
+	.string	"_M_erase"
+.LASF1836:
+	.string	"fwrite"
+.LASF1711:
+	.string	"LC_MONETARY_MASK (1 << __LC_MONETARY)"
+.LASF2846:
+	.string	"_BITS_TYPES_STRUCT_SCHED_PARAM 1"
+.LASF856:
+	.string	"_GLIBCXX_HAVE_NETINET_IN_H 1"
+.LASF2808:
+	.string	"__GTHREADS_CXX0X 1"
+.LASF2540:
+	.string	"_SC_RE_DUP_MAX _SC_RE_DUP_MAX"
+.LASF2322:
+	.string	"ALLPERMS (S_ISUID|S_ISGID|S_ISVTX|S_IRWXU|S_IRWXG|S_IRWXO)"
+.LASF3360:
+	.string	"operator+="
+.LASF96:
+	.string	"__cpp_nsdmi 200809L"
+.LASF3488:
+	.string	"_ZNSt15__exception_ptr13exception_ptrD4Ev"
+.LASF3373:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9push_backEc"
+.LASF489:
+	.string	"_GLIBCXX_BEGIN_NAMESPACE_CXX11 namespace __cxx11 {"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF2819:
+	.string	"SCHED_RESET_ON_FORK 0x40000000"
+.LASF3880:
+	.string	"wchar_t"
+.LASF4053:
+	.string	"p_sep_by_space"
+.LASF3726:
+	.string	"_ZSt12__equal_aux1IPKcPcEbT_S3_T0_"
+.LASF2716:
+	.string	"_CS_GNU_LIBC_VERSION _CS_GNU_LIBC_VERSION"
+.LASF3843:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEpLEl"
+.LASF2605:
+	.string	"_SC_MB_LEN_MAX _SC_MB_LEN_MAX"
+.LASF3458:
+	.string	"_Alloc"
+.LASF3772:
+	.string	"_S_always_equal"
+.LASF2539:
+	.string	"_SC_LINE_MAX _SC_LINE_MAX"
+.LASF1032:
+	.string	"__cpp_lib_is_swappable 201603L"
+.LASF306:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF3275:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE17_M_use_local_dataEv"
+.LASF3193:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5rfindEPKcmm"
+.LASF2446:
+	.string	"_POSIX_RAW_SOCKETS 200809L"
+.LASF1625:
+	.string	"vfwscanf"
+.LASF2537:
+	.string	"_SC_EQUIV_CLASS_MAX _SC_EQUIV_CLASS_MAX"
+.LASF4184:
+	.string	"_ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC2Ev"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1674:
+	.string	"_GLIBCXX_OPERATOR_NEW"
+.LASF1046:
+	.string	"_GLIBCXX_DEPRECATED_PAIR_CTOR"
+.LASF791:
+	.string	"_GLIBCXX_HAVE_COSHL 1"
+.LASF162:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF2836:
+	.string	"CLONE_UNTRACED 0x00800000"
+.LASF3714:
+	.string	"_ZSt12__relocate_aIPmS0_SaImEET0_T_S3_S2_RT1_"
+.LASF4156:
+	.string	"__alloc"
+.LASF116:
+	.string	"__cpp_if_constexpr 201606L"
+.LASF547:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF4155:
+	.string	"__result"
+.LASF1454:
+	.string	"__STDC_CONSTANT_MACROS"
+.LASF3706:
+	.string	"_RandomAccessIterator"
+.LASF1663:
+	.string	"wcstoull"
+.LASF2185:
+	.string	"__S_IFCHR 0020000"
+.LASF1122:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF728:
+	.string	"_PSTL_PAR_BACKEND_TBB "
+.LASF4035:
+	.string	"tm_isdst"
+.LASF1738:
+	.string	"iscntrl"
+.LASF1154:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1995:
+	.string	"EKEYREJECTED 129"
+.LASF4052:
+	.string	"p_cs_precedes"
+.LASF797:
+	.string	"_GLIBCXX_HAVE_ENDIAN_H 1"
+.LASF3326:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE3endEv"
+.LASF3469:
+	.string	"reverse_iterator<__gnu_cxx::__normal_iterator<char const*, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >"
+.LASF891:
+	.string	"_GLIBCXX_HAVE_SYMLINK 1"
+.LASF2118:
+	.string	"DN_ATTRIB 0x00000020"
+.LASF1070:
+	.string	"__glibcxx_requires_cond(_Cond,_Msg) "
+.LASF896:
+	.string	"_GLIBCXX_HAVE_SYS_RESOURCE_H 1"
+.LASF261:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF127:
+	.string	"__cpp_sized_deallocation 201309L"
+.LASF3370:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendEmc"
+.LASF499:
+	.string	"_GLIBCXX_BEGIN_NAMESPACE_ALGO "
+.LASF2495:
+	.string	"_SC_ARG_MAX _SC_ARG_MAX"
+.LASF3484:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4EOS0_"
+.LASF535:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF3742:
+	.string	"lower_bound<__gnu_cxx::__normal_iterator<long unsigned int const*, std::vector<long unsigned int> >, unsigned int, simulator::result_reader::find_chunk(uint32_t, simulator::result_chunk&) const::<lambda(uint64_t, uint32_t)> >"
+.LASF4115:
+	.string	"mVersion"
+.LASF3789:
+	.string	"operator--"
+.LASF2532:
+	.string	"_SC_BC_BASE_MAX _SC_BC_BASE_MAX"
+.LASF2449:
+	.string	"_POSIX_THREAD_SPORADIC_SERVER -1"
+.LASF2576:
+	.string	"_SC_THREAD_PRIORITY_SCHEDULING _SC_THREAD_PRIORITY_SCHEDULING"
+.LASF364:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF4226:
+	.string	"align_val_t"
+.LASF2137:
+	.string	"__POSIX_FADV_DONTNEED 4"
+.LASF796:
+	.string	"_GLIBCXX_HAVE_DLFCN_H 1"
+.LASF3764:
+	.string	"_S_on_swap"
+.LASF3796:
+	.string	"operator-="
+.LASF3784:
+	.string	"operator->"
+.LASF1862:
+	.string	"vsscanf"
+.LASF1538:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF675:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF375:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF2497:
+	.string	"_SC_CLK_TCK _SC_CLK_TCK"
+.LASF2643:
+	.string	"_SC_FILE_ATTRIBUTES _SC_FILE_ATTRIBUTES"
+.LASF2855:
+	.string	"__CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))"
+.LASF1378:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF3967:
+	.string	"int_fast16_t"
+.LASF3394:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5eraseEN9__gnu_cxx17__normal_iteratorIPKcS4_EES9_"
+.LASF4223:
+	.string	"__int128 unsigned"
+.LASF2948:
+	.string	"__jmp_buf_tag_defined 1"
+.LASF147:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF4181:
+	.string	"__new_finish"
+.LASF2122:
+	.string	"F_SEAL_GROW 0x0004"
+.LASF313:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2021:
+	.string	"_VECTOR_TCC 1"
+.LASF2104:
+	.string	"F_SHLCK 8"
+.LASF1893:
+	.string	"EFBIG 27"
+.LASF2499:
+	.string	"_SC_OPEN_MAX _SC_OPEN_MAX"
+.LASF1700:
+	.string	"LC_ALL __LC_ALL"
+.LASF1671:
+	.string	"_GLIBCXX_SIZED_DEALLOC(p,n) (p), (n) * sizeof(_Tp)"
+.LASF2792:
+	.string	"_UNIQUE_PTR_H 1"
+.LASF1591:
+	.string	"_WCHAR_H 1"
+.LASF38:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1649:
+	.string	"wcstok"
+.LASF1537:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1535:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF1731:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF3863:
+	.string	"operator-<long unsigned int*, std::vector<long unsigned int> >"
+.LASF1494:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1001:
+	.string	"_FUNCTEXCEPT_H 1"
+.LASF3454:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareEPKc"
+.LASF2356:
+	.string	"STATX_INO 0x00000100U"
+.LASF2370:
+	.string	"STATX_ATTR_AUTOMOUNT 0x00001000"
+.LASF3874:
+	.string	"short int"
+.LASF2376:
+	.string	"_UNISTD_H 1"
+.LASF3028:
+	.string	"ATOMIC_WCHAR_T_LOCK_FREE __GCC_ATOMIC_WCHAR_T_LOCK_FREE"
+.LASF1326:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF4090:
+	.string	"max_align_t"
+.LASF1729:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF843:
+	.string	"_GLIBCXX_HAVE_LINUX_TYPES_H 1"
+.LASF1355:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF4240:
+	.string	"11max_align_t"
+.LASF2067:
+	.string	"O_TMPFILE __O_TMPFILE"
+.LASF2420:
+	.string	"_POSIX_REALTIME_SIGNALS 200809L"
+.LASF2662:
+	.string	"_SC_TYPED_MEMORY_OBJECTS _SC_TYPED_MEMORY_OBJECTS"
+.LASF1786:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF280:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1793:
+	.string	"EOF (-1)"
+.LASF2468:
+	.string	"STDOUT_FILENO 1"
+.LASF478:
+	.string	"_GLIBCXX_NOEXCEPT_IF(...) noexcept(__VA_ARGS__)"
+.LASF1809:
+	.string	"stdin stdin"
+.LASF3556:
+	.string	"_ZNSt12_Vector_baseImSaImEEC4EOS1_RKS0_"
+.LASF1128:
+	.string	"__SIZE_T__ "
+.LASF1149:
+	.string	"_T_WCHAR_ "
+.LASF1670:
+	.string	"_GLIBCXX_OPERATOR_DELETE ::operator delete"
+.LASF2567:
+	.string	"_SC_GETPW_R_SIZE_MAX _SC_GETPW_R_SIZE_MAX"
+.LASF3261:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE11_M_is_localEv"
+.LASF2949:
+	.string	"__SC_THREAD_STACK_MIN_VALUE 75"
+.LASF480:
+	.string	"_GLIBCXX_THROW(_EXC) "
+.LASF2072:
+	.string	"F_SETFD 2"
+.LASF1476:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF3421:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5c_strEv"
+.LASF2245:
+	.string	"MAP_FIXED_NOREPLACE 0x100000"
+.LASF3031:
+	.string	"ATOMIC_SHORT_LOCK_FREE __GCC_ATOMIC_SHORT_LOCK_FREE"
+.LASF2502:
+	.string	"_SC_JOB_CONTROL _SC_JOB_CONTROL"
+.LASF1424:
+	.string	"srand"
+.LASF3525:
+	.string	"_ZNSt16allocator_traitsISaImEE37select_on_container_copy_constructionERKS0_"
+.LASF2333:
+	.string	"_LINUX_STDDEF_H "
+.LASF2156:
+	.string	"FALLOC_FL_NO_HIDE_STALE 0x04"
+.LASF2431:
+	.string	"_POSIX_THREAD_CPUTIME 0"
+.LASF3716:
+	.string	"_Allocator"
+.LASF1286:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF2360:
+	.string	"STATX_BTIME 0x00000800U"
+.LASF1453:
+	.string	"__STDC_LIMIT_MACROS "
+.LASF2882:
+	.string	"CPU_XOR_S(setsize,destset,srcset1,srcset2) __CPU_OP_S (setsize, destset, srcset1, srcset2, ^)"
+.LASF1493:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF201:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF2593:
+	.string	"_SC_2_C_VERSION _SC_2_C_VERSION"
+.LASF1168:
+	.string	"WNOHANG 1"
+.LASF1402:
+	.string	"abort"
+.LASF1071:
+	.string	"__glibcxx_requires_valid_range(_First,_Last) "
+.LASF1905:
+	.string	"ENOTEMPTY 39"
+.LASF1723:
+	.string	"localeconv"
+.LASF548:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1857:
+	.string	"vsprintf"
+.LASF635:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF3388:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEmmc"
+.LASF1015:
+	.string	"__glibcxx_digits10(_Tp) __glibcxx_floating(_Tp, __FLT_DIG__, __DBL_DIG__, __LDBL_DIG__)"
+.LASF3548:
+	.string	"_ZNKSt12_Vector_baseImSaImEE13get_allocatorEv"
+.LASF2435:
+	.string	"_POSIX_TIMEOUTS 200809L"
+.LASF957:
+	.string	"_GLIBCXX_SYMVER 1"
+.LASF2383:
+	.string	"_POSIX2_SW_DEV __POSIX2_THIS_VERSION"
+.LASF2779:
+	.string	"_CS_V7_ENV _CS_V7_ENV"
+.LASF3722:
+	.string	"_ZSt8distanceIN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEEENSt15iterator_traitsIT_E15difference_typeES9_S9_"
+.LASF3865:
+	.string	"operator-<long unsigned int const*, std::vector<long unsigned int> >"
+.LASF1487:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF3214:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE16find_last_not_ofEPKcm"
+.LASF3002:
+	.string	"_T_PTRDIFF_ "
+.LASF2677:
+	.string	"_SC_HOST_NAME_MAX _SC_HOST_NAME_MAX"
+.LASF2720:
+	.string	"_CS_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS"
+.LASF2169:
+	.string	"AT_STATX_SYNC_AS_STAT 0x0000"
+.LASF4004:
+	.string	"_markers"
+.LASF2308:
+	.string	"S_ISDIR(mode) __S_ISTYPE((mode), __S_IFDIR)"
+.LASF1776:
+	.string	"_STDIO_H 1"
+.LASF21:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF4006:
+	.string	"_fileno"
+.LASF3624:
+	.string	"_ZNKSt6vectorImSaImEE2atEm"
+.LASF632:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF3050:
+	.string	"operator std::integral_constant<bool, false>::value_type"
+.LASF1892:
+	.string	"ETXTBSY 26"
+.LASF3729:
+	.string	"__niter_base<char*>"
+.LASF3906:
+	.string	"__int_least32_t"
+.LASF3324:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5beginEv"
+.LASF2231:
+	.string	"F_TLOCK 2"
+.LASF2443:
+	.string	"_POSIX_CLOCK_SELECTION 200809L"
+.LASF354:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2911:
+	.string	"ADJ_NANO 0x2000"
+.LASF1119:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF3263:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_createERmm"
+.LASF1287:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2880:
+	.string	"CPU_AND_S(setsize,destset,srcset1,srcset2) __CPU_OP_S (setsize, destset, srcset1, srcset2, &)"
+.LASF2861:
+	.string	"__CPU_FREE(cpuset) __sched_cpufree (cpuset)"
+.LASF284:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2788:
+	.string	"_STL_RAW_STORAGE_ITERATOR_H 1"
+.LASF3529:
+	.string	"_Vector_impl_data"
+.LASF1779:
+	.string	"__struct_FILE_defined 1"
+.LASF3703:
+	.string	"__advance<__gnu_cxx::__normal_iterator<long unsigned int const*, std::vector<long unsigned int> >, long int>"
+.LASF2551:
+	.string	"_SC_PII_SOCKET _SC_PII_SOCKET"
+.LASF3821:
+	.string	"_S_single"
+.LASF2642:
+	.string	"_SC_PIPE _SC_PIPE"
+.LASF3664:
+	.string	"_M_erase_at_end"
+.LASF1465:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF3589:
+	.string	"_ZNSt6vectorImSaImEEC4EOS1_RKS0_St17integral_constantIbLb0EE"
+.LASF785:
+	.string	"_GLIBCXX_HAVE_AT_QUICK_EXIT 1"
+.LASF4060:
+	.string	"int_n_cs_precedes"
+.LASF4162:
+	.string	"__num"
+.LASF121:
+	.string	"__cpp_noexcept_function_type 201510L"
+.LASF1282:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF309:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF3398:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEmmRKS4_"
+.LASF1238:
+	.string	"__U32_TYPE unsigned int"
+.LASF1701:
+	.string	"LC_PAPER __LC_PAPER"
+.LASF320:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF1937:
+	.string	"EPROTO 71"
+.LASF934:
+	.string	"_GLIBCXX_PACKAGE_URL \"\""
+.LASF2093:
+	.string	"F_GET_SEALS 1034"
+.LASF3377:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignEPKcm"
+.LASF4198:
+	.string	"__closure"
+.LASF2238:
+	.string	"MAP_LOCKED 0x02000"
+.LASF3083:
+	.string	"find"
+.LASF4195:
+	.string	"__iter_comp_val<simulator::result_reader::find_chunk(uint32_t, simulator::result_chunk&) const::<lambda(uint64_t, uint32_t)> >"
+.LASF3938:
+	.string	"__allow_parallel"
+.LASF655:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF561:
+	.string	"_POSIX_SOURCE 1"
+.LASF2637:
+	.string	"_SC_DEVICE_IO _SC_DEVICE_IO"
+.LASF1598:
+	.string	"____mbstate_t_defined 1"
+.LASF1340:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF2346:
+	.string	"__aligned_be64 __be64 __attribute__((aligned(8)))"
+.LASF4170:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEC2ERKS1_"
+.LASF1388:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1891:
+	.string	"ENOTTY 25"
+.LASF3973:
+	.string	"uint_fast64_t"
+.LASF1353:
+	.string	"__sigset_t_defined 1"
+.LASF1193:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF258:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1151:
+	.string	"__WCHAR_T "
+.LASF1233:
+	.string	"_SYS_TYPES_H 1"
+.LASF595:
+	.string	"__USE_LARGEFILE64 1"
+.LASF3579:
+	.string	"_ZNSt6vectorImSaImEE11_S_relocateEPmS2_S2_RS0_"
+.LASF2111:
+	.string	"LOCK_WRITE 128"
+.LASF1342:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF2494:
+	.string	"_PC_2_SYMLINKS _PC_2_SYMLINKS"
+.LASF1838:
+	.string	"getchar"
+.LASF2904:
+	.string	"ADJ_MAXERROR 0x0004"
+.LASF1241:
+	.string	"__SQUAD_TYPE long int"
+.LASF2465:
+	.string	"__LP64_OFF64_CFLAGS \"-m64\""
+.LASF3776:
+	.string	"rebind<char>"
+.LASF2061:
+	.string	"O_DIRECTORY __O_DIRECTORY"
+.LASF1228:
+	.string	"EXIT_FAILURE 1"
+.LASF3506:
+	.string	"_ZNSt15__new_allocatorImED4Ev"
+.LASF2071:
+	.string	"F_GETFD 1"
+.LASF373:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF605:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1957:
+	.string	"EPROTOTYPE 91"
+.LASF2912:
+	.string	"ADJ_TICK 0x4000"
+.LASF2933:
+	.string	"STA_FREQHOLD 0x0080"
+.LASF3200:
+	.string	"find_last_of"
+.LASF4087:
+	.string	"__glibc_reserved"
+.LASF3875:
+	.string	"long int"
+.LASF3312:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ERKS4_RKS3_"
+.LASF4215:
+	.string	"_ZN9simulator13result_readerC2ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE"
+.LASF2926:
+	.string	"STA_PLL 0x0001"
+.LASF731:
+	.string	"_PSTL_CONFIG_H "
+.LASF2733:
+	.string	"_CS_XBS5_ILP32_OFF32_LINTFLAGS _CS_XBS5_ILP32_OFF32_LINTFLAGS"
+.LASF1410:
+	.string	"calloc"
+.LASF1732:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF3767:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE27_S_propagate_on_copy_assignEv"
+.LASF3898:
+	.string	"__int32_t"
+.LASF1394:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1657:
+	.string	"wmemmove"
+.LASF3653:
+	.string	"_ZNSt6vectorImSaImEE16_M_shrink_to_fitEv"
+.LASF3844:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEplEl"
+.LASF2610:
+	.string	"_SC_SHRT_MAX _SC_SHRT_MAX"
+.LASF761:
+	.string	"_PSTL_PRAGMA_SIMD_ORDERED_MONOTONIC(PRM) "
+.LASF3294:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_S_copy_charsEPcS5_S5_"
+.LASF1248:
+	.string	"__U64_TYPE unsigned long int"
+.LASF429:
+	.string	"__gnu_linux__ 1"
+.LASF3224:
+	.string	"_ZNSt11char_traitsIcE6assignERcRKc"
+.LASF2173:
+	.string	"AT_EACCESS 0x200"
+.LASF2399:
+	.string	"_POSIX_MAPPED_FILES 200809L"
+.LASF3920:
+	.string	"__time_t"
+.LASF2272:
+	.string	"MADV_DONTFORK 10"
+.LASF2204:
+	.string	"S_IFCHR __S_IFCHR"
+.LASF639:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __THROW __asm__ (__ASMNAME (#alias))"
+.LASF4085:
+	.string	"st_mtim"
+.LASF237:
+	.string	"__DBL_NORM_MAX__ double(1.79769313486231570814527423731704357e+308L)"
+.LASF1988:
+	.string	"EDQUOT 122"
+.LASF3362:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEpLEPKc"
+.LASF2987:
+	.string	"__gthrw_(name) name"
+.LASF1517:
+	.string	"UINT8_C(c) c"
+.LASF1345:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF3197:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE13find_first_ofEcm"
+.LASF1203:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF3817:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmiEl"
+.LASF3752:
+	.string	"__gnu_cxx"
+.LASF2746:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_CFLAGS _CS_POSIX_V6_ILP32_OFF32_CFLAGS"
+.LASF2343:
+	.string	"__bitwise__ __bitwise"
+.LASF1814:
+	.string	"RENAME_WHITEOUT (1 << 2)"
+.LASF3892:
+	.string	"lldiv_t"
+.LASF3598:
+	.string	"_ZNSt6vectorImSaImEE6assignESt16initializer_listImE"
+.LASF2930:
+	.string	"STA_INS 0x0010"
+.LASF1740:
+	.string	"isgraph"
+.LASF3198:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE13find_first_ofEPKcmm"
+.LASF2751:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS"
+.LASF3935:
+	.string	"__allow_vector"
+.LASF990:
+	.string	"_GLIBCXX_USE_ST_MTIM 1"
+.LASF546:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1962:
+	.string	"EPFNOSUPPORT 96"
+.LASF1073:
+	.string	"__glibcxx_requires_can_increment_range(_First1,_Last1,_First2) "
+.LASF2023:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_GROW"
+.LASF93:
+	.string	"__cpp_variadic_templates 200704L"
+.LASF3266:
+	.string	"_M_destroy"
+.LASF795:
+	.string	"_GLIBCXX_HAVE_DIRFD 1"
+.LASF2905:
+	.string	"ADJ_ESTERROR 0x0008"
+.LASF2513:
+	.string	"_SC_MEMLOCK_RANGE _SC_MEMLOCK_RANGE"
+.LASF1147:
+	.string	"__WCHAR_T__ "
+.LASF3452:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareEmmRKS4_"
+.LASF733:
+	.string	"_PSTL_VERSION_MAJOR (_PSTL_VERSION / 1000)"
+.LASF3868:
+	.string	"_ZN9__gnu_cxxeqIPKmSt6vectorImSaImEEEEbRKNS_17__normal_iteratorIT_T0_EESB_"
+.LASF1445:
+	.string	"_ASSERT_H 1"
+.LASF2298:
+	.string	"MREMAP_DONTUNMAP 4"
+.LASF1993:
+	.string	"EKEYEXPIRED 127"
+.LASF2281:
+	.string	"MADV_KEEPONFORK 19"
+.LASF2183:
+	.string	"__S_IFMT 0170000"
+.LASF2893:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF3646:
+	.string	"_M_fill_assign"
+.LASF954:
+	.string	"_GLIBCXX_STDIO_EOF -1"
+.LASF4182:
+	.string	"__in_chrg"
+.LASF1315:
+	.string	"__suseconds_t_defined "
+.LASF2999:
+	.string	"_STDDEF_H_ "
+.LASF2529:
+	.string	"_SC_SEM_VALUE_MAX _SC_SEM_VALUE_MAX"
+.LASF2628:
+	.string	"_SC_XOPEN_REALTIME_THREADS _SC_XOPEN_REALTIME_THREADS"
+.LASF2758:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS"
+.LASF3401:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEmmPKc"
+.LASF2639:
+	.string	"_SC_DEVICE_SPECIFIC_R _SC_DEVICE_SPECIFIC_R"
+.LASF1183:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF2034:
+	.string	"O_WRONLY 01"
+.LASF1539:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF1116:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF992:
+	.string	"_GLIBCXX_USE_UCHAR_C8RTOMB_MBRTOC8_CXX20 1"
+.LASF3747:
+	.string	"_ZSt3endIKcLm8EEPT_RAT0__S1_"
+.LASF2730:
+	.string	"_CS_XBS5_ILP32_OFF32_CFLAGS _CS_XBS5_ILP32_OFF32_CFLAGS"
+.LASF2919:
+	.string	"MOD_STATUS ADJ_STATUS"
+.LASF2652:
+	.string	"_SC_REGEXP _SC_REGEXP"
+.LASF3861:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEmiEl"
+.LASF537:
+	.string	"__USE_LARGEFILE64"
+.LASF1572:
+	.string	"strcoll"
+.LASF385:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF527:
+	.string	"__USE_POSIX199309"
+.LASF3293:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_S_copy_charsEPcN9__gnu_cxx17__normal_iteratorIPKcS4_EESA_"
+.LASF2236:
+	.string	"MAP_DENYWRITE 0x00800"
+.LASF3682:
+	.string	"iterator_traits<char const*>"
+.LASF2250:
+	.string	"PROT_GROWSDOWN 0x01000000"
+.LASF1724:
+	.string	"_GLIBCXX_C_LOCALE_GNU 1"
+.LASF931:
+	.string	"_GLIBCXX_PACKAGE_NAME \"package-unused\""
+.LASF2493:
+	.string	"_PC_SYMLINK_MAX _PC_SYMLINK_MAX"
+.LASF3267:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE10_M_destroyEm"
+.LASF3996:
+	.string	"_IO_write_base"
+.LASF3539:
+	.string	"_ZNSt12_Vector_baseImSaImEE12_Vector_implC4Ev"
+.LASF591:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF3516:
+	.string	"_ZNSaImEC4Ev"
+.LASF4143:
+	.string	"_ZdlPvm"
+.LASF976:
+	.string	"_GLIBCXX_USE_LFS 1"
+.LASF3084:
+	.string	"_ZNSt11char_traitsIcE4findEPKcmRS1_"
+.LASF488:
+	.string	"_GLIBCXX_NAMESPACE_CXX11 __cxx11::"
+.LASF1735:
+	.string	"_GLIBCXX_CCTYPE 1"
+.LASF3841:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEmmEi"
+.LASF103:
+	.string	"__cpp_decltype_auto 201304L"
+.LASF2351:
+	.string	"STATX_UID 0x00000008U"
+.LASF160:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF3639:
+	.string	"_ZNSt6vectorImSaImEE5eraseEN9__gnu_cxx17__normal_iteratorIPKmS1_EES6_"
+.LASF4204:
+	.string	"__PRETTY_FUNCTION__"
+.LASF2810:
+	.string	"_SCHED_H 1"
+.LASF2630:
+	.string	"_SC_BARRIERS _SC_BARRIERS"
+.LASF2524:
+	.string	"_SC_VERSION _SC_VERSION"
+.LASF575:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF2247:
+	.string	"PROT_WRITE 0x2"
+.LASF483:
+	.string	"_GLIBCXX_NOEXCEPT_PARM , bool _NE"
+.LASF2804:
+	.string	"_GLIBCXX_ATOMICITY_H 1"
+.LASF2426:
+	.string	"_LFS_LARGEFILE 1"
+.LASF2332:
+	.string	"_LINUX_POSIX_TYPES_H "
+.LASF1638:
+	.string	"wcslen"
+.LASF3881:
+	.string	"char16_t"
+.LASF2444:
+	.string	"_POSIX_ADVISORY_INFO 200809L"
+.LASF3201:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE12find_last_ofES2_m"
+.LASF3951:
+	.string	"_ZN6__pstl9execution2v118unsequenced_policy16__allow_parallelEv"
+.LASF376:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF3054:
+	.string	"integral_constant<bool, false>"
+.LASF3383:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEN9__gnu_cxx17__normal_iteratorIPKcS4_EESt16initializer_listIcE"
+.LASF1300:
+	.string	"__mode_t_defined "
+.LASF1341:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF2195:
+	.string	"__S_ISGID 02000"
+.LASF3184:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareEmmPKc"
+.LASF3867:
+	.string	"operator==<long unsigned int const*, std::vector<long unsigned int> >"
+.LASF230:
+	.string	"__DBL_DIG__ 15"
+.LASF994:
+	.string	"_GLIBCXX_USE_UTIME 1"
+.LASF3262:
+	.string	"_M_create"
+.LASF1989:
+	.string	"ENOMEDIUM 123"
+.LASF2852:
+	.string	"__CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\\0', setsize); while (0)"
+.LASF3096:
+	.string	"eq_int_type"
+.LASF3328:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6rbeginEv"
+.LASF2083:
+	.string	"F_SETSIG __F_SETSIG"
+.LASF1299:
+	.string	"__gid_t_defined "
+.LASF1992:
+	.string	"ENOKEY 126"
+.LASF167:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2151:
+	.string	"SPLICE_F_MORE 4"
+.LASF1013:
+	.string	"__glibcxx_floating(_Tp,_Fval,_Dval,_LDval) (std::__are_same<_Tp, float>::__value ? _Fval : std::__are_same<_Tp, double>::__value ? _Dval : _LDval)"
+.LASF3134:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEEC4EPKc"
+.LASF4111:
+	.string	"resultFileMagic"
+.LASF2558:
+	.string	"_SC_PII_INTERNET_STREAM _SC_PII_INTERNET_STREAM"
+.LASF3925:
+	.string	"int16_t"
+.LASF837:
+	.string	"_GLIBCXX_HAVE_LIMIT_RSS 1"
+.LASF3503:
+	.string	"__new_allocator<long unsigned int>"
+.LASF1973:
+	.string	"ENOTCONN 107"
+.LASF662:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF4065:
+	.string	"__pos"
+.LASF2941:
+	.string	"STA_CLK 0x8000"
+.LASF3783:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEdeEv"
+.LASF3744:
+	.string	"equal<char const*, char*>"
+.LASF1804:
+	.string	"L_ctermid 9"
+.LASF4089:
+	.string	"__max_align_ld"
+.LASF4110:
+	.string	"time"
+.LASF3823:
+	.string	"_S_atomic"
+.LASF1521:
+	.string	"INTMAX_C(c) c ## L"
+.LASF4088:
+	.string	"__max_align_ll"
+.LASF2304:
+	.string	"PKEY_DISABLE_WRITE 0x2"
+.LASF542:
+	.string	"__USE_GNU"
+.LASF1477:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1532:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF1882:
+	.string	"EBUSY 16"
+.LASF2429:
+	.string	"_POSIX_SHARED_MEMORY_OBJECTS 200809L"
+.LASF3617:
+	.string	"_ZNKSt6vectorImSaImEE5emptyEv"
+.LASF1819:
+	.string	"fclose"
+.LASF1365:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF611:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1512:
+	.string	"WINT_MAX (4294967295u)"
+.LASF3533:
+	.string	"_ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC4Ev"
+.LASF3792:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEixEl"
+.LASF2902:
+	.string	"ADJ_OFFSET 0x0001"
+.LASF1182:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF2920:
+	.string	"MOD_TIMECONST ADJ_TIMECONST"
+.LASF600:
+	.string	"__USE_MISC 1"
+.LASF1247:
+	.string	"__S64_TYPE long int"
+.LASF1348:
+	.string	"_SYS_SELECT_H 1"
+.LASF3382:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEN9__gnu_cxx17__normal_iteratorIPKcS4_EEmc"
+.LASF2004:
+	.string	"_GLIBCXX_CHARCONV_H 1"
+.LASF3280:
+	.string	"_M_limit"
+.LASF747:
+	.string	"_PSTL_PRAGMA_FORCEINLINE "
+.LASF2080:
+	.string	"__F_GETSIG 11"
+.LASF360:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1837:
+	.string	"getc"
+.LASF551:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF3937:
+	.string	"_ZN6__pstl9execution2v116sequenced_policy14__allow_vectorEv"
+.LASF3721:
+	.string	"distance<__gnu_cxx::__normal_iterator<long unsigned int const*, std::vector<long unsigned int> > >"
+.LASF4074:
+	.string	"st_ino"
+.LASF1101:
+	.string	"_NEW "
+.LASF2155:
+	.string	"FALLOC_FL_PUNCH_HOLE 0x02"
+.LASF3446:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16find_last_not_ofERKS4_m"
+.LASF3699:
+	.string	"__niter_base<long unsigned int*>"
+.LASF1855:
+	.string	"vfprintf"
+.LASF1002:
+	.string	"_EXCEPTION_DEFINES_H 1"
+.LASF2297:
+	.string	"MREMAP_FIXED 2"
+.LASF36:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF219:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF2622:
+	.string	"_SC_XBS5_ILP32_OFF32 _SC_XBS5_ILP32_OFF32"
+.LASF3448:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16find_last_not_ofEPKcm"
+.LASF3414:
+	.string	"_M_replace"
+.LASF3770:
+	.string	"_S_propagate_on_swap"
+.LASF524:
+	.string	"__USE_ISOCXX11"
+.LASF596:
+	.string	"__WORDSIZE 64"
+.LASF111:
+	.string	"__cpp_nested_namespace_definitions 201411L"
+.LASF3693:
+	.string	"_ZSt20__throw_length_errorPKc"
+.LASF2453:
+	.string	"_POSIX_TRACE_LOG -1"
+.LASF1848:
+	.string	"setbuf"
+.LASF835:
+	.string	"_GLIBCXX_HAVE_LIMIT_DATA 1"
+.LASF3969:
+	.string	"int_fast64_t"
+.LASF944:
+	.string	"_GLIBCXX98_USE_C99_MATH 1"
+.LASF3627:
+	.string	"_ZNSt6vectorImSaImEE4backEv"
+.LASF1430:
+	.string	"wctomb"
+.LASF1939:
+	.string	"EDOTDOT 73"
+.LASF1681:
+	.string	"__LC_CTYPE 0"
+.LASF3431:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5rfindEPKcmm"
+.LASF3645:
+	.string	"_ZNSt6vectorImSaImEE21_M_default_initializeEm"
+.LASF1668:
+	.string	"_STD_NEW_ALLOCATOR_H 1"
+.LASF3315:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEED4Ei"
+.LASF2536:
+	.string	"_SC_COLL_WEIGHTS_MAX _SC_COLL_WEIGHTS_MAX"
+.LASF978:
+	.string	"_GLIBCXX_USE_LSTAT 1"
+.LASF4221:
+	.string	"_ZnwmPv"
+.LASF2590:
+	.string	"_SC_XOPEN_ENH_I18N _SC_XOPEN_ENH_I18N"
+.LASF2434:
+	.string	"_POSIX_SHELL 1"
+.LASF1768:
+	.string	"_FUNCTIONAL_HASH_H 1"
+.LASF2822:
+	.string	"CLONE_FS 0x00000200"
+.LASF853:
+	.string	"_GLIBCXX_HAVE_MODFF 1"
+.LASF1542:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1379:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF2112:
+	.string	"LOCK_RW 192"
+.LASF2412:
+	.string	"_POSIX_THREAD_PRIORITY_SCHEDULING 200809L"
+.LASF1102:
+	.string	"__EXCEPTION_H 1"
+.LASF3668:
+	.string	"_M_move_assign"
+.LASF1363:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF2440:
+	.string	"_POSIX_MESSAGE_PASSING 200809L"
+.LASF1126:
+	.string	"__need_NULL "
+.LASF1325:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF2564:
+	.string	"_SC_THREADS _SC_THREADS"
+.LASF3158:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE8max_sizeEv"
+.LASF1242:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF264:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF633:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF927:
+	.string	"_GLIBCXX_HAVE___CXA_THREAD_ATEXIT_IMPL 1"
+.LASF1587:
+	.string	"_STRINGFWD_H 1"
+.LASF3565:
+	.string	"_M_create_storage"
+.LASF2102:
+	.string	"F_UNLCK 2"
+.LASF431:
+	.string	"__linux__ 1"
+.LASF787:
+	.string	"_GLIBCXX_HAVE_CEILL 1"
+.LASF3102:
+	.string	"__new_allocator"
+.LASF2327:
+	.string	"_ASM_GENERIC_TYPES_H "
+.LASF3930:
+	.string	"tv_nsec"
+.LASF902:
+	.string	"_GLIBCXX_HAVE_SYS_SYSINFO_H 1"
+.LASF2269:
+	.string	"MADV_DONTNEED 4"
+.LASF4009:
+	.string	"_cur_column"
+.LASF2871:
+	.string	"CPU_CLR_S(cpu,setsize,cpusetp) __CPU_CLR_S (cpu, setsize, cpusetp)"
+.LASF3253:
+	.string	"_M_local_data"
+.LASF2394:
+	.string	"_POSIX_JOB_CONTROL 1"
+.LASF122:
+	.string	"__cpp_template_auto 201606L"
+.LASF1140:
+	.string	"__DEFINED_size_t "
+.LASF2086:
+	.string	"F_GETOWN_EX __F_GETOWN_EX"
+.LASF2942:
+	.string	"STA_RONLY (STA_PPSSIGNAL | STA_PPSJITTER | STA_PPSWANDER | STA_PPSERROR | STA_CLOCKERR | STA_NANO | STA_MODE | STA_CLK)"
+.LASF855:
+	.string	"_GLIBCXX_HAVE_NETDB_H 1"
+.LASF592:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF2608:
+	.string	"_SC_SCHAR_MAX _SC_SCHAR_MAX"
+.LASF2167:
+	.string	"AT_EMPTY_PATH 0x1000"
+.LASF3093:
+	.string	"int_type"
+.LASF112:
+	.string	"__cpp_fold_expressions 201603L"
+.LASF1888:
+	.string	"EINVAL 22"
+.LASF4160:
+	.string	"__first1"
+.LASF4161:
+	.string	"__first2"
+.LASF2139:
+	.string	"POSIX_FADV_NORMAL 0"
+.LASF908:
+	.string	"_GLIBCXX_HAVE_TANHF 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1475:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF3486:
+	.string	"_ZNSt15__exception_ptr13exception_ptraSEOS0_"
+.LASF2286:
+	.string	"MADV_DONTNEED_LOCKED 24"
+.LASF3159:
+	.string	"empty"
+.LASF3440:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12find_last_ofEPKcm"
+.LASF2455:
+	.string	"_POSIX_V7_LPBIG_OFFBIG -1"
+.LASF3127:
+	.string	"_ZNSaIcEC4ERKS_"
+.LASF1185:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF955:
+	.string	"_GLIBCXX_STDIO_SEEK_CUR 1"
+.LASF2341:
+	.string	"__ASM_GENERIC_POSIX_TYPES_H "
+.LASF2681:
+	.string	"_SC_TRACE_LOG _SC_TRACE_LOG"
+.LASF3850:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC4ERKS2_"
+.LASF4163:
+	.string	"__last1"
+.LASF3640:
+	.string	"_ZNSt6vectorImSaImEE4swapERS1_"
+.LASF1900:
+	.string	"ERANGE 34"
+.LASF3260:
+	.string	"_M_is_local"
+.LASF929:
+	.string	"_GLIBCXX_LT_OBJDIR \".libs/\""
+.LASF1208:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF3802:
+	.string	"_Container"
+.LASF3856:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEmmEi"
+.LASF3226:
+	.string	"_ZNSt16allocator_traitsISaIcEE8max_sizeERKS0_"
+.LASF968:
+	.string	"_GLIBCXX_USE_CLOCK_MONOTONIC 1"
+.LASF2687:
+	.string	"_SC_LEVEL1_DCACHE_LINESIZE _SC_LEVEL1_DCACHE_LINESIZE"
+.LASF3855:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEmmEv"
+.LASF3569:
+	.string	"_Type"
+.LASF1366:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF294:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF87:
+	.string	"__cpp_user_defined_literals 200809L"
+.LASF1072:
+	.string	"__glibcxx_requires_can_increment(_First,_Size) "
+.LASF758:
+	.string	"_PSTL_UDR_PRESENT 1"
+.LASF2501:
+	.string	"_SC_TZNAME_MAX _SC_TZNAME_MAX"
+.LASF1506:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1654:
+	.string	"wmemchr"
+.LASF3824:
+	.string	"__alloc_traits<std::allocator<long unsigned int>, long unsigned int>"
+.LASF3451:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareERKS4_"
+.LASF2844:
+	.string	"CLONE_IO 0x80000000"
+.LASF764:
+	.string	"_PSTL_PRAGMA_VECTOR_UNALIGNED "
+.LASF4225:
+	.string	"input_iterator_tag"
+.LASF2252:
+	.string	"MAP_SHARED 0x01"
+.LASF35:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF3425:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13get_allocatorEv"
+.LASF3468:
+	.string	"reverse_iterator<__gnu_cxx::__normal_iterator<char*, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > > >"
+.LASF1385:
+	.string	"__LOCK_ALIGNMENT "
+.LASF327:
+	.string	"__FLT32X_DIG__ 15"
+.LASF4210:
+	.string	"fileDescriptor"
+.LASF362:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF4032:
+	.string	"tm_year"
+.LASF3450:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6substrEmm"
+.LASF1095:
+	.string	"_STL_ALGO_H 1"
+.LASF3192:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5rfindEcm"
+.LASF2484:
+	.string	"_PC_ASYNC_IO _PC_ASYNC_IO"
+.LASF4167:
+	.string	"__rhs"
+.LASF2581:
+	.string	"_SC_NPROCESSORS_ONLN _SC_NPROCESSORS_ONLN"
+.LASF4216:
+	.string	"_ZNSt6vectorImSaImEEC2Ev"
+.LASF1010:
+	.string	"_EXT_NUMERIC_TRAITS 1"
+.LASF460:
+	.string	"_GLIBCXX11_DEPRECATED _GLIBCXX_DEPRECATED"
+.LASF1466:
+	.string	"INT8_MAX (127)"
+.LASF3079:
+	.string	"_ZNSt7__equalILb1EE5equalIcEEbPKT_S4_S4_"
+.LASF3891:
+	.string	"7lldiv_t"
+.LASF1997:
+	.string	"ENOTRECOVERABLE 131"
+.LASF2834:
+	.string	"CLONE_CHILD_CLEARTID 0x00200000"
+.LASF841:
+	.string	"_GLIBCXX_HAVE_LINUX_FUTEX 1"
+.LASF4082:
+	.string	"st_blksize"
+.LASF2318:
+	.string	"S_IREAD S_IRUSR"
+.LASF2689:
+	.string	"_SC_LEVEL2_CACHE_ASSOC _SC_LEVEL2_CACHE_ASSOC"
+.LASF3094:
+	.string	"to_int_type"
+.LASF3289:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_S_assignEPcmc"
+.LASF2814:
+	.string	"SCHED_RR 2"
+.LASF243:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF3567:
+	.string	"__type_identity<std::allocator<long unsigned int> >"
+.LASF2248:
+	.string	"PROT_EXEC 0x4"
+.LASF1236:
+	.string	"__U16_TYPE unsigned short int"
+.LASF3368:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendEPKcm"
+.LASF3064:
+	.string	"forward_iterator_tag"
+.LASF2767:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF2601:
+	.string	"_SC_INT_MAX _SC_INT_MAX"
+.LASF310:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF666:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF2969:
+	.string	"PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS"
+.LASF3049:
+	.string	"__cpp_lib_byte 201603L"
+.LASF2506:
+	.string	"_SC_TIMERS _SC_TIMERS"
+.LASF2711:
+	.string	"_SC_MINSIGSTKSZ _SC_MINSIGSTKSZ"
+.LASF1909:
+	.string	"EIDRM 43"
+.LASF335:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF4104:
+	.string	"sequential"
+.LASF2275:
+	.string	"MADV_UNMERGEABLE 13"
+.LASF3482:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4ERKS0_"
+.LASF2680:
+	.string	"_SC_TRACE_INHERIT _SC_TRACE_INHERIT"
+.LASF583:
+	.string	"__USE_POSIX199309 1"
+.LASF193:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF486:
+	.string	"_GLIBCXX_USE_DUAL_ABI 1"
+.LASF2615:
+	.string	"_SC_USHRT_MAX _SC_USHRT_MAX"
+.LASF1311:
+	.string	"__clockid_t_defined 1"
+.LASF4132:
+	.string	"find_chunk"
+.LASF3115:
+	.string	"_ZNSt15__new_allocatorIcE8allocateEmPKv"
+.LASF888:
+	.string	"_GLIBCXX_HAVE_STRTOLD 1"
+.LASF2964:
+	.string	"PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED"
+.LASF715:
+	.string	"_GLIBCXX_USE_C99_STDIO _GLIBCXX11_USE_C99_STDIO"
+.LASF2869:
+	.string	"CPU_COUNT(cpusetp) __CPU_COUNT_S (sizeof (cpu_set_t), cpusetp)"
+.LASF1436:
+	.string	"strtoull"
+.LASF2592:
+	.string	"_SC_2_CHAR_TERM _SC_2_CHAR_TERM"
+.LASF569:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF3457:
+	.string	"_Traits"
+.LASF925:
+	.string	"_GLIBCXX_HAVE_WCTYPE_H 1"
+.LASF2921:
+	.string	"MOD_CLKB ADJ_TICK"
+.LASF894:
+	.string	"_GLIBCXX_HAVE_SYS_IPC_H 1"
+.LASF3270:
+	.string	"_Char_alloc_type"
+.LASF3333:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4cendEv"
+.LASF3735:
+	.string	"move<simulator::result_reader::find_chunk(uint32_t, simulator::result_chunk&) const::<lambda(uint64_t, uint32_t)>&>"
+.LASF2145:
+	.string	"SYNC_FILE_RANGE_WAIT_BEFORE 1"
+.LASF3919:
+	.string	"__off64_t"
+.LASF1647:
+	.string	"wcstod"
+.LASF3060:
+	.string	"false_type"
+.LASF1648:
+	.string	"wcstof"
+.LASF3015:
+	.string	"_GLIBCXX_CDTOR_CALLABI "
+.LASF412:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF4033:
+	.string	"tm_wday"
+.LASF1650:
+	.string	"wcstol"
+.LASF1806:
+	.string	"FOPEN_MAX"
+.LASF883:
+	.string	"_GLIBCXX_HAVE_STRERROR_L 1"
+.LASF828:
+	.string	"_GLIBCXX_HAVE_ISNANL 1"
+.LASF4193:
+	.string	"position"
+.LASF3037:
+	.string	"ATOMIC_VAR_INIT(_VI) { _VI }"
+.LASF3337:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6lengthEv"
+.LASF768:
+	.string	"_PSTL_PRAGMA_MESSAGE(x) "
+.LASF847:
+	.string	"_GLIBCXX_HAVE_LOGF 1"
+.LASF78:
+	.string	"__GXX_WEAK__ 1"
+.LASF1899:
+	.string	"EDOM 33"
+.LASF3290:
+	.string	"_S_copy_chars"
+.LASF1680:
+	.string	"_BITS_LOCALE_H 1"
+.LASF81:
+	.string	"__cpp_rtti 199711L"
+.LASF2077:
+	.string	"F_SETOWN __F_SETOWN"
+.LASF3510:
+	.string	"_ZNSt15__new_allocatorImE10deallocateEPmm"
+.LASF1694:
+	.string	"LC_CTYPE __LC_CTYPE"
+.LASF3478:
+	.string	"_ZNSt15__exception_ptr13exception_ptr10_M_releaseEv"
+.LASF3873:
+	.string	"signed char"
+.LASF232:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1245:
+	.string	"__SLONG32_TYPE int"
+.LASF977:
+	.string	"_GLIBCXX_USE_LONG_LONG 1"
+.LASF1449:
+	.string	"assert_perror(errnum) (!(errnum) ? __ASSERT_VOID_CAST (0) : __assert_perror_fail ((errnum), __FILE__, __LINE__, __ASSERT_FUNCTION))"
+.LASF1965:
+	.string	"EADDRNOTAVAIL 99"
+.LASF3949:
+	.string	"_ZN6__pstl9execution2v118unsequenced_policy19__allow_unsequencedEv"
+.LASF1863:
+	.string	"_ERRNO_H 1"
+.LASF3359:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4backEv"
+.LASF1180:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF3350:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5clearEv"
+.LASF128:
+	.string	"__cpp_aligned_new 201606L"
+.LASF2477:
+	.string	"_PC_NAME_MAX _PC_NAME_MAX"
+.LASF950:
+	.string	"_GLIBCXX_HAS_GTHREADS 1"
+.LASF3754:
+	.string	"_Iter_comp_val<simulator::result_reader::find_chunk(uint32_t, simulator::result_chunk&) const::<lambda(uint64_t, uint32_t)> >"
+.LASF3675:
+	.string	"reverse_iterator<__gnu_cxx::__normal_iterator<long unsigned int*, std::vector<long unsigned int, std::allocator<long unsigned int> > > >"
+.LASF3234:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_Alloc_hiderC4EPcOS3_"
+.LASF2740:
+	.string	"_CS_XBS5_LP64_OFF64_LIBS _CS_XBS5_LP64_OFF64_LIBS"
+.LASF652:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1910:
+	.string	"ECHRNG 44"
+.LASF2866:
+	.string	"CPU_CLR(cpu,cpusetp) __CPU_CLR_S (cpu, sizeof (cpu_set_t), cpusetp)"
+.LASF2927:
+	.string	"STA_PPSFREQ 0x0002"
+.LASF722:
+	.string	"_GLIBCXX_HAVE_BUILTIN_HAS_UNIQ_OBJ_REP 1"
+.LASF318:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF342:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2258:
+	.string	"MAP_ANONYMOUS 0x20"
+.LASF1105:
+	.string	"_GLIBCXX_BITS_UNIFORM_INT_DIST_H "
+.LASF2479:
+	.string	"_PC_PIPE_BUF _PC_PIPE_BUF"
+.LASF1076:
+	.string	"__glibcxx_requires_sorted_pred(_First,_Last,_Pred) "
+.LASF3385:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEmRKS4_mm"
+.LASF1389:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF658:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF2382:
+	.string	"_POSIX2_C_DEV __POSIX2_THIS_VERSION"
+.LASF1270:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF391:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF2175:
+	.string	"_BITS_STAT_H 1"
+.LASF3463:
+	.string	"_ZNSt16initializer_listIcEC4Ev"
+.LASF2891:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF3599:
+	.string	"_ZNSt6vectorImSaImEE5beginEv"
+.LASF2562:
+	.string	"_SC_PII_OSI_M _SC_PII_OSI_M"
+.LASF618:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF432:
+	.string	"__unix 1"
+.LASF2881:
+	.string	"CPU_OR_S(setsize,destset,srcset1,srcset2) __CPU_OP_S (setsize, destset, srcset1, srcset2, |)"
+.LASF1868:
+	.string	"ENOENT 2"
+.LASF777:
+	.string	"_GLIBCXX_HAVE_ASINF 1"
+.LASF126:
+	.string	"__cpp_nontype_template_parameter_auto 201606L"
+.LASF2570:
+	.string	"_SC_THREAD_DESTRUCTOR_ITERATIONS _SC_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF539:
+	.string	"__USE_MISC"
+.LASF1514:
+	.string	"INT16_C(c) c"
+.LASF1593:
+	.string	"__need___va_list"
+.LASF3941:
+	.string	"_ZN6__pstl9execution2v115parallel_policy19__allow_unsequencedEv"
+.LASF1034:
+	.string	"__cpp_lib_type_trait_variable_templates 201510L"
+.LASF4026:
+	.string	"__isoc99_vwscanf"
+.LASF770:
+	.string	"_PSTL_CPP11_STD_ROTATE_BROKEN ((__GLIBCXX__ && __GLIBCXX__ < 20150716) || (_MSC_VER && _MSC_VER < 1800))"
+.LASF1605:
+	.string	"btowc"
+.LASF2669:
+	.string	"_SC_2_PBS_TRACK _SC_2_PBS_TRACK"
+.LASF2377:
+	.string	"_POSIX_VERSION 200809L"
+.LASF1230:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF2000:
+	.string	"ENOTSUP EOPNOTSUPP"
+.LASF2566:
+	.string	"_SC_GETGR_R_SIZE_MAX _SC_GETGR_R_SIZE_MAX"
+.LASF3848:
+	.string	"__normal_iterator<long unsigned int const*, std::vector<long unsigned int, std::allocator<long unsigned int> > >"
+.LASF2612:
+	.string	"_SC_UCHAR_MAX _SC_UCHAR_MAX"
+.LASF897:
+	.string	"_GLIBCXX_HAVE_SYS_SDT_H 1"
+.LASF1734:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF3822:
+	.string	"_S_mutex"
+.LASF543:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2762:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_CFLAGS _CS_POSIX_V7_ILP32_OFF32_CFLAGS"
+.LASF3746:
+	.string	"end<char const, 8>"
+.LASF3020:
+	.string	"__cpp_lib_shared_ptr_arrays 201611L"
+.LASF2186:
+	.string	"__S_IFBLK 0060000"
+.LASF2553:
+	.string	"_SC_PII_OSI _SC_PII_OSI"
+.LASF4148:
+	.string	"mmap"
+.LASF3227:
+	.string	"select_on_container_copy_construction"
+.LASF1541:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF1774:
+	.string	"__cpp_lib_constexpr_string 201611L"
+.LASF1828:
+	.string	"fputc"
+.LASF292:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF2961:
+	.string	"PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM"
+.LASF3534:
+	.string	"_ZNSt12_Vector_baseImSaImEE17_Vector_impl_dataC4EOS2_"
+.LASF3298:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_assignERKS4_"
+.LASF3536:
+	.string	"_ZNSt12_Vector_baseImSaImEE17_Vector_impl_data12_M_copy_dataERKS2_"
+.LASF1655:
+	.string	"wmemcmp"
+.LASF3637:
+	.string	"_ZNSt6vectorImSaImEE6insertEN9__gnu_cxx17__normal_iteratorIPKmS1_EEmRS4_"
+.LASF3766:
+	.string	"_S_propagate_on_copy_assign"
+.LASF3170:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4dataEv"
+.LASF1111:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF3901:
+	.string	"__uint64_t"
+.LASF3119:
+	.string	"max_size"
+.LASF491:
+	.string	"_GLIBCXX_DEFAULT_ABI_TAG _GLIBCXX_ABI_TAG_CXX11"
+.LASF2860:
+	.string	"__CPU_ALLOC(count) __sched_cpualloc (count)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF3727:
+	.string	"_II1"
+.LASF3728:
+	.string	"_II2"
+.LASF2971:
+	.string	"PTHREAD_ONCE_INIT 0"
+.LASF2460:
+	.string	"_XBS5_LP64_OFF64 1"
+.LASF2119:
+	.string	"DN_MULTISHOT 0x80000000"
+.LASF2754:
+	.string	"_CS_POSIX_V6_LP64_OFF64_CFLAGS _CS_POSIX_V6_LP64_OFF64_CFLAGS"
+.LASF1760:
+	.string	"_GLIBCXX_MEM_FN_TRAITS2"
+.LASF3073:
+	.string	"char_traits<char>"
+.LASF3621:
+	.string	"_M_range_check"
+.LASF2321:
+	.string	"ACCESSPERMS (S_IRWXU|S_IRWXG|S_IRWXO)"
+.LASF200:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1947:
+	.string	"ELIBSCN 81"
+.LASF687:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2658:
+	.string	"_SC_THREAD_SPORADIC_SERVER _SC_THREAD_SPORADIC_SERVER"
+.LASF386:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2022:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_REINIT"
+.LASF1091:
+	.string	"_GLIBCXX_PREDEFINED_OPS_H 1"
+.LASF4217:
+	.string	"_ZNSt12_Vector_baseImSaImEEC2Ev"
+.LASF2886:
+	.string	"_TIME_H 1"
+.LASF3176:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEE4swapERS2_"
+.LASF686:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF379:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2978:
+	.string	"pthread_cleanup_pop_restore_np(execute) __clframe.__restore (); __clframe.__setdoit (execute); } while (0)"
+.LASF28:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF2777:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS"
+.LASF113:
+	.string	"__cpp_nontype_template_args 201411L"
+.LASF793:
+	.string	"_GLIBCXX_HAVE_DECL_STRNLEN 1"
+.LASF3509:
+	.string	"_ZNSt15__new_allocatorImE8allocateEmPKv"
+.LASF2020:
+	.string	"_STL_BVECTOR_H 1"
+.LASF1574:
+	.string	"strcspn"
+.LASF1038:
+	.string	"__cpp_lib_addressof_constexpr 201603L"
+.LASF3707:
+	.string	"_Distance"
+.LASF2408:
+	.string	"_XOPEN_SHM 1"
+.LASF3278:
+	.string	"_M_check_length"
+.LASF3582:
+	.string	"_ZNSt6vectorImSaImEEC4ERKS0_"
+.LASF1948:
+	.string	"ELIBMAX 82"
+.LASF3831:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaImEmE15_S_nothrow_moveEv"
+.LASF119:
+	.string	"__cpp_aggregate_bases 201603L"
+.LASF2691:
+	.string	"_SC_LEVEL3_CACHE_SIZE _SC_LEVEL3_CACHE_SIZE"
+.LASF2013:
+	.string	"__cpp_lib_raw_memory_algorithms 201606L"
+.LASF2596:
+	.string	"_SC_XOPEN_XPG3 _SC_XOPEN_XPG3"
+.LASF487:
+	.string	"_GLIBCXX_USE_CXX11_ABI 1"
+.LASF3423:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE4dataEv"
+.LASF3777:
+	.string	"other"
+.LASF528:
+	.string	"__USE_POSIX199506"
+.LASF3242:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ENS4_12__sv_wrapperERKS3_"
+.LASF4118:
+	.string	"result_chunk_header"
+.LASF987:
+	.string	"_GLIBCXX_USE_SCHED_YIELD 1"
+.LASF2492:
+	.string	"_PC_ALLOC_SIZE_MIN _PC_ALLOC_SIZE_MIN"
+.LASF3678:
+	.string	"iterator_category"
+.LASF2847:
+	.string	"_BITS_CPU_SET_H 1"
+.LASF208:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF221:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF3723:
+	.string	"forward<long unsigned int const&>"
+.LASF2257:
+	.string	"MAP_FILE 0"
+.LASF3615:
+	.string	"_ZNSt6vectorImSaImEE13shrink_to_fitEv"
+.LASF494:
+	.string	"_GLIBCXX_END_NAMESPACE_VERSION "
+.LASF501:
+	.string	"_GLIBCXX_LONG_DOUBLE_COMPAT"
+.LASF428:
+	.string	"__SEG_GS 1"
+.LASF1000:
+	.string	"_GTHREAD_USE_MUTEX_TIMEDLOCK 1"
+.LASF32:
+	.string	"__CHAR_BIT__ 8"
+.LASF3274:
+	.string	"_M_use_local_data"
+.LASF1608:
+	.string	"fputwc"
+.LASF2925:
+	.string	"MOD_NANO ADJ_NANO"
+.LASF1698:
+	.string	"LC_MONETARY __LC_MONETARY"
+.LASF3417:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE9_M_appendEPKcm"
+.LASF875:
+	.string	"_GLIBCXX_HAVE_SINL 1"
+.LASF2288:
+	.string	"POSIX_MADV_NORMAL 0"
+.LASF274:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF880:
+	.string	"_GLIBCXX_HAVE_STDBOOL_H 1"
+.LASF868:
+	.string	"_GLIBCXX_HAVE_SETENV 1"
+.LASF504:
+	.string	"_GLIBCXX_BEGIN_NAMESPACE_LDBL "
+.LASF3585:
+	.string	"_ZNSt6vectorImSaImEEC4ERKS1_"
+.LASF1209:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF936:
+	.string	"_GLIBCXX_STDC_HEADERS 1"
+.LASF1712:
+	.string	"LC_MESSAGES_MASK (1 << __LC_MESSAGES)"
+.LASF684:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF102:
+	.string	"__cpp_generic_lambdas 201304L"
+.LASF2026:
+	.string	"_FCNTL_H 1"
+.LASF4188:
+	.string	"_ZNSt12_Vector_baseImSaImEED2Ev"
+.LASF2899:
+	.string	"CLOCK_TAI 11"
+.LASF3188:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4findEPKcmm"
+.LASF1853:
+	.string	"tmpnam"
+.LASF3771:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE20_S_propagate_on_swapEv"
+.LASF2606:
+	.string	"_SC_NZERO _SC_NZERO"
+.LASF683:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF3147:
+	.string	"rbegin"
+.LASF748:
+	.string	"_PSTL_PRAGMA_SIMD_SCAN(PRM) "
+.LASF669:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF3872:
+	.string	"long long unsigned int"
+.LASF3133:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEEC4ERKS2_"
+.LASF3768:
+	.string	"_S_propagate_on_move_assign"
+.LASF2895:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF3517:
+	.string	"_ZNSaImEC4ERKS_"
+.LASF2234:
+	.string	"MAP_32BIT 0x40"
+.LASF1656:
+	.string	"wmemcpy"
+.LASF3190:
+	.string	"rfind"
+.LASF2101:
+	.string	"F_WRLCK 1"
+.LASF903:
+	.string	"_GLIBCXX_HAVE_SYS_TIME_H 1"
+.LASF3858:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEpLEl"
+.LASF2357:
+	.string	"STATX_SIZE 0x00000200U"
+.LASF388:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF2474:
+	.string	"_PC_LINK_MAX _PC_LINK_MAX"
+.LASF245:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF4231:
+	.string	"~_Vector_impl"
+.LASF778:
+	.string	"_GLIBCXX_HAVE_ASINL 1"
+.LASF3023:
+	.string	"_SHARED_PTR_ATOMIC_H 1"
+.LASF691:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF922:
+	.string	"_GLIBCXX_HAVE_VWSCANF 1"
+.LASF1749:
+	.string	"isblank"
+.LASF678:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF3310:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4EOS4_"
+.LASF3845:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEmIEl"
+.LASF1298:
+	.string	"__dev_t_defined "
+.LASF105:
+	.string	"__cpp_variable_templates 201304L"
+.LASF3005:
+	.string	"_PTRDIFF_T_ "
+.LASF2374:
+	.string	"__statx_timestamp_defined 1"
+.LASF2129:
+	.string	"RWH_WRITE_LIFE_MEDIUM 3"
+.LASF3087:
+	.string	"copy"
+.LASF1972:
+	.string	"EISCONN 106"
+.LASF4175:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEC2ERKS2_"
+.LASF2283:
+	.string	"MADV_PAGEOUT 21"
+.LASF1951:
+	.string	"ERESTART 85"
+.LASF1428:
+	.string	"system"
+.LASF1555:
+	.string	"WINT_WIDTH 32"
+.LASF3725:
+	.string	"__equal_aux1<char const*, char*>"
+.LASF952:
+	.string	"_GLIBCXX_MANGLE_SIZE_T m"
+.LASF1045:
+	.string	"_GLIBCXX_DEPRECATED_PAIR_CTOR __attribute__ ((__deprecated__ (\"use 'nullptr' instead of '0' to \" \"initialize std::pair of move-only \" \"type and pointer\")))"
+.LASF581:
+	.string	"__USE_POSIX 1"
+.LASF1886:
+	.string	"ENOTDIR 20"
+.LASF3761:
+	.string	"__alloc_traits<std::allocator<char>, char>"
+.LASF3656:
+	.string	"_M_emplace_aux"
+.LASF2572:
+	.string	"_SC_THREAD_STACK_MIN _SC_THREAD_STACK_MIN"
+.LASF434:
+	.string	"__ELF__ 1"
+.LASF312:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF348:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF3090:
+	.string	"_ZNSt11char_traitsIcE6assignEPcmc"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF4135:
+	.string	"_ZN9simulator13result_readeraSERKS0_"
+.LASF824:
+	.string	"_GLIBCXX_HAVE_INTTYPES_H 1"
+.LASF3782:
+	.string	"operator*"
+.LASF3206:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE17find_first_not_ofES2_m"
+.LASF3281:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE8_M_limitEmm"
+.LASF3798:
+	.string	"operator-"
+.LASF27:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF2125:
+	.string	"RWH_WRITE_LIFE_NOT_SET 0"
+.LASF647:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF3939:
+	.string	"_ZN6__pstl9execution2v116sequenced_policy16__allow_parallelEv"
+.LASF3887:
+	.string	"div_t"
+.LASF2311:
+	.string	"S_ISREG(mode) __S_ISTYPE((mode), __S_IFREG)"
+.LASF3136:
+	.string	"operator="
+.LASF696:
+	.string	"__stub_revoke "
+.LASF2123:
+	.string	"F_SEAL_WRITE 0x0008"
+.LASF3416:
+	.string	"_M_append"
+.LASF97:
+	.string	"__cpp_inheriting_constructors 201511L"
+.LASF1772:
+	.string	"__cpp_lib_string_view 201803L"
+.LASF680:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1835:
+	.string	"ftell"
+.LASF1221:
+	.string	"__CFLOAT32 _Complex float"
+.LASF1919:
+	.string	"EBADR 53"
+.LASF3057:
+	.string	"operator std::integral_constant<bool, true>::value_type"
+.LASF1306:
+	.string	"__id_t_defined "
+.LASF3045:
+	.string	"__RESULT_FILE_H__ "
+.LASF2029:
+	.string	"F_SETLK64 6"
+.LASF3122:
+	.string	"_ZNKSt15__new_allocatorIcE11_M_max_sizeEv"
+.LASF415:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1958:
+	.string	"ENOPROTOOPT 92"
+.LASF1422:
+	.string	"rand"
+.LASF3447:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE16find_last_not_ofEPKcmm"
+.LASF1949:
+	.string	"ELIBEXEC 83"
+.LASF3271:
+	.string	"_M_get_allocator"
+.LASF668:
+	.string	"__restrict_arr "
+.LASF3103:
+	.string	"_ZNSt15__new_allocatorIcEC4Ev"
+.LASF650:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF453:
+	.string	"_GLIBCXX_CONST __attribute__ ((__const__))"
+.LASF134:
+	.string	"__cpp_exceptions 199711L"
+.LASF2405:
+	.string	"_POSIX_NO_TRUNC 1"
+.LASF521:
+	.string	"__USE_ISOC11"
+.LASF2015:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_REINIT "
+.LASF1194:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF148:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2650:
+	.string	"_SC_READER_WRITER_LOCKS _SC_READER_WRITER_LOCKS"
+.LASF1815:
+	.string	"__attr_dealloc_fclose"
+.LASF3778:
+	.string	"__normal_iterator<char*, std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> > >"
+.LASF1129:
+	.string	"_SIZE_T "
+.LASF2373:
+	.string	"STATX_ATTR_DAX 0x00200000"
+.LASF1065:
+	.string	"__cpp_lib_array_constexpr 201803L"
+.LASF2732:
+	.string	"_CS_XBS5_ILP32_OFF32_LIBS _CS_XBS5_ILP32_OFF32_LIBS"
+.LASF2857:
+	.string	"__CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)"
+.LASF995:
+	.string	"_GLIBCXX_USE_UTIMENSAT 1"
+.LASF23:
+	.string	"__LP64__ 1"
+.LASF2436:
+	.string	"_POSIX_SPIN_LOCKS 200809L"
+.LASF2242:
+	.string	"MAP_STACK 0x20000"
+.LASF2571:
+	.string	"_SC_THREAD_KEYS_MAX _SC_THREAD_KEYS_MAX"
+.LASF442:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1691:
+	.string	"__LC_TELEPHONE 10"
+.LASF2141:
+	.string	"POSIX_FADV_SEQUENTIAL 2"
+.LASF1478:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF4057:
+	.string	"n_sign_posn"
+.LASF2324:
+	.string	"S_BLKSIZE 512"
+.LASF2433:
+	.string	"_POSIX_READER_WRITER_LOCKS 200809L"
+.LASF1104:
+	.string	"__cpp_lib_hardware_interference_size 201703L"
+.LASF1800:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF622:
+	.string	"__NTHNL(fct) fct __THROW"
+.LASF1367:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF2416:
+	.string	"_POSIX_THREAD_PRIO_PROTECT 200809L"
+.LASF3950:
+	.string	"_ZN6__pstl9execution2v118unsequenced_policy14__allow_vectorEv"
+.LASF1881:
+	.string	"ENOTBLK 15"
+.LASF1022:
+	.string	"_GLIBCXX_TYPE_TRAITS 1"
+.LASF1498:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1177:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF271:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF3528:
+	.string	"_Vector_base<long unsigned int, std::allocator<long unsigned int> >"
+.LASF1798:
+	.string	"SEEK_HOLE 4"
+.LASF3660:
+	.string	"_S_check_init_len"
+.LASF3724:
+	.string	"_ZSt7forwardIRKmEOT_RNSt16remove_referenceIS2_E4typeE"
+.LASF1922:
+	.string	"EBADRQC 56"
+.LASF738:
+	.string	"_PSTL_STRING_AUX(x) #x"
+.LASF928:
+	.string	"_GLIBCXX_ICONV_CONST "
+.LASF3374:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignERKS4_"
+.LASF2043:
+	.string	"O_SYNC 04010000"
+.LASF3116:
+	.string	"size_type"
+.LASF1312:
+	.string	"__time_t_defined 1"
+.LASF2922:
+	.string	"MOD_CLKA ADJ_OFFSET_SINGLESHOT"
+.LASF1896:
+	.string	"EROFS 30"
+.LASF3884:
+	.string	"__unknown__"
+.LASF3730:
+	.string	"_ZSt12__niter_baseIPcET_S1_"
+.LASF1866:
+	.string	"_ASM_GENERIC_ERRNO_BASE_H "
+.LASF3781:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEC4ERKS1_"
+.LASF1685:
+	.string	"__LC_MONETARY 4"
+.LASF2824:
+	.string	"CLONE_SIGHAND 0x00000800"
+.LASF2521:
+	.string	"_SC_DELAYTIMER_MAX _SC_DELAYTIMER_MAX"
+.LASF1954:
+	.string	"ENOTSOCK 88"
+.LASF3581:
+	.string	"_ZNSt6vectorImSaImEEC4Ev"
+.LASF530:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2938:
+	.string	"STA_CLOCKERR 0x1000"
+.LASF846:
+	.string	"_GLIBCXX_HAVE_LOG10L 1"
+.LASF1090:
+	.string	"__glibcxx_requires_irreflexive_pred2(_First,_Last,_Pred) "
+.LASF1519:
+	.string	"UINT32_C(c) c ## U"
+.LASF882:
+	.string	"_GLIBCXX_HAVE_STDLIB_H 1"
+.LASF1938:
+	.string	"EMULTIHOP 72"
+.LASF3320:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEaSESt16initializer_listIcE"
+.LASF4207:
+	.string	"degrees"
+.LASF4021:
+	.string	"FILE"
+.LASF3137:
+	.string	"_ZNSaIcEaSERKS_"
+.LASF199:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF2052:
+	.string	"__O_DSYNC 010000"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2135:
+	.string	"FNONBLOCK O_NONBLOCK"
+.LASF2963:
+	.string	"PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1759:
+	.string	"_GLIBCXX_MEM_FN_TRAITS"
+.LASF2575:
+	.string	"_SC_THREAD_ATTR_STACKSIZE _SC_THREAD_ATTR_STACKSIZE"
+.LASF1357:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF246:
+	.string	"__LDBL_DIG__ 18"
+.LASF3386:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEmPKcm"
+.LASF3905:
+	.string	"__uint_least16_t"
+.LASF3255:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE13_M_local_dataEv"
+.LASF3238:
+	.string	"__sv_type"
+.LASF1030:
+	.string	"__cpp_lib_void_t 201411L"
+.LASF2906:
+	.string	"ADJ_STATUS 0x0010"
+.LASF1157:
+	.string	"___int_wchar_t_h "
+.LASF3220:
+	.string	"_ZNSt16allocator_traitsISaIcEE8allocateERS0_m"
+.LASF1261:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF727:
+	.string	"_GLIBCXX_USE_TBB_PAR_BACKEND __has_include(<tbb/tbb.h>)"
+.LASF2722:
+	.string	"_CS_LFS_CFLAGS _CS_LFS_CFLAGS"
+.LASF2246:
+	.string	"PROT_READ 0x1"
+.LASF496:
+	.string	"_GLIBCXX_BEGIN_NAMESPACE_CONTAINER "
+.LASF2078:
+	.string	"F_GETOWN __F_GETOWN"
+.LASF1337:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF3502:
+	.string	"memory_order_seq_cst"
+.LASF1125:
+	.string	"__need_wchar_t "
+.LASF3244:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12__sv_wrapperC4ESt17basic_string_viewIcS2_E"
+.LASF2451:
+	.string	"_POSIX_TRACE_EVENT_FILTER -1"
+.LASF2385:
+	.string	"_XOPEN_VERSION 700"
+.LASF2508:
+	.string	"_SC_PRIORITIZED_IO _SC_PRIORITIZED_IO"
+.LASF2458:
+	.string	"_POSIX_V7_LP64_OFF64 1"
+.LASF2485:
+	.string	"_PC_PRIO_IO _PC_PRIO_IO"
+.LASF3893:
+	.string	"char"
+.LASF4091:
+	.string	"simulator"
+.LASF4171:
+	.string	"_ZNSt15__new_allocatorImEC2Ev"
+.LASF130:
+	.string	"__cpp_template_template_args 201611L"
+.LASF2085:
+	.string	"F_SETOWN_EX __F_SETOWN_EX"
+.LASF2766:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_CFLAGS _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS"
+.LASF1780:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF1317:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1362:
+	.string	"__FDS_BITS(set) ((set)->fds_bits)"
+.LASF337:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2657:
+	.string	"_SC_SPORADIC_SERVER _SC_SPORADIC_SERVER"
+.LASF1500:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1148:
+	.string	"_WCHAR_T "
+.LASF1107:
+	.string	"_GLIBCXX_INCLUDE_NEXT_C_HEADERS "
+.LASF2835:
+	.string	"CLONE_DETACHED 0x00400000"
+.LASF3499:
+	.string	"memory_order_acquire"
+.LASF2525:
+	.string	"_SC_PAGESIZE _SC_PAGESIZE"
+.LASF723:
+	.string	"_GLIBCXX_HAVE_BUILTIN_IS_AGGREGATE 1"
+.LASF270:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF2796:
+	.string	"__cpp_lib_make_unique 201304L"
+.LASF1096:
+	.string	"_GLIBCXX_ALGORITHMFWD_H 1"
+.LASF736:
+	.string	"_PSTL_USAGE_WARNINGS 0"
+.LASF2598:
+	.string	"_SC_CHAR_BIT _SC_CHAR_BIT"
+.LASF1718:
+	.string	"LC_IDENTIFICATION_MASK (1 << __LC_IDENTIFICATION)"
+.LASF3912:
+	.string	"__dev_t"
+.LASF100:
+	.string	"__cpp_return_type_deduction 201304L"
+.LASF830:
+	.string	"_GLIBCXX_HAVE_LC_MESSAGES 1"
+.LASF2735:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LDFLAGS _CS_XBS5_ILP32_OFFBIG_LDFLAGS"
+.LASF3125:
+	.string	"allocator"
+.LASF2936:
+	.string	"STA_PPSWANDER 0x0400"
+.LASF767:
+	.string	"_PSTL_PRAGMA_MESSAGE_IMPL(x) _PSTL_PRAGMA(message(_PSTL_STRING_CONCAT(_PSTL_PRAGMA_LOCATION, x)))"
+.LASF1271:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF646:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF2913:
+	.string	"ADJ_OFFSET_SINGLESHOT 0x8001"
+.LASF1795:
+	.string	"SEEK_CUR 1"
+.LASF732:
+	.string	"_PSTL_VERSION 12000"
+.LASF2504:
+	.string	"_SC_REALTIME_SIGNALS _SC_REALTIME_SIGNALS"
+.LASF2038:
+	.string	"O_NOCTTY 0400"
+.LASF1471:
+	.string	"UINT16_MAX (65535)"
+.LASF962:
+	.string	"_GLIBCXX_USE_C99_CTYPE_TR1 1"
+.LASF4102:
+	.string	"alias_table"
+.LASF590:
+	.string	"_LARGEFILE_SOURCE"
+.LASF673:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF3143:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE6cbeginEv"
+.LASF1581:
+	.string	"strrchr"
+.LASF533:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2047:
+	.string	"__O_NOFOLLOW 0400000"
+.LASF3169:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE4backEv"
+.LASF4141:
+	.string	"munmap"
+.LASF3325:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE3endEv"
+.LASF3808:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEptEv"
+.LASF3738:
+	.string	"__equal_aux<char const*, char*>"
+.LASF4036:
+	.string	"tm_gmtoff"
+.LASF2883:
+	.string	"CPU_ALLOC_SIZE(count) __CPU_ALLOC_SIZE (count)"
+.LASF614:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1224:
+	.string	"__CFLOAT64X _Complex long double"
+.LASF3661:
+	.string	"_ZNSt6vectorImSaImEE17_S_check_init_lenEmRKS0_"
+.LASF1970:
+	.string	"ECONNRESET 104"
+.LASF2147:
+	.string	"SYNC_FILE_RANGE_WAIT_AFTER 4"
+.LASF255:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF437:
+	.string	"_REENTRANT 1"
+.LASF2254:
+	.string	"MAP_SHARED_VALIDATE 0x03"
+.LASF2100:
+	.string	"F_RDLCK 0"
+.LASF2840:
+	.string	"CLONE_NEWIPC 0x08000000"
+.LASF2060:
+	.string	"O_LARGEFILE __O_LARGEFILE"
+.LASF1582:
+	.string	"strspn"
+.LASF2962:
+	.string	"PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS"
+.LASF2875:
+	.string	"CPU_EQUAL(cpusetp1,cpusetp2) __CPU_EQUAL_S (sizeof (cpu_set_t), cpusetp1, cpusetp2)"
+.LASF3367:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6appendERKS4_mm"
+.LASF1446:
+	.string	"__ASSERT_VOID_CAST static_cast<void>"
+.LASF396:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1629:
+	.string	"vwscanf"
+.LASF4047:
+	.string	"mon_grouping"
+.LASF1142:
+	.string	"_GCC_SIZE_T "
+.LASF2988:
+	.string	"__gthrw(name) __gthrw2(__gthrw_ ## name,name,name)"
+.LASF3097:
+	.string	"_ZNSt11char_traitsIcE11eq_int_typeERKiS2_"
+.LASF3092:
+	.string	"_ZNSt11char_traitsIcE12to_char_typeERKi"
+.LASF2868:
+	.string	"CPU_ZERO(cpusetp) __CPU_ZERO_S (sizeof (cpu_set_t), cpusetp)"
+.LASF831:
+	.string	"_GLIBCXX_HAVE_LDEXPF 1"
+.LASF3424:
+	.string	"get_allocator"
+.LASF1551:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF755:
+	.string	"_PSTL_CPP14_VARIABLE_TEMPLATES_PRESENT (!__INTEL_COMPILER || __INTEL_COMPILER >= 1700) && (_MSC_FULL_VER >= 190023918 || __cplusplus >= 201402L)"
+.LASF1513:
+	.string	"INT8_C(c) c"
+.LASF2789:
+	.string	"_GLIBCXX_ALIGN_H 1"
+.LASF3864:
+	.string	"_ZN9__gnu_cxxmiIPmSt6vectorImSaImEEEENS_17__normal_iteratorIT_T0_E15difference_typeERKS8_SB_"
+.LASF1163:
+	.string	"__need_wchar_t"
+.LASF3501:
+	.string	"memory_order_acq_rel"
+.LASF171:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF3968:
+	.string	"int_fast32_t"
+.LASF3846:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPmSt6vectorImSaImEEEmiEl"
+.LASF3453:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareEmmRKS4_mm"
+.LASF278:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF3620:
+	.string	"_ZNKSt6vectorImSaImEEixEm"
+.LASF2143:
+	.string	"POSIX_FADV_DONTNEED __POSIX_FADV_DONTNEED"
+.LASF2731:
+	.string	"_CS_XBS5_ILP32_OFF32_LDFLAGS _CS_XBS5_ILP32_OFF32_LDFLAGS"
+.LASF1237:
+	.string	"__S32_TYPE int"
+.LASF2338:
+	.string	"_ASM_X86_POSIX_TYPES_64_H "
+.LASF3852:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEEptEv"
+.LASF2998:
+	.string	"_STDDEF_H "
+.LASF1130:
+	.string	"_SYS_SIZE_T_H "
+.LASF3647:
+	.string	"_ZNSt6vectorImSaImEE14_M_fill_assignEmRKm"
+.LASF2806:
+	.string	"_GLIBCXX_GCC_GTHR_POSIX_H "
+.LASF2631:
+	.string	"_SC_BASE _SC_BASE"
+.LASF3249:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7_M_dataEPc"
+.LASF744:
+	.string	"_PSTL_PRAGMA_SIMD _PSTL_PRAGMA(omp simd)"
+.LASF2289:
+	.string	"POSIX_MADV_RANDOM 1"
+.LASF1285:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2314:
+	.string	"S_ISSOCK(mode) __S_ISTYPE((mode), __S_IFSOCK)"
+.LASF1884:
+	.string	"EXDEV 18"
+.LASF2565:
+	.string	"_SC_THREAD_SAFE_FUNCTIONS _SC_THREAD_SAFE_FUNCTIONS"
+.LASF4165:
+	.string	"__val"
+.LASF291:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF135:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF3455:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7compareEmmPKc"
+.LASF1319:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF3963:
+	.string	"uint_least16_t"
+.LASF2448:
+	.string	"_POSIX_SPORADIC_SERVER -1"
+.LASF3603:
+	.string	"_ZNSt6vectorImSaImEE6rbeginEv"
+.LASF775:
+	.string	"_GLIBCXX_HAVE_ARC4RANDOM 1"
+.LASF1134:
+	.string	"_SIZE_T_ "
+.LASF2362:
+	.string	"STATX_DIOALIGN 0x00002000U"
+.LASF2352:
+	.string	"STATX_GID 0x00000010U"
+.LASF4105:
+	.string	"stub_shuffle"
+.LASF2379:
+	.string	"_POSIX2_VERSION __POSIX2_THIS_VERSION"
+.LASF235:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF484:
+	.string	"_GLIBCXX_NOEXCEPT_QUAL noexcept (_NE)"
+.LASF389:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF183:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2586:
+	.string	"_SC_XOPEN_VERSION _SC_XOPEN_VERSION"
+.LASF3601:
+	.string	"_ZNSt6vectorImSaImEE3endEv"
+.LASF3165:
+	.string	"front"
+.LASF2457:
+	.string	"_XBS5_LPBIG_OFFBIG -1"
+.LASF2811:
+	.string	"_BITS_SCHED_H 1"
+.LASF2843:
+	.string	"CLONE_NEWNET 0x40000000"
+.LASF356:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF971:
+	.string	"_GLIBCXX_USE_DEV_RANDOM 1"
+.LASF131:
+	.string	"__cpp_threadsafe_static_init 200806L"
+.LASF2108:
+	.string	"LOCK_UN 8"
+.LASF3381:
+	.string	"insert"
+.LASF783:
+	.string	"_GLIBCXX_HAVE_ATANL 1"
+.LASF3191:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE5rfindES2_m"
+.LASF1675:
+	.string	"__cpp_lib_incomplete_container_elements 201505L"
+.LASF2813:
+	.string	"SCHED_FIFO 1"
+.LASF914:
+	.string	"_GLIBCXX_HAVE_TRUNCATE 1"
+.LASF2533:
+	.string	"_SC_BC_DIM_MAX _SC_BC_DIM_MAX"
+.LASF1470:
+	.string	"UINT8_MAX (255)"
+.LASF2472:
+	.string	"L_INCR SEEK_CUR"
+.LASF613:
+	.string	"__PMT"
+.LASF2990:
+	.string	"_GLIBCXX_READ_MEM_BARRIER __atomic_thread_fence (__ATOMIC_ACQUIRE)"
+.LASF2126:
+	.string	"RWF_WRITE_LIFE_NOT_SET RWH_WRITE_LIFE_NOT_SET"
+.LASF1769:
+	.string	"_HASH_BYTES_H 1"
+.LASF2107:
+	.string	"LOCK_NB 4"
+.LASF3168:
+	.string	"data"
+.LASF344:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF2715:
+	.string	"_CS_POSIX_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS"
+.LASF1021:
+	.string	"_STL_PAIR_H 1"
+.LASF378:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF2991:
+	.string	"_GLIBCXX_WRITE_MEM_BARRIER __atomic_thread_fence (__ATOMIC_RELEASE)"
+.LASF2589:
+	.string	"_SC_XOPEN_CRYPT _SC_XOPEN_CRYPT"
+.LASF3493:
+	.string	"_ZNKSt15__exception_ptr13exception_ptr20__cxa_exception_typeEv"
+.LASF753:
+	.string	"_PSTL_CPP14_MAKE_REVERSE_ITERATOR_PRESENT (_MSC_VER >= 1900 || __cplusplus >= 201402L || __cpp_lib_make_reverse_iterator == 201402)"
+.LASF1143:
+	.string	"_SIZET_ "
+.LASF3481:
+	.string	"_ZNSt15__exception_ptr13exception_ptrC4Ev"
+.LASF1616:
+	.string	"mbrtowc"
+.LASF2268:
+	.string	"MADV_WILLNEED 3"
+.LASF3205:
+	.string	"find_first_not_of"
+.LASF2241:
+	.string	"MAP_NONBLOCK 0x10000"
+.LASF4045:
+	.string	"mon_decimal_point"
+.LASF475:
+	.string	"_GLIBCXX23_CONSTEXPR "
+.LASF2739:
+	.string	"_CS_XBS5_LP64_OFF64_LDFLAGS _CS_XBS5_LP64_OFF64_LDFLAGS"
+.LASF800:
+	.string	"_GLIBCXX_HAVE_EXPF 1"
+.LASF2124:
+	.string	"F_SEAL_FUTURE_WRITE 0x0010"
+.LASF1131:
+	.string	"_T_SIZE_ "
+.LASF3361:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEpLERKS4_"
+.LASF4151:
+	.string	"open"
+.LASF3076:
+	.string	"_ZNSt11char_traitsIcE2eqERKcS2_"
+.LASF4076:
+	.string	"st_mode"
+.LASF3179:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE6substrEmm"
+.LASF467:
+	.string	"_GLIBCXX20_DEPRECATED_SUGGEST(ALT) "
+.LASF2663:
+	.string	"_SC_USER_GROUPS _SC_USER_GROUPS"
+.LASF1714:
+	.string	"LC_NAME_MASK (1 << __LC_NAME)"
+.LASF4005:
+	.string	"_chain"
+.LASF4237:
+	.string	"typedef __va_list_tag __va_list_tag"
+.LASF3402:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE7replaceEmmmc"
+.LASF3931:
+	.string	"__compar_fn_t"
+.LASF440:
+	.string	"SIMULATOR_MIN_LOG_LEVEL DEBUG"
+.LASF1669:
+	.string	"_GLIBCXX_OPERATOR_NEW ::operator new"
+.LASF2955:
+	.string	"PTHREAD_ERRORCHECK_MUTEX_INITIALIZER_NP { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_ERRORCHECK_NP) } }"
+.LASF690:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF3694:
+	.string	"min<long unsigned int>"
+.LASF2471:
+	.string	"L_SET SEEK_SET"
+.LASF2707:
+	.string	"_SC_TRACE_USER_EVENT_MAX _SC_TRACE_USER_EVENT_MAX"
+.LASF2371:
+	.string	"STATX_ATTR_MOUNT_ROOT 0x00002000"
+.LASF951:
+	.string	"_GLIBCXX_HOSTED 1"
+.LASF4071:
+	.string	"fpos_t"
+.LASF2841:
+	.string	"CLONE_NEWUSER 0x10000000"
+.LASF3804:
+	.string	"_M_current"
+.LASF1994:
+	.string	"EKEYREVOKED 128"
+.LASF2205:
+	.string	"S_IFBLK __S_IFBLK"
+.LASF910:
+	.string	"_GLIBCXX_HAVE_TANL 1"
+.LASF3683:
+	.string	"remove_reference<long unsigned int const&>"
+.LASF2516:
+	.string	"_SC_SEMAPHORES _SC_SEMAPHORES"
+.LASF3902:
+	.string	"__int_least8_t"
+.LASF3606:
+	.string	"_ZNKSt6vectorImSaImEE4rendEv"
+.LASF4120:
+	.string	"mNumOfRecords"
+.LASF1585:
+	.string	"strxfrm"
+.LASF1583:
+	.string	"strstr"
+.LASF3387:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6insertEmPKc"
+.LASF3632:
+	.string	"_ZNSt6vectorImSaImEE9push_backEOm"
+.LASF821:
+	.string	"_GLIBCXX_HAVE_HYPOTF 1"
+.LASF476:
+	.string	"_GLIBCXX17_INLINE inline"
+.LASF4073:
+	.string	"st_dev"
+.LASF1459:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF3666:
+	.string	"_ZNSt6vectorImSaImEE8_M_eraseEN9__gnu_cxx17__normal_iteratorIPmS1_EE"
+.LASF207:
+	.string	"__GCC_IEC_559 2"
+.LASF2140:
+	.string	"POSIX_FADV_RANDOM 1"
+.LASF2039:
+	.string	"O_TRUNC 01000"
+.LASF817:
+	.string	"_GLIBCXX_HAVE_GETENTROPY 1"
+.LASF3011:
+	.string	"__need_ptrdiff_t"
+.LASF2198:
+	.string	"__S_IWRITE 0200"
+.LASF3980:
+	.string	"overflow_arg_area"
+.LASF3981:
+	.string	"reg_save_area"
+.LASF3923:
+	.string	"__syscall_slong_t"
+.LASF314:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF3908:
+	.string	"__int_least64_t"
+.LASF1604:
+	.string	"_GLIBCXX_CWCHAR 1"
+.LASF1364:
+	.string	"NFDBITS __NFDBITS"
+.LASF2395:
+	.string	"_POSIX_SAVED_IDS 1"
+.LASF1966:
+	.string	"ENETDOWN 100"
+.LASF586:
+	.string	"__USE_XOPEN2K8 1"
+.LASF3733:
+	.string	"_Destroy<long unsigned int*>"
+.LASF1872:
+	.string	"ENXIO 6"
+.LASF1561:
+	.string	"_STRINGS_H 1"
+.LASF879:
+	.string	"_GLIBCXX_HAVE_STDALIGN_H 1"
+.LASF3313:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4EOS4_RKS3_"
+.LASF2296:
+	.string	"MREMAP_MAYMOVE 1"
+.LASF3212:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE16find_last_not_ofEcm"
+.LASF2816:
+	.string	"SCHED_ISO 4"
+.LASF2768:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LIBS _CS_POSIX_V7_ILP32_OFFBIG_LIBS"
+.LASF984:
+	.string	"_GLIBCXX_USE_PTHREAD_RWLOCK_T 1"
+.LASF1435:
+	.string	"strtoll"
+.LASF233:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF240:
+	.string	"__DBL_DENORM_MIN__ double(4.94065645841246544176568792868221372e-324L)"
+.LASF2046:
+	.string	"__O_DIRECTORY 0200000"
+.LASF2528:
+	.string	"_SC_SEM_NSEMS_MAX _SC_SEM_NSEMS_MAX"
+.LASF2267:
+	.string	"MADV_SEQUENTIAL 2"
+.LASF2380:
+	.string	"_POSIX2_C_VERSION __POSIX2_THIS_VERSION"
+.LASF2580:
+	.string	"_SC_NPROCESSORS_CONF _SC_NPROCESSORS_CONF"
+.LASF3616:
+	.string	"_ZNKSt6vectorImSaImEE8capacityEv"
+.LASF845:
+	.string	"_GLIBCXX_HAVE_LOG10F 1"
+.LASF3311:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC4ESt16initializer_listIcERKS3_"
+.LASF3659:
+	.string	"_ZNKSt6vectorImSaImEE12_M_check_lenEmPKc"
+.LASF1611:
+	.string	"fwprintf"
+.LASF900:
+	.string	"_GLIBCXX_HAVE_SYS_STATVFS_H 1"
+.LASF571:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF400:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1254:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF604:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF629:
+	.string	"__END_DECLS }"
+.LASF2574:
+	.string	"_SC_THREAD_ATTR_STACKADDR _SC_THREAD_ATTR_STACKADDR"
+.LASF716:
+	.string	"_GLIBCXX_USE_C99_STDLIB _GLIBCXX11_USE_C99_STDLIB"
+.LASF624:
+	.string	"__PMT(args) args"
+.LASF729:
+	.string	"_PSTL_ASSERT(_Condition) __glibcxx_assert(_Condition)"
+.LASF610:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF3017:
+	.string	"_GLIBCXX_EH_PTR_USED "
+.LASF1036:
+	.string	"__cpp_lib_is_aggregate 201703L"
+.LASF3487:
+	.string	"~exception_ptr"
+.LASF155:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF3518:
+	.string	"_ZNSaImEaSERKS_"
+.LASF3258:
+	.string	"_M_set_length"
+.LASF3739:
+	.string	"_ZSt11__equal_auxIPKcPcEbT_S3_T0_"
+.LASF3961:
+	.string	"int_least64_t"
+.LASF4050:
+	.string	"int_frac_digits"
+.LASF433:
+	.string	"__unix__ 1"
+.LASF2310:
+	.string	"S_ISBLK(mode) __S_ISTYPE((mode), __S_IFBLK)"
+.LASF2336:
+	.string	"__DECLARE_FLEX_ARRAY(TYPE,NAME) struct { struct { } __empty_ ## NAME; TYPE NAME[]; }"
+.LASF870:
+	.string	"_GLIBCXX_HAVE_SINCOSF 1"
+.LASF1984:
+	.string	"ENOTNAM 118"
+.LASF1719:
+	.string	"LC_ALL_MASK (LC_CTYPE_MASK | LC_NUMERIC_MASK | LC_TIME_MASK | LC_COLLATE_MASK | LC_MONETARY_MASK | LC_MESSAGES_MASK | LC_PAPER_MASK | LC_NAME_MASK | LC_ADDRESS_MASK | LC_TELEPHONE_MASK | LC_MEASUREMENT_MASK | LC_IDENTIFICATION_MASK )"
+.LASF2697:
+	.string	"_SC_IPV6 _SC_IPV6"
+.LASF139:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF2755:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LDFLAGS _CS_POSIX_V6_LP64_OFF64_LDFLAGS"
+.LASF2227:
+	.string	"X_OK 1"
+.LASF409:
+	.string	"__amd64__ 1"
+.LASF1563:
+	.string	"_GLIBCXX_CSTRING 1"
+.LASF3438:
+	.string	"_ZNKSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12find_last_ofERKS4_m"
+.LASF4072:
+	.string	"stat"
+.LASF981:
+	.string	"_GLIBCXX_USE_PTHREAD_COND_CLOCKWAIT 1"
+.LASF886:
+	.string	"_GLIBCXX_HAVE_STRING_H 1"
+.LASF341:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF3459:
+	.string	"initializer_list<char>"
+.LASF3163:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE3endEv"
+.LASF2554:
+	.string	"_SC_POLL _SC_POLL"
+.LASF1849:
+	.string	"setvbuf"
+.LASF1211:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF99:
+	.string	"__cpp_alias_templates 200704L"
+.LASF2206:
+	.string	"S_IFREG __S_IFREG"
+.LASF2222:
+	.string	"S_IWOTH (S_IWGRP >> 3)"
+.LASF216:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF211:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF4016:
+	.string	"_freeres_list"
+.LASF1278:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF3952:
+	.string	"par_unseq"
+.LASF298:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF3900:
+	.string	"__int64_t"
+.LASF2142:
+	.string	"POSIX_FADV_WILLNEED 3"
+.LASF1877:
+	.string	"EAGAIN 11"
+.LASF1554:
+	.string	"WCHAR_WIDTH 32"
+.LASF1043:
+	.string	"__cpp_lib_tuple_element_t 201402L"
+.LASF251:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1401:
+	.string	"_GLIBCXX_BITS_STD_ABS_H "
+.LASF3681:
+	.string	"iterator_traits<long unsigned int*>"
+.LASF2858:
+	.ascii	"__CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension_"
+	.ascii	"_ ({ cpu_set_t *__dest = (destset); const __cp"
+	.string	"u_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))"
+.LASF3526:
+	.string	"__destroy<long unsigned int*>"
+.LASF2120:
+	.string	"F_SEAL_SEAL 0x0001"
+.LASF1485:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1438:
+	.string	"strtold"
+.LASF4058:
+	.string	"int_p_cs_precedes"
+.LASF1161:
+	.string	"__DEFINED_wchar_t "
+.LASF124:
+	.string	"__cpp_variadic_using 201611L"
+.LASF370:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF654:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1659:
+	.string	"wprintf"
+.LASF1678:
+	.string	"_GLIBCXX_CXX_LOCALE_H 1"
+.LASF1944:
+	.string	"EREMCHG 78"
+.LASF3319:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEaSEOS4_"
+.LASF3991:
+	.string	"_IO_FILE"
+.LASF3118:
+	.string	"_ZNSt15__new_allocatorIcE10deallocateEPcm"
+.LASF653:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF2372:
+	.string	"STATX_ATTR_VERITY 0x00100000"
+.LASF3610:
+	.string	"_ZNKSt6vectorImSaImEE5crendEv"
+.LASF1577:
+	.string	"strncat"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF2217:
+	.string	"S_IRGRP (S_IRUSR >> 3)"
+.LASF1265:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF325:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2264:
+	.string	"MS_INVALIDATE 2"
+.LASF2653:
+	.string	"_SC_REGEX_VERSION _SC_REGEX_VERSION"
+.LASF2244:
+	.string	"MAP_SYNC 0x80000"
+.LASF1005:
+	.string	"__throw_exception_again throw"
+.LASF3775:
+	.string	"_ZN9__gnu_cxx14__alloc_traitsISaIcEcE15_S_nothrow_moveEv"
+.LASF1087:
+	.string	"__glibcxx_requires_irreflexive(_First,_Last) "
+.LASF1928:
+	.string	"ETIME 62"
+.LASF1969:
+	.string	"ECONNABORTED 103"
+.LASF2853:
+	.string	"__CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))"
+.LASF2563:
+	.string	"_SC_T_IOV_MAX _SC_T_IOV_MAX"
+.LASF3101:
+	.string	"ptrdiff_t"
+.LASF1387:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF465:
+	.string	"_GLIBCXX17_DEPRECATED_SUGGEST(ALT) _GLIBCXX_DEPRECATED_SUGGEST(ALT)"
+.LASF1684:
+	.string	"__LC_COLLATE 3"
+.LASF2056:
+	.string	"F_SETLKW F_SETLKW64"
+.LASF781:
+	.string	"_GLIBCXX_HAVE_ATAN2L 1"
+.LASF165:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF3687:
+	.string	"_Iterator"
+.LASF1386:
+	.string	"__ONCE_ALIGNMENT "
+.LASF213:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF3467:
+	.string	"reverse_iterator<char const*>"
+.LASF3130:
+	.string	"basic_string_view<char, std::char_traits<char> >"
+.LASF2784:
+	.string	"CLOSE_RANGE_UNSHARE (1U << 1)"
+.LASF3978:
+	.string	"gp_offset"
+.LASF2028:
+	.string	"F_GETLK64 5"
+.LASF1751:
+	.string	"_CXXABI_FORCED_H 1"
+.LASF225:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF989:
+	.string	"_GLIBCXX_USE_SENDFILE 1"
+.LASF3392:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE5eraseEmm"
+.LASF3153:
+	.string	"crend"
+.LASF3010:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF3:
+	.string	"__cplusplus 201703L"
+.LASF1150:
+	.string	"_T_WCHAR "
+.LASF3903:
+	.string	"__uint_least8_t"
+.LASF2550:
+	.string	"_SC_PII_XTI _SC_PII_XTI"
+.LASF3547:
+	.string	"_ZNKSt12_Vector_baseImSaImEE19_M_get_Tp_allocatorEv"
+.LASF1280:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF3375:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE6assignEOS4_"
+.LASF3551:
+	.string	"_ZNSt12_Vector_baseImSaImEEC4ERKS0_"
+.LASF463:
+	.string	"_GLIBCXX14_DEPRECATED_SUGGEST(ALT) _GLIBCXX_DEPRECATED_SUGGEST(ALT)"
+.LASF1576:
+	.string	"strlen"
+.LASF3135:
+	.string	"_ZNSt17basic_string_viewIcSt11char_traitsIcEEC4EPKcm"
+.LASF616:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF3185:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareEmmPKcm"
+.LASF2256:
+	.string	"MAP_FIXED 0x10"
+.LASF205:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF2295:
+	.string	"MCL_ONFAULT 4"
+.LASF2661:
+	.string	"_SC_TIMEOUTS _SC_TIMEOUTS"
+.LASF1817:
+	.string	"_GLIBCXX_CSTDIO 1"
+.LASF2062:
+	.string	"O_NOFOLLOW __O_NOFOLLOW"
+.LASF2387:
+	.string	"_XOPEN_XPG2 1"
+.LASF1331:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF3916:
+	.string	"__mode_t"
+.LASF1821:
+	.string	"ferror"
+.LASF2113:
+	.string	"DN_ACCESS 0x00000001"
+.LASF1709:
+	.string	"LC_TIME_MASK (1 << __LC_TIME)"
+.LASF1144:
+	.string	"__size_t "
+.LASF1558:
+	.string	"__CORRECT_ISO_CPP_STRING_H_PROTO "
+.LASF3652:
+	.string	"_M_shrink_to_fit"
+.LASF3936:
+	.string	"_ZN6__pstl9execution2v116sequenced_policy19__allow_unsequencedEv"
+.LASF187:
+	.string	"__UINT16_C(c) c"
+.LASF1350:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF450:
+	.string	"_GLIBCXX_RELEASE 12"
+.LASF110:
+	.string	"__cpp_enumerator_attributes 201411L"
+.LASF1178:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1813:
+	.string	"RENAME_EXCHANGE (1 << 1)"
+.LASF645:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2326:
+	.string	"_LINUX_TYPES_H "
+.LASF1692:
+	.string	"__LC_MEASUREMENT 11"
+.LASF3095:
+	.string	"_ZNSt11char_traitsIcE11to_int_typeERKc"
+.LASF2878:
+	.string	"CPU_OR(destset,srcset1,srcset2) __CPU_OP_S (sizeof (cpu_set_t), destset, srcset1, srcset2, |)"
+.LASF3698:
+	.string	"_ZSt14__relocate_a_1ImmENSt9enable_ifIXsrSt24__is_bitwise_relocatableIT_vE5valueEPS2_E4typeES4_S4_S4_RSaIT0_E"
+.LASF85:
+	.string	"__cpp_raw_strings 200710L"
+.LASF2829:
+	.string	"CLONE_THREAD 0x00010000"
+.LASF1624:
+	.string	"vfwprintf"
+.LASF338:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF3504:
+	.string	"_ZNSt15__new_allocatorImEC4Ev"
+.LASF3926:
+	.string	"int32_t"
+.LASF4027:
+	.string	"tm_sec"
+.LASF1601:
+	.string	"__CORRECT_ISO_CPP_WCHAR_H_PROTO "
+.LASF776:
+	.string	"_GLIBCXX_HAVE_ARPA_INET_H 1"
+.LASF2491:
+	.string	"_PC_REC_XFER_ALIGN _PC_REC_XFER_ALIGN"
+.LASF3794:
+	.string	"operator+"
+.LASF441:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1792:
+	.string	"BUFSIZ 8192"
+.LASF2582:
+	.string	"_SC_PHYS_PAGES _SC_PHYS_PAGES"
+.LASF3081:
+	.string	"length"
+.LASF3966:
+	.string	"int_fast8_t"
+.LASF2273:
+	.string	"MADV_DOFORK 11"
+.LASF1864:
+	.string	"_BITS_ERRNO_H 1"
+.LASF1643:
+	.string	"wcsrchr"
+.LASF3962:
+	.string	"uint_least8_t"
+.LASF769:
+	.string	"_PSTL_PRAGMA_MESSAGE_POLICIES(x) "
+.LASF282:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF3924:
+	.string	"int8_t"
+.LASF2713:
+	.string	"_CS_PATH _CS_PATH"
+.LASF1461:
+	.string	"__intptr_t_defined "
+.LASF2832:
+	.string	"CLONE_SETTLS 0x00080000"
+.LASF3757:
+	.string	"operator()<__gnu_cxx::__normal_iterator<long unsigned int const*, std::vector<long unsigned int> >, unsigned int const>"
+.LASF2401:
+	.string	"_POSIX_MEMLOCK_RANGE 200809L"
+.LASF1523:
+	.string	"INT8_WIDTH 8"
+.LASF1609:
+	.string	"fputws"
+.LASF1115:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1726:
+	.string	"_GLIBCXX_IOSFWD 1"
+.LASF2609:
+	.string	"_SC_SCHAR_MIN _SC_SCHAR_MIN"
+.LASF2410:
+	.string	"_POSIX_REENTRANT_FUNCTIONS 1"
+.LASF1640:
+	.string	"wcsncmp"
+.LASF1842:
+	.string	"putchar"
+.LASF3680:
+	.string	"iterator_traits<char*>"
+.LASF3745:
+	.string	"_ZSt5equalIPKcPcEbT_S3_T0_"
+.LASF2092:
+	.string	"F_ADD_SEALS 1033"
+.LASF1697:
+	.string	"LC_COLLATE __LC_COLLATE"
+.LASF3628:
+	.string	"_ZNKSt6vectorImSaImEE4backEv"
+.LASF3989:
+	.string	"mbstate_t"
+.LASF752:
+	.string	"_PSTL_CPP14_2RANGE_MISMATCH_EQUAL_PRESENT (_MSC_VER >= 1900 || __cplusplus >= 201300L || __cpp_lib_robust_nonmodifying_seq_ops == 201304)"
+.LASF1580:
+	.string	"strpbrk"
+.LASF2019:
+	.string	"_GLIBCXX_ASAN_ANNOTATE_BEFORE_DEALLOC "
+.LASF3269:
+	.string	"_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEE12_M_constructEmc"
+.LASF3982:
+	.string	"wint_t"
+.LASF368:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF713:
+	.string	"_GLIBCXX_USE_C99_MATH _GLIBCXX11_USE_C99_MATH"
+.LASF24:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2909:
+	.string	"ADJ_SETOFFSET 0x0100"
+.LASF985:
+	.string	"_GLIBCXX_USE_RANDOM_TR1 1"
+.LASF1234:
+	.string	"_BITS_TYPES_H 1"
+.LASF4208:
+	.string	"_ZN9simulator13result_readerD2Ev"
+.LASF1288:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2390:
+	.string	"_XOPEN_UNIX 1"
+.LASF2885:
+	.string	"CPU_FREE(cpuset) __CPU_FREE (cpuset)"
+.LASF2798:
+	.string	"_SHARED_PTR_BASE_H 1"
+.LASF2951:
+	.string	"PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE"
+.LASF3816:
+	.string	"_ZN9__gnu_cxx17__normal_iteratorIPKcNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEEmIEl"
+.LASF3960:
+	.string	"int_least32_t"
+.LASF369:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF2162:
+	.string	"AT_FDCWD -100"
+.LASF4125:
+	.string	"_ZN9simulator13result_readerC4ERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE"
+.LASF4017:
+	.string	"_freeres_buf"
+.LASF2914:
+	.string	"ADJ_OFFSET_SS_READ 0xa001"
+.LASF2082:
+	.string	"__F_GETOWN_EX 16"
+.LASF3180:
+	.string	"_ZNKSt17basic_string_viewIcSt11char_traitsIcEE7compareES2_"
+.LASF3695:
+	.string	"_ZSt3minImERKT_S2_S2_"
+.LASF3750:
+	.string	"unsigned int"
+.LASF1702:
+	.string	"LC_NAME __LC_NAME"
+.LASF3327:
+	.string	"reverse_iterator"
+.LASF2094:
+	.string	"F_GET_RW_HINT 1035"
+.LASF239:
+	.string	"__DBL_EPSILON__ double(2.22044604925031308084726333618164062e-16L)"
+.LASF3070:
+	.string	"_Destroy_aux<true>"
+.LASF1409:
+	.string	"bsearch"
+.LASF2797:
+	.string	"_SHARED_PTR_H 1"
+.LASF2515:
+	.string	"_SC_MESSAGE_PASSING _SC_MESSAGE_PASSING"
+.LASF1202:
+	.string	"__CFLOAT128 __cfloat128"
+.LASF395:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF863:
+	.string	"_GLIBCXX_HAVE_POWF 1"
+.LASF540:
+	.string	"__USE_ATFILE"
+.LASF3862:
+	.string	"_ZNK9__gnu_cxx17__normal_iteratorIPKmSt6vectorImSaImEEE4baseEv"
+.LASF2839:
+	.string	"CLONE_NEWUTS 0x04000000"
+.LASF2760:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LIBS _CS_POSIX_V6_LPBIG_OFFBIG_LIBS"
+.LASF1368:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1399:
+	.string	"__COMPAR_FN_T "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"./src/main/result_reader.cpp"
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits